@@ -67,6 +67,49 @@ int arch_dcache_flush_and_invd_range(void *start_addr, size_t size)
 	return 0;
 }
 
+/* Same as the CMSIS by-address operations, but with the barriers issued once
+ * for all the ranges rather than around each of them.
+ */
+static void dcache_ranges(const struct sys_cache_range *ranges, size_t count,
+			  volatile uint32_t *op)
+{
+	__DSB();
+
+	for (size_t i = 0; i < count; i++) {
+		uintptr_t addr = (uintptr_t)ranges[i].addr;
+		uintptr_t end = addr + ranges[i].size;
+
+		for (addr &= ~(uintptr_t)(__SCB_DCACHE_LINE_SIZE - 1U); addr < end;
+		     addr += __SCB_DCACHE_LINE_SIZE) {
+			*op = addr;
+		}
+	}
+
+	__DSB();
+	__ISB();
+}
+
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	dcache_ranges(ranges, count, &SCB->DCCMVAC);
+
+	return 0;
+}
+
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	dcache_ranges(ranges, count, &SCB->DCIMVAC);
+
+	return 0;
+}
+
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	dcache_ranges(ranges, count, &SCB->DCCIMVAC);
+
+	return 0;
+}
+
 void arch_icache_enable(void)
 {
 	SCB_EnableICache();
@@ -55,8 +55,13 @@ FUNC_ALIAS(z_arm_exc_exit, z_arm_int_exit, void);
 Z_GENERIC_SECTION(.text._HandlerModeExit) void z_arm_exc_exit(void)
 {
 #ifdef CONFIG_PREEMPT_ENABLED
+	/* PendSV has the lowest priority, so it is tail-chained once after
+	 * the last of back-to-back ISRs however many of them pend it. The
+	 * other ICSR bits ignore a write of zero, so there is no need to read
+	 * the register first.
+	 */
 	if (_kernel.ready_q.cache != _kernel.cpus->current) {
-		SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
+		SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
 	}
 #endif /* CONFIG_PREEMPT_ENABLED */
 
@@ -0,0 +1,37 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/cache.h>
+
+static int dcache_ranges(const struct sys_cache_range *ranges, size_t count, int op)
+{
+	for (size_t i = 0; i < count; i++) {
+		int ret = arm64_dcache_range_nosync(ranges[i].addr, ranges[i].size, op);
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	barrier_dsync_fence_full();
+
+	return 0;
+}
+
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	return dcache_ranges(ranges, count, K_CACHE_WB);
+}
+
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	return dcache_ranges(ranges, count, K_CACHE_INVD);
+}
+
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	return dcache_ranges(ranges, count, K_CACHE_WB_INVD);
+}
@@ -175,51 +175,6 @@ void arch_flush_local_fpu(void)
 	}
 }
 
-#ifdef CONFIG_SMP
-static void flush_owned_fpu(struct k_thread *thread)
-{
-	__ASSERT(read_daif() & DAIF_IRQ_BIT, "must be called with IRQs disabled");
-
-	int i;
-
-	/* search all CPUs for the owner we want */
-	unsigned int num_cpus = arch_num_cpus();
-
-	for (i = 0; i < num_cpus; i++) {
-		if (atomic_ptr_get(&_kernel.cpus[i].arch.fpu_owner) != thread) {
-			continue;
-		}
-		/* we found it live on CPU i */
-		if (i == _current_cpu->id) {
-			arch_flush_local_fpu();
-		} else {
-			/* the FPU context is live on another CPU */
-			arch_flush_fpu_ipi(i);
-
-			/*
-			 * Wait for it only if this is about the thread
-			 * currently running on this CPU. Otherwise the
-			 * other CPU running some other thread could regain
-			 * ownership the moment it is removed from it and
-			 * we would be stuck here.
-			 *
-			 * Also, if this is for the thread running on this
-			 * CPU, then we preemptively flush any live context
-			 * on this CPU as well since we're likely to
-			 * replace it, and this avoids a deadlock where
-			 * two CPUs want to pull each other's FPU context.
-			 */
-			if (thread == _current) {
-				arch_flush_local_fpu();
-				while (atomic_ptr_get(&_kernel.cpus[i].arch.fpu_owner) == thread) {
-					barrier_dsync_fence_full();
-				}
-			}
-		}
-		break;
-	}
-}
-#endif
 
 void z_arm64_fpu_enter_exc(void)
 {
@@ -366,7 +321,7 @@ void z_arm64_fpu_trap(struct arch_esf *esf, uint32_t exception_class)
 	 * Make sure the FPU context we need isn't live on another CPU.
 	 * The current CPU's FPU context is NULL at this point.
 	 */
-	flush_owned_fpu(_current);
+	z_float_flush_owned(_current);
 #endif
 
 	/* become new owner */
@@ -426,29 +381,33 @@ static void fpu_access_update(unsigned int exc_update_level)
 	__ASSERT(read_daif() & DAIF_IRQ_BIT, "must be called with IRQs disabled");
 
 	uint64_t cpacr = read_cpacr_el1();
+	uint64_t new_cpacr = cpacr & ~(CPACR_EL1_FPEN | CPACR_EL1_ZEN);
 
 	if (arch_exception_depth() == exc_update_level) {
 		/* We're about to execute non-exception code */
 		if (atomic_ptr_get(&_current_cpu->arch.fpu_owner) == _current) {
 			/* turn on FPU access */
-			cpacr |= CPACR_EL1_FPEN;
+			new_cpacr |= CPACR_EL1_FPEN;
 			if (USE_SVE(_current)) {
-				cpacr |= CPACR_EL1_ZEN;
+				new_cpacr |= CPACR_EL1_ZEN;
 			}
-			write_cpacr_el1(cpacr);
-		} else {
-			/* deny FPU access */
-			write_cpacr_el1(cpacr & ~(CPACR_EL1_FPEN | CPACR_EL1_ZEN));
 		}
-	} else {
-		/*
-		 * Any new exception level should always trap on FPU
-		 * access as we want to make sure IRQs are disabled before
-		 * granting it access (see z_arm64_fpu_trap() documentation).
-		 */
-		write_cpacr_el1(cpacr & ~(CPACR_EL1_FPEN | CPACR_EL1_ZEN));
+		/* otherwise deny FPU access */
+	}
+	/*
+	 * Any new exception level should always trap on FPU
+	 * access as we want to make sure IRQs are disabled before
+	 * granting it access (see z_arm64_fpu_trap() documentation).
+	 */
+
+	/*
+	 * Most exception exits and context switches leave the access
+	 * unchanged: skip the write and the context synchronization then.
+	 */
+	if (new_cpacr != cpacr) {
+		write_cpacr_el1(new_cpacr);
+		barrier_isync_fence_full();
 	}
-	barrier_isync_fence_full();
 }
 
 /*
@@ -479,7 +438,7 @@ int arch_float_disable(struct k_thread *thread)
 		thread->base.user_options &= ~K_FP_REGS;
 
 #ifdef CONFIG_SMP
-		flush_owned_fpu(thread);
+		z_float_flush_owned(thread);
 #else
 		if (thread == atomic_ptr_get(&_current_cpu->arch.fpu_owner)) {
 			arch_flush_local_fpu();
@@ -50,11 +50,6 @@ extern void z_arm64_fatal_error(unsigned int reason, struct arch_esf *esf);
 extern void z_arm64_set_ttbr0(uint64_t ttbr0);
 extern void z_arm64_mem_cfg_ipi(void);
 
-#ifdef CONFIG_FPU_SHARING
-void arch_flush_local_fpu(void);
-void arch_flush_fpu_ipi(unsigned int cpu);
-#endif
-
 #ifdef CONFIG_ARM64_SAFE_EXCEPTION_STACK
 void z_arm64_safe_exception_stack_init(void);
 #endif
@@ -94,7 +94,7 @@ static void z_riscv_fpu_load(void)
  * Flush FPU content and clear ownership. If the saved FPU state is "clean"
  * then we know the in-memory copy is up to date and skip the FPU content
  * transfer. The saved FPU state is updated upon disabling FPU access so
- * we require that this be called only when the FPU is disabled.
+ * FPU access is disabled first if it is still granted.
  *
  * This is called locally and also from flush_fpu_ipi_handler().
  */
@@ -102,8 +102,8 @@ void arch_flush_local_fpu(void)
 {
 	__ASSERT((csr_read(mstatus) & MSTATUS_IEN) == 0,
 		 "must be called with IRQs disabled");
-	__ASSERT((csr_read(mstatus) & MSTATUS_FS) == 0,
-		 "must be called with FPU access disabled");
+
+	z_riscv_fpu_disable();
 
 	struct k_thread *owner = atomic_ptr_get(&_current_cpu->arch.fpu_owner);
 
@@ -129,57 +129,6 @@ void arch_flush_local_fpu(void)
 	}
 }
 
-#ifdef CONFIG_SMP
-static void flush_owned_fpu(struct k_thread *thread)
-{
-	__ASSERT((csr_read(mstatus) & MSTATUS_IEN) == 0,
-		 "must be called with IRQs disabled");
-
-	int i;
-	atomic_ptr_val_t owner;
-
-	/* search all CPUs for the owner we want */
-	unsigned int num_cpus = arch_num_cpus();
-
-	for (i = 0; i < num_cpus; i++) {
-		owner = atomic_ptr_get(&_kernel.cpus[i].arch.fpu_owner);
-		if (owner != thread) {
-			continue;
-		}
-		/* we found it live on CPU i */
-		if (i == _current_cpu->id) {
-			z_riscv_fpu_disable();
-			arch_flush_local_fpu();
-			break;
-		}
-		/* the FPU context is live on another CPU */
-		arch_flush_fpu_ipi(i);
-
-		/*
-		 * Wait for it only if this is about the thread
-		 * currently running on this CPU. Otherwise the
-		 * other CPU running some other thread could regain
-		 * ownership the moment it is removed from it and
-		 * we would be stuck here.
-		 *
-		 * Also, if this is for the thread running on this
-		 * CPU, then we preemptively flush any live context
-		 * on this CPU as well since we're likely to
-		 * replace it, and this avoids a deadlock where
-		 * two CPUs want to pull each other's FPU context.
-		 */
-		if (thread == _current) {
-			z_riscv_fpu_disable();
-			arch_flush_local_fpu();
-			do {
-				arch_nop();
-				owner = atomic_ptr_get(&_kernel.cpus[i].arch.fpu_owner);
-			} while (owner == thread);
-		}
-		break;
-	}
-}
-#endif
 
 void z_riscv_fpu_enter_exc(void)
 {
@@ -233,7 +182,7 @@ void z_riscv_fpu_trap(struct arch_esf *esf)
 	 * Make sure the FPU context we need isn't live on another CPU.
 	 * The current CPU's FPU context is NULL at this point.
 	 */
-	flush_owned_fpu(_current);
+	z_float_flush_owned(_current);
 #endif
 
 	/* make it accessible and clean to the returning context */
@@ -273,7 +222,7 @@ static bool fpu_access_allowed(unsigned int exc_update_level)
 			z_riscv_fpu_disable();
 			arch_flush_local_fpu();
 #ifdef CONFIG_SMP
-			flush_owned_fpu(_current);
+			z_float_flush_owned(_current);
 #endif
 			z_riscv_fpu_load();
 			_current_cpu->arch.fpu_state = MSTATUS_FS_CLEAN;
@@ -325,7 +274,7 @@ int arch_float_disable(struct k_thread *thread)
 		unsigned int key = arch_irq_lock();
 
 #ifdef CONFIG_SMP
-		flush_owned_fpu(thread);
+		z_float_flush_owned(thread);
 #else
 		if (thread == _current_cpu->arch.fpu_owner) {
 			z_riscv_fpu_disable();
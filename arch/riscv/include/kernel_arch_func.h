@@ -97,11 +97,6 @@ extern FUNC_NORETURN void z_riscv_userspace_enter(k_thread_entry_t user_entry,
 int z_irq_do_offload(void);
 #endif
 
-#ifdef CONFIG_FPU_SHARING
-void arch_flush_local_fpu(void);
-void arch_flush_fpu_ipi(unsigned int cpu);
-#endif
-
 #ifndef CONFIG_MULTITHREADING
 extern FUNC_NORETURN void z_riscv_switch_to_main_no_multithreading(
 	k_thread_entry_t main_func, void *p1, void *p2, void *p3);
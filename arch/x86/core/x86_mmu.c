@@ -968,6 +968,140 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
 	return old_val;
 }
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+#define LARGE_PAGE_SIZE		get_entry_scope(PDE_LEVEL)
+
+/* Page tables displaced by large page mappings, linked through their first
+ * entry. There is one per large page mapped with range_map(), so splitting
+ * these never runs out of page tables. Large pages copied into the page
+ * tables of a new memory domain did not displace any, those fall back to
+ * the page pool.
+ */
+__pinned_bss
+static pentry_t *spare_tables;
+
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_X86_COMMON_PAGE_TABLE)
+static void *page_pool_get(void);
+#endif
+
+__pinned_func
+static void spare_table_put(pentry_t *table)
+{
+	*(pentry_t **)table = spare_tables;
+	spare_tables = table;
+}
+
+__pinned_func
+static pentry_t *spare_table_get(void)
+{
+	pentry_t *table = spare_tables;
+
+	if (table != NULL) {
+		spare_tables = *(pentry_t **)table;
+	}
+
+	return table;
+}
+
+/**
+ * Replace a large page by a page table with the same mappings
+ *
+ * x86_mmu_lock must be held.
+ *
+ * @param pde Page directory entry of the large page
+ * @param virt Virtual address within the large page
+ *
+ * @retval 0 if successful
+ * @retval -ENOMEM if no page table is available
+ */
+__pinned_func
+static int large_page_split(pentry_t *pde, void *virt)
+{
+	pentry_t *table = spare_table_get();
+	pentry_t pde_val = *pde;
+	pentry_t pte_val;
+
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_X86_COMMON_PAGE_TABLE)
+	if (table == NULL) {
+		table = page_pool_get();
+	}
+#endif
+
+	CHECKIF(table == NULL) {
+		LOG_ERR("no page table to split large page at %p", virt);
+		return -ENOMEM;
+	}
+
+	/* Same flags, without the page size bit which is the PAT bit of PTEs */
+	pte_val = pde_val & ~MMU_PS;
+	for (int i = 0; i < get_num_entries(PTE_LEVEL); i++) {
+		table[i] = pte_val + ((pentry_t)i * CONFIG_MMU_PAGE_SIZE);
+	}
+
+	*pde = (pentry_t)k_mem_phys_addr(table) | INT_FLAGS;
+	tlb_flush_page(virt);
+
+	return 0;
+}
+
+/**
+ * Map a whole large page, if the page tables allow it
+ *
+ * Only done when the page directory entry currently points to a page table,
+ * which is kept to split the large page later.
+ *
+ * x86_mmu_lock must be held.
+ *
+ * @retval true if the large page was mapped
+ * @retval false if the range must be mapped with regular pages
+ */
+__pinned_func
+static bool large_page_map(pentry_t *ptables, uint8_t *virt, pentry_t entry_val,
+			   size_t size, pentry_t mask, uint32_t options)
+{
+	pentry_t *table = ptables;
+	pentry_t *pdep;
+	pentry_t old_val;
+
+	if ((size < LARGE_PAGE_SIZE) || (mask != MASK_ALL) || ((entry_val & MMU_P) == 0U) ||
+	    ((options & (OPTION_RESET | OPTION_CLEAR)) != 0U) ||
+	    ((POINTER_TO_UINT(virt) & (LARGE_PAGE_SIZE - 1)) != 0U) ||
+	    ((get_entry_phys(entry_val, PTE_LEVEL) & (LARGE_PAGE_SIZE - 1)) != 0U)) {
+		return false;
+	}
+
+	for (int level = 0; level < PDE_LEVEL; level++) {
+		pentry_t entry = get_entry(table, virt, level);
+
+		if (((entry & MMU_P) == 0U) || is_leaf(level, entry)) {
+			return false;
+		}
+		table = next_table(entry, level);
+	}
+
+	pdep = get_entry_ptr(table, virt, PDE_LEVEL);
+	old_val = *pdep;
+	if ((old_val & MMU_P) == 0U) {
+		return false;
+	}
+
+	*pdep = entry_val | MMU_PS;
+
+	if ((old_val & MMU_PS) == 0U) {
+		spare_table_put(next_table(old_val, PDE_LEVEL));
+	}
+
+	if ((options & OPTION_FLUSH) != 0U) {
+		for (size_t offset = 0; offset < LARGE_PAGE_SIZE;
+		     offset += CONFIG_MMU_PAGE_SIZE) {
+			tlb_flush_page(virt + offset);
+		}
+	}
+
+	return true;
+}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 /**
  * Low level page table update function for a virtual page
  *
@@ -998,6 +1132,7 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
  *
  * @retval 0 if successful
  * @retval -EFAULT if large page encountered or missing page table level
+ * @retval -ENOMEM if a large page could not be split
  */
 __pinned_func
 static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
@@ -1024,6 +1159,16 @@ static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
 			break;
 		}
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+		if ((level == PDE_LEVEL) && ((*entryp & MMU_P) != 0U) &&
+		    ((*entryp & MMU_PS) != 0U)) {
+			ret = large_page_split(entryp, virt);
+			if (ret != 0) {
+				goto out;
+			}
+		}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 		/* We bail out early here due to no support for
 		 * splitting existing bigpage mappings.
 		 * If the PS bit is not supported at some level (like
@@ -1124,6 +1269,14 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 			entry_val = (pentry_t)(phys + offset) | entry_flags;
 		}
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+		if (large_page_map(ptables, dest_virt, entry_val, size - offset,
+				   mask, options)) {
+			offset += LARGE_PAGE_SIZE - CONFIG_MMU_PAGE_SIZE;
+			continue;
+		}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 		ret2 = page_map_set(ptables, dest_virt, entry_val, NULL, mask,
 				   options);
 		ARG_UNUSED(ret2);
@@ -1313,6 +1466,21 @@ void arch_mem_unmap(void *addr, size_t size)
 	ARG_UNUSED(ret);
 }
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+/* Align virtual regions of large enough physical regions so that they can
+ * be mapped with large pages.
+ */
+__pinned_func
+size_t arch_virt_region_align(uintptr_t phys, size_t size)
+{
+	if ((size >= LARGE_PAGE_SIZE) && ((phys & (LARGE_PAGE_SIZE - 1)) == 0U)) {
+		return LARGE_PAGE_SIZE;
+	}
+
+	return CONFIG_MMU_PAGE_SIZE;
+}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 #ifdef K_MEM_IS_VM_KERNEL
 __boot_func
 static void identity_map_remove(uint32_t level)
@@ -2076,6 +2244,12 @@ int arch_page_phys_get(void *virt, uintptr_t *phys)
 	if ((pte & MMU_P) != 0) {
 		if (phys != NULL) {
 			*phys = (uintptr_t)get_entry_phys(pte, PTE_LEVEL);
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+			if (level == PDE_LEVEL) {
+				/* Offset of the page within the large page */
+				*phys += POINTER_TO_UINT(virt) & (LARGE_PAGE_SIZE - 1);
+			}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
 		}
 		ret = 0;
 	} else {
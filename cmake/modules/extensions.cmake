@@ -740,6 +740,42 @@ function(generate_inc_file_for_target
   generate_inc_file_for_gen_target(${target} ${source_file} ${generated_file} ${generated_target_name} ${ARGN})
 endfunction()
 
+# Generate a header defining a struct sys_perfect_hash named 'name',
+# a minimal perfect hash table over the keys listed one per line in
+# 'keys_file', for lookup with sys_perfect_hash_lookup().
+#
+# See tests/lib/perfect_hash for an example of usage.
+function(generate_perfect_hash
+    keys_file      # The file listing the keys
+    generated_file # The generated header file
+    name           # Name of the generated table
+    )
+  add_custom_command(
+    OUTPUT ${generated_file}
+    COMMAND
+    ${PYTHON_EXECUTABLE}
+    ${ZEPHYR_BASE}/scripts/build/gen_perfect_hash.py
+    --input ${keys_file}
+    --output ${generated_file}
+    --name ${name}
+    DEPENDS ${keys_file} ${ZEPHYR_BASE}/scripts/build/gen_perfect_hash.py
+    WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
+    )
+endfunction()
+
+function(generate_perfect_hash_for_target
+    target         # The cmake target that depends on the generated file
+    keys_file      # The file listing the keys
+    generated_file # The generated header file
+    name           # Name of the generated table
+    )
+  generate_unique_target_name_from_filename(${generated_file} generated_target_name)
+
+  add_custom_target(${generated_target_name} DEPENDS ${generated_file})
+  generate_perfect_hash(${keys_file} ${generated_file} ${name})
+  add_dependencies(${target} ${generated_target_name})
+endfunction()
+
 # 1.4. board_*
 #
 # This section is for extensions related to Zephyr board handling.
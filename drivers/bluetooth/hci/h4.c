@@ -236,6 +236,7 @@ static void rx_thread(void *p1, void *p2, void *p3)
 	const struct h4_config *cfg = dev->config;
 	struct h4_data *h4 = dev->data;
 	struct net_buf *buf;
+	uint8_t batch = 0U;
 
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
@@ -277,11 +278,16 @@ static void rx_thread(void *p1, void *p2, void *p3)
 			 * is receiving data so fast that rx.fifo never
 			 * or very rarely goes empty.
 			 */
-			k_yield();
+			if (++batch >= CONFIG_BT_H4_RX_BATCH) {
+				batch = 0U;
+				k_yield();
+			}
 
 			uart_irq_rx_disable(cfg->uart);
 			buf = k_fifo_get(&h4->rx.fifo, K_NO_WAIT);
 		}
+
+		batch = 0U;
 	}
 }
 
@@ -427,20 +433,26 @@ static inline void process_tx(const struct device *dev)
 		}
 	}
 
-	bytes = uart_fifo_fill(cfg->uart, h4->tx.buf->data, h4->tx.buf->len);
-	if (unlikely(bytes < 0)) {
-		LOG_ERR("Unable to write to UART (err %d)", bytes);
-	} else {
+	/* Keep filling the UART FIFO from the queued buffers until it is
+	 * full, instead of waiting for one TX interrupt per packet.
+	 */
+	do {
+		bytes = uart_fifo_fill(cfg->uart, h4->tx.buf->data, h4->tx.buf->len);
+		if (unlikely(bytes < 0)) {
+			LOG_ERR("Unable to write to UART (err %d)", bytes);
+			return;
+		}
+
 		net_buf_pull(h4->tx.buf, bytes);
-	}
+		if (h4->tx.buf->len) {
+			return;
+		}
 
-	if (h4->tx.buf->len) {
-		return;
-	}
+		h4->tx.type = BT_HCI_H4_NONE;
+		net_buf_unref(h4->tx.buf);
+		h4->tx.buf = k_fifo_get(&h4->tx.fifo, K_NO_WAIT);
+	} while (h4->tx.buf && bytes > 0);
 
-	h4->tx.type = BT_HCI_H4_NONE;
-	net_buf_unref(h4->tx.buf);
-	h4->tx.buf = k_fifo_get(&h4->tx.fifo, K_NO_WAIT);
 	if (!h4->tx.buf) {
 		uart_irq_tx_disable(cfg->uart);
 	}
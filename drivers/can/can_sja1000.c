@@ -148,6 +148,67 @@ int can_sja1000_get_capabilities(const struct device *dev, can_mode_t *cap)
 	return 0;
 }
 
+static void can_sja1000_write_acceptance(const struct device *dev, uint32_t acr, uint32_t amr)
+{
+	can_sja1000_write_reg(dev, CAN_SJA1000_ACR0, acr >> 24);
+	can_sja1000_write_reg(dev, CAN_SJA1000_ACR1, acr >> 16);
+	can_sja1000_write_reg(dev, CAN_SJA1000_ACR2, acr >> 8);
+	can_sja1000_write_reg(dev, CAN_SJA1000_ACR3, acr);
+
+	can_sja1000_write_reg(dev, CAN_SJA1000_AMR0, amr >> 24);
+	can_sja1000_write_reg(dev, CAN_SJA1000_AMR1, amr >> 16);
+	can_sja1000_write_reg(dev, CAN_SJA1000_AMR2, amr >> 8);
+	can_sja1000_write_reg(dev, CAN_SJA1000_AMR3, amr);
+}
+
+#ifdef CONFIG_CAN_SJA1000_HW_ACCEPTANCE
+/*
+ * In single filter mode, ACR0..ACR3 hold the 11-bit ID of standard frames in bits 31..21, and
+ * the 29-bit ID of extended frames in bits 31..3. Set AMR bits are don't care.
+ */
+static void can_sja1000_calc_acceptance(const struct can_filter *std, const struct can_filter *ext,
+					uint32_t *acr, uint32_t *amr)
+{
+	uint32_t care = 0U;
+	uint32_t code = 0U;
+
+	if (std != NULL && ext != NULL) {
+		/* Only the 11 most significant bits of extended IDs overlap standard IDs */
+		care = std->mask & (ext->mask >> 18) & ~(std->id ^ (ext->id >> 18));
+		code = std->id & care;
+		care <<= 21;
+		code <<= 21;
+	} else if (std != NULL) {
+		care = std->mask << 21;
+		code = (std->id & std->mask) << 21;
+	} else if (ext != NULL) {
+		care = ext->mask << 3;
+		code = (ext->id & ext->mask) << 3;
+	}
+
+	*acr = code;
+	*amr = ~care;
+}
+
+static void can_sja1000_update_acceptance(const struct device *dev)
+{
+	struct can_sja1000_data *data = dev->data;
+	struct can_filter std;
+	struct can_filter ext;
+	bool has_std;
+	bool has_ext;
+
+	has_std = can_sw_filter_merge(&data->sw_filter, false, &std);
+	has_ext = can_sw_filter_merge(&data->sw_filter, true, &ext);
+
+	can_sja1000_calc_acceptance(has_std ? &std : NULL, has_ext ? &ext : NULL, &data->acr,
+				    &data->amr);
+	can_sja1000_write_acceptance(dev, data->acr, data->amr);
+
+	LOG_DBG("acceptance code 0x%08x, mask 0x%08x", data->acr, data->amr);
+}
+#endif /* CONFIG_CAN_SJA1000_HW_ACCEPTANCE */
+
 int can_sja1000_start(const struct device *dev)
 {
 	const struct can_sja1000_config *config = dev->config;
@@ -169,6 +230,11 @@ int can_sja1000_start(const struct device *dev)
 	can_sja1000_clear_errors(dev);
 	CAN_STATS_RESET(dev);
 
+#ifdef CONFIG_CAN_SJA1000_HW_ACCEPTANCE
+	/* The acceptance filter is only writable in reset mode */
+	can_sja1000_update_acceptance(dev);
+#endif /* CONFIG_CAN_SJA1000_HW_ACCEPTANCE */
+
 	err = can_sja1000_leave_reset_mode(dev);
 	if (err != 0) {
 		if (config->common.phy != NULL) {
@@ -425,42 +491,38 @@ int can_sja1000_add_rx_filter(const struct device *dev, can_rx_callback_t callba
 			      const struct can_filter *filter)
 {
 	struct can_sja1000_data *data = dev->data;
-	int filter_id = -ENOSPC;
 
 	if ((filter->flags & ~(CAN_FILTER_IDE)) != 0) {
 		LOG_ERR("unsupported CAN filter flags 0x%02x", filter->flags);
 		return -ENOTSUP;
 	}
 
-	for (int i = 0; i < ARRAY_SIZE(data->filters); i++) {
-		if (!atomic_test_and_set_bit(data->rx_allocs, i)) {
-			filter_id = i;
-			break;
-		}
-	}
+#ifdef CONFIG_CAN_SJA1000_HW_ACCEPTANCE
+	if (data->common.started) {
+		bool ide = (filter->flags & CAN_FILTER_IDE) != 0U;
+		uint32_t acr;
+		uint32_t amr;
+
+		can_sja1000_calc_acceptance(ide ? NULL : filter, ide ? filter : NULL, &acr, &amr);
 
-	if (filter_id >= 0) {
-		data->filters[filter_id].filter = *filter;
-		data->filters[filter_id].user_data = user_data;
-		data->filters[filter_id].callback = callback;
+		/* Frames matching the filter must all pass the current acceptance filter */
+		if ((~data->amr & (amr | (acr ^ data->acr))) != 0U) {
+			LOG_ERR("filter not covered by the acceptance filter, stop the controller "
+				"to add it");
+			return -EBUSY;
+		}
 	}
+#endif /* CONFIG_CAN_SJA1000_HW_ACCEPTANCE */
 
-	return filter_id;
+	return can_sw_filter_add(&data->sw_filter, callback, user_data, filter);
 }
 
 void can_sja1000_remove_rx_filter(const struct device *dev, int filter_id)
 {
 	struct can_sja1000_data *data = dev->data;
 
-	if (filter_id < 0 || filter_id >= ARRAY_SIZE(data->filters)) {
+	if (can_sw_filter_remove(&data->sw_filter, filter_id) != 0) {
 		LOG_ERR("filter ID %d out of bounds", filter_id);
-		return;
-	}
-
-	if (atomic_test_and_clear_bit(data->rx_allocs, filter_id)) {
-		data->filters[filter_id].callback = NULL;
-		data->filters[filter_id].user_data = NULL;
-		data->filters[filter_id].filter = (struct can_filter){0};
 	}
 }
 
@@ -557,7 +619,6 @@ static void can_sja1000_handle_receive_irq(const struct device *dev)
 {
 	struct can_sja1000_data *data = dev->data;
 	struct can_frame frame;
-	can_rx_callback_t callback;
 	uint8_t sr;
 
 	do {
@@ -566,18 +627,7 @@ static void can_sja1000_handle_receive_irq(const struct device *dev)
 #ifndef CONFIG_CAN_ACCEPT_RTR
 		if ((frame.flags & CAN_FRAME_RTR) == 0U) {
 #endif /* !CONFIG_CAN_ACCEPT_RTR */
-			for (int i = 0; i < ARRAY_SIZE(data->filters); i++) {
-				if (!atomic_test_bit(data->rx_allocs, i)) {
-					continue;
-				}
-
-				if (can_frame_matches_filter(&frame, &data->filters[i].filter)) {
-					callback = data->filters[i].callback;
-					if (callback != NULL) {
-						callback(dev, &frame, data->filters[i].user_data);
-					}
-				}
-			}
+			can_sw_filter_rx(&data->sw_filter, &frame);
 #ifndef CONFIG_CAN_ACCEPT_RTR
 		}
 #endif /* !CONFIG_CAN_ACCEPT_RTR */
@@ -748,6 +798,7 @@ int can_sja1000_init(const struct device *dev)
 
 	k_mutex_init(&data->mod_lock);
 	k_sem_init(&data->tx_idle, 1, 1);
+	can_sw_filter_init(&data->sw_filter, dev, data->filters, ARRAY_SIZE(data->filters));
 
 	data->state = CAN_STATE_ERROR_ACTIVE;
 
@@ -763,15 +814,7 @@ int can_sja1000_init(const struct device *dev)
 	can_sja1000_write_reg(dev, CAN_SJA1000_CDR, config->cdr | CAN_SJA1000_CDR_CAN_MODE);
 
 	/* Set up acceptance code and mask to match any frame (software filtering) */
-	can_sja1000_write_reg(dev, CAN_SJA1000_ACR0, 0x00);
-	can_sja1000_write_reg(dev, CAN_SJA1000_ACR1, 0x00);
-	can_sja1000_write_reg(dev, CAN_SJA1000_ACR2, 0x00);
-	can_sja1000_write_reg(dev, CAN_SJA1000_ACR3, 0x00);
-
-	can_sja1000_write_reg(dev, CAN_SJA1000_AMR0, 0xFF);
-	can_sja1000_write_reg(dev, CAN_SJA1000_AMR1, 0xFF);
-	can_sja1000_write_reg(dev, CAN_SJA1000_AMR2, 0xFF);
-	can_sja1000_write_reg(dev, CAN_SJA1000_AMR3, 0xFF);
+	can_sja1000_write_acceptance(dev, 0x00000000U, 0xFFFFFFFFU);
 
 	err = can_calc_timing(dev, &timing, config->common.bitrate,
 			      config->common.sample_point);
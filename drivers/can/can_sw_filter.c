@@ -0,0 +1,219 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/can_sw_filter.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#define NO_ENTRY (-1)
+
+static inline bool can_sw_filter_is_exact(const struct can_filter *filter)
+{
+	if ((filter->flags & CAN_FILTER_IDE) != 0U) {
+		return filter->mask == CAN_EXT_ID_MASK;
+	}
+
+	return filter->mask == CAN_STD_ID_MASK;
+}
+
+static inline uint32_t can_sw_filter_hash(uint32_t id, bool ide)
+{
+	/* Fibonacci hashing, with standard and extended IDs hashed apart */
+	if (ide) {
+		id |= BIT(31);
+	}
+
+	return (id * 2654435769U) >> (32 - CONFIG_CAN_SW_FILTER_HASH_BITS);
+}
+
+static int16_t *can_sw_filter_list(struct can_sw_filter *sw, const struct can_filter *filter)
+{
+	if (!can_sw_filter_is_exact(filter)) {
+		return &sw->masked;
+	}
+
+	return &sw->buckets[can_sw_filter_hash(filter->id, (filter->flags & CAN_FILTER_IDE) != 0U)];
+}
+
+/*
+ * The lock is released while calling the RX callbacks, for them to be able to add or remove
+ * filters. A filter removed meanwhile may end the walk early, which only happens when racing
+ * with the removal anyway.
+ */
+static void can_sw_filter_dispatch_list(struct can_sw_filter *sw, int16_t index,
+					struct can_frame *frame, k_spinlock_key_t *key)
+{
+	while (index != NO_ENTRY) {
+		struct can_sw_filter_entry *entry = &sw->entries[index];
+		can_rx_callback_t callback = entry->callback;
+		void *user_data = entry->user_data;
+
+		index = entry->next;
+
+		if (callback == NULL || !can_frame_matches_filter(frame, &entry->filter)) {
+			continue;
+		}
+
+		k_spin_unlock(&sw->lock, *key);
+		callback(sw->dev, frame, user_data);
+		*key = k_spin_lock(&sw->lock);
+	}
+}
+
+static void can_sw_filter_dispatch(struct can_sw_filter *sw, struct can_frame *frame)
+{
+	bool ide = (frame->flags & CAN_FRAME_IDE) != 0U;
+	k_spinlock_key_t key = k_spin_lock(&sw->lock);
+
+	can_sw_filter_dispatch_list(sw, sw->buckets[can_sw_filter_hash(frame->id, ide)], frame,
+				    &key);
+	can_sw_filter_dispatch_list(sw, sw->masked, frame, &key);
+
+	k_spin_unlock(&sw->lock, key);
+}
+
+#ifdef CONFIG_CAN_SW_FILTER_DEFERRED
+static void can_sw_filter_work_handler(struct k_work *work)
+{
+	struct can_sw_filter *sw = CONTAINER_OF(work, struct can_sw_filter, work);
+	struct can_frame frame;
+
+	/* All the frames received since the work was submitted are dispatched at once */
+	while (k_msgq_get(&sw->msgq, &frame, K_NO_WAIT) == 0) {
+		can_sw_filter_dispatch(sw, &frame);
+	}
+}
+#endif /* CONFIG_CAN_SW_FILTER_DEFERRED */
+
+void can_sw_filter_init(struct can_sw_filter *sw, const struct device *dev,
+			struct can_sw_filter_entry *entries, size_t num_entries)
+{
+	__ASSERT_NO_MSG(num_entries <= INT16_MAX);
+
+	sw->dev = dev;
+	sw->entries = entries;
+	sw->num_entries = num_entries;
+	sw->masked = NO_ENTRY;
+
+	for (size_t i = 0; i < ARRAY_SIZE(sw->buckets); i++) {
+		sw->buckets[i] = NO_ENTRY;
+	}
+
+	for (size_t i = 0; i < num_entries; i++) {
+		entries[i] = (struct can_sw_filter_entry){ .next = NO_ENTRY };
+	}
+
+#ifdef CONFIG_CAN_SW_FILTER_DEFERRED
+	k_work_init(&sw->work, can_sw_filter_work_handler);
+	k_msgq_init(&sw->msgq, sw->msgq_buffer, sizeof(struct can_frame),
+		    CONFIG_CAN_SW_FILTER_DEFERRED_FRAMES);
+#endif /* CONFIG_CAN_SW_FILTER_DEFERRED */
+}
+
+int can_sw_filter_add(struct can_sw_filter *sw, can_rx_callback_t callback, void *user_data,
+		      const struct can_filter *filter)
+{
+	k_spinlock_key_t key = k_spin_lock(&sw->lock);
+	int filter_id = -ENOSPC;
+	int16_t *head;
+
+	for (int i = 0; i < sw->num_entries; i++) {
+		if (sw->entries[i].callback == NULL) {
+			filter_id = i;
+			break;
+		}
+	}
+
+	if (filter_id >= 0) {
+		struct can_sw_filter_entry *entry = &sw->entries[filter_id];
+
+		head = can_sw_filter_list(sw, filter);
+
+		entry->filter = *filter;
+		entry->callback = callback;
+		entry->user_data = user_data;
+		entry->next = *head;
+		*head = filter_id;
+	}
+
+	k_spin_unlock(&sw->lock, key);
+
+	return filter_id;
+}
+
+int can_sw_filter_remove(struct can_sw_filter *sw, int filter_id)
+{
+	struct can_sw_filter_entry *entry;
+	k_spinlock_key_t key;
+	int16_t *index;
+
+	if (filter_id < 0 || filter_id >= sw->num_entries) {
+		return -EINVAL;
+	}
+
+	entry = &sw->entries[filter_id];
+	key = k_spin_lock(&sw->lock);
+
+	if (entry->callback != NULL) {
+		index = can_sw_filter_list(sw, &entry->filter);
+
+		while (*index != filter_id) {
+			__ASSERT_NO_MSG(*index != NO_ENTRY);
+			index = &sw->entries[*index].next;
+		}
+
+		*index = entry->next;
+		*entry = (struct can_sw_filter_entry){ .next = NO_ENTRY };
+	}
+
+	k_spin_unlock(&sw->lock, key);
+
+	return 0;
+}
+
+void can_sw_filter_rx(struct can_sw_filter *sw, struct can_frame *frame)
+{
+#ifdef CONFIG_CAN_SW_FILTER_DEFERRED
+	if (k_msgq_put(&sw->msgq, frame, K_NO_WAIT) != 0) {
+		CAN_STATS_RX_OVERRUN_INC(sw->dev);
+		return;
+	}
+
+	(void)k_work_submit(&sw->work);
+#else /* CONFIG_CAN_SW_FILTER_DEFERRED */
+	can_sw_filter_dispatch(sw, frame);
+#endif /* !CONFIG_CAN_SW_FILTER_DEFERRED */
+}
+
+bool can_sw_filter_merge(struct can_sw_filter *sw, bool ide, struct can_filter *merged)
+{
+	k_spinlock_key_t key = k_spin_lock(&sw->lock);
+	bool found = false;
+
+	for (int i = 0; i < sw->num_entries; i++) {
+		const struct can_filter *filter = &sw->entries[i].filter;
+
+		if (sw->entries[i].callback == NULL ||
+		    ((filter->flags & CAN_FILTER_IDE) != 0U) != ide) {
+			continue;
+		}
+
+		if (!found) {
+			*merged = *filter;
+			found = true;
+		} else {
+			/* Only keep the ID bits all the filters care about and agree on */
+			merged->mask &= filter->mask & ~(merged->id ^ filter->id);
+		}
+
+		merged->id &= merged->mask;
+	}
+
+	k_spin_unlock(&sw->lock, key);
+
+	return found;
+}
@@ -169,6 +169,31 @@ static void stm32_ltdc_get_capabilities(const struct device *dev,
 	capabilities->current_orientation = DISPLAY_ORIENTATION_NORMAL;
 }
 
+/* Number of rows flushed from the d-cache with a single barrier */
+#define STM32_LTDC_FLUSH_ROWS	16
+
+static void stm32_ltdc_copy_rows(uint8_t *dst, size_t dst_pitch,
+				 const uint8_t *src, size_t src_pitch,
+				 size_t len, uint16_t height)
+{
+	struct sys_cache_range rows[STM32_LTDC_FLUSH_ROWS];
+	size_t nb_rows = 0;
+
+	for (uint16_t row = 0; row < height; row++) {
+		(void)memcpy(dst, src, len);
+		rows[nb_rows].addr = dst;
+		rows[nb_rows].size = len;
+		if (++nb_rows == ARRAY_SIZE(rows)) {
+			sys_cache_data_flush_ranges(rows, nb_rows);
+			nb_rows = 0;
+		}
+		dst += dst_pitch;
+		src += src_pitch;
+	}
+
+	sys_cache_data_flush_ranges(rows, nb_rows);
+}
+
 static void stm32_ltdc_partial_write(const struct device *dev,
 				     const uint16_t x, const uint16_t y,
 				     const struct display_buffer_descriptor *desc,
@@ -180,12 +205,9 @@ static void stm32_ltdc_partial_write(const struct device *dev,
 	dst += x * data->current_pixel_size;
 	dst += y * config->width * data->current_pixel_size;
 
-	for (uint16_t row = 0; row < desc->height; row++) {
-		(void)memcpy(dst, src, desc->width * data->current_pixel_size);
-		sys_cache_data_flush_range(dst, desc->width * data->current_pixel_size);
-		dst += config->width * data->current_pixel_size;
-		src += desc->pitch * data->current_pixel_size;
-	}
+	stm32_ltdc_copy_rows(dst, config->width * data->current_pixel_size,
+			     src, desc->pitch * data->current_pixel_size,
+			     desc->width * data->current_pixel_size, desc->height);
 }
 
 /*
@@ -275,9 +297,7 @@ static int stm32_ltdc_read(const struct device *dev, const uint16_t x,
 {
 	const struct display_stm32_ltdc_config *config = dev->config;
 	struct display_stm32_ltdc_data *data = dev->data;
-	uint8_t *dst = buf;
 	const uint8_t *src = data->front_buf;
-	uint16_t row;
 
 	/* Validate the given parameters */
 	if (x + desc->width > config->width || y + desc->height > config->height) {
@@ -289,12 +309,9 @@ static int stm32_ltdc_read(const struct device *dev, const uint16_t x,
 	src += (x * data->current_pixel_size);
 	src += (y * config->width * data->current_pixel_size);
 
-	for (row = 0; row < desc->height; row++) {
-		(void)memcpy(dst, src, desc->width * data->current_pixel_size);
-		sys_cache_data_flush_range(dst, desc->width * data->current_pixel_size);
-		src += (config->width * data->current_pixel_size);
-		dst += (desc->pitch * data->current_pixel_size);
-	}
+	stm32_ltdc_copy_rows(buf, desc->pitch * data->current_pixel_size,
+			     src, config->width * data->current_pixel_size,
+			     desc->width * data->current_pixel_size, desc->height);
 
 	return 0;
 }
@@ -0,0 +1,237 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/dma/dma_memcpy.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(dma_memcpy, CONFIG_DMA_LOG_LEVEL);
+
+#define DMA_MEMCPY_NODE DT_CHOSEN(zephyr_memcpy_dma)
+
+static struct {
+	const struct device *dev;
+	int channel;
+	struct k_spinlock lock;
+	sys_slist_t queue;
+	struct dma_memcpy_req *curr;
+	/* Bytes of the current request already copied */
+	size_t done;
+	struct dma_block_config block;
+	struct dma_config config;
+} ctx = {
+	.channel = -1,
+};
+
+static void dma_memcpy_done(const struct device *dev, void *user_data, uint32_t channel,
+			    int status);
+
+/* Start the next block of the current request, blocks are limited in size
+ * by controllers.
+ */
+static int block_start(void)
+{
+	struct dma_memcpy_req *req = ctx.curr;
+	uintptr_t src = (uintptr_t)req->src + ctx.done;
+	uintptr_t dst = (uintptr_t)req->dst + ctx.done;
+	size_t len = MIN(req->len - ctx.done, CONFIG_DMA_MEMCPY_MAX_BLOCK_SIZE);
+	uint32_t width = (((src | dst | len) & 0x3) == 0) ? 4 : 1;
+	int err;
+
+	ctx.block = (struct dma_block_config){
+		.source_address = src,
+		.dest_address = dst,
+		.block_size = len,
+	};
+
+	ctx.config = (struct dma_config){
+		.channel_direction = MEMORY_TO_MEMORY,
+		.source_data_size = width,
+		.dest_data_size = width,
+		.source_burst_length = width,
+		.dest_burst_length = width,
+		.block_count = 1,
+		.head_block = &ctx.block,
+		.dma_callback = dma_memcpy_done,
+	};
+
+	err = dma_config(ctx.dev, ctx.channel, &ctx.config);
+	if (err == 0) {
+		err = dma_start(ctx.dev, ctx.channel);
+	}
+
+	return err;
+}
+
+static int req_start(struct dma_memcpy_req *req)
+{
+	/* Dirty lines of the destination must not be written back over
+	 * the copy.
+	 */
+	sys_cache_data_flush_range((void *)req->src, req->len);
+	sys_cache_data_flush_and_invd_range(req->dst, req->len);
+
+	ctx.done = 0;
+
+	return block_start();
+}
+
+/* Complete the current request and start the next one */
+static void req_complete(int status)
+{
+	struct dma_memcpy_req *req = ctx.curr;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	while (req != NULL) {
+		sys_cache_data_invd_range(req->dst, req->len);
+
+		key = k_spin_lock(&ctx.lock);
+		node = sys_slist_get(&ctx.queue);
+		ctx.curr = (node != NULL) ? CONTAINER_OF(node, struct dma_memcpy_req, node) : NULL;
+		k_spin_unlock(&ctx.lock, key);
+
+		req->cb(req, status);
+
+		req = ctx.curr;
+		if (req != NULL) {
+			status = req_start(req);
+			if (status == 0) {
+				return;
+			}
+
+			LOG_ERR("Failed to start copy (%d)", status);
+		}
+	}
+}
+
+static void dma_memcpy_done(const struct device *dev, void *user_data, uint32_t channel,
+			    int status)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+	ARG_UNUSED(channel);
+
+	if (status >= 0) {
+		ctx.done += ctx.block.block_size;
+		if (ctx.done < ctx.curr->len) {
+			status = block_start();
+			if (status == 0) {
+				return;
+			}
+		} else {
+			status = 0;
+		}
+	}
+
+	req_complete(status);
+}
+
+int dma_memcpy_submit(struct dma_memcpy_req *req)
+{
+	k_spinlock_key_t key;
+	bool start;
+	int err;
+
+	if (req->cb == NULL) {
+		return -EINVAL;
+	}
+
+	if ((ctx.channel < 0) || (req->len < CONFIG_DMA_MEMCPY_THRESHOLD)) {
+		memcpy(req->dst, req->src, req->len);
+		req->cb(req, 0);
+		return 0;
+	}
+
+	key = k_spin_lock(&ctx.lock);
+	start = (ctx.curr == NULL);
+	if (start) {
+		ctx.curr = req;
+	} else {
+		sys_slist_append(&ctx.queue, &req->node);
+	}
+	k_spin_unlock(&ctx.lock, key);
+
+	if (start) {
+		err = req_start(req);
+		if (err != 0) {
+			LOG_ERR("Failed to start copy (%d)", err);
+			req_complete(err);
+		}
+	}
+
+	return 0;
+}
+
+struct dma_memcpy_sync {
+	struct dma_memcpy_req req;
+	struct k_sem done;
+	int status;
+};
+
+static void dma_memcpy_sync_done(struct dma_memcpy_req *req, int status)
+{
+	struct dma_memcpy_sync *sync = CONTAINER_OF(req, struct dma_memcpy_sync, req);
+
+	sync->status = status;
+	k_sem_give(&sync->done);
+}
+
+int dma_memcpy(void *dst, const void *src, size_t len)
+{
+	struct dma_memcpy_sync sync = {
+		.req = {
+			.dst = dst,
+			.src = src,
+			.len = len,
+			.cb = dma_memcpy_sync_done,
+		},
+	};
+
+	if ((ctx.channel < 0) || (len < CONFIG_DMA_MEMCPY_THRESHOLD) || k_is_in_isr()) {
+		memcpy(dst, src, len);
+		return 0;
+	}
+
+	k_sem_init(&sync.done, 0, 1);
+	(void)dma_memcpy_submit(&sync.req);
+	k_sem_take(&sync.done, K_FOREVER);
+
+	return sync.status;
+}
+
+static int dma_memcpy_init(void)
+{
+#if DT_HAS_CHOSEN(zephyr_memcpy_dma)
+	const struct device *dev = DEVICE_DT_GET(DMA_MEMCPY_NODE);
+	int channel;
+
+	if (!device_is_ready(dev)) {
+		LOG_WRN("%s not ready, copies run by the CPU", dev->name);
+		return 0;
+	}
+
+	channel = dma_request_channel(dev, NULL);
+	if (channel < 0) {
+		LOG_WRN("No channel available on %s, copies run by the CPU", dev->name);
+		return 0;
+	}
+
+	ctx.dev = dev;
+	ctx.channel = channel;
+#endif
+
+	return 0;
+}
+
+SYS_INIT(dma_memcpy_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -132,6 +132,7 @@ static int dwmac_send(const struct device *dev, struct net_pkt *pkt)
 	struct net_buf *frag, *pinned;
 	unsigned int pkt_len = net_pkt_get_len(pkt);
 	unsigned int d_idx;
+	unsigned int nb_frags = 0;
 	struct dwmac_dma_desc *d;
 	uint32_t des2_flags, des3_flags;
 
@@ -162,7 +163,9 @@ static int dwmac_send(const struct device *dev, struct net_pkt *pkt)
 			k_sem_give(&p->free_tx_descs);
 			goto abort;
 		}
-		sys_cache_data_flush_range(pinned->data, pinned->len);
+		p->tx_flush[nb_frags].addr = pinned->data;
+		p->tx_flush[nb_frags].size = pinned->len;
+		nb_frags++;
 		p->tx_frags[d_idx] = pinned;
 		LOG_DBG("d[%d]: frag %p pinned %p len %d", d_idx,
 			frag->data, pinned->data, pinned->len);
@@ -188,6 +191,9 @@ static int dwmac_send(const struct device *dev, struct net_pkt *pkt)
 		frag = frag->frags;
 	} while (frag);
 
+	/* flush all the fragments at once */
+	sys_cache_data_flush_ranges(p->tx_flush, nb_frags);
+
 	/* make sure all the above made it to memory */
 	barrier_dmem_fence_full();
 
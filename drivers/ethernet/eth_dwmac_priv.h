@@ -61,6 +61,7 @@ struct dwmac_priv {
 
 	struct net_buf *tx_frags[NB_TX_DESCS]; /* index shared with tx_descs */
 	struct net_buf *rx_frags[NB_RX_DESCS]; /* index shared with rx_descs */
+	struct sys_cache_range tx_flush[NB_TX_DESCS]; /* fragments to flush */
 
 	struct net_pkt *rx_pkt;
 	unsigned int rx_bytes;
@@ -200,8 +200,8 @@ static void virtnet_if_init(struct net_if *iface)
 
 		virtq_add_buffer_chain(vq, vqbuf, 1, 0, virtnet_rx_cb, &(data->rx_cb_data[i]),
 				       K_FOREVER);
-		virtio_notify_virtqueue(config->vdev, VIRTQ_RX(1));
 	}
+	virtio_notify_virtqueue(config->vdev, VIRTQ_RX(1));
 	LOG_DBG("initialization finished");
 }
 
@@ -61,14 +61,14 @@ static void set_up_xfer(const struct device *dev, enum mspi_xfer_direction dir)
 	struct flash_mspi_nor_data *dev_data = dev->data;
 
 	memset(&dev_data->xfer, 0, sizeof(dev_data->xfer));
-	memset(&dev_data->packet, 0, sizeof(dev_data->packet));
+	memset(&dev_data->packets[0], 0, sizeof(dev_data->packets[0]));
 
 	dev_data->xfer.xfer_mode  = MSPI_PIO;
-	dev_data->xfer.packets    = &dev_data->packet;
+	dev_data->xfer.packets    = dev_data->packets;
 	dev_data->xfer.num_packet = 1;
 	dev_data->xfer.timeout    = dev_config->transfer_timeout;
 
-	dev_data->packet.dir = dir;
+	dev_data->packets[0].dir = dir;
 }
 
 static void set_up_xfer_with_addr(const struct device *dev,
@@ -80,7 +80,7 @@ static void set_up_xfer_with_addr(const struct device *dev,
 	set_up_xfer(dev, dir);
 	dev_data->xfer.addr_length = dev_data->cmd_info.uses_4byte_addr
 				   ? 4 : 3;
-	dev_data->packet.address = addr;
+	dev_data->packets[0].address = addr;
 }
 
 static uint16_t get_extended_command(const struct device *dev,
@@ -101,15 +101,20 @@ static int perform_xfer(const struct device *dev, uint8_t cmd)
 	const struct flash_mspi_nor_config *dev_config = dev->config;
 	struct flash_mspi_nor_data *dev_data = dev->data;
 	const struct mspi_dev_cfg *cfg = NULL;
+	uint32_t packet_cmd;
 	int rc;
 
 	if (dev_data->cmd_info.cmd_extension != CMD_EXTENSION_NONE &&
 	    in_octal_io(dev)) {
 		dev_data->xfer.cmd_length = 2;
-		dev_data->packet.cmd = get_extended_command(dev, cmd);
+		packet_cmd = get_extended_command(dev, cmd);
 	} else {
 		dev_data->xfer.cmd_length = 1;
-		dev_data->packet.cmd = cmd;
+		packet_cmd = cmd;
+	}
+
+	for (uint32_t i = 0; i < dev_data->xfer.num_packet; i++) {
+		dev_data->packets[i].cmd = packet_cmd;
 	}
 
 	/* Commands before chip is initialized manually apply a MSPI config
@@ -160,8 +165,8 @@ static int cmd_rdsr(const struct device *dev, uint8_t op_code, uint8_t *sr)
 		dev_data->xfer.addr_length = dev_data->cmd_info.rdsr_addr_4
 					   ? 4 : 0;
 	}
-	dev_data->packet.num_bytes = sizeof(uint8_t);
-	dev_data->packet.data_buf  = sr;
+	dev_data->packets[0].num_bytes = sizeof(uint8_t);
+	dev_data->packets[0].data_buf  = sr;
 	rc = perform_xfer(dev, op_code);
 	if (rc < 0) {
 		LOG_ERR("%s 0x%02x failed: %d", __func__, op_code, rc);
@@ -219,8 +224,8 @@ static int cmd_wrsr(const struct device *dev, uint8_t op_code,
 	}
 
 	set_up_xfer(dev, MSPI_TX);
-	dev_data->packet.num_bytes = sr_cnt;
-	dev_data->packet.data_buf  = sr;
+	dev_data->packets[0].num_bytes = sr_cnt;
+	dev_data->packets[0].data_buf  = sr;
 	rc = perform_xfer(dev, op_code);
 	if (rc < 0) {
 		LOG_ERR("%s 0x%02x failed: %d", __func__, op_code, rc);
@@ -359,24 +364,44 @@ static int api_read(const struct device *dev, off_t addr, void *dest,
 	}
 
 	while (size > 0) {
-		uint32_t to_read;
-
-		if (dev_config->packet_data_limit &&
-		    dev_config->packet_data_limit < size) {
-			to_read = dev_config->packet_data_limit;
-		} else {
-			to_read = size;
-		}
+		uint32_t num_packet = 0;
 
 		set_up_xfer_with_addr(dev, MSPI_RX, addr);
 		dev_data->xfer.rx_dummy = get_rx_dummy(dev);
-		dev_data->packet.data_buf  = dest;
-		dev_data->packet.num_bytes = to_read;
-		rc = perform_xfer(dev, dev_data->cmd_info.read_cmd);
 
-		addr += to_read;
-		dest  = (uint8_t *)dest + to_read;
-		size -= to_read;
+		/* Reads split by the controller packet data limit are queued
+		 * as packets of one transfer, so the controller runs their
+		 * command, address and data phases back to back.
+		 */
+		while (size > 0 && num_packet < ARRAY_SIZE(dev_data->packets)) {
+			struct mspi_xfer_packet *packet =
+				&dev_data->packets[num_packet];
+			uint32_t to_read;
+
+			if (dev_config->packet_data_limit &&
+			    dev_config->packet_data_limit < size) {
+				to_read = dev_config->packet_data_limit;
+			} else {
+				to_read = size;
+			}
+
+			packet->dir       = MSPI_RX;
+			packet->cb_mask   = MSPI_BUS_NO_CB;
+			packet->address   = addr;
+			packet->data_buf  = dest;
+			packet->num_bytes = to_read;
+			num_packet++;
+
+			addr += to_read;
+			dest  = (uint8_t *)dest + to_read;
+			size -= to_read;
+		}
+
+		dev_data->xfer.num_packet = num_packet;
+		rc = perform_xfer(dev, dev_data->cmd_info.read_cmd);
+		if (rc < 0) {
+			break;
+		}
 	}
 
 	release(dev);
@@ -421,8 +446,8 @@ static int api_write(const struct device *dev, off_t addr, const void *src,
 		}
 
 		set_up_xfer_with_addr(dev, MSPI_TX, addr);
-		dev_data->packet.data_buf  = (uint8_t *)src;
-		dev_data->packet.num_bytes = to_write;
+		dev_data->packets[0].data_buf  = (uint8_t *)src;
+		dev_data->packets[0].num_bytes = to_write;
 		rc = perform_xfer(dev, dev_data->cmd_info.pp_cmd);
 		if (rc < 0) {
 			LOG_ERR("Page program xfer failed: %d", rc);
@@ -517,7 +542,7 @@ static int api_erase(const struct device *dev, off_t addr, size_t size)
 		}
 		if (rc < 0) {
 			LOG_ERR("Erase command 0x%02x xfer failed: %d",
-				dev_data->packet.cmd, rc);
+				dev_data->packets[0].cmd, rc);
 			break;
 		}
 
@@ -567,9 +592,9 @@ static int sfdp_read(const struct device *dev, off_t addr, void *dest,
 		dev_data->xfer.rx_dummy    = 8;
 		dev_data->xfer.addr_length = 3;
 	}
-	dev_data->packet.address   = addr;
-	dev_data->packet.data_buf  = dest;
-	dev_data->packet.num_bytes = size;
+	dev_data->packets[0].address   = addr;
+	dev_data->packets[0].data_buf  = dest;
+	dev_data->packets[0].num_bytes = size;
 	rc = perform_xfer(dev, JESD216_CMD_READ_SFDP);
 	if (rc < 0) {
 		LOG_ERR("Read SFDP xfer failed: %d", rc);
@@ -589,8 +614,8 @@ static int read_jedec_id(const struct device *dev, uint8_t *id)
 		dev_data->xfer.addr_length = dev_data->cmd_info.rdid_addr_4
 					   ? 4 : 0;
 	}
-	dev_data->packet.data_buf  = id;
-	dev_data->packet.num_bytes = JESD216_READ_ID_LEN;
+	dev_data->packets[0].data_buf  = id;
+	dev_data->packets[0].num_bytes = JESD216_READ_ID_LEN;
 	rc = perform_xfer(dev, SPI_NOR_CMD_RDID);
 	if (rc < 0) {
 		LOG_ERR("Read JEDEC ID failed: %d", rc);
@@ -778,9 +803,9 @@ static int octal_enable_set(const struct device *dev, bool enable)
 	set_up_xfer(dev, MSPI_RX);
 	dev_data->xfer.rx_dummy    = 8;
 	dev_data->xfer.addr_length = 1;
-	dev_data->packet.address   = 0x02;
-	dev_data->packet.num_bytes = sizeof(uint8_t);
-	dev_data->packet.data_buf  = &status_reg;
+	dev_data->packets[0].address   = 0x02;
+	dev_data->packets[0].num_bytes = sizeof(uint8_t);
+	dev_data->packets[0].data_buf  = &status_reg;
 	rc = perform_xfer(dev, op_code);
 	if (rc < 0) {
 		LOG_ERR("cmd_rdsr 0x%02x failed: %d", op_code, rc);
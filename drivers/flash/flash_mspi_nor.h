@@ -112,7 +112,7 @@ struct flash_mspi_nor_data {
 #if defined(CONFIG_MULTITHREADING)
 	struct k_sem acquired;
 #endif
-	struct mspi_xfer_packet packet;
+	struct mspi_xfer_packet packets[CONFIG_FLASH_MSPI_NOR_READ_PACKETS];
 	struct mspi_xfer xfer;
 	struct jesd216_erase_type erase_types[JESD216_NUM_ERASE_TYPES];
 	struct flash_mspi_nor_cmd_info cmd_info;
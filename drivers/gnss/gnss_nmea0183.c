@@ -15,6 +15,24 @@
 #define GNSS_NMEA0183_PICO_DEGREES_IN_DEGREE      (1000000000000ULL)
 #define GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE      (GNSS_NMEA0183_PICO_DEGREES_IN_DEGREE / 60ULL)
 #define GNSS_NMEA0183_PICO_DEGREES_IN_NANO_DEGREE (1000ULL)
+
+/*
+ * Weight of each minute fraction digit in pico degrees, looked up rather
+ * than divided down per digit, as 64-bit divisions are library calls on
+ * 32-bit targets. Digits beyond the table are below a pico degree.
+ */
+static const uint64_t gnss_nmea0183_minute_fraction_weights[] = {
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 10ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 100ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 1000ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 10000ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 100000ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 1000000ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 10000000ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 100000000ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 1000000000ULL,
+	GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 10000000000ULL,
+};
 #define GNSS_NMEA0183_NANO_KNOTS_IN_MMS           (1943861LL)
 
 #define GNSS_NMEA0183_MESSAGE_SIZE_MIN      (6)
@@ -196,7 +214,6 @@ int gnss_nmea0183_ddmm_mmmm_to_ndeg(const char *ddmm_mmmm, int64_t *ndeg)
 
 	/* Convert minute fraction to pico degrees and add it to pico_degrees */
 	pos = decimal + 1;
-	increment = (GNSS_NMEA0183_PICO_DEGREES_IN_MINUTE / 10);
 	while (ddmm_mmmm[pos] != '\0') {
 		/* Verify char is decimal */
 		if (ddmm_mmmm[pos] < '0' || ddmm_mmmm[pos] > '9') {
@@ -204,10 +221,10 @@ int gnss_nmea0183_ddmm_mmmm_to_ndeg(const char *ddmm_mmmm, int64_t *ndeg)
 		}
 
 		/* Add increment to pico_degrees */
-		pico_degrees += (ddmm_mmmm[pos] - '0') * increment;
-
-		/* Update unit */
-		increment /= 10;
+		if ((pos - decimal - 1) < ARRAY_SIZE(gnss_nmea0183_minute_fraction_weights)) {
+			pico_degrees += (ddmm_mmmm[pos] - '0') *
+					gnss_nmea0183_minute_fraction_weights[pos - decimal - 1];
+		}
 
 		/* Increment position */
 		pos++;
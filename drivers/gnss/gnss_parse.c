@@ -17,6 +17,14 @@
 #define GNSS_PARSE_MICRO                           (1000000LL)
 #define GNSS_PARSE_MILLI                           (1000LL)
 
+/*
+ * Weight of each fraction digit, looked up rather than divided down per
+ * digit, as 64-bit divisions are library calls on 32-bit targets.
+ */
+static const int32_t gnss_parse_nano_fraction_weights[] = {
+	100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1,
+};
+
 int gnss_parse_dec_to_nano(const char *str, int64_t *nano)
 {
 	int64_t sum = 0;
@@ -75,18 +83,17 @@ int gnss_parse_dec_to_nano(const char *str, int64_t *nano)
 
 	/* Convert decimal part to nano fractions and add it to sum */
 	pos = decimal + 1;
-	increment = GNSS_PARSE_NANO / 10LL;
 	while (str[pos] != '\0') {
 		/* Verify char is decimal */
 		if (str[pos] < '0' || str[pos] > '9') {
 			return -EINVAL;
 		}
 
-		/* Add value to micro_degrees */
-		sum += (str[pos] - '0') * increment;
-
-		/* Update unit */
-		increment /= 10;
+		/* Add value to sum, digits beyond nano precision are ignored */
+		if ((pos - decimal - 1) < ARRAY_SIZE(gnss_parse_nano_fraction_weights)) {
+			sum += (str[pos] - '0') *
+			       gnss_parse_nano_fraction_weights[pos - decimal - 1];
+		}
 
 		/* Increment position */
 		pos++;
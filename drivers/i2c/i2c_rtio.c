@@ -99,11 +99,101 @@ void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 	mpsc_init(&ctx->io_q);
 	ctx->txn_curr = NULL;
 	ctx->txn_head = NULL;
+#ifdef CONFIG_I2C_RTIO_SCHED
+	ctx->pending = NULL;
+	ctx->last_iodev = NULL;
+	ctx->batch = 0;
+#endif
 	ctx->dt_spec.bus = dev;
 	ctx->iodev.data = &ctx->dt_spec;
 	ctx->iodev.api = &i2c_iodev_api;
 }
 
+#ifdef CONFIG_I2C_RTIO_SCHED
+static inline struct rtio_sqe *i2c_rtio_sched_sqe(struct mpsc_node *node)
+{
+	return &CONTAINER_OF(node, struct rtio_iodev_sqe, q)->sqe;
+}
+
+/* Move submitted transactions to the pending list, ordered by decreasing
+ * priority and in submission order among equal priorities.
+ */
+static void i2c_rtio_sched_collect(struct i2c_rtio *ctx)
+{
+	struct mpsc_node *node;
+
+	while ((node = mpsc_pop(&ctx->io_q)) != NULL) {
+		uint8_t prio = i2c_rtio_sched_sqe(node)->prio;
+		struct mpsc_node *prev = NULL;
+		struct mpsc_node *curr = ctx->pending;
+
+		while (curr != NULL && i2c_rtio_sched_sqe(curr)->prio >= prio) {
+			prev = curr;
+			curr = mpsc_ptr_get(curr->next);
+		}
+
+		mpsc_ptr_set(node->next, curr);
+		if (prev == NULL) {
+			ctx->pending = node;
+		} else {
+			mpsc_ptr_set(prev->next, node);
+		}
+	}
+}
+
+/* Pick the next transaction to start, the oldest one of the highest priority
+ * unless one of the same priority is for the target of the previous
+ * transaction, so the bus stays on that target.
+ */
+static struct mpsc_node *i2c_rtio_sched_next(struct i2c_rtio *ctx)
+{
+	struct mpsc_node *head;
+	struct mpsc_node *pick;
+	struct mpsc_node *pick_prev = NULL;
+
+	i2c_rtio_sched_collect(ctx);
+
+	head = ctx->pending;
+	if (head == NULL) {
+		ctx->last_iodev = NULL;
+		ctx->batch = 0;
+		return NULL;
+	}
+
+	pick = head;
+
+	if (ctx->last_iodev != NULL && ctx->batch < CONFIG_I2C_RTIO_SCHED_BATCH) {
+		uint8_t prio = i2c_rtio_sched_sqe(head)->prio;
+		struct mpsc_node *prev = NULL;
+
+		for (struct mpsc_node *curr = head;
+		     curr != NULL && i2c_rtio_sched_sqe(curr)->prio == prio;
+		     prev = curr, curr = mpsc_ptr_get(curr->next)) {
+			if (i2c_rtio_sched_sqe(curr)->iodev == ctx->last_iodev) {
+				pick = curr;
+				pick_prev = prev;
+				break;
+			}
+		}
+	}
+
+	if (pick_prev == NULL) {
+		ctx->pending = mpsc_ptr_get(pick->next);
+	} else {
+		mpsc_ptr_set(pick_prev->next, mpsc_ptr_get(pick->next));
+	}
+
+	if (i2c_rtio_sched_sqe(pick)->iodev == ctx->last_iodev) {
+		ctx->batch = MIN(ctx->batch + 1, UINT8_MAX);
+	} else {
+		ctx->last_iodev = i2c_rtio_sched_sqe(pick)->iodev;
+		ctx->batch = 1;
+	}
+
+	return pick;
+}
+#endif /* CONFIG_I2C_RTIO_SCHED */
+
 /**
  * @private
  * @brief Setup the next transaction (could be a single op) if needed
@@ -121,7 +211,11 @@ static bool i2c_rtio_next(struct i2c_rtio *ctx, bool completion)
 		return false;
 	}
 
+#ifdef CONFIG_I2C_RTIO_SCHED
+	struct mpsc_node *next = i2c_rtio_sched_next(ctx);
+#else
 	struct mpsc_node *next = mpsc_pop(&ctx->io_q);
+#endif
 
 	/* Nothing left to do */
 	if (next == NULL) {
@@ -401,20 +401,13 @@ static q31_t icm45686_fifo_read_temp_from_packet(const uint8_t *pkt)
 	return CLAMP(intermediate, INT32_MIN, INT32_MAX);
 }
 
-static int icm45686_fifo_read_imu_from_packet(const uint8_t *pkt, bool is_accel,
-					      uint8_t axis_offset, q31_t *out)
+/* Raw high resolution reading of an axis of a FIFO packet */
+static inline int icm45686_fifo_read_imu_raw(const uint8_t *pkt, bool is_accel,
+					     uint8_t axis_offset, int32_t *raw)
 {
 	uint32_t unsigned_value;
-	int32_t signed_value;
 	int offset = 1 + (axis_offset * 2) + (is_accel ? 0 : 6);
 	uint32_t mask = is_accel ? GENMASK(7, 4) : GENMASK(3, 0);
-	uint8_t accel_fs = ICM45686_DT_ACCEL_FS_32;
-	uint8_t gyro_fs = ICM45686_DT_GYRO_FS_4000;
-
-	int32_t whole;
-	int32_t fraction;
-	int64_t intermediate;
-	int8_t shift;
 
 	unsigned_value = (pkt[offset] | (pkt[offset + 1] << 8));
 	if (unsigned_value == FIFO_NO_DATA) {
@@ -423,28 +416,51 @@ static int icm45686_fifo_read_imu_from_packet(const uint8_t *pkt, bool is_accel,
 
 	unsigned_value =
 		(unsigned_value << 4) | ((pkt[17 + axis_offset] & mask) >> (is_accel ? 4 : 0));
-	signed_value = sign_extend(unsigned_value, 19);
+	*raw = sign_extend(unsigned_value, 19);
+
+	return 0;
+}
 
-	if (!is_accel) {
-		icm45686_get_shift(SENSOR_CHAN_GYRO_XYZ, accel_fs, gyro_fs, &shift);
-		icm45686_gyro_rads(gyro_fs, signed_value, true, &whole, &fraction);
+/* Multiplier, in Q16, converting raw high resolution readings to q31 values
+ * with the given shift. High resolution readings always use the largest
+ * full scale, the conversion of a reference reading gives the slope for all
+ * of them, so frames are converted without divisions.
+ */
+static int64_t icm45686_fifo_imu_scale(bool is_accel, int8_t shift)
+{
+	const int32_t ref = BIT(18);
+	int32_t whole;
+	int32_t fraction;
+	int64_t intermediate;
+
+	if (is_accel) {
+		icm45686_accel_ms(ICM45686_DT_ACCEL_FS_32, ref, true, &whole, &fraction);
 	} else {
-		icm45686_get_shift(SENSOR_CHAN_ACCEL_XYZ, accel_fs, gyro_fs, &shift);
-		icm45686_accel_ms(accel_fs, signed_value, true, &whole, &fraction);
+		icm45686_gyro_rads(ICM45686_DT_GYRO_FS_4000, ref, true, &whole, &fraction);
 	}
 
 	intermediate = ((int64_t)whole * INT64_C(1000000) + fraction);
-	if (shift < 0) {
-		intermediate =
-			intermediate * ((int64_t)INT32_MAX + 1) * (1 << -shift) / INT64_C(1000000);
-	} else {
-		intermediate =
-			intermediate * ((int64_t)INT32_MAX + 1) / ((1 << shift) * INT64_C(1000000));
-	}
 
-	*out = CLAMP(intermediate, INT32_MIN, INT32_MAX);
+	/* intermediate * 2^31 / (2^shift * 1000000) for a reading of ref, in Q16 */
+	return (intermediate << (31 + 16 - 18)) / (((int64_t)1 << shift) * INT64_C(1000000));
+}
 
-	return 0;
+static inline q31_t icm45686_fifo_imu_q31(int32_t raw, int64_t scale)
+{
+	int64_t value = ((int64_t)raw * scale) >> 16;
+
+	return CLAMP(value, INT32_MIN, INT32_MAX);
+}
+
+static inline bool icm45686_fifo_packet_supported(const struct icm45686_encoded_fifo_payload *fdata)
+{
+	/** This driver assumes 20-byte fifo packets, with both accel and gyro,
+	 * and no auxiliary sensors.
+	 */
+	return !(fdata->header & FIFO_HEADER_EXT_HEADER_EN(true)) &&
+	       (fdata->header & FIFO_HEADER_ACCEL_EN(true)) &&
+	       (fdata->header & FIFO_HEADER_GYRO_EN(true)) &&
+	       (fdata->header & FIFO_HEADER_HIRES_EN(true));
 }
 
 static int icm45686_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
@@ -453,64 +469,72 @@ static int icm45686_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 	struct icm45686_encoded_data *edata = (struct icm45686_encoded_data *)buffer;
 	struct icm45686_encoded_fifo_payload *frame_begin = edata->fifo_payload;
 	int count = 0;
-	int err;
 
 	if (*fit >= edata->header.fifo_count || chan_spec.chan_idx != 0) {
 		return 0;
 	}
 
-	while (count < max_count && (*fit < edata->header.fifo_count)) {
-		struct icm45686_encoded_fifo_payload *fdata = &frame_begin[*fit];
-
-		/** This driver assumes 20-byte fifo packets, with both accel and gyro,
-		 * and no auxiliary sensors.
-		 */
-		CHECKIF(!(!(fdata->header & FIFO_HEADER_EXT_HEADER_EN(true)) &&
-			  (fdata->header & FIFO_HEADER_ACCEL_EN(true)) &&
-			  (fdata->header & FIFO_HEADER_GYRO_EN(true)) &&
-			  (fdata->header & FIFO_HEADER_HIRES_EN(true)))) {
-			LOG_ERR("Unsupported FIFO packet format 0x%02x", fdata->header);
-			return -ENOTSUP;
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_ACCEL_XYZ:
+	case SENSOR_CHAN_GYRO_XYZ: {
+		struct sensor_three_axis_data *out = data_out;
+		bool is_accel = chan_spec.chan_type == SENSOR_CHAN_ACCEL_XYZ;
+		int64_t scale;
+		int32_t raw[3];
+
+		if (icm45686_get_shift(chan_spec.chan_type, edata->header.accel_fs,
+				       edata->header.gyro_fs, &out->shift) != 0) {
+			return -EINVAL;
 		}
 
-		switch (chan_spec.chan_type) {
-		case SENSOR_CHAN_ACCEL_XYZ:
-		case SENSOR_CHAN_GYRO_XYZ: {
-			struct sensor_three_axis_data *out = data_out;
-			bool is_accel = chan_spec.chan_type == SENSOR_CHAN_ACCEL_XYZ;
-
-			icm45686_get_shift(chan_spec.chan_type, edata->header.accel_fs,
-					   edata->header.gyro_fs, &out->shift);
-
-			out->header.base_timestamp_ns = edata->header.timestamp;
-
-			err = icm45686_fifo_read_imu_from_packet((uint8_t *)fdata, is_accel, 0,
-								 &out->readings[count].x);
-			err |= icm45686_fifo_read_imu_from_packet((uint8_t *)fdata, is_accel, 1,
-								  &out->readings[count].y);
-			err |= icm45686_fifo_read_imu_from_packet((uint8_t *)fdata, is_accel, 2,
-								  &out->readings[count].z);
-			if (err != 0) {
-				count--;
+		out->header.base_timestamp_ns = edata->header.timestamp;
+		scale = icm45686_fifo_imu_scale(is_accel, out->shift);
+
+		/* Frames are converted in bulk, with the scale computed once */
+		for (; count < max_count && (*fit < edata->header.fifo_count); *fit = *fit + 1) {
+			const uint8_t *pkt = frame_begin[*fit].buf;
+
+			CHECKIF(!icm45686_fifo_packet_supported(&frame_begin[*fit])) {
+				LOG_ERR("Unsupported FIFO packet format 0x%02x", pkt[0]);
+				return -ENOTSUP;
 			}
-			break;
-		}
-		case SENSOR_CHAN_DIE_TEMP: {
-			struct sensor_q31_data *out = data_out;
 
-			icm45686_get_shift(chan_spec.chan_type, edata->header.accel_fs,
-					   edata->header.gyro_fs, &out->shift);
+			if ((icm45686_fifo_read_imu_raw(pkt, is_accel, 0, &raw[0]) != 0) ||
+			    (icm45686_fifo_read_imu_raw(pkt, is_accel, 1, &raw[1]) != 0) ||
+			    (icm45686_fifo_read_imu_raw(pkt, is_accel, 2, &raw[2]) != 0)) {
+				continue;
+			}
 
-			out->header.base_timestamp_ns = edata->header.timestamp;
-			out->readings[count].temperature =
-				icm45686_fifo_read_temp_from_packet((uint8_t *)fdata);
-			break;
+			out->readings[count].x = icm45686_fifo_imu_q31(raw[0], scale);
+			out->readings[count].y = icm45686_fifo_imu_q31(raw[1], scale);
+			out->readings[count].z = icm45686_fifo_imu_q31(raw[2], scale);
+			count++;
 		}
-		default:
-			return 0;
+		break;
+	}
+	case SENSOR_CHAN_DIE_TEMP: {
+		struct sensor_q31_data *out = data_out;
+
+		icm45686_get_shift(chan_spec.chan_type, edata->header.accel_fs,
+				   edata->header.gyro_fs, &out->shift);
+
+		out->header.base_timestamp_ns = edata->header.timestamp;
+
+		for (; count < max_count && (*fit < edata->header.fifo_count); *fit = *fit + 1) {
+			const uint8_t *pkt = frame_begin[*fit].buf;
+
+			CHECKIF(!icm45686_fifo_packet_supported(&frame_begin[*fit])) {
+				LOG_ERR("Unsupported FIFO packet format 0x%02x", pkt[0]);
+				return -ENOTSUP;
+			}
+
+			out->readings[count].temperature = icm45686_fifo_read_temp_from_packet(pkt);
+			count++;
 		}
-		*fit = *fit + 1;
-		count++;
+		break;
+	}
+	default:
+		return 0;
 	}
 
 	return count;
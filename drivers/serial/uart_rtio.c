@@ -0,0 +1,237 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/uart/rtio.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(uart_rtio, CONFIG_UART_LOG_LEVEL);
+
+static struct rtio_iodev_sqe *sqe_pop(struct mpsc *q)
+{
+	struct mpsc_node *node = mpsc_pop(q);
+
+	return (node != NULL) ? CONTAINER_OF(node, struct rtio_iodev_sqe, q) : NULL;
+}
+
+static int sqe_rx_buf(struct rtio_iodev_sqe *iodev_sqe, uint8_t **buf, uint32_t *buf_len)
+{
+	return rtio_sqe_rx_buf(iodev_sqe, 1, CONFIG_UART_RTIO_RX_BUF_SIZE, buf, buf_len);
+}
+
+/* Start writes until one is accepted by the driver, or none is left */
+static void tx_start(struct uart_rtio *ctx, struct rtio_iodev_sqe *iodev_sqe)
+{
+	k_spinlock_key_t key;
+	int err;
+
+	while (iodev_sqe != NULL) {
+		const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+
+		if (sqe->op == RTIO_OP_TINY_TX) {
+			err = uart_tx(ctx->dev, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len,
+				      SYS_FOREVER_US);
+		} else {
+			err = uart_tx(ctx->dev, sqe->tx.buf, sqe->tx.buf_len, SYS_FOREVER_US);
+		}
+
+		if (err == 0) {
+			return;
+		}
+
+		key = k_spin_lock(&ctx->lock);
+		ctx->tx_curr = sqe_pop(&ctx->tx_q);
+		k_spin_unlock(&ctx->lock, key);
+
+		rtio_iodev_sqe_err(iodev_sqe, err);
+		iodev_sqe = ctx->tx_curr;
+	}
+}
+
+/* Enable reception with reads until one is accepted by the driver, or none
+ * is left.
+ */
+static void rx_start(struct uart_rtio *ctx, struct rtio_iodev_sqe *iodev_sqe)
+{
+	k_spinlock_key_t key;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int err;
+
+	while (iodev_sqe != NULL) {
+		err = sqe_rx_buf(iodev_sqe, &buf, &buf_len);
+		if (err == 0) {
+			err = uart_rx_enable(ctx->dev, buf, buf_len, ctx->rx_timeout);
+			if (err == 0) {
+				return;
+			}
+		}
+
+		key = k_spin_lock(&ctx->lock);
+		ctx->rx_curr = sqe_pop(&ctx->rx_q);
+		ctx->rx_enabled = (ctx->rx_curr != NULL);
+		k_spin_unlock(&ctx->lock, key);
+
+		rtio_iodev_sqe_err(iodev_sqe, err);
+		iodev_sqe = ctx->rx_curr;
+	}
+}
+
+/* Hand the next read to the driver, while it still receives in the current one */
+static void rx_buf_provide(struct uart_rtio *ctx)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	k_spinlock_key_t key;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int err;
+
+	key = k_spin_lock(&ctx->lock);
+	iodev_sqe = sqe_pop(&ctx->rx_q);
+	k_spin_unlock(&ctx->lock, key);
+
+	while (iodev_sqe != NULL) {
+		err = sqe_rx_buf(iodev_sqe, &buf, &buf_len);
+		if (err == 0) {
+			err = uart_rx_buf_rsp(ctx->dev, buf, buf_len);
+			if (err == 0) {
+				ctx->rx_next = iodev_sqe;
+				return;
+			}
+		}
+
+		rtio_iodev_sqe_err(iodev_sqe, err);
+
+		key = k_spin_lock(&ctx->lock);
+		iodev_sqe = sqe_pop(&ctx->rx_q);
+		k_spin_unlock(&ctx->lock, key);
+	}
+}
+
+static void uart_rtio_callback(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	struct uart_rtio *ctx = user_data;
+	struct rtio_iodev_sqe *iodev_sqe;
+	k_spinlock_key_t key;
+	size_t count;
+
+	ARG_UNUSED(dev);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		key = k_spin_lock(&ctx->lock);
+		iodev_sqe = ctx->tx_curr;
+		ctx->tx_curr = sqe_pop(&ctx->tx_q);
+		k_spin_unlock(&ctx->lock, key);
+
+		if (evt->type == UART_TX_DONE) {
+			rtio_iodev_sqe_ok(iodev_sqe, evt->data.tx.len);
+		} else {
+			rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+		}
+
+		tx_start(ctx, ctx->tx_curr);
+		break;
+	case UART_RX_RDY:
+		ctx->rx_count += evt->data.rx.len;
+		break;
+	case UART_RX_BUF_REQUEST:
+		rx_buf_provide(ctx);
+		break;
+	case UART_RX_BUF_RELEASED:
+		iodev_sqe = ctx->rx_curr;
+		count = ctx->rx_count;
+
+		key = k_spin_lock(&ctx->lock);
+		ctx->rx_curr = ctx->rx_next;
+		ctx->rx_next = NULL;
+		ctx->rx_count = 0;
+		k_spin_unlock(&ctx->lock, key);
+
+		if (iodev_sqe != NULL) {
+			rtio_iodev_sqe_ok(iodev_sqe, count);
+		}
+		break;
+	case UART_RX_STOPPED:
+		LOG_WRN("Reception stopped (reason %d)", evt->data.rx_stop.reason);
+		break;
+	case UART_RX_DISABLED:
+		/* Reads submitted once the driver stopped asking for buffers */
+		key = k_spin_lock(&ctx->lock);
+		ctx->rx_curr = sqe_pop(&ctx->rx_q);
+		ctx->rx_enabled = (ctx->rx_curr != NULL);
+		k_spin_unlock(&ctx->lock, key);
+
+		rx_start(ctx, ctx->rx_curr);
+		break;
+	default:
+		break;
+	}
+}
+
+static void uart_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct uart_rtio *ctx = iodev_sqe->sqe.iodev->data;
+	bool start = false;
+	k_spinlock_key_t key;
+	int err;
+
+	key = k_spin_lock(&ctx->lock);
+
+	if (!ctx->initialized) {
+		err = uart_callback_set(ctx->dev, uart_rtio_callback, ctx);
+		if (err != 0) {
+			k_spin_unlock(&ctx->lock, key);
+			LOG_ERR("Failed to set callback of %s (%d)", ctx->dev->name, err);
+			rtio_iodev_sqe_err(iodev_sqe, err);
+			return;
+		}
+
+		ctx->initialized = true;
+	}
+
+	switch (iodev_sqe->sqe.op) {
+	case RTIO_OP_TX:
+	case RTIO_OP_TINY_TX:
+		if (ctx->tx_curr == NULL) {
+			ctx->tx_curr = iodev_sqe;
+			start = true;
+		} else {
+			mpsc_push(&ctx->tx_q, &iodev_sqe->q);
+		}
+
+		k_spin_unlock(&ctx->lock, key);
+
+		if (start) {
+			tx_start(ctx, iodev_sqe);
+		}
+		break;
+	case RTIO_OP_RX:
+		if (!ctx->rx_enabled) {
+			ctx->rx_enabled = true;
+			ctx->rx_curr = iodev_sqe;
+			start = true;
+		} else {
+			mpsc_push(&ctx->rx_q, &iodev_sqe->q);
+		}
+
+		k_spin_unlock(&ctx->lock, key);
+
+		if (start) {
+			rx_start(ctx, iodev_sqe);
+		}
+		break;
+	default:
+		k_spin_unlock(&ctx->lock, key);
+		LOG_ERR("Unsupported op %d", iodev_sqe->sqe.op);
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		break;
+	}
+}
+
+const struct rtio_iodev_api uart_rtio_iodev_api = {
+	.submit = uart_rtio_submit,
+};
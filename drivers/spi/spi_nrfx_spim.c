@@ -44,6 +44,13 @@ struct spi_nrfx_data {
 	uint8_t *tx_buffer;
 	uint8_t *rx_buffer;
 #endif
+#ifdef CONFIG_SPI_RTIO
+	struct spi_rtio *rtio_ctx;
+	struct spi_buf rtio_tx_buf;
+	struct spi_buf rtio_rx_buf;
+	struct spi_buf_set rtio_tx_bufs;
+	struct spi_buf_set rtio_rx_bufs;
+#endif
 };
 
 struct spi_nrfx_config {
@@ -58,6 +65,9 @@ struct spi_nrfx_config {
 };
 
 static void event_handler(const nrfx_spim_event_t *p_event, void *p_context);
+#ifdef CONFIG_SPI_RTIO
+static void spi_nrfx_iodev_complete(const struct device *dev, int status);
+#endif
 
 static inline void finalize_spi_transaction(const struct device *dev, bool deactivate_cs)
 {
@@ -225,6 +235,13 @@ static void finish_transaction(const struct device *dev, int error)
 
 	LOG_DBG("Transaction finished with status %d", error);
 
+#ifdef CONFIG_SPI_RTIO
+	if (dev_data->rtio_ctx->txn_head != NULL) {
+		spi_nrfx_iodev_complete(dev, error);
+		return;
+	}
+#endif
+
 	spi_context_complete(ctx, dev, error);
 	dev_data->busy = false;
 
@@ -352,6 +369,142 @@ static void event_handler(const nrfx_spim_event_t *p_event, void *p_context)
 	}
 }
 
+#ifdef CONFIG_SPI_RTIO
+/* Submissions are run from the SPIM interrupt: each one is a single EasyDMA
+ * transfer (or more if it exceeds the maximum transfer length), the next one
+ * of a transaction is started when it ends, without involving a thread.
+ */
+static void spi_nrfx_iodev_msg_start(const struct device *dev, const uint8_t *tx_buf,
+				     uint8_t *rx_buf, uint32_t buf_len)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+
+	dev_data->rtio_tx_buf.buf = (uint8_t *)tx_buf;
+	dev_data->rtio_tx_buf.len = buf_len;
+	dev_data->rtio_rx_buf.buf = rx_buf;
+	dev_data->rtio_rx_buf.len = buf_len;
+
+	spi_context_buffers_setup(&dev_data->ctx,
+				  tx_buf != NULL ? &dev_data->rtio_tx_bufs : NULL,
+				  rx_buf != NULL ? &dev_data->rtio_rx_bufs : NULL, 1);
+
+	transfer_next_chunk(dev);
+}
+
+static void spi_nrfx_iodev_start(const struct device *dev)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	struct rtio_sqe *sqe = &dev_data->rtio_ctx->txn_curr->sqe;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		spi_nrfx_iodev_msg_start(dev, NULL, sqe->rx.buf, sqe->rx.buf_len);
+		break;
+	case RTIO_OP_TX:
+		spi_nrfx_iodev_msg_start(dev, sqe->tx.buf, NULL, sqe->tx.buf_len);
+		break;
+	case RTIO_OP_TINY_TX:
+		spi_nrfx_iodev_msg_start(dev, sqe->tiny_tx.buf, NULL, sqe->tiny_tx.buf_len);
+		break;
+	case RTIO_OP_TXRX:
+		spi_nrfx_iodev_msg_start(dev, sqe->txrx.tx_buf, sqe->txrx.rx_buf,
+					 sqe->txrx.buf_len);
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		spi_nrfx_iodev_complete(dev, -EINVAL);
+		break;
+	}
+}
+
+static int spi_nrfx_iodev_prepare_start(const struct device *dev)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	const struct spi_nrfx_config *dev_config = dev->config;
+	struct spi_rtio *rtio_ctx = dev_data->rtio_ctx;
+	struct spi_dt_spec *spi_dt_spec = rtio_ctx->txn_curr->sqe.iodev->data;
+	void *reg = dev_data->spim.p_reg;
+	int error;
+
+	/* The configuration of blocking calls is copied to the same place,
+	 * so it can differ from the last one with the same address.
+	 */
+	if ((spi_dt_spec == &rtio_ctx->dt_spec) && dev_data->initialized) {
+		nrfx_spim_uninit(&dev_data->spim);
+		dev_data->initialized = false;
+	}
+
+	error = configure(dev, &spi_dt_spec->config);
+	if (error != 0) {
+		return error;
+	}
+
+	if (dev_config->wake_pin != WAKE_PIN_NOT_USED) {
+		error = spi_nrfx_wake_request(dev_config->wake_gpiote, dev_config->wake_pin);
+		if (error == -ETIMEDOUT) {
+			LOG_WRN("Waiting for WAKE acknowledgment timed out");
+		}
+	}
+
+	if (NRF_SPIM_IS_320MHZ_SPIM(reg)) {
+		nrfy_spim_enable(reg);
+	}
+	spi_context_cs_control(&dev_data->ctx, true);
+
+	return 0;
+}
+
+static void spi_nrfx_iodev_complete(const struct device *dev, int status)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	struct spi_rtio *rtio_ctx = dev_data->rtio_ctx;
+
+	if (status == 0 && (rtio_ctx->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION) != 0) {
+		rtio_ctx->txn_curr = rtio_txn_next(rtio_ctx->txn_curr);
+		spi_nrfx_iodev_start(dev);
+		return;
+	}
+
+	do {
+		if (dev_data->ctx.config != NULL) {
+			finalize_spi_transaction(dev, true);
+		}
+
+		/* Taken on submission */
+		pm_device_runtime_put_async(dev, K_NO_WAIT);
+
+		if (!spi_rtio_complete(rtio_ctx, status)) {
+			break;
+		}
+
+		status = spi_nrfx_iodev_prepare_start(dev);
+		if (status == 0) {
+			spi_nrfx_iodev_start(dev);
+		}
+	} while (status != 0);
+}
+
+static void spi_nrfx_iodev_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	int error;
+
+	/* Submissions are made from thread context, completions from the
+	 * interrupt release the device.
+	 */
+	(void)pm_device_runtime_get(dev);
+
+	if (spi_rtio_submit(dev_data->rtio_ctx, iodev_sqe)) {
+		error = spi_nrfx_iodev_prepare_start(dev);
+		if (error == 0) {
+			spi_nrfx_iodev_start(dev);
+		} else {
+			spi_nrfx_iodev_complete(dev, error);
+		}
+	}
+}
+#endif /* CONFIG_SPI_RTIO */
+
 static int transceive(const struct device *dev,
 		      const struct spi_config *spi_cfg,
 		      const struct spi_buf_set *tx_bufs,
@@ -360,6 +513,25 @@ static int transceive(const struct device *dev,
 		      spi_callback_t cb,
 		      void *userdata)
 {
+#ifdef CONFIG_SPI_RTIO
+	struct spi_nrfx_data *dev_data = dev->data;
+	int error;
+
+	/* Queued with the RTIO submissions, completed before returning */
+	spi_context_lock(&dev_data->ctx, false, NULL, NULL, spi_cfg);
+	error = spi_rtio_transceive(dev_data->rtio_ctx, spi_cfg, tx_bufs, rx_bufs);
+	spi_context_release(&dev_data->ctx, error);
+
+	if (asynchronous) {
+		if (cb != NULL) {
+			cb(dev, error, userdata);
+		}
+
+		return 0;
+	}
+
+	return error;
+#else
 	struct spi_nrfx_data *dev_data = dev->data;
 	const struct spi_nrfx_config *dev_config = dev->config;
 	void *reg = dev_data->spim.p_reg;
@@ -429,6 +601,7 @@ static int transceive(const struct device *dev,
 		pm_device_runtime_put(dev);
 	}
 	return error;
+#endif /* CONFIG_SPI_RTIO */
 }
 
 static int spi_nrfx_transceive(const struct device *dev,
@@ -482,7 +655,7 @@ static DEVICE_API(spi, spi_nrfx_driver_api) = {
 	.transceive_async = spi_nrfx_transceive_async,
 #endif
 #ifdef CONFIG_SPI_RTIO
-	.iodev_submit = spi_rtio_iodev_default_submit,
+	.iodev_submit = spi_nrfx_iodev_submit,
 #endif
 	.release = spi_nrfx_release,
 };
@@ -565,6 +738,14 @@ static int spi_nrfx_init(const struct device *dev)
 		return err;
 	}
 
+#ifdef CONFIG_SPI_RTIO
+	dev_data->rtio_tx_bufs.buffers = &dev_data->rtio_tx_buf;
+	dev_data->rtio_tx_bufs.count = 1;
+	dev_data->rtio_rx_bufs.buffers = &dev_data->rtio_rx_buf;
+	dev_data->rtio_rx_bufs.count = 1;
+	spi_rtio_init(dev_data->rtio_ctx, dev);
+#endif
+
 	spi_context_unlock_unconditionally(&dev_data->ctx);
 
 	return pm_device_driver_init(dev, spim_nrfx_pm_action);
@@ -611,6 +792,10 @@ static int spi_nrfx_deinit(const struct device *dev)
 		 static uint8_t spim_##inst##_rx_buffer			       \
 			[CONFIG_SPI_NRFX_RAM_BUFFER_SIZE]		       \
 			DMM_MEMORY_SECTION(DT_DRV_INST(inst));))	       \
+	IF_ENABLED(CONFIG_SPI_RTIO,					       \
+		(SPI_RTIO_DEFINE(spim_##inst##_rtio,			       \
+				 CONFIG_SPI_NRFX_RTIO_SQ_SIZE,		       \
+				 CONFIG_SPI_NRFX_RTIO_CQ_SIZE)))	       \
 	static struct spi_nrfx_data spi_##inst##_data = {		       \
 		.spim = NRFX_SPIM_INSTANCE(DT_INST_REG_ADDR(inst)),	       \
 		IF_ENABLED(CONFIG_MULTITHREADING,			       \
@@ -621,6 +806,8 @@ static int spi_nrfx_deinit(const struct device *dev)
 		IF_ENABLED(SPI_BUFFER_IN_RAM,				       \
 			(.tx_buffer = spim_##inst##_tx_buffer,		       \
 			 .rx_buffer = spim_##inst##_rx_buffer,))	       \
+		IF_ENABLED(CONFIG_SPI_RTIO,				       \
+			(.rtio_ctx = &spim_##inst##_rtio,))		       \
 		.dev  = DEVICE_DT_GET(DT_DRV_INST(inst)),		       \
 		.busy = false,						       \
 	};								       \
@@ -67,6 +67,24 @@ static uint64_t last_cycle;
 static uint64_t last_tick;
 static uint32_t last_elapsed;
 
+#ifdef CONFIG_HRTIMER
+/* The comparator is shared by the tick timeout and the high-resolution timers,
+ * and set for the earliest of the two.
+ */
+static uint64_t tick_cycle;
+static uint64_t hr_cycle = UINT64_MAX;
+#endif
+
+/* Set the comparator for the next tick timeout, lock held */
+static void set_compare(uint64_t next_cycle)
+{
+#ifdef CONFIG_HRTIMER
+	tick_cycle = next_cycle;
+	next_cycle = MIN(next_cycle, hr_cycle);
+#endif
+	arm_arch_timer_set_compare(next_cycle);
+}
+
 #if defined(CONFIG_TEST)
 const int32_t z_sys_timer_irq_for_test = ARM_ARCH_TIMER_IRQ;
 #endif
@@ -103,12 +121,20 @@ static void arm_arch_timer_compare_isr(const void *arg)
 	last_tick += delta_ticks;
 	last_elapsed = 0;
 
+#ifdef CONFIG_HRTIMER
+	bool hr_expired = (curr_cycle >= hr_cycle);
+#endif
+
 	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
 		uint64_t next_cycle = last_cycle + CYC_PER_TICK;
 
-		arm_arch_timer_set_compare(next_cycle);
+		set_compare(next_cycle);
 		arm_arch_timer_set_irq_mask(false);
 	} else {
+#ifdef CONFIG_HRTIMER
+		/* sys_clock_announce() sets the next tick timeout */
+		tick_cycle = last_cycle + CYCLES_MAX;
+#endif
 		arm_arch_timer_set_irq_mask(true);
 #ifdef CONFIG_ARM_ARCH_TIMER_ERRATUM_740657
 		/*
@@ -135,6 +161,12 @@ static void arm_arch_timer_compare_isr(const void *arg)
 
 	k_spin_unlock(&lock, key);
 
+#ifdef CONFIG_HRTIMER
+	if (hr_expired) {
+		sys_clock_hrtimer_announce();
+	}
+#endif
+
 	sys_clock_announce(delta_ticks);
 }
 
@@ -160,10 +192,22 @@ void sys_clock_set_timeout(int32_t ticks, bool idle)
 		}
 	}
 
-	arm_arch_timer_set_compare(next_cycle);
+	set_compare(next_cycle);
+	arm_arch_timer_set_irq_mask(false);
+	k_spin_unlock(&lock, key);
+}
+
+#ifdef CONFIG_HRTIMER
+void sys_clock_hrtimer_set(uint64_t cycles)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	hr_cycle = cycles;
+	arm_arch_timer_set_compare(MIN(tick_cycle, hr_cycle));
 	arm_arch_timer_set_irq_mask(false);
 	k_spin_unlock(&lock, key);
 }
+#endif
 
 uint32_t sys_clock_elapsed(void)
 {
@@ -238,7 +282,7 @@ static int sys_clock_driver_init(void)
 #endif
 	last_tick = arm_arch_timer_count() / CYC_PER_TICK;
 	last_cycle = last_tick * CYC_PER_TICK;
-	arm_arch_timer_set_compare(last_cycle + CYC_PER_TICK);
+	set_compare(last_cycle + CYC_PER_TICK);
 	arm_arch_timer_enable(true);
 	irq_enable(ARM_ARCH_TIMER_IRQ);
 	arm_arch_timer_set_irq_mask(false);
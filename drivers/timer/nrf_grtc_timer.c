@@ -87,6 +87,10 @@ static nrfx_grtc_channel_t system_clock_channel_data = {
 #define USE_SYS_EVENT 1
 #endif
 static int sys_evt_handle = -1;
+#if defined(CONFIG_HRTIMER)
+/* Compare channel dedicated to the high-resolution timers */
+static int32_t hrtimer_chan = -1;
+#endif
 
 #define IS_CHANNEL_ALLOWED_ASSERT(chan)                                                            \
 	__ASSERT_NO_MSG((NRFX_GRTC_CONFIG_ALLOWED_CC_CHANNELS_MASK & (1UL << (chan))) &&           \
@@ -293,6 +297,32 @@ void z_nrf_grtc_timer_abort(int32_t chan)
 	compare_int_unlock(chan, key);
 }
 
+#if defined(CONFIG_HRTIMER)
+static void hrtimer_handler(int32_t id, uint64_t expire_time, void *user_data)
+{
+	ARG_UNUSED(id);
+	ARG_UNUSED(expire_time);
+	ARG_UNUSED(user_data);
+
+	sys_clock_hrtimer_announce();
+}
+
+void sys_clock_hrtimer_set(uint64_t cycles)
+{
+	if (hrtimer_chan < 0) {
+		return;
+	}
+
+	if (cycles == UINT64_MAX) {
+		z_nrf_grtc_timer_abort(hrtimer_chan);
+		return;
+	}
+
+	/* HW ensures that a past value triggers an event */
+	(void)compare_set(hrtimer_chan, MIN(cycles, COUNTER_SPAN - 1), hrtimer_handler, NULL);
+}
+#endif /* CONFIG_HRTIMER */
+
 uint64_t z_nrf_grtc_timer_get_ticks(k_timeout_t t)
 {
 	int64_t abs_ticks = Z_TICK_ABS(t.ticks);
@@ -511,6 +541,13 @@ static int sys_clock_driver_init(void)
 	nrfx_grtc_channel_callback_set(system_clock_channel_data.channel,
 				       sys_clock_timeout_handler, NULL);
 
+#if defined(CONFIG_HRTIMER)
+	hrtimer_chan = z_nrf_grtc_timer_chan_alloc();
+	if (hrtimer_chan < 0) {
+		return hrtimer_chan;
+	}
+#endif
+
 	int_mask = NRFX_GRTC_CONFIG_ALLOWED_CC_CHANNELS_MASK;
 	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
 		system_timeout_set_relative(CYC_PER_TICK);
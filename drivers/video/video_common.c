@@ -64,6 +64,7 @@ static struct video_buffer video_buf[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
 struct mem_block {
 	void *data;
+	atomic_t refcount;
 };
 
 static struct mem_block video_block[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
@@ -93,6 +94,8 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align, k_tim
 		return NULL;
 	}
 
+	atomic_set(&block->refcount, 1);
+
 	vbuf->buffer = block->data;
 	vbuf->size = size;
 	vbuf->bytesused = 0;
@@ -105,24 +108,48 @@ struct video_buffer *video_buffer_alloc(size_t size, k_timeout_t timeout)
 	return video_buffer_aligned_alloc(size, sizeof(void *), timeout);
 }
 
+static struct mem_block *video_buffer_block(const struct video_buffer *vbuf)
+{
+	for (int i = 0; i < ARRAY_SIZE(video_block); i++) {
+		if (video_block[i].data == vbuf->buffer) {
+			return &video_block[i];
+		}
+	}
+
+	return NULL;
+}
+
+struct video_buffer *video_buffer_ref(struct video_buffer *vbuf)
+{
+	struct mem_block *block;
+
+	__ASSERT_NO_MSG(vbuf != NULL);
+
+	block = video_buffer_block(vbuf);
+	__ASSERT(block != NULL, "Not a buffer of the video pool");
+
+	atomic_inc(&block->refcount);
+
+	return vbuf;
+}
+
 void video_buffer_release(struct video_buffer *vbuf)
 {
-	struct mem_block *block = NULL;
-	int i;
+	struct mem_block *block;
 
 	__ASSERT_NO_MSG(vbuf != NULL);
 
-	/* vbuf to block */
-	for (i = 0; i < ARRAY_SIZE(video_block); i++) {
-		if (video_block[i].data == vbuf->buffer) {
-			block = &video_block[i];
-			break;
-		}
+	block = video_buffer_block(vbuf);
+
+	/* Still used by other devices of the pipeline */
+	if (block && atomic_dec(&block->refcount) > 1) {
+		return;
 	}
 
 	vbuf->buffer = NULL;
 	if (block) {
 		VIDEO_COMMON_FREE(block->data);
+		block->data = NULL;
 	}
 }
 
@@ -30,6 +30,7 @@ struct virtio_mmio_data {
 
 	struct virtq *virtqueues;
 	uint16_t virtqueue_count;
+	bool event_idx;
 
 	struct k_spinlock isr_lock;
 	struct k_spinlock notify_lock;
@@ -224,6 +225,7 @@ static int virtio_mmio_set_virtqueues(const struct device *dev, uint16_t queue_c
 		if (ret != 0) {
 			goto fail;
 		}
+		data->virtqueues[i].event_idx = data->event_idx;
 		created_queues++;
 
 		ret = virtio_mmio_set_virtqueue(dev, i, &data->virtqueues[i]);
@@ -273,6 +275,8 @@ static DEVICE_API(virtio, virtio_mmio_driver_api) = {
 
 static int virtio_mmio_init_common(const struct device *dev)
 {
+	struct virtio_mmio_data *data = dev->data;
+
 	DEVICE_MMIO_NAMED_MAP(dev, reg_base, K_MEM_CACHE_NONE);
 
 	const uint32_t magic = virtio_mmio_read32(dev, VIRTIO_MMIO_MAGIC_VALUE);
@@ -305,6 +309,12 @@ static int virtio_mmio_init_common(const struct device *dev)
 
 	virtio_mmio_write_driver_feature_bit(dev, VIRTIO_F_VERSION_1, true);
 
+	data->event_idx = IS_ENABLED(CONFIG_VIRTIO_RING_EVENT_IDX) &&
+			  virtio_mmio_read_device_feature_bit(dev, VIRTIO_RING_F_EVENT_IDX);
+	if (data->event_idx) {
+		virtio_mmio_write_driver_feature_bit(dev, VIRTIO_RING_F_EVENT_IDX, true);
+	}
+
 	return 0;
 };
 
@@ -91,6 +91,7 @@ struct virtio_pci_data {
 
 	struct virtq *virtqueues;
 	uint16_t virtqueue_count;
+	bool event_idx;
 
 	struct k_spinlock isr_lock;
 	struct k_spinlock notify_lock;
@@ -288,6 +289,7 @@ static int virtio_pci_init_virtqueues(
 		if (ret != 0) {
 			goto fail;
 		}
+		data->virtqueues[i].event_idx = data->event_idx;
 		created_queues++;
 
 		ret = virtio_pci_set_virtqueue(dev, i, &data->virtqueues[i]);
@@ -536,6 +538,12 @@ static int virtio_pci_init_common(const struct device *dev)
 
 	virtio_pci_write_driver_feature_bit(dev, VIRTIO_F_VERSION_1, 1);
 
+	data->event_idx = IS_ENABLED(CONFIG_VIRTIO_RING_EVENT_IDX) &&
+			  virtio_pci_read_device_feature_bit(dev, VIRTIO_RING_F_EVENT_IDX);
+	if (data->event_idx) {
+		virtio_pci_write_driver_feature_bit(dev, VIRTIO_RING_F_EVENT_IDX, 1);
+	}
+
 	return 0;
 };
 
@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/drivers/virtio/virtqueue.h>
+#include <zephyr/drivers/virtio/virtio_config.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/__assert.h>
@@ -66,6 +67,8 @@ int virtq_create(struct virtq *v, size_t size)
 	memset(v_area, 0, v_size);
 
 	v->last_used_idx = 0;
+	v->event_idx = false;
+	v->notified_avail_idx = 0;
 
 	k_stack_alloc_init(&v->free_desc_stack, size);
 	for (uint16_t i = 0; i < size; i++) {
@@ -167,6 +170,63 @@ int virtq_add_buffer_chain(
 	return 0;
 }
 
+/* The used_event and avail_event fields follow the rings, see 2.7.6 and 2.7.8 */
+static inline volatile uint16_t *virtq_used_event(struct virtq *v)
+{
+	return &v->avail->ring[v->num];
+}
+
+static inline volatile uint16_t *virtq_avail_event(struct virtq *v)
+{
+	return (volatile uint16_t *)&v->used->ring[v->num];
+}
+
+/* See 2.7.10.1, true if event_idx is in [old_idx, new_idx) */
+static inline bool virtq_need_event(uint16_t event_idx, uint16_t new_idx, uint16_t old_idx)
+{
+	return (uint16_t)(new_idx - event_idx - 1) < (uint16_t)(new_idx - old_idx);
+}
+
+bool virtq_notification_needed(struct virtq *v)
+{
+	bool needed;
+
+	k_spinlock_key_t key = k_spin_lock(&v->lock);
+
+	uint16_t old_idx = v->notified_avail_idx;
+	uint16_t new_idx = sys_le16_to_cpu(v->avail->idx);
+
+	/* The new avail->idx must be visible before reading what the device expects */
+	barrier_dmem_fence_full();
+
+	if (v->event_idx) {
+		needed = virtq_need_event(sys_le16_to_cpu(*virtq_avail_event(v)), new_idx,
+					  old_idx);
+	} else {
+		needed = !(sys_le16_to_cpu(v->used->flags) & VIRTQ_USED_F_NO_NOTIFY);
+	}
+
+	v->notified_avail_idx = new_idx;
+
+	k_spin_unlock(&v->lock, key);
+
+	return needed;
+}
+
+bool virtq_enable_used_notification(struct virtq *v)
+{
+	if (!v->event_idx) {
+		return false;
+	}
+
+	*virtq_used_event(v) = sys_cpu_to_le16(v->last_used_idx);
+
+	/* The device may have used buffers before seeing the new used_event */
+	barrier_dmem_fence_full();
+
+	return sys_le16_to_cpu(v->used->idx) != v->last_used_idx;
+}
+
 int virtq_get_free_desc(struct virtq *v, uint16_t *desc_idx, k_timeout_t timeout)
 {
 	stack_data_t desc;
@@ -28,7 +28,7 @@ static esp_hosted_config_t esp_hosted_config = {
 
 static esp_hosted_data_t esp_hosted_data = {0};
 
-static int esp_hosted_recv(struct net_if *, void *, size_t);
+static int esp_hosted_recv(esp_hosted_data_t *, size_t, void *, size_t);
 
 static size_t esp_hosted_get_iface(const struct device *dev)
 {
@@ -133,11 +133,53 @@ static int esp_hosted_ctrl(const struct device *dev, CtrlMsgId req_id, CtrlMsg *
 	return 0;
 }
 
+static void esp_hosted_rx_flush(esp_hosted_data_t *data)
+{
+	for (size_t itf = 0; itf < ARRAY_SIZE(data->iface); itf++) {
+		size_t count = data->rx_count[itf];
+
+		if (count == 0) {
+			continue;
+		}
+
+		data->rx_count[itf] = 0;
+
+		if (net_recv_data_batch(data->iface[itf], data->rx_pkts[itf], count) < 0) {
+			LOG_ERR("Failed to push received data");
+			for (size_t i = 0; i < count; i++) {
+				net_pkt_unref(data->rx_pkts[itf][i]);
+			}
+#if defined(CONFIG_NET_STATISTICS_WIFI)
+			data->stats.errors.rx += count;
+#endif
+		}
+	}
+}
+
+static void esp_hosted_event_wait(const struct device *dev)
+{
+	esp_hosted_data_t *data = dev->data;
+
+	/* Read the frames the ESP has queued back to back, rather than one
+	 * per poll period, but bound the burst so that the RX threads get to
+	 * run.
+	 */
+	if (++data->rx_burst < CONFIG_WIFI_ESP_HOSTED_RX_BATCH &&
+	    esp_hosted_hal_data_ready(dev)) {
+		return;
+	}
+
+	esp_hosted_rx_flush(data);
+	data->rx_burst = 0;
+
+	k_msleep(CONFIG_WIFI_ESP_HOSTED_EVENT_TASK_POLL_MS);
+}
+
 static void esp_hosted_event_task(const struct device *dev, void *p2, void *p3)
 {
 	esp_hosted_data_t *data = dev->data;
 
-	for (;; k_msleep(CONFIG_WIFI_ESP_HOSTED_EVENT_TASK_POLL_MS)) {
+	for (;; esp_hosted_event_wait(dev)) {
 		esp_frame_t frame = {0};
 
 		do {
@@ -186,7 +228,7 @@ static void esp_hosted_event_task(const struct device *dev, void *p2, void *p3)
 		switch (frame.if_type) {
 		case ESP_HOSTED_SAP_IF:
 		case ESP_HOSTED_STA_IF: {
-			esp_hosted_recv(data->iface[frame.if_type], frame.payload, frame.len);
+			esp_hosted_recv(data, frame.if_type, frame.payload, frame.len);
 			continue;
 		}
 		case ESP_HOSTED_PRIV_IF: {
@@ -417,20 +459,24 @@ static int esp_hosted_send(const struct device *dev, struct net_pkt *pkt)
 	return 0;
 }
 
-static int esp_hosted_recv(struct net_if *iface, void *buf, size_t len)
+static int esp_hosted_recv(esp_hosted_data_t *data, size_t itf, void *buf, size_t len)
 {
-	int ret = 0;
+	struct net_if *iface = data->iface[itf];
 	struct net_pkt *pkt = NULL;
-#if defined(CONFIG_NET_STATISTICS_WIFI)
-	const struct device *dev = net_if_get_device(iface);
-	esp_hosted_data_t *data = dev->data;
-#endif
+	int ret = 0;
 
 	if (!iface || !net_if_flag_is_set(iface, NET_IF_UP)) {
 		return 0;
 	}
 
-	pkt = net_pkt_rx_alloc_with_buffer(iface, len, NET_AF_UNSPEC, 0, K_MSEC(1000));
+	pkt = net_pkt_rx_alloc_with_buffer(iface, len, NET_AF_UNSPEC, 0, K_NO_WAIT);
+	if (pkt == NULL) {
+		/* The pending batch may hold the last free buffers. */
+		esp_hosted_rx_flush(data);
+		pkt = net_pkt_rx_alloc_with_buffer(iface, len, NET_AF_UNSPEC, 0,
+						   K_MSEC(1000));
+	}
+
 	if (pkt == NULL) {
 		LOG_ERR("Failed to allocate net buffer");
 		return -ENOMEM;
@@ -442,10 +488,9 @@ static int esp_hosted_recv(struct net_if *iface, void *buf, size_t len)
 		goto error;
 	}
 
-	if (net_recv_data(iface, pkt) < 0) {
-		ret = -EIO;
-		LOG_ERR("Failed to push received data");
-		goto error;
+	data->rx_pkts[itf][data->rx_count[itf]++] = pkt;
+	if (data->rx_count[itf] == CONFIG_WIFI_ESP_HOSTED_RX_BATCH) {
+		esp_hosted_rx_flush(data);
 	}
 
 #if defined(CONFIG_NET_STATISTICS_WIFI)
@@ -56,6 +56,9 @@ typedef struct {
 	struct net_stats_wifi stats;
 #endif
 	enum wifi_iface_state state[2];
+	struct net_pkt *rx_pkts[2][CONFIG_WIFI_ESP_HOSTED_RX_BATCH];
+	size_t rx_count[2];
+	size_t rx_burst;
 } esp_hosted_data_t;
 
 #define TLV_HEADER_SIZE      (14)
@@ -188,10 +188,23 @@ static inline void arch_isr_direct_footer(int maybe_swap)
 	TOOLCHAIN_ENABLE_GCC_WARNING(TOOLCHAIN_WARNING_ATTRIBUTES) \
 	TOOLCHAIN_ENABLE_IAR_WARNING(TOOLCHAIN_WARNING_ATTRIBUTES)
 
+/* On Cortex-M the interrupt attribute only makes the compiler realign the
+ * stack in the prologue, which the exception entry already does when
+ * CCR.STKALIGN is set: always on the cores other than Cortex-M3 and
+ * Cortex-M4, and on these with CONFIG_STACK_ALIGN_DOUBLE_WORD.
+ */
+#if defined(CONFIG_CPU_CORTEX_M) && \
+	(defined(CONFIG_STACK_ALIGN_DOUBLE_WORD) || \
+	 !(defined(CONFIG_CPU_CORTEX_M3) || defined(CONFIG_CPU_CORTEX_M4)))
+#define Z_ARM_ISR_DIRECT_ATTR
+#else
+#define Z_ARM_ISR_DIRECT_ATTR __attribute__ ((interrupt ("IRQ")))
+#endif
+
 #define ARCH_ISR_DIRECT_DECLARE(name) \
 	static inline int name##_body(void); \
 	ARCH_ISR_DIAG_OFF \
-	__attribute__ ((interrupt ("IRQ"))) void name(void) \
+	Z_ARM_ISR_DIRECT_ATTR void name(void) \
 	{ \
 		int check_reschedule; \
 		ISR_DIRECT_HEADER(); \
@@ -69,12 +69,13 @@ static ALWAYS_INLINE size_t arch_dcache_line_size_get(void)
 }
 
 /*
- * operation for data cache by virtual address to PoC
+ * operation for data cache by virtual address to PoC, without the final
+ * barrier so that operations on several ranges can share it
  * ops:  K_CACHE_INVD: invalidate
  *	 K_CACHE_WB: clean
  *	 K_CACHE_WB_INVD: clean and invalidate
  */
-static ALWAYS_INLINE int arm64_dcache_range(void *addr, size_t size, int op)
+static ALWAYS_INLINE int arm64_dcache_range_nosync(void *addr, size_t size, int op)
 {
 	size_t line_size;
 	uintptr_t start_addr = (uintptr_t)addr;
@@ -111,7 +112,7 @@ static ALWAYS_INLINE int arm64_dcache_range(void *addr, size_t size, int op)
 		if (start_addr & (line_size - 1)) {
 			start_addr &= ~(line_size - 1);
 			if (start_addr == end_addr) {
-				goto done;
+				return 0;
 			}
 			dc_ops("civac", start_addr);
 			start_addr += line_size;
@@ -133,12 +134,26 @@ static ALWAYS_INLINE int arm64_dcache_range(void *addr, size_t size, int op)
 		start_addr += line_size;
 	}
 
-done:
-	barrier_dsync_fence_full();
-
 	return 0;
 }
 
+/*
+ * operation for data cache by virtual address to PoC
+ * ops:  K_CACHE_INVD: invalidate
+ *	 K_CACHE_WB: clean
+ *	 K_CACHE_WB_INVD: clean and invalidate
+ */
+static ALWAYS_INLINE int arm64_dcache_range(void *addr, size_t size, int op)
+{
+	int ret = arm64_dcache_range_nosync(addr, size, op);
+
+	if (ret == 0) {
+		barrier_dsync_fence_full();
+	}
+
+	return ret;
+}
+
 #ifdef CONFIG_ARM64_DCACHE_ALL_OPS
 
 /*
@@ -159,6 +159,64 @@ int arch_dcache_flush_and_invd_range(void *addr, size_t size);
 #define cache_data_flush_and_invd_range(addr, size) \
 	arch_dcache_flush_and_invd_range(addr, size)
 
+#if defined(CONFIG_ARCH_HAS_DCACHE_RANGES) || defined(__DOXYGEN__)
+
+struct sys_cache_range;
+
+/**
+ * @brief Flush several address ranges in the d-cache
+ *
+ * Flush the given address ranges of the data cache, with a single barrier
+ * for all of them.
+ *
+ * @param ranges Address ranges to flush.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t count);
+
+#define cache_data_flush_ranges(ranges, count) arch_dcache_flush_ranges(ranges, count)
+
+/**
+ * @brief Invalidate several address ranges in the d-cache
+ *
+ * Invalidate the given address ranges of the data cache, with a single
+ * barrier for all of them.
+ *
+ * @param ranges Address ranges to invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t count);
+
+#define cache_data_invd_ranges(ranges, count) arch_dcache_invd_ranges(ranges, count)
+
+/**
+ * @brief Flush and Invalidate several address ranges in the d-cache
+ *
+ * Flush and Invalidate the given address ranges of the data cache, with a
+ * single barrier for all of them.
+ *
+ * @param ranges Address ranges to flush and invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t count);
+
+#define cache_data_flush_and_invd_ranges(ranges, count) \
+	arch_dcache_flush_and_invd_ranges(ranges, count)
+
+#endif /* CONFIG_ARCH_HAS_DCACHE_RANGES */
+
 #if defined(CONFIG_DCACHE_LINE_SIZE_DETECT) || defined(__DOXYGEN__)
 
 /**
@@ -995,6 +995,33 @@ int bt_iso_chan_send(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq
 int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
 			uint32_t ts);
 
+/**
+ * @brief Send data to several ISO channels with the same timestamp
+ *
+ * Send one SDU to each of the channels, typically the CISes of a CIG or the
+ * BISes of a BIG, with the same sequence number and timestamp. All SDUs are
+ * queued before the stack starts sending any of them, so they reach the
+ * controller back to back.
+ *
+ * @note Buffer ownership is transferred to the stack in case of success, in
+ * case of an error the caller retains the ownership of all buffers and none
+ * of them is sent.
+ *
+ * @param chans    Channel objects.
+ * @param bufs     Buffers containing data to be sent, one per channel.
+ * @param count    Number of channels and buffers.
+ * @param seq_num  Packet Sequence number, see bt_iso_chan_send_ts().
+ * @param ts       Timestamp of the SDUs in microseconds (us).
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the parameters are invalid or a channel is not able to
+ *         send.
+ * @retval -ENOTCONN if a channel is not connected.
+ * @retval -EMSGSIZE if a buffer does not fit its channel.
+ */
+int bt_iso_chan_send_ts_batch(struct bt_iso_chan *chans[], struct net_buf *bufs[],
+			      size_t count, uint16_t seq_num, uint32_t ts);
+
 /**
  * @brief Sets up the ISO data path for a ISO channel
  *
@@ -21,6 +21,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Address range of a batched d-cache operation
+ */
+struct sys_cache_range {
+	/** Starting address. */
+	void *addr;
+	/** Range size. */
+	size_t size;
+};
+
 #if defined(CONFIG_EXTERNAL_CACHE)
 #include <zephyr/drivers/cache.h>
 
@@ -351,6 +361,156 @@ static ALWAYS_INLINE int z_impl_sys_cache_data_flush_and_invd_range(void *addr,
 	return -ENOTSUP;
 }
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+static inline bool z_sys_cache_data_ranges_use_all(const struct sys_cache_range *ranges,
+						   size_t count)
+{
+#if CONFIG_DCACHE_RANGES_ALL_THRESHOLD > 0
+	size_t total = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		total += ranges[i].size;
+	}
+
+	return total >= CONFIG_DCACHE_RANGES_ALL_THRESHOLD;
+#else
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(count);
+
+	return false;
+#endif
+}
+#endif
+/** @endcond */
+
+/**
+ * @brief Flush several address ranges in the d-cache
+ *
+ * Same as calling sys_cache_data_flush_range() on each of the ranges, but
+ * with a single barrier for all of them where the cache controller supports
+ * it. When the ranges add up to at least
+ * @kconfig{CONFIG_DCACHE_RANGES_ALL_THRESHOLD} bytes, the whole data cache is
+ * flushed instead.
+ *
+ * Meant for drivers preparing a DMA transfer from several buffers at once.
+ *
+ * @param ranges Address ranges to flush.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static inline int sys_cache_data_flush_ranges(const struct sys_cache_range *ranges,
+					      size_t count)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+	if (z_sys_cache_data_ranges_use_all(ranges, count) && cache_data_flush_all() == 0) {
+		return 0;
+	}
+#if defined(cache_data_flush_ranges)
+	return cache_data_flush_ranges(ranges, count);
+#else
+	for (size_t i = 0; i < count; i++) {
+		int ret = cache_data_flush_range(ranges[i].addr, ranges[i].size);
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+#endif
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
+/**
+ * @brief Invalidate several address ranges in the d-cache
+ *
+ * Same as calling sys_cache_data_invd_range() on each of the ranges, but
+ * with a single barrier for all of them where the cache controller supports
+ * it. The same alignment requirements apply to each range.
+ *
+ * @param ranges Address ranges to invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static inline int sys_cache_data_invd_ranges(const struct sys_cache_range *ranges,
+					     size_t count)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+#if defined(cache_data_invd_ranges)
+	return cache_data_invd_ranges(ranges, count);
+#else
+	for (size_t i = 0; i < count; i++) {
+		int ret = cache_data_invd_range(ranges[i].addr, ranges[i].size);
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+#endif
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
+/**
+ * @brief Flush and Invalidate several address ranges in the d-cache
+ *
+ * Same as calling sys_cache_data_flush_and_invd_range() on each of the
+ * ranges, but with a single barrier for all of them where the cache
+ * controller supports it. When the ranges add up to at least
+ * @kconfig{CONFIG_DCACHE_RANGES_ALL_THRESHOLD} bytes, the whole data cache is
+ * flushed and invalidated instead.
+ *
+ * @param ranges Address ranges to flush and invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static inline int sys_cache_data_flush_and_invd_ranges(const struct sys_cache_range *ranges,
+						       size_t count)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+	if (z_sys_cache_data_ranges_use_all(ranges, count) &&
+	    cache_data_flush_and_invd_all() == 0) {
+		return 0;
+	}
+#if defined(cache_data_flush_and_invd_ranges)
+	return cache_data_flush_and_invd_ranges(ranges, count);
+#else
+	for (size_t i = 0; i < count; i++) {
+		int ret = cache_data_flush_and_invd_range(ranges[i].addr, ranges[i].size);
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+#endif
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
 /**
  * @brief Flush and Invalidate an address range in the i-cache
  *
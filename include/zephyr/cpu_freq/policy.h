@@ -70,6 +70,36 @@ void cpu_freq_policy_reset(void);
  */
 const struct pstate *cpu_freq_policy_pstate_set(const struct pstate *state);
 
+/**
+ * @brief Apply a P-state between two evaluations of the policy
+ *
+ * To be called by CPU frequency scaling policies reacting to events, such as
+ * the wake up of a thread, without waiting for the next periodic evaluation.
+ * The P-state is applied with cpu_freq_pstate_set() and is tracked by the
+ * subsystem as if selected by the policy. The same restrictions on the
+ * current CPU apply.
+ *
+ * @param state Pointer to a P-state
+ *
+ * @return 0 if request received successfully, -errno in case of failure.
+ */
+int cpu_freq_pstate_fast_set(const struct pstate *state);
+
+struct k_thread;
+
+/**
+ * @brief Notify the CPU frequency scaling policy that a thread became ready
+ *
+ * Implemented by policies that ramp the frequency up ahead of the periodic
+ * evaluation, such as the utilization policy. It is called by the scheduler,
+ * with the scheduler lock held, whenever a thread is added to the run queue,
+ * and must neither block nor call back into the scheduler.
+ *
+ * @param thread Thread added to the run queue
+ * @param util Utilization of the thread, out of K_THREAD_UTIL_SCALE
+ */
+void cpu_freq_policy_thread_ready(const struct k_thread *thread, uint32_t util);
+
 /**
  * @}
  */
@@ -0,0 +1,140 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILE_H_
+#define ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct device;
+
+/** @defgroup boot_profile Boot profiler
+ *  @ingroup debug
+ *  @brief Module timing the steps of the system initialization
+ *
+ *  The boot profiler records the start and end time of every init level,
+ *  SYS_INIT entry and device initialization, as well as the boot milestones
+ *  such as the switch to the main thread, in a table kept in non-initialized
+ *  RAM. Times are measured with the timing functions, in cycles since the
+ *  start of the kernel initialization.
+ *  @{
+ */
+
+/** Kind of a boot profile record */
+enum boot_profile_type {
+	/** Init level, from its first entry to its last one */
+	BOOT_PROFILE_LEVEL,
+	/** SYS_INIT entry */
+	BOOT_PROFILE_SYS_INIT,
+	/** Device initialization */
+	BOOT_PROFILE_DEVICE,
+	/** Boot milestone, start and end are equal */
+	BOOT_PROFILE_MARK,
+};
+
+/** Init level of the records made once the init levels are over */
+#define BOOT_PROFILE_LEVEL_NONE 0xffU
+
+/** One step of the boot */
+struct boot_profile_record {
+	/** Start time, in cycles since the start of the profile */
+	uint64_t start;
+	/** End time, in cycles since the start of the profile, 0 if running */
+	uint64_t end;
+	/** What was timed, depending on the kind of record */
+	union {
+		/** Initialized device, for BOOT_PROFILE_DEVICE */
+		const struct device *dev;
+		/** Init function, for BOOT_PROFILE_SYS_INIT */
+		int (*init_fn)(void);
+		/** Milestone or level name, for BOOT_PROFILE_MARK and BOOT_PROFILE_LEVEL */
+		const char *name;
+	};
+	/** Thread running the step, NULL before the kernel is up */
+	const void *thread;
+	/** Result of the init function */
+	int result;
+	/** Kind of record, see @ref boot_profile_type */
+	uint8_t type;
+	/** Init level running when the step started */
+	uint8_t level;
+};
+
+/**
+ * @brief Get the number of boot profile records.
+ *
+ * @return Number of records, which stops growing once the table is full.
+ */
+size_t boot_profile_count(void);
+
+/**
+ * @brief Get a boot profile record.
+ *
+ * @param index Index of the record, records are ordered by start time.
+ *
+ * @return Record, or NULL if @p index is out of range.
+ */
+const struct boot_profile_record *boot_profile_get(size_t index);
+
+/**
+ * @brief Get the name of what a boot profile record timed.
+ *
+ * SYS_INIT entries are named after their init function when the symbol table
+ * is available.
+ *
+ * @param record Boot profile record.
+ *
+ * @return Name, or NULL if unknown.
+ */
+const char *boot_profile_name(const struct boot_profile_record *record);
+
+/**
+ * @brief Get the number of steps dropped because the table was full.
+ *
+ * @return Number of dropped steps.
+ */
+size_t boot_profile_dropped(void);
+
+/**
+ * @brief Convert boot profile cycles to nanoseconds.
+ *
+ * @param cycles Time of a record.
+ *
+ * @return Time in nanoseconds.
+ */
+uint64_t boot_profile_cycles_to_ns(uint64_t cycles);
+
+/**
+ * @brief Record a boot milestone.
+ *
+ * @param name Name of the milestone, must stay valid.
+ */
+void boot_profile_mark(const char *name);
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Hooks of the kernel initialization, see kernel/init.c and kernel/device.c */
+void z_boot_profile_start(void);
+void z_boot_profile_level(uint8_t level);
+int z_boot_profile_enter(enum boot_profile_type type, const void *what);
+void z_boot_profile_exit(int index, int result);
+
+/** @endcond */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILE_H_ */
@@ -469,6 +469,16 @@ struct device_state {
 	 * invoked.
 	 */
 	bool initialized : 1;
+
+#if defined(CONFIG_DEVICE_INIT_ASYNC) || defined(__DOXYGEN__)
+	/** Indicates the device is queued for asynchronous initialization,
+	 * until its initialization function returns.
+	 */
+	bool init_pending;
+
+	/** Indicates an asynchronous init thread runs the initialization */
+	bool init_running;
+#endif /* CONFIG_DEVICE_INIT_ASYNC */
 };
 
 struct pm_device_base;
@@ -495,6 +505,9 @@ typedef uint8_t device_flags_t;
 /** Device initialization is deferred */
 #define DEVICE_FLAG_INIT_DEFERRED BIT(0)
 
+/** Device initialization runs asynchronously, after the devices it requires */
+#define DEVICE_FLAG_INIT_ASYNC BIT(1)
+
 /** @} */
 
 /** Device operations */
@@ -932,7 +945,8 @@ __syscall int device_deinit(const struct device *dev);
  * @param node_id Devicetree node identifier.
  */
 #define Z_DEVICE_DT_FLAGS(node_id)                                             \
-	(DT_PROP_OR(node_id, zephyr_deferred_init, 0U) * DEVICE_FLAG_INIT_DEFERRED)
+	((DT_PROP_OR(node_id, zephyr_deferred_init, 0U) * DEVICE_FLAG_INIT_DEFERRED) | \
+	 (DT_PROP_OR(node_id, zephyr_async_init, 0U) * DEVICE_FLAG_INIT_ASYNC))
 
 #if defined(CONFIG_DEVICE_DEPS) || defined(__DOXYGEN__)
 
@@ -118,6 +118,139 @@ int flash_img_check(struct flash_img_context *ctx,
  */
 uint8_t flash_img_get_upload_slot(void);
 
+#if defined(CONFIG_IMG_DELTA) || defined(__DOXYGEN__)
+
+/** Magic number starting a patch, "ZDP1" in memory */
+#define FLASH_IMG_DELTA_MAGIC 0x3150445aU
+
+/** Size of the patch header */
+#define FLASH_IMG_DELTA_HEADER_SIZE 76
+
+/**
+ * @name Patch operations
+ *
+ * Following the header, a patch is a sequence of operations. Each
+ * operation is one byte followed by an unsigned LEB128 argument.
+ * @{
+ */
+/** Copy as many bytes from the source image */
+#define FLASH_IMG_DELTA_OP_COPY 0
+/** Followed by as many bytes, added to those of the source image */
+#define FLASH_IMG_DELTA_OP_ADD 1
+/** Followed by as many bytes, written as they are */
+#define FLASH_IMG_DELTA_OP_INSERT 2
+/** Move in the source image by the zigzag-encoded signed argument */
+#define FLASH_IMG_DELTA_OP_SEEK 3
+/** @} */
+
+/**
+ * @brief Context to rebuild an image from a patch
+ *
+ * A patch starts with a header made of, in little-endian order:
+ * FLASH_IMG_DELTA_MAGIC, the sizes of the source and target images on 32
+ * bits, and their SHA-256 hashes. Operations follow, which produce the
+ * target image in order while moving through the source image, as the
+ * control blocks of bsdiff do. ADD bytes are mostly zero and COPY stands
+ * for unchanged ranges, so the patch compresses well if the transport
+ * does.
+ */
+struct flash_img_delta_context {
+	/** @cond INTERNAL_HIDDEN */
+	struct flash_img_context img;
+	const struct flash_area *source;
+	size_t source_start;
+	size_t source_size;
+	size_t source_off;
+	size_t target_size;
+	size_t target_off;
+	size_t patch_off;
+	uint32_t arg;
+	uint8_t arg_shift;
+	uint8_t state;
+	uint8_t op;
+	uint8_t area_id;
+	uint8_t target_sha[32];
+	/* Holds the header until it is complete */
+	uint8_t buf[CONFIG_IMG_DELTA_BUF_SIZE];
+	/** @endcond */
+};
+
+/**
+ * @brief Check whether a stream starts with a patch
+ *
+ * @param data First bytes of the stream.
+ * @param len Number of bytes in @p data.
+ *
+ * @return true if @p data starts with the patch magic number.
+ */
+bool flash_img_delta_is_patch(const uint8_t *data, size_t len);
+
+/**
+ * @brief Initialize context needed to rebuild an image from a patch.
+ *
+ * @param ctx context to be initialized
+ * @param area_id flash area id of partition where the image should be written
+ * @param source_area_id flash area id of partition holding the image the
+ * patch applies to
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int flash_img_delta_init_id(struct flash_img_delta_context *ctx, uint8_t area_id,
+			    uint8_t source_area_id);
+
+/**
+ * @brief Initialize context needed to rebuild an image from a patch.
+ *
+ * The image is written to the upload slot, as for flash_img_init(), from the
+ * running image.
+ *
+ * @param ctx context to be initialized
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int flash_img_delta_init(struct flash_img_delta_context *ctx);
+
+/**
+ * @brief Process the next bytes of a patch.
+ *
+ * The patch is processed as it comes, with no other memory than the
+ * context. The source image is checked against the hash in the header, when
+ * CONFIG_IMG_ENABLE_IMAGE_CHECK is enabled, before anything is written.
+ *
+ * @param ctx context
+ * @param data patch data
+ * @param len Number of bytes in @p data
+ * @param flush when true, the patch is complete and any buffered data is
+ * written to flash
+ *
+ * @return 0 on success, -EINVAL if the patch is malformed, does not match the
+ * source image or, on flush, is truncated, other negative errno code on fail
+ */
+int flash_img_delta_write(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len,
+			  bool flush);
+
+/**
+ * @brief Read number of bytes of the patch processed.
+ *
+ * @param ctx context
+ *
+ * @return Number of bytes of the patch processed.
+ */
+size_t flash_img_delta_bytes_read(struct flash_img_delta_context *ctx);
+
+/**
+ * @brief Verify the rebuilt image against the hash from the patch header.
+ *
+ * The function is enabled via CONFIG_IMG_ENABLE_IMAGE_CHECK Kconfig options.
+ *
+ * @param ctx context of a flushed patch
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int flash_img_delta_check(struct flash_img_delta_context *ctx);
+
+#endif /* CONFIG_IMG_DELTA */
+
 #ifdef __cplusplus
 }
 #endif
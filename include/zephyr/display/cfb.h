@@ -186,6 +186,9 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
  * @brief Finalize framebuffer and write it to display RAM,
  * invert or reorder pixels if necessary.
  *
+ * Only the rows modified since the previous call are written, so that small
+ * updates do not transfer the whole framebuffer to the display.
+ *
  * @param dev Pointer to device structure for driver instance
  *
  * @return 0 on success, negative value otherwise
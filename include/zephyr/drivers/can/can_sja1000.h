@@ -13,6 +13,7 @@
 #define ZEPHYR_INCLUDE_DRIVERS_CAN_CAN_SJA1000_H_
 
 #include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/can_sw_filter.h>
 
 /**
  * @name SJA1000 Output Control Register (OCR) bits
@@ -149,22 +150,17 @@ struct can_sja1000_config {
 	CAN_SJA1000_DT_CONFIG_GET(DT_DRV_INST(inst), _custom, _read_reg, _write_reg, _ocr, _cdr,   \
 				  _min_bitrate)
 
-/**
- * @brief SJA1000 driver internal RX filter structure.
- */
-struct can_sja1000_rx_filter {
-	struct can_filter filter;
-	can_rx_callback_t callback;
-	void *user_data;
-};
-
 /**
  * @brief SJA1000 driver internal data structure.
  */
 struct can_sja1000_data {
 	struct can_driver_data common;
-	ATOMIC_DEFINE(rx_allocs, CONFIG_CAN_SJA1000_MAX_FILTERS);
-	struct can_sja1000_rx_filter filters[CONFIG_CAN_SJA1000_MAX_FILTERS];
+	struct can_sw_filter_entry filters[CONFIG_CAN_SJA1000_MAX_FILTERS];
+	struct can_sw_filter sw_filter;
+#ifdef CONFIG_CAN_SJA1000_HW_ACCEPTANCE
+	uint32_t acr;
+	uint32_t amr;
+#endif /* CONFIG_CAN_SJA1000_HW_ACCEPTANCE */
 	struct k_mutex mod_lock;
 	enum can_state state;
 	struct k_sem tx_idle;
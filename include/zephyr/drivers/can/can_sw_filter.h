@@ -0,0 +1,138 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Software RX filtering for CAN controller drivers.
+ *
+ * Shared by the drivers of CAN controllers with fewer hardware acceptance filters than RX
+ * filters supported. Filters matching a single CAN ID are looked up in a hash table, the others
+ * are matched one by one. The filters can also be merged into a single acceptance filter, for
+ * the hardware to reject most of the frames no RX filter is interested in.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_CAN_CAN_SW_FILTER_H_
+#define ZEPHYR_INCLUDE_DRIVERS_CAN_CAN_SW_FILTER_H_
+
+#include <zephyr/drivers/can.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Software RX filter entry, one per RX filter supported by the driver.
+ */
+struct can_sw_filter_entry {
+	/** RX filter */
+	struct can_filter filter;
+	/** RX callback, NULL if the entry is free */
+	can_rx_callback_t callback;
+	/** User data of the RX callback */
+	void *user_data;
+	/** Next entry in the same hash bucket or in the list of masked filters, -1 if last */
+	int16_t next;
+};
+
+/**
+ * @brief Software RX filter engine.
+ */
+struct can_sw_filter {
+	/** CAN controller device passed to the RX callbacks */
+	const struct device *dev;
+	/** RX filter entries */
+	struct can_sw_filter_entry *entries;
+	/** Number of RX filter entries */
+	uint16_t num_entries;
+	/** First filter matching a range of CAN IDs, -1 if none */
+	int16_t masked;
+	/** First filter of each hash bucket of filters matching a single CAN ID, -1 if none */
+	int16_t buckets[BIT(CONFIG_CAN_SW_FILTER_HASH_BITS)];
+	/** Protects the lists of filters */
+	struct k_spinlock lock;
+#if defined(CONFIG_CAN_SW_FILTER_DEFERRED) || defined(__DOXYGEN__)
+	/** Work item dispatching the received frames */
+	struct k_work work;
+	/** Received frames waiting to be dispatched */
+	struct k_msgq msgq;
+	/** Buffer of the received frames */
+	char msgq_buffer[CONFIG_CAN_SW_FILTER_DEFERRED_FRAMES * sizeof(struct can_frame)];
+#endif /* CONFIG_CAN_SW_FILTER_DEFERRED */
+};
+
+/**
+ * @brief Initialize a software RX filter engine.
+ *
+ * @param sw Software RX filter engine.
+ * @param dev CAN controller device.
+ * @param entries Array of RX filter entries.
+ * @param num_entries Number of RX filter entries, at most INT16_MAX.
+ */
+void can_sw_filter_init(struct can_sw_filter *sw, const struct device *dev,
+			struct can_sw_filter_entry *entries, size_t num_entries);
+
+/**
+ * @brief Add a software RX filter.
+ *
+ * See @a can_add_rx_filter() for argument description.
+ *
+ * @param sw Software RX filter engine.
+ * @param callback RX callback.
+ * @param user_data User data of the RX callback.
+ * @param filter RX filter.
+ *
+ * @retval filter_id Identifier of the RX filter, between 0 and the number of entries.
+ * @retval -ENOSPC if all the entries are in use.
+ */
+int can_sw_filter_add(struct can_sw_filter *sw, can_rx_callback_t callback, void *user_data,
+		      const struct can_filter *filter);
+
+/**
+ * @brief Remove a software RX filter.
+ *
+ * @param sw Software RX filter engine.
+ * @param filter_id Identifier of the RX filter.
+ *
+ * @retval 0 on success, including if the RX filter is not in use.
+ * @retval -EINVAL if @p filter_id is out of bounds.
+ */
+int can_sw_filter_remove(struct can_sw_filter *sw, int filter_id);
+
+/**
+ * @brief Pass a received CAN frame to the matching RX callbacks.
+ *
+ * May be called from ISR context. With @kconfig{CONFIG_CAN_SW_FILTER_DEFERRED}, the frame is
+ * only queued and the RX callbacks are called from the system work queue, along with the other
+ * frames received meanwhile.
+ *
+ * @param sw Software RX filter engine.
+ * @param frame Received CAN frame.
+ */
+void can_sw_filter_rx(struct can_sw_filter *sw, struct can_frame *frame);
+
+/**
+ * @brief Merge the RX filters of one CAN ID type into a single filter.
+ *
+ * The merged filter matches at least all the CAN IDs matched by the RX filters, for
+ * programming a hardware acceptance filter.
+ *
+ * @param sw Software RX filter engine.
+ * @param ide true for the extended (29-bit) CAN ID filters, false for the standard (11-bit)
+ *            CAN ID filters.
+ * @param[out] merged Merged filter.
+ *
+ * @retval true if @p merged was set.
+ * @retval false if there is no RX filter of this CAN ID type.
+ */
+bool can_sw_filter_merge(struct can_sw_filter *sw, bool ide, struct can_filter *merged);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_CAN_CAN_SW_FILTER_H_ */
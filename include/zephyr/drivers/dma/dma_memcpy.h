@@ -0,0 +1,92 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_
+
+#include <stddef.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief DMA memory copy service
+ * @defgroup dma_memcpy DMA memory copy service
+ * @ingroup dma_interface
+ *
+ * Memory copies offloaded to a memory to memory channel of the DMA
+ * controller chosen with the ``zephyr,memcpy-dma`` devicetree property.
+ * Copies are run one after the other. Copies shorter than
+ * CONFIG_DMA_MEMCPY_THRESHOLD, or done without such a controller, are run
+ * by the CPU.
+ * @{
+ */
+
+struct dma_memcpy_req;
+
+/**
+ * @brief Callback completing a copy
+ *
+ * Called from the DMA controller completion context, usually an ISR, or
+ * from dma_memcpy_submit() for copies run by the CPU.
+ *
+ * @param req Copy request.
+ * @param status 0 on success, negative error code otherwise.
+ */
+typedef void (*dma_memcpy_callback_t)(struct dma_memcpy_req *req, int status);
+
+/** @brief Copy request, owned by the service until completed. */
+struct dma_memcpy_req {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	/** @endcond */
+	/** Destination. */
+	void *dst;
+	/** Source. */
+	const void *src;
+	/** Number of bytes to copy. */
+	size_t len;
+	/** Completion callback. */
+	dma_memcpy_callback_t cb;
+	/** User data. */
+	void *user_data;
+};
+
+/**
+ * @brief Copy memory asynchronously
+ *
+ * @param req Copy request, left untouched until completed.
+ *
+ * @retval 0 on success, @p req is completed through its callback.
+ * @retval -EINVAL if @p req has no callback.
+ */
+int dma_memcpy_submit(struct dma_memcpy_req *req);
+
+/**
+ * @brief Copy memory and wait for completion
+ *
+ * Copies are run by the CPU when called from an ISR.
+ *
+ * @param dst Destination.
+ * @param src Source.
+ * @param len Number of bytes to copy.
+ *
+ * @retval 0 on success.
+ * @retval -errno if the DMA transfer failed.
+ */
+int dma_memcpy(void *dst, const void *src, size_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_ */
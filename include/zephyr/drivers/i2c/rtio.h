@@ -27,6 +27,13 @@ struct i2c_rtio {
 	struct rtio_iodev_sqe *txn_head;
 	struct rtio_iodev_sqe *txn_curr;
 	struct i2c_dt_spec dt_spec;
+#ifdef CONFIG_I2C_RTIO_SCHED
+	/* Submitted transactions ordered by priority, linked through their q node */
+	struct mpsc_node *pending;
+	/* Target of the last started transaction and number of them in a row */
+	const struct rtio_iodev *last_iodev;
+	uint8_t batch;
+#endif
 };
 
 /**
@@ -73,6 +80,10 @@ bool i2c_rtio_complete(struct i2c_rtio *ctx, int status);
 /**
  * @brief Submit, atomically, a submission to work on at some point
  *
+ * With CONFIG_I2C_RTIO_SCHED transactions are started by decreasing
+ * priority, then in submission order, preferring the target of the previous
+ * transaction.
+ *
  * @retval true Next submission is ready to start
  * @retval false No new submission to start or submissions are in progress already
  */
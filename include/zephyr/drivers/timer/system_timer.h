@@ -163,6 +163,36 @@ uint32_t sys_clock_cycle_get_32(void);
  */
 uint64_t sys_clock_cycle_get_64(void);
 
+#if defined(CONFIG_HRTIMER) || defined(__DOXYGEN__)
+/**
+ * @brief Set the next high-resolution timer expiry
+ *
+ * Program the hardware to call sys_clock_hrtimer_announce() when
+ * sys_clock_cycle_get_64() reaches @p cycles, independently of the tick
+ * timeout requested by sys_clock_set_timeout().  If @p cycles has already
+ * been reached, the call must happen as soon as possible.  A later call
+ * replaces the expiry set by an earlier one, and an early or spurious
+ * announcement is harmless.  Implemented by drivers selecting
+ * CONFIG_SYSTEM_TIMER_HAS_HRTIMER.
+ *
+ * @kconfig_dep{CONFIG_HRTIMER}
+ *
+ * @param cycles Expiry in cycles, or UINT64_MAX for none.
+ */
+void sys_clock_hrtimer_set(uint64_t cycles);
+
+/**
+ * @brief Announce a high-resolution timer expiry to the kernel
+ *
+ * Called by the system timer driver, in interrupt context, for the expiry
+ * set with sys_clock_hrtimer_set().  Runs the expired high-resolution
+ * timers and sets the next expiry.
+ *
+ * @kconfig_dep{CONFIG_HRTIMER}
+ */
+void sys_clock_hrtimer_announce(void);
+#endif /* CONFIG_HRTIMER || __DOXYGEN__ */
+
 #if defined(CONFIG_SYSTEM_CLOCK_HW_CYCLES_PER_SEC_RUNTIME_UPDATE) || defined(__DOXYGEN__)
 /**
  * @brief Update the system timer frequency at runtime.
@@ -0,0 +1,81 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_UART_RTIO_H_
+#define ZEPHYR_INCLUDE_DRIVERS_UART_RTIO_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief UART RTIO interface
+ * @defgroup uart_rtio UART RTIO interface
+ * @ingroup uart_interface
+ *
+ * RTIO I/O device running reads and writes with the asynchronous UART API.
+ *
+ * Writes (@ref RTIO_OP_TX and @ref RTIO_OP_TINY_TX) are sent one after the
+ * other and complete with the number of bytes sent.
+ *
+ * Reads (@ref RTIO_OP_RX, including multishot and memory pool backed ones)
+ * each provide a reception buffer. A read completes with the number of bytes
+ * received once its buffer is full or reception stops. Reads queued while
+ * receiving are handed to the driver when it requests the next buffer, so at
+ * least two of them must be pending for reception without gaps.
+ *
+ * The I/O device owns the asynchronous API callback of the UART.
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+struct uart_rtio {
+	const struct device *dev;
+	int32_t rx_timeout;
+	struct k_spinlock lock;
+	bool initialized;
+	struct mpsc tx_q;
+	struct rtio_iodev_sqe *tx_curr;
+	struct mpsc rx_q;
+	struct rtio_iodev_sqe *rx_curr;
+	struct rtio_iodev_sqe *rx_next;
+	size_t rx_count;
+	bool rx_enabled;
+};
+
+extern const struct rtio_iodev_api uart_rtio_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO I/O device for a UART
+ *
+ * @param _name Name of the I/O device
+ * @param _dev UART device
+ * @param _rx_timeout Inactivity period after which received data is
+ *		      reported, in microseconds, or @ref SYS_FOREVER_US.
+ */
+#define UART_RTIO_IODEV_DEFINE(_name, _dev, _rx_timeout)                                           \
+	static struct uart_rtio _uart_rtio_##_name = {                                             \
+		.dev = (_dev),                                                                     \
+		.rx_timeout = (_rx_timeout),                                                       \
+		.tx_q = MPSC_INIT((_uart_rtio_##_name.tx_q)),                                      \
+		.rx_q = MPSC_INIT((_uart_rtio_##_name.rx_q)),                                      \
+	};                                                                                         \
+	RTIO_IODEV_DEFINE(_name, &uart_rtio_iodev_api, &_uart_rtio_##_name)
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_UART_RTIO_H_ */
@@ -884,9 +884,25 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align, k_tim
  */
 struct video_buffer *video_buffer_alloc(size_t size, k_timeout_t timeout);
 
+/**
+ * @brief Take a reference to a video buffer.
+ *
+ * Lets a buffer be shared by several devices of a pipeline, for instance given to a display
+ * and an encoder after capture. Each reference is dropped with @ref video_buffer_release,
+ * the memory is returned to the pool with the last one.
+ *
+ * @param buf Pointer to a video buffer allocated from the video buffer pool.
+ *
+ * @return @p buf
+ */
+struct video_buffer *video_buffer_ref(struct video_buffer *buf);
+
 /**
  * @brief Release a video buffer.
  *
+ * Drops a reference to the video buffer, allocation being the first one. The buffer is
+ * freed once no reference is left.
+ *
  * @param buf Pointer to the video buffer to release.
  */
 void video_buffer_release(struct video_buffer *buf);
@@ -76,6 +76,10 @@ static inline struct virtq *virtio_get_virtqueue(const struct device *dev, uint1
  * as the avail->idx is increased, which is done by virtq_add_buffer_chain, so the
  * device may access the buffers even without notifying it with virtio_notify_virtqueue
  *
+ * The notification is skipped if the device does not need it, see
+ * virtq_notification_needed. Adding several buffers before notifying the device
+ * once saves notifications, which are costly for virtualized devices.
+ *
  * @param dev virtio device it operates on
  * @param queue_idx virtqueue to be notified
  */
@@ -83,7 +87,9 @@ static inline void virtio_notify_virtqueue(const struct device *dev, uint16_t qu
 {
 	const struct virtio_driver_api *api = dev->api;
 
-	api->notify_virtqueue(dev, queue_idx);
+	if (virtq_notification_needed(api->get_virtqueue(dev, queue_idx))) {
+		api->notify_virtqueue(dev, queue_idx);
+	}
 }
 
 /**
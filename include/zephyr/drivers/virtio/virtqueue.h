@@ -191,6 +191,17 @@ struct virtq {
 	 * array with callbacks invoked after receiving buffers back from the device
 	 */
 	struct virtq_receive_callback_entry *recv_cbs;
+
+	/**
+	 * true if VIRTIO_RING_F_EVENT_IDX was negotiated, in which case notifications
+	 * in both directions are suppressed with the used_event and avail_event fields
+	 * (see 2.7.7 and 2.7.10)
+	 */
+	bool event_idx;
+	/**
+	 * value of avail->idx when the device was last notified
+	 */
+	uint16_t notified_avail_idx;
 };
 
 
@@ -248,6 +259,27 @@ int virtq_add_buffer_chain(
 	k_timeout_t timeout
 );
 
+/**
+ * @brief checks if the device has to be notified about added buffers
+ * Buffers may be added with several calls to virtq_add_buffer_chain before notifying
+ * the device once. This returns false if the device asked not to be notified, either
+ * with VIRTQ_USED_F_NO_NOTIFY or, if VIRTIO_RING_F_EVENT_IDX was negotiated, because
+ * it did not reach the buffers added since the last notification yet.
+ * @param v virtqueue it operates on
+ * @return true if virtio_notify_virtqueue has to be called
+ */
+bool virtq_notification_needed(struct virtq *v);
+
+/**
+ * @brief re-enables used buffer notifications after processing the used ring
+ * With VIRTIO_RING_F_EVENT_IDX, the device only interrupts once used->idx passes
+ * the used_event index written here, so the buffers it returns while the used ring
+ * is processed do not trigger more interrupts.
+ * @param v virtqueue it operates on
+ * @return true if the device used more buffers meanwhile, which must be processed
+ */
+bool virtq_enable_used_notification(struct virtq *v);
+
 /**
  * @brief adds free descriptor back
  *
@@ -0,0 +1,146 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/filtering.h
+ *
+ * @brief Public APIs for DSP filtering
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_FILTERING_H_
+#define ZEPHYR_INCLUDE_DSP_FILTERING_H_
+
+#include <zephyr/dsp/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The filter instances are defined before including dsp.h, which pulls in the backend */
+
+/**
+ * @brief Length of the state buffer of a FIR filter.
+ *
+ * @param num_taps   number of filter coefficients
+ * @param block_size maximum number of samples processed per call
+ */
+#define ZDSP_FIR_STATE_LEN(num_taps, block_size) ((num_taps) + (block_size) - 1)
+
+/**
+ * @brief Floating-point FIR filter instance.
+ */
+struct zdsp_fir_f32 {
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+	/** State buffer of ZDSP_FIR_STATE_LEN(num_taps, block_size) samples */
+	float32_t *state;
+	/** Filter coefficients, in time reversed order */
+	const float32_t *coeffs;
+};
+
+/**
+ * @brief Length of the state buffer of a biquad cascade filter.
+ *
+ * @param num_stages number of second order sections
+ */
+#define ZDSP_BIQUAD_STATE_LEN(num_stages) (2 * (num_stages))
+
+/**
+ * @brief Floating-point biquad cascade filter instance.
+ */
+struct zdsp_biquad_f32 {
+	/** Number of second order sections */
+	uint8_t num_stages;
+	/** State buffer of ZDSP_BIQUAD_STATE_LEN(num_stages) samples */
+	float32_t *state;
+	/** Filter coefficients, 5 per stage */
+	const float32_t *coeffs;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_filtering Filtering Functions
+ * Block based filters for DSP.
+ * @{
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @defgroup math_dsp_filtering_fir Finite Impulse Response (FIR) Filters
+ *
+ * <pre>
+ *     dst[n] = coeffs[0] * src[n] + coeffs[1] * src[n-1] + ... + coeffs[num_taps-1] * src[n-num_taps+1]
+ * </pre>
+ * The filter state holds the last input samples of the previous block, so that a signal can be
+ * filtered one block at a time. The state buffer must be zeroed before filtering the first block.
+ * @{
+ */
+
+/**
+ * @brief Floating-point FIR filter.
+ *
+ * @param[in]  fir        points to the filter instance
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block, may not overlap @p src
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_f32(const struct zdsp_fir_f32 *fir, const DSP_DATA float32_t *src,
+				 DSP_DATA float32_t *dst, uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @defgroup math_dsp_filtering_biquad Biquad Cascade Filters
+ *
+ * Cascade of second order sections, implemented in direct form II transposed. Each stage has
+ * five coefficients {b0, b1, b2, a1, a2}, with the feedback coefficients a1 and a2 negated:
+ * <pre>
+ *     y[n] = b0 * x[n] + d1
+ *     d1   = b1 * x[n] + a1 * y[n] + d2
+ *     d2   = b2 * x[n] + a2 * y[n]
+ * </pre>
+ * The state buffer must be zeroed before filtering the first block.
+ * @{
+ */
+
+/**
+ * @brief Floating-point biquad cascade filter.
+ *
+ * @param[in]  biquad     points to the filter instance
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block, may be the same as @p src
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_f32(const struct zdsp_biquad_f32 *biquad,
+				    const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_FILTERING_H_ */
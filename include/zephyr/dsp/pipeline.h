@@ -0,0 +1,182 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/pipeline.h
+ *
+ * @brief Public APIs for DSP block pipelines
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_PIPELINE_H_
+#define ZEPHYR_INCLUDE_DSP_PIPELINE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_pipeline Block Pipelines
+ *
+ * A pipeline runs blocks of samples through a fixed list of stages, for example the blocks
+ * read from an I2S or DMIC driver or decoded from an RTIO sensor stream. Stages that can
+ * process a block in place do so, the others write to a work buffer allocated along with the
+ * pipeline, so that processing a block never allocates memory nor copies it more than once.
+ * The stages are implemented on top of the zDSP functions, and therefore use the optimized
+ * code of the selected backend (e.g. Helium or Neon with CMSIS-DSP).
+ *
+ * A pipeline holds the state of its filters and may only process one signal, from one thread
+ * at a time.
+ * @{
+ */
+
+struct zdsp_pipeline_stage;
+
+/**
+ * @brief Process a block of samples.
+ *
+ * @param[in]  stage      points to the pipeline stage
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block, the same as @p src for stages processing
+ *                        blocks in place
+ * @param[in]  block_size number of samples to process
+ */
+typedef void (*zdsp_pipeline_process_t)(const struct zdsp_pipeline_stage *stage,
+					const float32_t *src, float32_t *dst,
+					uint32_t block_size);
+
+/**
+ * @brief Pipeline stage.
+ */
+struct zdsp_pipeline_stage {
+	/** Processing function */
+	zdsp_pipeline_process_t process;
+	/** Stage specific data, e.g. the filter instance */
+	void *data;
+	/** The stage can process a block in place */
+	bool in_place;
+};
+
+/**
+ * @brief Pipeline.
+ */
+struct zdsp_pipeline {
+	/** Stages, in processing order */
+	const struct zdsp_pipeline_stage *stages;
+	/** Number of stages */
+	size_t num_stages;
+	/** Work buffer of @a block_size samples */
+	float32_t *work;
+	/** Maximum number of samples per block */
+	uint32_t block_size;
+};
+
+/** @cond INTERNAL_HIDDEN */
+void zdsp_pipeline_fir_f32(const struct zdsp_pipeline_stage *stage, const float32_t *src,
+			   float32_t *dst, uint32_t block_size);
+void zdsp_pipeline_biquad_f32(const struct zdsp_pipeline_stage *stage, const float32_t *src,
+			      float32_t *dst, uint32_t block_size);
+void zdsp_pipeline_scale_f32(const struct zdsp_pipeline_stage *stage, const float32_t *src,
+			     float32_t *dst, uint32_t block_size);
+/** @endcond */
+
+/**
+ * @brief Initializer of a FIR filter stage.
+ *
+ * @param _fir pointer to a @ref zdsp_fir_f32 instance, with a state buffer large enough for
+ *             the block size of the pipeline
+ */
+#define ZDSP_PIPELINE_STAGE_FIR_F32(_fir)                                                          \
+	{                                                                                          \
+		.process = zdsp_pipeline_fir_f32,                                                  \
+		.data = (_fir),                                                                    \
+		.in_place = false,                                                                 \
+	}
+
+/**
+ * @brief Initializer of a biquad cascade filter stage.
+ *
+ * @param _biquad pointer to a @ref zdsp_biquad_f32 instance
+ */
+#define ZDSP_PIPELINE_STAGE_BIQUAD_F32(_biquad)                                                    \
+	{                                                                                          \
+		.process = zdsp_pipeline_biquad_f32,                                               \
+		.data = (_biquad),                                                                 \
+		.in_place = true,                                                                  \
+	}
+
+/**
+ * @brief Initializer of a gain stage.
+ *
+ * @param _scale pointer to the float32_t gain, which may be changed between blocks
+ */
+#define ZDSP_PIPELINE_STAGE_SCALE_F32(_scale)                                                      \
+	{                                                                                          \
+		.process = zdsp_pipeline_scale_f32,                                                \
+		.data = (_scale),                                                                  \
+		.in_place = true,                                                                  \
+	}
+
+/**
+ * @brief Initializer of a custom stage, e.g. an FFT or a resampler of the application.
+ *
+ * @param _process  @ref zdsp_pipeline_process_t processing function
+ * @param _data     stage specific data
+ * @param _in_place true if @p _process can process a block in place
+ */
+#define ZDSP_PIPELINE_STAGE(_process, _data, _in_place)                                            \
+	{                                                                                          \
+		.process = (_process),                                                             \
+		.data = (_data),                                                                   \
+		.in_place = (_in_place),                                                           \
+	}
+
+/**
+ * @brief Statically define a pipeline and its work buffer.
+ *
+ * @param _name       name of the @ref zdsp_pipeline variable
+ * @param _block_size maximum number of samples per block
+ * @param ...         stages, in processing order
+ */
+#define ZDSP_PIPELINE_DEFINE(_name, _block_size, ...)                                              \
+	static float32_t _name##_work[_block_size];                                                \
+	static const struct zdsp_pipeline_stage _name##_stages[] = {__VA_ARGS__};                  \
+	static struct zdsp_pipeline _name = {                                                      \
+		.stages = _name##_stages,                                                          \
+		.num_stages = ARRAY_SIZE(_name##_stages),                                          \
+		.work = _name##_work,                                                              \
+		.block_size = (_block_size),                                                       \
+	}
+
+/**
+ * @brief Process a block of samples through all the stages of a pipeline.
+ *
+ * The block is processed in place: @p data holds the output of the last stage on return.
+ *
+ * @param[in]     pipeline   points to the pipeline
+ * @param[in,out] data       points to the block
+ * @param[in]     block_size number of samples in the block
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p block_size is larger than the block size of the pipeline.
+ */
+int zdsp_pipeline_process(struct zdsp_pipeline *pipeline, float32_t *data, uint32_t block_size);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_PIPELINE_H_ */
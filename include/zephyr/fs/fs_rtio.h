@@ -0,0 +1,55 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+#define ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous file I/O
+ * @defgroup file_system_rtio Asynchronous file I/O
+ * @ingroup file_system_api
+ *
+ * Files are exposed as RTIO I/O devices. RTIO_OP_RX submissions read from the
+ * current position of the file and RTIO_OP_TX submissions write at it, each
+ * completing with the number of bytes transferred or a negative error code.
+ * Memory pool buffers are supported for reads.
+ *
+ * Operations are executed by the RTIO work queue threads with the regular
+ * blocking file system API, so the submitter never blocks. Operations on the
+ * same file must be chained to be executed in submission order when more than
+ * one work queue thread is configured.
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api fs_rtio_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO I/O device for a file.
+ *
+ * @param _name Name of the I/O device.
+ * @param _file Pointer to the @ref fs_file_t of the file, which must be opened
+ *		before submitting operations.
+ */
+#define FS_RTIO_IODEV_DEFINE(_name, _file) RTIO_IODEV_DEFINE(_name, &fs_rtio_iodev_api, _file)
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_RTIO_H_ */
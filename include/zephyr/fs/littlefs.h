@@ -53,6 +53,16 @@ struct fs_littlefs {
 	struct lfs lfs;
 	void *backend;
 	struct k_mutex mutex;
+
+#if CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE > 0
+	/* Read-ahead buffer of flash backends, holding ra_len bytes read
+	 * from offset ra_off of block ra_block.
+	 */
+	uint8_t ra_buffer[CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE];
+	lfs_block_t ra_block;
+	lfs_off_t ra_off;
+	lfs_size_t ra_len;
+#endif
 };
 
 /** @brief Define a littlefs configuration with customized size
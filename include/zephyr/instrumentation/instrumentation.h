@@ -32,6 +32,8 @@ enum instr_event_types {
 	INSTR_EVENT_PROFILE,	/**< Profile events */
 	INSTR_EVENT_SCHED_IN,	/**< Thread switched in scheduler event */
 	INSTR_EVENT_SCHED_OUT,	/**< Thread switched out scheduler event */
+	INSTR_EVENT_ENTRY_COMPACT, /**< Callee entry event record, followed by instr_compact. */
+	INSTR_EVENT_EXIT_COMPACT, /**< Callee exit event record, followed by instr_compact. */
 	INSTR_EVENT_NUM,	/**< Add more events above this one */
 	INSTR_EVENT_INVALID	/**< Invalid or no event generated after promotion */
 } __packed;
@@ -75,6 +77,27 @@ struct instr_record {
 	};
 } __packed;
 
+/**
+ * @brief Compact entry/exit event record.
+ *
+ * Used instead of struct instr_record when
+ * CONFIG_INSTRUMENTATION_MODE_CALLGRAPH_COMPACT is enabled and the time since
+ * the previous record fits in 32 bits. The caller and the thread name are not
+ * recorded, the thread name can be found from the scheduler events.
+ */
+struct instr_record_compact {
+	struct instr_header header;
+	void *callee;
+	/** Time since the previous record, in nanoseconds. */
+	uint32_t delta_t;
+	/** Arch-specific mode indicator (thread mode, interrupt mode, etc.). */
+	uint8_t mode: 3;
+	/** CPU number. */
+	uint8_t cpu: 5;
+	/** Thread ID (correlate values with thread lookup table). */
+	void *thread_id;
+} __packed;
+
 /**
  * @brief Checks if tracing feature is available.
  *
@@ -174,6 +197,52 @@ bool instr_trace_enabled(void);
  */
 bool instr_profile_enabled(void);
 
+/**
+ * @brief Enables or disables instrumentation of the code in a given range.
+ *
+ * Instrumentation of the functions located in [@a start, @a end) is turned on
+ * or off at runtime, for instance to restrict tracing to a single function or
+ * to the code of one module. The range is rounded out to
+ * CONFIG_INSTRUMENTATION_FILTER_GRANULE, functions sharing a granule are
+ * filtered together. Code outside of the first
+ * CONFIG_INSTRUMENTATION_FILTER_TEXT_SIZE bytes of the text region is always
+ * instrumented.
+ *
+ * @kconfig_dep{CONFIG_INSTRUMENTATION_FILTER}
+ *
+ * @param start  First address of the range.
+ * @param end    Address past the end of the range.
+ * @param enable true to instrument the range, false to skip it.
+ */
+void instr_filter_set(void *start, void *end, bool enable);
+
+/**
+ * @brief Enables or disables instrumentation of all code covered by the filter.
+ *
+ * @kconfig_dep{CONFIG_INSTRUMENTATION_FILTER}
+ *
+ * @param enable true to instrument all code, false to skip it all.
+ */
+void instr_filter_set_all(bool enable);
+
+/**
+ * @brief Freezes the trace buffer.
+ *
+ * Stops recording trace events so the buffer keeps the events that led to
+ * the call, until it is dumped. It can be called when the application detects
+ * a condition worth investigating. The buffer is also frozen when
+ * CONFIG_INSTRUMENTATION_SNAPSHOT_LATENCY_US is set and the time between the
+ * trigger function call and the stopper function return exceeds it.
+ */
+void instr_snapshot(void);
+
+/**
+ * @brief Tells if the trace buffer has been frozen by a snapshot.
+ *
+ * @return true if a snapshot was taken, false otherwise.
+ */
+bool instr_snapshot_taken(void);
+
 /**
  * @brief Dumps the buffered contents via UART (tracing).
  */
@@ -235,6 +235,44 @@ int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
  */
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len);
 
+/**
+ * @brief Get the next message in place, without copying it.
+ *
+ * The message stays in the buffer, and its space is not reused by the writer,
+ * until released with @ref pbuf_read_finish. Messages wrapping around the end
+ * of the buffer are not contiguous and must be read with @ref pbuf_read.
+ *
+ * @param pb		A buffer from which data will be read.
+ * @param[out] buf	Pointer to the message in the buffer.
+ * @retval int	Length of the message, negative error code on fail.
+ *		0, if the buffer is empty.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-ENOBUFS, if the message wraps around the end of the buffer.
+ *		-EAGAIN, if not whole message is ready yet.
+ */
+int pbuf_read_claim(struct pbuf *pb, const char **buf);
+
+/**
+ * @brief Release a message got with @ref pbuf_read_claim.
+ *
+ * @param pb	A buffer from which data was read.
+ * @param len	Length of the message returned by @ref pbuf_read_claim.
+ * @retval int	0 on success, -EINVAL if any of input parameter is incorrect.
+ */
+int pbuf_read_finish(struct pbuf *pb, uint16_t len);
+
+/**
+ * @brief Read the read index of the reader from pbuf.
+ *
+ * Lets the writer tell whether the reader read all the messages written
+ * before a given write index, for example to only notify a reader which
+ * may have stopped reading.
+ *
+ * @param pb		A buffer to which data is written.
+ * @retval uint32_t	The read index.
+ */
+uint32_t pbuf_rd_idx_read(struct pbuf *pb);
+
 /**
  * @brief Read handshake word from pbuf.
  *
@@ -826,6 +826,35 @@ static inline bool k_is_pre_kernel(void)
 	return !z_sys_post_kernel;
 }
 
+#if defined(CONFIG_CPU_ID_IN_TLS) || !defined(CONFIG_SMP) || defined(__DOXYGEN__)
+/**
+ * @brief Get the ID of the CPU the current thread runs on.
+ *
+ * Unlike arch_curr_cpu(), this can be called from user mode, and costs a
+ * single load of a thread local variable on SMP systems, where it requires
+ * @kconfig{CONFIG_CPU_ID_IN_TLS}.
+ *
+ * The thread may migrate to another CPU right after the call, so the result
+ * is only a hint: it is meant to pick per-CPU data, such as per-CPU counters
+ * or free lists, that is then updated with atomic operations. These stay
+ * correct if the thread migrates, and do not bounce cache lines between the
+ * CPUs otherwise.
+ *
+ * @return ID of the CPU, from 0 to arch_num_cpus() - 1.
+ */
+static inline unsigned int k_cpu_id_get(void)
+{
+#ifdef CONFIG_CPU_ID_IN_TLS
+	/* Stored by the scheduler when the thread is switched in */
+	extern Z_THREAD_LOCAL uint8_t z_tls_cpu_id;
+
+	return z_tls_cpu_id;
+#else
+	return 0;
+#endif
+}
+#endif /* CONFIG_CPU_ID_IN_TLS || !CONFIG_SMP */
+
 /**
  * @brief Get thread ID of the current thread.
  *
@@ -2634,6 +2663,7 @@ struct k_event {
  */
 	_wait_q_t         wait_q;
 	uint32_t          events;
+	uint32_t          wait_mask;
 	struct k_spinlock lock;
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
@@ -2655,6 +2685,7 @@ struct k_event {
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
 	.events = 0, \
+	.wait_mask = 0, \
 	.lock = {}, \
 	}
 /**
@@ -3382,6 +3413,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3411,6 +3443,16 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_MUTEX_FAST_PATH
+	/** Set while threads may be waiting on the mutex */
+	atomic_t contended;
+#endif /* CONFIG_MUTEX_FAST_PATH */
+
+#ifdef CONFIG_LOCK_STATS
+	/** Contention statistics, NULL when not gathered */
+	struct k_lock_stats *stats;
+#endif /* CONFIG_LOCK_STATS */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
@@ -3592,6 +3634,129 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @defgroup rwlock_apis Read-Write Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Reader count of one CPU, on its own cache line in SMP */
+struct z_rwlock_readers {
+	atomic_t count;
+} __aligned(COND_CODE_1(CONFIG_SMP, (64), (sizeof(atomic_t))));
+
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Read-write lock structure
+ *
+ * All the members are internal and should not be accessed directly.
+ */
+struct k_rwlock {
+	/**
+	 * @cond INTERNAL_HIDDEN
+	 */
+	struct z_rwlock_readers readers[CONFIG_MP_MAX_NUM_CPUS];
+	/* Set while a writer waits for or holds the lock */
+	atomic_t writer;
+	/* Serializes writers, and readers arriving while a writer is pending */
+	struct k_mutex wr_lock;
+	/* Given by readers leaving while a writer is pending */
+	struct k_sem drained;
+	/** @endcond */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj)                                                                  \
+	{                                                                                          \
+		.wr_lock = Z_MUTEX_INITIALIZER((obj).wr_lock),                                     \
+		.drained = Z_SEM_INITIALIZER((obj).drained, 0, 1),                                 \
+	}
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a read-write lock.
+ *
+ * The read-write lock can be accessed outside the module where it is
+ * defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the read-write lock.
+ */
+#define K_RWLOCK_DEFINE(name) struct k_rwlock name = Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a read-write lock.
+ *
+ * @param rwlock Address of the read-write lock.
+ */
+void k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a read-write lock for reading.
+ *
+ * Readers only update a counter of the CPU they run on, so taking the lock
+ * for reading does not contend with readers on other CPUs. A reader arriving
+ * while a writer waits for or holds the lock queues behind that writer, so
+ * writers are not starved. As a consequence, a thread already holding the
+ * lock for reading must not take it again for reading.
+ *
+ * @param rwlock Address of the read-write lock.
+ * @param timeout Waiting period to lock the read-write lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Read-write lock locked for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a read-write lock locked for reading.
+ *
+ * The lock can be released from another CPU than the one it was taken on.
+ *
+ * @param rwlock Address of the read-write lock.
+ */
+void k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a read-write lock for writing.
+ *
+ * Blocks new readers, then waits for the current readers to leave.
+ *
+ * @param rwlock Address of the read-write lock.
+ * @param timeout Waiting period to lock the read-write lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Read-write lock locked for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a read-write lock locked for writing.
+ *
+ * @param rwlock Address of the read-write lock.
+ */
+void k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup semaphore_apis Semaphore APIs
  * @ingroup kernel_apis
@@ -3609,11 +3774,19 @@ struct k_sem {
 	 * @cond INTERNAL_HIDDEN
 	 */
 	_wait_q_t wait_q;
+#ifdef CONFIG_SEM_FAST_PATH
+	atomic_t count;
+#else
 	unsigned int count;
+#endif /* CONFIG_SEM_FAST_PATH */
 	unsigned int limit;
 
 	Z_DECL_POLL_EVENT
 
+#ifdef CONFIG_LOCK_STATS
+	struct k_lock_stats *stats;
+#endif /* CONFIG_LOCK_STATS */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_sem)
 
 #ifdef CONFIG_OBJ_CORE_SEM
@@ -3626,6 +3799,12 @@ struct k_sem {
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_SEM_FAST_PATH
+/* Count bits of k_sem.count, the remaining top bit flags waiters */
+#define Z_SEM_COUNT_MASK ((atomic_val_t)(BIT(ATOMIC_BITS - 1U) - 1U))
+#define Z_SEM_WAITERS    (~Z_SEM_COUNT_MASK)
+#endif /* CONFIG_SEM_FAST_PATH */
+
 #define Z_SEM_INITIALIZER(obj, initial_count, count_limit) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&(obj).wait_q), \
@@ -3725,7 +3904,11 @@ __syscall unsigned int k_sem_count_get(struct k_sem *sem);
  */
 static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 {
+#ifdef CONFIG_SEM_FAST_PATH
+	return (unsigned int)(atomic_get(&sem->count) & Z_SEM_COUNT_MASK);
+#else
 	return sem->count;
+#endif /* CONFIG_SEM_FAST_PATH */
 }
 
 /**
@@ -3950,6 +4133,42 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 int k_work_submit(struct k_work *work);
 
+/** @brief Submit several work items to a queue at once.
+ *
+ * Equivalent to calling k_work_submit_to_queue() for each item in
+ * order, except that the work lock is taken once for the whole batch
+ * and the caller is rescheduled at most once.  This is intended for
+ * producers, typically ISRs, that post bursts of work items.
+ *
+ * Each item is handled independently with the same rules as
+ * k_work_submit_to_queue(): items already queued are left alone,
+ * running items are queued to the queue that runs them, and a rejected
+ * item does not prevent the remaining ones from being submitted.
+ *
+ * @isr_ok
+ *
+ * @param queue pointer to the work queue on which the items should run.  If
+ * NULL each item uses the queue from its most recent submission.
+ * @param work array of pointers to the work items.
+ * @param count number of entries in @p work.
+ *
+ * @return the number of items that were newly queued, or the negative error
+ * k_work_submit_to_queue() would have returned for the first rejected item.
+ */
+int k_work_submit_batch_to_queue(struct k_work_q *queue,
+				 struct k_work *const *work, size_t count);
+
+/** @brief Submit several work items to the system queue at once.
+ *
+ * @isr_ok
+ *
+ * @param work array of pointers to the work items.
+ * @param count number of entries in @p work.
+ *
+ * @return as with k_work_submit_batch_to_queue().
+ */
+int k_work_submit_batch(struct k_work *const *work, size_t count);
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -4076,6 +4295,43 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *cfg);
 
+/** @brief Add a worker thread to a running work queue.
+ *
+ * Work queues are normally serviced by a single thread.  When
+ * CONFIG_WORKQUEUE_POOL is enabled additional threads can be attached
+ * to a started queue, allowing independent work items submitted to it
+ * to be processed concurrently (e.g. one worker per CPU).
+ *
+ * A given work item is still never run by more than one worker at a
+ * time: if it is resubmitted while running, the resubmission is held on
+ * the queue until the running invocation returns.  Flush, cancel and
+ * drain operations wait for all workers of the queue as appropriate.
+ *
+ * The worker thread takes the name of the queue's primary thread.  The
+ * worker stops when the queue is stopped with k_work_queue_stop().
+ *
+ * @param queue pointer to a started work queue.
+ *
+ * @param worker pointer to the worker structure, which must remain
+ *        valid until the queue is stopped.
+ *
+ * @param stack pointer to the worker thread stack area.
+ *
+ * @param stack_size size of the worker thread stack area, in bytes.
+ *
+ * @param prio initial thread priority
+ *
+ * @param cpu CPU the worker is to be pinned to, or -1 to let it run on
+ *        any CPU.  Ignored unless CONFIG_SCHED_CPU_MASK is enabled.
+ *
+ * @retval 0 if the worker was added.
+ * @retval -ENODEV if the queue is not started or is being stopped.
+ */
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, int cpu);
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -4580,6 +4836,12 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* Work item being flushed, used to order the flush against
+	 * workers processing the item concurrently.
+	 */
+	struct k_work *target;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4692,6 +4954,32 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* Additional worker threads added by k_work_queue_add_worker(). */
+	sys_slist_t workers;
+
+	/* Flushers waiting for a running item to complete. */
+	sys_slist_t parked;
+
+	/* Number of worker threads, including the primary one. */
+	uint8_t nthreads;
+
+	/* Number of worker threads currently running a work item. */
+	uint8_t nbusy;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+};
+
+/** @brief Additional worker thread of a work queue.
+ *
+ * @see k_work_queue_add_worker()
+ */
+struct k_work_q_worker {
+	/* The thread that helps animate the queue. */
+	struct k_thread thread;
+
+	/* Node in the queue's list of workers. */
+	sys_snode_t node;
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -5124,6 +5412,14 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+/* A thread owns or waits for a slot reserved with k_msgq_reserve() */
+#define K_MSGQ_FLAG_RESERVE	BIT(1)
+/* The slot at the write pointer is reserved */
+#define K_MSGQ_FLAG_RESERVED	BIT(2)
+/* A thread owns or waits for the queue head with k_msgq_peek_slot() */
+#define K_MSGQ_FLAG_PEEK	BIT(3)
+/* The message at the read pointer is held by k_msgq_peek_slot() */
+#define K_MSGQ_FLAG_PEEKED	BIT(4)
 
 /**
  * @brief Message Queue Attributes
@@ -5233,6 +5529,7 @@ int k_msgq_cleanup(struct k_msgq *msgq);
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A slot is reserved with k_msgq_reserve().
  */
 __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 
@@ -5259,6 +5556,8 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  *
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EBUSY A slot is reserved with k_msgq_reserve(), or the head
+ *                of the queue is held with k_msgq_peek_slot().
  */
 __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
 
@@ -5281,6 +5580,7 @@ __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
  * @retval 0 Message received.
  * @retval -ENOMSG Returned without waiting or queue purged.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY The head of the queue is held with k_msgq_peek_slot().
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
@@ -5323,12 +5623,105 @@ __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
  *
  * This routine discards all unreceived messages in a message queue's ring
  * buffer. Any threads that are blocked waiting to send a message to the
- * message queue are unblocked and see an -ENOMSG error code.
+ * message queue are unblocked and see an -ENOMSG error code. A message held
+ * with k_msgq_peek_slot() is discarded too, while a slot reserved with
+ * k_msgq_reserve() stays reserved.
  *
  * @param msgq Address of the message queue.
  */
 __syscall void k_msgq_purge(struct k_msgq *msgq);
 
+/**
+ * @brief Reserve a message slot for writing in place.
+ *
+ * This routine hands out the next free slot of the message queue's ring
+ * buffer, so a producer can build a message in place instead of having it
+ * copied by k_msgq_put(). The message becomes visible to consumers when
+ * committed with k_msgq_commit().
+ *
+ * Only one slot can be reserved at a time. While it is, k_msgq_put() and
+ * k_msgq_put_front() return -EBUSY.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @note Not available from user mode, as the slot is in the message
+ * queue's ring buffer.
+ *
+ * @isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Set to the address of the reserved slot, of the queue's
+ *             message size.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot reserved.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Another slot is reserved, or other threads wait for room.
+ */
+int k_msgq_reserve(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Commit a slot reserved with k_msgq_reserve().
+ *
+ * This routine adds the message written to the reserved slot to the end of
+ * the message queue.
+ *
+ * @isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL No slot is reserved.
+ */
+int k_msgq_commit(struct k_msgq *msgq);
+
+/**
+ * @brief Get the message at the head of a message queue in place.
+ *
+ * This routine hands out the oldest message of the queue without copying
+ * it. The message stays in the queue until k_msgq_release() is called.
+ *
+ * Only one message can be held at a time. While it is, k_msgq_get() and
+ * k_msgq_put_front() return -EBUSY.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @note Not available from user mode, as the message is in the message
+ * queue's ring buffer.
+ *
+ * @isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Set to the address of the message.
+ * @param timeout Waiting period for a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message held.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Another message is held, or other threads wait for a
+ *                message.
+ */
+int k_msgq_peek_slot(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Release a message held with k_msgq_peek_slot().
+ *
+ * This routine removes the held message from the message queue, making its
+ * slot available to producers.
+ *
+ * @isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message removed.
+ * @retval -EINVAL No message is held, or it was discarded by
+ *                 k_msgq_purge().
+ */
+int k_msgq_release(struct k_msgq *msgq);
+
 /**
  * @brief Get the amount of free space in a message queue.
  *
@@ -5355,7 +5748,9 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	uint32_t reserved = ((msgq->flags & K_MSGQ_FLAG_RESERVED) != 0U) ? 1U : 0U;
+
+	return msgq->max_msgs - msgq->used_msgs - reserved;
 }
 
 /**
@@ -5676,6 +6071,14 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+struct k_mem_slab_magazine {
+	struct k_spinlock lock;
+	uint32_t count;
+	char *blocks[CONFIG_MEM_SLAB_MAGAZINE_SIZE];
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5683,6 +6086,12 @@ struct k_mem_slab {
 	char *free_list;
 	struct k_mem_slab_info info;
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	/* Threads allocating from the free list, magazines are bypassed */
+	atomic_t waiters;
+	struct k_mem_slab_magazine magazines[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
@@ -5690,6 +6099,21 @@ struct k_mem_slab {
 #endif
 };
 
+static inline uint32_t z_mem_slab_num_cached(struct k_mem_slab *slab)
+{
+	uint32_t cached = 0U;
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->magazines[i].count;
+	}
+#else
+	ARG_UNUSED(slab);
+#endif
+
+	return cached;
+}
+
 #define Z_MEM_SLAB_INITIALIZER(_slab, _slab_buffer, _slab_block_size, \
 			       _slab_num_blocks)                      \
 	{                                                             \
@@ -5894,7 +6318,7 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_used;
+	return slab->info.num_used - z_mem_slab_num_cached(slab);
 }
 
 /**
@@ -5933,7 +6357,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -6128,6 +6552,14 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 /* Number of bytes consumed by buckets */
 #define _Z_HEAP_BUCKETS_SIZE(bytes) (_Z_HEAP_NUM_BUCKETS(bytes) * sizeof(uint32_t))
 
+/* Number of bytes consumed by the optional size class table */
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+#define _Z_HEAP_SIZE_CLASSES_SIZE                                                                  \
+	((2 + (CONFIG_SYS_HEAP_SIZE_CLASS_MAX / 8)) * sizeof(uint32_t))
+#else
+#define _Z_HEAP_SIZE_CLASSES_SIZE 0
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
 /**
  * @brief Minimum heap size required for allocating a given size
  *
@@ -6142,6 +6574,7 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
  * The parameters considered:
  *   Size of the header "struct z_heap"
  *   Buckets holding chunk metadata
+ *   Size class table, if CONFIG_SYS_HEAP_SIZE_CLASSES is enabled
  *   Free heap chunk
  *   End chunk
  *   Chunk metadata for single allocation
@@ -6151,7 +6584,8 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
  * @return Approximate size of the heap required to allocate @a alloc_bytes
  */
 #define Z_HEAP_MIN_SIZE_FOR(alloc_bytes) \
-	((alloc_bytes) + _Z_HEAP_SIZE + _Z_HEAP_BUCKETS_SIZE(alloc_bytes) + (3 * 8))
+	((alloc_bytes) + _Z_HEAP_SIZE + _Z_HEAP_BUCKETS_SIZE(alloc_bytes) +             \
+	 _Z_HEAP_SIZE_CLASSES_SIZE + (3 * 8))
 
 /**
  * @brief Define a static k_heap in the specified linker section
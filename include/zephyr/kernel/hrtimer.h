@@ -0,0 +1,105 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief High-resolution timers
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_HRTIMER_H_
+#define ZEPHYR_INCLUDE_KERNEL_HRTIMER_H_
+
+#include <stdint.h>
+#include <zephyr/sys/dlist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup hrtimer_apis High-resolution timer APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+struct k_hrtimer;
+
+/**
+ * @brief High-resolution timer expiry function.
+ *
+ * Called in interrupt context, with the timer already restarted if it is
+ * periodic. The function may restart or stop the timer.
+ *
+ * @param timer Expired timer.
+ */
+typedef void (*k_hrtimer_handler_t)(struct k_hrtimer *timer);
+
+/**
+ * @brief High-resolution timer.
+ *
+ * Unlike @ref k_timer, which expires on system clock ticks, a high-resolution
+ * timer expires at a given value of the hardware cycle counter returned by
+ * k_cycle_get_64(): the system timer driver programs its comparator for the
+ * earliest of the next tick timeout and the next high-resolution timer.
+ */
+struct k_hrtimer {
+	/** @cond INTERNAL_HIDDEN */
+	sys_dnode_t node;
+	uint64_t expiry;
+	uint64_t period;
+	k_hrtimer_handler_t handler;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a high-resolution timer.
+ *
+ * @param timer Timer.
+ * @param handler Expiry function.
+ */
+void k_hrtimer_init(struct k_hrtimer *timer, k_hrtimer_handler_t handler);
+
+/**
+ * @brief Start a high-resolution timer.
+ *
+ * The expiry is absolute, so that a periodic schedule does not drift with the
+ * handling latency. A timer already running is restarted. An expiry in the
+ * past makes the timer expire as soon as possible.
+ *
+ * @param timer Timer.
+ * @param expiry Value of k_cycle_get_64() at which the timer expires.
+ * @param period Period in cycles after the first expiry, or 0 for a one-shot
+ *               timer.
+ */
+void k_hrtimer_start(struct k_hrtimer *timer, uint64_t expiry, uint64_t period);
+
+/**
+ * @brief Stop a high-resolution timer.
+ *
+ * The expiry function is not called anymore once this returns, unless it is
+ * already running on another CPU.
+ *
+ * @param timer Timer.
+ */
+void k_hrtimer_stop(struct k_hrtimer *timer);
+
+/**
+ * @brief Get the next expiry of a high-resolution timer.
+ *
+ * @param timer Timer.
+ *
+ * @return Value of k_cycle_get_64() at which the timer expires next, or 0 if
+ *         it is not running.
+ */
+uint64_t k_hrtimer_expiry_get(const struct k_hrtimer *timer);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_HRTIMER_H_ */
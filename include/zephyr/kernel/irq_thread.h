@@ -0,0 +1,127 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Threaded interrupt handlers
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_IRQ_THREAD_H_
+#define ZEPHYR_INCLUDE_KERNEL_IRQ_THREAD_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup irq_thread_apis Threaded interrupt handler APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Bottom half handler of a threaded interrupt.
+ *
+ * Runs in the interrupt thread, once for one or more calls to
+ * k_irq_thread_wake() made since it last ran.
+ *
+ * @param arg Argument given when defining the interrupt thread.
+ */
+typedef void (*k_irq_thread_handler_t)(void *arg);
+
+/**
+ * @brief Interrupt thread.
+ *
+ * A thread dedicated to the bottom half of an interrupt. It waits directly on
+ * the interrupt thread rather than on a semaphore or a work queue, so that the
+ * ISR wakes it with a single scheduler operation, and does not queue behind
+ * unrelated work.
+ */
+struct k_irq_thread {
+	/** @cond INTERNAL_HIDDEN */
+	_wait_q_t wait_q;
+	atomic_t pending;
+	k_irq_thread_handler_t handler;
+	void *arg;
+	/** @endcond */
+};
+
+/**
+ * @brief Thread priority for the bottom half of an interrupt.
+ *
+ * Maps an interrupt priority, where lower values are more urgent, to a
+ * cooperative thread priority in the same order, so that the bottom halves
+ * run before all the preemptible threads and in the order of their
+ * interrupts.
+ *
+ * @param irq_prio Interrupt priority.
+ */
+#define K_IRQ_THREAD_PRIO(irq_prio) \
+	K_PRIO_COOP(MIN((irq_prio), CONFIG_NUM_COOP_PRIORITIES - 1))
+
+/**
+ * @brief Statically define and start an interrupt thread.
+ *
+ * @param name Name of the interrupt thread.
+ * @param stack_size Stack size of the thread.
+ * @param _handler Bottom half handler.
+ * @param _arg Argument of the handler.
+ * @param prio Priority of the thread, usually K_IRQ_THREAD_PRIO().
+ */
+#define K_IRQ_THREAD_DEFINE(name, stack_size, _handler, _arg, prio)		\
+	struct k_irq_thread name = {						\
+		.wait_q = Z_WAIT_Q_INIT(&name.wait_q),				\
+		.pending = ATOMIC_INIT(0),					\
+		.handler = _handler,						\
+		.arg = _arg,							\
+	};									\
+	K_THREAD_DEFINE(name##_thread, stack_size, z_irq_thread_entry,		\
+			&name, NULL, NULL, prio, 0, 0)
+
+/**
+ * @brief Create an interrupt thread.
+ *
+ * @param irq_thread Interrupt thread.
+ * @param thread Thread object.
+ * @param stack Stack of the thread.
+ * @param stack_size Stack size of the thread.
+ * @param handler Bottom half handler.
+ * @param arg Argument of the handler.
+ * @param prio Priority of the thread, usually K_IRQ_THREAD_PRIO().
+ *
+ * @return ID of the thread.
+ */
+k_tid_t k_irq_thread_create(struct k_irq_thread *irq_thread, struct k_thread *thread,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    k_irq_thread_handler_t handler, void *arg, int prio);
+
+/**
+ * @brief Wake an interrupt thread.
+ *
+ * Called from the ISR to run the bottom half handler. Calls made before the
+ * handler runs are coalesced into a single run, so the handler must process
+ * all the pending events of the device.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param irq_thread Interrupt thread.
+ */
+void k_irq_thread_wake(struct k_irq_thread *irq_thread);
+
+/** @cond INTERNAL_HIDDEN */
+void z_irq_thread_entry(void *p1, void *p2, void *p3);
+/** @endcond */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_IRQ_THREAD_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_LOCK_STATS_H_
+#define ZEPHYR_INCLUDE_KERNEL_LOCK_STATS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct k_spinlock;
+struct k_mutex;
+struct k_sem;
+
+/**
+ * @brief Lock contention statistics
+ * @defgroup lock_stats_apis Lock contention statistics
+ * @ingroup kernel_apis
+ *
+ * Statistics gathered for the spinlocks, mutexes and semaphores they are
+ * registered with, when CONFIG_LOCK_STATS is enabled. Times are in
+ * hardware cycles. Semaphores have no owner, so their hold time is not
+ * tracked.
+ * @{
+ */
+
+/** Statistics of a lock instance. */
+struct k_lock_stats {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	uint32_t hold_start;
+	/** @endcond */
+	/** Lock class name, shared by the instances of a class. */
+	const char *name;
+	/** Number of acquisitions. */
+	uint32_t acquires;
+	/** Number of acquisitions which had to wait for the lock. */
+	uint32_t contended;
+	/** Longest wait for the lock. */
+	uint32_t wait_max;
+	/** Longest time the lock was held. */
+	uint32_t hold_max;
+	/** Sum of the waits for the lock. */
+	uint64_t wait_total;
+	/** Sum of the times the lock was held. */
+	uint64_t hold_total;
+};
+
+/**
+ * @brief Gather statistics for a spinlock.
+ *
+ * Must be called while the spinlock is not in use, for instance from a
+ * PRE_KERNEL init function for kernel locks.
+ *
+ * @param l Spinlock.
+ * @param stats Statistics, zero initialized.
+ * @param name Lock class name.
+ */
+void k_spin_lock_stats_register(struct k_spinlock *l, struct k_lock_stats *stats,
+				const char *name);
+
+/**
+ * @brief Gather statistics for a mutex.
+ *
+ * Must be called after k_mutex_init(), while the mutex is not in use.
+ *
+ * @param mutex Mutex.
+ * @param stats Statistics, zero initialized.
+ * @param name Lock class name.
+ */
+void k_mutex_stats_register(struct k_mutex *mutex, struct k_lock_stats *stats,
+			    const char *name);
+
+/**
+ * @brief Gather statistics for a semaphore.
+ *
+ * Must be called after k_sem_init(), while the semaphore is not in use.
+ *
+ * @param sem Semaphore.
+ * @param stats Statistics, zero initialized.
+ * @param name Lock class name.
+ */
+void k_sem_stats_register(struct k_sem *sem, struct k_lock_stats *stats, const char *name);
+
+/**
+ * @brief Callback for k_lock_stats_foreach().
+ *
+ * @param stats Statistics of a lock instance.
+ * @param user_data User data.
+ */
+typedef void (*k_lock_stats_cb_t)(const struct k_lock_stats *stats, void *user_data);
+
+/**
+ * @brief Walk the statistics of all registered locks.
+ *
+ * Statistics are read while being updated, values of a lock may be
+ * slightly inconsistent with each other.
+ *
+ * @param cb Callback.
+ * @param user_data User data passed to @p cb.
+ */
+void k_lock_stats_foreach(k_lock_stats_cb_t cb, void *user_data);
+
+/**
+ * @brief Reset the statistics of all registered locks.
+ */
+void k_lock_stats_reset(void);
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Called with the lock held, wait_start is the cycle count when the
+ * acquisition started.
+ */
+void z_lock_stats_acquired(struct k_lock_stats *stats, uint32_t wait_start, bool contended);
+
+/* Called with the lock held, right before releasing it. */
+void z_lock_stats_released(struct k_lock_stats *stats);
+
+/* Same as z_lock_stats_acquired() for locks without exclusive owner. */
+void z_lock_stats_shared_acquired(struct k_lock_stats *stats, uint32_t wait_start,
+				  bool contended);
+
+/** @endcond */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_LOCK_STATS_H_ */
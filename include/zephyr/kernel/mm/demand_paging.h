@@ -59,6 +59,16 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_PREFETCH) || defined(__DOXYGEN__)
+	struct {
+		/** Number of pages paged in ahead of any access to them */
+		unsigned long			pages;
+
+		/** Number of prefetched pages accessed before being evicted */
+		unsigned long			hits;
+	} prefetch;
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -27,6 +27,30 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_LATENCY is selected.
+	 * @{
+	 */
+	uint64_t  ready;        /**< \# of cycles spent ready but not running */
+	uint64_t  preempted;    /**< \# of ready cycles following a preemption */
+	uint32_t  num_preemptions; /**< \# of times preempted while ready */
+	uint32_t  num_ipis;     /**< \# of IPIs raised to schedule the thread */
+	uint32_t  ready_stamp;  /**< start of current ready window, 0 if none */
+	bool      was_preempted; /**< current ready window follows a preemption */
+	/** Scheduling latency histogram, bucket N spans [2^N, 2^(N+1)) cycles */
+	uint32_t  latency[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+#if defined(CONFIG_SCHED_THREAD_USAGE_UTIL) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_UTIL is selected.
+	 * @{
+	 */
+	uint32_t  util;         /**< decayed utilization, 2^20 is full time */
+	uint32_t  util_stamp;   /**< end of the last usage window */
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
@@ -109,6 +109,11 @@ struct _thread_base {
 
 #endif /* CONFIG_SMP */
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* Index of the per-CPU run queue the thread is queued on */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 #ifdef CONFIG_SCHED_CPU_MASK
 	/* "May run on" bits for each CPU */
 	uint16_t cpu_mask;
@@ -204,6 +209,9 @@ struct _thread_userspace_local_data {
 };
 #endif /* CONFIG_THREAD_USERSPACE_LOCAL_DATA */
 
+/** Utilization of a thread or CPU running all the time */
+#define K_THREAD_UTIL_SCALE 1024U
+
 typedef struct k_thread_runtime_stats {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	/*
@@ -237,6 +245,31 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	/*
+	 * Time spent in the ready queue. For CPUs these are the sums over
+	 * all threads that were switched in on that CPU.
+	 */
+
+	uint64_t ready_cycles;        /* # of cycles spent ready, not running */
+	uint64_t preempted_cycles;    /* # of ready cycles after preemption */
+	uint32_t num_preemptions;     /* # of preemptions */
+	uint32_t num_ipis;            /* # of IPIs raised for scheduling */
+
+	/* Ready to running latency, bucket N spans [2^N, 2^(N+1)) cycles */
+	uint32_t latency_hist[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+	/*
+	 * Decayed fraction of the time spent running (non-idle for CPUs),
+	 * K_THREAD_UTIL_SCALE meaning all the time. For all CPUs combined
+	 * this is the sum over the CPUs.
+	 */
+
+	uint32_t util;
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
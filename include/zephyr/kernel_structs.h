@@ -127,6 +127,19 @@ struct _priq_mq {
 #endif
 };
 
+/* Two-level bitmap indexed variant of the multi-queue structure.  A
+ * summary word marks the non-empty words of the per-priority bitmap,
+ * so the best priority is found with two count-trailing-zeros
+ * operations regardless of the number of priorities.  Unlike the
+ * multi-queue, each list is kept in deadline order when deadline
+ * scheduling is enabled.
+ */
+struct _priq_bm {
+	sys_dlist_t queues[K_NUM_THREAD_PRIO];
+	unsigned long bitmask[PRIQ_BITMAP_SIZE];
+	unsigned long summary;
+};
+
 struct _ready_q {
 #ifndef CONFIG_SMP
 	/* always contains next thread to run: cannot be NULL */
@@ -139,6 +152,8 @@ struct _ready_q {
 	struct _priq_rb runq;
 #elif defined(CONFIG_SCHED_MULTIQ)
 	struct _priq_mq runq;
+#elif defined(CONFIG_SCHED_BITMAP)
+	struct _priq_bm runq;
 #endif
 };
 
@@ -157,7 +172,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -216,7 +231,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -234,6 +249,10 @@ struct z_kernel {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	/* Identify CPUs to send IPIs to at the next scheduling point */
 	atomic_t pending_ipi;
+#ifdef CONFIG_IPI_COALESCE
+	/* Identify CPUs sent an IPI that have not rescheduled since */
+	atomic_t ipi_in_flight;
+#endif
 #endif
 };
 
@@ -308,6 +327,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+	/* CPU whose timeout queue holds this timeout */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
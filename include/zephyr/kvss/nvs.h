@@ -62,6 +62,12 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if defined(CONFIG_NVS_GC_BACKGROUND) || defined(__DOXYGEN__)
+	/** Background garbage collection work item */
+	struct k_work gc_work;
+	/** Sector left alone by background garbage collection */
+	uint16_t gc_skip_sector;
+#endif
 };
 
 /**
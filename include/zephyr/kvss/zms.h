@@ -65,6 +65,16 @@ struct zms_fs {
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_ZMS_LOOKUP_INDEX
+	/** Hash table holding the most recent ATE address of every written ID */
+	struct zms_lookup_entry *lookup_index;
+	/** Number of slots of the lookup index */
+	uint32_t lookup_index_size;
+	/** Number of used slots of the lookup index */
+	uint32_t lookup_index_used;
+	/** Flag indicating that the lookup index holds every ID */
+	bool lookup_index_complete;
+#endif
 };
 
 /**
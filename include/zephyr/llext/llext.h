@@ -194,6 +194,16 @@ struct llext_load_param {
 	 */
 	bool pre_located;
 
+	/**
+	 * Execute the extension in place. Requires @ref pre_located: the
+	 * read-only regions are used directly from the ELF buffer, typically
+	 * in memory-mapped flash, while the LLEXT core copies the initial
+	 * contents of the writable regions to their pre-defined addresses and
+	 * clears the BSS there, as startup code does for the main image. Only
+	 * these writable regions use RAM.
+	 */
+	bool xip;
+
 	/**
 	 * Extensions can implement custom ELF sections to be loaded in specific
 	 * memory regions, detached from other sections of compatible types.
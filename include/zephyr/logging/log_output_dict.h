@@ -23,8 +23,14 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	MSG_SYNC = 2,
 };
 
+/**
+ * Magic following the type of a sync record.
+ */
+#define LOG_DICT_OUTPUT_SYNC_MAGIC "ZLOGSYN"
+
 /**
  * Output header for one dictionary based log message.
  */
@@ -47,6 +53,18 @@ struct log_dict_output_dropped_msg_t {
 	uint16_t num_dropped_messages;
 } __packed;
 
+/**
+ * Sync record for dictionary based logging.
+ *
+ * Marks a record boundary so that a decoder can start from the middle
+ * of stored log data. Sequence number orders the stored blocks.
+ */
+struct log_dict_output_sync_msg_t {
+	uint8_t type;
+	char magic[sizeof(LOG_DICT_OUTPUT_SYNC_MAGIC) - 1];
+	uint32_t seq;
+} __packed;
+
 /** @brief Process log messages v2 for dictionary-based logging.
  *
  * Function is using provided context with the buffer and output function to
@@ -68,6 +86,13 @@ void log_dict_output_msg_process(const struct log_output *log_output,
  */
 void log_dict_output_dropped_process(const struct log_output *output, uint32_t cnt);
 
+/** @brief Output a sync record for dictionary-based logging.
+ *
+ * @param output Pointer to the log output instance.
+ * @param seq    Sequence number of the block starting with the record.
+ */
+void log_dict_output_sync_process(const struct log_output *output, uint32_t seq);
+
 #ifdef __cplusplus
 }
 #endif
@@ -63,6 +63,41 @@ void *mem_attr_heap_alloc(uint32_t attr, size_t bytes);
  */
 void *mem_attr_heap_aligned_alloc(uint32_t attr, size_t align, size_t bytes);
 
+/**
+ * @brief Allocate aligned memory following an attribute preference list.
+ *
+ * Tries each attribute of @p attrs in order and returns the first successful
+ * allocation. This implements placement policies such as "fast on-chip memory
+ * first, fall back to external RAM" for objects that work from any region but
+ * run faster in some.
+ *
+ * @param attrs attributes to try, most preferred first.
+ * @param num_attrs number of entries in @p attrs.
+ * @param align power of two alignment for the returned pointer in bytes.
+ * @param bytes requested size of the allocation in bytes.
+ *
+ * @retval ptr a valid pointer to the allocated memory.
+ * @retval NULL if no memory is available with any of the attributes.
+ */
+void *mem_attr_heap_aligned_alloc_prefer(const uint32_t *attrs, size_t num_attrs,
+					 size_t align, size_t bytes);
+
+/**
+ * @brief Allocate memory following an attribute preference list.
+ *
+ * Convenience wrapper around @ref mem_attr_heap_aligned_alloc_prefer taking
+ * the attributes as variadic arguments, most preferred first.
+ *
+ * @param bytes requested size of the allocation in bytes.
+ * @param ... attributes to try, in order.
+ *
+ * @retval ptr a valid pointer to the allocated memory.
+ * @retval NULL if no memory is available with any of the attributes.
+ */
+#define MEM_ATTR_HEAP_ALLOC_PREFER(bytes, ...)                                                     \
+	mem_attr_heap_aligned_alloc_prefer((const uint32_t[]){__VA_ARGS__},                        \
+					   NUM_VA_ARGS(__VA_ARGS__), 0, (bytes))
+
 /**
  * @brief Free the allocated memory
  *
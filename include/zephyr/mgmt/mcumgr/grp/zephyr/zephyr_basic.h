@@ -22,6 +22,7 @@ extern "C" {
  * @{
  */
 #define ZEPHYR_MGMT_GRP_BASIC_CMD_ERASE_STORAGE 0 /**< Erase storage partition */
+#define ZEPHYR_MGMT_GRP_BASIC_CMD_BOOT_PROFILE 1 /**< Read boot profile records */
 /** @} */
 
 /**
@@ -152,6 +152,8 @@ struct modem_cmux_dlci {
 	bool flow_control : 1;
 	bool rx_full : 1;
 	bool msc_sent : 1;
+	/* Receive ready notification pending */
+	bool rx_pending : 1;
 };
 
 struct modem_cmux_frame {
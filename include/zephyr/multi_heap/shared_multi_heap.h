@@ -148,6 +148,24 @@ void *shared_multi_heap_alloc(enum shared_multi_heap_attr attr, size_t bytes);
 void *shared_multi_heap_aligned_alloc(enum shared_multi_heap_attr attr,
 				      size_t align, size_t bytes);
 
+/**
+ * @brief Allocate aligned memory following an attribute preference list
+ *
+ * Tries each attribute of @p attrs in order and returns the first successful
+ * allocation, e.g. to place an object in on-chip cacheable memory when
+ * possible and in external memory otherwise.
+ *
+ * @param attrs		capabilities / attributes to try, most preferred first.
+ * @param num_attrs	number of entries in @p attrs.
+ * @param align		power of two alignment for the returned pointer, in bytes.
+ * @param bytes		requested size of the allocation in bytes.
+ *
+ * @retval ptr		a valid pointer to heap memory.
+ * @retval err		NULL if no memory is available for any attribute.
+ */
+void *shared_multi_heap_aligned_alloc_prefer(const enum shared_multi_heap_attr *attrs,
+					     size_t num_attrs, size_t align, size_t bytes);
+
 /**
  * @brief Free memory from the shared multi-heap pool
  *
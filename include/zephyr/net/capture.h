@@ -179,6 +179,73 @@ static inline int net_capture_disable(const struct device *dev)
 #endif
 }
 
+/**
+ * @typedef net_capture_filter_cb_t
+ * @brief Callback used to select the network packets to capture
+ *
+ * Called for every network packet of the captured interface, before the
+ * packet is copied, so that the packets that are not of interest do not
+ * take capture buffers nor tunnel bandwidth. The callback is called with
+ * the capture lock held, and must not block nor modify the packet.
+ *
+ * @param iface Network interface the packet is sent or received on
+ * @param pkt The network packet
+ * @param user_data A valid pointer to user data or NULL
+ *
+ * @return true if the packet is to be captured, false otherwise
+ */
+typedef bool (*net_capture_filter_cb_t)(struct net_if *iface, struct net_pkt *pkt,
+					void *user_data);
+
+/**
+ * @brief Set the filter of a network capture device.
+ *
+ * @param dev Network capture device
+ * @param cb Filter callback, or NULL to capture all the packets
+ * @param user_data User supplied data passed to the callback
+ *
+ * @return 0 if ok, <0 if the filter could not be set
+ */
+#if defined(CONFIG_NET_CAPTURE)
+int net_capture_filter_set(const struct device *dev, net_capture_filter_cb_t cb,
+			   void *user_data);
+#else
+static inline int net_capture_filter_set(const struct device *dev,
+					 net_capture_filter_cb_t cb,
+					 void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Set the snapshot length of a network capture device.
+ *
+ * Captured packets longer than @p snaplen are truncated to their first
+ * @p snaplen bytes, typically to keep only the protocol headers.
+ *
+ * @param dev Network capture device
+ * @param snaplen Maximum number of bytes captured per packet, or 0 to
+ *        capture the packets in full
+ *
+ * @return 0 if ok, <0 if the snapshot length could not be set
+ */
+#if defined(CONFIG_NET_CAPTURE)
+int net_capture_snaplen_set(const struct device *dev, size_t snaplen);
+#else
+static inline int net_capture_snaplen_set(const struct device *dev, size_t snaplen)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(snaplen);
+
+	return -ENOTSUP;
+}
+#endif
+
 /** @cond INTERNAL_HIDDEN */
 
 /**
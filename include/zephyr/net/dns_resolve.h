@@ -537,6 +537,11 @@ struct dns_resolve_context {
 
 		/** Flag to indicate that the callback has been called at least once. */
 		bool cb_called;
+
+#if defined(CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS) || defined(__DOXYGEN__)
+		/** Number of servers the query was sent to and which did not answer yet */
+		uint8_t servers_pending;
+#endif
 	} queries[DNS_NUM_CONCUR_QUERIES];
 
 	/** Is this context in use */
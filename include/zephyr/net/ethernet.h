@@ -207,6 +207,16 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload supported, the driver splits packets
+	 * with a GSO size set into segments of that size.
+	 */
+	ETHERNET_HW_TSO			= BIT(21),
+
+	/** Large receive offload supported, the driver may pass up
+	 * coalesced in-order TCP segments as one packet.
+	 */
+	ETHERNET_HW_LRO			= BIT(22),
 };
 
 /** @cond INTERNAL_HIDDEN */
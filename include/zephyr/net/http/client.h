@@ -210,6 +210,11 @@ struct http_response {
 	uint8_t body_found : 1;       /**< Is message body found */
 	uint8_t message_complete : 1; /**< Is HTTP message parsing complete */
 	uint8_t cr_present : 1;       /**< Is Content-Range field present */
+	/** Can the connection be kept open and used for another request. Set
+	 * once the message is complete, according to the HTTP version and the
+	 * Connection header of the response.
+	 */
+	uint8_t keep_alive : 1;
 };
 
 /** HTTP client internal data that the application should not touch
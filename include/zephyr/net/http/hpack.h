@@ -12,6 +12,7 @@
 #ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 #define ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -127,6 +128,29 @@ struct http_hpack_header_buf {
 	size_t datalen;
 };
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+/** HPACK encoder dynamic table. */
+struct http_hpack_table {
+	/** Entries, stored from the oldest to the newest. */
+	uint8_t buf[CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE];
+
+	/** Number of bytes used in the entry buffer. */
+	uint16_t used;
+
+	/** Number of entries in the table. */
+	uint16_t count;
+
+	/** Size of the table, as defined by RFC7541. */
+	uint16_t size;
+
+	/** Maximum size of the table. */
+	uint16_t max_size;
+
+	/** The maximum size has to be signaled in the next header block. */
+	bool size_update;
+};
+#endif
+
 /** @cond INTERNAL_HIDDEN */
 
 int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
@@ -138,6 +162,13 @@ int http_hpack_decode_header(const uint8_t *buf, size_t datalen,
 int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 			     struct http_hpack_header_buf *header);
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+void http_hpack_table_init(struct http_hpack_table *table, size_t max_size);
+void http_hpack_table_set_max_size(struct http_hpack_table *table, size_t max_size);
+int http_hpack_encode_header_table(struct http_hpack_table *table, uint8_t *buf,
+				   size_t buflen, struct http_hpack_header_buf *header);
+#endif
+
 /** @endcond */
 
 #ifdef __cplusplus
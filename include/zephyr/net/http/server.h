@@ -120,6 +120,15 @@ struct http_resource_detail_static {
 
 	/** Size of the static resource. */
 	size_t static_data_len;
+
+	/** Precompressed variants of the resource. The first variant in the
+	 *  order of preference of @kconfig{CONFIG_HTTP_SERVER_COMPRESSION}
+	 *  accepted by the client is served instead of @ref static_data.
+	 */
+	const struct http_resource_static_variant *variants;
+
+	/** Number of precompressed variants. */
+	size_t num_variants;
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -148,6 +157,20 @@ enum http_compression {
 	HTTP_ZSTD = 5      /**< ZSTD */
 };
 
+/**
+ * @brief Precompressed variant of a static server resource.
+ */
+struct http_resource_static_variant {
+	/** Compression of the variant. */
+	enum http_compression compression;
+
+	/** Compressed content. */
+	const void *data;
+
+	/** Size of the compressed content. */
+	size_t data_len;
+};
+
 /** @cond INTERNAL_HIDDEN */
 /* Make sure that the common is the first in the struct. */
 BUILD_ASSERT(offsetof(struct http_resource_detail_static_fs, common) == 0);
@@ -366,6 +389,19 @@ struct http2_stream_ctx {
 
 	/** Flag indicating that END_STREAM flag was sent. */
 	bool end_stream_sent : 1;
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+/** @cond INTERNAL_HIDDEN */
+	/** Peer stream-level window size, available for sending. */
+	int32_t send_window;
+
+	/** Static content not sent yet, waiting for the peer window. */
+	const char *pending_data;
+
+	/** Length of the static content not sent yet. */
+	size_t pending_len;
+/** @endcond */
+#endif
 };
 
 /** @brief HTTP/2 frame representation. */
@@ -430,6 +466,44 @@ struct http_client_ctx {
 	/** Connection-level window size. */
 	int window_size;
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+/** @cond INTERNAL_HIDDEN */
+	/** Peer connection-level window size, available for sending. */
+	int32_t send_window;
+
+	/** Initial stream window size announced by the peer. */
+	uint32_t peer_initial_window_size;
+
+	/** Maximum frame payload size accepted by the peer. */
+	uint32_t peer_max_frame_size;
+
+	/** Stream from which the next round of DATA frames starts. */
+	uint8_t next_stream;
+/** @endcond */
+#endif
+
+#if defined(CONFIG_HTTP_SERVER_NONBLOCKING)
+/** @cond INTERNAL_HIDDEN */
+	/** Output queue, data not accepted by the socket yet. */
+	uint8_t tx_queue[CONFIG_HTTP_SERVER_TX_QUEUE_SIZE];
+
+	/** Offset of the first queued byte in the output queue. */
+	size_t tx_head;
+
+	/** Number of bytes in the output queue. */
+	size_t tx_len;
+
+	/** Static content to send after the output queue, by reference. */
+	const uint8_t *tx_ref_data;
+
+	/** Length of the static content to send after the output queue. */
+	size_t tx_ref_len;
+
+	/** Uptime after which a client not reading its output is dropped. */
+	int64_t tx_deadline;
+/** @endcond */
+#endif
+
 	/** Server state for the associated client. */
 	enum http_server_state server_state;
 
@@ -493,6 +567,12 @@ struct http_client_ctx {
 /** @cond INTERNAL_HIDDEN */
 	/** Client supported compression. */
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (uint8_t supported_compression));
+
+	/** Entity tag of the if-none-match request header. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG, (uint32_t if_none_match));
+
+	/** HPACK dynamic table used to encode the response headers. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE, (struct http_hpack_table hpack_table));
 /** @endcond */
 
 	/** Flag indicating that HTTP2 preface was sent. */
@@ -516,6 +596,15 @@ struct http_client_ctx {
 	/** Flag indicating accept encoding is being processed. */
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (bool accept_encoding_next: 1));
 
+	/** Flag indicating if-none-match is being processed. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG, (bool if_none_match_next: 1));
+
+	/** Flag indicating that the request has a valid if-none-match header. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG, (bool if_none_match_valid: 1));
+
+	/** Flag indicating that the if-none-match header matches any entity tag. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG, (bool if_none_match_any: 1));
+
 	/** The next frame on the stream is expectd to be a continuation frame. */
 	bool expect_continuation : 1;
 };
@@ -864,6 +864,23 @@ struct mqtt_transport {
 #endif
 };
 
+/** @brief QoS 1 or QoS 2 publication awaiting acknowledgment. */
+struct mqtt_inflight_msg {
+	/** Publication, as sent. Topic and payload are not copied. */
+	struct mqtt_publish_param param;
+
+	/** Wall clock value (in milliseconds) of the last transmission. */
+	uint32_t last_sent;
+
+	/** Stage of the acknowledgment flow, 0 if the entry is free. */
+	uint8_t state;
+
+	/** Resend the publication, or its release, on the next call to
+	 *  @ref mqtt_live.
+	 */
+	bool resend;
+};
+
 /** @brief MQTT internal state. */
 struct mqtt_internal {
 	/** Internal. Mutex to protect access to the client instance. */
@@ -890,6 +907,22 @@ struct mqtt_internal {
 	/** Internal. MQTT 5.0 disconnect reason set in case of processing errors. */
 	enum mqtt_disconnect_reason_code disconnect_reason;
 #endif /* CONFIG_MQTT_VERSION_5_0 */
+
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING) || defined(__DOXYGEN__)
+	/** Internal. Publications awaiting acknowledgment. */
+	struct mqtt_inflight_msg inflight[CONFIG_MQTT_INFLIGHT_MAX];
+
+	/** Internal. Number of publications awaiting acknowledgment. */
+	uint16_t inflight_count;
+
+	/** Internal. Maximum number of publications awaiting acknowledgment,
+	 *  further limited by the Receive Maximum of the server.
+	 */
+	uint16_t inflight_max;
+
+	/** Internal. Last message id assigned by the client. */
+	uint16_t last_message_id;
+#endif /* CONFIG_MQTT_INFLIGHT_TRACKING */
 };
 
 /**
@@ -1082,11 +1115,44 @@ int mqtt_connect(struct mqtt_client *client);
  * @param[in] param Parameters to be used for the publish message.
  *                  Shall not be NULL.
  *
+ * @note With @kconfig{CONFIG_MQTT_INFLIGHT_TRACKING}, QoS 1 and QoS 2
+ *       publications are tracked until acknowledged, and retransmitted as
+ *       needed. A message id of 0 is then replaced by one assigned by the
+ *       client. The topic and the payload shall remain valid until the
+ *       publication is acknowledged with @ref MQTT_EVT_PUBACK or
+ *       @ref MQTT_EVT_PUBCOMP.
+ *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ * @retval -EAGAIN if the maximum number of publications awaiting
+ *                 acknowledgment has been reached.
  */
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to publish several messages at once. The messages are encoded
+ *        one after another in the transmit buffer and sent with a single
+ *        transport write, which lets small messages share network packets.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] params Parameters to be used for the publish messages.
+ *                   Shall not be NULL.
+ * @param[in] count Number of messages to publish.
+ *
+ * @note At most @kconfig{CONFIG_MQTT_PUBLISH_BATCH_MAX} messages are
+ *       published in one call. Fewer messages are published if the fixed
+ *       and variable headers of the messages do not fit in the transmit
+ *       buffer, or if the maximum number of publications awaiting
+ *       acknowledgment is reached. The same notes as for @ref mqtt_publish
+ *       apply to each message.
+ *
+ * @return Number of messages published, starting with the first one, or a
+ *         negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_batch(struct mqtt_client *client,
+		       const struct mqtt_publish_param *params, size_t count);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
@@ -1230,6 +1296,8 @@ int mqtt_abort(struct mqtt_client *client);
  *        makes it possible to respect the Keep Alive time agreed with the
  *        broker on connection. @ref mqtt_connect for details on Keep Alive
  *        time.
+ * @note  With @kconfig{CONFIG_MQTT_INFLIGHT_TRACKING}, unacknowledged
+ *        publications are also retransmitted from this function.
  *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
  */
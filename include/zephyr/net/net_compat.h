@@ -111,6 +111,7 @@ extern "C" {
 
 #define iovec                     net_iovec
 #define msghdr                    net_msghdr
+#define mmsghdr                   net_mmsghdr
 #define cmsghdr                   net_cmsghdr
 #define ALIGN_H(x)                NET_ALIGN_H(x)
 #define ALIGN_D(x)                NET_ALIGN_D(x)
@@ -172,6 +173,7 @@ extern "C" {
 #define TLS_DTLS_HANDSHAKE_ON_CONNECT     ZSOCK_TLS_DTLS_HANDSHAKE_ON_CONNECT
 #define TLS_CERT_VERIFY_RESULT            ZSOCK_TLS_CERT_VERIFY_RESULT
 #define TLS_CERT_VERIFY_CALLBACK          ZSOCK_TLS_CERT_VERIFY_CALLBACK
+#define TLS_RECORD_CORK                   ZSOCK_TLS_RECORD_CORK
 #define TLS_PEER_VERIFY_NONE              ZSOCK_TLS_PEER_VERIFY_NONE
 #define TLS_PEER_VERIFY_OPTIONAL          ZSOCK_TLS_PEER_VERIFY_OPTIONAL
 #define TLS_PEER_VERIFY_REQUIRED          ZSOCK_TLS_PEER_VERIFY_REQUIRED
@@ -244,11 +246,13 @@ extern "C" {
 #define MSG_TRUNC    ZSOCK_MSG_TRUNC
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
 #define MSG_WAITALL  ZSOCK_MSG_WAITALL
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
 
 #define TCP_NODELAY    ZSOCK_TCP_NODELAY
 #define TCP_KEEPIDLE   ZSOCK_TCP_KEEPIDLE
 #define TCP_KEEPINTVL  ZSOCK_TCP_KEEPINTVL
 #define TCP_KEEPCNT    ZSOCK_TCP_KEEPCNT
+#define TCP_CONGESTION ZSOCK_TCP_CONGESTION
 
 #define IP_TOS               ZSOCK_IP_TOS
 #define IP_TTL               ZSOCK_IP_TTL
@@ -1290,6 +1290,35 @@ int net_context_sendto(struct net_context *context,
 		       k_timeout_t timeout,
 		       void *user_data);
 
+/**
+ * @brief Send a caller filled buffer chain to a peer without copying it.
+ *
+ * @details This works like net_context_sendto() for UDP contexts, but the
+ * payload is given as a chain of network buffers, typically allocated with
+ * net_pkt_get_reserve_tx_data(), that is linked after the protocol headers
+ * instead of being copied. On success the context takes over the caller
+ * reference to @p frags, on failure the caller still owns it and may retry.
+ * If @p dst_addr is NULL, the address given to net_context_connect() is used.
+ *
+ * @param context The network context to use.
+ * @param frags Buffer chain holding the payload.
+ * @param dst_addr Destination address, or NULL for a connected context.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Timeout for the send attempt.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise,
+ *         -EOPNOTSUPP if the context is not a UDP one.
+ */
+int net_context_sendto_buf(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct net_sockaddr *dst_addr,
+			   net_socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data);
+
 /**
  * @brief Send data in iovec to a peer specified in net_msghdr struct.
  *
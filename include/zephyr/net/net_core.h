@@ -129,6 +129,79 @@ enum net_verdict {
  */
 int net_recv_data(struct net_if *iface, struct net_pkt *pkt);
 
+/**
+ * @brief Called by a network device driver to pass a batch of received
+ * network packets to the network stack.
+ *
+ * @details Works like calling net_recv_data() for each packet, but the
+ * packets are queued to the RX threads with one queue operation per traffic
+ * class, and the RX threads are woken up once for the whole batch.
+ *
+ * @param iface Network interface where the packets were received.
+ * @param pkts Array of network packets.
+ * @param count Number of packets in the array.
+ *
+ * @return 0 if ok, then the network stack owns all the packets, <0 if error,
+ * then none of the packets were taken.
+ */
+int net_recv_data_batch(struct net_if *iface, struct net_pkt **pkts, size_t count);
+
+struct net_rx_poll;
+
+/**
+ * @typedef net_rx_poll_cb_t
+ * @brief Network device RX poll function.
+ *
+ * @details Receives at most @p budget packets from the device and passes
+ * them to the stack, usually with net_recv_data_batch(). If fewer packets
+ * than the budget were pending, the driver re-enables its RX interrupt
+ * before returning. Otherwise the function is called again.
+ *
+ * @param poll RX poll context of the device.
+ * @param budget Maximum number of packets to receive.
+ *
+ * @return Number of packets received.
+ */
+typedef int (*net_rx_poll_cb_t)(struct net_rx_poll *poll, int budget);
+
+/**
+ * @brief RX poll context of a network device.
+ *
+ * A driver using it disables its RX interrupt in the interrupt handler and
+ * calls net_rx_poll_schedule(). Packets are then received from the RX poll
+ * thread, up to the budget at a time, for as long as more packets arrive.
+ * Under load this replaces one interrupt per packet by one poll per batch.
+ */
+struct net_rx_poll {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	net_rx_poll_cb_t cb;
+	int budget;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize the RX poll context of a network device.
+ *
+ * @param poll RX poll context.
+ * @param cb Poll function of the driver.
+ * @param budget Maximum number of packets received in one call of @p cb.
+ */
+void net_rx_poll_init(struct net_rx_poll *poll, net_rx_poll_cb_t cb, int budget);
+
+/**
+ * @brief Schedule the poll function of a network device.
+ *
+ * @details Can be called from an interrupt handler. Scheduling a poll that
+ * is already pending has no effect.
+ *
+ * @param poll RX poll context.
+ *
+ * @return 0 if the poll was already pending, 1 or 2 if it was scheduled,
+ * <0 if error.
+ */
+int net_rx_poll_schedule(struct net_rx_poll *poll);
+
 /**
  * @brief Try sending data to network.
  *
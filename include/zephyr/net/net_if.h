@@ -297,6 +297,11 @@ enum net_if_flag {
 	/** Mutex locking on TX data path disabled on the interface. */
 	NET_IF_NO_TX_LOCK,
 
+	/** Received flows are spread over the per-CPU receive packet
+	 * steering queues, see CONFIG_NET_RPS.
+	 */
+	NET_IF_RPS,
+
 /** @cond INTERNAL_HIDDEN */
 	/* Total number of flags - must be at the end of the enum */
 	NET_IF_NUM_FLAGS
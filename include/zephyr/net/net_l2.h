@@ -48,6 +48,12 @@ enum net_l2_flags {
 	 * IP address etc to network interface.
 	 */
 	NET_L2_POINT_TO_POINT			= BIT(3),
+
+	/** L2 splits TCP packets larger than the MTU into segments before
+	 * sending them, so the TCP stack can hand down several segments
+	 * worth of data at once.
+	 */
+	NET_L2_GSO				= BIT(4),
 } __packed;
 
 /**
@@ -361,6 +361,18 @@ struct net_pkt {
 	uint8_t ipv4_pmtu : 1;
 #endif /* CONFIG_NET_IPV4_PMTU */
 
+#if defined(CONFIG_NET_ETHERNET_GSO)
+	/* Segment size if the L2 needs to split the packet before sending */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_ETHERNET_GSO */
+
+#if defined(CONFIG_NET_UDP_TX_CHECKSUM_COPY)
+	/* Checksum of the data written with net_pkt_write_chksum() */
+	uint16_t chksum_payload;
+	uint8_t chksum_payload_odd : 1;	  /* Odd number of bytes summed */
+	uint8_t chksum_payload_valid : 1; /* chksum_payload is in use */
+#endif /* CONFIG_NET_UDP_TX_CHECKSUM_COPY */
+
 	/* @endcond */
 };
 
@@ -873,6 +885,48 @@ static inline void net_pkt_set_ipv4_pmtu(struct net_pkt *pkt, bool value)
 }
 #endif /* CONFIG_NET_IPV4_PMTU */
 
+#if defined(CONFIG_NET_ETHERNET_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	pkt->gso_size = size;
+}
+#else
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0U;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+}
+#endif /* CONFIG_NET_ETHERNET_GSO */
+
+#if defined(CONFIG_NET_UDP_TX_CHECKSUM_COPY)
+static inline bool net_pkt_chksum_payload(struct net_pkt *pkt, uint16_t *sum)
+{
+	*sum = pkt->chksum_payload;
+
+	return pkt->chksum_payload_valid;
+}
+#else
+static inline bool net_pkt_chksum_payload(struct net_pkt *pkt, uint16_t *sum)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(sum);
+
+	return false;
+}
+#endif /* CONFIG_NET_UDP_TX_CHECKSUM_COPY */
+
 #if defined(CONFIG_NET_IPV4_FRAGMENT)
 static inline uint16_t net_pkt_ipv4_fragment_offset(struct net_pkt *pkt)
 {
@@ -2489,6 +2543,29 @@ int net_pkt_read_le64(struct net_pkt *pkt, uint64_t *data);
  */
 int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length);
 
+/**
+ * @brief Write data into a net_pkt and compute its checksum
+ *
+ * @details Same as net_pkt_write(), but the Internet checksum of the
+ *          data is computed while it is copied. The checksum of all the
+ *          data written by successive calls is kept in the packet, so the
+ *          transport layer does not need to read the payload again.
+ *
+ * @param pkt    The network packet where to write
+ * @param data   Data to be written
+ * @param length Length of the data to be written
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+#if defined(CONFIG_NET_UDP_TX_CHECKSUM_COPY)
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length);
+#else
+static inline int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length)
+{
+	return net_pkt_write(pkt, data, length);
+}
+#endif
+
 /**
  * @brief Write a byte (uint8_t) data to a net_pkt
  *
@@ -116,6 +116,27 @@ int prometheus_collector_register_metric(struct prometheus_collector *collector,
 const void *prometheus_collector_get_metric(struct prometheus_collector *collector,
 					    const char *name);
 
+#if defined(CONFIG_PROMETHEUS_SCHED_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Collector exporting the kernel scheduling latency statistics
+ *
+ * Available when CONFIG_PROMETHEUS_SCHED_STATS is enabled. The metrics are
+ * refreshed from k_thread_runtime_stats_all_get() every time the collector
+ * is scraped.
+ */
+extern struct prometheus_collector prometheus_sched_stats_collector;
+#endif /* CONFIG_PROMETHEUS_SCHED_STATS */
+
+#if defined(CONFIG_PROMETHEUS_SYS_HIST) || defined(__DOXYGEN__)
+/**
+ * @brief Collector exporting sys_hist histograms
+ *
+ * Available when CONFIG_PROMETHEUS_SYS_HIST is enabled. Holds the metrics
+ * defined with PROMETHEUS_SYS_HIST_DEFINE().
+ */
+extern struct prometheus_collector prometheus_sys_hist_collector;
+#endif /* CONFIG_PROMETHEUS_SYS_HIST */
+
 /** @cond INTERNAL_HIDDEN */
 
 enum prometheus_walk_state {
@@ -137,6 +158,10 @@ struct prometheus_collector_walk_context {
  * @brief Walk through all metrics in a Prometheus collector and format them
  *        into a buffer.
  *
+ * Each call appends as many metrics as fit to the string in @p buffer, which
+ * must be empty or NUL terminated. The collector stays locked until the walk
+ * completes.
+ *
  * @param ctx Pointer to the walker context.
  * @param buffer Pointer to the buffer to store the formatted metrics.
  * @param buffer_size Size of the buffer.
@@ -19,6 +19,10 @@
 
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/net/prometheus/metric.h>
+#ifdef CONFIG_PROMETHEUS_SYS_HIST
+#include <zephyr/net/prometheus/collector.h>
+#include <zephyr/sys/hist.h>
+#endif
 
 #include <stddef.h>
 
@@ -105,6 +109,40 @@ struct prometheus_histogram {
  */
 int prometheus_histogram_observe(struct prometheus_histogram *histogram, double value);
 
+#if defined(CONFIG_PROMETHEUS_SYS_HIST) || defined(__DOXYGEN__)
+/** @cond INTERNAL_HIDDEN */
+struct prometheus_sys_hist_binding {
+	struct sys_hist *hist;
+	struct prometheus_histogram_bucket *buckets;
+};
+/** @endcond */
+
+/**
+ * @brief Export a sys_hist histogram as a Prometheus histogram metric
+ *
+ * The metric is bound to the prometheus_sys_hist_collector collector and
+ * refreshed from the histogram every time it is scraped. Prometheus buckets
+ * are powers of two, the sum is estimated from the histogram buckets.
+ *
+ * Available when CONFIG_PROMETHEUS_SYS_HIST is enabled.
+ *
+ * @param _name The histogram metric name.
+ * @param _desc Histogram description.
+ * @param _label Label for the metric. Additional labels can be added at runtime.
+ * @param _hist sys_hist histogram to export, see SYS_HIST_DEFINE().
+ */
+#define PROMETHEUS_SYS_HIST_DEFINE(_name, _desc, _label, _hist)			\
+	static struct prometheus_histogram_bucket				\
+		_name##_sys_hist_buckets[SYS_HIST_MAX_BITS + 1];		\
+	static struct prometheus_sys_hist_binding _name##_sys_hist = {		\
+		.hist = &(_hist),						\
+		.buckets = _name##_sys_hist_buckets,				\
+	};									\
+	PROMETHEUS_HISTOGRAM_DEFINE(_name, _desc, _label,			\
+				    &prometheus_sys_hist_collector,		\
+				    &_name##_sys_hist)
+#endif /* CONFIG_PROMETHEUS_SYS_HIST */
+
 /**
  * @}
  */
@@ -42,6 +42,8 @@
 extern "C" {
 #endif
 
+struct net_buf;
+
 /**
  * @name Options for poll()
  * @{
@@ -78,6 +80,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: Override operation to non-blocking after the first message */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -261,6 +265,17 @@ extern "C" {
  *  Kconfig option is enabled.
  */
 #define ZSOCK_TLS_CERT_VERIFY_CALLBACK 20
+/** Socket option to coalesce small writes into TLS records, similar to
+ *  TCP_CORK. While enabled, data sent on a TLS socket is buffered and sent
+ *  as a single TLS record once the buffer is full or the option is disabled
+ *  again. Accepted values:
+ *  - 0 - Disabled (default), each send call produces its own records.
+ *  - 1 - Enabled.
+ *
+ *  The option is only available if CONFIG_NET_SOCKETS_TLS_RECORD_CORK
+ *  Kconfig option is enabled.
+ */
+#define ZSOCK_TLS_RECORD_CORK 21
 
 /* Valid values for @ref TLS_PEER_VERIFY option */
 #define ZSOCK_TLS_PEER_VERIFY_NONE 0     /**< Peer verification disabled. */
@@ -512,6 +527,27 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct net_msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send several messages with a single call
+ *
+ * @details
+ * Works like calling zsock_sendmsg() for each element of @p msgvec, the
+ * number of bytes sent for each message is stored in its @c msg_len field.
+ * Sending stops at the first message that fails.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to send
+ * @param vlen Number of elements in @p msgvec
+ * @param flags Flags passed to every zsock_sendmsg() call
+ *
+ * @return Number of messages sent, or -1 with errno set if the first
+ *         message could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct net_mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -538,6 +574,29 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct net_msghdr *msg, int flags);
 
+/**
+ * @brief Receive several messages with a single call
+ *
+ * @details
+ * Works like calling zsock_recvmsg() for each element of @p msgvec, the
+ * number of bytes received for each message is stored in its @c msg_len
+ * field. With @ref ZSOCK_MSG_WAITFORONE, only the first message may
+ * block and the call returns as soon as the receive queue is empty, so
+ * that one wakeup drains all datagrams queued on the socket.
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to fill
+ * @param vlen Number of elements in @p msgvec
+ * @param flags Flags passed to the zsock_recvmsg() calls
+ *
+ * @return Number of messages received, or -1 with errno set if the first
+ *         message could not be received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct net_mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -895,6 +954,54 @@ int zsock_send_all(int sock, const void *buf, size_t len, int flags,
 int zsock_sendmsg_all(int sock, const struct net_msghdr *msg, int flags,
 		      k_timeout_t timeout, size_t *sent_len);
 
+/**
+ * @brief Receive a datagram without copying its payload
+ *
+ * @details
+ * Zephyr specific variant of zsock_recvfrom() for UDP sockets. Instead
+ * of copying the payload into a user buffer, the network buffers holding
+ * it are loaned to the caller, which must release them with
+ * net_buf_unref() once done. Loaned buffers are not available to the
+ * network stack, so they should be returned quickly to avoid stalling
+ * the reception of further packets.
+ * The function is only available to supervisor threads and requires
+ * @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY}.
+ *
+ * @param sock Socket descriptor
+ * @param frags Set to the buffer chain holding the payload, or NULL
+ *        for an empty datagram.
+ * @param flags Receive flags, ZSOCK_MSG_PEEK is not supported.
+ * @param src_addr Optional source address of the datagram
+ * @param addrlen Length of @p src_addr, updated on return
+ *
+ * @return Length of the payload on success, -1 with errno set otherwise.
+ */
+ssize_t zsock_recvfrom_buf(int sock, struct net_buf **frags, int flags,
+			   struct net_sockaddr *src_addr, net_socklen_t *addrlen);
+
+/**
+ * @brief Send a datagram without copying its payload
+ *
+ * @details
+ * Zephyr specific variant of zsock_sendto() for UDP sockets. The payload
+ * is given as a chain of network buffers, typically allocated with
+ * net_pkt_get_reserve_tx_data() and filled by the caller, which is sent
+ * as is after the protocol headers. On success the socket takes over the
+ * caller reference to @p frags, on failure it stays with the caller.
+ * The function is only available to supervisor threads and requires
+ * @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY}.
+ *
+ * @param sock Socket descriptor
+ * @param frags Buffer chain holding the payload
+ * @param flags Send flags
+ * @param dest_addr Destination address, or NULL for a connected socket
+ * @param addrlen Length of @p dest_addr
+ *
+ * @return Number of bytes sent on success, -1 with errno set otherwise.
+ */
+ssize_t zsock_sendto_buf(int sock, struct net_buf *frags, int flags,
+			 const struct net_sockaddr *dest_addr, net_socklen_t addrlen);
+
 /**
  * @name Socket level options (ZSOCK_SOL_SOCKET)
  * @{
@@ -996,6 +1103,8 @@ int zsock_sendmsg_all(int sock, const struct net_msghdr *msg, int flags,
 #define ZSOCK_TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define ZSOCK_TCP_KEEPCNT 4
+/** Congestion control algorithm, by name ("reno", "cubic" or "bbr") */
+#define ZSOCK_TCP_CONGESTION 13
 
 /** @} */
 
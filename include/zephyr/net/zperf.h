@@ -65,6 +65,7 @@ struct zperf_upload_params {
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		int thread_priority;
 		bool wait_for_start;
+		uint32_t cpu_mask; /* CPUs the session may run on, 0 for all */
 #endif
 		uint32_t report_interval_ms;
 	} options;
@@ -1092,6 +1092,14 @@ struct net_buf_pool {
 	/** Size of user data allocated to this pool */
 	uint8_t user_data_size;
 
+#if defined(CONFIG_NET_BUF_POOL_LOCKFREE)
+	/** Lock-free free list head: generation tag and buffer index + 1 */
+	atomic_t lf_head;
+
+	/** Number of threads about to block on the free LIFO */
+	atomic_t lf_waiters;
+#endif /* CONFIG_NET_BUF_POOL_LOCKFREE */
+
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 	/** Amount of available buffers in the pool. */
 	atomic_t avail_count;
@@ -1129,6 +1137,9 @@ struct net_buf_pool {
 		.buf_count = _count,                                               \
 		.uninit_count = _count,                                            \
 		.user_data_size = _ud_size,                                        \
+		IF_ENABLED(CONFIG_NET_BUF_POOL_LOCKFREE,                           \
+			   (.lf_head = ATOMIC_INIT(0),                             \
+			    .lf_waiters = ATOMIC_INIT(0),))                        \
 		NET_BUF_POOL_USAGE_INIT(_pool, _count)                             \
 		.destroy = _destroy,                                               \
 		.alloc = _alloc,                                                   \
@@ -1241,8 +1252,41 @@ extern const struct net_buf_data_cb net_buf_fixed_cb;
 
 /** @cond INTERNAL_HIDDEN */
 extern const struct net_buf_data_cb net_buf_var_cb;
+
+extern const struct net_buf_data_alloc net_buf_view_alloc;
+
+void net_buf_view_destroy(struct net_buf *buf);
+
+/* View buffers keep a pointer to the buffer they reference after the
+ * user data.
+ */
+#define _NET_BUF_VIEW_UD_SIZE(_ud_size) \
+	(ROUND_UP(_ud_size, sizeof(void *)) + sizeof(struct net_buf *))
 /** @endcond */
 
+/**
+ *
+ * @brief Define a new pool for zero-copy view buffers
+ *
+ * Defines a pool of buffers without data storage of their own, to be
+ * used with net_buf_slice(). Each view references a range of another
+ * buffer's data and holds a reference to that buffer until the view
+ * is freed. View buffers must not be written to through the net_buf
+ * API other than to pull or trim data: they have neither headroom nor
+ * tailroom.
+ *
+ * @param _name      Name of the pool variable.
+ * @param _count     Number of view buffers in the pool.
+ * @param _ud_size   User data space to reserve per buffer.
+ */
+#define NET_BUF_POOL_VIEW_DEFINE(_name, _count, _ud_size)                       \
+	_NET_BUF_ARRAY_DEFINE(_name, _count, _NET_BUF_VIEW_UD_SIZE(_ud_size));  \
+	static STRUCT_SECTION_ITERABLE(net_buf_pool, _name) =                   \
+		NET_BUF_POOL_INITIALIZER(_name, &net_buf_view_alloc,            \
+					 _net_buf_##_name, _count,              \
+					 _NET_BUF_VIEW_UD_SIZE(_ud_size),       \
+					 net_buf_view_destroy)
+
 /**
  *
  * @brief Define a new pool for buffers with variable size payloads
@@ -1503,6 +1547,12 @@ struct net_buf * __must_check net_buf_alloc_with_data(struct net_buf_pool *pool,
 						      k_timeout_t timeout);
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_NET_BUF_POOL_LOCKFREE)
+void net_buf_pool_lf_put(struct net_buf_pool *pool, struct net_buf *buf);
+#endif /* CONFIG_NET_BUF_POOL_LOCKFREE */
+/** @endcond */
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1523,7 +1573,11 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_LOCKFREE)
+	net_buf_pool_lf_put(pool, buf);
+#else
 	k_lifo_put(&pool->free, buf);
+#endif /* CONFIG_NET_BUF_POOL_LOCKFREE */
 }
 
 /**
@@ -1602,6 +1656,35 @@ struct net_buf * __must_check net_buf_ref(struct net_buf *buf);
 struct net_buf * __must_check net_buf_clone(struct net_buf *buf,
 					    k_timeout_t timeout);
 
+/**
+ * @brief Create a zero-copy view of a range of a buffer chain
+ *
+ * Builds a fragment chain of view buffers, allocated from @p view_pool,
+ * that reference @p len bytes of the data of @p buf and its fragments,
+ * starting @p offset bytes into the chain. No data is copied: every
+ * view holds a reference to the fragment it points into, which keeps
+ * the payload alive until the view is freed. The referenced fragments
+ * must not be modified while views of them exist.
+ *
+ * Cloning a view with net_buf_clone() creates another view of the same
+ * range.
+ *
+ * @param view_pool Pool defined with NET_BUF_POOL_VIEW_DEFINE().
+ * @param buf A valid pointer on a buffer chain.
+ * @param offset Offset of the range from the start of the chain data.
+ * @param len Length of the range.
+ * @param timeout Affects the action taken should the view pool be empty.
+ *        If K_NO_WAIT, then return immediately. If K_FOREVER, then
+ *        wait as long as necessary. Otherwise, wait until the specified
+ *        timeout.
+ *
+ * @return Head of the view chain, or NULL if out of view buffers, if
+ *         @p len is zero or if the range extends past the chain data.
+ */
+struct net_buf * __must_check net_buf_slice(struct net_buf_pool *view_pool,
+					    struct net_buf *buf, size_t offset,
+					    size_t len, k_timeout_t timeout);
+
 /**
  * @brief Get a pointer to the user data of a buffer.
  *
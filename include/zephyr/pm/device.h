@@ -227,6 +227,14 @@ struct pm_device {
 	struct k_event event;
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
+#if defined(CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY) || defined(__DOXYGEN__)
+	/** Uptime, in milliseconds, of the last asynchronous put */
+	uint32_t put_time;
+	/** Average time, in milliseconds, between an asynchronous put and the next get */
+	uint32_t idle_time;
+	/** An asynchronous put was done and no get since */
+	bool put_pending;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY */
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 };
@@ -88,6 +88,20 @@ struct pm_policy_event {
  */
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks);
 
+/**
+ * @brief Function to report the time spent idle
+ *
+ * This function is called by the power subsystem when waking up from the
+ * state returned by pm_policy_next_state(), for policies learning from the
+ * past idle periods. It is only called with CONFIG_PM_POLICY_PREDICTIVE.
+ *
+ * @param cpu CPU index.
+ * @param ticks The number of ticks to the next scheduled event, as given to
+ *              pm_policy_next_state().
+ * @param idle_us The time spent idle, in microseconds.
+ */
+void pm_policy_idle_report(uint8_t cpu, int32_t ticks, uint32_t idle_us);
+
 /** @endcond */
 
 /** Special value for 'all substates'. */
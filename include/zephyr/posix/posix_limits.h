@@ -78,7 +78,8 @@
 
 /* Runtime invariant values */
 #define AIO_LISTIO_MAX                _POSIX_AIO_LISTIO_MAX
-#define AIO_MAX                       _POSIX_AIO_MAX
+#define AIO_MAX \
+	COND_CODE_1(CONFIG_POSIX_ASYNCHRONOUS_IO, (CONFIG_POSIX_AIO_MAX), (0))
 #define AIO_PRIO_DELTA_MAX            (0)
 #define ARG_MAX                       _POSIX_ARG_MAX
 #define ATEXIT_MAX                    (32)
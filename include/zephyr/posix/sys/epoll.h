@@ -0,0 +1,77 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_POSIX_SYS_EPOLL_H_
+#define ZEPHYR_INCLUDE_POSIX_SYS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/zvfs/epoll.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EPOLLIN      ZVFS_EPOLLIN
+#define EPOLLPRI     ZVFS_EPOLLPRI
+#define EPOLLOUT     ZVFS_EPOLLOUT
+#define EPOLLERR     ZVFS_EPOLLERR
+#define EPOLLHUP     ZVFS_EPOLLHUP
+#define EPOLLONESHOT ZVFS_EPOLLONESHOT
+
+#define EPOLL_CTL_ADD ZVFS_EPOLL_CTL_ADD
+#define EPOLL_CTL_DEL ZVFS_EPOLL_CTL_DEL
+#define EPOLL_CTL_MOD ZVFS_EPOLL_CTL_MOD
+
+#define EPOLL_CLOEXEC ZVFS_EPOLL_CLOEXEC
+
+typedef union zvfs_epoll_data epoll_data_t;
+
+struct epoll_event {
+	uint32_t events;
+	epoll_data_t data;
+};
+
+/**
+ * @brief Create an epoll file descriptor
+ *
+ * @param size Ignored, but must be greater than zero
+ *
+ * @return New epoll file descriptor on success, -1 on error
+ */
+int epoll_create(int size);
+
+/**
+ * @brief Create an epoll file descriptor
+ *
+ * @param flags Zero or EPOLL_CLOEXEC
+ *
+ * @return New epoll file descriptor on success, -1 on error
+ */
+int epoll_create1(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of an epoll set
+ *
+ * Only level triggered events are supported. A file descriptor must be
+ * removed from the set before it is closed.
+ *
+ * @return 0 on success, -1 on error
+ */
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+
+/**
+ * @brief Wait for events on an epoll set
+ *
+ * @return Number of ready file descriptors, 0 on timeout, -1 on error
+ */
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_POSIX_SYS_EPOLL_H_ */
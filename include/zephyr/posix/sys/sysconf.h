@@ -277,7 +277,8 @@ enum {
 #define __z_posix_sysconf_SC_GETGR_R_SIZE_MAX             (0L)
 #define __z_posix_sysconf_SC_GETPW_R_SIZE_MAX             (0L)
 #define __z_posix_sysconf_SC_AIO_LISTIO_MAX               _POSIX_AIO_LISTIO_MAX
-#define __z_posix_sysconf_SC_AIO_MAX                      _POSIX_AIO_MAX
+#define __z_posix_sysconf_SC_AIO_MAX                                                               \
+	COND_CODE_1(CONFIG_POSIX_ASYNCHRONOUS_IO, (CONFIG_POSIX_AIO_MAX), (0))
 #define __z_posix_sysconf_SC_AIO_PRIO_DELTA_MAX           0
 #define __z_posix_sysconf_SC_ARG_MAX                      _POSIX_ARG_MAX
 #define __z_posix_sysconf_SC_ATEXIT_MAX                   32
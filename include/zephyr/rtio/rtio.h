@@ -421,6 +421,10 @@ struct rtio_sqe_pool {
 	const uint16_t pool_size;
 	uint16_t pool_free;
 	struct rtio_iodev_sqe *pool;
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	/* Producers all consume the free list */
+	struct k_spinlock lock;
+#endif
 };
 
 struct rtio_cqe_pool {
@@ -467,6 +471,13 @@ struct rtio {
 	 */
 	atomic_t xcqcnt;
 
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	/* Number of pending calls to the executor, the submission queue is
+	 * only consumed by the first one
+	 */
+	atomic_t submit_pending;
+#endif
+
 	/* Submission queue object pool with free list */
 	struct rtio_sqe_pool *sqe_pool;
 
@@ -848,24 +859,37 @@ static inline void rtio_sqe_prep_delay(struct rtio_sqe *sqe,
 
 static inline struct rtio_iodev_sqe *rtio_sqe_pool_alloc(struct rtio_sqe_pool *pool)
 {
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+#endif
 	struct mpsc_node *node = mpsc_pop(&pool->free_q);
+	struct rtio_iodev_sqe *iodev_sqe = NULL;
 
-	if (node == NULL) {
-		return NULL;
+	if (node != NULL) {
+		iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+		pool->pool_free--;
 	}
 
-	struct rtio_iodev_sqe *iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
-
-	pool->pool_free--;
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	k_spin_unlock(&pool->lock, key);
+#endif
 
 	return iodev_sqe;
 }
 
 static inline void rtio_sqe_pool_free(struct rtio_sqe_pool *pool, struct rtio_iodev_sqe *iodev_sqe)
 {
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+#endif
+
 	mpsc_push(&pool->free_q, &iodev_sqe->q);
 
 	pool->pool_free++;
+
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	k_spin_unlock(&pool->lock, key);
+#endif
 }
 
 static inline struct rtio_cqe *rtio_cqe_pool_alloc(struct rtio_cqe_pool *pool)
@@ -1187,9 +1211,16 @@ static inline int rtio_sqe_acquire_array(struct rtio *r, size_t n, struct rtio_s
 		return -ENOMEM;
 	}
 
-	for (i = 0; i < n; i++) {
-		iodev_sqe = CONTAINER_OF(sqes[i], struct rtio_iodev_sqe, sqe);
-		mpsc_push(&r->sq, &iodev_sqe->q);
+	/* Queued as a whole so chains are not interleaved with other producers */
+	for (i = 1; i < n; i++) {
+		iodev_sqe = CONTAINER_OF(sqes[i - 1], struct rtio_iodev_sqe, sqe);
+		mpsc_ptr_set(iodev_sqe->q.next,
+			     &CONTAINER_OF(sqes[i], struct rtio_iodev_sqe, sqe)->q);
+	}
+
+	if (n > 0) {
+		mpsc_push_list(&r->sq, &CONTAINER_OF(sqes[0], struct rtio_iodev_sqe, sqe)->q,
+			       &CONTAINER_OF(sqes[n - 1], struct rtio_iodev_sqe, sqe)->q);
 	}
 
 	return 0;
@@ -1274,6 +1305,45 @@ static inline struct rtio_cqe *rtio_cqe_consume(struct rtio *r)
 	return cqe;
 }
 
+/**
+ * @brief Consume the available completion queue events, up to a number
+ *
+ * Each returned completion queue event must be released with
+ * rtio_cqe_release() once handled.
+ *
+ * @param r RTIO context
+ * @param cqes Array receiving the completion queue events
+ * @param n Size of @p cqes
+ *
+ * @return Number of completion queue events consumed, 0 to @p n
+ */
+static inline size_t rtio_cqe_consume_batch(struct rtio *r, struct rtio_cqe **cqes, size_t n)
+{
+	struct mpsc_node *node;
+	size_t count = 0;
+
+	while (count < n) {
+#ifdef CONFIG_RTIO_CONSUME_SEM
+		if (k_sem_take(r->consume_sem, K_NO_WAIT) != 0) {
+			break;
+		}
+#endif
+
+		node = mpsc_pop(&r->cq);
+		if (node == NULL) {
+#ifdef CONFIG_RTIO_CONSUME_SEM
+			/* Being produced, left for the next call */
+			k_sem_give(r->consume_sem);
+#endif
+			break;
+		}
+
+		cqes[count++] = CONTAINER_OF(node, struct rtio_cqe, q);
+	}
+
+	return count;
+}
+
 /**
  * @brief Wait for and consume a single completion queue event
  *
@@ -1716,22 +1786,48 @@ static inline int z_impl_rtio_sqe_copy_in_get_handles(struct rtio *r, const stru
 						      struct rtio_sqe **handle,
 						      size_t sqe_count)
 {
-	struct rtio_sqe *sqe;
+	struct rtio_iodev_sqe *first = NULL;
+	struct rtio_iodev_sqe *last = NULL;
+	struct rtio_iodev_sqe *iodev_sqe;
 	uint32_t acquirable = rtio_sqe_acquirable(r);
 
-	if (acquirable < sqe_count) {
-		return -ENOMEM;
+	if ((acquirable < sqe_count) || (sqe_count == 0)) {
+		return (sqe_count == 0) ? 0 : -ENOMEM;
 	}
 
+	/* Filled in before being queued, and queued as a whole, so other
+	 * producers neither see partial submissions nor split chains.
+	 */
 	for (unsigned long i = 0; i < sqe_count; i++) {
-		sqe = rtio_sqe_acquire(r);
-		__ASSERT_NO_MSG(sqe != NULL);
-		if (handle != NULL && i == 0) {
-			*handle = sqe;
+		iodev_sqe = rtio_sqe_pool_alloc(r->sqe_pool);
+		if (iodev_sqe == NULL) {
+			/* Taken by another producer meanwhile */
+			while (first != NULL) {
+				iodev_sqe = first;
+				first = (first == last) ? NULL :
+					CONTAINER_OF(mpsc_ptr_get(first->q.next),
+						     struct rtio_iodev_sqe, q);
+				rtio_sqe_pool_free(r->sqe_pool, iodev_sqe);
+			}
+
+			return -ENOMEM;
 		}
-		*sqe = sqes[i];
+
+		iodev_sqe->sqe = sqes[i];
+		if (last == NULL) {
+			first = iodev_sqe;
+		} else {
+			mpsc_ptr_set(last->q.next, &iodev_sqe->q);
+		}
+		last = iodev_sqe;
 	}
 
+	if (handle != NULL) {
+		*handle = &first->sqe;
+	}
+
+	mpsc_push_list(&r->sq, &first->q, &last->q);
+
 	return 0;
 }
 
@@ -1806,7 +1902,11 @@ static inline int z_impl_rtio_cqe_copy_out(struct rtio *r,
  * submission chain, freeing submission queue events when done, and
  * producing completion queue events as submissions are completed.
  *
- * @warning It is undefined behavior to have re-entrant calls to submit
+ * @warning It is undefined behavior to have re-entrant calls to submit,
+ *	    unless CONFIG_RTIO_SUBMIT_MP is enabled. Submissions of concurrent
+ *	    producers must then be queued with rtio_sqe_copy_in(), so they
+ *	    are complete once visible, and the wait count includes their
+ *	    completions.
  *
  * @param r RTIO context
  * @param wait_count Number of submissions to wait for completion of.
@@ -398,6 +398,50 @@ int settings_save_one(const char *name, const void *value, size_t val_len);
  */
 int settings_delete(const char *name);
 
+/**
+ * Start a transaction.
+ *
+ * Items set in a transaction are saved together on commit: after a power
+ * loss either none or all of them are found in persisted storage, the
+ * interrupted commit being completed on the next load. Transactions are
+ * staged in a buffer of CONFIG_SETTINGS_TRANSACTION_BUF_SIZE bytes, which is
+ * saved as a single item on commit, so the whole transaction must fit in the
+ * value size limit of the backend.
+ *
+ * The settings lock is held until settings_transaction_commit() or
+ * settings_transaction_abort(), other threads saving items are blocked
+ * meanwhile.
+ *
+ * @return 0 on success, -ENOENT if there is no settings destination,
+ *	   -EBUSY if a transaction is already in progress.
+ */
+int settings_transaction_begin(void);
+
+/**
+ * Add an item to the current transaction.
+ *
+ * @param name Name/key of the settings item.
+ * @param value Pointer to the value of the settings item, NULL to delete it.
+ * @param val_len Length of the value, 0 to delete the item.
+ *
+ * @return 0 on success, -EINVAL if there is no transaction in progress or
+ *	   the item is invalid, -ENOMEM if the transaction buffer is full.
+ */
+int settings_transaction_set(const char *name, const void *value, size_t val_len);
+
+/**
+ * Save the items of the current transaction and end it.
+ *
+ * @return 0 on success, non-zero on failure. The transaction ends in all
+ *	   cases, if its journal was saved it is completed on the next load.
+ */
+int settings_transaction_commit(void);
+
+/**
+ * Drop the items of the current transaction and end it.
+ */
+void settings_transaction_abort(void);
+
 /**
  * Call commit for all settings handler. This should apply all
  * settings which has been set, but not applied yet.
@@ -9,6 +9,7 @@
 
 #include <zephyr/net/socket.h>
 #include <zephyr/shell/shell.h>
+#include <zephyr/sys/ring_buffer.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -62,6 +63,15 @@ struct shell_telnet {
 
 	/** If set, no output is sent to the TELNET client. */
 	bool output_lock;
+
+#if CONFIG_SHELL_TELNET_TX_RING_BUFFER_SIZE > 0
+	/** Ring buffer for outgoing data, used instead of the line buffer. */
+	struct ring_buf tx_ringbuf;
+	uint8_t tx_buf[CONFIG_SHELL_TELNET_TX_RING_BUFFER_SIZE];
+
+	/** Mutex protecting the output ring buffer access. */
+	struct k_mutex tx_lock;
+#endif
 };
 
 #define SHELL_TELNET_DEFINE(_name)					\
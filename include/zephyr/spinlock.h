@@ -19,6 +19,9 @@
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/time_units.h>
+#ifdef CONFIG_LOCK_STATS
+#include <zephyr/kernel/lock_stats.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -79,6 +82,11 @@ struct k_spinlock {
 			uint32_t lock_time;
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+
+#ifdef CONFIG_LOCK_STATS
+			/* Contention statistics, NULL when not gathered */
+			struct k_lock_stats *stats;
+#endif /* CONFIG_LOCK_STATS */
 		};
 
 #ifdef CONFIG_NONZERO_SPINLOCK_SIZE
@@ -194,6 +202,10 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	k.key = arch_irq_lock();
 
 	z_spinlock_validate_pre(l);
+#ifdef CONFIG_LOCK_STATS
+	uint32_t wait_start = (l->stats != NULL) ? sys_clock_cycle_get_32() : 0U;
+	bool contended = false;
+#endif /* CONFIG_LOCK_STATS */
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/*
@@ -203,15 +215,26 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	atomic_val_t ticket = atomic_inc(&l->tail);
 	/* Spin until our ticket is served */
 	while (atomic_get(&l->owner) != ticket) {
+#ifdef CONFIG_LOCK_STATS
+		contended = true;
+#endif /* CONFIG_LOCK_STATS */
 		arch_spin_relax();
 	}
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
+#ifdef CONFIG_LOCK_STATS
+		contended = true;
+#endif /* CONFIG_LOCK_STATS */
 		arch_spin_relax();
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_LOCK_STATS
+	if (l->stats != NULL) {
+		z_lock_stats_acquired(l->stats, wait_start, contended);
+	}
+#endif /* CONFIG_LOCK_STATS */
 
 	return k;
 }
@@ -267,6 +290,11 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_LOCK_STATS
+	if (l->stats != NULL) {
+		z_lock_stats_acquired(l->stats, sys_clock_cycle_get_32(), false);
+	}
+#endif /* CONFIG_LOCK_STATS */
 
 	k->key = key;
 
@@ -315,6 +343,11 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 		 l, delta, CONFIG_SPIN_LOCK_TIME_LIMIT);
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+#ifdef CONFIG_LOCK_STATS
+	if (l->stats != NULL) {
+		z_lock_stats_released(l->stats);
+	}
+#endif /* CONFIG_LOCK_STATS */
 
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
@@ -365,6 +398,11 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+#ifdef CONFIG_LOCK_STATS
+	if (l->stats != NULL) {
+		z_lock_stats_released(l->stats);
+	}
+#endif /* CONFIG_LOCK_STATS */
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	(void)atomic_inc(&l->owner);
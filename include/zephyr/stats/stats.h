@@ -71,6 +71,10 @@ struct stats_hdr {
 #ifdef CONFIG_STATS_NAMES
 	const struct stats_name_map *s_map;
 	int s_map_cnt;
+#endif
+#ifdef CONFIG_STATS_UPDATE_HOOK
+	/** Refreshes the values before they are walked, can be NULL */
+	void (*s_update)(struct stats_hdr *hdr);
 #endif
 	struct stats_hdr *s_next;
 };
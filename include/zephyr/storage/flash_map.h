@@ -65,6 +65,10 @@ struct flash_area {
 	/** Partition label if defined in DTS. Otherwise nullptr; */
 	const char *fa_label;
 #endif
+#if CONFIG_FLASH_MAP_MMAP
+	/** Address the area is mapped at, NULL if not memory mapped */
+	const void *fa_mmap;
+#endif
 };
 
 /**
@@ -126,8 +130,8 @@ int flash_area_open(uint8_t id, const struct flash_area **fa);
 /**
  * @brief Close flash_area
  *
- * Reserved for future usage and external projects compatibility reason.
- * Currently is NOP.
+ * Programs data buffered by CONFIG_FLASH_MAP_WRITE_COMBINE. Reserved for
+ * future usage and external projects compatibility reason otherwise.
  *
  * @param[in] fa Flash area to be closed.
  */
@@ -210,6 +214,44 @@ int flash_area_copy(const struct flash_area *src_fa, off_t src_off,
 		    const struct flash_area *dst_fa, off_t dst_off,
 		    off_t len, uint8_t *buf, size_t buf_size);
 
+/**
+ * @brief Get a pointer to memory mapped flash area data
+ *
+ * Gives direct access to the data of areas on memory mapped flash, such as
+ * internal flash, without copying it. The data cache is invalidated for the
+ * range, and data buffered by CONFIG_FLASH_MAP_WRITE_COMBINE programmed, so
+ * the pointer reflects the area content until the range is written or
+ * erased again.
+ *
+ * This allows for instance loading extensions stored in a flash area with
+ * the llext buffer loader without copying them to RAM.
+ *
+ * @param[in]  fa  Flash area
+ * @param[in]  off Offset relative from beginning of flash area
+ * @param[in]  len Number of bytes to access
+ * @param[out] ptr Pointer to the data at @p off
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the range is out of the area.
+ * @retval -ENOTSUP if the area is not memory mapped or
+ * CONFIG_FLASH_MAP_MMAP is disabled.
+ * @return other negative errno code on failure to program buffered data.
+ */
+int flash_area_mmap(const struct flash_area *fa, off_t off, size_t len, const void **ptr);
+
+/**
+ * @brief Program data buffered for a flash area
+ *
+ * With CONFIG_FLASH_MAP_WRITE_COMBINE, writes are buffered and programmed
+ * later. This programs them right away. Does nothing otherwise.
+ *
+ * @param[in] fa Flash area
+ *
+ * @return  0 on success, negative errno code of the first failure to program
+ * buffered data since the last call.
+ */
+int flash_area_flush(const struct flash_area *fa);
+
 /**
  * @brief Erase flash area
  *
@@ -25,6 +25,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -75,6 +78,13 @@ struct stream_flash_ctx {
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	uint8_t *buf_alt; /* Write buffer half being programmed */
+	size_t pending_bytes; /* Number of bytes in buf_alt being programmed */
+	int pending_rc; /* Result of programming buf_alt */
+	struct k_work work; /* Programs buf_alt */
+	struct k_sem idle; /* Available while buf_alt is not being programmed */
+#endif
 	/** @endcond */
 };
 
@@ -86,6 +96,8 @@ struct stream_flash_ctx {
  * @param buf Write buffer
  * @param buf_len Length of write buffer. Can not be larger than the page size.
  *                Must be multiple of the flash device write-block-size.
+ *                With CONFIG_STREAM_FLASH_ASYNC, the buffer is split in two
+ *                halves which must each meet these requirements.
  * @param offset Offset within flash device to start writing to
  * @param size Number of bytes available for performing buffered write.
  * @param cb Callback to be invoked on completed flash write operations.
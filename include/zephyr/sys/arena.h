@@ -0,0 +1,251 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Arena (bump) allocator
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_arena_apis Arena Allocator APIs
+ * @ingroup memory_management
+ * @{
+ */
+
+/** Alignment of memory returned by sys_arena_alloc() */
+#define SYS_ARENA_ALIGN 8
+
+/**
+ * @brief Arena allocator
+ *
+ * An arena hands out memory from a single buffer by advancing an
+ * offset.  Objects cannot be freed individually: everything is
+ * released at once with sys_arena_reset(), or back to a point taken
+ * with sys_arena_mark().  This suits request-scoped scratch data that
+ * all dies together, where it replaces many heap calls by a few
+ * pointer operations.
+ *
+ * Arenas have no internal locking.  They are meant to be owned by a
+ * single thread (e.g. the one handling a request); callers sharing an
+ * arena must serialize access themselves.
+ */
+struct sys_arena {
+	/** Start of the backing buffer */
+	uint8_t *base;
+	/** Size of the backing buffer */
+	size_t size;
+	/** Bytes currently handed out, including alignment padding */
+	size_t used;
+	/** Peak value of @a used */
+	size_t max_used;
+	/** Heap the buffer came from, or NULL for caller-provided memory */
+	struct k_heap *heap;
+};
+
+/**
+ * @brief Statically define an arena with its own backing buffer
+ *
+ * @param name Name of the struct sys_arena variable
+ * @param bytes Size of the backing buffer
+ */
+#define SYS_ARENA_DEFINE(name, bytes)                                                              \
+	static uint8_t __aligned(SYS_ARENA_ALIGN) _sys_arena_buf_##name[bytes];                    \
+	struct sys_arena name = {                                                                  \
+		.base = _sys_arena_buf_##name,                                                     \
+		.size = (bytes),                                                                   \
+	}
+
+/**
+ * @brief Statically define a file-local arena
+ *
+ * Same as SYS_ARENA_DEFINE(), with the arena declared static.
+ *
+ * @param name Name of the struct sys_arena variable
+ * @param bytes Size of the backing buffer
+ */
+#define SYS_ARENA_DEFINE_STATIC(name, bytes)                                                       \
+	static uint8_t __aligned(SYS_ARENA_ALIGN) _sys_arena_buf_##name[bytes];                    \
+	static struct sys_arena name = {                                                           \
+		.base = _sys_arena_buf_##name,                                                     \
+		.size = (bytes),                                                                   \
+	}
+
+/**
+ * @brief Initialize an arena on caller-provided memory
+ *
+ * @param arena Arena to initialize
+ * @param mem Backing buffer
+ * @param bytes Size of the backing buffer
+ */
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes);
+
+/**
+ * @brief Initialize an arena with a buffer taken from a k_heap
+ *
+ * The buffer is returned to the heap by sys_arena_deinit().
+ *
+ * @param arena Arena to initialize
+ * @param heap Heap to allocate the backing buffer from
+ * @param bytes Size of the backing buffer
+ * @param timeout How long to wait for the heap allocation
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if the backing buffer could not be allocated
+ */
+int sys_arena_init_from_heap(struct sys_arena *arena, struct k_heap *heap,
+			     size_t bytes, k_timeout_t timeout);
+
+/**
+ * @brief Release an arena's backing buffer
+ *
+ * Returns the buffer to its k_heap if the arena was set up with
+ * sys_arena_init_from_heap(). All memory allocated from the arena
+ * becomes invalid.
+ *
+ * @param arena Arena to release
+ */
+void sys_arena_deinit(struct sys_arena *arena);
+
+/**
+ * @brief Allocate aligned memory from an arena
+ *
+ * @param arena Arena to allocate from
+ * @param align Required alignment, a power of two
+ * @param bytes Number of bytes requested
+ *
+ * @return Pointer to the memory, or NULL if @a bytes is zero or the
+ *         arena does not have enough room left
+ */
+static inline void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align,
+					    size_t bytes)
+{
+	__ASSERT((align & (align - 1U)) == 0U, "align must be a power of 2");
+
+	uintptr_t start = ROUND_UP((uintptr_t)arena->base + arena->used, align);
+	size_t offset = start - (uintptr_t)arena->base;
+
+	if ((bytes == 0U) || (offset > arena->size) || (bytes > arena->size - offset)) {
+		return NULL;
+	}
+
+	arena->used = offset + bytes;
+	arena->max_used = MAX(arena->max_used, arena->used);
+
+	return (void *)start;
+}
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * The memory is aligned to @ref SYS_ARENA_ALIGN bytes.
+ *
+ * @param arena Arena to allocate from
+ * @param bytes Number of bytes requested
+ *
+ * @return Pointer to the memory, or NULL if @a bytes is zero or the
+ *         arena does not have enough room left
+ */
+static inline void *sys_arena_alloc(struct sys_arena *arena, size_t bytes)
+{
+	return sys_arena_aligned_alloc(arena, SYS_ARENA_ALIGN, bytes);
+}
+
+/**
+ * @brief Release all memory allocated from an arena
+ *
+ * @param arena Arena to reset
+ */
+static inline void sys_arena_reset(struct sys_arena *arena)
+{
+	arena->used = 0;
+}
+
+/**
+ * @brief Get a marker for the current arena position
+ *
+ * Passing the marker to sys_arena_rewind() later releases everything
+ * allocated after this call, keeping earlier allocations.
+ *
+ * @param arena Arena to query
+ *
+ * @return Opaque marker
+ */
+static inline size_t sys_arena_mark(const struct sys_arena *arena)
+{
+	return arena->used;
+}
+
+/**
+ * @brief Release all memory allocated since a marker was taken
+ *
+ * @param arena Arena to rewind
+ * @param mark Marker from sys_arena_mark() on the same arena
+ */
+static inline void sys_arena_rewind(struct sys_arena *arena, size_t mark)
+{
+	__ASSERT(mark <= arena->used, "arena marker %zu beyond used %zu", mark,
+		 arena->used);
+
+	arena->used = mark;
+}
+
+/**
+ * @brief Get the number of bytes currently allocated from an arena
+ *
+ * @param arena Arena to query
+ *
+ * @return Allocated bytes, including alignment padding
+ */
+static inline size_t sys_arena_used_get(const struct sys_arena *arena)
+{
+	return arena->used;
+}
+
+/**
+ * @brief Get the peak number of bytes allocated from an arena
+ *
+ * @param arena Arena to query
+ *
+ * @return Highest value returned by sys_arena_used_get() so far
+ */
+static inline size_t sys_arena_max_used_get(const struct sys_arena *arena)
+{
+	return arena->max_used;
+}
+
+/**
+ * @brief Get the number of bytes still available in an arena
+ *
+ * @param arena Arena to query
+ *
+ * @return Free bytes, before any alignment padding
+ */
+static inline size_t sys_arena_free_get(const struct sys_arena *arena)
+{
+	return arena->size - arena->used;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ARENA_H_ */
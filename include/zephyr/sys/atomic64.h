@@ -0,0 +1,224 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ATOMIC64_H_
+#define ZEPHYR_INCLUDE_SYS_ATOMIC64_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup atomic64_apis 64-bit Atomic Services APIs
+ * @ingroup atomic_apis
+ * @{
+ */
+
+/**
+ * @brief 64-bit atomic variable.
+ *
+ * Unlike @ref atomic_t, which has the size of a register, it is 64-bit wide
+ * on all targets, so that counters do not wrap around on 32-bit targets.
+ */
+typedef int64_t atomic64_t;
+
+/** @brief Value of a 64-bit atomic variable. */
+typedef atomic64_t atomic64_val_t;
+
+/**
+ * @brief Initialize a 64-bit atomic variable.
+ *
+ * @param i Value to assign to the atomic variable.
+ */
+#define ATOMIC64_INIT(i) (i)
+
+#if defined(CONFIG_ATOMIC64_OPERATIONS_C)
+
+/* 32-bit targets, where the compiler builtins would call into libatomic:
+ * implemented in kernel/atomic64_c.c with locks, and as system calls since
+ * user mode cannot take these.
+ */
+
+__syscall bool atomic64_cas(atomic64_t *target, atomic64_val_t old_value,
+			    atomic64_val_t new_value);
+
+__syscall atomic64_val_t atomic64_get(const atomic64_t *target);
+
+__syscall atomic64_val_t atomic64_set(atomic64_t *target, atomic64_val_t value);
+
+__syscall atomic64_val_t atomic64_add(atomic64_t *target, atomic64_val_t value);
+
+__syscall atomic64_val_t atomic64_sub(atomic64_t *target, atomic64_val_t value);
+
+__syscall atomic64_val_t atomic64_or(atomic64_t *target, atomic64_val_t value);
+
+__syscall atomic64_val_t atomic64_xor(atomic64_t *target, atomic64_val_t value);
+
+__syscall atomic64_val_t atomic64_and(atomic64_t *target, atomic64_val_t value);
+
+#else
+
+/**
+ * @brief 64-bit atomic compare-and-set.
+ *
+ * If the value of @p target equals @p old_value, it is set to @p new_value.
+ *
+ * @param target Address of atomic variable.
+ * @param old_value Original value to compare against.
+ * @param new_value New value to store.
+ *
+ * @return true if @p new_value is written, false otherwise.
+ */
+static inline bool atomic64_cas(atomic64_t *target, atomic64_val_t old_value,
+				atomic64_val_t new_value)
+{
+	return __atomic_compare_exchange_n(target, &old_value, new_value, 0,
+					   __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief 64-bit atomic get.
+ *
+ * @param target Address of atomic variable.
+ *
+ * @return Value of @p target.
+ */
+static inline atomic64_val_t atomic64_get(const atomic64_t *target)
+{
+	return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief 64-bit atomic get-and-set.
+ *
+ * @param target Address of atomic variable.
+ * @param value Value to write to @p target.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_set(atomic64_t *target, atomic64_val_t value)
+{
+	return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief 64-bit atomic addition.
+ *
+ * @param target Address of atomic variable.
+ * @param value Value to add.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_add(atomic64_t *target, atomic64_val_t value)
+{
+	return __atomic_fetch_add(target, value, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief 64-bit atomic subtraction.
+ *
+ * @param target Address of atomic variable.
+ * @param value Value to subtract.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_sub(atomic64_t *target, atomic64_val_t value)
+{
+	return __atomic_fetch_sub(target, value, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief 64-bit atomic bitwise inclusive OR.
+ *
+ * @param target Address of atomic variable.
+ * @param value Value to OR.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_or(atomic64_t *target, atomic64_val_t value)
+{
+	return __atomic_fetch_or(target, value, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief 64-bit atomic bitwise exclusive OR (XOR).
+ *
+ * @param target Address of atomic variable.
+ * @param value Value to XOR.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_xor(atomic64_t *target, atomic64_val_t value)
+{
+	return __atomic_fetch_xor(target, value, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief 64-bit atomic bitwise AND.
+ *
+ * @param target Address of atomic variable.
+ * @param value Value to AND.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_and(atomic64_t *target, atomic64_val_t value)
+{
+	return __atomic_fetch_and(target, value, __ATOMIC_SEQ_CST);
+}
+
+#endif /* CONFIG_ATOMIC64_OPERATIONS_C */
+
+/**
+ * @brief 64-bit atomic increment.
+ *
+ * @param target Address of atomic variable.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_inc(atomic64_t *target)
+{
+	return atomic64_add(target, 1);
+}
+
+/**
+ * @brief 64-bit atomic decrement.
+ *
+ * @param target Address of atomic variable.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_dec(atomic64_t *target)
+{
+	return atomic64_sub(target, 1);
+}
+
+/**
+ * @brief 64-bit atomic clear.
+ *
+ * @param target Address of atomic variable.
+ *
+ * @return Previous value of @p target.
+ */
+static inline atomic64_val_t atomic64_clear(atomic64_t *target)
+{
+	return atomic64_set(target, 0);
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(CONFIG_ATOMIC64_OPERATIONS_C)
+#include <zephyr/syscalls/atomic64.h>
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ATOMIC64_H_ */
@@ -0,0 +1,182 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup avltree_apis Balanced AVL Tree
+ * @ingroup datastructure_apis
+ *
+ * @brief Balanced AVL tree implementation
+ *
+ * This implements an intrusive balanced tree with the same usage as the
+ * @ref rbtree_apis, trading one extra pointer per node for faster
+ * lookups and iteration:
+ *
+ * - AVL trees are more strictly balanced than red/black trees, their
+ *   height is at most 1.44 * log2(N) instead of 2 * log2(N), so fewer
+ *   nodes are touched by each search.
+ * - Nodes store their parent, so iterating and removing need no stack
+ *   and iteration goes from a node to the next in amortized O(1).
+ * - The lowest-sorted node is cached, making avl_get_min() O(1), which
+ *   suits queues ordered by priority or deadline.
+ *
+ * The balance factor is unioned with the parent pointer, so the overall
+ * memory overhead of a node is three pointers.
+ *
+ * https://en.wikipedia.org/wiki/AVL_tree
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_AVL_H_
+#define ZEPHYR_INCLUDE_SYS_AVL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Balanced AVL tree node structure
+ */
+struct avlnode {
+	/** @cond INTERNAL_HIDDEN */
+	/* Parent node, with the balance factor plus one in the 2 low bits */
+	uintptr_t parent_balance;
+	struct avlnode *children[2];
+	/** @endcond */
+};
+
+/**
+ * @typedef avl_lessthan_t
+ * @brief AVL tree comparison predicate
+ *
+ * Compares the two nodes and returns true if node A is strictly less
+ * than B according to the tree's sorting criteria, false otherwise.
+ *
+ * As for @ref rb_lessthan_t, the new node being inserted will always be
+ * "A", so nodes comparing as equal are kept in insertion order.
+ */
+typedef bool (*avl_lessthan_t)(struct avlnode *a, struct avlnode *b);
+
+/**
+ * @brief Balanced AVL tree structure
+ */
+struct avltree {
+	/** Root node of the tree */
+	struct avlnode *root;
+	/** Comparison function for nodes in the tree */
+	avl_lessthan_t lessthan_fn;
+	/** @cond INTERNAL_HIDDEN */
+	struct avlnode *min;
+	/** @endcond */
+};
+
+/**
+ * @brief Insert node into tree
+ */
+void avl_insert(struct avltree *tree, struct avlnode *node);
+
+/**
+ * @brief Remove node from tree
+ */
+void avl_remove(struct avltree *tree, struct avlnode *node);
+
+/**
+ * @brief Returns the lowest-sorted member of the tree
+ */
+static inline struct avlnode *avl_get_min(struct avltree *tree)
+{
+	return tree->min;
+}
+
+/**
+ * @brief Returns the highest-sorted member of the tree
+ */
+struct avlnode *avl_get_max(struct avltree *tree);
+
+/**
+ * @brief Returns the member following a node of the tree
+ *
+ * @param node Member of the tree.
+ *
+ * @return The next member in sorting order, NULL if @p node is the last.
+ */
+struct avlnode *avl_next(struct avlnode *node);
+
+/**
+ * @brief Returns the member preceding a node of the tree
+ *
+ * @param node Member of the tree.
+ *
+ * @return The previous member in sorting order, NULL if @p node is the
+ * first.
+ */
+struct avlnode *avl_prev(struct avlnode *node);
+
+/**
+ * @brief Returns true if the given node is part of the tree
+ *
+ * As for rb_contains(), this only compares the node pointer with the
+ * members of the tree, so it can be used to implement a "set".
+ */
+bool avl_contains(struct avltree *tree, struct avlnode *node);
+
+/**
+ * @brief Walk a tree in-order
+ *
+ * The loop is not safe against modifications to the tree, see
+ * AVL_FOR_EACH_SAFE() to remove the current node.
+ *
+ * @param tree A pointer to a struct avltree to walk
+ * @param node The symbol name of a local struct avlnode* variable to
+ *             use as the iterator
+ */
+#define AVL_FOR_EACH(tree, node) \
+	for ((node) = avl_get_min(tree); (node) != NULL; (node) = avl_next(node))
+
+/**
+ * @brief Walk a tree in-order, safe against removal of the current node
+ *
+ * @param tree A pointer to a struct avltree to walk
+ * @param node The symbol name of a local struct avlnode* variable to
+ *             use as the iterator
+ * @param next The symbol name of a local struct avlnode* variable to
+ *             hold the next node
+ */
+#define AVL_FOR_EACH_SAFE(tree, node, next)                                                        \
+	for ((node) = avl_get_min(tree), (next) = ((node) != NULL) ? avl_next(node) : NULL;        \
+	     (node) != NULL; (node) = (next), (next) = ((node) != NULL) ? avl_next(node) : NULL)
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_AVL_CONTAINER(n, node, field)                                                            \
+	(((n) != NULL) ? CONTAINER_OF(n, __typeof__(*(node)), field) : NULL)
+/** @endcond */
+
+/**
+ * @brief Loop over an AVL tree with implicit container field logic
+ *
+ * As for AVL_FOR_EACH(), but "node" can have an arbitrary type
+ * containing a struct avlnode.
+ *
+ * @param tree A pointer to a struct avltree to walk
+ * @param node The symbol name of a local iterator
+ * @param field The field name of a struct avlnode inside node
+ */
+#define AVL_FOR_EACH_CONTAINER(tree, node, field)                                                  \
+	for ((node) = Z_AVL_CONTAINER(avl_get_min(tree), node, field); (node) != NULL;             \
+	     (node) = Z_AVL_CONTAINER(avl_next(&(node)->field), node, field))
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_SYS_AVL_H_ */
@@ -296,6 +296,8 @@ enum {
 	ZFD_IOCTL_STAT,
 	ZFD_IOCTL_TRUNCATE,
 	ZFD_IOCTL_MMAP,
+	ZFD_IOCTL_RECV_BUF,
+	ZFD_IOCTL_SEND_BUF,
 
 	/* Codes above 0x5400 and below 0x5500 are reserved for termios, FIO, etc */
 	ZFD_IOCTL_FIONREAD = 0x541B,
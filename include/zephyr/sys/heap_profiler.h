@@ -0,0 +1,143 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H_
+#define ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup heap_profiler Heap allocation profiler
+ * @ingroup heaps
+ * @{
+ */
+
+struct k_thread;
+
+/** Number of buckets in allocation size histograms */
+#define SYS_HEAP_PROFILER_HIST_BUCKETS 8
+
+/**
+ * @brief Upper bound, in bytes, of a histogram bucket
+ *
+ * Bucket @p n counts requests of up to 16 << @p n bytes, the last
+ * bucket counts all larger requests.
+ */
+#define SYS_HEAP_PROFILER_HIST_LIMIT(n) (16U << (n))
+
+/**
+ * @brief Allocation site statistics
+ *
+ * A site is a heap and the thread allocating from it, NULL for
+ * allocations made from interrupts or before the kernel started.
+ */
+struct sys_heap_profiler_site {
+	/** Heap identifier, see HEAP_ID_FROM_POINTER() */
+	uintptr_t heap_id;
+	/** Allocating thread, only used as an identifier */
+	const struct k_thread *thread;
+	/** Number of allocations */
+	uint32_t allocs;
+	/** Number of allocations since freed */
+	uint32_t frees;
+	/** Bytes currently allocated */
+	size_t live_bytes;
+	/** Largest value of live_bytes */
+	size_t peak_bytes;
+	/** Allocation request size histogram */
+	uint32_t hist[SYS_HEAP_PROFILER_HIST_BUCKETS];
+};
+
+/**
+ * @brief Profiler totals over all profiled heaps
+ */
+struct sys_heap_profiler_stats {
+	/** Number of allocations */
+	uint32_t allocs;
+	/** Number of frees */
+	uint32_t frees;
+	/** Bytes currently allocated */
+	size_t live_bytes;
+	/** Largest value of live_bytes */
+	size_t peak_bytes;
+	/** Allocations not tracked as the live allocation table was full */
+	uint32_t untracked;
+	/** Allocations not attributed as the site table was full */
+	uint32_t dropped;
+};
+
+/**
+ * @brief Start profiling a heap
+ *
+ * Registers heap listeners for @p heap. Allocations made before this
+ * call are not known to the profiler.
+ *
+ * @param heap Heap to profile
+ *
+ * @retval 0 on success
+ * @retval -EALREADY if the heap is already profiled
+ * @retval -ENOMEM if CONFIG_SYS_HEAP_PROFILER_HEAPS heaps are profiled
+ */
+int sys_heap_profiler_attach(struct sys_heap *heap);
+
+/**
+ * @brief Stop profiling a heap
+ *
+ * Statistics gathered so far are kept until sys_heap_profiler_reset().
+ *
+ * @param heap Heap to stop profiling
+ */
+void sys_heap_profiler_detach(struct sys_heap *heap);
+
+/**
+ * @brief Callback for sys_heap_profiler_foreach()
+ *
+ * @param site Copy of the site statistics
+ * @param user_data User data passed to sys_heap_profiler_foreach()
+ */
+typedef void (*sys_heap_profiler_cb_t)(const struct sys_heap_profiler_site *site,
+				       void *user_data);
+
+/**
+ * @brief Iterate over allocation sites
+ *
+ * The callback is called without the profiler lock held, on a snapshot
+ * of each site.
+ *
+ * @param cb Callback
+ * @param user_data User data passed to @p cb
+ */
+void sys_heap_profiler_foreach(sys_heap_profiler_cb_t cb, void *user_data);
+
+/**
+ * @brief Get the profiler totals
+ *
+ * @param stats Filled with the totals
+ */
+void sys_heap_profiler_stats_get(struct sys_heap_profiler_stats *stats);
+
+/**
+ * @brief Forget all statistics and tracked allocations
+ *
+ * Allocations made before the reset are ignored when freed.
+ */
+void sys_heap_profiler_reset(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H_ */
@@ -0,0 +1,147 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Relocatable heap allocations
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HEAP_RELOC_H_
+#define ZEPHYR_INCLUDE_SYS_HEAP_RELOC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_heap_reloc_apis Relocatable Heap APIs
+ * @ingroup low_level_heap_allocator
+ * @{
+ */
+
+/**
+ * @brief Handle slot of a relocatable heap
+ *
+ * @warning Not to be manipulated outside of the heap_reloc code.
+ */
+struct sys_heap_reloc_slot {
+	/** Current address of the object, NULL if the handle is free */
+	void *mem;
+	/** Number of outstanding sys_heap_reloc_pin() calls */
+	uint16_t pins;
+};
+
+/**
+ * @brief Relocatable heap
+ *
+ * A sys_heap whose objects are referenced through handles instead of
+ * pointers. An object is only accessed while pinned with
+ * sys_heap_reloc_pin(); unpinned objects may be moved towards the
+ * start of the heap by sys_heap_reloc_compact(), which gathers free
+ * memory into larger blocks.
+ *
+ * All calls are serialized with an internal spinlock, so they may be
+ * used from any context. Compaction holds it while moving one object.
+ */
+struct sys_heap_reloc {
+	/** Underlying heap */
+	struct sys_heap heap;
+	/** Handle table */
+	struct sys_heap_reloc_slot *slots;
+	/** Number of handles */
+	uint16_t num_slots;
+	/** Lock */
+	struct k_spinlock lock;
+};
+
+/**
+ * @brief Initialize a relocatable heap
+ *
+ * @param rheap Relocatable heap
+ * @param mem Memory for the heap
+ * @param bytes Size of @p mem
+ * @param slots Handle table
+ * @param num_slots Number of entries in @p slots, at most UINT16_MAX
+ */
+void sys_heap_reloc_init(struct sys_heap_reloc *rheap, void *mem, size_t bytes,
+			 struct sys_heap_reloc_slot *slots, uint16_t num_slots);
+
+/**
+ * @brief Allocate a relocatable object
+ *
+ * @param rheap Relocatable heap
+ * @param bytes Size of the object
+ *
+ * @return A handle to the unpinned object, or a negative error code:
+ *         -ENOMEM if the heap has no room, -ENOSPC if all handles are used
+ */
+int sys_heap_reloc_alloc(struct sys_heap_reloc *rheap, size_t bytes);
+
+/**
+ * @brief Free a relocatable object
+ *
+ * The object must not be pinned.
+ *
+ * @param rheap Relocatable heap
+ * @param handle Handle returned by sys_heap_reloc_alloc()
+ */
+void sys_heap_reloc_free(struct sys_heap_reloc *rheap, int handle);
+
+/**
+ * @brief Pin an object and get its address
+ *
+ * The object is not moved until a matching sys_heap_reloc_unpin().
+ *
+ * @param rheap Relocatable heap
+ * @param handle Handle returned by sys_heap_reloc_alloc()
+ *
+ * @return Current address of the object
+ */
+void *sys_heap_reloc_pin(struct sys_heap_reloc *rheap, int handle);
+
+/**
+ * @brief Unpin an object
+ *
+ * The address returned by sys_heap_reloc_pin() must not be used after
+ * the last unpin.
+ *
+ * @param rheap Relocatable heap
+ * @param handle Handle returned by sys_heap_reloc_alloc()
+ */
+void sys_heap_reloc_unpin(struct sys_heap_reloc *rheap, int handle);
+
+/**
+ * @brief Compact a relocatable heap
+ *
+ * Slides unpinned objects into the free memory preceding them, so that
+ * free memory gathers between pinned objects and at the end of the heap.
+ * The lock is released between moves, so this is meant to be called
+ * periodically from a low priority thread or work item.
+ *
+ * @param rheap Relocatable heap
+ * @param max_moves Maximum number of objects to move
+ *
+ * @return Number of objects moved, less than @p max_moves when the heap
+ *         cannot be compacted further
+ */
+size_t sys_heap_reloc_compact(struct sys_heap_reloc *rheap, size_t max_moves);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HEAP_RELOC_H_ */
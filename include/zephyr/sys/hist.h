@@ -0,0 +1,274 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HIST_H_
+#define ZEPHYR_INCLUDE_SYS_HIST_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+#ifdef CONFIG_SYS_HIST_STATS
+#include <zephyr/stats/stats.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Log-linear histogram API
+ * @defgroup sys_hist Log-linear histogram API
+ * @ingroup datastructure_apis
+ *
+ * Histograms with buckets of constant relative width, in the manner of
+ * HdrHistogram, suitable for tracking latency percentiles from hot paths.
+ *
+ * Values below 2^(sub_bits + 1) have a bucket each. Above, every power of two
+ * range is split in 2^sub_bits buckets, so a value is known with a relative
+ * error below 2^-sub_bits. Values of max_bits bits or more are counted in the
+ * last bucket.
+ *
+ * Each CPU has its own buckets, updated with a single atomic increment, so
+ * recording is safe from any context without locking. Readers sum the
+ * buckets of all CPUs.
+ * @{
+ */
+
+/** @brief Largest supported number of value bits. */
+#define SYS_HIST_MAX_BITS 32
+
+/**
+ * @brief Number of buckets of a histogram.
+ *
+ * @param sub_bits Log2 of the number of buckets per power of two.
+ * @param max_bits Number of bits of the largest value told apart.
+ *
+ * Includes the last bucket, counting the values out of range.
+ */
+#define SYS_HIST_NUM_BUCKETS(sub_bits, max_bits) ((((max_bits) - (sub_bits) + 1) << (sub_bits)) + 1)
+
+/** @cond INTERNAL_HIDDEN */
+#ifdef CONFIG_SYS_HIST_STATS
+STATS_SECT_DECL(sys_hist) {
+	struct stats_hdr s_hdr;
+	uint32_t count;
+	uint32_t p50;
+	uint32_t p90;
+	uint32_t p99;
+	uint32_t p999;
+	uint32_t max;
+};
+#endif
+/** @endcond */
+
+/** @brief Bucket layout of a histogram. */
+struct sys_hist_layout {
+	/** Number of buckets. */
+	uint16_t num_buckets;
+	/** Log2 of the number of buckets per power of two. */
+	uint8_t sub_bits;
+	/** Number of bits of the largest value told apart. */
+	uint8_t max_bits;
+};
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_SYS_HIST_LAYOUT_INIT(_sub_bits, _max_bits)                                              \
+	{                                                                                          \
+		.num_buckets = SYS_HIST_NUM_BUCKETS(_sub_bits, _max_bits),                         \
+		.sub_bits = (_sub_bits),                                                           \
+		.max_bits = (_max_bits),                                                           \
+	}
+/** @endcond */
+
+/** @brief Histogram. */
+struct sys_hist {
+	/** Name, used by the shell and exporters. */
+	const char *name;
+	/** Buckets of all CPUs, one set after the other. */
+	atomic_t *buckets;
+	/** Bucket layout, of each CPU. */
+	struct sys_hist_layout layout;
+#if defined(CONFIG_SYS_HIST_STATS) || defined(__DOXYGEN__)
+	/** Statistics group exported with the stats subsystem. */
+	STATS_SECT_DECL(sys_hist) stats;
+#endif
+};
+
+/**
+ * @brief Define a histogram.
+ *
+ * @param _name Histogram name.
+ * @param _sub_bits Log2 of the number of buckets per power of two, sets the
+ *		    precision.
+ * @param _max_bits Number of bits of the largest value told apart, sets the
+ *		    range.
+ */
+#define SYS_HIST_DEFINE(_name, _sub_bits, _max_bits)                                              \
+	BUILD_ASSERT(((_sub_bits) < (_max_bits)) && ((_max_bits) <= SYS_HIST_MAX_BITS) &&          \
+			     (SYS_HIST_NUM_BUCKETS(_sub_bits, _max_bits) <= UINT16_MAX),           \
+		     "Invalid histogram layout");                                                  \
+	static atomic_t _name##_buckets[CONFIG_MP_MAX_NUM_CPUS *                                   \
+					SYS_HIST_NUM_BUCKETS(_sub_bits, _max_bits)];               \
+	STRUCT_SECTION_ITERABLE(sys_hist, _name) = {                                               \
+		.name = STRINGIFY(_name),                                                          \
+		.buckets = _name##_buckets,                                                        \
+		.layout = Z_SYS_HIST_LAYOUT_INIT(_sub_bits, _max_bits),                            \
+	}
+
+/**
+ * @brief Snapshot of a histogram.
+ *
+ * Holds the buckets of all CPUs summed together. Snapshots of histograms
+ * with the same layout can be merged.
+ */
+struct sys_hist_snapshot {
+	/** Buckets, provided by the user. */
+	uint32_t *buckets;
+	/** Bucket layout. */
+	struct sys_hist_layout layout;
+	/** Number of values. */
+	uint64_t count;
+};
+
+/**
+ * @brief Define a snapshot able to hold a histogram of the given layout.
+ *
+ * @param _name Snapshot name.
+ * @param _sub_bits Log2 of the number of buckets per power of two.
+ * @param _max_bits Number of bits of the largest value told apart.
+ */
+#define SYS_HIST_SNAPSHOT_DEFINE(_name, _sub_bits, _max_bits)                                     \
+	uint32_t _name##_buckets[SYS_HIST_NUM_BUCKETS(_sub_bits, _max_bits)];                      \
+	struct sys_hist_snapshot _name = {                                                         \
+		.buckets = _name##_buckets,                                                        \
+		.layout = Z_SYS_HIST_LAYOUT_INIT(_sub_bits, _max_bits),                            \
+	}
+
+/**
+ * @brief Get the bucket a value is counted in.
+ *
+ * @param layout Bucket layout.
+ * @param value Value.
+ *
+ * @return Bucket index.
+ */
+static inline uint32_t sys_hist_bucket_get(const struct sys_hist_layout *layout, uint32_t value)
+{
+	uint32_t msb, shift;
+
+	if (value < BIT(layout->sub_bits + 1)) {
+		return value;
+	}
+
+	msb = 31U - __builtin_clz(value);
+	if (msb >= layout->max_bits) {
+		return layout->num_buckets - 1U;
+	}
+
+	shift = msb - layout->sub_bits;
+
+	return ((shift + 1U) << layout->sub_bits) + (value >> shift) - BIT(layout->sub_bits);
+}
+
+/**
+ * @brief Get the highest value of a bucket.
+ *
+ * @param layout Bucket layout.
+ * @param idx Bucket index.
+ *
+ * @return Highest value counted in the bucket, UINT32_MAX for the last one.
+ */
+uint32_t sys_hist_bucket_max(const struct sys_hist_layout *layout, uint32_t idx);
+
+/**
+ * @brief Record a value.
+ *
+ * Can be called from any context, including ISRs. Not available to user
+ * mode threads.
+ *
+ * @param hist Histogram.
+ * @param value Value.
+ */
+static inline void sys_hist_record(struct sys_hist *hist, uint32_t value)
+{
+	uint32_t cpu = IS_ENABLED(CONFIG_SMP) ? arch_curr_cpu()->id : 0U;
+
+	atomic_inc(&hist->buckets[(cpu * hist->layout.num_buckets) +
+				  sys_hist_bucket_get(&hist->layout, value)]);
+}
+
+/**
+ * @brief Get the number of values in a bucket of a histogram.
+ *
+ * @param hist Histogram.
+ * @param idx Bucket index.
+ *
+ * @return Number of values counted in the bucket by all CPUs.
+ */
+uint32_t sys_hist_bucket_count(const struct sys_hist *hist, uint32_t idx);
+
+/**
+ * @brief Reset a histogram.
+ *
+ * Values recorded concurrently may be lost or kept.
+ *
+ * @param hist Histogram.
+ */
+void sys_hist_reset(struct sys_hist *hist);
+
+/**
+ * @brief Take a snapshot of a histogram.
+ *
+ * @param hist Histogram.
+ * @param snap Snapshot, with the same layout as @p hist.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the layouts differ.
+ */
+int sys_hist_snapshot(const struct sys_hist *hist, struct sys_hist_snapshot *snap);
+
+/**
+ * @brief Add a snapshot to another one.
+ *
+ * @param dst Snapshot to add to.
+ * @param src Snapshot to add, with the same layout as @p dst.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the layouts differ.
+ */
+int sys_hist_merge(struct sys_hist_snapshot *dst, const struct sys_hist_snapshot *src);
+
+/**
+ * @brief Get a percentile from a snapshot.
+ *
+ * @param snap Snapshot.
+ * @param ppm Percentile in parts per million, for instance 990000 for p99 or
+ *	      999000 for p99.9.
+ *
+ * @return Highest value of the bucket holding the percentile, 0 if the
+ *	   snapshot is empty.
+ */
+uint32_t sys_hist_percentile(const struct sys_hist_snapshot *snap, uint32_t ppm);
+
+/**
+ * @brief Find a histogram by name.
+ *
+ * @param name Histogram name.
+ *
+ * @return Histogram, or NULL if not found.
+ */
+struct sys_hist *sys_hist_find(const char *name);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HIST_H_ */
@@ -6,6 +6,7 @@
 #ifndef ZEPHYR_INCLUDE_SYS_KOBJECT_H
 #define ZEPHYR_INCLUDE_SYS_KOBJECT_H
 
+#include <errno.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -281,6 +282,57 @@ static inline void k_object_free(void *obj)
 /* LCOV_EXCL_STOP */
 #endif /* CONFIG_DYNAMIC_OBJECTS */
 
+/**
+ * @brief System call in a batch
+ *
+ * @see k_syscall_batch()
+ */
+struct k_syscall_batch_entry {
+	/** System call identifier, one of the K_SYSCALL_* values */
+	uintptr_t id;
+	/** Arguments, marshalled as by the generated system call wrapper */
+	uintptr_t args[6];
+	/** Value returned by the system call handler, set by k_syscall_batch() */
+	uintptr_t ret;
+};
+
+#if defined(CONFIG_SYSCALL_BATCH) || defined(__DOXYGEN__)
+/**
+ * Execute several system calls with a single privilege transition
+ *
+ * The system calls are performed in order, as if the calling user thread
+ * had invoked them one by one: each one validates its arguments and a
+ * validation failure terminates the thread. The identifiers and arguments
+ * of the system calls are those the generated wrappers pass to
+ * arch_syscall_invoke6(), and the return value of each system call is
+ * stored in the @a ret field of its entry.
+ *
+ * Batches can not be nested.
+ *
+ * @note This function is available only if @kconfig{CONFIG_SYSCALL_BATCH}
+ * is selected.
+ *
+ * @param entries Array of system calls, in memory writable by the caller
+ * @param count Number of entries in the array
+ * @retval 0 All the system calls were executed
+ * @retval -ENOTSUP Called from supervisor mode, where kernel APIs must be
+ *         called directly
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count);
+#else
+
+/* LCOV_EXCL_START */
+static inline int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+/* LCOV_EXCL_STOP */
+#endif /* CONFIG_SYSCALL_BATCH */
+
 /** @} */
 
 #include <zephyr/syscalls/kobject.h>
@@ -0,0 +1,243 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SYS_MPMC_LOCKFREE_H_
+#define ZEPHYR_SYS_MPMC_LOCKFREE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/toolchain/common.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util_macro.h>
+
+/**
+ * @brief Multiple Producer Multiple Consumer (MPMC) Lockfree Queue API
+ * @defgroup mpmc_lockfree MPMC API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/**
+ * @file mpmc_lockfree.h
+ *
+ * @brief A lock-free and type safe power of 2 fixed sized multiple producer
+ * multiple consumer (MPMC) bounded queue.
+ *
+ * The queue is a ring of cells, each carrying a sequence number next to its
+ * element (D. Vyukov's bounded MPMC queue). Producers and consumers claim a
+ * position with a compare-and-swap on a shared index, then work on the
+ * claimed cell without further synchronization and publish it by bumping
+ * its sequence number. Acquire and consume are O(1) apart from retries
+ * under contention, and are safe from any number of threads and ISRs.
+ *
+ * As with the SPSC queue, elements are accessed in place: an element is
+ * acquired, filled and produced by a producer, then consumed, read and
+ * released by a consumer. A consumer that finds the oldest element claimed
+ * but not yet produced sees the queue as empty, even if later elements
+ * have already been produced.
+ *
+ * An MPMC queue may be declared on a stack or statically, with zeroed
+ * storage being a valid empty queue.
+ */
+
+/**
+ * @private
+ * @brief Common MPMC attributes
+ *
+ * @warning Not to be manipulated without the macros!
+ */
+struct mpmc {
+	/* next position to produce into */
+	atomic_t enqueue;
+
+	/* next position to consume from */
+	atomic_t dequeue;
+
+	/* mask used to automatically wrap values */
+	unsigned long mask;
+};
+
+/**
+ * @private
+ * @brief Claim the cell at a queue position
+ *
+ * Cell sequence numbers are stored relative to the cell index, so that
+ * zero-initialized storage describes an empty queue: cell i is free for
+ * position p when its sequence plus i equals p, and holds the element of
+ * position p when it equals p + 1.
+ *
+ * @param pos Shared enqueue or dequeue index
+ * @param mask Queue size minus one
+ * @param cells Cell array, each cell starting with its sequence number
+ * @param stride Size of a cell in bytes
+ * @param lag 0 to claim a free cell, 1 to claim a produced one
+ *
+ * @return Pointer to the sequence number of the claimed cell, or NULL if
+ *         the queue is full (lag 0) or empty (lag 1)
+ */
+static inline atomic_t *z_mpmc_claim(atomic_t *pos, unsigned long mask, void *cells,
+				     size_t stride, unsigned long lag)
+{
+	unsigned long p = (unsigned long)atomic_get(pos);
+
+	for (;;) {
+		unsigned long idx = p & mask;
+		atomic_t *seq = (atomic_t *)((uint8_t *)cells + idx * stride);
+		long dif = (long)((unsigned long)atomic_get(seq) + idx - (p + lag));
+
+		if (dif == 0) {
+			if (atomic_cas(pos, (atomic_val_t)p, (atomic_val_t)(p + 1))) {
+				return seq;
+			}
+		} else if (dif < 0) {
+			return NULL;
+		}
+
+		/* Lost a race with another producer or consumer */
+		p = (unsigned long)atomic_get(pos);
+	}
+}
+
+/**
+ * @private
+ * @brief Hand a claimed free cell over to consumers
+ */
+static inline void z_mpmc_produce(atomic_t *seq)
+{
+	(void)atomic_inc(seq);
+}
+
+/**
+ * @private
+ * @brief Hand a consumed cell back to producers for the next wrap
+ */
+static inline void z_mpmc_release(atomic_t *seq, unsigned long mask)
+{
+	(void)atomic_add(seq, (atomic_val_t)mask);
+}
+
+/**
+ * @brief Statically initialize an mpmc
+ *
+ * @param sz Size of the mpmc, must be power of 2 (ex: 2, 4, 8)
+ * @param buf Cell buffer pointer, must be zeroed
+ */
+#define MPMC_INITIALIZER(sz, buf)                                                                  \
+	{                                                                                          \
+		._mpmc =                                                                           \
+			{                                                                          \
+				.enqueue = ATOMIC_INIT(0),                                         \
+				.dequeue = ATOMIC_INIT(0),                                         \
+				.mask = sz - 1,                                                    \
+			},                                                                         \
+		.buffer = buf,                                                                     \
+	}
+
+/**
+ * @brief Declare the struct types for an mpmc
+ *
+ * @param name Name of the mpmc symbol to be provided
+ * @param type Type stored in the mpmc
+ */
+#define MPMC_DECLARE(name, type)                                                                   \
+	struct mpmc_cell_##name {                                                                  \
+		atomic_t seq;                                                                      \
+		type data;                                                                         \
+	};                                                                                         \
+	struct mpmc_##name {                                                                       \
+		struct mpmc _mpmc;                                                                 \
+		struct mpmc_cell_##name * const buffer;                                            \
+	}
+
+/**
+ * @brief Define an mpmc with a fixed size
+ *
+ * @param name Name of the mpmc symbol to be provided
+ * @param type Type stored in the mpmc
+ * @param sz Size of the mpmc, must be power of 2 (ex: 2, 4, 8)
+ */
+#define MPMC_DEFINE(name, type, sz)                                                                \
+	BUILD_ASSERT(IS_POWER_OF_TWO(sz));                                                         \
+	MPMC_DECLARE(name, type);                                                                  \
+	static struct mpmc_cell_##name __mpmc_buf_##name[sz];                                      \
+	struct mpmc_##name name = MPMC_INITIALIZER(sz, __mpmc_buf_##name);
+
+/**
+ * @brief Size of the MPMC queue
+ *
+ * @param mpmc MPMC reference
+ */
+#define mpmc_size(mpmc) ((mpmc)->_mpmc.mask + 1)
+
+/**
+ * @private
+ * @brief Cell holding a given element
+ */
+#define z_mpmc_cell(mpmc, item)                                                                    \
+	((__typeof__(&(mpmc)->buffer[0]))((uint8_t *)(item) -                                     \
+					   offsetof(__typeof__((mpmc)->buffer[0]), data)))
+
+/**
+ * @brief Acquire an element to produce from the MPMC
+ *
+ * @param mpmc MPMC to acquire an element from for producing
+ *
+ * @return A pointer to the acquired element or null if the mpmc is full
+ */
+#define mpmc_acquire(mpmc)                                                                         \
+	({                                                                                         \
+		atomic_t *seq = z_mpmc_claim(&(mpmc)->_mpmc.enqueue, (mpmc)->_mpmc.mask,           \
+					     (mpmc)->buffer, sizeof((mpmc)->buffer[0]), 0);        \
+		seq ? &((__typeof__(&(mpmc)->buffer[0]))seq)->data : NULL;                         \
+	})
+
+/**
+ * @brief Produce a previously acquired element to the MPMC
+ *
+ * @param mpmc MPMC the element was acquired from
+ * @param item Element returned by mpmc_acquire()
+ */
+#define mpmc_produce(mpmc, item) z_mpmc_produce(&z_mpmc_cell(mpmc, item)->seq)
+
+/**
+ * @brief Consume an element from the MPMC
+ *
+ * @param mpmc MPMC to consume from
+ *
+ * @return Pointer to element or null if no consumable elements left
+ */
+#define mpmc_consume(mpmc)                                                                         \
+	({                                                                                         \
+		atomic_t *seq = z_mpmc_claim(&(mpmc)->_mpmc.dequeue, (mpmc)->_mpmc.mask,           \
+					     (mpmc)->buffer, sizeof((mpmc)->buffer[0]), 1);        \
+		seq ? &((__typeof__(&(mpmc)->buffer[0]))seq)->data : NULL;                         \
+	})
+
+/**
+ * @brief Release a consumed element
+ *
+ * @param mpmc MPMC the element was consumed from
+ * @param item Element returned by mpmc_consume()
+ */
+#define mpmc_release(mpmc, item) z_mpmc_release(&z_mpmc_cell(mpmc, item)->seq, (mpmc)->_mpmc.mask)
+
+/**
+ * @brief Approximate count of claimed or produced elements in the MPMC
+ *
+ * The value is only a snapshot when other contexts use the queue.
+ *
+ * @param mpmc MPMC to get item count for
+ */
+#define mpmc_used(mpmc)                                                                            \
+	((unsigned long)atomic_get(&(mpmc)->_mpmc.enqueue) -                                      \
+	 (unsigned long)atomic_get(&(mpmc)->_mpmc.dequeue))
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_SYS_MPMC_LOCKFREE_H_ */
@@ -0,0 +1,152 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SYS_MPMC_MSGQ_H_
+#define ZEPHYR_SYS_MPMC_MSGQ_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Blocking MPMC message queue
+ * @defgroup mpmc_msgq MPMC message queue API
+ * @ingroup mpmc_lockfree
+ * @{
+ */
+
+/**
+ * @brief Blocking message queue on top of a lock-free MPMC ring
+ *
+ * Offers k_msgq-like put and get of fixed size messages. Messages are
+ * copied into and out of the ring without any lock; the semaphores are
+ * only used when a caller has to wait for a full queue to drain or an
+ * empty queue to fill, and producers/consumers only signal them when
+ * someone is actually waiting.
+ *
+ * The internal semaphores are not kernel objects accessible from user
+ * mode, so the queue is meant for supervisor threads and ISRs.
+ */
+struct mpmc_msgq {
+	/** @cond INTERNAL_HIDDEN */
+	struct mpmc _mpmc;
+	uint8_t *buffer;
+	size_t msg_size;
+	size_t stride;
+	atomic_t get_waiters;
+	atomic_t put_waiters;
+	struct k_sem not_empty;
+	struct k_sem not_full;
+	/** @endcond */
+};
+
+/**
+ * @brief Size in bytes of one slot of a queue, including its sequence number
+ *
+ * @param msg_size Message size in bytes
+ */
+#define MPMC_MSGQ_SLOT_SIZE(msg_size) ROUND_UP(sizeof(atomic_t) + (msg_size), sizeof(atomic_t))
+
+/**
+ * @brief Size in bytes of the buffer needed by a queue
+ *
+ * @param msg_size Message size in bytes
+ * @param max_msgs Maximum number of messages, must be a power of 2
+ */
+#define MPMC_MSGQ_BUF_SIZE(msg_size, max_msgs) (MPMC_MSGQ_SLOT_SIZE(msg_size) * (max_msgs))
+
+/**
+ * @brief Statically define and initialize an MPMC message queue
+ *
+ * @param name Name of the queue
+ * @param q_msg_size Message size in bytes
+ * @param q_max_msgs Maximum number of messages, must be a power of 2
+ */
+#define MPMC_MSGQ_DEFINE(name, q_msg_size, q_max_msgs)                                             \
+	BUILD_ASSERT(IS_POWER_OF_TWO(q_max_msgs));                                                 \
+	static uint8_t __aligned(sizeof(atomic_t))                                                 \
+		_mpmc_msgq_buf_##name[MPMC_MSGQ_BUF_SIZE(q_msg_size, q_max_msgs)];                 \
+	struct mpmc_msgq name = {                                                                  \
+		._mpmc = {                                                                         \
+			.enqueue = ATOMIC_INIT(0),                                                 \
+			.dequeue = ATOMIC_INIT(0),                                                 \
+			.mask = (q_max_msgs) - 1,                                                  \
+		},                                                                                 \
+		.buffer = _mpmc_msgq_buf_##name,                                                   \
+		.msg_size = (q_msg_size),                                                          \
+		.stride = MPMC_MSGQ_SLOT_SIZE(q_msg_size),                                         \
+		.get_waiters = ATOMIC_INIT(0),                                                     \
+		.put_waiters = ATOMIC_INIT(0),                                                     \
+		.not_empty = Z_SEM_INITIALIZER(name.not_empty, 0, K_SEM_MAX_LIMIT),                \
+		.not_full = Z_SEM_INITIALIZER(name.not_full, 0, K_SEM_MAX_LIMIT),                  \
+	}
+
+/**
+ * @brief Initialize an MPMC message queue
+ *
+ * @param q Queue to initialize
+ * @param buffer Buffer of MPMC_MSGQ_BUF_SIZE(@p msg_size, @p max_msgs) bytes,
+ *               aligned to sizeof(atomic_t)
+ * @param msg_size Message size in bytes
+ * @param max_msgs Maximum number of messages, must be a power of 2
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @p max_msgs is not a power of 2
+ */
+int mpmc_msgq_init(struct mpmc_msgq *q, void *buffer, size_t msg_size, uint32_t max_msgs);
+
+/**
+ * @brief Send a message to an MPMC message queue
+ *
+ * @note Can be called by ISRs with @p timeout set to K_NO_WAIT.
+ *
+ * @param q Queue to send to
+ * @param data Message of the queue's message size
+ * @param timeout How long to wait for room in a full queue
+ *
+ * @retval 0 Message sent
+ * @retval -ENOMSG Queue full and @p timeout was K_NO_WAIT
+ * @retval -EAGAIN Waiting period timed out
+ */
+int mpmc_msgq_put(struct mpmc_msgq *q, const void *data, k_timeout_t timeout);
+
+/**
+ * @brief Receive a message from an MPMC message queue
+ *
+ * @note Can be called by ISRs with @p timeout set to K_NO_WAIT.
+ *
+ * @param q Queue to receive from
+ * @param data Buffer of the queue's message size for the message
+ * @param timeout How long to wait for a message in an empty queue
+ *
+ * @retval 0 Message received
+ * @retval -ENOMSG Queue empty and @p timeout was K_NO_WAIT
+ * @retval -EAGAIN Waiting period timed out
+ */
+int mpmc_msgq_get(struct mpmc_msgq *q, void *data, k_timeout_t timeout);
+
+/**
+ * @brief Get the approximate number of messages in an MPMC message queue
+ *
+ * @param q Queue to query
+ *
+ * @return Number of messages being sent or waiting to be received
+ */
+static inline uint32_t mpmc_msgq_num_used_get(struct mpmc_msgq *q)
+{
+	return (uint32_t)mpmc_used(q);
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SYS_MPMC_MSGQ_H_ */
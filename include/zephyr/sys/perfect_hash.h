@@ -0,0 +1,121 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_PERFECT_HASH_H_
+#define ZEPHYR_INCLUDE_SYS_PERFECT_HASH_H_
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup hashmap_apis
+ * @defgroup perfect_hash Static Perfect Hash Tables
+ * @{
+ *
+ * Lookup tables over a set of keys known at build time, generated by
+ * scripts/build/gen_perfect_hash.py with the generate_perfect_hash() or
+ * generate_perfect_hash_for_target() CMake functions. Tables are constant
+ * and a lookup hashes the key twice and compares it once.
+ *
+ * Keys are listed one per line in an input file. A lookup returns the line
+ * number of the key, counting from 0, so it can index an array of values
+ * kept in the same order as the input file.
+ */
+
+/**
+ * @brief Static perfect hash table
+ *
+ * Defined by the generated header, its fields are private.
+ */
+struct sys_perfect_hash {
+	/** @cond INTERNAL_HIDDEN */
+	/* Seed of the second hash, per bucket of the first one */
+	const uint16_t *seeds;
+	/* Keys and key indexes, per slot */
+	const char *const *keys;
+	const uint16_t *key_lens;
+	const uint16_t *indexes;
+	uint16_t n_buckets;
+	uint16_t n_keys;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+/* 32-bit FNV-1a with the seed mixed into the offset basis, must match
+ * scripts/build/gen_perfect_hash.py.
+ */
+static inline uint32_t z_perfect_hash32(uint32_t seed, const void *key, size_t len)
+{
+	const uint8_t *p = (const uint8_t *)key;
+	uint32_t h = 2166136261U ^ seed;
+
+	for (size_t i = 0; i < len; i++) {
+		h ^= p[i];
+		h *= 16777619U;
+	}
+
+	return h;
+}
+/** @endcond */
+
+/**
+ * @brief Look up a key in a static perfect hash table
+ *
+ * @param ph Table, as defined by the generated header.
+ * @param key Key to look up, not necessarily NUL terminated.
+ * @param len Length of @p key in bytes.
+ *
+ * @return Line of @p key in the input file, counting from 0, or -ENOENT if
+ * @p key is not in the table.
+ */
+static inline int sys_perfect_hash_lookup(const struct sys_perfect_hash *ph, const void *key,
+					  size_t len)
+{
+	uint32_t slot;
+
+	if (ph->n_keys == 0) {
+		return -ENOENT;
+	}
+
+	slot = ph->seeds[z_perfect_hash32(0, key, len) % ph->n_buckets];
+	slot = z_perfect_hash32(slot, key, len) % ph->n_keys;
+
+	if ((ph->key_lens[slot] != len) || (memcmp(ph->keys[slot], key, len) != 0)) {
+		return -ENOENT;
+	}
+
+	return ph->indexes[slot];
+}
+
+/**
+ * @brief Look up a NUL terminated key in a static perfect hash table
+ *
+ * @param ph Table, as defined by the generated header.
+ * @param key Key to look up.
+ *
+ * @return Line of @p key in the input file, counting from 0, or -ENOENT if
+ * @p key is not in the table.
+ */
+static inline int sys_perfect_hash_lookup_str(const struct sys_perfect_hash *ph, const char *key)
+{
+	return sys_perfect_hash_lookup(ph, key, strlen(key));
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_PERFECT_HASH_H_ */
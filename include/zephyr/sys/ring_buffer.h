@@ -9,6 +9,9 @@
 
 #include <zephyr/sys/util.h>
 #include <errno.h>
+#ifdef CONFIG_RING_BUFFER_SPSC
+#include <zephyr/sys/barrier.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +45,16 @@ typedef uint16_t ring_buf_idx_t;
 
 struct ring_buf_index { ring_buf_idx_t head, tail, base; };
 
+/* Producer and consumer indexes in separate cache lines, so that each side
+ * only writes to its own.
+ */
+#if defined(CONFIG_RING_BUFFER_SPSC) && defined(CONFIG_DCACHE_LINE_SIZE) && \
+	(CONFIG_DCACHE_LINE_SIZE > 0)
+#define Z_RING_BUF_INDEX_ALIGN __aligned(CONFIG_DCACHE_LINE_SIZE)
+#else
+#define Z_RING_BUF_INDEX_ALIGN
+#endif
+
 /** @endcond */
 
 /**
@@ -50,14 +63,31 @@ struct ring_buf_index { ring_buf_idx_t head, tail, base; };
 struct ring_buf {
 	/** @cond INTERNAL_HIDDEN */
 	uint8_t *buffer;
-	struct ring_buf_index put;
-	struct ring_buf_index get;
+	struct ring_buf_index put Z_RING_BUF_INDEX_ALIGN;
+	struct ring_buf_index get Z_RING_BUF_INDEX_ALIGN;
 	uint32_t size;
 	/** @endcond */
 };
 
 /** @cond INTERNAL_HIDDEN */
 
+/* Reads the tail index published by the other side. With
+ * CONFIG_RING_BUFFER_SPSC, the data it covers is only accessed after the
+ * index is read.
+ */
+static inline ring_buf_idx_t z_ring_buf_tail_get(const struct ring_buf_index *ring)
+{
+#ifdef CONFIG_RING_BUFFER_SPSC
+	ring_buf_idx_t tail = *(const volatile ring_buf_idx_t *)&ring->tail;
+
+	barrier_dmem_fence_full();
+
+	return tail;
+#else
+	return ring->tail;
+#endif
+}
+
 uint32_t ring_buf_area_claim(struct ring_buf *buf, struct ring_buf_index *ring,
 			     uint8_t **data, uint32_t size);
 int ring_buf_area_finish(struct ring_buf *buf, struct ring_buf_index *ring,
@@ -212,7 +242,7 @@ static inline void ring_buf_item_init(struct ring_buf *buf,
  */
 static inline bool ring_buf_is_empty(const struct ring_buf *buf)
 {
-	return buf->get.head == buf->put.tail;
+	return buf->get.head == z_ring_buf_tail_get(&buf->put);
 }
 
 /**
@@ -234,7 +264,7 @@ static inline void ring_buf_reset(struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_space_get(const struct ring_buf *buf)
 {
-	ring_buf_idx_t allocated = buf->put.head - buf->get.tail;
+	ring_buf_idx_t allocated = buf->put.head - z_ring_buf_tail_get(&buf->get);
 
 	return buf->size - allocated;
 }
@@ -272,7 +302,7 @@ static inline uint32_t ring_buf_capacity_get(const struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_size_get(const struct ring_buf *buf)
 {
-	ring_buf_idx_t available = buf->put.tail - buf->get.head;
+	ring_buf_idx_t available = z_ring_buf_tail_get(&buf->put) - buf->get.head;
 
 	return available;
 }
@@ -19,6 +19,8 @@
 
 #include <zephyr/device.h>
 
+struct k_mem_slab;
+
 /**
  * @brief USB Audio Class 2 device API
  * @defgroup uac2_device USB Audio Class 2 device API
@@ -197,6 +199,73 @@ void usbd_uac2_set_ops(const struct device *dev,
 int usbd_uac2_send(const struct device *dev, uint8_t terminal,
 		   void *data, uint16_t size);
 
+/**
+ * @brief I2S stream bridged to an AudioStreaming interface
+ *
+ * The memory slab configured for the I2S stream is used as a ring of buffers
+ * shared by I2S and USB. Isochronous OUT packets are received directly in
+ * I2S TX blocks, and I2S RX blocks are sent as isochronous IN packets without
+ * any copy. The slab blocks must be suitable for use by UDC driver, and the
+ * I2S stream must be configured with 0 timeout before the bridge is enabled.
+ */
+struct uac2_i2s_stream {
+	/** Terminal ID linked to AudioStreaming interface */
+	uint8_t terminal;
+	/**
+	 * I2S direction, I2S_DIR_TX for audio received from the USB host and
+	 * I2S_DIR_RX for audio sent to the USB host
+	 */
+	uint8_t dir;
+	/** Number of blocks written to I2S TX before it is started */
+	uint8_t prebuffer;
+	/** Number of bytes per audio frame, i.e. sample size times channels */
+	uint8_t frame_size;
+	/** Sample rate in Hz */
+	uint32_t sample_rate;
+	/** I2S device */
+	const struct device *i2s_dev;
+	/** Memory slab configured for the I2S stream */
+	struct k_mem_slab *mem_slab;
+
+	/** @cond INTERNAL_HIDDEN */
+	bool enabled;
+	bool started;
+	uint8_t usb_blocks;
+	uint8_t blocks_written;
+	int32_t level;
+	/** @endcond */
+};
+
+/**
+ * @brief Bridge between USB Audio 2 device and I2S streams
+ */
+struct uac2_i2s_bridge {
+	/** Bridged streams */
+	struct uac2_i2s_stream *streams;
+	/** Number of bridged streams */
+	size_t num_streams;
+
+	/** @cond INTERNAL_HIDDEN */
+	bool microframes;
+	/** @endcond */
+};
+
+/**
+ * @brief Bridge USB Audio 2 device terminals to I2S streams
+ *
+ * Register USB Audio 2 application callbacks moving audio between the
+ * terminals and the I2S streams. I2S is started and stopped when the host
+ * enables and disables the terminals. Explicit feedback is derived from the
+ * number of blocks queued for I2S TX.
+ *
+ * @param dev USB Audio 2 device instance
+ * @param bridge Bridge between the device terminals and I2S streams
+ *
+ * @return 0 on success, negative value on error
+ */
+int usbd_uac2_i2s_bridge_init(const struct device *dev,
+			      struct uac2_i2s_bridge *bridge);
+
 /**
  * @}
  */
@@ -67,6 +67,13 @@ struct zbus_channel_data {
 	struct net_buf_pool *msg_subscriber_pool;
 #endif /* ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION */
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Message sequence counter, odd while the message is being written. It allows reading
+	 * the channel without taking the semaphore.
+	 */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 #if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS) || defined(__DOXYGEN__)
 	/** Kernel timestamp of the last publish action on this channel */
 	k_ticks_t publish_timestamp;
@@ -700,6 +707,9 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
  *
  * This routine reads a message from a channel.
  *
+ * With @kconfig{CONFIG_ZBUS_CHANNEL_SEQLOCK} enabled, the message is copied without taking the
+ * channel's semaphore unless the channel is being published or is claimed.
+ *
  * @param[in] chan The channel's reference.
  * @param[out] msg Reference to the message where the read function copies the channel's
  * message data to.
@@ -1273,6 +1283,31 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan, void *msg,
 		      k_timeout_t timeout);
 
+struct net_buf;
+
+/**
+ * @brief Wait for a channel message without copying it.
+ *
+ * This routine makes the subscriber wait for the new message in case of channel publication, like
+ * zbus_sub_wait_msg(), but lends the buffer holding the message instead of copying it. The buffer
+ * is shared with the other message subscribers and async listeners of the publication, so its
+ * data must not be modified.
+ *
+ * @param[in] sub The subscriber's reference.
+ * @param[out] chan The notification channel's reference.
+ * @param[out] buf The buffer holding the published message, at its data pointer. It must be
+ * released with net_buf_unref() once the message is no longer needed.
+ * @param[in] timeout Waiting period for a notification arrival,
+ *                or one of the special values, K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Could not retrieve the net_buf from the subscriber FIFO.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_sub_wait_msg_buf(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout);
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 /**
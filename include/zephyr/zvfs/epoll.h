@@ -0,0 +1,94 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLLIN  ZVFS_POLLIN
+#define ZVFS_EPOLLPRI ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT ZVFS_POLLOUT
+#define ZVFS_EPOLLERR ZVFS_POLLERR
+#define ZVFS_EPOLLHUP ZVFS_POLLHUP
+#define ZVFS_EPOLLONESHOT BIT(30)
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+#define ZVFS_EPOLL_CLOEXEC 0x80000
+
+/** User data returned with the events of a file descriptor */
+union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+};
+
+/** Event mask and user data of a file descriptor */
+struct zvfs_epoll_event {
+	uint32_t events;
+	union zvfs_epoll_data data;
+};
+
+/**
+ * @brief Create a ZVFS epoll file descriptor
+ *
+ * An epoll file descriptor holds a persistent set of file descriptors to
+ * monitor. Interest is registered once with @ref zvfs_epoll_ctl and each
+ * file descriptor is added to a ready list when it signals readiness, so
+ * the cost of @ref zvfs_epoll_wait depends on the number of ready file
+ * descriptors rather than on the number of monitored ones.
+ *
+ * Events are level triggered. A file descriptor must be removed from the
+ * set before it is closed.
+ *
+ * @param flags Zero or @ref ZVFS_EPOLL_CLOEXEC, which is ignored
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create1(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of a ZVFS epoll set
+ *
+ * @param epfd Epoll file descriptor
+ * @param op One of @ref ZVFS_EPOLL_CTL_ADD, @ref ZVFS_EPOLL_CTL_MOD or
+ *        @ref ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor to monitor
+ * @param event Events to monitor and user data, ignored for
+ *        @ref ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for events on a ZVFS epoll set
+ *
+ * @param epfd Epoll file descriptor
+ * @param events Array filled with the ready file descriptors
+ * @param maxevents Number of elements in @p events
+ * @param timeout Timeout in milliseconds, negative to wait forever
+ *
+ * @return Number of ready file descriptors, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
@@ -0,0 +1,124 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file 64-bit atomic ops in pure C
+ *
+ * For 32-bit targets, which cannot update 64 bits at once. Unlike
+ * atomic_c.c, this is also used on SMP, where the native 32-bit atomics
+ * back the spinlocks. Each variable hashes to one of several locks by its
+ * address, so that unrelated counters updated on different CPUs do not
+ * serialize on a single lock.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic64.h>
+
+#ifdef CONFIG_SMP
+#define NUM_LOCKS 16
+#else
+#define NUM_LOCKS 1
+#endif
+
+static struct k_spinlock locks[NUM_LOCKS];
+
+static inline struct k_spinlock *lock_get(const atomic64_t *target)
+{
+	/* Low bits are always the same for aligned variables */
+	return &locks[((uintptr_t)target / sizeof(atomic64_t)) % NUM_LOCKS];
+}
+
+#ifdef CONFIG_USERSPACE
+#include <zephyr/internal/syscall_handler.h>
+
+#define ATOMIC64_SYSCALL_HANDLER_TARGET_VALUE(name) \
+	static inline atomic64_val_t z_vrfy_##name(atomic64_t *target, \
+						   atomic64_val_t value) \
+	{								\
+		K_OOPS(K_SYSCALL_MEMORY_WRITE(target, sizeof(atomic64_t))); \
+		return z_impl_##name((atomic64_t *)target, value); \
+	}
+#else
+#define ATOMIC64_SYSCALL_HANDLER_TARGET_VALUE(name)
+#endif /* CONFIG_USERSPACE */
+
+bool z_impl_atomic64_cas(atomic64_t *target, atomic64_val_t old_value,
+			 atomic64_val_t new_value)
+{
+	k_spinlock_key_t key = k_spin_lock(lock_get(target));
+	bool ret = false;
+
+	if (*target == old_value) {
+		*target = new_value;
+		ret = true;
+	}
+
+	k_spin_unlock(lock_get(target), key);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline bool z_vrfy_atomic64_cas(atomic64_t *target, atomic64_val_t old_value,
+				       atomic64_val_t new_value)
+{
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(target, sizeof(atomic64_t)));
+
+	return z_impl_atomic64_cas(target, old_value, new_value);
+}
+#include <zephyr/syscalls/atomic64_cas_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+atomic64_val_t z_impl_atomic64_get(const atomic64_t *target)
+{
+	k_spinlock_key_t key = k_spin_lock(lock_get(target));
+	atomic64_val_t ret = *target;
+
+	k_spin_unlock(lock_get(target), key);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline atomic64_val_t z_vrfy_atomic64_get(const atomic64_t *target)
+{
+	K_OOPS(K_SYSCALL_MEMORY_READ(target, sizeof(atomic64_t)));
+
+	return z_impl_atomic64_get(target);
+}
+#include <zephyr/syscalls/atomic64_get_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#define ATOMIC64_OP(name, expr)							\
+	atomic64_val_t z_impl_atomic64_##name(atomic64_t *target,		\
+					      atomic64_val_t value)		\
+	{									\
+		k_spinlock_key_t key = k_spin_lock(lock_get(target));		\
+		atomic64_val_t ret = *target;					\
+										\
+		*target = (expr);						\
+		k_spin_unlock(lock_get(target), key);				\
+										\
+		return ret;							\
+	}									\
+	ATOMIC64_SYSCALL_HANDLER_TARGET_VALUE(atomic64_##name)
+
+ATOMIC64_OP(set, value);
+ATOMIC64_OP(add, (atomic64_val_t)((uint64_t)ret + (uint64_t)value));
+ATOMIC64_OP(sub, (atomic64_val_t)((uint64_t)ret - (uint64_t)value));
+ATOMIC64_OP(or, ret | value);
+ATOMIC64_OP(xor, ret ^ value);
+ATOMIC64_OP(and, ret & value);
+
+#ifdef CONFIG_USERSPACE
+#include <zephyr/syscalls/atomic64_set_mrsh.c>
+#include <zephyr/syscalls/atomic64_add_mrsh.c>
+#include <zephyr/syscalls/atomic64_sub_mrsh.c>
+#include <zephyr/syscalls/atomic64_or_mrsh.c>
+#include <zephyr/syscalls/atomic64_xor_mrsh.c>
+#include <zephyr/syscalls/atomic64_and_mrsh.c>
+#endif /* CONFIG_USERSPACE */
@@ -14,13 +14,25 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/pm/device_runtime.h>
+#include <zephyr/debug/boot_profile.h>
+
+#ifdef CONFIG_DEVICE_INIT_ASYNC
+#include <zephyr/kernel.h>
+#endif /* CONFIG_DEVICE_INIT_ASYNC */
 
 int do_device_init(const struct device *dev)
 {
 	int rc = 0;
 
 	if (dev->ops.init != NULL) {
+#ifdef CONFIG_BOOT_PROFILE
+		int profile = z_boot_profile_enter(BOOT_PROFILE_DEVICE, dev);
+
 		rc = dev->ops.init(dev);
+		z_boot_profile_exit(profile, rc);
+#else
+		rc = dev->ops.init(dev);
+#endif /* CONFIG_BOOT_PROFILE */
 		/* If initialization failed, record in dev->state->init_res
 		 * the POSITIVE value of the resulting errno
 		 */
@@ -66,6 +78,13 @@ int z_impl_device_init(const struct device *dev)
 		return -EALREADY;
 	}
 
+#ifdef CONFIG_DEVICE_INIT_ASYNC
+	/* Being initialized by the asynchronous init threads */
+	if (dev->state->init_pending) {
+		return -EALREADY;
+	}
+#endif /* CONFIG_DEVICE_INIT_ASYNC */
+
 	return do_device_init(dev);
 }
 
@@ -275,3 +294,146 @@ int device_supported_foreach(const struct device *dev,
 }
 
 #endif /* CONFIG_DEVICE_DEPS */
+
+#ifdef CONFIG_DEVICE_INIT_ASYNC
+
+/*
+ * Devices marked as zephyr,async-init are queued by the init levels running
+ * after the kernel is up, and initialized by a pool of threads once all the
+ * devices they require are done. The queue is the init_pending flag of the
+ * device states, scanned in init order, so that independent devices start
+ * in the order the init levels would have run them.
+ */
+
+static K_KERNEL_STACK_ARRAY_DEFINE(async_init_stacks, CONFIG_DEVICE_INIT_ASYNC_THREADS,
+				   CONFIG_DEVICE_INIT_ASYNC_STACK_SIZE);
+static struct k_thread async_init_threads[CONFIG_DEVICE_INIT_ASYNC_THREADS];
+
+static K_MUTEX_DEFINE(async_init_lock);
+static K_CONDVAR_DEFINE(async_init_cond);
+static bool async_init_started;
+static bool async_init_closed;
+
+static int async_init_pending_cb(const struct device *dev, void *context)
+{
+	ARG_UNUSED(context);
+
+	/* Stops the iteration at the first required device not done yet */
+	return dev->state->init_pending ? -EBUSY : 0;
+}
+
+static bool async_init_deps_done(const struct device *dev)
+{
+	return device_required_foreach(dev, async_init_pending_cb, NULL) >= 0;
+}
+
+/* Returns the first queued device that can be initialized, or NULL */
+static const struct device *async_init_next(bool *queued)
+{
+	*queued = false;
+
+	STRUCT_SECTION_FOREACH(device, dev) {
+		if (!dev->state->init_pending || dev->state->init_running) {
+			continue;
+		}
+
+		*queued = true;
+
+		if (async_init_deps_done(dev)) {
+			return dev;
+		}
+	}
+
+	return NULL;
+}
+
+static void async_init_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev;
+	bool queued;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&async_init_lock, K_FOREVER);
+
+	while (true) {
+		dev = async_init_next(&queued);
+		if (dev == NULL) {
+			if (async_init_closed && !queued) {
+				break;
+			}
+
+			k_condvar_wait(&async_init_cond, &async_init_lock, K_FOREVER);
+			continue;
+		}
+
+		dev->state->init_running = true;
+		k_mutex_unlock(&async_init_lock);
+
+		(void)do_device_init(dev);
+
+		k_mutex_lock(&async_init_lock, K_FOREVER);
+		dev->state->init_running = false;
+		dev->state->init_pending = false;
+
+		/* Wakes up the threads waiting for it, and the ones requiring it */
+		k_condvar_broadcast(&async_init_cond);
+	}
+
+	k_mutex_unlock(&async_init_lock);
+}
+
+void z_device_init_async(const struct device *dev)
+{
+	k_mutex_lock(&async_init_lock, K_FOREVER);
+
+	if (!async_init_started) {
+		for (int i = 0; i < CONFIG_DEVICE_INIT_ASYNC_THREADS; i++) {
+			k_thread_create(&async_init_threads[i], async_init_stacks[i],
+					K_KERNEL_STACK_SIZEOF(async_init_stacks[i]),
+					async_init_thread, NULL, NULL, NULL,
+					CONFIG_DEVICE_INIT_ASYNC_PRIORITY, 0, K_NO_WAIT);
+			k_thread_name_set(&async_init_threads[i], "device_init");
+		}
+
+		async_init_started = true;
+	}
+
+	dev->state->init_pending = true;
+
+	/* Threads waiting for required devices share the condition variable */
+	k_condvar_broadcast(&async_init_cond);
+
+	k_mutex_unlock(&async_init_lock);
+}
+
+void z_device_init_async_wait(const struct device *dev)
+{
+	/* Nothing was queued, skip walking the dependencies */
+	if (!async_init_started) {
+		return;
+	}
+
+	k_mutex_lock(&async_init_lock, K_FOREVER);
+
+	while (!async_init_deps_done(dev)) {
+		k_condvar_wait(&async_init_cond, &async_init_lock, K_FOREVER);
+	}
+
+	k_mutex_unlock(&async_init_lock);
+}
+
+void z_device_init_async_close(void)
+{
+	k_mutex_lock(&async_init_lock, K_FOREVER);
+
+	/* The threads exit once the queue is empty */
+	async_init_closed = true;
+	k_condvar_broadcast(&async_init_cond);
+
+	k_mutex_unlock(&async_init_lock);
+}
+
+#endif /* CONFIG_DEVICE_INIT_ASYNC */
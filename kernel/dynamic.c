@@ -14,6 +14,8 @@
 #include <zephyr/sys/kobject.h>
 #include <zephyr/internal/syscall_handler.h>
 
+#include <string.h>
+
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 #if CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0
@@ -31,6 +33,42 @@ static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack, CONFIG_DYNAMIC_THREAD_POOL_SIZ
 				   K_THREAD_STACK_LEN(CONFIG_DYNAMIC_THREAD_STACK_SIZE));
 SYS_BITARRAY_DEFINE_STATIC(dynamic_ba, BA_SIZE);
 
+#ifdef CONFIG_DYNAMIC_THREAD_POOL_REPAINT
+/* Pool stacks that hold the unused stack pattern over their whole buffer */
+static ATOMIC_DEFINE(dynamic_painted, BA_SIZE);
+
+static void z_thread_stack_repaint_pool(k_thread_stack_t *stack, size_t offset)
+{
+	uint8_t *buf = (uint8_t *)K_THREAD_STACK_BUFFER(stack);
+	size_t size = K_THREAD_STACK_SIZEOF(dynamic_stack[0]);
+	size_t clean = 0;
+
+	if (IS_ENABLED(CONFIG_STACK_SENTINEL)) {
+		/* Rewritten by the thread creation anyway */
+		clean = 4;
+	}
+
+	/* The stack grows down: a thread only dirties the buffer above the
+	 * lowest address it reached, so only that part needs a new fill.
+	 */
+	while ((clean < size) && (buf[clean] == 0xaaU)) {
+		clean++;
+	}
+
+	memset(&buf[clean], 0xaa, size - clean);
+	atomic_set_bit(dynamic_painted, offset);
+}
+
+bool z_thread_stack_is_painted(k_thread_stack_t *stack)
+{
+	if (!IS_ARRAY_ELEMENT(dynamic_stack, stack)) {
+		return false;
+	}
+
+	return atomic_test_and_clear_bit(dynamic_painted, ARRAY_INDEX(dynamic_stack, stack));
+}
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_REPAINT */
+
 static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size, int flags)
 {
 	int rv;
@@ -130,6 +168,9 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 
 	if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
 		if (IS_ARRAY_ELEMENT(dynamic_stack, stack)) {
+#ifdef CONFIG_DYNAMIC_THREAD_POOL_REPAINT
+			z_thread_stack_repaint_pool(stack, ARRAY_INDEX(dynamic_stack, stack));
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_REPAINT */
 			if (sys_bitarray_free(&dynamic_ba, 1, ARRAY_INDEX(dynamic_stack, stack))) {
 				LOG_ERR("stack %p is not allocated!", stack);
 				return -EINVAL;
@@ -47,6 +47,7 @@ struct event_walk_data {
 #endif /* CONFIG_WAITQ_SCALABLE */
 	uint32_t events;
 	uint32_t clear_events;
+	uint32_t wait_mask;
 };
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -58,6 +59,7 @@ void z_impl_k_event_init(struct k_event *event)
 	__ASSERT_NO_MSG(!arch_is_in_isr());
 
 	event->events = 0;
+	event->wait_mask = 0;
 	event->lock = (struct k_spinlock) {};
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
@@ -170,6 +172,8 @@ static int event_walk_op(struct k_thread *thread, void *data)
 		thread->next_event_link = event_data->head;
 		event_data->head = thread;
 #endif /* !CONFIG_WAITQ_SCALABLE */
+	} else {
+		event_data->wait_mask |= thread->events;
 	}
 
 	return 0;
@@ -191,6 +195,21 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
 
+	/*
+	 * The wait conditions of the pended threads were not met by the
+	 * current events, so only the newly set ones can meet them. Skip the
+	 * walk when none of these is waited for.
+	 */
+	if ((events & ~event->events & event->wait_mask) == 0) {
+		event->events = events;
+		k_spin_unlock(&event->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, post, event, events,
+					       events_mask);
+
+		return previous_events;
+	}
+
 	/*
 	 * Posting an event has the potential to wake multiple pended threads.
 	 * It is desirable to unpend all affected threads simultaneously. When
@@ -208,11 +227,15 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 #endif /* CONFIG_WAITQ_SCALABLE */
 	data.events = events;
 	data.clear_events = 0;
+	data.wait_mask = 0;
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, EVENT_POST_WALK_OP_FN, &data);
 
 	/* stash any events not consumed */
 	event->events = data.events & ~data.clear_events;
 
+	/* events still waited for, by the threads left pended */
+	event->wait_mask = data.wait_mask;
+
 	z_reschedule(&event->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, post, event, events,
@@ -330,6 +353,7 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 
 	thread->events = events;
 	thread->event_options = options;
+	event->wait_mask |= events;
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
@@ -7,6 +7,8 @@
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <kernel_arch_interface.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
 
 int z_impl_k_float_disable(struct k_thread *thread)
 {
@@ -29,6 +31,52 @@ int z_impl_k_float_enable(struct k_thread *thread, unsigned int options)
 #endif /* CONFIG_FPU && CONFIG_FPU_SHARING */
 }
 
+#if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING) && \
+	defined(CONFIG_ARCH_HAS_LAZY_FPU_SHARING) && defined(CONFIG_SMP)
+void z_float_flush_owned(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int i;
+
+	/* search all CPUs for the owner we want */
+	for (i = 0; i < num_cpus; i++) {
+		if (atomic_ptr_get(&_kernel.cpus[i].arch.fpu_owner) != thread) {
+			continue;
+		}
+
+		/* we found it live on CPU i */
+		if (i == _current_cpu->id) {
+			arch_flush_local_fpu();
+			break;
+		}
+
+		/* the FPU context is live on another CPU */
+		arch_flush_fpu_ipi(i);
+
+		/*
+		 * Wait for it only if this is about the thread
+		 * currently running on this CPU. Otherwise the
+		 * other CPU running some other thread could regain
+		 * ownership the moment it is removed from it and
+		 * we would be stuck here.
+		 *
+		 * Also, if this is for the thread running on this
+		 * CPU, then we preemptively flush any live context
+		 * on this CPU as well since we're likely to
+		 * replace it, and this avoids a deadlock where
+		 * two CPUs want to pull each other's FPU context.
+		 */
+		if (thread == _current) {
+			arch_flush_local_fpu();
+			while (atomic_ptr_get(&_kernel.cpus[i].arch.fpu_owner) == thread) {
+				barrier_dsync_fence_full();
+			}
+		}
+		break;
+	}
+}
+#endif /* CONFIG_FPU && CONFIG_FPU_SHARING && CONFIG_ARCH_HAS_LAZY_FPU_SHARING && CONFIG_SMP */
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_float_disable(struct k_thread *thread)
 {
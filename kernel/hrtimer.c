@@ -0,0 +1,128 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/hrtimer.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/dlist.h>
+
+/* Running timers, sorted by expiry */
+static sys_dlist_t hrtimer_list = SYS_DLIST_STATIC_INIT(&hrtimer_list);
+static struct k_spinlock hrtimer_lock;
+
+static struct k_hrtimer *first(void)
+{
+	sys_dnode_t *node = sys_dlist_peek_head(&hrtimer_list);
+
+	return (node == NULL) ? NULL : CONTAINER_OF(node, struct k_hrtimer, node);
+}
+
+/* Returns true if the timer is the new head of the list */
+static bool add(struct k_hrtimer *timer)
+{
+	struct k_hrtimer *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&hrtimer_list, t, node) {
+		if (timer->expiry < t->expiry) {
+			sys_dlist_insert(&t->node, &timer->node);
+			return first() == timer;
+		}
+	}
+
+	sys_dlist_append(&hrtimer_list, &timer->node);
+
+	return first() == timer;
+}
+
+static void program_next(void)
+{
+	struct k_hrtimer *next = first();
+
+	sys_clock_hrtimer_set((next == NULL) ? UINT64_MAX : next->expiry);
+}
+
+void k_hrtimer_init(struct k_hrtimer *timer, k_hrtimer_handler_t handler)
+{
+	__ASSERT_NO_MSG(handler != NULL);
+
+	sys_dnode_init(&timer->node);
+	timer->expiry = 0;
+	timer->period = 0;
+	timer->handler = handler;
+}
+
+void k_hrtimer_start(struct k_hrtimer *timer, uint64_t expiry, uint64_t period)
+{
+	K_SPINLOCK(&hrtimer_lock) {
+		bool was_first = (first() == timer);
+
+		if (sys_dnode_is_linked(&timer->node)) {
+			sys_dlist_remove(&timer->node);
+		}
+
+		timer->expiry = expiry;
+		timer->period = period;
+
+		if (add(timer) || was_first) {
+			program_next();
+		}
+	}
+}
+
+void k_hrtimer_stop(struct k_hrtimer *timer)
+{
+	K_SPINLOCK(&hrtimer_lock) {
+		if (!sys_dnode_is_linked(&timer->node)) {
+			K_SPINLOCK_BREAK;
+		}
+
+		bool was_first = (first() == timer);
+
+		sys_dlist_remove(&timer->node);
+		timer->expiry = 0;
+
+		if (was_first) {
+			program_next();
+		}
+	}
+}
+
+uint64_t k_hrtimer_expiry_get(const struct k_hrtimer *timer)
+{
+	uint64_t expiry = 0;
+
+	K_SPINLOCK(&hrtimer_lock) {
+		if (sys_dnode_is_linked(&timer->node)) {
+			expiry = timer->expiry;
+		}
+	}
+
+	return expiry;
+}
+
+void sys_clock_hrtimer_announce(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&hrtimer_lock);
+	struct k_hrtimer *timer;
+
+	for (timer = first(); timer != NULL && timer->expiry <= k_cycle_get_64();
+	     timer = first()) {
+		sys_dlist_remove(&timer->node);
+
+		if (timer->period != 0) {
+			timer->expiry += timer->period;
+			(void)add(timer);
+		}
+
+		k_spin_unlock(&hrtimer_lock, key);
+		timer->handler(timer);
+		key = k_spin_lock(&hrtimer_lock);
+	}
+
+	program_next();
+	k_spin_unlock(&hrtimer_lock, key);
+}
@@ -29,5 +29,15 @@ atomic_val_t ipi_mask_create(struct k_thread *thread);
 #define signal_pending_ipi() do { } while (false)
 #endif /* CONFIG_SMP */
 
+#ifdef CONFIG_IPI_COALESCE
+/* The current CPU is picking its next thread: it needs IPIs again after this */
+static ALWAYS_INLINE void ipi_in_flight_clear(void)
+{
+	atomic_clear_bit(&_kernel.ipi_in_flight, _current_cpu->id);
+}
+#else
+#define ipi_in_flight_clear() do { } while (false)
+#endif /* CONFIG_IPI_COALESCE */
+
 
 #endif /* ZEPHYR_KERNEL_INCLUDE_IPI_H_ */
@@ -219,6 +219,45 @@ int arch_float_disable(struct k_thread *thread);
  * @retval -ENOTSUP If the operation is not supported
  */
 int arch_float_enable(struct k_thread *thread, unsigned int options);
+
+#if defined(CONFIG_ARCH_HAS_LAZY_FPU_SHARING) || defined(__DOXYGEN__)
+/**
+ * @brief Flush the FPU context live on the current CPU
+ *
+ * Save the content of the FPU registers to the thread owning them on the
+ * current CPU, if any, release the ownership and deny further FPU access.
+ * Must be called with interrupts locked.
+ */
+void arch_flush_local_fpu(void);
+
+/**
+ * @brief Ask another CPU to flush its live FPU context
+ *
+ * Signal @a cpu so that it calls arch_flush_local_fpu() from interrupt
+ * context. This does not wait for the flush to happen.
+ *
+ * @param cpu Index of the CPU to signal
+ */
+void arch_flush_fpu_ipi(unsigned int cpu);
+
+#if defined(CONFIG_SMP) || defined(__DOXYGEN__)
+/**
+ * @brief Make sure a thread's FPU context is not live on any CPU
+ *
+ * Search all CPUs for the one owning @a thread's FPU context and flush it,
+ * locally or through arch_flush_fpu_ipi(). The remote flush is only waited
+ * for when @a thread is the current thread, which then also gives up the
+ * context live on the current CPU to prevent two CPUs from waiting on each
+ * other. Must be called with interrupts locked.
+ *
+ * This is implemented by the kernel for architectures selecting
+ * CONFIG_ARCH_HAS_LAZY_FPU_SHARING.
+ *
+ * @param thread Thread whose FPU context is to be flushed
+ */
+void z_float_flush_owned(struct k_thread *thread);
+#endif /* CONFIG_SMP */
+#endif /* CONFIG_ARCH_HAS_LAZY_FPU_SHARING */
 #endif /* CONFIG_FPU && CONFIG_FPU_SHARING */
 
 /**
@@ -44,6 +44,27 @@ extern char *z_setup_new_thread(struct k_thread *new_thread,
 				void *p1, void *p2, void *p3,
 				int prio, uint32_t options, const char *name);
 
+#ifdef CONFIG_DYNAMIC_THREAD_POOL_REPAINT
+/**
+ * @brief Check whether a stack buffer already holds the unused stack pattern
+ *
+ * True for a pool stack that was repainted when last freed, in which case
+ * thread creation does not need to fill it again. Consumes the state, as
+ * the new thread dirties the stack.
+ *
+ * @param stack Stack object
+ * @return true if the stack buffer is already painted
+ */
+bool z_thread_stack_is_painted(k_thread_stack_t *stack);
+#else
+static inline bool z_thread_stack_is_painted(k_thread_stack_t *stack)
+{
+	ARG_UNUSED(stack);
+
+	return false;
+}
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_REPAINT */
+
 /**
  * @brief Allocate aligned memory from the current thread's resource pool
  *
@@ -98,6 +119,9 @@ z_thread_return_value_set_with_data(struct k_thread *thread,
 
 #ifdef CONFIG_SMP
 extern void z_smp_init(void);
+#ifdef CONFIG_CPU_ID_IN_TLS
+extern void z_smp_tls_init(void);
+#endif /* CONFIG_CPU_ID_IN_TLS */
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 extern void smp_timer_init(void);
 #endif /* CONFIG_SYS_CLOCK_EXISTS */
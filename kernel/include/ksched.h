@@ -73,6 +73,7 @@ void z_ready_thread(struct k_thread *thread);
 void z_requeue_current(struct k_thread *curr);
 struct k_thread *z_swap_next_thread(void);
 void move_current_to_end_of_prio_q(void);
+bool z_thread_is_active_elsewhere(struct k_thread *thread);
 
 static inline void z_reschedule_unlocked(void)
 {
@@ -352,6 +353,24 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || defined(CONFIG_CPU_FREQ_POLICY_UTIL)
+/**
+ * @brief Mark the start of a thread's ready window
+ *
+ * Called with the scheduler lock held whenever @a thread is added to
+ * the run queue. @a ipi is true when an IPI was flagged to get the
+ * thread running on another CPU. Also passes the utilization of the
+ * thread on to the CPU frequency policy.
+ */
+void z_sched_usage_ready(struct k_thread *thread, bool ipi);
+#else
+static inline void z_sched_usage_ready(struct k_thread *thread, bool ipi)
+{
+	ARG_UNUSED(thread);
+	ARG_UNUSED(ipi);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY || CONFIG_CPU_FREQ_POLICY_UTIL */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
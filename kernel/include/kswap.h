@@ -11,6 +11,21 @@
 #include <zephyr/sys/barrier.h>
 #include <kernel_arch_func.h>
 
+#ifdef CONFIG_CPU_ID_IN_TLS
+extern uintptr_t z_tls_cpu_id_offset;
+
+/* Publish the CPU the thread runs on to its copy of z_tls_cpu_id. The
+ * offset is 0 until known, as no thread local variable can be at the
+ * thread pointer itself.
+ */
+static ALWAYS_INLINE void z_tls_cpu_id_set(struct k_thread *thread, uint8_t cpu_id)
+{
+	if (z_tls_cpu_id_offset != 0) {
+		*(uint8_t *)(thread->tls + z_tls_cpu_id_offset) = cpu_id;
+	}
+}
+#endif /* CONFIG_CPU_ID_IN_TLS */
+
 #ifdef CONFIG_STACK_SENTINEL
 extern void z_check_stack_sentinel(void);
 #else
@@ -125,6 +140,9 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 #ifdef CONFIG_SMP
 		new_thread->base.cpu = arch_curr_cpu()->id;
+#ifdef CONFIG_CPU_ID_IN_TLS
+		z_tls_cpu_id_set(new_thread, new_thread->base.cpu);
+#endif /* CONFIG_CPU_ID_IN_TLS */
 
 		if (!is_spinlock) {
 			z_smp_release_global_lock(new_thread);
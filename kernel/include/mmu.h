@@ -158,6 +158,12 @@
  */
 #define K_MEM_PAGE_FRAME_BACKED		BIT(5)
 
+/**
+ * This page frame was paged in ahead of any access to it, and has not
+ * been seen accessed yet
+ */
+#define K_MEM_PAGE_FRAME_PREFETCHED	BIT(6)
+
 /**
  * Data structure for physical page frames
  *
@@ -220,6 +226,11 @@ static inline bool k_mem_page_frame_is_backed(struct k_mem_page_frame *pf)
 	return (pf->va_and_flags & K_MEM_PAGE_FRAME_BACKED) != 0U;
 }
 
+static inline bool k_mem_page_frame_is_prefetched(struct k_mem_page_frame *pf)
+{
+	return (pf->va_and_flags & K_MEM_PAGE_FRAME_PREFETCHED) != 0U;
+}
+
 static inline bool k_mem_page_frame_is_evictable(struct k_mem_page_frame *pf)
 {
 	return (!k_mem_page_frame_is_free(pf) &&
@@ -406,6 +417,26 @@ int k_mem_page_frame_evict(uintptr_t phys);
  */
 bool k_mem_page_fault(void *addr);
 
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+/**
+ * Account for the use of a prefetched page frame
+ *
+ * Eviction algorithms call this with the arch_page_info_get() flags of a
+ * page frame before they clear its accessed flag, so that prefetched pages
+ * used before being evicted are counted as prefetch hits.
+ *
+ * @param pf Page frame
+ * @param flags ARCH_DATA_PAGE_* flags of the data page in the page frame
+ */
+void k_mem_paging_prefetch_check(struct k_mem_page_frame *pf, uintptr_t flags);
+#else
+static inline void k_mem_paging_prefetch_check(struct k_mem_page_frame *pf, uintptr_t flags)
+{
+	ARG_UNUSED(pf);
+	ARG_UNUSED(flags);
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
+
 #endif /* CONFIG_DEMAND_PAGING */
 #endif /* CONFIG_MMU */
 #endif /* KERNEL_INCLUDE_MMU_H */
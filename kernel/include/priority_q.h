@@ -35,6 +35,13 @@
 #define _priq_run_remove	z_priq_mq_remove
 #define _priq_run_yield         z_priq_mq_yield
 #define _priq_run_best		z_priq_mq_best
+ /* Bitmap Indexed Scheduling */
+#elif defined(CONFIG_SCHED_BITMAP)
+#define _priq_run_init		z_priq_bm_init
+#define _priq_run_add		z_priq_bm_add
+#define _priq_run_remove	z_priq_bm_remove
+#define _priq_run_yield         z_priq_bm_yield
+#define _priq_run_best		z_priq_bm_best
 #endif
 
 /* Scalable Wait Queue */
@@ -348,6 +355,105 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 
 	return NULL;
 }
+
+#if defined(CONFIG_SCHED_BITMAP)
+BUILD_ASSERT(PRIQ_BITMAP_SIZE <= NBITS,
+	     "too many thread priorities for a two-level bitmap");
+
+static ALWAYS_INLINE void z_priq_bm_init(struct _priq_bm *pq)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pq->queues); i++) {
+		sys_dlist_init(&pq->queues[i]);
+	}
+
+	pq->summary = 0;
+	for (size_t i = 0; i < ARRAY_SIZE(pq->bitmask); i++) {
+		pq->bitmask[i] = 0;
+	}
+}
+
+/* Insert a thread into its priority list.  Threads are kept in FIFO
+ * order, except that with deadline scheduling earlier deadlines sort
+ * ahead.  The scan starts from the tail, so threads that share a
+ * deadline (including all threads that never set one) are appended
+ * in constant time.
+ */
+static ALWAYS_INLINE void z_priq_bm_insert(sys_dlist_t *list,
+					   struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_DEADLINE
+	sys_dnode_t *n = sys_dlist_peek_tail(list);
+
+	while ((n != NULL) &&
+	       (z_sched_prio_cmp(thread, CONTAINER_OF(n, struct k_thread,
+						       base.qnode_dlist)) > 0)) {
+		n = sys_dlist_peek_prev(list, n);
+	}
+
+	/* The thread goes right after n, or at the head if n is NULL */
+	if (n == NULL) {
+		sys_dlist_prepend(list, &thread->base.qnode_dlist);
+		return;
+	}
+
+	n = sys_dlist_peek_next(list, n);
+	if (n != NULL) {
+		sys_dlist_insert(n, &thread->base.qnode_dlist);
+		return;
+	}
+#endif /* CONFIG_SCHED_DEADLINE */
+
+	sys_dlist_append(list, &thread->base.qnode_dlist);
+}
+
+static ALWAYS_INLINE void z_priq_bm_add(struct _priq_bm *pq,
+					struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+
+	z_priq_bm_insert(&pq->queues[pos.offset_prio], thread);
+	pq->bitmask[pos.idx] |= BIT(pos.bit);
+	pq->summary |= BIT(pos.idx);
+}
+
+static ALWAYS_INLINE void z_priq_bm_remove(struct _priq_bm *pq,
+					   struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+
+	sys_dlist_dequeue(&thread->base.qnode_dlist);
+	if (unlikely(sys_dlist_is_empty(&pq->queues[pos.offset_prio]))) {
+		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+		if (pq->bitmask[pos.idx] == 0) {
+			pq->summary &= ~BIT(pos.idx);
+		}
+	}
+}
+
+static ALWAYS_INLINE void z_priq_bm_yield(struct _priq_bm *pq)
+{
+#ifndef CONFIG_SMP
+	struct prio_info pos = get_prio_info(_current->base.prio);
+
+	sys_dlist_dequeue(&_current->base.qnode_dlist);
+	z_priq_bm_insert(&pq->queues[pos.offset_prio], _current);
+#endif
+}
+
+static ALWAYS_INLINE struct k_thread *z_priq_bm_best(struct _priq_bm *pq)
+{
+	if (unlikely(pq->summary == 0)) {
+		return NULL;
+	}
+
+	unsigned int idx = TRAILING_ZEROS(pq->summary);
+	unsigned int index = idx * NBITS + TRAILING_ZEROS(pq->bitmask[idx]);
+	sys_dnode_t *n = sys_dlist_peek_head(&pq->queues[index]);
+
+	return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+}
+#endif /* CONFIG_SCHED_BITMAP */
+
 #ifdef IAR_SUPPRESS_ALWAYS_INLINE_WARNING_FLAG
 TOOLCHAIN_ENABLE_WARNING(TOOLCHAIN_WARNING_ALWAYS_INLINE)
 #endif
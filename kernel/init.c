@@ -40,6 +40,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/arch/common/init.h>
+#include <zephyr/debug/boot_profile.h>
 
 LOG_MODULE_REGISTER(os, CONFIG_KERNEL_LOG_LEVEL);
 
@@ -192,6 +193,11 @@ bool z_sys_post_kernel;
 
 /* defined in device.c */
 extern int do_device_init(const struct device *dev);
+#ifdef CONFIG_DEVICE_INIT_ASYNC
+extern void z_device_init_async(const struct device *dev);
+extern void z_device_init_async_wait(const struct device *dev);
+extern void z_device_init_async_close(void);
+#endif /* CONFIG_DEVICE_INIT_ASYNC */
 
 /**
  * @brief Initialize state for all static devices.
@@ -206,6 +212,31 @@ static void z_device_state_init(void)
 	}
 }
 
+/**
+ * @brief Initialize a device from a given init level
+ *
+ * Once the kernel is up, devices marked for asynchronous initialization are
+ * handed over to the init threads, and the other ones first wait for the
+ * devices they require to be done.
+ */
+static int z_device_init_level(const struct device *dev, enum init_level level)
+{
+#ifdef CONFIG_DEVICE_INIT_ASYNC
+	if (level >= INIT_LEVEL_POST_KERNEL) {
+		if ((dev->flags & DEVICE_FLAG_INIT_ASYNC) != 0U) {
+			z_device_init_async(dev);
+			return 0;
+		}
+
+		z_device_init_async_wait(dev);
+	}
+#else
+	ARG_UNUSED(level);
+#endif /* CONFIG_DEVICE_INIT_ASYNC */
+
+	return do_device_init(dev);
+}
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -233,20 +264,36 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
+#ifdef CONFIG_BOOT_PROFILE
+	z_boot_profile_level(level);
+#endif /* CONFIG_BOOT_PROFILE */
+
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
 		const struct device *dev = entry->dev;
 		int result = 0;
 
 		sys_trace_sys_init_enter(entry, level);
 		if (dev != NULL) {
+			/* Devices are profiled by do_device_init() */
 			if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
-				result = do_device_init(dev);
+				result = z_device_init_level(dev, level);
 			}
 		} else {
+#ifdef CONFIG_BOOT_PROFILE
+			int profile = z_boot_profile_enter(BOOT_PROFILE_SYS_INIT, entry->init_fn);
+
 			result = entry->init_fn();
+			z_boot_profile_exit(profile, result);
+#else
+			result = entry->init_fn();
+#endif /* CONFIG_BOOT_PROFILE */
 		}
 		sys_trace_sys_init_exit(entry, level, result);
 	}
+
+#ifdef CONFIG_BOOT_PROFILE
+	z_boot_profile_level(BOOT_PROFILE_LEVEL_NONE);
+#endif /* CONFIG_BOOT_PROFILE */
 }
 
 /* defined in banner.c */
@@ -296,6 +343,14 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 #endif /* CONFIG_MMU */
 	z_sys_post_kernel = true;
 
+#ifdef CONFIG_CPU_ID_IN_TLS
+	z_smp_tls_init();
+#endif /* CONFIG_CPU_ID_IN_TLS */
+
+#ifdef CONFIG_BOOT_PROFILE
+	boot_profile_mark("main thread");
+#endif /* CONFIG_BOOT_PROFILE */
+
 #if CONFIG_IRQ_OFFLOAD
 	arch_irq_offload_init();
 #endif
@@ -326,14 +381,26 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 #ifdef CONFIG_SMP
 	if (!IS_ENABLED(CONFIG_SMP_BOOT_DELAY)) {
 		z_smp_init();
+#ifdef CONFIG_BOOT_PROFILE
+		boot_profile_mark("smp");
+#endif /* CONFIG_BOOT_PROFILE */
 	}
 	z_sys_init_run_level(INIT_LEVEL_SMP);
 #endif /* CONFIG_SMP */
 
+#ifdef CONFIG_DEVICE_INIT_ASYNC
+	/* No more devices to queue, let the init threads exit when done */
+	z_device_init_async_close();
+#endif /* CONFIG_DEVICE_INIT_ASYNC */
+
 #ifdef CONFIG_MMU
 	z_mem_manage_boot_finish();
 #endif /* CONFIG_MMU */
 
+#ifdef CONFIG_BOOT_PROFILE
+	boot_profile_mark("main");
+#endif /* CONFIG_BOOT_PROFILE */
+
 #ifdef CONFIG_BOOTARGS
 	extern int main(int, char **);
 	extern char **prepare_main_args(int *argc);
@@ -540,6 +607,10 @@ FUNC_NORETURN void z_cstart(void)
 	/* gcov hook needed to get the coverage report.*/
 	gcov_static_init();
 
+#ifdef CONFIG_BOOT_PROFILE
+	z_boot_profile_start();
+#endif /* CONFIG_BOOT_PROFILE */
+
 	/* initialize early init calls */
 	z_sys_init_run_level(INIT_LEVEL_EARLY);
 
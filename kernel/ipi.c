@@ -69,6 +69,27 @@ atomic_val_t ipi_mask_create(struct k_thread *thread)
 	return (atomic_val_t)ipi_mask;
 }
 
+#ifdef CONFIG_IPI_COALESCE
+/*
+ * Drop the CPUs that still have an IPI in flight from <cpu_bitmap>: they pick
+ * their next thread when handling it, from a run queue that already contains
+ * the threads flagged since. The current CPU is never marked, as not all the
+ * architectures deliver IPIs to the CPU sending them.
+ */
+static uint32_t ipi_coalesce(uint32_t cpu_bitmap)
+{
+	unsigned int key = arch_irq_lock();
+	uint32_t self = BIT(_current_cpu->id);
+	uint32_t in_flight;
+
+	in_flight = (uint32_t)atomic_or(&_kernel.ipi_in_flight,
+					(atomic_val_t)(cpu_bitmap & ~self));
+	arch_irq_unlock(key);
+
+	return cpu_bitmap & ~in_flight;
+}
+#endif /* CONFIG_IPI_COALESCE */
+
 void signal_pending_ipi(void)
 {
 	/* Synchronization note: you might think we need to lock these
@@ -84,6 +105,9 @@ void signal_pending_ipi(void)
 		uint32_t  cpu_bitmap;
 
 		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+#ifdef CONFIG_IPI_COALESCE
+		cpu_bitmap = ipi_coalesce(cpu_bitmap);
+#endif
 		if (cpu_bitmap != 0) {
 #ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
 			arch_sched_directed_ipi(cpu_bitmap);
@@ -186,6 +210,12 @@ void z_sched_ipi(void)
 	/* NOTE: When adding code to this, make sure this is called
 	 * at appropriate location when !CONFIG_SCHED_IPI_SUPPORTED.
 	 */
+
+	/* Must precede the IPI work processing and the rescheduling on
+	 * the way out of the interrupt, which the senders rely on.
+	 */
+	ipi_in_flight_clear();
+
 #ifdef CONFIG_TRACE_SCHED_IPI
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
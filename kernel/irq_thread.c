@@ -0,0 +1,69 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/irq_thread.h>
+#include <ksched.h>
+#include <wait_q.h>
+
+static struct k_spinlock lock;
+
+void z_irq_thread_entry(void *p1, void *p2, void *p3)
+{
+	struct k_irq_thread *irq_thread = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		/* Checked with the lock held so that a wake-up can not be
+		 * missed between the check and the pend.
+		 */
+		if (atomic_clear(&irq_thread->pending) == 0) {
+			(void)z_pend_curr(&lock, key, &irq_thread->wait_q, K_FOREVER);
+			continue;
+		}
+
+		k_spin_unlock(&lock, key);
+
+		irq_thread->handler(irq_thread->arg);
+	}
+}
+
+k_tid_t k_irq_thread_create(struct k_irq_thread *irq_thread, struct k_thread *thread,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    k_irq_thread_handler_t handler, void *arg, int prio)
+{
+	__ASSERT_NO_MSG(handler != NULL);
+
+	z_waitq_init(&irq_thread->wait_q);
+	atomic_clear(&irq_thread->pending);
+	irq_thread->handler = handler;
+	irq_thread->arg = arg;
+
+	return k_thread_create(thread, stack, stack_size, z_irq_thread_entry, irq_thread,
+			       NULL, NULL, prio, 0, K_NO_WAIT);
+}
+
+void k_irq_thread_wake(struct k_irq_thread *irq_thread)
+{
+	/* Already pending: the thread has not run the handler yet, and will
+	 * see the new events when it does.
+	 */
+	if (atomic_set(&irq_thread->pending, 1) != 0) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (z_sched_wake(&irq_thread->wait_q, 0, NULL)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+}
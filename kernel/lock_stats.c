@@ -0,0 +1,104 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/lock_stats.h>
+#include <zephyr/sys/slist.h>
+
+static sys_slist_t stats_list = SYS_SLIST_STATIC_INIT(&stats_list);
+static struct k_spinlock stats_lock;
+
+static void stats_register(struct k_lock_stats *stats, const char *name)
+{
+	stats->name = name;
+
+	K_SPINLOCK(&stats_lock) {
+		sys_slist_append(&stats_list, &stats->node);
+	}
+}
+
+void k_spin_lock_stats_register(struct k_spinlock *l, struct k_lock_stats *stats,
+				const char *name)
+{
+	stats_register(stats, name);
+	l->stats = stats;
+}
+
+void k_mutex_stats_register(struct k_mutex *mutex, struct k_lock_stats *stats,
+			    const char *name)
+{
+	stats_register(stats, name);
+	mutex->stats = stats;
+}
+
+void k_sem_stats_register(struct k_sem *sem, struct k_lock_stats *stats, const char *name)
+{
+	stats_register(stats, name);
+	sem->stats = stats;
+}
+
+void k_lock_stats_foreach(k_lock_stats_cb_t cb, void *user_data)
+{
+	struct k_lock_stats *stats;
+
+	/* Locks are never unregistered, only the list walk needs protection. */
+	K_SPINLOCK(&stats_lock) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&stats_list, stats, node) {
+			cb(stats, user_data);
+		}
+	}
+}
+
+void k_lock_stats_reset(void)
+{
+	struct k_lock_stats *stats;
+
+	K_SPINLOCK(&stats_lock) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&stats_list, stats, node) {
+			stats->acquires = 0;
+			stats->contended = 0;
+			stats->wait_max = 0;
+			stats->hold_max = 0;
+			stats->wait_total = 0;
+			stats->hold_total = 0;
+		}
+	}
+}
+
+static uint32_t acquire_record(struct k_lock_stats *stats, uint32_t wait_start, bool contended)
+{
+	uint32_t now = sys_clock_cycle_get_32();
+	uint32_t wait = now - wait_start;
+
+	stats->acquires++;
+	stats->contended += contended ? 1U : 0U;
+	stats->wait_total += wait;
+	stats->wait_max = MAX(stats->wait_max, wait);
+
+	return now;
+}
+
+void z_lock_stats_acquired(struct k_lock_stats *stats, uint32_t wait_start, bool contended)
+{
+	stats->hold_start = acquire_record(stats, wait_start, contended);
+}
+
+void z_lock_stats_released(struct k_lock_stats *stats)
+{
+	uint32_t hold = sys_clock_cycle_get_32() - stats->hold_start;
+
+	stats->hold_total += hold;
+	stats->hold_max = MAX(stats->hold_max, hold);
+}
+
+void z_lock_stats_shared_acquired(struct k_lock_stats *stats, uint32_t wait_start,
+				  bool contended)
+{
+	/* Several threads may hold a semaphore at once. */
+	K_SPINLOCK(&stats_lock) {
+		(void)acquire_record(stats, wait_start, contended);
+	}
+}
@@ -18,6 +18,163 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+/* Number of blocks moved at once between a magazine and the free list */
+#define MAGAZINE_BATCH ((CONFIG_MEM_SLAB_MAGAZINE_SIZE + 1) / 2)
+
+/*
+ * Locking rules: a magazine lock may be taken before the slab lock, never
+ * after it. Only the stats code ever holds more than one magazine lock,
+ * always taking them in CPU order.
+ */
+
+static void magazine_refill(struct k_mem_slab *slab,
+			    struct k_mem_slab_magazine *mag)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while ((mag->count < MAGAZINE_BATCH) && (slab->free_list != NULL)) {
+		mag->blocks[mag->count++] = slab->free_list;
+		slab->free_list = *(char **)(slab->free_list);
+		slab->info.num_used++;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+static void magazine_flush(struct k_mem_slab *slab,
+			   struct k_mem_slab_magazine *mag, uint32_t keep)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while (mag->count > keep) {
+		char *block = mag->blocks[--mag->count];
+
+		*(char **)block = slab->free_list;
+		slab->free_list = block;
+		slab->info.num_used--;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+static bool magazine_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int irq = arch_irq_lock();
+	struct k_mem_slab_magazine *mag = &slab->magazines[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+	bool found;
+
+	/* Don't grab blocks from the free list while threads wait for them */
+	if ((mag->count == 0U) && (atomic_get(&slab->waiters) == 0)) {
+		magazine_refill(slab, mag);
+	}
+
+	found = (mag->count != 0U);
+	if (found) {
+		*mem = mag->blocks[--mag->count];
+	}
+
+	k_spin_unlock(&mag->lock, key);
+	arch_irq_unlock(irq);
+
+	return found;
+}
+
+static bool magazine_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int irq = arch_irq_lock();
+	struct k_mem_slab_magazine *mag = &slab->magazines[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+	bool cached = false;
+
+	/* Freed blocks must reach waiting threads through the free list */
+	if (atomic_get(&slab->waiters) == 0) {
+		if (mag->count == CONFIG_MEM_SLAB_MAGAZINE_SIZE) {
+			magazine_flush(slab, mag,
+				       CONFIG_MEM_SLAB_MAGAZINE_SIZE - MAGAZINE_BATCH);
+		}
+
+		mag->blocks[mag->count++] = mem;
+		cached = true;
+	}
+
+	k_spin_unlock(&mag->lock, key);
+	arch_irq_unlock(irq);
+
+	return cached;
+}
+
+/*
+ * Called when the local magazine ran dry: from now on frees bypass the
+ * magazines, and the blocks they hold are returned to the free list so
+ * that allocating from it only fails or waits if the slab is exhausted.
+ */
+static void magazine_waiter_begin(struct k_mem_slab *slab)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	atomic_inc(&slab->waiters);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_mem_slab_magazine *mag = &slab->magazines[i];
+		k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+		magazine_flush(slab, mag, 0U);
+		k_spin_unlock(&mag->lock, key);
+	}
+}
+
+static void magazine_waiter_end(struct k_mem_slab *slab)
+{
+	atomic_dec(&slab->waiters);
+}
+
+struct slab_stats_key {
+	k_spinlock_key_t key;
+	k_spinlock_key_t mag_keys[CONFIG_MP_MAX_NUM_CPUS];
+};
+
+static void slab_stats_lock(struct k_mem_slab *slab, struct slab_stats_key *k)
+{
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		k->mag_keys[i] = k_spin_lock(&slab->magazines[i].lock);
+	}
+
+	k->key = k_spin_lock(&slab->lock);
+}
+
+static void slab_stats_unlock(struct k_mem_slab *slab, struct slab_stats_key *k)
+{
+	k_spin_unlock(&slab->lock, k->key);
+
+	for (int i = CONFIG_MP_MAX_NUM_CPUS - 1; i >= 0; i--) {
+		k_spin_unlock(&slab->magazines[i].lock, k->mag_keys[i]);
+	}
+}
+#else
+#define magazine_alloc(slab, mem) false
+#define magazine_free(slab, mem) false
+#define magazine_waiter_begin(slab) do { } while (false)
+#define magazine_waiter_end(slab) do { } while (false)
+
+struct slab_stats_key {
+	k_spinlock_key_t key;
+};
+
+static inline void slab_stats_lock(struct k_mem_slab *slab,
+				   struct slab_stats_key *k)
+{
+	k->key = k_spin_lock(&slab->lock);
+}
+
+static inline void slab_stats_unlock(struct k_mem_slab *slab,
+				     struct slab_stats_key *k)
+{
+	k_spin_unlock(&slab->lock, k->key);
+}
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -28,12 +185,14 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
 
 	struct k_mem_slab *slab;
-	k_spinlock_key_t   key;
+	struct slab_stats_key key;
+	struct k_mem_slab_info *info = stats;
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
-	key = k_spin_lock(&slab->lock);
-	memcpy(stats, &slab->info, sizeof(slab->info));
-	k_spin_unlock(&slab->lock, key);
+	slab_stats_lock(slab, &key);
+	memcpy(info, &slab->info, sizeof(slab->info));
+	info->num_used = k_mem_slab_num_used_get(slab);
+	slab_stats_unlock(slab, &key);
 
 	return 0;
 }
@@ -43,20 +202,20 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
 
 	struct k_mem_slab *slab;
-	k_spinlock_key_t   key;
+	struct slab_stats_key key;
 	struct sys_memory_stats *ptr = stats;
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
-	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	slab_stats_lock(slab, &key);
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) *
+			       slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
 	ptr->max_allocated_bytes = 0;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
-	k_spin_unlock(&slab->lock, key);
+	slab_stats_unlock(slab, &key);
 
 	return 0;
 }
@@ -184,6 +343,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	atomic_clear(&slab->waiters);
+	(void)memset(slab->magazines, 0, sizeof(slab->magazines));
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -221,11 +385,21 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+	if (magazine_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+
+	magazine_waiter_begin(slab);
+
+	key = k_spin_lock(&slab->lock);
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
@@ -256,6 +430,8 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+		magazine_waiter_end(slab);
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
@@ -265,6 +441,8 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	k_spin_unlock(&slab->lock, key);
 
+	magazine_waiter_end(slab);
+
 	return result;
 }
 
@@ -276,9 +454,16 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	if (magazine_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
 	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
 		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
@@ -306,10 +491,13 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 		return -EINVAL;
 	}
 
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	struct slab_stats_key key;
+
+	slab_stats_lock(slab, &key);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) *
+				 slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
@@ -318,7 +506,7 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 	stats->max_allocated_bytes = 0;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
-	k_spin_unlock(&slab->lock, key);
+	slab_stats_unlock(slab, &key);
 
 	return 0;
 }
@@ -1346,6 +1346,13 @@ static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_pt
 	}
 
 	if (k_mem_page_frame_is_mapped(pf)) {
+		if (IS_ENABLED(CONFIG_DEMAND_PAGING_PREFETCH) &&
+		    k_mem_page_frame_is_prefetched(pf)) {
+			k_mem_paging_prefetch_check(pf,
+				arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false));
+			k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_PREFETCHED);
+		}
+
 		ret = k_mem_paging_backing_store_location_get(pf, location_ptr,
 							      page_fault);
 		if (ret != 0) {
@@ -1577,6 +1584,13 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+static inline void paging_stats_prefetch_inc(void)
+{
+#if defined(CONFIG_DEMAND_PAGING_STATS) && defined(CONFIG_DEMAND_PAGING_PREFETCH)
+	paging_stats.prefetch.pages++;
+#endif
+}
+
 static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 {
 	struct k_mem_page_frame *pf;
@@ -1611,6 +1625,89 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+void k_mem_paging_prefetch_check(struct k_mem_page_frame *pf, uintptr_t flags)
+{
+	if (!k_mem_page_frame_is_prefetched(pf) ||
+	    (flags & (ARCH_DATA_PAGE_ACCESSED | ARCH_DATA_PAGE_DIRTY)) == 0U) {
+		return;
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.prefetch.hits++;
+#endif
+	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_PREFETCHED);
+}
+
+/*
+ * Page in the data pages following the one that just faulted, as long as
+ * they are paged out too. Page frames are only taken from the free list or
+ * from clean evictions, so prefetching never writes to the backing store.
+ * Called with z_mm_lock held, which is dropped around the page-ins when
+ * CONFIG_DEMAND_PAGING_ALLOW_IRQ is enabled.
+ *
+ * The faulting page has not been accessed yet, nor have earlier prefetched
+ * ones, so prefetching stops rather than evicting any of them.
+ */
+static void do_prefetch_locked(void *fault_addr, struct k_mem_page_frame *fault_pf,
+			       k_spinlock_key_t *key)
+{
+	uint8_t *addr = (uint8_t *)ROUND_DOWN(POINTER_TO_UINT(fault_addr), CONFIG_MMU_PAGE_SIZE);
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_PREFETCH_PAGES; i++) {
+		struct k_mem_page_frame *pf;
+		uintptr_t page_in_location, page_out_location;
+		bool dirty = false;
+		int ret;
+
+		addr += CONFIG_MMU_PAGE_SIZE;
+		if ((uintptr_t)addr >= (uintptr_t)K_MEM_VIRT_RAM_END ||
+		    (uintptr_t)addr < (uintptr_t)K_MEM_VIRT_RAM_START) {
+			break;
+		}
+
+		if (arch_page_location_get(addr, &page_in_location) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			pf = do_eviction_select(&dirty);
+			if ((pf == NULL) || (pf == fault_pf) || dirty ||
+			    !k_mem_page_frame_is_backed(pf) || k_mem_page_frame_is_prefetched(pf)) {
+				break;
+			}
+
+			paging_stats_eviction_inc(_current, dirty);
+		}
+		ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
+		__ASSERT(ret == 0, "failed to prepare page frame");
+		__ASSERT(!dirty, "prefetch evicted a dirty page frame");
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key = k_spin_lock(&z_mm_lock);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
+		frame_mapped_set(pf, addr);
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PREFETCHED);
+
+		arch_mem_page_in(addr, k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
+			k_mem_paging_eviction_add(pf);
+		}
+
+		paging_stats_prefetch_inc();
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1752,6 +1849,11 @@ static bool do_page_fault(void *addr, bool pin)
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	if (!pin) {
+		do_prefetch_locked(addr, pf, &key);
+	}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -123,6 +123,63 @@ exit:
 	return ret;
 }
 
+static inline void advance_write_ptr(struct k_msgq *msgq)
+{
+	msgq->write_ptr += msgq->msg_size;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+}
+
+/*
+ * Account for a message just stored in the ring. A thread pended in
+ * k_msgq_peek_slot() (marked by a NULL swap_data) is handed the message in
+ * place instead of a copy.
+ */
+static bool msg_queued(struct k_msgq *msgq, struct k_thread *pending_thread)
+{
+	msgq->used_msgs++;
+
+	if (unlikely(pending_thread != NULL)) {
+		msgq->flags |= K_MSGQ_FLAG_PEEKED;
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		return true;
+	}
+
+	return handle_poll_events(msgq);
+}
+
+/*
+ * Give the slot at write_ptr to a thread pended waiting for room: copy the
+ * message of a k_msgq_put() caller, or reserve the slot for a
+ * k_msgq_reserve() caller (marked by a NULL swap_data).
+ */
+static void give_slot_to_writer(struct k_msgq *msgq, struct k_thread *pending_thread)
+{
+	if (pending_thread->base.swap_data == NULL) {
+		msgq->flags |= K_MSGQ_FLAG_RESERVED;
+	} else {
+		__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+				msgq->write_ptr < msgq->buffer_end);
+		(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
+		       msgq->msg_size);
+		advance_write_ptr(msgq);
+		msgq->used_msgs++;
+	}
+
+	/* wake up waiting thread */
+	arch_thread_return_value_set(pending_thread, 0);
+	z_ready_thread(pending_thread);
+}
+
+static inline bool put_is_busy(struct k_msgq *msgq, bool put_at_back)
+{
+	/* a zero-copy producer owns write_ptr, a zero-copy consumer read_ptr */
+	return ((msgq->flags & K_MSGQ_FLAG_RESERVE) != 0U) ||
+	       (!put_at_back && ((msgq->flags & K_MSGQ_FLAG_PEEKED) != 0U));
+}
+
 static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 			k_timeout_t timeout, bool put_at_back)
 {
@@ -141,10 +198,13 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_front, msgq, timeout);
 	}
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	if (unlikely(put_is_busy(msgq, put_at_back))) {
+		result = -EBUSY;
+	} else if (z_impl_k_msgq_num_free_get(msgq) > 0U) {
 		/* message queue isn't full */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (unlikely(pending_thread != NULL)) {
+		if (unlikely(pending_thread != NULL) &&
+		    pending_thread->base.swap_data != NULL) {
 			resched = true;
 
 			/* give message to waiting thread */
@@ -161,10 +221,7 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 				 * copy the message and increment write_ptr
 				 */
 				(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
-				msgq->write_ptr += msgq->msg_size;
-				if (msgq->write_ptr == msgq->buffer_end) {
-					msgq->write_ptr = msgq->buffer_start;
-				}
+				advance_write_ptr(msgq);
 			} else {
 				/*
 				 * to write a message to the head of the queue,
@@ -178,8 +235,7 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 				msgq->read_ptr -= msgq->msg_size;
 				(void)memcpy(msgq->read_ptr, (char *)data, msgq->msg_size);
 			}
-			msgq->used_msgs++;
-			resched = handle_poll_events(msgq);
+			resched = msg_queued(msgq, pending_thread);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -284,7 +340,10 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
+	if (unlikely((msgq->flags & K_MSGQ_FLAG_PEEK) != 0U)) {
+		/* a zero-copy consumer owns the head of the queue */
+		result = -EBUSY;
+	} else if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
 		msgq->read_ptr += msgq->msg_size;
@@ -299,19 +358,7 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
 			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
+			give_slot_to_writer(msgq, pending_thread);
 			resched = true;
 		}
 		result = 0;
@@ -454,11 +501,174 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
+	/* a message held by a zero-copy consumer is discarded as well */
+	if ((msgq->flags & K_MSGQ_FLAG_PEEKED) != 0U) {
+		msgq->flags &= ~(K_MSGQ_FLAG_PEEK | K_MSGQ_FLAG_PEEKED);
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+}
+
+/*
+ * Zero-copy API. At most one thread at a time owns or waits for a reserved
+ * slot, and at most one owns or waits for the head of the queue; other
+ * callers see -EBUSY. Zero-copy waiters only pend on an otherwise empty
+ * wait queue, so the wait queue never holds both readers and writers.
+ */
+int k_msgq_reserve(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_RESERVE) != 0U) {
+		result = -EBUSY;
+	} else if (z_impl_k_msgq_num_free_get(msgq) > 0U) {
+		msgq->flags |= K_MSGQ_FLAG_RESERVE | K_MSGQ_FLAG_RESERVED;
+		*slot = msgq->write_ptr;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else if (z_waitq_head(&msgq->wait_q) != NULL) {
+		/* copying producers are already waiting for room */
+		result = -EBUSY;
+	} else {
+		msgq->flags |= K_MSGQ_FLAG_RESERVE;
+		_current->base.swap_data = NULL;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+
+		key = k_spin_lock(&msgq->lock);
+		if (result == 0) {
+			*slot = msgq->write_ptr;
+		} else {
+			msgq->flags &= ~K_MSGQ_FLAG_RESERVE;
+		}
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_commit(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key;
+	struct k_thread *pending_thread;
+	bool resched;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_RESERVED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~(K_MSGQ_FLAG_RESERVE | K_MSGQ_FLAG_RESERVED);
+
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (unlikely(pending_thread != NULL) &&
+	    pending_thread->base.swap_data != NULL) {
+		/* give message to waiting thread, the slot stays free */
+		(void)memcpy(pending_thread->base.swap_data, msgq->write_ptr,
+			     msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	} else {
+		advance_write_ptr(msgq);
+		resched = msg_queued(msgq, pending_thread);
+	}
+
 	if (resched) {
 		z_reschedule(&msgq->lock, key);
 	} else {
 		k_spin_unlock(&msgq->lock, key);
 	}
+
+	return 0;
+}
+
+int k_msgq_peek_slot(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_PEEK) != 0U) {
+		result = -EBUSY;
+	} else if (msgq->used_msgs > 0U) {
+		msgq->flags |= K_MSGQ_FLAG_PEEK | K_MSGQ_FLAG_PEEKED;
+		*slot = msgq->read_ptr;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else if (z_waitq_head(&msgq->wait_q) != NULL) {
+		/* copying consumers are already waiting for a message */
+		result = -EBUSY;
+	} else {
+		msgq->flags |= K_MSGQ_FLAG_PEEK;
+		_current->base.swap_data = NULL;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+
+		key = k_spin_lock(&msgq->lock);
+		if (result == 0) {
+			*slot = msgq->read_ptr;
+		} else {
+			msgq->flags &= ~K_MSGQ_FLAG_PEEK;
+		}
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_release(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key;
+	struct k_thread *pending_thread;
+	bool resched = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_PEEKED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~(K_MSGQ_FLAG_PEEK | K_MSGQ_FLAG_PEEKED);
+	msgq->read_ptr += msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs--;
+
+	/* handle first thread waiting to write (if any) */
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (unlikely(pending_thread != NULL)) {
+		give_slot_to_writer(msgq, pending_thread);
+		resched = true;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
 }
 
 #ifdef CONFIG_USERSPACE
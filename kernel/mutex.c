@@ -52,10 +52,141 @@ static struct k_spinlock lock;
 static struct k_obj_type obj_type_mutex;
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* Busy-wait while the mutex is held by a thread running on another
+ * CPU, which is expected to release it shortly, for at most
+ * CONFIG_MUTEX_ADAPTIVE_SPIN_US.  Invoked without the lock held; the
+ * caller has to recheck the mutex state afterwards.
+ */
+static void mutex_spin(struct k_mutex *mutex)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	struct k_thread *owner;
+
+	while (true) {
+		owner = *(struct k_thread *volatile *)&mutex->owner;
+		if ((owner == NULL) || !z_thread_is_active_elsewhere(owner) ||
+		    ((k_cycle_get_32() - start) >= limit)) {
+			break;
+		}
+		arch_spin_relax();
+	}
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+#ifdef CONFIG_MUTEX_FAST_PATH
+BUILD_ASSERT(CONFIG_PRIORITY_CEILING >= K_LOWEST_THREAD_PRIO,
+	     "mutex fast path requires priority inheritance to be disabled");
+
+/* Returned by z_pend_curr() to a waiter woken by an unlock, which then
+ * competes for the mutex again.
+ */
+#define MUTEX_RETRY 1
+
+/* With the fast path the owner is claimed and released with a single
+ * compare-and-swap.  Threads about to pend set the contended flag with
+ * the lock held, and an unlock that finds it set wakes the first waiter
+ * under the lock.  The flag is only cleared with the lock held when
+ * the wait queue is found empty.
+ */
+static inline bool mutex_trylock_atomic(struct k_mutex *mutex)
+{
+	if (mutex->owner == _current) {
+		mutex->lock_count++;
+		return true;
+	}
+
+	if (atomic_ptr_cas((atomic_ptr_t *)&mutex->owner, NULL, _current)) {
+		mutex->lock_count = 1U;
+		return true;
+	}
+
+	return false;
+}
+
+static int mutex_lock_atomic(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int ret;
+
+	if (likely(mutex_trylock_atomic(mutex))) {
+		return 0;
+	}
+
+	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
+		return -EBUSY;
+	}
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	mutex_spin(mutex);
+	if (mutex_trylock_atomic(mutex)) {
+		return 0;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
+
+	key = k_spin_lock(&lock);
+
+	while (true) {
+		atomic_set(&mutex->contended, 1);
+
+		if (mutex_trylock_atomic(mutex)) {
+			if (z_waitq_head(&mutex->wait_q) == NULL) {
+				atomic_clear(&mutex->contended);
+			}
+			k_spin_unlock(&lock, key);
+			return 0;
+		}
+
+		ret = z_pend_curr(&lock, key, &mutex->wait_q,
+				  sys_timepoint_timeout(end));
+		if (ret != MUTEX_RETRY) {
+			return ret;
+		}
+
+		key = k_spin_lock(&lock);
+	}
+}
+
+static void mutex_unlock_atomic(struct k_mutex *mutex)
+{
+	k_spinlock_key_t key;
+	struct k_thread *waiter;
+
+	mutex->lock_count = 0U;
+	(void)atomic_ptr_set((atomic_ptr_t *)&mutex->owner, NULL);
+
+	if (likely(atomic_get(&mutex->contended) == 0)) {
+		return;
+	}
+
+	key = k_spin_lock(&lock);
+
+	waiter = z_unpend_first_thread(&mutex->wait_q);
+	if (waiter != NULL) {
+		arch_thread_return_value_set(waiter, MUTEX_RETRY);
+		z_ready_thread(waiter);
+		z_reschedule(&lock, key);
+	} else {
+		atomic_clear(&mutex->contended);
+		k_spin_unlock(&lock, key);
+	}
+}
+#endif /* CONFIG_MUTEX_FAST_PATH */
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_MUTEX_FAST_PATH
+	atomic_clear(&mutex->contended);
+#endif /* CONFIG_MUTEX_FAST_PATH */
+#ifdef CONFIG_LOCK_STATS
+	mutex->stats = NULL;
+#endif /* CONFIG_LOCK_STATS */
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -104,9 +235,11 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 }
 #endif
 
-int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+static int mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
+#ifndef CONFIG_MUTEX_FAST_PATH
 	k_spinlock_key_t key;
+#endif /* CONFIG_MUTEX_FAST_PATH */
 #if (CONFIG_PRIORITY_CEILING < K_LOWEST_THREAD_PRIO)
 	bool resched = false;
 	int new_prio;
@@ -116,6 +249,19 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
 
+#ifdef CONFIG_MUTEX_FAST_PATH
+	int ret = mutex_lock_atomic(mutex, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, ret);
+
+	return ret;
+#else
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		mutex_spin(mutex);
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	key = k_spin_lock(&lock);
 
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
@@ -215,6 +361,28 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	return got_mutex;
 #endif
+#endif /* CONFIG_MUTEX_FAST_PATH */
+}
+
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+#ifdef CONFIG_LOCK_STATS
+	if (mutex->stats != NULL) {
+		uint32_t wait_start = sys_clock_cycle_get_32();
+		struct k_thread *owner = mutex->owner;
+		int ret = mutex_lock(mutex, timeout);
+
+		/* Nested locking by the owner is not an acquisition. */
+		if ((ret == 0) && (mutex->lock_count == 1U)) {
+			z_lock_stats_acquired(mutex->stats, wait_start,
+					      (owner != NULL) && (owner != _current));
+		}
+
+		return ret;
+	}
+#endif /* CONFIG_LOCK_STATS */
+
+	return mutex_lock(mutex, timeout);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -229,7 +397,9 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 
 int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 {
+#ifndef CONFIG_MUTEX_FAST_PATH
 	struct k_thread *new_owner;
+#endif /* CONFIG_MUTEX_FAST_PATH */
 
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
@@ -268,6 +438,15 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		goto k_mutex_unlock_return;
 	}
 
+#ifdef CONFIG_LOCK_STATS
+	if (mutex->stats != NULL) {
+		z_lock_stats_released(mutex->stats);
+	}
+#endif /* CONFIG_LOCK_STATS */
+
+#ifdef CONFIG_MUTEX_FAST_PATH
+	mutex_unlock_atomic(mutex);
+#else
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 #if (CONFIG_PRIORITY_CEILING < K_LOWEST_THREAD_PRIO)
@@ -298,7 +477,7 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		mutex->lock_count = 0U;
 		k_spin_unlock(&lock, key);
 	}
-
+#endif /* CONFIG_MUTEX_FAST_PATH */
 
 k_mutex_unlock_return:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, unlock, mutex, 0);
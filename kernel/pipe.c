@@ -144,8 +144,52 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 	return written;
 }
 
+static void copy_from_pending_writers(struct k_pipe *pipe, bool *need_resched,
+				      struct pipe_buf_spec *buf)
+{
+	struct k_thread *writer = NULL;
+	struct pipe_buf_spec *writer_buf;
+	size_t copy_size;
+
+	/*
+	 * The reverse of copy_to_pending_readers(): once the ring buffer is
+	 * drained, take the rest directly from the waiting writers, rather
+	 * than waking them up to refill the ring buffer and pending again.
+	 */
+	do {
+		LOCK_SCHED_SPINLOCK {
+			writer = _priq_wait_best(&pipe->space.waitq);
+			if (writer == NULL) {
+				K_SPINLOCK_BREAK;
+			}
+
+			writer_buf = writer->base.swap_data;
+			copy_size = min(buf->len - buf->used,
+					writer_buf->len - writer_buf->used);
+			memcpy(&buf->data[buf->used],
+			       &writer_buf->data[writer_buf->used], copy_size);
+			buf->used += copy_size;
+			writer_buf->used += copy_size;
+
+			if (writer_buf->used < writer_buf->len) {
+				/* This writer has more: don't unpend. */
+				writer = NULL;
+			} else {
+				unpend_thread_no_timeout(writer);
+				z_abort_thread_timeout(writer);
+			}
+		}
+		if (writer != NULL) {
+			z_thread_return_value_set_with_data(writer, 0, NULL);
+			z_ready_thread(writer);
+			*need_resched = true;
+		}
+	} while (writer != NULL && buf->used < buf->len);
+}
+
 int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_timeout_t timeout)
 {
+	struct pipe_buf_spec buf = { (uint8_t *)data, len, 0 };
 	int rc;
 	size_t written = 0;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
@@ -199,7 +243,16 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
+		/* provide our "direct copy" info to potential readers */
+		buf.used = written;
+		_current->base.swap_data = &buf;
+
 		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		written = buf.used;
+		if (rc == 0 && written == len) {
+			rc = written;
+			break;
+		}
 		if (rc != 0) {
 			if (rc == -EAGAIN) {
 				rc = written ? written : -EAGAIN;
@@ -233,12 +286,21 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 	}
 
 	for (;;) {
-		if (pipe_full(pipe)) {
+		bool was_full = pipe_full(pipe);
+
+		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
+
+		/* See the comment in z_impl_k_pipe_write() about coherence */
+		if (!IS_ENABLED(CONFIG_KERNEL_COHERENCE) && buf.used < len &&
+		    pipe->waiting != 0) {
+			copy_from_pending_writers(pipe, &need_resched, &buf);
+		}
+
+		if (was_full) {
 			/* One or more pending writers may exist. */
-			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+			need_resched |= z_sched_wake_all(&pipe->space, 0, NULL);
 		}
 
-		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
 		if (likely(buf.used == len)) {
 			rc = buf.used;
 			break;
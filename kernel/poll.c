@@ -169,43 +169,19 @@ static inline void register_event(struct k_poll_event *event,
 }
 
 /* must be called with interrupts locked */
-static inline void clear_event_registration(struct k_poll_event *event)
+static inline bool clear_event_registration(struct k_poll_event *event)
 {
-	bool remove_event = false;
-
 	event->poller = NULL;
 
-	switch (event->type) {
-	case K_POLL_TYPE_SEM_AVAILABLE:
-		__ASSERT(event->sem != NULL, "invalid semaphore\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_DATA_AVAILABLE:
-		__ASSERT(event->queue != NULL, "invalid queue\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_SIGNAL:
-		__ASSERT(event->signal != NULL, "invalid poll signal\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		__ASSERT(event->msgq != NULL, "invalid message queue\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
-		__ASSERT(event->pipe != NULL, "invalid pipe\n");
-		remove_event = true;
-		break;
-	case K_POLL_TYPE_IGNORE:
-		/* nothing to do */
-		break;
-	default:
-		__ASSERT(false, "invalid event type\n");
-		break;
-	}
-	if (remove_event && sys_dnode_is_linked(&event->_node)) {
-		sys_dlist_remove(&event->_node);
+	/* Events that were signaled have already been taken off the
+	 * object's list, and ignored ones were never put on one.
+	 */
+	if (event->type == K_POLL_TYPE_IGNORE || !sys_dnode_is_linked(&event->_node)) {
+		return false;
 	}
+
+	sys_dlist_remove(&event->_node);
+	return true;
 }
 
 /* must be called with interrupts locked */
@@ -214,9 +190,11 @@ static inline void clear_event_registrations(struct k_poll_event *events,
 					      k_spinlock_key_t key)
 {
 	while (num_events--) {
-		clear_event_registration(&events[num_events]);
-		k_spin_unlock(&lock, key);
-		key = k_spin_lock(&lock);
+		/* Only let other contexts in after an actual list update */
+		if (clear_event_registration(&events[num_events])) {
+			k_spin_unlock(&lock, key);
+			key = k_spin_lock(&lock);
+		}
 	}
 }
 
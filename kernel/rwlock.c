@@ -0,0 +1,132 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/sys/atomic.h>
+#include <ksched.h>
+
+/*
+ * Readers increment the counter of their CPU, then check for a writer.
+ * A writer flags itself, then waits for the sum of the counters to drop
+ * to zero. Both sides use sequentially consistent atomics, so either the
+ * reader sees the writer and backs off, or the writer sees the reader and
+ * waits for it. Counters of a reader released on another CPU than the
+ * one it was taken on go out of balance, only their sum is meaningful.
+ */
+
+static inline atomic_t *cpu_readers(struct k_rwlock *rwlock)
+{
+	return &rwlock->readers[IS_ENABLED(CONFIG_SMP) ? _current_cpu->id : 0].count;
+}
+
+static void reader_exit(struct k_rwlock *rwlock)
+{
+	unsigned int key = arch_irq_lock();
+
+	(void)atomic_dec(cpu_readers(rwlock));
+	arch_irq_unlock(key);
+
+	if (atomic_get(&rwlock->writer) != 0) {
+		k_sem_give(&rwlock->drained);
+	}
+}
+
+static bool reader_enter(struct k_rwlock *rwlock)
+{
+	/* Pick and update the counter without migrating */
+	unsigned int key = arch_irq_lock();
+
+	(void)atomic_inc(cpu_readers(rwlock));
+	arch_irq_unlock(key);
+
+	if (atomic_get(&rwlock->writer) == 0) {
+		return true;
+	}
+
+	reader_exit(rwlock);
+
+	return false;
+}
+
+static bool readers_active(struct k_rwlock *rwlock)
+{
+	atomic_val_t sum = 0;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(rwlock->readers); i++) {
+		sum += atomic_get(&rwlock->readers[i].count);
+	}
+
+	return sum != 0;
+}
+
+void k_rwlock_init(struct k_rwlock *rwlock)
+{
+	for (unsigned int i = 0; i < ARRAY_SIZE(rwlock->readers); i++) {
+		atomic_clear(&rwlock->readers[i].count);
+	}
+
+	atomic_clear(&rwlock->writer);
+	(void)k_mutex_init(&rwlock->wr_lock);
+	(void)k_sem_init(&rwlock->drained, 0, 1);
+}
+
+int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	int ret;
+
+	if (reader_enter(rwlock)) {
+		return 0;
+	}
+
+	/* Queue behind the pending writer, which clears the flag before unlocking */
+	ret = k_mutex_lock(&rwlock->wr_lock, timeout);
+	if (ret != 0) {
+		return ret;
+	}
+
+	(void)reader_enter(rwlock);
+	k_mutex_unlock(&rwlock->wr_lock);
+
+	return 0;
+}
+
+void k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	reader_exit(rwlock);
+}
+
+int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	ret = k_mutex_lock(&rwlock->wr_lock, timeout);
+	if (ret != 0) {
+		return ret;
+	}
+
+	atomic_set(&rwlock->writer, 1);
+
+	/* Gives from readers of a previous writer are stale, the counters are checked below */
+	k_sem_reset(&rwlock->drained);
+
+	while (readers_active(rwlock)) {
+		ret = k_sem_take(&rwlock->drained, sys_timepoint_timeout(end));
+		if (ret != 0) {
+			k_rwlock_write_unlock(rwlock);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+void k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	atomic_clear(&rwlock->writer);
+	k_mutex_unlock(&rwlock->wr_lock);
+}
@@ -48,9 +48,32 @@ BUILD_ASSERT(CONFIG_NUM_COOP_PRIORITIES >= CONFIG_NUM_METAIRQ_PRIORITIES,
 #ifdef IAR_SUPPRESS_ALWAYS_INLINE_WARNING_FLAG
 TOOLCHAIN_DISABLE_WARNING(TOOLCHAIN_WARNING_ALWAYS_INLINE)
 #endif
+#ifdef CONFIG_SCHED_CPU_RUNQ
+/* Pick the per-CPU run queue for a thread being made ready: the CPU
+ * it last ran on when its mask still allows it, so it stays
+ * cache-warm, otherwise the lowest CPU its mask permits.
+ */
+static ALWAYS_INLINE uint8_t runq_home_cpu(struct k_thread *thread)
+{
+	unsigned int cpu = thread->base.cpu;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	uint32_t m = thread->base.cpu_mask;
+
+	if ((m & BIT(cpu)) == 0U) {
+		cpu = m == 0U ? 0U : u32_count_trailing_zeros(m);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	return (cpu < CONFIG_MP_MAX_NUM_CPUS) ? (uint8_t)cpu : 0U;
+}
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY)
 	int cpu, m = thread->base.cpu_mask;
 
 	/* Edge case: it's legal per the API to "make runnable" a
@@ -65,16 +88,16 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
@@ -82,6 +105,13 @@ static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 	__ASSERT_NO_MSG(!is_thread_dummy(thread));
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* Remember the queue so removal finds it even if the thread's
+	 * last CPU changes while it sits in the queue.
+	 */
+	thread->base.runq_cpu = runq_home_cpu(thread);
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 	_priq_run_add(thread_runq(thread), thread);
 }
 
@@ -98,9 +128,38 @@ static ALWAYS_INLINE void runq_yield(void)
 	_priq_run_yield(curr_cpu_runq());
 }
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+/* Work stealing.  The local queue's best thread wins ties; a thread
+ * queued on another CPU is taken only when it is strictly more
+ * important and allowed to run here.  That keeps the priority rules
+ * of a single global queue while leaving threads where they are
+ * cache-warm whenever it doesn't matter.
+ */
+static ALWAYS_INLINE struct k_thread *runq_steal(struct k_thread *best)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int id = _current_cpu->id;
+
+	for (unsigned int i = 1; i < num_cpus; i++) {
+		unsigned int cpu = (id + i) % num_cpus;
+		struct k_thread *thread = _priq_run_best(&_kernel.cpus[cpu].ready_q.runq);
+
+		if ((thread != NULL) && ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+
+	return best;
+}
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	return runq_steal(_priq_run_best(curr_cpu_runq()));
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -185,6 +244,11 @@ TOOLCHAIN_DISABLE_WARNING(TOOLCHAIN_WARNING_ALWAYS_INLINE)
 static ALWAYS_INLINE struct k_thread *next_up(void)
 {
 #ifdef CONFIG_SMP
+	/* This CPU is about to look at the run queue: IPIs sent to it from
+	 * now on are needed again.
+	 */
+	ipi_in_flight_clear();
+
 	if (z_is_thread_halting(_current)) {
 		halt_thread(_current, z_is_thread_aborting(_current) ?
 				      _THREAD_DEAD : _THREAD_SUSPENDED);
@@ -345,6 +409,11 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
+bool z_thread_is_active_elsewhere(struct k_thread *thread)
+{
+	return thread_active_elsewhere(thread) != NULL;
+}
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -360,7 +429,10 @@ static void ready_thread(struct k_thread *thread)
 		queue_thread(thread);
 		update_cache(0);
 
-		flag_ipi(ipi_mask_create(thread));
+		atomic_val_t ipi_mask = ipi_mask_create(thread);
+
+		flag_ipi(ipi_mask);
+		z_sched_usage_ready(thread, ipi_mask != 0);
 	}
 }
 
@@ -929,6 +1001,9 @@ void *z_get_next_switch_handle(void *interrupted)
 			_current_cpu->swap_ok = 0;
 			cpu_id = arch_curr_cpu()->id;
 			new_thread->base.cpu = cpu_id;
+#ifdef CONFIG_CPU_ID_IN_TLS
+			z_tls_cpu_id_set(new_thread, cpu_id);
+#endif /* CONFIG_CPU_ID_IN_TLS */
 			set_current(new_thread);
 
 #ifdef CONFIG_TIMESLICING
@@ -997,13 +1072,19 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
+
+#ifdef CONFIG_LOCK_STATS
+	static struct k_lock_stats sched_lock_stats;
+
+	k_spin_lock_stats_register(&_sched_spinlock, &sched_lock_stats, "sched");
+#endif /* CONFIG_LOCK_STATS */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -42,6 +42,52 @@ static struct k_spinlock lock;
 static struct k_obj_type obj_type_sem;
 #endif /* CONFIG_OBJ_CORE_SEM */
 
+#ifdef CONFIG_SEM_FAST_PATH
+/* With the fast path the count is an atomic, with Z_SEM_WAITERS set
+ * (only ever while the count is zero) when threads may be pending on
+ * the wait queue.  Takes and gives that don't involve waiters update
+ * the count with a single compare-and-swap and never touch the lock;
+ * everything else, including clearing Z_SEM_WAITERS, happens with the
+ * lock held.
+ */
+static inline bool sem_take_fast(struct k_sem *sem)
+{
+	atomic_val_t count;
+
+	do {
+		count = atomic_get(&sem->count);
+		if ((count & Z_SEM_COUNT_MASK) == 0) {
+			return false;
+		}
+	} while (!atomic_cas(&sem->count, count, count - 1));
+
+	return true;
+}
+
+static inline bool sem_give_fast(struct k_sem *sem)
+{
+#ifdef CONFIG_POLL
+	/* Poll events are signaled under the lock */
+	ARG_UNUSED(sem);
+	return false;
+#else
+	atomic_val_t count;
+
+	do {
+		count = atomic_get(&sem->count);
+		if ((count & Z_SEM_WAITERS) != 0) {
+			return false;
+		}
+		if ((unsigned int)count == sem->limit) {
+			return true;
+		}
+	} while (!atomic_cas(&sem->count, count, count + 1));
+
+	return true;
+#endif /* CONFIG_POLL */
+}
+#endif /* CONFIG_SEM_FAST_PATH */
+
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		      unsigned int limit)
 {
@@ -54,8 +100,17 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SEM_FAST_PATH
+	limit = MIN(limit, (unsigned int)Z_SEM_COUNT_MASK);
+	initial_count = MIN(initial_count, limit);
+	atomic_set(&sem->count, initial_count);
+#else
 	sem->count = initial_count;
+#endif /* CONFIG_SEM_FAST_PATH */
 	sem->limit = limit;
+#ifdef CONFIG_LOCK_STATS
+	sem->stats = NULL;
+#endif /* CONFIG_LOCK_STATS */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
 
@@ -94,20 +149,44 @@ static inline bool handle_poll_events(struct k_sem *sem)
 
 void z_impl_k_sem_give(struct k_sem *sem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key;
 	struct k_thread *thread;
 	bool resched;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, give, sem);
 
+#ifdef CONFIG_SEM_FAST_PATH
+	if (likely(sem_give_fast(sem))) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give, sem);
+		return;
+	}
+#endif /* CONFIG_SEM_FAST_PATH */
+
+	key = k_spin_lock(&lock);
 	thread = z_unpend_first_thread(&sem->wait_q);
 
 	if (unlikely(thread != NULL)) {
 		arch_thread_return_value_set(thread, 0);
 		z_ready_thread(thread);
 		resched = true;
+#ifdef CONFIG_SEM_FAST_PATH
+		if (z_waitq_head(&sem->wait_q) == NULL) {
+			(void)atomic_and(&sem->count, ~Z_SEM_WAITERS);
+		}
+#endif /* CONFIG_SEM_FAST_PATH */
 	} else {
+#ifdef CONFIG_SEM_FAST_PATH
+		atomic_val_t count;
+
+		/* Waiters may have timed out, leaving the flag behind */
+		(void)atomic_and(&sem->count, ~Z_SEM_WAITERS);
+		do {
+			count = atomic_get(&sem->count);
+		} while (((unsigned int)count != sem->limit) &&
+			 !atomic_cas(&sem->count, count, count + 1));
+#else
 		sem->count += (sem->count != sem->limit) ? 1U : 0U;
+#endif /* CONFIG_SEM_FAST_PATH */
 		resched = handle_poll_events(sem);
 	}
 
@@ -132,10 +211,43 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret;
+#ifdef CONFIG_LOCK_STATS
+	uint32_t wait_start = (sem->stats != NULL) ? sys_clock_cycle_get_32() : 0U;
+	bool contended = false;
+#endif /* CONFIG_LOCK_STATS */
 
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
 
+#ifdef CONFIG_SEM_FAST_PATH
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
+
+	if (likely(sem_take_fast(sem))) {
+		ret = 0;
+		goto out;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Announce a waiter before committing to pend, so that gives
+	 * take the slow path.  Retry if a give raced with us.
+	 */
+	while (!atomic_cas(&sem->count, 0, Z_SEM_WAITERS)) {
+		if (atomic_get(&sem->count) == Z_SEM_WAITERS) {
+			break;
+		}
+		if (sem_take_fast(sem)) {
+			k_spin_unlock(&lock, key);
+			ret = 0;
+			goto out;
+		}
+	}
+#else
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
@@ -152,12 +264,21 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 		ret = -EBUSY;
 		goto out;
 	}
+#endif /* CONFIG_SEM_FAST_PATH */
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
+#ifdef CONFIG_LOCK_STATS
+	contended = true;
+#endif /* CONFIG_LOCK_STATS */
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
 
 out:
+#ifdef CONFIG_LOCK_STATS
+	if ((ret == 0) && (sem->stats != NULL)) {
+		z_lock_stats_shared_acquired(sem->stats, wait_start, contended);
+	}
+#endif /* CONFIG_LOCK_STATS */
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
 
 	return ret;
@@ -178,7 +299,11 @@ void z_impl_k_sem_reset(struct k_sem *sem)
 		arch_thread_return_value_set(thread, -EAGAIN);
 		z_ready_thread(thread);
 	}
+#ifdef CONFIG_SEM_FAST_PATH
+	atomic_clear(&sem->count);
+#else
 	sem->count = 0;
+#endif /* CONFIG_SEM_FAST_PATH */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, reset, sem);
 
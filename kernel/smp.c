@@ -11,6 +11,26 @@
 
 static atomic_t global_lock;
 
+#ifdef CONFIG_CPU_ID_IN_TLS
+Z_THREAD_LOCAL uint8_t z_tls_cpu_id;
+
+/* Offset of z_tls_cpu_id from the thread pointer, the same for all threads */
+uintptr_t z_tls_cpu_id_offset;
+
+void z_smp_tls_init(void)
+{
+	unsigned int key = arch_irq_lock();
+
+	/* Only valid once a thread with its thread pointer loaded runs, as
+	 * opposed to the dummy thread the kernel starts with.
+	 */
+	z_tls_cpu_id_offset = (uintptr_t)&z_tls_cpu_id - _current->tls;
+	z_tls_cpu_id = _current_cpu->id;
+
+	arch_irq_unlock(key);
+}
+#endif /* CONFIG_CPU_ID_IN_TLS */
+
 /**
  * Flag to tell recently powered up CPU to start
  * initialization routine.
@@ -459,7 +459,9 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 		stack_buf_size, (void *)stack_ptr);
 
 #ifdef CONFIG_INIT_STACKS
-	memset(stack_buf_start, 0xaa, stack_buf_size);
+	if (!z_thread_stack_is_painted(stack)) {
+		memset(stack_buf_start, 0xaa, stack_buf_size);
+	}
 #endif /* CONFIG_INIT_STACKS */
 #ifdef CONFIG_STACK_SENTINEL
 	/* Put the stack sentinel at the lowest 4 bytes of the stack area.
@@ -930,6 +932,13 @@ FUNC_NORETURN void k_thread_user_mode_enter(k_thread_entry_t entry,
 			     (char *)(_current->stack_info.start +
 				      _current->stack_info.size));
 #endif /* CONFIG_THREAD_LOCAL_STORAGE */
+#ifdef CONFIG_CPU_ID_IN_TLS
+	/* The fresh TLS area has lost the CPU ID stored at switch in */
+	unsigned int key = arch_irq_lock();
+
+	z_tls_cpu_id_set(_current, _current_cpu->id);
+	arch_irq_unlock(key);
+#endif /* CONFIG_CPU_ID_IN_TLS */
 	arch_user_mode_enter(entry, p1, p2, p3);
 #else
 	/* XXX In this case we do not reset the stack */
@@ -1197,6 +1206,20 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->peak_cycles      += tmp_stats.peak_cycles;
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		stats->ready_cycles     += tmp_stats.ready_cycles;
+		stats->preempted_cycles += tmp_stats.preempted_cycles;
+		stats->num_preemptions  += tmp_stats.num_preemptions;
+		stats->num_ipis         += tmp_stats.num_ipis;
+
+		for (unsigned int j = 0;
+		     j < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; j++) {
+			stats->latency_hist[j] += tmp_stats.latency_hist[j];
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+		stats->util             += tmp_stats.util;
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -11,11 +11,14 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/init.h>
 #include <zephyr/llext/symbol.h>
 
 static uint64_t curr_tick;
 
+#if !defined(CONFIG_TIMEOUT_QUEUE_WHEEL) && !defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL && !CONFIG_TIMEOUT_QUEUE_PER_CPU */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -23,32 +26,357 @@ static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
  */
 static struct k_spinlock timeout_lock;
 
+#ifdef CONFIG_LOCK_STATS
+static int timeout_lock_stats_init(void)
+{
+	static struct k_lock_stats timeout_lock_stats;
+
+	k_spin_lock_stats_register(&timeout_lock, &timeout_lock_stats, "timeout");
+
+	return 0;
+}
+
+SYS_INIT(timeout_lock_stats_init, PRE_KERNEL_1, 0);
+#endif /* CONFIG_LOCK_STATS */
+
+#ifndef CONFIG_TIMEOUT_QUEUE_PER_CPU
 /* Ticks left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
+#endif /* !CONFIG_TIMEOUT_QUEUE_PER_CPU */
 
-static struct _timeout *first(void)
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+/*
+ * One delta list per CPU, each behind its own lock, so that arming and
+ * cancelling timeouts on different CPUs doesn't contend.  timeout_lock
+ * then only protects the global tick count and the programmed deadline.
+ * Lock order is queue lock first, timeout_lock second.
+ */
+struct timeout_queue {
+	sys_dlist_t list;
+	struct k_spinlock lock;
+	/* Tick the first entry's dticks is relative to */
+	uint64_t tick;
+	/* Ticks left to process in an announce of this queue in progress */
+	int announce_remaining;
+};
+
+#define TIMEOUT_QUEUE_INIT(i, _) \
+	[i] = { .list = SYS_DLIST_STATIC_INIT(&timeout_queues[i].list) }
+
+static struct timeout_queue timeout_queues[CONFIG_MP_MAX_NUM_CPUS] = {
+	LISTIFY(CONFIG_MP_MAX_NUM_CPUS, TIMEOUT_QUEUE_INIT, (,))
+};
+
+/* Firing tick of the timeout callback each CPU is running, if any */
+static struct {
+	uint64_t tick;
+	bool active;
+} firing[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Absolute tick the system timer is programmed for */
+static uint64_t next_deadline = UINT64_MAX;
+
+/* A linked timeout always records a valid CPU.  One that was never
+ * armed may carry garbage, which only has to index some queue for the
+ * "is it linked" check to be made under a lock.
+ */
+static inline struct timeout_queue *queue_of(const struct _timeout *to)
+{
+	return &timeout_queues[to->cpu % CONFIG_MP_MAX_NUM_CPUS];
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/*
+ * Hierarchical timing wheel.  In this backend dticks holds the absolute
+ * tick at which the timeout expires rather than a delta to the previous
+ * entry.  Level N has WHEEL_SLOTS slots each spanning WHEEL_SLOTS^N
+ * ticks; a timeout lives on the lowest level whose current revolution
+ * covers its expiry, and the entries of a higher-level slot are
+ * "cascaded" down when curr_tick reaches the start of that slot.
+ *
+ * Slot lists are (re)initialized lazily when their occupancy bit goes
+ * from clear to set, so the wheel needs no boot-time setup.
+ */
+#define WHEEL_SLOT_BITS 6U
+#define WHEEL_SLOTS     BIT(WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS    CONFIG_TIMEOUT_QUEUE_WHEEL_LEVELS
+
+BUILD_ASSERT(WHEEL_SLOTS <= 64U, "Occupancy bitmap is a 64 bit word");
+BUILD_ASSERT(WHEEL_LEVELS * WHEEL_SLOT_BITS < 64U, "Wheel span exceeds tick width");
+
+static struct {
+	sys_dlist_t slots[WHEEL_LEVELS][WHEEL_SLOTS];
+	uint64_t occupied[WHEEL_LEVELS];
+	/* Timeouts beyond the span of the top level */
+	sys_dlist_t overflow;
+	/* Cached lower bound of the earliest expiry, UINT64_MAX when empty */
+	uint64_t next_expiry;
+	bool next_valid;
+} wheel = {
+	.overflow = SYS_DLIST_STATIC_INIT(&wheel.overflow),
+};
+
+static inline unsigned int wheel_shift(unsigned int level)
+{
+	return level * WHEEL_SLOT_BITS;
+}
+
+/* The overflow list is revisited each time the top level cursor
+ * advances by one slot.
+ */
+static inline uint64_t wheel_overflow_event(void)
+{
+	unsigned int top = wheel_shift(WHEEL_LEVELS - 1U);
+
+	return ((curr_tick >> top) + 1U) << top;
+}
+
+static void wheel_insert(struct _timeout *to)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	unsigned int level = 0U;
+	uint64_t block = curr_tick;
+	uint64_t bound = expiry;
+
+	/* Only cascading can present an already-due timeout; it goes to
+	 * the current level 0 slot and is fired in the same pass.
+	 */
+	if (expiry > curr_tick) {
+		while ((level < (WHEEL_LEVELS - 1U)) &&
+		       (((expiry >> wheel_shift(level)) -
+			 (curr_tick >> wheel_shift(level))) >= WHEEL_SLOTS)) {
+			level++;
+		}
+
+		block = expiry >> wheel_shift(level);
+	}
+
+	if ((block - (curr_tick >> wheel_shift(level))) >= WHEEL_SLOTS) {
+		sys_dlist_append(&wheel.overflow, &to->node);
+		bound = wheel_overflow_event();
+	} else {
+		unsigned int idx = block & WHEEL_SLOT_MASK;
+		sys_dlist_t *slot = &wheel.slots[level][idx];
+
+		if ((wheel.occupied[level] & BIT64(idx)) == 0U) {
+			sys_dlist_init(slot);
+			wheel.occupied[level] |= BIT64(idx);
+		}
+		sys_dlist_append(slot, &to->node);
+	}
+
+	if (wheel.next_valid && (bound < wheel.next_expiry)) {
+		wheel.next_expiry = bound;
+	}
+}
+
+static void wheel_remove(struct _timeout *to)
+{
+	sys_dnode_t *n = to->node.next;
+	bool overflow = false;
+
+	/* The last entry of a list has the list head on both sides */
+	if (n == to->node.prev) {
+		if (n == &wheel.overflow) {
+			overflow = true;
+		} else {
+			size_t pos = (sys_dlist_t *)n - &wheel.slots[0][0];
+
+			wheel.occupied[pos / WHEEL_SLOTS] &= ~BIT64(pos % WHEEL_SLOTS);
+		}
+	}
+
+	sys_dlist_remove(&to->node);
+
+	if (overflow || ((uint64_t)to->dticks == wheel.next_expiry)) {
+		wheel.next_valid = false;
+	}
+}
+
+/* Distance in slots from the cursor to the first occupied slot on
+ * @level.  Only level 0 can have the cursor slot itself occupied, and
+ * only while sys_clock_announce() is firing it.
+ */
+static unsigned int wheel_distance(unsigned int level)
+{
+	uint64_t occ = wheel.occupied[level];
+	unsigned int cursor = (curr_tick >> wheel_shift(level)) & WHEEL_SLOT_MASK;
+	unsigned int s = (cursor + 1U) & WHEEL_SLOT_MASK;
+
+	if ((occ & BIT64(cursor)) != 0U) {
+		return 0U;
+	}
+
+	/* Rotate so that bit 0 is the slot right after the cursor */
+	if (s != 0U) {
+		occ = (occ >> s) | (occ << (WHEEL_SLOTS - s));
+	}
+
+	return u64_count_trailing_zeros(occ) + 1U;
+}
+
+/* Next tick at which the wheel needs servicing: a level 0 expiry or the
+ * start of an occupied higher-level slot that must cascade.
+ */
+static uint64_t wheel_next_event(void)
+{
+	uint64_t ev = UINT64_MAX;
+
+	for (unsigned int level = 0U; level < WHEEL_LEVELS; level++) {
+		if (wheel.occupied[level] != 0U) {
+			uint64_t block = (curr_tick >> wheel_shift(level)) + wheel_distance(level);
+
+			ev = min(ev, block << wheel_shift(level));
+		}
+	}
+
+	if (!sys_dlist_is_empty(&wheel.overflow)) {
+		ev = min(ev, wheel_overflow_event());
+	}
+
+	return ev;
+}
+
+/* Earliest expiry, for programming the tickless timer.  The first
+ * occupied slot on a level always holds that level's earliest entries,
+ * so at most one slot per level is scanned.  Overflowed timeouts only
+ * contribute the tick at which they are next revisited, so the result
+ * can be early (never late) by up to one top-level slot.
+ */
+static uint64_t wheel_next_expiry(void)
+{
+	if (wheel.next_valid) {
+		return wheel.next_expiry;
+	}
+
+	uint64_t best = UINT64_MAX;
+
+	for (unsigned int level = 0U; level < WHEEL_LEVELS; level++) {
+		if (wheel.occupied[level] == 0U) {
+			continue;
+		}
+
+		unsigned int d = wheel_distance(level);
+
+		if (level == 0U) {
+			best = min(best, curr_tick + d);
+		} else {
+			unsigned int idx = ((curr_tick >> wheel_shift(level)) + d) &
+					   WHEEL_SLOT_MASK;
+			struct _timeout *t;
+
+			SYS_DLIST_FOR_EACH_CONTAINER(&wheel.slots[level][idx], t, node) {
+				best = min(best, (uint64_t)t->dticks);
+			}
+		}
+	}
+
+	if (!sys_dlist_is_empty(&wheel.overflow)) {
+		best = min(best, wheel_overflow_event());
+	}
+
+	wheel.next_expiry = best;
+	wheel.next_valid = true;
+
+	return best;
+}
+
+/* Redistribute the overflow list and the higher-level slots that start
+ * at curr_tick.
+ */
+static void wheel_cascade(void)
+{
+	if (((curr_tick & BIT64_MASK(wheel_shift(WHEEL_LEVELS - 1U))) == 0U) &&
+	    !sys_dlist_is_empty(&wheel.overflow)) {
+		sys_dlist_t pending;
+		sys_dnode_t *n;
+
+		sys_dlist_init(&pending);
+		while ((n = sys_dlist_get(&wheel.overflow)) != NULL) {
+			sys_dlist_append(&pending, n);
+		}
+		while ((n = sys_dlist_get(&pending)) != NULL) {
+			wheel_insert(CONTAINER_OF(n, struct _timeout, node));
+		}
+
+		/* The cached bound may have been this very revisit */
+		wheel.next_valid = false;
+	}
+
+	for (unsigned int level = WHEEL_LEVELS - 1U; level > 0U; level--) {
+		unsigned int idx = (curr_tick >> wheel_shift(level)) & WHEEL_SLOT_MASK;
+		sys_dlist_t *slot = &wheel.slots[level][idx];
+		sys_dnode_t *n;
+
+		if ((wheel.occupied[level] & BIT64(idx)) == 0U) {
+			continue;
+		}
+
+		wheel.occupied[level] &= ~BIT64(idx);
+		while ((n = sys_dlist_get(slot)) != NULL) {
+			wheel_insert(CONTAINER_OF(n, struct _timeout, node));
+		}
+	}
+}
+
+static struct _timeout *wheel_first_due(void)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	unsigned int idx = curr_tick & WHEEL_SLOT_MASK;
+	sys_dnode_t *n;
+
+	if ((wheel.occupied[0] & BIT64(idx)) == 0U) {
+		return NULL;
+	}
+
+	n = sys_dlist_peek_head(&wheel.slots[0][idx]);
+
+	return CONTAINER_OF(n, struct _timeout, node);
+}
+#else
+static struct _timeout *first_in(sys_dlist_t *list)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(list);
 
 	return (t == NULL) ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next_in(sys_dlist_t *list, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(list, &t->node);
 
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static void remove_from(sys_dlist_t *list, struct _timeout *t)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	if (next_in(list, t) != NULL) {
+		next_in(list, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
 }
 
+#ifndef CONFIG_TIMEOUT_QUEUE_PER_CPU
+static struct _timeout *first(void)
+{
+	return first_in(&timeout_list);
+}
+
+static struct _timeout *next(struct _timeout *t)
+{
+	return next_in(&timeout_list, t);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	remove_from(&timeout_list, t);
+}
+#endif /* !CONFIG_TIMEOUT_QUEUE_PER_CPU */
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifndef CONFIG_TIMEOUT_QUEUE_PER_CPU
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -69,7 +397,300 @@ static int32_t elapsed(void)
 	 */
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
+#endif /* !CONFIG_TIMEOUT_QUEUE_PER_CPU */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+/*
+ * With per-CPU queues curr_tick is advanced by the whole announced amount
+ * up front, so "now" is always curr_tick plus the driver's elapsed count.
+ * The "relative to the firing timeout" rule of the single queue is kept per
+ * CPU: timeouts added while a CPU runs a timeout callback are based on
+ * that callback's tick.  Must be called with interrupts locked.
+ */
+static uint64_t timeout_base(void)
+{
+	unsigned int cpu = arch_curr_cpu()->id;
+	uint64_t base = 0;
 
+	if (firing[cpu].active) {
+		return firing[cpu].tick;
+	}
+
+	K_SPINLOCK(&timeout_lock) {
+		base = curr_tick + sys_clock_elapsed();
+	}
+
+	return base;
+}
+
+/* must be locked (timeout_lock) */
+static void program_deadline(void)
+{
+	int32_t ticks = SYS_CLOCK_MAX_WAIT;
+
+	if (next_deadline != UINT64_MAX) {
+		int64_t delta = (int64_t)(next_deadline - curr_tick) - sys_clock_elapsed();
+
+		if (delta <= (int64_t)INT_MAX) {
+			ticks = max(0, delta);
+		}
+	}
+
+	sys_clock_set_timeout(ticks, false);
+}
+
+k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
+{
+	/* A stale CPU id after migration only picks a remote queue */
+	struct timeout_queue *q = &timeout_queues[arch_curr_cpu()->id];
+	k_ticks_t ticks = 0;
+
+	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		return 0;
+	}
+
+#ifdef CONFIG_KERNEL_COHERENCE
+	__ASSERT_NO_MSG(sys_cache_is_mem_coherent(to));
+#endif /* CONFIG_KERNEL_COHERENCE */
+
+	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	to->fn = fn;
+
+	K_SPINLOCK(&q->lock) {
+		struct _timeout *t;
+		uint64_t expiry;
+
+		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
+			expiry = timeout_base() + timeout.ticks + 1;
+			ticks = expiry;
+		} else {
+			expiry = Z_TICK_ABS(timeout.ticks);
+			ticks = timeout.ticks;
+		}
+
+		to->dticks = max(1, (int64_t)(expiry - q->tick));
+		to->cpu = q - timeout_queues;
+		expiry = q->tick + to->dticks;
+
+		for (t = first_in(&q->list); t != NULL; t = next_in(&q->list, t)) {
+			if (t->dticks > to->dticks) {
+				t->dticks -= to->dticks;
+				sys_dlist_insert(&t->node, &to->node);
+				break;
+			}
+			to->dticks -= t->dticks;
+		}
+
+		if (t == NULL) {
+			sys_dlist_append(&q->list, &to->node);
+		}
+
+		if ((to == first_in(&q->list)) && (q->announce_remaining == 0)) {
+			k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+
+			if (expiry < next_deadline) {
+				next_deadline = expiry;
+				program_deadline();
+			}
+			k_spin_unlock(&timeout_lock, key);
+		}
+	}
+
+	return ticks;
+}
+
+/* An aborted head leaves the timer programmed early; the spurious
+ * announce reprograms it, which is cheaper than scanning every queue.
+ */
+int z_abort_timeout(struct _timeout *to)
+{
+	struct timeout_queue *q = queue_of(to);
+	int ret = -EINVAL;
+
+	K_SPINLOCK(&q->lock) {
+		if (sys_dnode_is_linked(&to->node)) {
+			remove_from(&q->list, to);
+			to->dticks = TIMEOUT_DTICKS_ABORTED;
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+
+/* must be locked (queue lock), returns the absolute expiry */
+static uint64_t timeout_expiry(struct timeout_queue *q, const struct _timeout *timeout)
+{
+	uint64_t ticks = q->tick;
+
+	for (struct _timeout *t = first_in(&q->list); t != NULL; t = next_in(&q->list, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
+{
+	struct timeout_queue *q = queue_of(timeout);
+	k_ticks_t ticks = 0;
+
+	K_SPINLOCK(&q->lock) {
+		if (!z_is_inactive_timeout(timeout)) {
+			uint64_t expiry = timeout_expiry(q, timeout);
+			k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+
+			ticks = (k_ticks_t)(expiry - curr_tick) - sys_clock_elapsed();
+			k_spin_unlock(&timeout_lock, key);
+		}
+	}
+
+	return ticks;
+}
+EXPORT_SYMBOL(z_timeout_remaining);
+
+k_ticks_t z_timeout_expires(const struct _timeout *timeout)
+{
+	struct timeout_queue *q = queue_of(timeout);
+	k_ticks_t ticks = 0;
+
+	K_SPINLOCK(&q->lock) {
+		if (!z_is_inactive_timeout(timeout)) {
+			ticks = timeout_expiry(q, timeout);
+		} else {
+			k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+
+			ticks = curr_tick;
+			k_spin_unlock(&timeout_lock, key);
+		}
+	}
+
+	return ticks;
+}
+EXPORT_SYMBOL(z_timeout_expires);
+
+int32_t z_get_next_timeout_expiry(void)
+{
+	int32_t ret = (int32_t) K_TICKS_FOREVER;
+
+	K_SPINLOCK(&timeout_lock) {
+		ret = SYS_CLOCK_MAX_WAIT;
+		if (next_deadline != UINT64_MAX) {
+			int64_t delta = (int64_t)(next_deadline - curr_tick) - sys_clock_elapsed();
+
+			if (delta <= (int64_t)INT_MAX) {
+				ret = max(0, delta);
+			}
+		}
+	}
+	return ret;
+}
+
+/* Process @ticks worth of expirations on one queue, returning the
+ * absolute expiry of its new head.  A queue already being processed by
+ * another CPU just absorbs the ticks; that CPU reports its head.
+ */
+static uint64_t announce_queue(struct timeout_queue *q, int32_t ticks)
+{
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	unsigned int cpu = arch_curr_cpu()->id;
+	uint64_t next = UINT64_MAX;
+	struct _timeout *t;
+
+	if (q->announce_remaining != 0) {
+		q->announce_remaining += ticks;
+		k_spin_unlock(&q->lock, key);
+		return next;
+	}
+
+	q->announce_remaining = ticks;
+
+	for (t = first_in(&q->list);
+	     (t != NULL) && (t->dticks <= q->announce_remaining);
+	     t = first_in(&q->list)) {
+		int dt = t->dticks;
+
+		q->tick += dt;
+		t->dticks = 0;
+		remove_from(&q->list, t);
+
+		firing[cpu].tick = q->tick;
+		firing[cpu].active = true;
+		k_spin_unlock(&q->lock, key);
+		t->fn(t);
+		key = k_spin_lock(&q->lock);
+		firing[cpu].active = false;
+		q->announce_remaining -= dt;
+	}
+
+	if (t != NULL) {
+		t->dticks -= q->announce_remaining;
+	}
+
+	q->tick += q->announce_remaining;
+	q->announce_remaining = 0;
+
+	t = first_in(&q->list);
+	if (t != NULL) {
+		next = q->tick + t->dticks;
+	}
+
+	k_spin_unlock(&q->lock, key);
+
+	return next;
+}
+
+void sys_clock_announce(int32_t ticks)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int id = arch_curr_cpu()->id;
+	uint64_t next = UINT64_MAX;
+
+	/* Adds racing with the scan below program the timer themselves
+	 * and are folded in by the final min().
+	 */
+	K_SPINLOCK(&timeout_lock) {
+		curr_tick += ticks;
+		next_deadline = UINT64_MAX;
+	}
+
+	/* Local queue first, then the others on behalf of CPUs whose
+	 * timer interrupt is not the one that fired.
+	 */
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		next = min(next, announce_queue(&timeout_queues[(id + i) % num_cpus], ticks));
+	}
+
+	K_SPINLOCK(&timeout_lock) {
+		next_deadline = min(next_deadline, next);
+		program_deadline();
+	}
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice();
+#endif /* CONFIG_TIMESLICING */
+}
+#else
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+static int32_t next_timeout(int32_t ticks_elapsed)
+{
+	uint64_t expiry = wheel_next_expiry();
+	int32_t ret;
+
+	if ((expiry == UINT64_MAX) ||
+	    ((int64_t)(expiry - curr_tick - ticks_elapsed) > (int64_t)INT_MAX)) {
+		ret = SYS_CLOCK_MAX_WAIT;
+	} else {
+		ret = max(0, (int64_t)(expiry - curr_tick) - ticks_elapsed);
+	}
+
+	return ret;
+}
+#else
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
 	struct _timeout *to = first();
@@ -84,6 +705,7 @@ static int32_t next_timeout(int32_t ticks_elapsed)
 
 	return ret;
 }
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
 {
@@ -101,7 +723,9 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 		struct _timeout *t;
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
@@ -117,6 +741,14 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+		bool is_first = (curr_tick + to->dticks) < wheel_next_expiry();
+
+		to->dticks += curr_tick;
+		wheel_insert(to);
+
+		if (is_first && announce_remaining == 0) {
+#else
 		for (t = first(); t != NULL; t = next(t)) {
 			if (t->dticks > to->dticks) {
 				t->dticks -= to->dticks;
@@ -131,6 +763,7 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 		}
 
 		if (to == first() && announce_remaining == 0) {
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
@@ -150,9 +783,15 @@ int z_abort_timeout(struct _timeout *to)
 
 	K_SPINLOCK(&timeout_lock) {
 		if (sys_dnode_is_linked(&to->node)) {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+			bool is_first = ((uint64_t)to->dticks == wheel_next_expiry());
+
+			wheel_remove(to);
+#else
 			bool is_first = (to == first());
 
 			remove_timeout(to);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 			to->dticks = TIMEOUT_DTICKS_ABORTED;
 			ret = 0;
 			if (is_first) {
@@ -167,6 +806,9 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	return (k_ticks_t)((uint64_t)timeout->dticks - curr_tick);
+#else
 	k_ticks_t ticks = 0;
 
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
@@ -177,6 +819,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -236,6 +879,28 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	for (uint64_t ev = wheel_next_event();
+	     (ev - curr_tick) <= (uint64_t)announce_remaining;
+	     ev = wheel_next_event()) {
+		int dt = (int)(ev - curr_tick);
+		struct _timeout *t;
+
+		curr_tick = ev;
+		wheel_cascade();
+
+		while ((t = wheel_first_due()) != NULL) {
+			wheel_remove(t);
+			t->dticks = 0;
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+
+		announce_remaining -= dt;
+	}
+#else
 	struct _timeout *t;
 
 	for (t = first();
@@ -256,6 +921,7 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -269,12 +935,18 @@ void sys_clock_announce(int32_t ticks)
 #endif /* CONFIG_TIMESLICING */
 }
 
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
 
 	K_SPINLOCK(&timeout_lock) {
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+		t = curr_tick + sys_clock_elapsed();
+#else
 		t = curr_tick + elapsed();
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
 	}
 	return t;
 }
@@ -341,7 +1013,60 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	/* Pending timeouts keep their relative distance to "now", as
+	 * they do with the delta list; re-sort them around the new tick.
+	 */
+	K_SPINLOCK(&timeout_lock) {
+		sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+		sys_dnode_t *n;
+
+		for (unsigned int level = 0U; level < WHEEL_LEVELS; level++) {
+			for (unsigned int idx = 0U; idx < WHEEL_SLOTS; idx++) {
+				if ((wheel.occupied[level] & BIT64(idx)) == 0U) {
+					continue;
+				}
+				while ((n = sys_dlist_get(&wheel.slots[level][idx])) != NULL) {
+					struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+					t->dticks = (int64_t)((uint64_t)t->dticks - curr_tick);
+					sys_dlist_append(&pending, n);
+				}
+			}
+			wheel.occupied[level] = 0U;
+		}
+
+		while ((n = sys_dlist_get(&wheel.overflow)) != NULL) {
+			struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+			t->dticks = (int64_t)((uint64_t)t->dticks - curr_tick);
+			sys_dlist_append(&pending, n);
+		}
+
+		curr_tick = tick;
+		wheel.next_valid = false;
+
+		while ((n = sys_dlist_get(&pending)) != NULL) {
+			struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+			t->dticks += curr_tick;
+			wheel_insert(t);
+		}
+	}
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+	/* Pending timeouts keep their distance to "now" */
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		K_SPINLOCK(&timeout_queues[i].lock) {
+			timeout_queues[i].tick = tick;
+		}
+	}
+
+	K_SPINLOCK(&timeout_lock) {
+		curr_tick = tick;
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -10,6 +10,11 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
+
+#ifdef CONFIG_CPU_FREQ_POLICY_UTIL
+#include <zephyr/cpu_freq/policy.h>
+#endif /* CONFIG_CPU_FREQ_POLICY_UTIL */
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -32,6 +37,88 @@ static uint32_t usage_now(void)
 	return (now == 0) ? 1 : now;
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+/* Utilization of something running all the time, the fields keep 10 more bits */
+#define UTIL_SHIFT 10
+#define UTIL_FULL  (K_THREAD_UTIL_SCALE << UTIL_SHIFT)
+
+/* 1 - y in 0.16 fixed point */
+#define UTIL_DECAY_Y1 1404U
+
+/* y^n in 0.32 fixed point, where y^32 = 1/2 */
+static const uint32_t util_decay_y[32] = {
+	0xffffffff, 0xfa83b2db, 0xf5257d15, 0xefe4b99c, 0xeac0c6e8, 0xe5b906e7, 0xe0ccdeec,
+	0xdbfbb798, 0xd744fccb, 0xd2a81d92, 0xce248c15, 0xc9b9bd86, 0xc5672a11, 0xc12c4cca,
+	0xbd08a39f, 0xb8fbaf47, 0xb504f334, 0xb123f582, 0xad583eea, 0xa9a15ab5, 0xa5fed6aa,
+	0xa2704303, 0x9ef53261, 0x9b8d39ba, 0x9837f052, 0x94f4efa9, 0x91c3d374, 0x8ea4398b,
+	0x8b95c1e4, 0x88980e81, 0x85aac368, 0x82cd8699,
+};
+
+static uint32_t util_period(void)
+{
+#ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
+	return timing_freq_get_mhz() * CONFIG_SCHED_THREAD_USAGE_UTIL_PERIOD_US;
+#else
+	return k_us_to_cyc_ceil32(CONFIG_SCHED_THREAD_USAGE_UTIL_PERIOD_US);
+#endif /* CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS */
+}
+
+/* Decays a utilization over a number of cycles */
+static uint32_t util_decay(uint32_t util, uint32_t cycles)
+{
+	uint32_t period = util_period();
+	uint32_t n = cycles / period;
+	uint32_t frac;
+
+	/* Nothing left after halving it for each of its bits */
+	if (n >= 32U * 21U) {
+		return 0;
+	}
+
+	util >>= n / 32U;
+	util = (uint32_t)(((uint64_t)util * util_decay_y[n % 32U]) >> 32);
+
+	/* Linear within a period */
+	frac = (uint32_t)(((uint64_t)(cycles % period) << 16) / period);
+	util -= (uint32_t)(((uint64_t)util * frac * UTIL_DECAY_Y1) >> 32);
+
+	return util;
+}
+
+static uint32_t util_update(uint32_t util, uint32_t cycles, bool running)
+{
+	if (running) {
+		return UTIL_FULL - util_decay(UTIL_FULL - util, cycles);
+	}
+
+	return util_decay(util, cycles);
+}
+
+static bool thread_is_running(struct k_thread *thread)
+{
+#ifdef CONFIG_SMP
+	return _kernel.cpus[thread->base.cpu].current == thread;
+#else
+	return _current == thread;
+#endif /* CONFIG_SMP */
+}
+
+/* Utilization of a thread as of now, the last usage window of a running
+ * thread is accounted for when the window ends.
+ */
+static uint32_t sched_thread_util(struct k_thread *thread)
+{
+	struct k_cycle_stats *usage = &thread->base.usage;
+	uint32_t util = usage->util;
+
+	if (!thread_is_running(thread)) {
+		util = util_decay(util, usage_now() - usage->util_stamp);
+	}
+
+	return util >> UTIL_SHIFT;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
@@ -39,6 +126,11 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 		return;
 	}
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+	cpu->usage->util = util_update(cpu->usage->util, cycles,
+				       cpu->current != cpu->idle_thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
 	if (cpu->current != cpu->idle_thread) {
 		cpu->usage->total += cycles;
 
@@ -62,6 +154,10 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 {
 	thread->base.usage.total += cycles;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+	thread->base.usage.util = util_update(thread->base.usage.util, cycles, true);
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	thread->base.usage.current += cycles;
 
@@ -71,19 +167,177 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/* Last thread switched in on each CPU, i.e. the one being switched out */
+static struct k_thread *latency_prev[CONFIG_MP_MAX_NUM_CPUS];
+
+static void sched_latency_update(struct k_cycle_stats *usage, uint32_t cycles,
+				 bool preempted)
+{
+	unsigned int bucket = 0;
+
+	if (cycles != 0) {
+		bucket = 31U - (unsigned int)u32_count_leading_zeros(cycles);
+	}
+
+	bucket = MIN(bucket, CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS - 1U);
+
+	usage->latency[bucket]++;
+	usage->ready += cycles;
+
+	if (preempted) {
+		usage->preempted += cycles;
+	}
+}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+static void sched_cpu_latency_update(struct _cpu *cpu, uint32_t cycles,
+				     bool preempted)
+{
+	if (cpu->usage->track_usage) {
+		sched_latency_update(cpu->usage, cycles, preempted);
+	}
+}
+
+static void sched_cpu_preempted(struct _cpu *cpu)
+{
+	if (cpu->usage->track_usage) {
+		cpu->usage->num_preemptions++;
+	}
+}
+#else
+#define sched_cpu_latency_update(cpu, cycles, preempted)   do { } while (0)
+#define sched_cpu_preempted(cpu)   do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+
+static void sched_latency_switch(struct _cpu *cpu, struct k_thread *thread,
+				 uint32_t now)
+{
+	struct k_thread *prev = latency_prev[cpu->id];
+	struct k_cycle_stats *usage;
+
+	if (prev == thread) {
+		return;
+	}
+
+	latency_prev[cpu->id] = thread;
+
+	/*
+	 * The outgoing thread is still ready if it was preempted (or
+	 * yielded): its ready window starts now. Otherwise it is going
+	 * to wait and ready_thread() will open its next window.
+	 */
+
+	if ((prev != NULL) && prev->base.usage.track_usage) {
+		usage = &prev->base.usage;
+
+		if (z_is_thread_ready(prev) && !z_is_idle_thread_object(prev)) {
+			usage->ready_stamp = now;
+			usage->was_preempted = true;
+			usage->num_preemptions++;
+			sched_cpu_preempted(cpu);
+		} else {
+			usage->ready_stamp = 0;
+		}
+	}
+
+	usage = &thread->base.usage;
+
+	if (usage->track_usage && (usage->ready_stamp != 0)) {
+		uint32_t cycles = now - usage->ready_stamp;
+
+		sched_latency_update(usage, cycles, usage->was_preempted);
+		sched_cpu_latency_update(cpu, cycles, usage->was_preempted);
+	}
+
+	usage->ready_stamp = 0;
+	usage->was_preempted = false;
+}
+
+static void sched_latency_copy(struct k_thread_runtime_stats *stats,
+			       const struct k_cycle_stats *usage)
+{
+	stats->ready_cycles     = usage->ready;
+	stats->preempted_cycles = usage->preempted;
+	stats->num_preemptions  = usage->num_preemptions;
+	stats->num_ipis         = usage->num_ipis;
+
+	for (unsigned int i = 0;
+	     i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+		stats->latency_hist[i] = usage->latency[i];
+	}
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || \
+	defined(CONFIG_CPU_FREQ_POLICY_UTIL)
+void z_sched_usage_ready(struct k_thread *thread, bool ipi)
+{
+	k_spinlock_key_t  key = k_spin_lock(&usage_lock);
+	struct k_cycle_stats *usage = &thread->base.usage;
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	if (usage->track_usage && !z_is_idle_thread_object(thread)) {
+		usage->ready_stamp = usage_now();
+		usage->was_preempted = false;
+
+		if (ipi) {
+			usage->num_ipis++;
+		}
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (ipi && _current_cpu->usage->track_usage) {
+		_current_cpu->usage->num_ipis++;
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+#else
+	ARG_UNUSED(ipi);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#ifdef CONFIG_CPU_FREQ_POLICY_UTIL
+	uint32_t util = usage->track_usage ? sched_thread_util(thread) : 0U;
+#endif /* CONFIG_CPU_FREQ_POLICY_UTIL */
+
+	k_spin_unlock(&usage_lock, key);
+
+#ifdef CONFIG_CPU_FREQ_POLICY_UTIL
+	/* Lets the policy ramp the frequency up before the thread runs */
+	cpu_freq_policy_thread_ready(thread, util);
+#endif /* CONFIG_CPU_FREQ_POLICY_UTIL */
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY || CONFIG_CPU_FREQ_POLICY_UTIL */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
-#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+#if defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) || \
+	defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || \
+	defined(CONFIG_SCHED_THREAD_USAGE_UTIL)
 	k_spinlock_key_t  key;
 
 	key = k_spin_lock(&usage_lock);
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+	/* The thread did not run since its last usage window */
+	if (thread->base.usage.track_usage) {
+		thread->base.usage.util =
+			util_update(thread->base.usage.util,
+				    _current_cpu->usage0 - thread->base.usage.util_stamp, false);
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
 	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	sched_latency_switch(_current_cpu, thread, _current_cpu->usage0);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 
 	k_spin_unlock(&usage_lock, key);
 #else
@@ -105,10 +359,14 @@ void z_sched_usage_stop(void)
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t now = usage_now();
+		uint32_t cycles = now - u0;
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+			cpu->current->base.usage.util_stamp = now;
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
 		}
 
 		sched_cpu_update_usage(cpu, cycles);
@@ -160,6 +418,14 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	sched_latency_copy(stats, cpu->usage);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+	stats->util = cpu->usage->util >> UTIL_SHIFT;
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
@@ -216,6 +482,14 @@ void z_sched_thread_usage(struct k_thread *thread,
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	sched_latency_copy(stats, &thread->base.usage);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+	stats->util = sched_thread_util(thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
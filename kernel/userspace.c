@@ -169,6 +169,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	struct rbnode node;
 
 	/* The object itself */
 	void *data;
@@ -184,9 +185,25 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
+static bool dyn_obj_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return (uintptr_t)CONTAINER_OF(a, struct dyn_obj, node)->kobj.name <
+	       (uintptr_t)CONTAINER_OF(b, struct dyn_obj, node)->kobj.name;
+}
+
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Tree of the same objects sorted by address, so that looking up an object
+ * during syscall validation does not depend on the number of objects.
  */
+static struct rbtree obj_rb_tree = {
+	.lessthan_fn = dyn_obj_lessthan
+};
+
+static void dyn_obj_unlink(struct dyn_obj *dyn)
+{
+	sys_dlist_remove(&dyn->dobj_list);
+	rb_remove(&obj_rb_tree, &dyn->node);
+}
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -224,29 +241,31 @@ static size_t obj_align_get(enum k_objects otype)
 
 static struct dyn_obj *dyn_object_find(const void *obj)
 {
-	struct dyn_obj *node;
+	struct dyn_obj *dyn = NULL;
+	struct rbnode *node;
 	k_spinlock_key_t key;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
 	key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
-		if (node->kobj.name == obj) {
-			goto end;
+	/* Descend the tree the way rb_insert() placed the objects */
+	node = obj_rb_tree.root;
+	while (node != NULL) {
+		dyn = CONTAINER_OF(node, struct dyn_obj, node);
+		if (dyn->kobj.name == obj) {
+			break;
 		}
+
+		node = z_rb_child(node, ((uintptr_t)obj < (uintptr_t)dyn->kobj.name) ? 0U : 1U);
 	}
 
-	/* No object found */
-	node = NULL;
+	if (node == NULL) {
+		/* No object found */
+		dyn = NULL;
+	}
 
- end:
 	k_spin_unlock(&lists_lock, key);
 
-	return node;
+	return dyn;
 }
 
 /**
@@ -376,6 +395,7 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	rb_insert(&obj_rb_tree, &dyn->node);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -469,7 +489,7 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		sys_dlist_remove(&dyn->dobj_list);
+		dyn_obj_unlink(dyn);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -601,7 +621,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
-	sys_dlist_remove(&dyn->dobj_list);
+	dyn_obj_unlink(dyn);
 	k_free(dyn->data);
 	k_free(dyn);
 out:
@@ -87,3 +87,43 @@ static inline void *z_vrfy_k_object_alloc_size(enum k_objects otype, size_t size
 	return z_impl_k_object_alloc_size(otype, size);
 }
 #include <zephyr/syscalls/k_object_alloc_size_mrsh.c>
+
+#ifdef CONFIG_SYSCALL_BATCH
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	/* Supervisor threads have no privilege transition to save, and the
+	 * handlers would validate the arguments against their permissions.
+	 */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	void *ssf = _current->syscall_frame;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(entries, count, sizeof(*entries)));
+
+	for (size_t i = 0; i < count; i++) {
+		struct k_syscall_batch_entry entry = entries[i];
+
+		K_OOPS(K_SYSCALL_VERIFY_MSG((entry.id < K_SYSCALL_LIMIT) &&
+					    (entry.id != K_SYSCALL_K_SYSCALL_BATCH),
+					    "invalid syscall %lu in batch",
+					    (unsigned long)entry.id));
+
+		entries[i].ret = _k_syscall_table[entry.id](entry.args[0], entry.args[1],
+							    entry.args[2], entry.args[3],
+							    entry.args[4], entry.args[5], ssf);
+
+		/* The handler cleared the frame when returning */
+		_current->syscall_frame = ssf;
+	}
+
+	return 0;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
+#endif /* CONFIG_SYSCALL_BATCH */
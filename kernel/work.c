@@ -193,6 +193,19 @@ static void queue_flusher_locked(struct k_work_q *queue,
 {
 	init_flusher(flusher);
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+	flusher->target = work;
+
+	/* Another worker may pick up anything at the head of the queue
+	 * while the item is still running, so park the flusher until the
+	 * running invocation completes instead.
+	 */
+	if ((flags_get(&work->flags) & K_WORK_QUEUED) == 0U) {
+		sys_slist_append(&queue->parked, &flusher->work.node);
+		return;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -201,6 +214,102 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	}
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+/* Determine whether a thread is one of the threads servicing a queue.
+ *
+ * Invoked with work lock held.
+ */
+static bool queue_is_worker_locked(struct k_work_q *queue, k_tid_t thread)
+{
+	struct k_work_q_worker *worker;
+
+	if (thread == queue->thread_id) {
+		return true;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (thread == &worker->thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Take the next item a worker may process from the queue.
+ *
+ * Items still running on another worker are left in place, so a work
+ * item never runs reentrantly: the worker running it picks up the
+ * resubmission when the handler returns.  Flushers for such items are
+ * left in place as well, since they must follow the queued instance.
+ *
+ * A flusher found after its target has been dequeued is parked until
+ * the target's handler completes, see release_flushers_locked().
+ *
+ * Invoked with work lock held.
+ *
+ * @return the next work item, or NULL if there is none.
+ */
+static struct k_work *queue_get_locked(struct k_work_q *queue)
+{
+	sys_snode_t *node, *next, *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_NODE_SAFE(&queue->pending, node, next) {
+		struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+		uint32_t target_flags = 0U;
+
+		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+			struct z_work_flusher *flusher
+				= CONTAINER_OF(work, struct z_work_flusher, work);
+
+			target_flags = flags_get(&flusher->target->flags);
+		}
+
+		if (flag_test(&work->flags, K_WORK_RUNNING_BIT)
+		    || ((target_flags & K_WORK_QUEUED) != 0U)) {
+			prev = node;
+			continue;
+		}
+
+		sys_slist_remove(&queue->pending, prev, node);
+
+		if ((target_flags & K_WORK_RUNNING) != 0U) {
+			sys_slist_append(&queue->parked, node);
+			continue;
+		}
+
+		return work;
+	}
+
+	return NULL;
+}
+
+/* Complete the flushers waiting for a work item that finished running.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue that ran the work item
+ * @param work the work item that completed
+ */
+static void release_flushers_locked(struct k_work_q *queue,
+				    struct k_work *work)
+{
+	struct z_work_flusher *flusher, *tmp;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&queue->parked, flusher, tmp,
+					  work.node) {
+		if (flusher->target == work) {
+			sys_slist_remove(&queue->parked, prev,
+					 &flusher->work.node);
+			finalize_flush_locked(&flusher->work);
+		} else {
+			prev = &flusher->work.node;
+		}
+	}
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 /* Try to remove a work item from the given queue.
  *
  * Invoked with work lock held.
@@ -265,7 +374,11 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
+#if defined(CONFIG_WORKQUEUE_POOL)
+	bool chained = !k_is_in_isr() && queue_is_worker_locked(queue, _current);
+#else
 	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -422,6 +535,50 @@ int k_work_submit(struct k_work *work)
 	return ret;
 }
 
+int k_work_submit_batch_to_queue(struct k_work_q *queue,
+				 struct k_work *const *work, size_t count)
+{
+	__ASSERT_NO_MSG((work != NULL) || (count == 0U));
+
+	int queued = 0;
+	int err = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < count; i++) {
+		/* Each item may be redirected (e.g. to the queue running
+		 * it), so resolve the target per item.
+		 */
+		struct k_work_q *target = queue;
+
+		__ASSERT_NO_MSG(work[i] != NULL);
+		__ASSERT_NO_MSG(work[i]->handler != NULL);
+
+		int rc = submit_to_queue_locked(work[i], &target);
+
+		if (rc > 0) {
+			queued++;
+		} else if ((rc < 0) && (err == 0)) {
+			err = rc;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	/* Only the first submission to an idle queue actually wakes its
+	 * thread, so a single reschedule covers the whole batch.
+	 */
+	if (queued > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return (err != 0) ? err : queued;
+}
+
+int k_work_submit_batch(struct k_work *const *work, size_t count)
+{
+	return k_work_submit_batch_to_queue(&k_sys_work_q, work, count);
+}
+
 /* Flush the work item if necessary.
  *
  * Flushing is necessary only if the work is either queued or running.
@@ -667,12 +824,20 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
+#if defined(CONFIG_WORKQUEUE_POOL)
+		work = queue_get_locked(queue);
+		node = (work != NULL) ? &work->node : NULL;
+#else
 		node = sys_slist_get(&queue->pending);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#if defined(CONFIG_WORKQUEUE_POOL)
+			queue->nbusy++;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -690,8 +855,20 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
+#if defined(CONFIG_WORKQUEUE_POOL)
+		} else if (flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+			   && !flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+			/* Other workers are still running items: the last
+			 * one to go idle completes any drain.
+			 */
+			;
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+			   && flag_test_and_clear(&queue->flags,
+						  K_WORK_QUEUE_DRAIN_BIT)) {
+#else
 		} else if (flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
 			 * immediate reschedule; released threads get their
@@ -705,6 +882,13 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#if defined(CONFIG_WORKQUEUE_POOL)
+			/* The last worker to exit clears the status flags. */
+			if (--queue->nthreads != 0U) {
+				k_spin_unlock(&lock, key);
+				return;
+			}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 			flags_set(&queue->flags, 0);
 			k_spin_unlock(&lock, key);
 			return;
@@ -755,7 +939,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+		release_flushers_locked(queue, work);
+		if (--queue->nbusy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -804,6 +995,12 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	sys_slist_init(&queue->workers);
+	sys_slist_init(&queue->parked);
+	queue->nthreads = 1U;
+	queue->nbusy = 0U;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	queue->thread_id = _current;
 	flags_set(&queue->flags, flags);
 	work_queue_main(queue, NULL, NULL);
@@ -826,6 +1023,12 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	sys_slist_init(&queue->workers);
+	sys_slist_init(&queue->parked);
+	queue->nthreads = 1U;
+	queue->nbusy = 0U;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -863,6 +1066,59 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, int cpu)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(worker);
+	__ASSERT_NO_MSG(stack);
+
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT)
+	    || flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+		ret = -ENODEV;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	(void)k_thread_create(&worker->thread, stack, stack_size,
+			      work_queue_main, queue, NULL, NULL,
+			      prio, 0, K_FOREVER);
+
+	const char *name = k_thread_name_get(queue->thread_id);
+
+	if (name != NULL) {
+		(void)k_thread_name_set(&worker->thread, name);
+	}
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(&worker->thread, cpu);
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif /* defined(CONFIG_SCHED_CPU_MASK) */
+
+	key = k_spin_lock(&lock);
+	sys_slist_append(&queue->workers, &worker->node);
+	queue->nthreads++;
+	k_spin_unlock(&lock, key);
+
+	k_thread_start(&worker->thread);
+
+	return 0;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -915,6 +1171,35 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* Wait for all threads servicing a stopping queue to exit.
+ *
+ * @retval 0 if all threads exited
+ * @retval -EAGAIN if the timeout expired first
+ */
+static int queue_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_work_q_worker *worker;
+	int ret = k_thread_join(queue->thread_id, timeout);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (ret != 0) {
+			break;
+		}
+		ret = k_thread_join(&worker->thread, sys_timepoint_timeout(end));
+	}
+
+	if (ret == 0) {
+		sys_slist_init(&queue->workers);
+	}
+
+	return ret;
+#else
+	return k_thread_join(queue->thread_id, timeout);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
@@ -940,10 +1225,14 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+#else
 	notify_queue_locked(queue);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+	if (queue_join(queue, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
@@ -0,0 +1,44 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/arena.h>
+
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes)
+{
+	arena->base = mem;
+	arena->size = bytes;
+	arena->used = 0;
+	arena->max_used = 0;
+	arena->heap = NULL;
+}
+
+int sys_arena_init_from_heap(struct sys_arena *arena, struct k_heap *heap,
+			     size_t bytes, k_timeout_t timeout)
+{
+	void *mem = k_heap_aligned_alloc(heap, SYS_ARENA_ALIGN, bytes, timeout);
+
+	if (mem == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_arena_init(arena, mem, bytes);
+	arena->heap = heap;
+
+	return 0;
+}
+
+void sys_arena_deinit(struct sys_arena *arena)
+{
+	if (arena->heap != NULL) {
+		k_heap_free(arena->heap, arena->base);
+	}
+
+	arena->base = NULL;
+	arena->size = 0;
+	arena->used = 0;
+	arena->heap = NULL;
+}
@@ -151,6 +151,126 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+BUILD_ASSERT((CONFIG_SYS_HEAP_SIZE_CLASS_MAX % CHUNK_UNIT) == 0,
+	     "CONFIG_SYS_HEAP_SIZE_CLASS_MAX must be a multiple of 8");
+
+/* Pop a chunk of exactly "sz" units from its size class list, if any.
+ * The chunk is still marked used, so there is nothing to split.
+ */
+static chunkid_t size_class_alloc(struct z_heap *h, chunksz_t sz)
+{
+	struct z_heap_size_classes *sc = size_classes(h);
+	int idx = sz - 1;
+
+	if ((sc == NULL) || (sz > SIZE_CLASS_COUNT) ||
+	    ((sc->avail & BIT(idx)) == 0U)) {
+		return 0;
+	}
+
+	chunkid_t c = sc->next[idx];
+
+	CHECK(chunk_used(h, c));
+	CHECK(chunk_size(h, c) == sz);
+
+	sc->next[idx] = next_free_chunk(h, c);
+	if (sc->next[idx] == 0U) {
+		sc->avail &= ~BIT(idx);
+	}
+	sc->cached -= sz;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+
+	return c;
+}
+
+/* Park a freed chunk on its size class list instead of merging it
+ * back into the buckets.  Returns false if the chunk is too big or
+ * the cache already holds an eighth of the heap.
+ */
+static bool size_class_free(struct z_heap *h, chunkid_t c)
+{
+	struct z_heap_size_classes *sc = size_classes(h);
+	chunksz_t sz = chunk_size(h, c);
+	int idx = sz - 1;
+
+	if ((sc == NULL) || (sz > SIZE_CLASS_COUNT) ||
+	    ((sc->cached + sz) > (h->end_chunk / 8U))) {
+		return false;
+	}
+
+	set_next_free_chunk(h, c, (sc->avail & BIT(idx)) ? sc->next[idx] : 0);
+	sc->next[idx] = c;
+	sc->avail |= BIT(idx);
+	sc->cached += sz;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+
+	return true;
+}
+
+/* Return every cached chunk to the regular free lists so that they
+ * can be merged and reused for other sizes.  Returns false if there
+ * was nothing to flush.
+ */
+static bool size_class_flush(struct z_heap *h)
+{
+	struct z_heap_size_classes *sc = size_classes(h);
+
+	if ((sc == NULL) || (sc->avail == 0U)) {
+		return false;
+	}
+
+	while (sc->avail != 0U) {
+		int idx = __builtin_ctz(sc->avail);
+		chunkid_t c = sc->next[idx];
+
+		sc->next[idx] = next_free_chunk(h, c);
+		if (sc->next[idx] == 0U) {
+			sc->avail &= ~BIT(idx);
+		}
+		sc->cached -= chunk_size(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		/* free_chunk() accounts for it again */
+		h->free_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
+		set_chunk_used(h, c, false);
+		free_chunk(h, c);
+	}
+
+	return true;
+}
+#else
+static inline chunkid_t size_class_alloc(struct z_heap *h, chunksz_t sz)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(sz);
+
+	return 0;
+}
+
+static inline bool size_class_free(struct z_heap *h, chunkid_t c)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(c);
+
+	return false;
+}
+
+static inline bool size_class_flush(struct z_heap *h)
+{
+	ARG_UNUSED(h);
+
+	return false;
+}
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -187,7 +307,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -197,6 +316,11 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	if (size_class_free(h, c)) {
+		return;
+	}
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -273,19 +397,25 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes, 0);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = size_class_alloc(h, chunk_sz);
 
 	if (c == 0U) {
-		return NULL;
-	}
+		c = alloc_chunk(h, chunk_sz);
+		if ((c == 0U) && size_class_flush(h)) {
+			c = alloc_chunk(h, chunk_sz);
+		}
+		if (c == 0U) {
+			return NULL;
+		}
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
-	}
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
 
-	set_chunk_used(h, c, true);
+		set_chunk_used(h, c, true);
+	}
 
 	mem = chunk_mem(h, c);
 
@@ -346,6 +476,9 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes, align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
+	if ((c0 == 0) && size_class_flush(h)) {
+		c0 = alloc_chunk(h, padded_sz);
+	}
 	if (c0 == 0) {
 		return NULL;
 	}
@@ -525,6 +658,34 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	return ptr2;
 }
 
+#ifdef CONFIG_SYS_HEAP_RELOC
+void *z_heap_slide_left(struct sys_heap *heap, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, mem);
+	chunkid_t lc = left_chunk(h, c);
+	chunksz_t sz = chunk_size(h, c);
+
+	CHECK(chunk_mem(h, c) == mem);
+
+	if (chunk_used(h, lc)) {
+		return NULL;
+	}
+
+	/* Take the free chunk on the left, move the data to its start
+	 * and free what is left over on the right.
+	 */
+	free_list_remove(h, lc);
+	merge_chunks(h, lc, c);
+	(void)memmove(chunk_mem(h, lc), mem, chunksz_to_bytes(h, sz));
+	split_chunks(h, lc, lc + sz);
+	set_chunk_used(h, lc, true);
+	free_chunk(h, lc + sz);
+
+	return chunk_mem(h, lc);
+}
+#endif /* CONFIG_SYS_HEAP_RELOC */
+
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
 	IF_ENABLED(CONFIG_MSAN, (__sanitizer_dtor_callback(mem, bytes)));
@@ -565,8 +726,20 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 #endif
 
 	int nb_buckets = bucket_idx(h, heap_sz) + 1;
-	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) +
-				     nb_buckets * sizeof(struct z_heap_bucket));
+	size_t chunk0_bytes = sizeof(struct z_heap) +
+			      nb_buckets * sizeof(struct z_heap_bucket);
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	struct z_heap_size_classes *sc = size_classes(h);
+
+	if (sc != NULL) {
+		sc->avail = 0;
+		sc->cached = 0;
+		chunk0_bytes += sizeof(*sc);
+	}
+#endif
+
+	chunksz_t chunk0_size = chunksz(chunk0_bytes);
 
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
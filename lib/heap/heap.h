@@ -264,6 +264,33 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* Optional front-end of exact-size class lists, one per chunk size
+ * from 1 to SIZE_CLASS_COUNT units.  The table lives in chunk0 right
+ * after the bucket array, and only heaps of at least
+ * SIZE_CLASS_MIN_HEAP_CHUNKS get one.  Chunks on a class list keep
+ * their "used" bit set and are singly linked through FREE_NEXT, with
+ * zero terminating the list.
+ */
+#define SIZE_CLASS_COUNT (CONFIG_SYS_HEAP_SIZE_CLASS_MAX / CHUNK_UNIT)
+#define SIZE_CLASS_MIN_HEAP_CHUNKS (16U * SIZE_CLASS_COUNT)
+
+struct z_heap_size_classes {
+	uint32_t avail;
+	chunksz_t cached;
+	chunkid_t next[SIZE_CLASS_COUNT];
+};
+
+static inline struct z_heap_size_classes *size_classes(struct z_heap *h)
+{
+	if (h->end_chunk < SIZE_CLASS_MIN_HEAP_CHUNKS) {
+		return NULL;
+	}
+	return (struct z_heap_size_classes *)
+		&h->buckets[bucket_idx(h, h->end_chunk) + 1];
+}
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -279,6 +306,23 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Chunks cached on the class lists look used but count as free */
+	struct z_heap_size_classes *sc = size_classes(h);
+
+	if (sc != NULL) {
+		*alloc_bytes -= chunksz_to_bytes(h, sc->cached);
+		*free_bytes += chunksz_to_bytes(h, sc->cached);
+	}
+#endif
 }
 
+#ifdef CONFIG_SYS_HEAP_RELOC
+/* Move the allocation at mem into the free chunk on its left, if there
+ * is one. Returns the new address, or NULL if it was not moved.
+ */
+void *z_heap_slide_left(struct sys_heap *heap, void *mem);
+#endif /* CONFIG_SYS_HEAP_RELOC */
+
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -0,0 +1,339 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/hash_function.h>
+#include <zephyr/sys/heap_listener.h>
+#include <zephyr/sys/heap_profiler.h>
+#include <zephyr/stats/stats.h>
+
+#define NUM_SITES  CONFIG_SYS_HEAP_PROFILER_SITES
+#define NUM_ALLOCS CONFIG_SYS_HEAP_PROFILER_ALLOCS
+
+BUILD_ASSERT(IS_POWER_OF_TWO(NUM_SITES), "site table size must be a power of 2");
+BUILD_ASSERT(IS_POWER_OF_TWO(NUM_ALLOCS), "allocation table size must be a power of 2");
+BUILD_ASSERT(NUM_SITES < UINT16_MAX);
+
+/* Site table entries are never removed, so an unused entry ends probes */
+#define SITE_UNUSED(s) ((s)->allocs == 0U)
+
+/*
+ * Live allocation, pointing at its site. Same address entries may exist
+ * briefly, as in place reallocation reports the new allocation before
+ * freeing the old one. Linear probing keeps them in insertion order.
+ */
+struct live_alloc {
+	void *mem;
+	uint16_t site;
+};
+
+#define NO_SITE UINT16_MAX
+
+struct profiled_heap {
+	struct sys_heap *heap;
+	struct heap_listener alloc_listener;
+	struct heap_listener free_listener;
+};
+
+static struct k_spinlock lock;
+static struct sys_heap_profiler_site sites[NUM_SITES];
+static struct live_alloc live[NUM_ALLOCS];
+static struct sys_heap_profiler_stats totals;
+static struct profiled_heap heaps[CONFIG_SYS_HEAP_PROFILER_HEAPS];
+
+#ifdef CONFIG_STATS
+STATS_SECT_START(heap_prof)
+STATS_SECT_ENTRY32(allocs)
+STATS_SECT_ENTRY32(frees)
+STATS_SECT_ENTRY32(live_bytes)
+STATS_SECT_ENTRY32(peak_bytes)
+STATS_SECT_ENTRY32(untracked)
+STATS_SECT_ENTRY32(dropped)
+STATS_SECT_END;
+
+STATS_NAME_START(heap_prof)
+STATS_NAME(heap_prof, allocs)
+STATS_NAME(heap_prof, frees)
+STATS_NAME(heap_prof, live_bytes)
+STATS_NAME(heap_prof, peak_bytes)
+STATS_NAME(heap_prof, untracked)
+STATS_NAME(heap_prof, dropped)
+STATS_NAME_END(heap_prof);
+
+static STATS_SECT_DECL(heap_prof) heap_prof;
+
+static void update_stats(void)
+{
+	STATS_SET(heap_prof, allocs, totals.allocs);
+	STATS_SET(heap_prof, frees, totals.frees);
+	STATS_SET(heap_prof, live_bytes, totals.live_bytes);
+	STATS_SET(heap_prof, peak_bytes, totals.peak_bytes);
+	STATS_SET(heap_prof, untracked, totals.untracked);
+	STATS_SET(heap_prof, dropped, totals.dropped);
+}
+
+static int heap_profiler_stats_init(void)
+{
+	return STATS_INIT_AND_REG(heap_prof, STATS_SIZE_32, "heap_prof");
+}
+
+SYS_INIT(heap_profiler_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#else
+static inline void update_stats(void)
+{
+}
+#endif /* CONFIG_STATS */
+
+static inline uint32_t hash_ptr(const void *ptr)
+{
+	return sys_hash32(&ptr, sizeof(ptr));
+}
+
+static unsigned int hist_bucket(size_t bytes)
+{
+	unsigned int n = 0;
+
+	while ((n < SYS_HEAP_PROFILER_HIST_BUCKETS - 1) &&
+	       (bytes > SYS_HEAP_PROFILER_HIST_LIMIT(n))) {
+		n++;
+	}
+
+	return n;
+}
+
+static uint16_t site_get(uintptr_t heap_id, const struct k_thread *thread)
+{
+	uintptr_t key = heap_id ^ ((uintptr_t)thread * 0x9e3779b1U);
+	uint32_t idx = sys_hash32(&key, sizeof(key));
+
+	for (unsigned int n = 0; n < NUM_SITES; n++, idx++) {
+		struct sys_heap_profiler_site *s = &sites[idx & (NUM_SITES - 1)];
+
+		if (SITE_UNUSED(s)) {
+			s->heap_id = heap_id;
+			s->thread = thread;
+			return idx & (NUM_SITES - 1);
+		}
+		if ((s->heap_id == heap_id) && (s->thread == thread)) {
+			return idx & (NUM_SITES - 1);
+		}
+	}
+
+	return NO_SITE;
+}
+
+static bool live_insert(void *mem, uint16_t site)
+{
+	uint32_t idx = hash_ptr(mem);
+
+	for (unsigned int n = 0; n < NUM_ALLOCS; n++, idx++) {
+		struct live_alloc *a = &live[idx & (NUM_ALLOCS - 1)];
+
+		if (a->mem == NULL) {
+			a->mem = mem;
+			a->site = site;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Remove the oldest entry for mem, returning its site */
+static bool live_remove(void *mem, uint16_t *site)
+{
+	uint32_t mask = NUM_ALLOCS - 1;
+	uint32_t i = hash_ptr(mem) & mask;
+
+	for (unsigned int n = 0; live[i].mem != mem; n++) {
+		if ((live[i].mem == NULL) || (n == NUM_ALLOCS)) {
+			return false;
+		}
+		i = (i + 1) & mask;
+	}
+
+	*site = live[i].site;
+
+	/* Backward shift deletion, so no tombstones are needed */
+	for (uint32_t n = 1, j = (i + 1) & mask; (n < NUM_ALLOCS) && (live[j].mem != NULL);
+	     n++, j = (j + 1) & mask) {
+		uint32_t home = hash_ptr(live[j].mem) & mask;
+
+		/* Move j into the hole at i unless its home is in (i, j] */
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			live[i] = live[j];
+			i = j;
+		}
+	}
+	live[i].mem = NULL;
+
+	return true;
+}
+
+static void on_alloc(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	const struct k_thread *thread = NULL;
+	struct sys_heap_profiler_site *s = NULL;
+	k_spinlock_key_t key;
+	uint16_t site;
+
+	if (!k_is_in_isr() && !k_is_pre_kernel()) {
+		thread = k_current_get();
+	}
+
+	key = k_spin_lock(&lock);
+
+	totals.allocs++;
+
+	site = site_get(heap_id, thread);
+	if (site == NO_SITE) {
+		totals.dropped++;
+	} else {
+		s = &sites[site];
+		s->allocs++;
+		s->hist[hist_bucket(bytes)]++;
+	}
+
+	if (live_insert(mem, site)) {
+		totals.live_bytes += bytes;
+		totals.peak_bytes = MAX(totals.peak_bytes, totals.live_bytes);
+		if (s != NULL) {
+			s->live_bytes += bytes;
+			s->peak_bytes = MAX(s->peak_bytes, s->live_bytes);
+		}
+	} else {
+		totals.untracked++;
+	}
+
+	update_stats();
+
+	k_spin_unlock(&lock, key);
+}
+
+static void on_free(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	k_spinlock_key_t key;
+	uint16_t site;
+
+	ARG_UNUSED(heap_id);
+
+	key = k_spin_lock(&lock);
+
+	totals.frees++;
+
+	/* Allocations made before attaching or resetting are not known */
+	if (live_remove(mem, &site)) {
+		totals.live_bytes -= bytes;
+		if (site != NO_SITE) {
+			sites[site].frees++;
+			sites[site].live_bytes -= bytes;
+		}
+	}
+
+	update_stats();
+
+	k_spin_unlock(&lock, key);
+}
+
+int sys_heap_profiler_attach(struct sys_heap *heap)
+{
+	struct profiled_heap *slot = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ARRAY_FOR_EACH_PTR(heaps, p) {
+		if (p->heap == heap) {
+			k_spin_unlock(&lock, key);
+			return -EALREADY;
+		}
+		if ((p->heap == NULL) && (slot == NULL)) {
+			slot = p;
+		}
+	}
+
+	if (slot == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOMEM;
+	}
+
+	slot->heap = heap;
+
+	k_spin_unlock(&lock, key);
+
+	/* Listeners are called with the listener lock held, so register
+	 * them outside of the profiler lock.
+	 */
+	slot->alloc_listener.heap_id = HEAP_ID_FROM_POINTER(heap);
+	slot->alloc_listener.event = HEAP_ALLOC;
+	slot->alloc_listener.alloc_cb = on_alloc;
+	heap_listener_register(&slot->alloc_listener);
+
+	slot->free_listener.heap_id = HEAP_ID_FROM_POINTER(heap);
+	slot->free_listener.event = HEAP_FREE;
+	slot->free_listener.free_cb = on_free;
+	heap_listener_register(&slot->free_listener);
+
+	return 0;
+}
+
+void sys_heap_profiler_detach(struct sys_heap *heap)
+{
+	k_spinlock_key_t key;
+
+	ARRAY_FOR_EACH_PTR(heaps, p) {
+		if (p->heap != heap) {
+			continue;
+		}
+
+		heap_listener_unregister(&p->alloc_listener);
+		heap_listener_unregister(&p->free_listener);
+
+		key = k_spin_lock(&lock);
+		p->heap = NULL;
+		k_spin_unlock(&lock, key);
+		break;
+	}
+}
+
+void sys_heap_profiler_foreach(sys_heap_profiler_cb_t cb, void *user_data)
+{
+	struct sys_heap_profiler_site site;
+	k_spinlock_key_t key;
+
+	for (unsigned int i = 0; i < NUM_SITES; i++) {
+		key = k_spin_lock(&lock);
+		site = sites[i];
+		k_spin_unlock(&lock, key);
+
+		if (!SITE_UNUSED(&site)) {
+			cb(&site, user_data);
+		}
+	}
+}
+
+void sys_heap_profiler_stats_get(struct sys_heap_profiler_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = totals;
+
+	k_spin_unlock(&lock, key);
+}
+
+void sys_heap_profiler_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(sites, 0, sizeof(sites));
+	memset(live, 0, sizeof(live));
+	memset(&totals, 0, sizeof(totals));
+	update_stats();
+
+	k_spin_unlock(&lock, key);
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/heap_reloc.h>
+#include "heap.h"
+
+/*
+ * Each object starts with the index of its handle, so that compaction
+ * can tell which handle to update when walking the chunks. The padding
+ * keeps objects as aligned as plain sys_heap allocations.
+ */
+struct reloc_hdr {
+	uint32_t handle;
+	uint32_t pad;
+};
+
+static inline void *chunk_addr(struct z_heap *h, chunkid_t c)
+{
+	return (uint8_t *)&chunk_buf(h)[c] + chunk_header_bytes(h);
+}
+
+static inline chunkid_t addr_chunk(struct z_heap *h, void *mem)
+{
+	uint8_t *p = (uint8_t *)mem - chunk_header_bytes(h);
+
+	return (p - (uint8_t *)chunk_buf(h)) / CHUNK_UNIT;
+}
+
+static inline struct sys_heap_reloc_slot *slot_get(struct sys_heap_reloc *rheap, int handle)
+{
+	__ASSERT((handle >= 0) && (handle < rheap->num_slots), "invalid handle %d", handle);
+	__ASSERT(rheap->slots[handle].mem != NULL, "handle %d is not allocated", handle);
+
+	return &rheap->slots[handle];
+}
+
+void sys_heap_reloc_init(struct sys_heap_reloc *rheap, void *mem, size_t bytes,
+			 struct sys_heap_reloc_slot *slots, uint16_t num_slots)
+{
+	sys_heap_init(&rheap->heap, mem, bytes);
+	rheap->slots = slots;
+	rheap->num_slots = num_slots;
+
+	for (uint16_t i = 0; i < num_slots; i++) {
+		slots[i].mem = NULL;
+		slots[i].pins = 0U;
+	}
+}
+
+int sys_heap_reloc_alloc(struct sys_heap_reloc *rheap, size_t bytes)
+{
+	k_spinlock_key_t key = k_spin_lock(&rheap->lock);
+	struct reloc_hdr *hdr;
+	int handle = -ENOSPC;
+
+	for (uint16_t i = 0; i < rheap->num_slots; i++) {
+		if (rheap->slots[i].mem == NULL) {
+			handle = i;
+			break;
+		}
+	}
+
+	if (handle < 0) {
+		goto out;
+	}
+
+	if (bytes > SIZE_MAX - sizeof(*hdr)) {
+		handle = -ENOMEM;
+		goto out;
+	}
+
+	hdr = sys_heap_alloc(&rheap->heap, bytes + sizeof(*hdr));
+	if (hdr == NULL) {
+		handle = -ENOMEM;
+		goto out;
+	}
+
+	hdr->handle = handle;
+	rheap->slots[handle].mem = hdr;
+	rheap->slots[handle].pins = 0U;
+
+out:
+	k_spin_unlock(&rheap->lock, key);
+
+	return handle;
+}
+
+void sys_heap_reloc_free(struct sys_heap_reloc *rheap, int handle)
+{
+	k_spinlock_key_t key = k_spin_lock(&rheap->lock);
+	struct sys_heap_reloc_slot *slot = slot_get(rheap, handle);
+
+	__ASSERT(slot->pins == 0U, "freeing pinned handle %d", handle);
+
+	sys_heap_free(&rheap->heap, slot->mem);
+	slot->mem = NULL;
+
+	k_spin_unlock(&rheap->lock, key);
+}
+
+void *sys_heap_reloc_pin(struct sys_heap_reloc *rheap, int handle)
+{
+	k_spinlock_key_t key = k_spin_lock(&rheap->lock);
+	struct sys_heap_reloc_slot *slot = slot_get(rheap, handle);
+
+	__ASSERT(slot->pins < UINT16_MAX, "too many pins on handle %d", handle);
+
+	slot->pins++;
+
+	k_spin_unlock(&rheap->lock, key);
+
+	return (struct reloc_hdr *)slot->mem + 1;
+}
+
+void sys_heap_reloc_unpin(struct sys_heap_reloc *rheap, int handle)
+{
+	k_spinlock_key_t key = k_spin_lock(&rheap->lock);
+	struct sys_heap_reloc_slot *slot = slot_get(rheap, handle);
+
+	__ASSERT(slot->pins > 0U, "handle %d is not pinned", handle);
+
+	slot->pins--;
+
+	k_spin_unlock(&rheap->lock, key);
+}
+
+/* Return the handle owning the allocation in chunk c if it can be moved */
+static int movable_handle(struct sys_heap_reloc *rheap, chunkid_t c)
+{
+	struct z_heap *h = rheap->heap.heap;
+	struct reloc_hdr *hdr = chunk_addr(h, c);
+	struct sys_heap_reloc_slot *slot;
+
+	if (!chunk_used(h, c) || chunk_used(h, left_chunk(h, c))) {
+		return -1;
+	}
+
+	/* Chunks cached by other code paths hold stale headers, only
+	 * trust the header if its handle points back at this chunk.
+	 */
+	if (hdr->handle >= rheap->num_slots) {
+		return -1;
+	}
+
+	slot = &rheap->slots[hdr->handle];
+	if ((slot->mem != hdr) || (slot->pins != 0U)) {
+		return -1;
+	}
+
+	return hdr->handle;
+}
+
+size_t sys_heap_reloc_compact(struct sys_heap_reloc *rheap, size_t max_moves)
+{
+	struct z_heap *h = rheap->heap.heap;
+	void *resume = NULL;
+	int last = -1;
+	size_t moved = 0;
+
+	while (moved < max_moves) {
+		k_spinlock_key_t key = k_spin_lock(&rheap->lock);
+		chunkid_t c = right_chunk(h, 0);
+		int handle = -1;
+		void *mem;
+
+		/* Chunk ids from before the lock was released can't be
+		 * trusted, but the last moved object is a valid chunk to
+		 * continue from if its handle still points to it.
+		 */
+		if ((last >= 0) && (rheap->slots[last].mem == resume)) {
+			c = addr_chunk(h, resume);
+		}
+
+		for (; c < h->end_chunk; c = right_chunk(h, c)) {
+			handle = movable_handle(rheap, c);
+			if (handle >= 0) {
+				break;
+			}
+		}
+
+		if (handle < 0) {
+			k_spin_unlock(&rheap->lock, key);
+			break;
+		}
+
+		mem = z_heap_slide_left(&rheap->heap, rheap->slots[handle].mem);
+		rheap->slots[handle].mem = mem;
+		resume = mem;
+		last = handle;
+		moved++;
+
+		k_spin_unlock(&rheap->lock, key);
+	}
+
+	return moved;
+}
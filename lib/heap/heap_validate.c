@@ -68,6 +68,41 @@ static inline void check_nexts(struct z_heap *h, int bidx)
 	}
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* Chunks on the size class lists must be valid, still marked used,
+ * of the exact size of their class, and add up to the cached total.
+ */
+static bool valid_size_classes(struct z_heap *h)
+{
+	struct z_heap_size_classes *sc = size_classes(h);
+	chunksz_t cached = 0;
+
+	if (sc == NULL) {
+		return true;
+	}
+
+	for (int i = 0; i < SIZE_CLASS_COUNT; i++) {
+		if ((sc->avail & BIT(i)) == 0U) {
+			continue;
+		}
+
+		VALIDATE(sc->next[i] != 0);
+
+		for (chunkid_t c = sc->next[i]; c != 0; c = next_free_chunk(h, c)) {
+			VALIDATE(in_bounds(h, c));
+			VALIDATE(valid_chunk(h, c));
+			VALIDATE(chunk_used(h, c));
+			VALIDATE(chunk_size(h, c) == (chunksz_t)(i + 1));
+			cached += chunk_size(h, c);
+			VALIDATE(cached <= sc->cached);
+		}
+	}
+
+	VALIDATE(cached == sc->cached);
+	return true;
+}
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
 bool sys_heap_validate(struct sys_heap *heap)
 {
 	struct z_heap *h = heap->heap;
@@ -85,6 +120,12 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	if (!valid_size_classes(h)) {
+		return false;
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
@@ -112,6 +112,18 @@ void *shared_multi_heap_aligned_alloc(enum shared_multi_heap_attr attr,
 					    align, bytes);
 }
 
+void *shared_multi_heap_aligned_alloc_prefer(const enum shared_multi_heap_attr *attrs,
+					     size_t num_attrs, size_t align, size_t bytes)
+{
+	void *block = NULL;
+
+	for (size_t idx = 0; (idx < num_attrs) && (block == NULL); idx++) {
+		block = shared_multi_heap_aligned_alloc(attrs[idx], align, bytes);
+	}
+
+	return block;
+}
+
 int shared_multi_heap_pool_init(void)
 {
 	static atomic_t state;
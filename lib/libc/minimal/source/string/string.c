@@ -24,6 +24,14 @@ typedef uintptr_t mem_word_t;
 
 #endif
 
+/*
+ * Words with every byte set to 0x01 and to 0x80, a word has a zero byte if
+ * and only if (w - ONES) & ~w & HIGHS is not zero.
+ */
+#define MEM_WORD_ONES ((mem_word_t)-1 / 0xff)
+#define MEM_WORD_HIGHS (MEM_WORD_ONES << 7)
+#define MEM_WORD_HAS_ZERO(w) ((((w) - MEM_WORD_ONES) & ~(w) & MEM_WORD_HIGHS) != 0)
+
 /**
  *
  * @brief Copy a string
@@ -120,14 +128,41 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *start = s;
+
+	/* Word-sized reads may go past the terminator within its word, which
+	 * the address sanitizer reports.
+	 */
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE) && !defined(CONFIG_ASAN)
+	const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+	/* do byte-sized scanning until word-aligned or finished */
+
+	while (((uintptr_t)s) & mask) {
+		if (*s == '\0') {
+			return s - start;
+		}
+		s++;
+	}
+
+	/* do word-sized scanning until a word holds the terminator, aligned
+	 * words never cross into memory past the string's last page
+	 */
+
+	const mem_word_t *s_word = (const mem_word_t *)s;
+
+	while (!MEM_WORD_HAS_ZERO(*s_word)) {
+		s_word++;
+	}
+
+	s = (const char *)s_word;
+#endif
 
 	while (*s != '\0') {
 		s++;
-		n++;
 	}
 
-	return n;
+	return s - start;
 }
 
 /**
@@ -240,6 +275,36 @@ int memcmp(const void *m1, const void *m2, size_t n)
 		return 0;
 	}
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* skip equal words if the areas have identical alignment, the
+	 * differing word, if any, is compared byte by byte below
+	 */
+
+	const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & mask) == 0) {
+		while ((((uintptr_t)c1) & mask) && (n > 1) && (*c1 == *c2)) {
+			c1++;
+			c2++;
+			n--;
+		}
+
+		if ((((uintptr_t)c1) & mask) == 0) {
+			const mem_word_t *w1 = (const mem_word_t *)c1;
+			const mem_word_t *w2 = (const mem_word_t *)c2;
+
+			while ((n > sizeof(mem_word_t)) && (*w1 == *w2)) {
+				w1++;
+				w2++;
+				n -= sizeof(mem_word_t);
+			}
+
+			c1 = (const char *)w1;
+			c2 = (const char *)w2;
+		}
+	}
+#endif
+
 	while ((--n > 0) && (*c1 == *c2)) {
 		c1++;
 		c2++;
@@ -317,6 +382,23 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 		mem_word_t *d_word = (mem_word_t *)d_byte;
 		const mem_word_t *s_word = (const mem_word_t *)s_byte;
 
+		/* unrolled to let the compiler use load/store multiple */
+
+		while (n >= (4 * sizeof(mem_word_t))) {
+			mem_word_t w0 = s_word[0];
+			mem_word_t w1 = s_word[1];
+			mem_word_t w2 = s_word[2];
+			mem_word_t w3 = s_word[3];
+
+			d_word[0] = w0;
+			d_word[1] = w1;
+			d_word[2] = w2;
+			d_word[3] = w3;
+			d_word += 4;
+			s_word += 4;
+			n -= 4 * sizeof(mem_word_t);
+		}
+
 		while (n >= sizeof(mem_word_t)) {
 			*(d_word++) = *(s_word++);
 			n -= sizeof(mem_word_t);
@@ -371,6 +453,15 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+	while (n >= (4 * sizeof(mem_word_t))) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
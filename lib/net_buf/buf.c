@@ -85,6 +85,80 @@ static inline struct net_buf *pool_get_uninit(struct net_buf_pool *pool,
 	return buf;
 }
 
+#if defined(CONFIG_NET_BUF_POOL_LOCKFREE)
+/* The lock-free free list head packs the index + 1 of the top buffer in
+ * its low 16 bits (zero meaning empty) and a generation tag, bumped on
+ * every update, in the remaining bits so that a stale compare-and-swap
+ * cannot succeed after the same buffer went out and came back (ABA).
+ * Each free buffer stores the index + 1 of the buffer below it in its
+ * node.next field.
+ */
+#define LF_INDEX_MASK 0xffffUL
+#define LF_HEAD(tag_of, idx) \
+	((atomic_val_t)((((unsigned long)(tag_of) + LF_INDEX_MASK + 1UL) & ~LF_INDEX_MASK) | \
+			(idx)))
+
+static inline struct net_buf *pool_buf_at(struct net_buf_pool *pool, size_t idx)
+{
+	size_t struct_size = ROUND_UP(sizeof(struct net_buf) + pool->user_data_size,
+				__alignof__(struct net_buf));
+
+	return (struct net_buf *)(((uint8_t *)pool->__bufs) + idx * struct_size);
+}
+
+static struct net_buf *pool_lf_pop(struct net_buf_pool *pool)
+{
+	atomic_val_t head, next;
+	struct net_buf *buf;
+
+	do {
+		head = atomic_get(&pool->lf_head);
+		if ((head & LF_INDEX_MASK) == 0) {
+			return NULL;
+		}
+
+		/* The buffer may be popped and reused under our feet, in
+		 * which case the value read here is garbage but the tag
+		 * check makes the CAS below fail.
+		 */
+		buf = pool_buf_at(pool, (head & LF_INDEX_MASK) - 1);
+		next = LF_HEAD(head, (uintptr_t)buf->node.next & LF_INDEX_MASK);
+	} while (!atomic_cas(&pool->lf_head, head, next));
+
+	return buf;
+}
+
+static void pool_lf_push(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	unsigned long idx = net_buf_id(buf) + 1;
+	atomic_val_t head;
+
+	__ASSERT_NO_MSG(idx <= LF_INDEX_MASK);
+
+	do {
+		head = atomic_get(&pool->lf_head);
+		buf->node.next = (sys_snode_t *)(uintptr_t)(head & LF_INDEX_MASK);
+	} while (!atomic_cas(&pool->lf_head, head, LF_HEAD(head, idx)));
+}
+
+void net_buf_pool_lf_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	pool_lf_push(pool, buf);
+
+	/* A thread that found the stack empty registers as a waiter
+	 * before checking it a last time and blocking on the LIFO.
+	 * Either it sees the buffer we just pushed, or we see it here
+	 * and hand a buffer over through the LIFO so that it wakes up.
+	 */
+	if (atomic_get(&pool->lf_waiters) > 0) {
+		buf = pool_lf_pop(pool);
+		if (buf != NULL) {
+			k_lifo_put(&pool->free, buf);
+		}
+	}
+}
+#endif /* CONFIG_NET_BUF_POOL_LOCKFREE */
+
 void net_buf_reset(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf->frags == NULL);
@@ -227,6 +301,42 @@ const struct net_buf_data_alloc net_buf_heap_alloc = {
 
 #endif /* K_HEAP_MEM_POOL_SIZE > 0 */
 
+static uint8_t *view_data_alloc(struct net_buf *buf, size_t *size,
+				k_timeout_t timeout)
+{
+	/* Views never own data, see net_buf_slice() */
+	return NULL;
+}
+
+static void view_data_unref(struct net_buf *buf, uint8_t *data)
+{
+	/* View data is external, released through net_buf_view_destroy() */
+}
+
+static const struct net_buf_data_cb net_buf_view_cb = {
+	.alloc = view_data_alloc,
+	.unref = view_data_unref,
+};
+
+const struct net_buf_data_alloc net_buf_view_alloc = {
+	.cb = &net_buf_view_cb,
+	.max_alloc_size = 0,
+};
+
+static inline struct net_buf **view_parent(struct net_buf *view)
+{
+	return (struct net_buf **)&view->user_data[view->user_data_size -
+						   sizeof(struct net_buf *)];
+}
+
+void net_buf_view_destroy(struct net_buf *buf)
+{
+	struct net_buf *parent = *view_parent(buf);
+
+	net_buf_destroy(buf);
+	net_buf_unref(parent);
+}
+
 static uint8_t *data_alloc(struct net_buf *buf, size_t *size, k_timeout_t timeout)
 {
 	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
@@ -258,6 +368,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_POOL_LOCKFREE)
+	buf = pool_lf_pop(pool);
+	if (buf) {
+		goto success;
+	}
+#endif /* CONFIG_NET_BUF_POOL_LOCKFREE */
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -290,6 +407,19 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	k_spin_unlock(&pool->lock, key);
 
+#if defined(CONFIG_NET_BUF_POOL_LOCKFREE)
+	/* Pair with net_buf_pool_lf_put(): announce ourselves before the
+	 * last look at the stack so that a concurrent release either
+	 * lands where we can see it or is routed to the LIFO.
+	 */
+	atomic_inc(&pool->lf_waiters);
+	buf = pool_lf_pop(pool);
+	if (buf) {
+		atomic_dec(&pool->lf_waiters);
+		goto success;
+	}
+#endif /* CONFIG_NET_BUF_POOL_LOCKFREE */
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -319,6 +449,9 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #else
 	buf = k_lifo_get(&pool->free, timeout);
 #endif
+#if defined(CONFIG_NET_BUF_POOL_LOCKFREE)
+	atomic_dec(&pool->lf_waiters);
+#endif /* CONFIG_NET_BUF_POOL_LOCKFREE */
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
 		return NULL;
@@ -506,10 +639,18 @@ struct net_buf *net_buf_clone(struct net_buf *buf, k_timeout_t timeout)
 		return NULL;
 	}
 
-	/* If the pool supports data referencing use that. Otherwise
-	 * we need to allocate new data and make a copy.
+	/* A view is cloned as another view of the same range. If the
+	 * pool supports data referencing use that. Otherwise we need to
+	 * allocate new data and make a copy.
 	 */
-	if (pool->alloc->cb->ref && !(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+	if (pool->alloc == &net_buf_view_alloc) {
+		clone->__buf = buf->__buf;
+		clone->data = buf->data;
+		clone->len = buf->len;
+		clone->size = buf->size;
+		clone->flags = NET_BUF_EXTERNAL_DATA;
+		(void)net_buf_ref(*view_parent(buf));
+	} else if (pool->alloc->cb->ref && !(buf->flags & NET_BUF_EXTERNAL_DATA)) {
 		clone->__buf = buf->__buf ? data_ref(buf, buf->__buf) : NULL;
 		clone->data = buf->data;
 		clone->len = buf->len;
@@ -538,6 +679,71 @@ struct net_buf *net_buf_clone(struct net_buf *buf, k_timeout_t timeout)
 	return clone;
 }
 
+struct net_buf *net_buf_slice(struct net_buf_pool *view_pool,
+			      struct net_buf *buf, size_t offset,
+			      size_t len, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct net_buf *head = NULL;
+	struct net_buf *tail = NULL;
+
+	__ASSERT_NO_MSG(view_pool);
+	__ASSERT_NO_MSG(buf);
+	__ASSERT(view_pool->alloc == &net_buf_view_alloc,
+		 "pool %p is not a view pool", view_pool);
+
+	if (len == 0U) {
+		return NULL;
+	}
+
+	/* Skip the fragments before the range */
+	while (buf && offset >= buf->len) {
+		offset -= buf->len;
+		buf = buf->frags;
+	}
+
+	for (; buf && len > 0U; buf = buf->frags, offset = 0U) {
+		size_t frag_len = MIN(len, buf->len - offset);
+		struct net_buf *view;
+
+		if (frag_len == 0U) {
+			continue;
+		}
+
+		view = net_buf_alloc_with_data(view_pool, buf->data + offset,
+					       frag_len, sys_timepoint_timeout(end));
+		if (!view) {
+			NET_BUF_ERR("Failed to allocate view buffer");
+			goto fail;
+		}
+
+		*view_parent(view) = net_buf_ref(buf);
+
+		if (tail) {
+			tail->frags = view;
+		} else {
+			head = view;
+		}
+		tail = view;
+
+		len -= frag_len;
+	}
+
+	if (len > 0U) {
+		NET_BUF_ERR("Range exceeds buffer chain by %zu bytes", len);
+		goto fail;
+	}
+
+	return head;
+
+fail:
+	if (head) {
+		net_buf_unref(head);
+	}
+
+	return NULL;
+}
+
 int net_buf_user_data_copy(struct net_buf *dst, const struct net_buf *src)
 {
 	__ASSERT_NO_MSG(dst);
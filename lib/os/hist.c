@@ -0,0 +1,303 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/hist.h>
+#include <zephyr/sys/iterable_sections.h>
+#ifdef CONFIG_SYS_HIST_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
+#define PPM_MAX 1000000U
+
+typedef uint32_t (*bucket_count_fn)(const void *ctx, uint32_t idx);
+
+static bool layout_equal(const struct sys_hist_layout *a, const struct sys_hist_layout *b)
+{
+	return (a->num_buckets == b->num_buckets) && (a->sub_bits == b->sub_bits) &&
+	       (a->max_bits == b->max_bits);
+}
+
+uint32_t sys_hist_bucket_max(const struct sys_hist_layout *layout, uint32_t idx)
+{
+	uint32_t shift, mantissa;
+
+	if (idx >= (layout->num_buckets - 1U)) {
+		return UINT32_MAX;
+	}
+
+	if (idx < BIT(layout->sub_bits + 1)) {
+		return idx;
+	}
+
+	/* Reverse of sys_hist_bucket_get() */
+	shift = (idx >> layout->sub_bits) - 1U;
+	mantissa = (idx & BIT_MASK(layout->sub_bits)) + BIT(layout->sub_bits);
+
+	return (mantissa << shift) + BIT_MASK(shift);
+}
+
+uint32_t sys_hist_bucket_count(const struct sys_hist *hist, uint32_t idx)
+{
+	uint32_t count = 0;
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		count += (uint32_t)atomic_get(&hist->buckets[(cpu * hist->layout.num_buckets) + idx]);
+	}
+
+	return count;
+}
+
+void sys_hist_reset(struct sys_hist *hist)
+{
+	for (size_t i = 0; i < (CONFIG_MP_MAX_NUM_CPUS * hist->layout.num_buckets); i++) {
+		atomic_clear(&hist->buckets[i]);
+	}
+}
+
+int sys_hist_snapshot(const struct sys_hist *hist, struct sys_hist_snapshot *snap)
+{
+	if (!layout_equal(&hist->layout, &snap->layout)) {
+		return -EINVAL;
+	}
+
+	snap->count = 0;
+
+	for (uint32_t i = 0; i < snap->layout.num_buckets; i++) {
+		snap->buckets[i] = sys_hist_bucket_count(hist, i);
+		snap->count += snap->buckets[i];
+	}
+
+	return 0;
+}
+
+int sys_hist_merge(struct sys_hist_snapshot *dst, const struct sys_hist_snapshot *src)
+{
+	if (!layout_equal(&dst->layout, &src->layout)) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = 0; i < dst->layout.num_buckets; i++) {
+		dst->buckets[i] += src->buckets[i];
+	}
+
+	dst->count += src->count;
+
+	return 0;
+}
+
+/* Highest value of the bucket holding the value of the given rank, counting
+ * from 1, with buckets read through @p get so that both snapshots and live
+ * histograms can be walked.
+ */
+static uint32_t rank_value(const struct sys_hist_layout *layout, bucket_count_fn get,
+			   const void *ctx, uint64_t rank)
+{
+	uint64_t count = 0;
+
+	for (uint32_t i = 0; i < layout->num_buckets; i++) {
+		count += get(ctx, i);
+		if (count >= rank) {
+			return sys_hist_bucket_max(layout, i);
+		}
+	}
+
+	/* Live histogram updated while walked. */
+	return UINT32_MAX;
+}
+
+static uint64_t percentile_rank(uint64_t count, uint32_t ppm)
+{
+	uint64_t rank = DIV_ROUND_UP(count * MIN(ppm, PPM_MAX), PPM_MAX);
+
+	return MAX(rank, 1U);
+}
+
+static uint32_t snapshot_bucket_count(const void *ctx, uint32_t idx)
+{
+	const struct sys_hist_snapshot *snap = ctx;
+
+	return snap->buckets[idx];
+}
+
+uint32_t sys_hist_percentile(const struct sys_hist_snapshot *snap, uint32_t ppm)
+{
+	if (snap->count == 0) {
+		return 0;
+	}
+
+	return rank_value(&snap->layout, snapshot_bucket_count, snap,
+			  percentile_rank(snap->count, ppm));
+}
+
+struct sys_hist *sys_hist_find(const char *name)
+{
+	STRUCT_SECTION_FOREACH(sys_hist, hist) {
+		if (strcmp(hist->name, name) == 0) {
+			return hist;
+		}
+	}
+
+	return NULL;
+}
+
+#if defined(CONFIG_SYS_HIST_SHELL) || defined(CONFIG_SYS_HIST_STATS)
+/* Summary computed from the live histogram, without a snapshot buffer. */
+struct hist_summary {
+	uint64_t count;
+	uint32_t p50;
+	uint32_t p90;
+	uint32_t p99;
+	uint32_t p999;
+	uint32_t max;
+};
+
+static uint32_t live_bucket_count(const void *ctx, uint32_t idx)
+{
+	return sys_hist_bucket_count(ctx, idx);
+}
+
+static void hist_summary_get(const struct sys_hist *hist, struct hist_summary *sum)
+{
+	const struct sys_hist_layout *layout = &hist->layout;
+
+	memset(sum, 0, sizeof(*sum));
+
+	for (uint32_t i = 0; i < layout->num_buckets; i++) {
+		uint32_t count = sys_hist_bucket_count(hist, i);
+
+		if (count != 0) {
+			sum->count += count;
+			sum->max = sys_hist_bucket_max(layout, i);
+		}
+	}
+
+	if (sum->count == 0) {
+		return;
+	}
+
+	sum->p50 = rank_value(layout, live_bucket_count, hist, percentile_rank(sum->count, 500000));
+	sum->p90 = rank_value(layout, live_bucket_count, hist, percentile_rank(sum->count, 900000));
+	sum->p99 = rank_value(layout, live_bucket_count, hist, percentile_rank(sum->count, 990000));
+	sum->p999 = rank_value(layout, live_bucket_count, hist,
+			       percentile_rank(sum->count, 999000));
+}
+#endif
+
+#ifdef CONFIG_SYS_HIST_STATS
+STATS_NAME_START(sys_hist)
+	STATS_NAME(sys_hist, count)
+	STATS_NAME(sys_hist, p50)
+	STATS_NAME(sys_hist, p90)
+	STATS_NAME(sys_hist, p99)
+	STATS_NAME(sys_hist, p999)
+	STATS_NAME(sys_hist, max)
+STATS_NAME_END(sys_hist);
+
+/* Statistics are only computed when read, through mcumgr or the shell. */
+static void hist_stats_update(struct stats_hdr *hdr)
+{
+	struct sys_hist *hist = CONTAINER_OF(hdr, struct sys_hist, stats.s_hdr);
+	struct hist_summary sum;
+
+	hist_summary_get(hist, &sum);
+
+	hist->stats.count = (uint32_t)MIN(sum.count, UINT32_MAX);
+	hist->stats.p50 = sum.p50;
+	hist->stats.p90 = sum.p90;
+	hist->stats.p99 = sum.p99;
+	hist->stats.p999 = sum.p999;
+	hist->stats.max = sum.max;
+}
+
+static int hist_stats_init(void)
+{
+	STRUCT_SECTION_FOREACH(sys_hist, hist) {
+		(void)stats_init_and_reg(&hist->stats.s_hdr, STATS_SIZE_32,
+					 (sizeof(hist->stats) - sizeof(hist->stats.s_hdr)) /
+						 STATS_SIZE_32,
+					 STATS_NAME_INIT_PARMS(sys_hist), hist->name);
+		hist->stats.s_hdr.s_update = hist_stats_update;
+	}
+
+	return 0;
+}
+
+SYS_INIT(hist_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_SYS_HIST_STATS */
+
+#ifdef CONFIG_SYS_HIST_SHELL
+static int cmd_hist_list(const struct shell *sh, size_t argc, char **argv)
+{
+	struct hist_summary sum;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-24s %10s %10s %10s %10s %10s %10s", "name", "count", "p50", "p90",
+		    "p99", "p99.9", "max");
+
+	STRUCT_SECTION_FOREACH(sys_hist, hist) {
+		hist_summary_get(hist, &sum);
+		shell_print(sh, "%-24s %10llu %10u %10u %10u %10u %10u", hist->name, sum.count,
+			    sum.p50, sum.p90, sum.p99, sum.p999, sum.max);
+	}
+
+	return 0;
+}
+
+static int cmd_hist_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct sys_hist *hist = sys_hist_find(argv[1]);
+
+	ARG_UNUSED(argc);
+
+	if (hist == NULL) {
+		shell_error(sh, "Histogram %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	for (uint32_t i = 0; i < hist->layout.num_buckets; i++) {
+		uint32_t count = sys_hist_bucket_count(hist, i);
+
+		if (count != 0) {
+			shell_print(sh, "<= %10u: %u", sys_hist_bucket_max(&hist->layout, i), count);
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_hist_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	struct sys_hist *hist = sys_hist_find(argv[1]);
+
+	ARG_UNUSED(argc);
+
+	if (hist == NULL) {
+		shell_error(sh, "Histogram %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	sys_hist_reset(hist);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_hist,
+	SHELL_CMD_ARG(list, NULL, "List histograms with their percentiles", cmd_hist_list, 1, 0),
+	SHELL_CMD_ARG(show, NULL, "Print the non empty buckets of a histogram\n"
+				  "Usage: show <name>", cmd_hist_show, 2, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset a histogram\n"
+				   "Usage: reset <name>", cmd_hist_reset, 2, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(hist, &sub_hist, "Latency histograms", NULL);
+#endif /* CONFIG_SYS_HIST_SHELL */
@@ -0,0 +1,133 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mpmc_msgq.h>
+
+int mpmc_msgq_init(struct mpmc_msgq *q, void *buffer, size_t msg_size, uint32_t max_msgs)
+{
+	if ((max_msgs == 0U) || !IS_POWER_OF_TWO(max_msgs)) {
+		return -EINVAL;
+	}
+
+	memset(buffer, 0, MPMC_MSGQ_BUF_SIZE(msg_size, max_msgs));
+
+	atomic_set(&q->_mpmc.enqueue, 0);
+	atomic_set(&q->_mpmc.dequeue, 0);
+	q->_mpmc.mask = max_msgs - 1U;
+	q->buffer = buffer;
+	q->msg_size = msg_size;
+	q->stride = MPMC_MSGQ_SLOT_SIZE(msg_size);
+	atomic_set(&q->get_waiters, 0);
+	atomic_set(&q->put_waiters, 0);
+	(void)k_sem_init(&q->not_empty, 0, K_SEM_MAX_LIMIT);
+	(void)k_sem_init(&q->not_full, 0, K_SEM_MAX_LIMIT);
+
+	return 0;
+}
+
+static inline void *slot_data(atomic_t *seq)
+{
+	return (uint8_t *)seq + sizeof(atomic_t);
+}
+
+static inline void wake_waiter(atomic_t *waiters, struct k_sem *sem)
+{
+	if (atomic_get(waiters) > 0) {
+		k_sem_give(sem);
+	}
+}
+
+static bool try_put(struct mpmc_msgq *q, const void *data)
+{
+	atomic_t *seq = z_mpmc_claim(&q->_mpmc.enqueue, q->_mpmc.mask, q->buffer,
+				     q->stride, 0);
+
+	if (seq == NULL) {
+		return false;
+	}
+
+	memcpy(slot_data(seq), data, q->msg_size);
+	z_mpmc_produce(seq);
+	wake_waiter(&q->get_waiters, &q->not_empty);
+
+	return true;
+}
+
+static bool try_get(struct mpmc_msgq *q, void *data)
+{
+	atomic_t *seq = z_mpmc_claim(&q->_mpmc.dequeue, q->_mpmc.mask, q->buffer,
+				     q->stride, 1);
+
+	if (seq == NULL) {
+		return false;
+	}
+
+	memcpy(data, slot_data(seq), q->msg_size);
+	z_mpmc_release(seq, q->_mpmc.mask);
+	wake_waiter(&q->put_waiters, &q->not_full);
+
+	return true;
+}
+
+/* Common slow path: register as a waiter, then retry before sleeping so
+ * that a concurrent put/get either makes the retry succeed or sees the
+ * waiter and signals the semaphore. Semaphore counts left over by
+ * waiters that found their message elsewhere only cause another retry.
+ */
+static int wait_for(struct mpmc_msgq *q, atomic_t *waiters, struct k_sem *sem,
+		    bool (*try_op)(struct mpmc_msgq *q, void *data), void *data,
+		    k_timeout_t timeout)
+{
+	k_timepoint_t end;
+	int ret;
+
+	if (try_op(q, data)) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -ENOMSG;
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	for (;;) {
+		(void)atomic_inc(waiters);
+		if (try_op(q, data)) {
+			(void)atomic_dec(waiters);
+			return 0;
+		}
+
+		ret = k_sem_take(sem, sys_timepoint_timeout(end));
+		(void)atomic_dec(waiters);
+
+		if (try_op(q, data)) {
+			return 0;
+		}
+		if (ret != 0) {
+			return -EAGAIN;
+		}
+	}
+}
+
+static bool try_put_op(struct mpmc_msgq *q, void *data)
+{
+	return try_put(q, data);
+}
+
+int mpmc_msgq_put(struct mpmc_msgq *q, const void *data, k_timeout_t timeout)
+{
+	return wait_for(q, &q->put_waiters, &q->not_full, try_put_op, (void *)data,
+			timeout);
+}
+
+int mpmc_msgq_get(struct mpmc_msgq *q, void *data, k_timeout_t timeout)
+{
+	return wait_for(q, &q->get_waiters, &q->not_empty, try_get, data, timeout);
+}
@@ -0,0 +1,575 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdarg.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* Enough for an fd monitored for both input and output */
+#define ZVFS_EPOLL_ITEM_EVENTS 3
+
+#define ZVFS_EPOLL_POLL_EVENTS (ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT)
+
+struct zvfs_epoll;
+
+struct zvfs_epoll_item {
+	/* Entry in the interest list */
+	sys_snode_t node;
+	/* Entry in the ready list */
+	sys_dnode_t ready_node;
+	/* Waits for the fd to become ready while it is not on the ready list */
+	struct k_work_poll work;
+	struct k_poll_event events[ZVFS_EPOLL_ITEM_EVENTS];
+	struct zvfs_epoll *ep;
+	struct zvfs_epoll_event event;
+	int fd;
+};
+
+struct zvfs_epoll {
+	sys_slist_t items;
+	sys_dlist_t ready;
+	struct k_poll_signal ready_sig;
+	struct k_spinlock lock;
+	size_t num_items;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(eps_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+SYS_BITARRAY_DEFINE_STATIC(items_bitarray, CONFIG_ZVFS_EPOLL_MAX_ITEMS);
+static struct zvfs_epoll eps[CONFIG_ZVFS_EPOLL_MAX];
+static struct zvfs_epoll_item items[CONFIG_ZVFS_EPOLL_MAX_ITEMS];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static int epoll_fd_ioctl(int fd, unsigned long request, ...)
+{
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	va_list args;
+	void *obj;
+	int ret;
+
+	obj = zvfs_get_fd_obj_and_vtable(fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	va_start(args, request);
+	ret = vtable->ioctl(obj, request, args);
+	va_end(args);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+/* Fill the poll events of the monitored fd, like zvfs_poll() does */
+static int epoll_item_prepare(struct zvfs_epoll_item *item, struct zvfs_pollfd *pfd,
+			      int *num_events)
+{
+	struct k_poll_event *pev = item->events;
+	int ret;
+
+	pfd->fd = item->fd;
+	pfd->events = item->event.events & ZVFS_EPOLL_POLL_EVENTS;
+	pfd->revents = 0;
+
+	ret = epoll_fd_ioctl(item->fd, ZFD_IOCTL_POLL_PREPARE, pfd, &pev,
+			     item->events + ARRAY_SIZE(item->events));
+
+	*num_events = pev - item->events;
+
+	if (ret == -EXDEV) {
+		/* Offloaded sockets are only supported by zvfs_poll() */
+		return -EOPNOTSUPP;
+	}
+
+	return ret;
+}
+
+/* Get the current events of the monitored fd without waiting */
+static int epoll_item_check(struct zvfs_epoll_item *item, uint32_t *revents)
+{
+	struct k_poll_event *pev = item->events;
+	struct zvfs_pollfd pfd;
+	int num_events;
+	int ret;
+
+	ret = epoll_item_prepare(item, &pfd, &num_events);
+	if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+
+	if (num_events > 0) {
+		(void)k_poll(item->events, num_events, K_NO_WAIT);
+	}
+
+	ret = epoll_fd_ioctl(item->fd, ZFD_IOCTL_POLL_UPDATE, &pfd, &pev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	*revents = pfd.revents;
+
+	return 0;
+}
+
+static void epoll_item_set_ready(struct zvfs_epoll_item *item)
+{
+	struct zvfs_epoll *ep = item->ep;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ep->lock);
+
+	if (!sys_dnode_is_linked(&item->ready_node)) {
+		sys_dlist_append(&ep->ready, &item->ready_node);
+	}
+
+	k_spin_unlock(&ep->lock, key);
+
+	k_poll_signal_raise(&ep->ready_sig, 0);
+}
+
+static void epoll_item_triggered(struct k_work *work)
+{
+	struct k_work_poll *pwork = CONTAINER_OF(work, struct k_work_poll, work);
+
+	epoll_item_set_ready(CONTAINER_OF(pwork, struct zvfs_epoll_item, work));
+}
+
+/* Wait in the background until the fd is ready, then move it to the ready list */
+static int epoll_item_arm(struct zvfs_epoll_item *item)
+{
+	struct zvfs_pollfd pfd;
+	int num_events;
+	int ret;
+
+	ret = epoll_item_prepare(item, &pfd, &num_events);
+	if (ret == -EALREADY) {
+		epoll_item_set_ready(item);
+		return 0;
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (num_events == 0) {
+		return 0;
+	}
+
+	return k_work_poll_submit(&item->work, item->events, num_events, K_FOREVER);
+}
+
+static void epoll_item_disarm(struct zvfs_epoll_item *item)
+{
+	struct k_work_sync sync;
+	k_spinlock_key_t key;
+
+	/* If the fd got ready already, let the handler finish first */
+	if (k_work_poll_cancel(&item->work) < 0) {
+		(void)k_work_flush(&item->work.work, &sync);
+	}
+
+	key = k_spin_lock(&item->ep->lock);
+
+	if (sys_dnode_is_linked(&item->ready_node)) {
+		sys_dlist_remove(&item->ready_node);
+	}
+
+	k_spin_unlock(&item->ep->lock, key);
+}
+
+static struct zvfs_epoll_item *epoll_item_find(struct zvfs_epoll *ep, int fd)
+{
+	struct zvfs_epoll_item *item;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ep->items, item, node) {
+		if (item->fd == fd) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static struct zvfs_epoll_item *epoll_item_alloc(struct zvfs_epoll *ep, int fd,
+						const struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_item *item;
+	size_t offset;
+
+	if (sys_bitarray_alloc(&items_bitarray, 1, &offset) < 0) {
+		return NULL;
+	}
+
+	item = &items[offset];
+	item->ep = ep;
+	item->fd = fd;
+	item->event = *event;
+	sys_dnode_init(&item->ready_node);
+	k_work_poll_init(&item->work, epoll_item_triggered);
+
+	sys_slist_append(&ep->items, &item->node);
+	ep->num_items++;
+
+	return item;
+}
+
+static void epoll_item_free(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	int err;
+
+	(void)sys_slist_find_and_remove(&ep->items, &item->node);
+	ep->num_items--;
+
+	err = sys_bitarray_free(&items_bitarray, 1, item - items);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+}
+
+/*
+ * Report up to maxevents ready fds. Only the fds on the ready list are
+ * looked at, the others are waited for by their own work item.
+ */
+static int epoll_collect(struct zvfs_epoll *ep, struct zvfs_epoll_event *events, int maxevents)
+{
+	struct zvfs_epoll_item *item;
+	sys_dlist_t reported;
+	k_spinlock_key_t key;
+	size_t budget = ep->num_items;
+	sys_dnode_t *node;
+	uint32_t revents;
+	int n = 0;
+	int ret;
+
+	sys_dlist_init(&reported);
+
+	/* Each item is looked at once at most, even if it keeps getting re-armed */
+	while (n < maxevents && budget-- > 0) {
+		key = k_spin_lock(&ep->lock);
+
+		node = sys_dlist_get(&ep->ready);
+		if (node == NULL) {
+			k_poll_signal_reset(&ep->ready_sig);
+		}
+
+		k_spin_unlock(&ep->lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		item = CONTAINER_OF(node, struct zvfs_epoll_item, ready_node);
+
+		ret = epoll_item_check(item, &revents);
+		if (ret < 0) {
+			/* The fd was closed without being removed first */
+			events[n].events = ZVFS_EPOLLERR;
+			events[n].data = item->event.data;
+			n++;
+			continue;
+		}
+
+		if (revents == 0) {
+			/* Not ready anymore, wait for it again */
+			(void)epoll_item_arm(item);
+			continue;
+		}
+
+		events[n].events = revents;
+		events[n].data = item->event.data;
+		n++;
+
+		if (item->event.events & ZVFS_EPOLLONESHOT) {
+			/* Disabled until re-enabled with ZVFS_EPOLL_CTL_MOD */
+			item->event.events = ZVFS_EPOLLONESHOT;
+			continue;
+		}
+
+		/* Level triggered, the next call checks it again */
+		sys_dlist_append(&reported, &item->ready_node);
+	}
+
+	if (!sys_dlist_is_empty(&reported)) {
+		key = k_spin_lock(&ep->lock);
+
+		while ((node = sys_dlist_get(&reported)) != NULL) {
+			sys_dlist_append(&ep->ready, node);
+		}
+
+		k_spin_unlock(&ep->lock, key);
+
+		k_poll_signal_raise(&ep->ready_sig, 0);
+	}
+
+	return n;
+}
+
+static struct zvfs_epoll *epoll_get(int epfd, struct k_mutex **lock)
+{
+	const struct fd_op_vtable *vtable;
+	struct zvfs_epoll *ep;
+
+	ep = zvfs_get_fd_obj_and_vtable(epfd, &vtable, lock);
+	if (ep == NULL) {
+		return NULL;
+	}
+
+	if (vtable != &zvfs_epoll_fd_vtable) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return ep;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	struct zvfs_epoll_item *item;
+	sys_snode_t *node;
+	int err;
+
+	while ((node = sys_slist_peek_head(&ep->items)) != NULL) {
+		item = CONTAINER_OF(node, struct zvfs_epoll_item, node);
+
+		epoll_item_disarm(item);
+		epoll_item_free(ep, item);
+	}
+
+	err = sys_bitarray_free(&eps_bitarray, 1, ep - eps);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	struct zvfs_epoll *ep = obj;
+
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE: {
+		struct zvfs_pollfd *pfd;
+		struct k_poll_event **pev;
+		struct k_poll_event *pev_end;
+
+		pfd = va_arg(args, struct zvfs_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		if (pfd->events & ZVFS_POLLIN) {
+			if (*pev == pev_end) {
+				return -ENOMEM;
+			}
+
+			k_poll_event_init(*pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+					  &ep->ready_sig);
+			(*pev)++;
+		}
+
+		return 0;
+	}
+
+	case ZFD_IOCTL_POLL_UPDATE: {
+		struct zvfs_pollfd *pfd;
+		struct k_poll_event **pev;
+
+		pfd = va_arg(args, struct zvfs_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		if (pfd->events & ZVFS_POLLIN) {
+			if (!sys_dlist_is_empty(&ep->ready)) {
+				pfd->revents |= ZVFS_POLLIN;
+			}
+			(*pev)++;
+		}
+
+		return 0;
+	}
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create1(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags & ~ZVFS_EPOLL_CLOEXEC) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&eps_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&eps_bitarray, 1, offset);
+		return -1;
+	}
+
+	ep = &eps[offset];
+	sys_slist_init(&ep->items);
+	sys_dlist_init(&ep->ready);
+	k_poll_signal_init(&ep->ready_sig);
+	ep->num_items = 0;
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct zvfs_epoll_item *item;
+	struct zvfs_epoll *ep;
+	struct k_mutex *lock;
+	int ret;
+
+	ep = epoll_get(epfd, &lock);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (zvfs_get_fd_obj_and_vtable(fd, &vtable, NULL) == NULL) {
+		return -1;
+	}
+
+	if (fd == epfd || vtable->ioctl == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL && event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	item = epoll_item_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		item = epoll_item_alloc(ep, fd, event);
+		if (item == NULL) {
+			ret = -ENOSPC;
+			break;
+		}
+
+		ret = epoll_item_arm(item);
+		if (ret < 0) {
+			epoll_item_free(ep, item);
+		}
+		break;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_disarm(item);
+		item->event = *event;
+		ret = epoll_item_arm(item);
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_disarm(item);
+		epoll_item_free(ep, item);
+		ret = 0;
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct zvfs_epoll *ep;
+	struct k_poll_event pev;
+	struct k_mutex *lock;
+	k_timepoint_t end;
+	int ret;
+
+	ep = epoll_get(epfd, &lock);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	k_poll_event_init(&pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &ep->ready_sig);
+
+	while (true) {
+		(void)k_mutex_lock(lock, K_FOREVER);
+		ret = epoll_collect(ep, events, maxevents);
+		k_mutex_unlock(lock);
+
+		if (ret > 0) {
+			return ret;
+		}
+
+		/* The lock is released so that other threads can update the set */
+		pev.state = K_POLL_STATE_NOT_READY;
+		ret = k_poll(&pev, 1, sys_timepoint_timeout(end));
+		if (ret == -EAGAIN) {
+			return 0;
+		} else if (ret != 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+}
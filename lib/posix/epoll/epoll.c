@@ -0,0 +1,38 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/posix/sys/epoll.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/zvfs/epoll.h>
+
+BUILD_ASSERT(sizeof(struct epoll_event) == sizeof(struct zvfs_epoll_event));
+
+int epoll_create(int size)
+{
+	if (size <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return zvfs_epoll_create1(0);
+}
+
+int epoll_create1(int flags)
+{
+	return zvfs_epoll_create1(flags);
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+	return zvfs_epoll_ctl(epfd, op, fd, (struct zvfs_epoll_event *)event);
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout)
+{
+	return zvfs_epoll_wait(epfd, (struct zvfs_epoll_event *)events, maxevents, timeout);
+}
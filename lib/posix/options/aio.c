@@ -5,9 +5,541 @@
  */
 
 #include <errno.h>
+#include <limits.h>
 #include <signal.h>
+#include <stdio.h>
 
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/posix/aio.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/timeutil.h>
+
+#if CONFIG_POSIX_AIO_MAX > 0
+
+/* Internal opcode, not accepted by lio_listio() */
+#define AIO_FSYNC (-1)
+
+int zvfs_fsync(int fd);
+off_t zvfs_lseek(int fd, off_t offset, int whence);
+
+enum aio_state {
+	AIO_REQ_FREE,
+	AIO_REQ_QUEUED,
+	AIO_REQ_RUNNING,
+	AIO_REQ_DONE,
+};
+
+/* Completion of a lio_listio() batch */
+struct aio_lio {
+	struct sigevent sig;
+	int pending;
+	bool used;
+};
+
+struct aio_req {
+	/* First word reserved for the k_fifo */
+	void *fifo_reserved;
+	struct aiocb *aiocbp;
+	struct aio_lio *lio;
+	ssize_t ret;
+	int error;
+	int opcode;
+	enum aio_state state;
+};
+
+static struct aio_req aio_reqs[CONFIG_POSIX_AIO_MAX];
+static struct aio_lio aio_lios[CONFIG_POSIX_AIO_MAX];
+
+static K_MUTEX_DEFINE(aio_lock);
+static K_CONDVAR_DEFINE(aio_done);
+static K_FIFO_DEFINE(aio_queue);
+
+static K_THREAD_STACK_ARRAY_DEFINE(aio_stacks, CONFIG_POSIX_AIO_WORKERS,
+				   CONFIG_POSIX_AIO_WORKER_STACK_SIZE);
+static struct k_thread aio_threads[CONFIG_POSIX_AIO_WORKERS];
+
+/* Called with aio_lock held */
+static struct aio_req *aio_find(const struct aiocb *aiocbp)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if ((aio_reqs[i].state != AIO_REQ_FREE) && (aio_reqs[i].aiocbp == aiocbp)) {
+			return &aio_reqs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int aio_check_sigevent(const struct sigevent *sig)
+{
+	switch (sig->sigev_notify) {
+	case SIGEV_NONE:
+		return 0;
+#if defined(_POSIX_THREADS)
+	case SIGEV_THREAD:
+		return (sig->sigev_notify_function != NULL) ? 0 : EINVAL;
+#endif
+	default:
+		/* Signals cannot be delivered, same as for mq_notify() */
+		return ENOSYS;
+	}
+}
+
+/* Notifications run in the context completing the request */
+static void aio_notify(const struct sigevent *sig)
+{
+#if defined(_POSIX_THREADS)
+	if (sig->sigev_notify == SIGEV_THREAD) {
+		sig->sigev_notify_function(sig->sigev_value);
+	}
+#else
+	ARG_UNUSED(sig);
+#endif
+}
+
+/* Called with aio_lock held, returns the batch to notify if any */
+static struct aio_lio *aio_complete_locked(struct aio_req *req, ssize_t ret, int error)
+{
+	struct aio_lio *lio = req->lio;
+
+	req->ret = ret;
+	req->error = (ret < 0) ? error : 0;
+	req->state = AIO_REQ_DONE;
+	req->lio = NULL;
+
+	k_condvar_broadcast(&aio_done);
+
+	if ((lio == NULL) || (--lio->pending > 0)) {
+		return NULL;
+	}
+
+	return lio;
+}
+
+static void aio_complete(struct aio_req *req, ssize_t ret, int error)
+{
+	struct sigevent sig = req->aiocbp->aio_sigevent;
+	struct sigevent lio_sig = {.sigev_notify = SIGEV_NONE};
+	struct aio_lio *lio;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	lio = aio_complete_locked(req, ret, error);
+	if (lio != NULL) {
+		lio_sig = lio->sig;
+		lio->used = false;
+	}
+	k_mutex_unlock(&aio_lock);
+
+	aio_notify(&sig);
+	aio_notify(&lio_sig);
+}
+
+static ssize_t aio_rw(struct aiocb *aiocbp, bool is_write)
+{
+	int fd = aiocbp->aio_fildes;
+	void *buf = (void *)aiocbp->aio_buf;
+	size_t off = aiocbp->aio_offset;
+	ssize_t ret;
+
+	ret = is_write ? zvfs_write(fd, buf, aiocbp->aio_nbytes, &off)
+		       : zvfs_read(fd, buf, aiocbp->aio_nbytes, &off);
+	if ((ret >= 0) || (errno != ENOTSUP)) {
+		return ret;
+	}
+
+	/*
+	 * Only some descriptors take an explicit offset, go through the file offset for the
+	 * others. Streams cannot seek and are read or written in order.
+	 */
+	if ((zvfs_lseek(fd, aiocbp->aio_offset, SEEK_SET) < 0) && (errno != ESPIPE) &&
+	    (errno != ENOTSUP)) {
+		return -1;
+	}
+
+	return is_write ? zvfs_write(fd, buf, aiocbp->aio_nbytes, NULL)
+			: zvfs_read(fd, buf, aiocbp->aio_nbytes, NULL);
+}
+
+static void aio_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		struct aio_req *req = k_fifo_get(&aio_queue, K_FOREVER);
+		ssize_t ret;
+
+		(void)k_mutex_lock(&aio_lock, K_FOREVER);
+		req->state = AIO_REQ_RUNNING;
+		k_mutex_unlock(&aio_lock);
+
+		errno = 0;
+		switch (req->opcode) {
+		case LIO_READ:
+			ret = aio_rw(req->aiocbp, false);
+			break;
+		case LIO_WRITE:
+			ret = aio_rw(req->aiocbp, true);
+			break;
+		default:
+			ret = zvfs_fsync(req->aiocbp->aio_fildes);
+			break;
+		}
+
+		aio_complete(req, ret, errno);
+	}
+}
+
+/* Called with aio_lock held, returns an errno value */
+static int aio_enqueue_locked(struct aiocb *aiocbp, int opcode, struct aio_lio *lio)
+{
+	struct aio_req *req;
+	int err;
+
+	if (aiocbp == NULL) {
+		return EINVAL;
+	}
+
+	if ((opcode != AIO_FSYNC) && (aiocbp->aio_offset < 0)) {
+		return EINVAL;
+	}
+
+	if ((aiocbp->aio_reqprio < 0) || (aiocbp->aio_reqprio > AIO_PRIO_DELTA_MAX)) {
+		return EINVAL;
+	}
+
+	err = aio_check_sigevent(&aiocbp->aio_sigevent);
+	if (err != 0) {
+		return err;
+	}
+
+	/* A control block whose status was not retrieved with aio_return() can be reused */
+	req = aio_find(aiocbp);
+	if ((req != NULL) && (req->state != AIO_REQ_DONE)) {
+		return EINVAL;
+	}
+
+	if (req == NULL) {
+		for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+			if (aio_reqs[i].state == AIO_REQ_FREE) {
+				req = &aio_reqs[i];
+				break;
+			}
+		}
+	}
+
+	if (req == NULL) {
+		return EAGAIN;
+	}
+
+	req->aiocbp = aiocbp;
+	req->lio = lio;
+	req->opcode = opcode;
+	req->ret = -1;
+	req->error = EINPROGRESS;
+	req->state = AIO_REQ_QUEUED;
+
+	if (lio != NULL) {
+		lio->pending++;
+	}
+
+	k_fifo_put(&aio_queue, req);
+
+	return 0;
+}
+
+static int aio_enqueue(struct aiocb *aiocbp, int opcode)
+{
+	int err;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	err = aio_enqueue_locked(aiocbp, opcode, NULL);
+	k_mutex_unlock(&aio_lock);
+
+	if (err != 0) {
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
+
+int aio_cancel(int fildes, struct aiocb *aiocbp)
+{
+	struct sigevent sigs[2 * CONFIG_POSIX_AIO_MAX];
+	size_t n = 0;
+	int ret = AIO_ALLDONE;
+
+	if ((aiocbp != NULL) && (aiocbp->aio_fildes != fildes)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		struct aio_req *req = &aio_reqs[i];
+		struct aio_lio *lio;
+
+		if ((req->state == AIO_REQ_FREE) || (req->state == AIO_REQ_DONE) ||
+		    (req->aiocbp->aio_fildes != fildes) ||
+		    ((aiocbp != NULL) && (req->aiocbp != aiocbp))) {
+			continue;
+		}
+
+		/* Requests already taken by a worker run to completion */
+		if ((req->state != AIO_REQ_QUEUED) || !k_queue_remove(&aio_queue._queue, req)) {
+			ret = AIO_NOTCANCELED;
+			continue;
+		}
+
+		sigs[n++] = req->aiocbp->aio_sigevent;
+		lio = aio_complete_locked(req, -1, ECANCELED);
+		if (lio != NULL) {
+			sigs[n++] = lio->sig;
+			lio->used = false;
+		}
+
+		if (ret == AIO_ALLDONE) {
+			ret = AIO_CANCELED;
+		}
+	}
+	k_mutex_unlock(&aio_lock);
+
+	for (size_t i = 0; i < n; i++) {
+		aio_notify(&sigs[i]);
+	}
+
+	return ret;
+}
+
+int aio_error(const struct aiocb *aiocbp)
+{
+	struct aio_req *req;
+	int ret;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	req = aio_find(aiocbp);
+	ret = (req != NULL) ? req->error : -1;
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = EINVAL;
+	}
+
+	return ret;
+}
+
+int aio_fsync(int op, struct aiocb *aiocbp)
+{
+	/* Data and file integrity completion are the same here */
+	ARG_UNUSED(op);
+
+	return aio_enqueue(aiocbp, AIO_FSYNC);
+}
+
+int aio_read(struct aiocb *aiocbp)
+{
+	return aio_enqueue(aiocbp, LIO_READ);
+}
+
+ssize_t aio_return(struct aiocb *aiocbp)
+{
+	struct aio_req *req;
+	ssize_t ret = -1;
+	int err = EINVAL;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	req = aio_find(aiocbp);
+	if ((req != NULL) && (req->state == AIO_REQ_DONE)) {
+		ret = req->ret;
+		err = req->error;
+		req->aiocbp = NULL;
+		req->state = AIO_REQ_FREE;
+	}
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = err;
+	}
+
+	return ret;
+}
+
+/* Called with aio_lock held */
+static bool aio_any_done(const struct aiocb *const list[], int nent)
+{
+	for (int i = 0; i < nent; i++) {
+		struct aio_req *req;
+
+		if (list[i] == NULL) {
+			continue;
+		}
+
+		req = aio_find(list[i]);
+		if ((req == NULL) || (req->state == AIO_REQ_DONE)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
+{
+	k_timepoint_t end;
+	int ret = 0;
+
+	if ((list == NULL) || (nent < 0) || ((timeout != NULL) && !timespec_is_valid(timeout))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc((timeout == NULL) ? K_FOREVER : timespec_to_timeout(timeout, NULL));
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	while (!aio_any_done(list, nent)) {
+		if (k_condvar_wait(&aio_done, &aio_lock, sys_timepoint_timeout(end)) != 0) {
+			ret = aio_any_done(list, nent) ? 0 : -1;
+			break;
+		}
+	}
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = EAGAIN;
+	}
+
+	return ret;
+}
+
+int aio_write(struct aiocb *aiocbp)
+{
+	return aio_enqueue(aiocbp, LIO_WRITE);
+}
+
+int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
+	       struct sigevent *ZRESTRICT sig)
+{
+	struct aio_lio wait_lio = {.sig.sigev_notify = SIGEV_NONE};
+	struct aio_lio *lio = NULL;
+	bool notify = false;
+	int err = 0;
+
+	if (((mode != LIO_WAIT) && (mode != LIO_NOWAIT)) || (list == NULL) || (nent < 0) ||
+	    (nent > CONFIG_POSIX_AIO_MAX)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((mode == LIO_NOWAIT) && (sig != NULL)) {
+		err = aio_check_sigevent(sig);
+		if (err != 0) {
+			errno = err;
+			return -1;
+		}
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	if (mode == LIO_WAIT) {
+		lio = &wait_lio;
+	} else if ((sig != NULL) && (sig->sigev_notify != SIGEV_NONE)) {
+		for (size_t i = 0; i < ARRAY_SIZE(aio_lios); i++) {
+			if (!aio_lios[i].used) {
+				lio = &aio_lios[i];
+				lio->used = true;
+				lio->sig = *sig;
+				break;
+			}
+		}
+
+		if (lio == NULL) {
+			k_mutex_unlock(&aio_lock);
+			errno = EAGAIN;
+			return -1;
+		}
+	}
+
+	/* Hold the batch open until every request is queued */
+	if (lio != NULL) {
+		lio->pending = 1;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		int rc;
+
+		if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+			continue;
+		}
+
+		if ((list[i]->aio_lio_opcode != LIO_READ) && (list[i]->aio_lio_opcode != LIO_WRITE)) {
+			rc = EINVAL;
+		} else {
+			rc = aio_enqueue_locked(list[i], list[i]->aio_lio_opcode, lio);
+		}
+
+		if (rc != 0) {
+			/* The other requests go on, failures are reported as EIO */
+			err = (rc == EAGAIN) ? EAGAIN : EIO;
+		}
+	}
+
+	if ((lio != NULL) && (--lio->pending == 0) && (lio != &wait_lio)) {
+		/* Every request failed to queue or completed already */
+		lio->used = false;
+		notify = true;
+	}
+
+	if (mode == LIO_WAIT) {
+		while (wait_lio.pending > 0) {
+			(void)k_condvar_wait(&aio_done, &aio_lock, K_FOREVER);
+		}
+
+		for (int i = 0; (i < nent) && (err == 0); i++) {
+			struct aio_req *req;
+
+			if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+				continue;
+			}
+
+			req = aio_find(list[i]);
+			if ((req != NULL) && (req->error != 0)) {
+				err = EIO;
+			}
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (notify) {
+		aio_notify(sig);
+	}
+
+	if (err != 0) {
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int aio_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_threads); i++) {
+		k_thread_create(&aio_threads[i], aio_stacks[i], K_THREAD_STACK_SIZEOF(aio_stacks[i]),
+				aio_worker, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(CONFIG_POSIX_AIO_WORKER_PRIORITY), 0, K_NO_WAIT);
+		k_thread_name_set(&aio_threads[i], "posix_aio");
+	}
+
+	return 0;
+}
+SYS_INIT(aio_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#else /* CONFIG_POSIX_AIO_MAX == 0 */
+
 
 int aio_cancel(int fildes, struct aiocb *aiocbp)
 {
@@ -80,3 +612,5 @@ int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
 	errno = ENOSYS;
 	return -1;
 }
+
+#endif /* CONFIG_POSIX_AIO_MAX > 0 */
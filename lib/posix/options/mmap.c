@@ -18,6 +18,7 @@
 #define _page_size COND_CODE_1(CONFIG_MMU, (CONFIG_MMU_PAGE_SIZE), (CONFIG_POSIX_PAGE_SIZE))
 
 int zvfs_ioctl(int fd, int cmd, va_list args);
+bool shm_obj_munmap(void *addr, size_t len);
 
 static int p2z(int prot, int pflags)
 {
@@ -112,6 +113,11 @@ int munmap(void *addr, size_t len)
 		return -1;
 	}
 
+	/* Shared memory objects outlive their mappings */
+	if (IS_ENABLED(CONFIG_POSIX_SHARED_MEMORY_OBJECTS) && shm_obj_munmap(addr, len)) {
+		return 0;
+	}
+
 	if (!IS_ENABLED(CONFIG_MMU)) {
 		/* cannot munmap without an MPU */
 		errno = ENOTSUP;
@@ -362,6 +362,18 @@ ssize_t recvmsg(int sock, struct msghdr *msg, int flags)
 	return zsock_recvmsg(sock, msg, flags);
 }
 
+int recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen, int flags,
+	     struct timespec *timeout)
+{
+	if (timeout != NULL) {
+		/* Use SO_RCVTIMEO or MSG_WAITFORONE instead */
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	return zsock_recvmmsg(sock, msgvec, vlen, flags);
+}
+
 ssize_t send(int sock, const void *buf, size_t len, int flags)
 {
 	return zsock_send(sock, buf, len, flags);
@@ -372,6 +384,11 @@ ssize_t sendmsg(int sock, const struct msghdr *message, int flags)
 	return zsock_sendmsg(sock, message, flags);
 }
 
+int sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
 ssize_t sendto(int sock, const void *buf, size_t len, int flags, const struct sockaddr *dest_addr,
 	       socklen_t addrlen)
 {
@@ -19,21 +19,47 @@
 #include <zephyr/sys/dlist.h>
 #include <zephyr/sys/fdtable.h>
 #include <zephyr/sys/hash_function.h>
+#include <zephyr/sys/slist.h>
 
 #define _page_size COND_CODE_1(CONFIG_MMU, (CONFIG_MMU_PAGE_SIZE), (CONFIG_POSIX_PAGE_SIZE))
 
+/*
+ * Without an MMU, objects are placed so that a single memory partition covers them, which some
+ * MPUs require to be a power of two aligned on its size.
+ */
+#ifdef CONFIG_MPU_REQUIRES_POWER_OF_TWO_ALIGNMENT
+#define shm_region_size(len) MAX(Z_POW2_CEIL(len), _page_size)
+#define shm_region_align(len) shm_region_size(len)
+#else
+#define shm_region_size(len) ROUND_UP(len, _page_size)
+#define shm_region_align(len) _page_size
+#endif
+
 static const struct fd_op_vtable shm_vtable;
 
 static sys_dlist_t shm_list = SYS_DLIST_STATIC_INIT(&shm_list);
 
+#ifdef CONFIG_USERSPACE
+/* Access of a memory domain to an object, granted by mmap() */
+struct shm_map {
+	sys_snode_t node;
+	struct k_mem_domain *domain;
+	struct k_mem_partition part;
+	size_t count;
+};
+#endif
+
 struct shm_obj {
 	uint8_t *mem;
 	sys_dnode_t node;
 	size_t refs;
+	size_t maps;
 	size_t size;
 	uint32_t hash;
 	bool unlinked: 1;
-	bool mapped: 1;
+#ifdef CONFIG_USERSPACE
+	sys_slist_t domains;
+#endif
 };
 
 static inline uint32_t hash32(const char *str, size_t n)
@@ -95,6 +121,102 @@ static void shm_obj_remove(struct shm_obj *shm)
 	k_free(shm);
 }
 
+static void shm_obj_release(struct shm_obj *shm)
+{
+	if (shm->unlinked && (shm->refs == 0) && (shm->maps == 0)) {
+		shm_obj_remove(shm);
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+static struct shm_map *shm_map_find(struct shm_obj *shm, struct k_mem_domain *domain)
+{
+	struct shm_map *map;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&shm->domains, map, node) {
+		if (map->domain == domain) {
+			return map;
+		}
+	}
+
+	return NULL;
+}
+
+/* Lets user threads of the memory domain of the caller access the whole object */
+static int shm_domain_grant(struct shm_obj *shm, bool writable)
+{
+	struct k_mem_domain *domain = k_current_get()->mem_domain_info.mem_domain;
+	k_mem_partition_attr_t attr = writable ? K_MEM_PARTITION_P_RW_U_RW
+					       : K_MEM_PARTITION_P_RW_U_RO;
+	struct shm_map *map = shm_map_find(shm, domain);
+	int ret;
+
+	if (map != NULL) {
+		if (!writable || (memcmp(&map->part.attr, &attr, sizeof(attr)) == 0)) {
+			map->count++;
+			return 0;
+		}
+
+		/* Upgrade a read-only mapping of the domain */
+		ret = k_mem_domain_remove_partition(domain, &map->part);
+		if (ret != 0) {
+			errno = -ret;
+			return -1;
+		}
+
+		map->part.attr = attr;
+		ret = k_mem_domain_add_partition(domain, &map->part);
+		if (ret != 0) {
+			sys_slist_find_and_remove(&shm->domains, &map->node);
+			k_free(map);
+			errno = -ret;
+			return -1;
+		}
+
+		map->count++;
+		return 0;
+	}
+
+	map = k_calloc(1, sizeof(*map));
+	if (map == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	map->domain = domain;
+	map->part.start = POINTER_TO_UINT(shm->mem);
+	map->part.size = IS_ENABLED(CONFIG_MMU) ? ROUND_UP(shm->size, _page_size)
+						: shm_region_size(shm->size);
+	map->part.attr = attr;
+
+	ret = k_mem_domain_add_partition(domain, &map->part);
+	if (ret != 0) {
+		k_free(map);
+		/* -EINVAL when the domain has no free partition slot left */
+		errno = (ret == -EINVAL) ? ENOMEM : -ret;
+		return -1;
+	}
+
+	map->count = 1;
+	sys_slist_append(&shm->domains, &map->node);
+
+	return 0;
+}
+
+static void shm_domain_revoke(struct shm_obj *shm)
+{
+	struct shm_map *map = shm_map_find(shm, k_current_get()->mem_domain_info.mem_domain);
+
+	if ((map == NULL) || (--map->count > 0)) {
+		return;
+	}
+
+	(void)k_mem_domain_remove_partition(map->domain, &map->part);
+	sys_slist_find_and_remove(&shm->domains, &map->node);
+	k_free(map);
+}
+#endif /* CONFIG_USERSPACE */
+
 static int shm_fstat(struct shm_obj *shm, struct zvfs_stat *st)
 {
 	*st = (struct zvfs_stat){0};
@@ -125,6 +247,11 @@ static int shm_ftruncate(struct shm_obj *shm, off_t length)
 
 	if (IS_ENABLED(CONFIG_MMU)) {
 		virt = k_mem_map(ROUND_UP(length, _page_size), K_MEM_PERM_RW);
+	} else if (IS_ENABLED(CONFIG_USERSPACE)) {
+		virt = k_aligned_alloc(shm_region_align(length), shm_region_size(length));
+		if (virt != NULL) {
+			memset(virt, 0, shm_region_size(length));
+		}
 	} else {
 		virt = k_calloc(1, length);
 	}
@@ -177,7 +304,6 @@ static int shm_mmap(struct shm_obj *shm, void *addr, size_t len, int prot, int f
 		    void **virt)
 {
 	ARG_UNUSED(addr);
-	ARG_UNUSED(prot);
 	__ASSERT_NO_MSG(virt != NULL);
 
 	if ((len == 0) || (off < 0) || ((flags & MAP_FIXED) != 0) ||
@@ -186,26 +312,56 @@ static int shm_mmap(struct shm_obj *shm, void *addr, size_t len, int prot, int f
 		return -1;
 	}
 
-	if (!IS_ENABLED(CONFIG_MMU)) {
-		errno = ENOTSUP;
+	if (shm->mem == NULL) {
+		errno = ENOMEM;
 		return -1;
 	}
 
-	if (shm->mem == NULL) {
-		errno = ENOMEM;
+#ifdef CONFIG_USERSPACE
+	if (shm_domain_grant(shm, (prot & PROT_WRITE) != 0) < 0) {
 		return -1;
 	}
+#else
+	ARG_UNUSED(prot);
+#endif
 
 	/*
 	 * Note: due to Zephyr's page mapping algorithm, physical pages can only have 1
 	 * mapping, so different file handles will have the same virtual memory address
-	 * underneath.
+	 * underneath. All memory domains share the same pages, without copies.
 	 */
 	*virt = shm->mem + off;
+	shm->maps++;
 
 	return 0;
 }
 
+bool shm_obj_munmap(void *addr, size_t len)
+{
+	uint8_t *start = addr;
+	struct shm_obj *shm;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&shm_list, shm, node) {
+		if ((shm->maps == 0) || (start < shm->mem) || (start >= shm->mem + shm->size)) {
+			continue;
+		}
+
+		if (len > (size_t)(shm->mem + shm->size - start)) {
+			continue;
+		}
+
+#ifdef CONFIG_USERSPACE
+		shm_domain_revoke(shm);
+#endif
+		shm->maps--;
+		shm_obj_release(shm);
+
+		return true;
+	}
+
+	return false;
+}
+
 static ssize_t shm_rw(struct shm_obj *shm, void *buf, size_t size, bool is_write, size_t offset)
 {
 	if (offset >= shm->size) {
@@ -240,9 +396,7 @@ static int shm_close(void *obj)
 	struct shm_obj *shm = obj;
 
 	shm->refs -= (shm->refs > 0) ? 1 : 0;
-	if (shm->unlinked && (shm->refs == 0)) {
-		shm_obj_remove(shm);
-	}
+	shm_obj_release(shm);
 
 	return 0;
 }
@@ -391,9 +545,7 @@ int shm_unlink(const char *name)
 	}
 
 	shm->unlinked = true;
-	if (shm->refs == 0) {
-		shm_obj_remove(shm);
-	}
+	shm_obj_release(shm);
 
 	return 0;
 }
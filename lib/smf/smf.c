@@ -22,18 +22,6 @@ struct internal_ctx {
 };
 
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
-static bool is_descendant_of(const struct smf_state *test_state,
-			     const struct smf_state *target_state)
-{
-	for (const struct smf_state *state = test_state; state != NULL; state = state->parent) {
-		if (target_state == state) {
-			return true;
-		}
-	}
-
-	return false;
-}
-
 static const struct smf_state *get_child_of(const struct smf_state *states,
 					    const struct smf_state *parent)
 {
@@ -50,9 +38,24 @@ static const struct smf_state *get_child_of(const struct smf_state *states,
 	return NULL;
 }
 
+static size_t get_depth_of(const struct smf_state *state)
+{
+	size_t depth = 0;
+
+	for (; state != NULL; state = state->parent) {
+		depth++;
+	}
+
+	return depth;
+}
+
 /**
- * @brief Find the Least Common Ancestor (LCA) of two states,
- *	  that are not ancestors of one another.
+ * @brief Find the Least Common Ancestor (LCA) of two states. A state is
+ *	  its own ancestor here, so the LCA of a state and one of its
+ *	  ancestors is that ancestor.
+ *
+ * Levels both states to the same depth and then walks up both chains
+ * together, in time linear in the depth of the hierarchy.
  *
  * @param source transition source
  * @param dest transition destination
@@ -61,15 +64,23 @@ static const struct smf_state *get_child_of(const struct smf_state *states,
 static const struct smf_state *get_lca_of(const struct smf_state *source,
 					  const struct smf_state *dest)
 {
-	for (const struct smf_state *ancestor = source->parent; ancestor != NULL;
-	     ancestor = ancestor->parent) {
-		/* First common ancestor */
-		if (is_descendant_of(dest, ancestor)) {
-			return ancestor;
-		}
+	size_t source_depth = get_depth_of(source);
+	size_t dest_depth = get_depth_of(dest);
+
+	for (; source_depth > dest_depth; source_depth--) {
+		source = source->parent;
 	}
 
-	return NULL;
+	for (; dest_depth > source_depth; dest_depth--) {
+		dest = dest->parent;
+	}
+
+	while (source != dest) {
+		source = source->parent;
+		dest = dest->parent;
+	}
+
+	return source;
 }
 
 /**
@@ -303,14 +314,10 @@ void smf_set_state(struct smf_ctx *const ctx, const struct smf_state *new_state)
 	if (ctx->executing != new_state && ctx->executing->parent == new_state->parent) {
 		/* Optimize sibling transitions (different states under same parent) */
 		topmost = ctx->executing->parent;
-	} else if (is_descendant_of(ctx->executing, new_state)) {
-		/* new state is a parent of where we are now*/
-		topmost = new_state;
-	} else if (is_descendant_of(new_state, ctx->executing)) {
-		/* we are a parent of the new state */
-		topmost = ctx->executing;
 	} else {
-		/* not directly related, find LCA */
+		/* Also covers self transitions, and transitions to an ancestor
+		 * or a descendant, where the LCA is that state itself.
+		 */
 		topmost = get_lca_of(ctx->executing, new_state);
 	}
 
@@ -0,0 +1,308 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/avl.h>
+#include <stddef.h>
+
+#define BALANCE_MASK ((uintptr_t)3)
+
+static inline struct avlnode *get_parent(struct avlnode *n)
+{
+	return (struct avlnode *)(n->parent_balance & ~BALANCE_MASK);
+}
+
+static inline void set_parent(struct avlnode *n, struct avlnode *parent)
+{
+	n->parent_balance = (uintptr_t)parent | (n->parent_balance & BALANCE_MASK);
+}
+
+/* Height of the right subtree minus height of the left one, -1 to 1 */
+static inline int get_balance(struct avlnode *n)
+{
+	return (int)(n->parent_balance & BALANCE_MASK) - 1;
+}
+
+static inline void set_balance(struct avlnode *n, int balance)
+{
+	n->parent_balance = (n->parent_balance & ~BALANCE_MASK) | (uintptr_t)(balance + 1);
+}
+
+/* Balance of a subtree taller on the given side */
+static inline int side_balance(uint8_t side)
+{
+	return (side != 0U) ? 1 : -1;
+}
+
+static inline uint8_t get_side(struct avlnode *parent, struct avlnode *child)
+{
+	return (parent->children[1] == child) ? 1U : 0U;
+}
+
+static void replace_child(struct avltree *tree, struct avlnode *parent, struct avlnode *old,
+			  struct avlnode *new)
+{
+	if (parent == NULL) {
+		tree->root = new;
+	} else {
+		parent->children[get_side(parent, old)] = new;
+	}
+}
+
+/* Moves the child of n on the given side up in place of n */
+static struct avlnode *rotate(struct avltree *tree, struct avlnode *n, uint8_t side)
+{
+	struct avlnode *child = n->children[side];
+	struct avlnode *inner = child->children[!side];
+	struct avlnode *parent = get_parent(n);
+
+	n->children[side] = inner;
+	if (inner != NULL) {
+		set_parent(inner, n);
+	}
+
+	child->children[!side] = n;
+	set_parent(n, child);
+
+	replace_child(tree, parent, n, child);
+	set_parent(child, parent);
+
+	return child;
+}
+
+/* Rebalances the subtree of n, two levels taller on the given side.
+ * Returns the new root of the subtree and whether its height is lower
+ * than before the rotations.
+ */
+static struct avlnode *rebalance(struct avltree *tree, struct avlnode *n, uint8_t side,
+				 bool *shrunk)
+{
+	struct avlnode *child = n->children[side];
+	int child_balance = get_balance(child);
+	int dir = side_balance(side);
+
+	if (child_balance != -dir) {
+		rotate(tree, n, side);
+
+		if (child_balance == 0) {
+			/* Only after a removal */
+			set_balance(n, dir);
+			set_balance(child, -dir);
+			*shrunk = false;
+		} else {
+			set_balance(n, 0);
+			set_balance(child, 0);
+			*shrunk = true;
+		}
+
+		return child;
+	}
+
+	struct avlnode *inner = child->children[!side];
+	int inner_balance = get_balance(inner);
+
+	rotate(tree, child, !side);
+	rotate(tree, n, side);
+
+	set_balance(n, (inner_balance == dir) ? -dir : 0);
+	set_balance(child, (inner_balance == -dir) ? dir : 0);
+	set_balance(inner, 0);
+	*shrunk = true;
+
+	return inner;
+}
+
+void avl_insert(struct avltree *tree, struct avlnode *node)
+{
+	struct avlnode *parent = NULL;
+	struct avlnode *n = tree->root;
+	bool is_min = true;
+	uint8_t side = 0U;
+	bool shrunk;
+
+	while (n != NULL) {
+		parent = n;
+		side = tree->lessthan_fn(node, n) ? 0U : 1U;
+		is_min = is_min && (side == 0U);
+		n = n->children[side];
+	}
+
+	node->children[0] = NULL;
+	node->children[1] = NULL;
+	node->parent_balance = (uintptr_t)parent;
+	set_balance(node, 0);
+
+	if (is_min) {
+		tree->min = node;
+	}
+
+	if (parent == NULL) {
+		tree->root = node;
+		return;
+	}
+
+	parent->children[side] = node;
+
+	/* Walk up while the subtree containing the new node got taller */
+	for (n = node; parent != NULL; n = parent, parent = get_parent(parent)) {
+		int balance;
+
+		side = get_side(parent, n);
+		balance = get_balance(parent) + side_balance(side);
+
+		if (balance == 0) {
+			set_balance(parent, 0);
+			break;
+		}
+
+		if ((balance == 1) || (balance == -1)) {
+			set_balance(parent, balance);
+			continue;
+		}
+
+		(void)rebalance(tree, parent, side, &shrunk);
+		break;
+	}
+}
+
+void avl_remove(struct avltree *tree, struct avlnode *node)
+{
+	struct avlnode *parent = get_parent(node);
+	struct avlnode *left = node->children[0];
+	struct avlnode *right = node->children[1];
+	struct avlnode *n;
+	uint8_t side = 0U;
+	bool shrunk;
+
+	if (tree->min == node) {
+		tree->min = avl_next(node);
+	}
+
+	if ((left != NULL) && (right != NULL)) {
+		/* Replace the node by its successor, the lowest of its right
+		 * subtree.
+		 */
+		struct avlnode *succ = right;
+
+		while (succ->children[0] != NULL) {
+			succ = succ->children[0];
+		}
+
+		if (succ == right) {
+			n = succ;
+			side = 1U;
+		} else {
+			n = get_parent(succ);
+			side = 0U;
+
+			n->children[0] = succ->children[1];
+			if (succ->children[1] != NULL) {
+				set_parent(succ->children[1], n);
+			}
+
+			succ->children[1] = right;
+			set_parent(right, succ);
+		}
+
+		succ->children[0] = left;
+		set_parent(left, succ);
+
+		replace_child(tree, parent, node, succ);
+		succ->parent_balance = node->parent_balance;
+	} else {
+		struct avlnode *child = (left != NULL) ? left : right;
+
+		if (parent != NULL) {
+			side = get_side(parent, node);
+		}
+
+		replace_child(tree, parent, node, child);
+		if (child != NULL) {
+			set_parent(child, parent);
+		}
+
+		n = parent;
+	}
+
+	/* Walk up while the subtree the node was removed from got lower */
+	while (n != NULL) {
+		int balance = get_balance(n) - side_balance(side);
+
+		parent = get_parent(n);
+
+		if ((balance == 1) || (balance == -1)) {
+			set_balance(n, balance);
+			break;
+		}
+
+		if (balance == 0) {
+			set_balance(n, 0);
+		} else {
+			n = rebalance(tree, n, (balance > 0) ? 1U : 0U, &shrunk);
+			if (!shrunk) {
+				break;
+			}
+		}
+
+		if (parent != NULL) {
+			side = get_side(parent, n);
+		}
+
+		n = parent;
+	}
+}
+
+struct avlnode *avl_get_max(struct avltree *tree)
+{
+	struct avlnode *n = tree->root;
+
+	while ((n != NULL) && (n->children[1] != NULL)) {
+		n = n->children[1];
+	}
+
+	return n;
+}
+
+static struct avlnode *step(struct avlnode *node, uint8_t side)
+{
+	struct avlnode *n = node->children[side];
+	struct avlnode *parent;
+
+	if (n != NULL) {
+		while (n->children[!side] != NULL) {
+			n = n->children[!side];
+		}
+
+		return n;
+	}
+
+	for (n = node, parent = get_parent(n); (parent != NULL) && (parent->children[side] == n);
+	     n = parent, parent = get_parent(n)) {
+		;
+	}
+
+	return parent;
+}
+
+struct avlnode *avl_next(struct avlnode *node)
+{
+	return step(node, 1U);
+}
+
+struct avlnode *avl_prev(struct avlnode *node)
+{
+	return step(node, 0U);
+}
+
+bool avl_contains(struct avltree *tree, struct avlnode *node)
+{
+	struct avlnode *n = tree->root;
+
+	while ((n != NULL) && (n != node)) {
+		n = n->children[tree->lessthan_fn(n, node) ? 1U : 0U];
+	}
+
+	return n == node;
+}
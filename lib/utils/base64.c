@@ -118,6 +118,71 @@ int base64_encode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 	return 0;
 }
 
+/*
+ * Decode a buffer made of complete groups of 4 characters, without spaces
+ * nor line breaks, which is the usual case. Returns -EAGAIN for anything
+ * else, including errors, left to the generic decoder.
+ */
+static int base64_decode_groups(uint8_t *dst, size_t dlen, size_t *olen,
+				const uint8_t *src, size_t slen)
+{
+	size_t i, n, pad = 0;
+	uint32_t x, invalid = 0U;
+	uint8_t *p;
+
+	if ((slen == 0) || ((slen % 4) != 0)) {
+		return -EAGAIN;
+	}
+
+	if (src[slen - 1] == '=') {
+		pad = (src[slen - 2] == '=') ? 2 : 1;
+	}
+
+	n = (slen / 4) * 3 - pad;
+	if ((dst == NULL) || (dlen < n)) {
+		return -EAGAIN;
+	}
+
+	/* Characters out of the map have the high bit set, invalid ones and
+	 * '=' decode to 64 or more.
+	 */
+	for (i = 0; i < slen - pad; i++) {
+		invalid |= src[i] | base64_dec_map[src[i] & 0x7F];
+	}
+
+	if ((invalid & 0xC0) != 0U) {
+		return -EAGAIN;
+	}
+
+	for (i = 0, p = dst; i + 4 <= slen - pad; i += 4) {
+		x = ((uint32_t)base64_dec_map[src[i]] << 18) |
+		    ((uint32_t)base64_dec_map[src[i + 1]] << 12) |
+		    ((uint32_t)base64_dec_map[src[i + 2]] << 6) |
+		    base64_dec_map[src[i + 3]];
+
+		*p++ = (uint8_t)(x >> 16);
+		*p++ = (uint8_t)(x >> 8);
+		*p++ = (uint8_t)x;
+	}
+
+	if (pad != 0) {
+		x = ((uint32_t)base64_dec_map[src[i]] << 18) |
+		    ((uint32_t)base64_dec_map[src[i + 1]] << 12);
+		if (pad == 1) {
+			x |= (uint32_t)base64_dec_map[src[i + 2]] << 6;
+		}
+
+		*p++ = (uint8_t)(x >> 16);
+		if (pad == 1) {
+			*p++ = (uint8_t)(x >> 8);
+		}
+	}
+
+	*olen = p - dst;
+
+	return 0;
+}
+
 /*
  * Decode a base64-formatted buffer
  */
@@ -128,6 +193,10 @@ int base64_decode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 	uint32_t j, x;
 	uint8_t *p;
 
+	if (base64_decode_groups(dst, dlen, olen, src, slen) == 0) {
+		return 0;
+	}
+
 	/* First pass: check for validity and get output length */
 	for (i = n = j = 0U; i < slen; i++) {
 		/* Skip spaces before checking for EOL */
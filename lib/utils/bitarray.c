@@ -157,6 +157,41 @@ mismatch:
 	return false;
 }
 
+/*
+ * Find the first cleared bit at or after a bit location, looking at
+ * whole bundles instead of individual bits.
+ *
+ * @param bitarray Bitarray struct
+ * @param bit      Starting bit location
+ *
+ * @return Location of the cleared bit, or the number of bits in the
+ *         bitarray if there is none.
+ */
+static size_t find_next_clear(sys_bitarray_t *bitarray, size_t bit)
+{
+	size_t idx = bit / bundle_bitness(bitarray);
+	uint32_t bundle;
+
+	if (bit >= bitarray->num_bits) {
+		return bitarray->num_bits;
+	}
+
+	bundle = ~bitarray->bundles[idx] & ~(BIT(bit % bundle_bitness(bitarray)) - 1);
+
+	while (bundle == 0U) {
+		idx++;
+		if (idx >= bitarray->num_bundles) {
+			return bitarray->num_bits;
+		}
+
+		bundle = ~bitarray->bundles[idx];
+	}
+
+	bit = idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1;
+
+	return MIN(bit, bitarray->num_bits);
+}
+
 /*
  * Set or clear a region of bits.
  *
@@ -495,7 +530,7 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 	uint32_t bit_idx;
 	int ret;
 	struct bundle_data bd;
-	size_t off_start, off_end;
+	size_t off_end;
 	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
@@ -527,29 +562,7 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
-	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
+	bit_idx = find_next_clear(bitarray, 0);
 
 	off_end = bitarray->num_bits - num_bits;
 	ret = -ENOSPC;
@@ -563,10 +576,10 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 			break;
 		}
 
-		/* Fast-forward to the bit just after
+		/* Fast-forward to the first free bit after
 		 * the mismatched bit.
 		 */
-		bit_idx = mismatch + 1;
+		bit_idx = find_next_clear(bitarray, mismatch + 1);
 	}
 
 out:
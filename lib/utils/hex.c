@@ -43,9 +43,11 @@ size_t bin2hex(const uint8_t *buf, size_t buflen, char *hex, size_t hexlen)
 		return 0;
 	}
 
+	static const char digits[] = "0123456789abcdef";
+
 	for (size_t i = 0; i < buflen; i++) {
-		hex2char(buf[i] >> 4, &hex[2U * i]);
-		hex2char(buf[i] & 0xf, &hex[2U * i + 1U]);
+		hex[2U * i] = digits[buf[i] >> 4];
+		hex[2U * i + 1U] = digits[buf[i] & 0xf];
 	}
 
 	hex[2U * buflen] = '\0';
@@ -1155,7 +1155,8 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 {
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
-	size_t i;
+	size_t start = 0;
+	size_t i, n;
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
@@ -1163,8 +1164,18 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
-			void *decode_field = (char *)val + descr[i].offset;
+		/* Fields usually come in the order of the descriptors, start
+		 * looking after the last decoded one.
+		 */
+		for (n = 0; n < descr_len; n++) {
+			void *decode_field;
+
+			i = start + n;
+			if (i >= descr_len) {
+				i -= descr_len;
+			}
+
+			decode_field = (char *)val + descr[i].offset;
 
 			/* Field has been decoded already, skip */
 			if (decoded_fields & ((int64_t)1 << i)) {
@@ -1189,11 +1200,12 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			}
 
 			decoded_fields |= (int64_t)1<<i;
+			start = i + 1;
 			break;
 		}
 
 		/* Skip field, if no descriptor was found */
-		if (i >= descr_len) {
+		if (n >= descr_len) {
 			ret = skip_field(obj, &kv);
 			if (ret < 0) {
 				return ret;
@@ -1736,6 +1748,65 @@ static int encode(const struct json_obj_descr *descr, const void *val,
 	}
 }
 
+#if CONFIG_JSON_LIBRARY_ENCODE_BUF_SIZE > 0
+/* Output gathered in chunks of up to CONFIG_JSON_LIBRARY_ENCODE_BUF_SIZE
+ * bytes before being handed to the caller's append_bytes callback.
+ */
+struct encode_buf {
+	json_append_bytes_t append_bytes;
+	void *data;
+	size_t used;
+	char buf[CONFIG_JSON_LIBRARY_ENCODE_BUF_SIZE];
+};
+
+static int append_bytes_to_buf(const char *bytes, size_t len, void *data);
+static int measure_bytes(const char *bytes, size_t len, void *data);
+
+static int encode_buf_flush(struct encode_buf *ebuf)
+{
+	int ret = 0;
+
+	if (ebuf->used > 0) {
+		ret = ebuf->append_bytes(ebuf->buf, ebuf->used, ebuf->data);
+		ebuf->used = 0;
+	}
+
+	return ret;
+}
+
+static int append_bytes_buffered(const char *bytes, size_t len, void *data)
+{
+	struct encode_buf *ebuf = data;
+	int ret;
+
+	if (len > sizeof(ebuf->buf) - ebuf->used) {
+		ret = encode_buf_flush(ebuf);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (len > sizeof(ebuf->buf)) {
+			return ebuf->append_bytes(bytes, len, ebuf->data);
+		}
+	}
+
+	memcpy(&ebuf->buf[ebuf->used], bytes, len);
+	ebuf->used += len;
+
+	return 0;
+}
+
+/* Writing to a buffer or measuring gains nothing from an extra copy, and
+ * nested calls append to the buffer of the outermost one.
+ */
+static bool encode_buffered(json_append_bytes_t append_bytes)
+{
+	return (append_bytes != append_bytes_buffered) &&
+	       (append_bytes != append_bytes_to_buf) &&
+	       (append_bytes != measure_bytes);
+}
+#endif /* CONFIG_JSON_LIBRARY_ENCODE_BUF_SIZE > 0 */
+
 int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 		    const void *val, json_append_bytes_t append_bytes,
 		    void *data)
@@ -1743,6 +1814,19 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 	size_t i;
 	int ret;
 
+#if CONFIG_JSON_LIBRARY_ENCODE_BUF_SIZE > 0
+	if (encode_buffered(append_bytes)) {
+		struct encode_buf ebuf = {
+			.append_bytes = append_bytes,
+			.data = data,
+		};
+
+		ret = json_obj_encode(descr, descr_len, val, append_bytes_buffered, &ebuf);
+
+		return (ret < 0) ? ret : encode_buf_flush(&ebuf);
+	}
+#endif
+
 	ret = append_bytes("{", 1, data);
 	if (ret < 0) {
 		return ret;
@@ -1780,6 +1864,21 @@ int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 {
 	void *ptr = (char *)val + descr->offset;
 
+#if CONFIG_JSON_LIBRARY_ENCODE_BUF_SIZE > 0
+	if (encode_buffered(append_bytes)) {
+		struct encode_buf ebuf = {
+			.append_bytes = append_bytes,
+			.data = data,
+		};
+		int ret;
+
+		ret = arr_encode(descr->array.element_descr, ptr, val, append_bytes_buffered,
+				 &ebuf);
+
+		return (ret < 0) ? ret : encode_buf_flush(&ebuf);
+	}
+#endif
+
 	return arr_encode(descr->array.element_descr, ptr, val, append_bytes,
 			  data);
 }
@@ -2162,6 +2261,19 @@ int json_mixed_arr_encode(const struct json_mixed_arr_descr *descr,
 		return append_bytes("[]", 2, data);
 	}
 
+#if CONFIG_JSON_LIBRARY_ENCODE_BUF_SIZE > 0
+	if (encode_buffered(append_bytes)) {
+		struct encode_buf ebuf = {
+			.append_bytes = append_bytes,
+			.data = data,
+		};
+
+		ret = json_mixed_arr_encode(descr, descr_len, val, append_bytes_buffered, &ebuf);
+
+		return (ret < 0) ? ret : encode_buf_flush(&ebuf);
+	}
+#endif
+
 	element_count = (size_t *)((char *)val + descr[0].count_offset);
 
 	ret = append_bytes("[", 1, data);
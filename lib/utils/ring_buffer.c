@@ -38,7 +38,13 @@ int ring_buf_area_finish(struct ring_buf *buf, struct ring_buf_index *ring,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_RING_BUFFER_SPSC
+	/* Data accesses complete before the other side sees the new tail */
+	barrier_dmem_fence_full();
+	*(volatile ring_buf_idx_t *)&ring->tail = ring->tail + size;
+#else
 	ring->tail += size;
+#endif
 	ring->head = ring->tail;
 
 	tail_offset = ring->tail - ring->base;
@@ -214,6 +214,10 @@
 #define MBEDTLS_GCM_C
 #endif
 
+#if defined(CONFIG_MBEDTLS_GCM_ALT_CRYPTO)
+#define MBEDTLS_GCM_ALT
+#endif
+
 #if defined(CONFIG_MBEDTLS_CIPHER_MODE_XTS_ENABLED)
 #define MBEDTLS_CIPHER_MODE_XTS
 #endif
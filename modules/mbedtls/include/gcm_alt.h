@@ -0,0 +1,31 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_MODULES_MBEDTLS_GCM_ALT_H_
+#define ZEPHYR_MODULES_MBEDTLS_GCM_ALT_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/crypto/cipher.h>
+
+/* GCM context used with CONFIG_MBEDTLS_GCM_ALT_CRYPTO. The operations are
+ * carried out by the crypto driver chosen with zephyr,crypto, with one
+ * driver session per direction, started on first use.
+ */
+typedef struct mbedtls_gcm_context {
+	/* Driver sessions, indexed by MBEDTLS_GCM_ENCRYPT/MBEDTLS_GCM_DECRYPT */
+	struct cipher_ctx session[2];
+	bool session_active[2];
+
+	/* Key, the driver may refer to it for the lifetime of a session */
+	unsigned char key[32];
+	uint16_t keylen;
+
+	/* Completion of asynchronous operations */
+	struct k_sem done;
+	int status;
+} mbedtls_gcm_context;
+
+#endif /* ZEPHYR_MODULES_MBEDTLS_GCM_ALT_H_ */
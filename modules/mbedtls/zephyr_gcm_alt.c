@@ -0,0 +1,348 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * AES-GCM for mbed TLS, offloaded to the crypto driver chosen with
+ * zephyr,crypto. TLS records, with or without PSA, are processed with the
+ * one-shot mbedtls_gcm_crypt_and_tag() and mbedtls_gcm_auth_decrypt()
+ * functions, which map to a single cipher_gcm_op() call. The multi-part
+ * API has no driver equivalent and is not supported.
+ */
+
+#include <limits.h>
+#include <string.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/crypto/crypto.h>
+#include <mbedtls/gcm.h>
+#include <mbedtls/error.h>
+#include <mbedtls/platform.h>
+#include <mbedtls/platform_util.h>
+
+static const struct device *const crypto_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_crypto));
+
+/* Session flags, 0 until the driver was found usable */
+static uint16_t crypto_flags;
+
+static void gcm_alt_done(struct cipher_pkt *completed, int status)
+{
+	mbedtls_gcm_context *ctx = completed->ctx->app_sessn_state;
+
+	ctx->status = status;
+	k_sem_give(&ctx->done);
+}
+
+static int gcm_alt_init(void)
+{
+	int caps;
+
+	if (!device_is_ready(crypto_dev)) {
+		return -ENODEV;
+	}
+
+	caps = crypto_query_hwcaps(crypto_dev);
+	if ((caps & CAP_RAW_KEY) == 0) {
+		return -ENOTSUP;
+	}
+
+	crypto_flags = CAP_RAW_KEY;
+	crypto_flags |= (caps & CAP_SEPARATE_IO_BUFS) ? CAP_SEPARATE_IO_BUFS : CAP_INPLACE_OPS;
+
+	/* With asynchronous operations, the calling thread sleeps while the
+	 * hardware processes the record instead of polling for completion.
+	 */
+	if ((caps & CAP_ASYNC_OPS) && cipher_callback_set(crypto_dev, gcm_alt_done) == 0) {
+		crypto_flags |= CAP_ASYNC_OPS;
+	} else {
+		crypto_flags |= CAP_SYNC_OPS;
+	}
+
+	return 0;
+}
+
+SYS_INIT(gcm_alt_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+static void gcm_alt_end_sessions(mbedtls_gcm_context *ctx)
+{
+	for (int i = 0; i < ARRAY_SIZE(ctx->session); i++) {
+		if (ctx->session_active[i]) {
+			(void)cipher_free_session(crypto_dev, &ctx->session[i]);
+			ctx->session_active[i] = false;
+		}
+	}
+}
+
+static struct cipher_ctx *gcm_alt_session(mbedtls_gcm_context *ctx, int mode,
+					  size_t iv_len, size_t tag_len)
+{
+	struct cipher_ctx *session = &ctx->session[mode];
+	int ret;
+
+	if (crypto_flags == 0 || ctx->keylen == 0) {
+		return NULL;
+	}
+
+	if (ctx->session_active[mode]) {
+		if (session->mode_params.gcm_info.nonce_len == iv_len &&
+		    session->mode_params.gcm_info.tag_len == tag_len) {
+			return session;
+		}
+
+		(void)cipher_free_session(crypto_dev, session);
+		ctx->session_active[mode] = false;
+	}
+
+	memset(session, 0, sizeof(*session));
+	session->key.bit_stream = ctx->key;
+	session->keylen = ctx->keylen;
+	session->flags = crypto_flags;
+	session->mode_params.gcm_info.nonce_len = iv_len;
+	session->mode_params.gcm_info.tag_len = tag_len;
+	session->app_sessn_state = ctx;
+
+	ret = cipher_begin_session(crypto_dev, session, CRYPTO_CIPHER_ALGO_AES,
+				   CRYPTO_CIPHER_MODE_GCM,
+				   mode == MBEDTLS_GCM_ENCRYPT ? CRYPTO_CIPHER_OP_ENCRYPT :
+								 CRYPTO_CIPHER_OP_DECRYPT);
+	if (ret < 0) {
+		return NULL;
+	}
+
+	ctx->session_active[mode] = true;
+
+	return session;
+}
+
+static int gcm_alt_op(mbedtls_gcm_context *ctx, int mode, size_t length,
+		      const unsigned char *iv, size_t iv_len,
+		      const unsigned char *add, size_t add_len,
+		      const unsigned char *input, unsigned char *output,
+		      unsigned char *tag, size_t tag_len)
+{
+	struct cipher_pkt pkt = { 0 };
+	struct cipher_aead_pkt aead = { 0 };
+	struct cipher_ctx *session;
+	int ret;
+
+	if (iv_len == 0 || tag_len < 4 || tag_len > 16 || length > INT_MAX) {
+		return MBEDTLS_ERR_GCM_BAD_INPUT;
+	}
+
+	session = gcm_alt_session(ctx, mode, iv_len, tag_len);
+	if (session == NULL) {
+		return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+	}
+
+	if (crypto_flags & CAP_INPLACE_OPS) {
+		if (output != input) {
+			memmove(output, input, length);
+		}
+
+		pkt.in_buf = output;
+	} else {
+		pkt.in_buf = (uint8_t *)input;
+	}
+
+	pkt.in_len = length;
+	pkt.out_buf = output;
+	pkt.out_buf_max = length;
+
+	aead.pkt = &pkt;
+	aead.ad = (uint8_t *)add;
+	aead.ad_len = add_len;
+	aead.tag = tag;
+
+	k_sem_reset(&ctx->done);
+
+	ret = cipher_gcm_op(session, &aead, (uint8_t *)iv);
+	if ((crypto_flags & CAP_ASYNC_OPS) && (ret == 0 || ret == -EINPROGRESS)) {
+		k_sem_take(&ctx->done, K_FOREVER);
+		ret = ctx->status;
+	}
+
+	return ret;
+}
+
+void mbedtls_gcm_init(mbedtls_gcm_context *ctx)
+{
+	memset(ctx, 0, sizeof(*ctx));
+	k_sem_init(&ctx->done, 0, 1);
+}
+
+int mbedtls_gcm_setkey(mbedtls_gcm_context *ctx, mbedtls_cipher_id_t cipher,
+		       const unsigned char *key, unsigned int keybits)
+{
+	if (cipher != MBEDTLS_CIPHER_ID_AES ||
+	    (keybits != 128 && keybits != 192 && keybits != 256)) {
+		return MBEDTLS_ERR_GCM_BAD_INPUT;
+	}
+
+	gcm_alt_end_sessions(ctx);
+
+	memcpy(ctx->key, key, keybits / 8);
+	ctx->keylen = keybits / 8;
+
+	return 0;
+}
+
+int mbedtls_gcm_crypt_and_tag(mbedtls_gcm_context *ctx, int mode, size_t length,
+			      const unsigned char *iv, size_t iv_len,
+			      const unsigned char *add, size_t add_len,
+			      const unsigned char *input, unsigned char *output,
+			      size_t tag_len, unsigned char *tag)
+{
+	int ret;
+
+	/* Drivers check the tag on decryption, they do not return it */
+	if (mode != MBEDTLS_GCM_ENCRYPT) {
+		return MBEDTLS_ERR_GCM_BAD_INPUT;
+	}
+
+	ret = gcm_alt_op(ctx, mode, length, iv, iv_len, add, add_len,
+			 input, output, tag, tag_len);
+	if (ret < 0 && ret != MBEDTLS_ERR_GCM_BAD_INPUT) {
+		return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+	}
+
+	return ret;
+}
+
+int mbedtls_gcm_auth_decrypt(mbedtls_gcm_context *ctx, size_t length,
+			     const unsigned char *iv, size_t iv_len,
+			     const unsigned char *add, size_t add_len,
+			     const unsigned char *tag, size_t tag_len,
+			     const unsigned char *input, unsigned char *output)
+{
+	int ret;
+
+	ret = gcm_alt_op(ctx, MBEDTLS_GCM_DECRYPT, length, iv, iv_len, add, add_len,
+			 input, output, (unsigned char *)tag, tag_len);
+	if (ret == MBEDTLS_ERR_GCM_BAD_INPUT ||
+	    ret == MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED) {
+		return ret;
+	}
+
+	if (ret < 0) {
+		/* Do not leak unauthenticated data */
+		mbedtls_platform_zeroize(output, length);
+		return MBEDTLS_ERR_GCM_AUTH_FAILED;
+	}
+
+	return 0;
+}
+
+int mbedtls_gcm_starts(mbedtls_gcm_context *ctx, int mode,
+		       const unsigned char *iv, size_t iv_len)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(mode);
+	ARG_UNUSED(iv);
+	ARG_UNUSED(iv_len);
+
+	return MBEDTLS_ERR_GCM_BAD_INPUT;
+}
+
+int mbedtls_gcm_update_ad(mbedtls_gcm_context *ctx,
+			  const unsigned char *add, size_t add_len)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(add);
+	ARG_UNUSED(add_len);
+
+	return MBEDTLS_ERR_GCM_BAD_INPUT;
+}
+
+int mbedtls_gcm_update(mbedtls_gcm_context *ctx,
+		       const unsigned char *input, size_t input_length,
+		       unsigned char *output, size_t output_size,
+		       size_t *output_length)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(input);
+	ARG_UNUSED(input_length);
+	ARG_UNUSED(output);
+	ARG_UNUSED(output_size);
+	ARG_UNUSED(output_length);
+
+	return MBEDTLS_ERR_GCM_BAD_INPUT;
+}
+
+int mbedtls_gcm_finish(mbedtls_gcm_context *ctx,
+		       unsigned char *output, size_t output_size,
+		       size_t *output_length,
+		       unsigned char *tag, size_t tag_len)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(output);
+	ARG_UNUSED(output_size);
+	ARG_UNUSED(output_length);
+	ARG_UNUSED(tag);
+	ARG_UNUSED(tag_len);
+
+	return MBEDTLS_ERR_GCM_BAD_INPUT;
+}
+
+void mbedtls_gcm_free(mbedtls_gcm_context *ctx)
+{
+	if (ctx == NULL) {
+		return;
+	}
+
+	gcm_alt_end_sessions(ctx);
+	mbedtls_platform_zeroize(ctx, sizeof(*ctx));
+}
+
+#if defined(MBEDTLS_SELF_TEST)
+int mbedtls_gcm_self_test(int verbose)
+{
+	/* Test case 2 of the GCM specification: zero key, IV and plaintext */
+	static const unsigned char expected_ct[16] = {
+		0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92,
+		0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78,
+	};
+	static const unsigned char expected_tag[16] = {
+		0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd,
+		0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf,
+	};
+	const unsigned char key[16] = { 0 };
+	const unsigned char iv[12] = { 0 };
+	const unsigned char pt[16] = { 0 };
+	unsigned char buf[16];
+	unsigned char tag[16];
+	mbedtls_gcm_context ctx;
+	int ret;
+
+	mbedtls_gcm_init(&ctx);
+
+	ret = mbedtls_gcm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, key, 128);
+	if (ret == 0) {
+		ret = mbedtls_gcm_crypt_and_tag(&ctx, MBEDTLS_GCM_ENCRYPT, sizeof(pt),
+						iv, sizeof(iv), NULL, 0, pt, buf,
+						sizeof(tag), tag);
+	}
+
+	if (ret == 0 && (memcmp(buf, expected_ct, sizeof(buf)) != 0 ||
+			 memcmp(tag, expected_tag, sizeof(tag)) != 0)) {
+		ret = 1;
+	}
+
+	if (ret == 0) {
+		ret = mbedtls_gcm_auth_decrypt(&ctx, sizeof(buf), iv, sizeof(iv), NULL, 0,
+					       tag, sizeof(tag), buf, buf);
+	}
+
+	if (ret == 0 && memcmp(buf, pt, sizeof(buf)) != 0) {
+		ret = 1;
+	}
+
+	mbedtls_gcm_free(&ctx);
+
+	if (verbose != 0) {
+		mbedtls_printf("  AES-GCM-128 (crypto driver): %s\n",
+			       ret == 0 ? "passed" : "failed");
+	}
+
+	return ret == 0 ? 0 : 1;
+}
+#endif /* MBEDTLS_SELF_TEST */
@@ -432,30 +432,63 @@ otError otPlatCryptoHkdfDeinit(otCryptoContext *aContext)
 	return psaToOtError(psa_key_derivation_abort(operation));
 }
 
+/*
+ * AES context. OpenThread encrypts one block at a time, AES-CCM included,
+ * so when its context is large enough a cipher operation is kept set up
+ * across the blocks, rather than setting up the key for every block.
+ * Otherwise only the key reference, which comes first, is stored.
+ */
+struct aes_context {
+	psa_key_id_t key_ref;
+	bool operation_active;
+	psa_cipher_operation_t operation;
+};
+
+static bool aesHasOperation(otCryptoContext *aContext)
+{
+	return aContext->mContextSize >= sizeof(struct aes_context);
+}
+
 otError otPlatCryptoAesInit(otCryptoContext *aContext)
 {
-	psa_key_id_t *key_ref;
+	struct aes_context *ctx;
 
 	if (!checkContext(aContext, sizeof(psa_key_id_t))) {
 		return OT_ERROR_INVALID_ARGS;
 	}
 
-	key_ref = aContext->mContext;
-	*key_ref = (psa_key_id_t)0; /* In TF-M 1.5.0 this can be replaced with PSA_KEY_ID_NULL */
+	ctx = aContext->mContext;
+	ctx->key_ref = (psa_key_id_t)0; /* In TF-M 1.5.0 this can be replaced with PSA_KEY_ID_NULL */
+
+	if (aesHasOperation(aContext)) {
+		ctx->operation_active = false;
+		ctx->operation = psa_cipher_operation_init();
+	}
 
 	return OT_ERROR_NONE;
 }
 
 otError otPlatCryptoAesSetKey(otCryptoContext *aContext, const otCryptoKey *aKey)
 {
-	psa_key_id_t *key_ref;
+	struct aes_context *ctx;
 
 	if (aKey == NULL || !checkContext(aContext, sizeof(psa_key_id_t))) {
 		return OT_ERROR_INVALID_ARGS;
 	}
 
-	key_ref = aContext->mContext;
-	*key_ref = aKey->mKeyRef;
+	ctx = aContext->mContext;
+	ctx->key_ref = aKey->mKeyRef;
+
+	if (aesHasOperation(aContext)) {
+		if (ctx->operation_active) {
+			psa_cipher_abort(&ctx->operation);
+		}
+
+		/* On failure, fall back to single-shot encryption */
+		ctx->operation_active = psa_cipher_encrypt_setup(&ctx->operation, ctx->key_ref,
+								 PSA_ALG_ECB_NO_PADDING) ==
+					PSA_SUCCESS;
+	}
 
 	return OT_ERROR_NONE;
 }
@@ -464,22 +497,41 @@ otError otPlatCryptoAesEncrypt(otCryptoContext *aContext, const uint8_t *aInput,
 {
 	const size_t block_size = PSA_BLOCK_CIPHER_BLOCK_LENGTH(PSA_KEY_TYPE_AES);
 	psa_status_t status = PSA_SUCCESS;
-	psa_key_id_t *key_ref;
+	struct aes_context *ctx;
 	size_t cipher_length;
 
 	if (aInput == NULL || aOutput == NULL || !checkContext(aContext, sizeof(psa_key_id_t))) {
 		return OT_ERROR_INVALID_ARGS;
 	}
 
-	key_ref = aContext->mContext;
-	status = psa_cipher_encrypt(*key_ref, PSA_ALG_ECB_NO_PADDING, aInput, block_size, aOutput,
-				    block_size, &cipher_length);
+	ctx = aContext->mContext;
+
+	if (aesHasOperation(aContext) && ctx->operation_active) {
+		status = psa_cipher_update(&ctx->operation, aInput, block_size, aOutput,
+					   block_size, &cipher_length);
+	} else {
+		status = psa_cipher_encrypt(ctx->key_ref, PSA_ALG_ECB_NO_PADDING, aInput,
+					    block_size, aOutput, block_size, &cipher_length);
+	}
 
 	return psaToOtError(status);
 }
 
 otError otPlatCryptoAesFree(otCryptoContext *aContext)
 {
+	struct aes_context *ctx;
+
+	if (!checkContext(aContext, sizeof(struct aes_context))) {
+		return OT_ERROR_NONE;
+	}
+
+	ctx = aContext->mContext;
+
+	if (ctx->operation_active) {
+		psa_cipher_abort(&ctx->operation);
+		ctx->operation_active = false;
+	}
+
 	return OT_ERROR_NONE;
 }
 
@@ -50,6 +50,7 @@ static int stats_handler(struct http_client_ctx *client, enum http_transaction_s
 							sizeof(prom_buffer));
 		if (ret < 0 && ret != -EAGAIN) {
 			LOG_ERR("Cannot format exposition data (%d)", ret);
+			(void)prometheus_collector_walk_init(&walk_ctx, stats_collector);
 			return ret;
 		}
 
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+# Copyright The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Compare the benchmark results recorded by twister against a baseline.
+
+Benchmarks report their results with the helpers of
+tests/benchmarks/common/bench_report.h, which twister records in twister.json
+as {"suite": ..., "metric": ..., "stats": {"median": ..., ...}}. The median of
+each metric is compared to the one of the baseline, and the script fails if
+any of them increased by more than the threshold.
+
+Example:
+
+    ./scripts/twister -T tests/benchmarks -p qemu_x86 -O baseline
+    (apply changes)
+    ./scripts/twister -T tests/benchmarks -p qemu_x86 -O current
+    ./scripts/benchmarks/compare_benchmarks.py baseline/twister.json \\
+        current/twister.json
+
+A baseline can also be saved in a smaller standalone file with --save.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    """Return {(platform, test, suite, metric): stats} from a twister.json or a saved baseline."""
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+
+    if "benchmarks" in data:
+        return {tuple(r["key"]): r["stats"] for r in data["benchmarks"]}
+
+    results = {}
+    for testsuite in data.get("testsuites", []):
+        for record in testsuite.get("recording") or []:
+            stats = record.get("stats")
+            if not isinstance(stats, dict) or "median" not in stats:
+                continue
+            key = (testsuite.get("platform"), testsuite.get("name"), record.get("suite"),
+                   record.get("metric"))
+            results[key] = stats
+
+    return results
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+    parser.add_argument("baseline", help="baseline twister.json or saved baseline")
+    parser.add_argument("current", nargs="?", help="twister.json to compare to the baseline")
+    parser.add_argument("-t", "--threshold", type=float, default=10.0,
+                        help="maximum increase of a median, in percent (default: 10)")
+    parser.add_argument("-s", "--save", metavar="FILE",
+                        help="save the results of the baseline to FILE and exit")
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    baseline = load_results(args.baseline)
+
+    if args.save:
+        with open(args.save, "w", encoding="utf-8") as f:
+            json.dump({"benchmarks": [{"key": list(k), "stats": v}
+                                      for k, v in sorted(baseline.items(), key=str)]},
+                      f, indent=2)
+        return 0
+
+    if args.current is None:
+        sys.exit("error: no results to compare to the baseline")
+
+    current = load_results(args.current)
+    regressions = 0
+
+    for key in sorted(current, key=str):
+        if key not in baseline:
+            print(f"NEW        {'/'.join(map(str, key))}: {current[key]['median']}")
+            continue
+
+        old = baseline[key]["median"]
+        new = current[key]["median"]
+        change = (new - old) * 100.0 / old if old else 0.0
+        status = "REGRESSION" if change > args.threshold else "OK"
+        regressions += status == "REGRESSION"
+
+        print(f"{status:<10} {'/'.join(map(str, key))}: {old} -> {new} ({change:+.1f}%)")
+
+    for key in sorted(set(baseline) - set(current), key=str):
+        print(f"MISSING    {'/'.join(map(str, key))}")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) regressed by more than {args.threshold}%")
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
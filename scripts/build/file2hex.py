@@ -9,7 +9,8 @@
 """Convert a file to a list of hex characters
 
 The list of hex characters can then be included to a source file. Optionally,
-the output can be compressed.
+the output can be compressed with gzip, or with brotli when the brotli module
+is installed.
 
 """
 
@@ -17,6 +18,7 @@ import argparse
 import codecs
 import gzip
 import io
+import sys
 
 
 def parse_args():
@@ -49,6 +51,12 @@ def parse_args():
     parser.add_argument(
         "-g", "--gzip", action="store_true", help="Compress the file using gzip before output"
     )
+    parser.add_argument(
+        "-b",
+        "--brotli",
+        action="store_true",
+        help="Compress the file using brotli before output, needs the brotli module",
+    )
     parser.add_argument(
         "-t",
         "--gzip-mtime",
@@ -97,6 +105,17 @@ def chunker(source, remaining=-1):
             remaining -= len(chunk_raw)
 
 
+def print_content(content):
+    if args.format == "literal":
+        print('"', end='')
+        for chunk in chunker(content):
+            make_string_literal(chunk)
+        print('"', end='')
+    else:
+        for chunk in chunker(content):
+            make_hex(chunk)
+
+
 def main():
     parse_args()
 
@@ -110,14 +129,17 @@ def main():
                     gz_obj.write(fg.read(args.length))
 
             content.seek(0)
-            if args.format == "literal":
-                print('"', end='')
-                for chunk in chunker(content):
-                    make_string_literal(chunk)
-                print('"', end='')
-            else:
-                for chunk in chunker(content):
-                    make_hex(chunk)
+            print_content(content)
+    elif args.brotli:
+        try:
+            import brotli
+        except ImportError:
+            sys.exit("file2hex.py: --brotli needs the brotli python module")
+
+        with open(args.file, 'rb') as fb:
+            fb.seek(args.offset)
+            with io.BytesIO(brotli.compress(fb.read(args.length), quality=11)) as content:
+                print_content(content)
     else:
         with open(args.file, "rb") as fp:
             fp.seek(args.offset)
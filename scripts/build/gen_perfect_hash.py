@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+#
+# Copyright The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Generate a minimal perfect hash table over a set of keys known at build
+time, for lookup with sys_perfect_hash_lookup() from
+include/zephyr/sys/perfect_hash.h.
+
+The input file lists one key per line. Empty lines and lines starting with
+'#' are ignored, the index returned by a lookup is the position of the key
+among the remaining lines.
+
+Keys are first hashed into buckets. The keys of each bucket are then placed
+in free slots by searching for a seed of a second hash sending each of them
+to a different free slot, biggest buckets first ("hash, displace and
+compress"). With as many slots as keys, the table is minimal.
+"""
+
+import argparse
+import os
+import sys
+
+MAX_SEED = 0xFFFF
+MAX_KEYS = 0xFFFF
+
+
+def hash32(seed, key):
+    """32-bit FNV-1a, must match z_perfect_hash32()"""
+    h = 2166136261 ^ seed
+    for b in key:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+
+    return h
+
+
+def place(keys, n_buckets):
+    n_keys = len(keys)
+    buckets = [[] for _ in range(n_buckets)]
+    for idx, key in enumerate(keys):
+        buckets[hash32(0, key) % n_buckets].append(idx)
+
+    seeds = [0] * n_buckets
+    slots = [None] * n_keys
+
+    for b in sorted(range(n_buckets), key=lambda b: len(buckets[b]), reverse=True):
+        if not buckets[b]:
+            break
+
+        for seed in range(MAX_SEED + 1):
+            taken = set()
+            for idx in buckets[b]:
+                slot = hash32(seed, keys[idx]) % n_keys
+                if slots[slot] is not None or slot in taken:
+                    break
+                taken.add(slot)
+            else:
+                break
+        else:
+            return None
+
+        seeds[b] = seed
+        for idx in buckets[b]:
+            slots[hash32(seed, keys[idx]) % n_keys] = idx
+
+    return seeds, slots
+
+
+def c_string(key):
+    out = ''
+    for b in key:
+        c = chr(b)
+        if c in '"\\?':
+            out += '\\' + c
+        elif 0x20 <= b < 0x7F:
+            out += c
+        else:
+            out += f'\\{b:03o}'
+
+    return f'"{out}"'
+
+
+def gen_perfect_hash(keys, name):
+    if len(keys) > MAX_KEYS:
+        sys.exit(f'{name}: too many keys ({len(keys)})')
+
+    if len(set(keys)) != len(keys):
+        sys.exit(f'{name}: duplicate keys')
+
+    out = [
+        '/*',
+        f' * This file generated by {os.path.basename(__file__)}',
+        ' */',
+        '',
+        '#include <zephyr/sys/perfect_hash.h>',
+        '',
+    ]
+
+    if not keys:
+        out += [f'static const struct sys_perfect_hash {name} = {{', '\t.n_buckets = 1,', '};']
+        return '\n'.join(out) + '\n'
+
+    # Buckets of 3 keys on average, grown until a seed is found for all of them
+    n_buckets = (len(keys) + 2) // 3
+    while True:
+        result = place(keys, n_buckets)
+        if result is not None:
+            break
+        n_buckets += (n_buckets + 7) // 8
+
+    seeds, slots = result
+
+    out.append(f'static const uint16_t {name}_seeds[{n_buckets}] = {{')
+    out += [f'\t{seed},' for seed in seeds]
+    out.append('};')
+    out.append('')
+    out.append(f'static const char *const {name}_keys[{len(keys)}] = {{')
+    out += [f'\t{c_string(keys[idx])},' for idx in slots]
+    out.append('};')
+    out.append('')
+    out.append(f'static const uint16_t {name}_key_lens[{len(keys)}] = {{')
+    out += [f'\t{len(keys[idx])},' for idx in slots]
+    out.append('};')
+    out.append('')
+    out.append(f'static const uint16_t {name}_indexes[{len(keys)}] = {{')
+    out += [f'\t{idx},' for idx in slots]
+    out.append('};')
+    out.append('')
+    out += [
+        f'static const struct sys_perfect_hash {name} = {{',
+        f'\t.seeds = {name}_seeds,',
+        f'\t.keys = {name}_keys,',
+        f'\t.key_lens = {name}_key_lens,',
+        f'\t.indexes = {name}_indexes,',
+        f'\t.n_buckets = {n_buckets},',
+        f'\t.n_keys = {len(keys)},',
+        '};',
+    ]
+
+    return '\n'.join(out) + '\n'
+
+
+def read_keys(path):
+    keys = []
+
+    with open(path, 'rb') as f:
+        for line in f.read().splitlines():
+            if not line or line.startswith(b'#'):
+                continue
+            keys.append(line)
+
+    return keys
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(allow_abbrev=False)
+    parser.add_argument(
+        '-i',
+        '--input',
+        dest='input',
+        required=True,
+        help='input file, one key per line',
+    )
+    parser.add_argument(
+        '-o',
+        '--output',
+        dest='output',
+        required=True,
+        help='output header file',
+    )
+    parser.add_argument(
+        '-n',
+        '--name',
+        dest='name',
+        required=True,
+        help='name of the generated struct sys_perfect_hash',
+    )
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    header = gen_perfect_hash(read_keys(args.input), args.name)
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, 'w') as f:
+        f.write(header)
+
+
+if __name__ == '__main__':
+    main()
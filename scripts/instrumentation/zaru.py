@@ -35,7 +35,7 @@ from west.app.main import WestApp
 from west.configuration import Configuration, config
 from west.util import west_topdir
 
-STATUS_REPLY_PATTERN = r"(0|1)\s(0|1)\s(0|1)"
+STATUS_REPLY_PATTERN = r"(0|1)\s(0|1)\s(0|1)(?:\s(0|1))?"
 
 
 LISTSETS_REPLY_PATTERN = r"(trigger|stopper): (0x[0-9A-Fa-f]+)"
@@ -88,6 +88,80 @@ def get_symbols_from_elf(elf_file, verbose=False):
     return addr_to_symbol
 
 
+def get_function_ranges_from_elf(elf_file):
+    """Get function address ranges from ELF.
+
+    Return a dict() of the function symbols in 'elf_file', indexed by the
+    symbol names, with the [start, end) address range of each function.
+    """
+
+    assert elf_file.exists(), f"File '{elf_file}' does not exist!"
+
+    ranges = {}
+
+    with ELFFile.load_from_path(str(elf_file.resolve())) as elf:
+        for symbol in elf.get_section_by_name(".symtab").iter_symbols():
+            if symbol.entry.st_info.type != "STT_FUNC" or symbol.entry.st_size == 0:
+                continue
+
+            # Clear the Thumb bit, if any.
+            start = symbol.entry.st_value & ~1
+            ranges[symbol.name] = (start, start + symbol.entry.st_size)
+
+    return ranges
+
+
+def resolve_compact_events(events):
+    """Fill in the timestamp and thread name of compact trace events.
+
+    Compact entry / exit events only carry the time elapsed since the previous
+    event and no thread name. Their timestamps are accumulated from the last
+    full event. The events preceding the first full event are placed backwards
+    from it, so their times are only relative to each other. Thread names are
+    taken from the full events of the same thread.
+    """
+
+    thread_names = {}
+    pending = []
+    last_ts = None
+
+    def finish(e):
+        if e["thread_name"] is None:
+            e["thread_name"] = thread_names.get(e["thread_id"], e["thread_id"])
+        return e
+
+    for e in events:
+        delta_t = e.pop("delta_t")
+
+        if delta_t is None:
+            thread_names[e["thread_id"]] = e["thread_name"]
+            last_ts = int(e["timestamp"])
+
+            ts = last_ts
+            for p, p_delta_t in reversed(pending):
+                p["timestamp"] = str(ts)
+                ts -= p_delta_t
+
+            for p, _ in pending:
+                yield finish(p)
+            pending = []
+
+            yield finish(e)
+        elif last_ts is None:
+            pending.append((e, delta_t))
+        else:
+            last_ts += delta_t
+            e["timestamp"] = str(last_ts)
+            yield finish(e)
+
+    # No full event at all, start from 0.
+    ts = 0
+    for i, (p, p_delta_t) in enumerate(pending):
+        ts += p_delta_t if i > 0 else 0
+        p["timestamp"] = str(ts)
+        yield finish(p)
+
+
 def generate_reverse_symbol_lookup(addr_to_symbol):
     """Generate a reverse symbol lookup dict.
 
@@ -306,11 +380,13 @@ def get_target_status(port, verbose=False):
     trace_enabled = r.group(1) == "1"
     profile_enabled = r.group(2) == "1"
     dynamic_trigger_enabled = r.group(3) == "1"
+    snapshot_taken = r.group(4) == "1"
 
     return {
         "trace": trace_enabled,
         "profile": profile_enabled,
         "dynamic_trigger": dynamic_trigger_enabled,
+        "snapshot": snapshot_taken,
     }
 
 
@@ -512,7 +588,11 @@ def get_and_print_trace(args, port, elf, demangle, annotate_ret=False, verbose=F
 
                     cpu = event.payload_field.get("cpu")
                     mode = event.payload_field.get("mode")
-                    timestamp = event.payload_field.get("timestamp").real
+                    # Compact events have a delta time instead of a
+                    # timestamp and no thread name, see
+                    # resolve_compact_events().
+                    timestamp = event.payload_field.get("timestamp")
+                    delta_t = event.payload_field.get("delta_t")
                     thread_name = event.payload_field.get("thread_name")
 
                     e = dict()
@@ -521,12 +601,13 @@ def get_and_print_trace(args, port, elf, demangle, annotate_ret=False, verbose=F
                     e["thread_id"] = str(thread_id)
                     e["cpu"] = str(cpu)
                     e["mode"] = str(mode)
-                    e["timestamp"] = str(timestamp)
-                    e["thread_name"] = str(thread_name)
+                    e["timestamp"] = None if timestamp is None else str(timestamp.real)
+                    e["thread_name"] = None if thread_name is None else str(thread_name)
+                    e["delta_t"] = None if delta_t is None else delta_t.real
 
                     yield e  # event
 
-        ge = get_trace_event_generator()
+        ge = resolve_compact_events(get_trace_event_generator())
 
         line_buffer_first_half = []  # thread_id, CPU, mode, and timestamp (ts)
         line_buffer_second_half = []  # functions
@@ -793,7 +874,11 @@ def export_to_perfetto(args, port, elf, output_filename, demangle, verbose=False
 
                     cpu = event.payload_field.get("cpu")
                     mode = event.payload_field.get("mode")
-                    timestamp = event.payload_field.get("timestamp").real
+                    # Compact events have a delta time instead of a
+                    # timestamp and no thread name, see
+                    # resolve_compact_events().
+                    timestamp = event.payload_field.get("timestamp")
+                    delta_t = event.payload_field.get("delta_t")
                     thread_name = event.payload_field.get("thread_name")
 
                     e = dict()
@@ -802,12 +887,13 @@ def export_to_perfetto(args, port, elf, output_filename, demangle, verbose=False
                     e["thread_id"] = str(thread_id)
                     e["cpu"] = str(cpu)
                     e["mode"] = str(mode)
-                    e["timestamp"] = str(timestamp)
-                    e["thread_name"] = str(thread_name)
+                    e["timestamp"] = None if timestamp is None else str(timestamp.real)
+                    e["thread_name"] = None if thread_name is None else str(thread_name)
+                    e["delta_t"] = None if delta_t is None else delta_t.real
 
                     yield e  # event
 
-        ge = get_trace_event_generator()
+        ge = resolve_compact_events(get_trace_event_generator())
 
         trace_events = []
         system_trace_events = []
@@ -1030,6 +1116,52 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
         return len(profiles)
 
 
+def set_filter(port, first, last, enable):
+    """Turn instrumentation on or off for the address range [first, last)."""
+
+    cmd = "enable" if enable else "disable"
+    port.write(bytes(f"{cmd} 0x{first:08x} 0x{last:08x}", "ascii") + b'\r')
+
+
+def parse_filter_target(target, ranges):
+    """Return the address range of a function name or of a 'START-END' range."""
+
+    if target in ranges:
+        return ranges[target]
+
+    r = re.fullmatch(r"(0x[0-9a-fA-F]+)-(0x[0-9a-fA-F]+)", target)
+    if r is None:
+        return None
+
+    return (int(r.group(1), 16), int(r.group(2), 16))
+
+
+def filter_cmd(args):
+    sport = connect_to_target(args.serial, args.verbose)
+
+    if args.enable_all:
+        sport.write(b'enable_all\r')
+    if args.disable_all:
+        sport.write(b'disable_all\r')
+
+    targets = [(t, False) for t in args.disable or []] + [(t, True) for t in args.enable or []]
+    if not targets:
+        return
+
+    elf_file = get_elf_file(args, args.verbose)
+    ranges = get_function_ranges_from_elf(elf_file)
+
+    for target, enable in targets:
+        addr_range = parse_filter_target(target, ranges)
+        if addr_range is None:
+            print(f"Could not find function '{target}' in ELF file '{elf_file.resolve()}'.")
+            sys.exit(2)
+
+        set_filter(sport, addr_range[0], addr_range[1], enable)
+        state = "on" if enable else "off"
+        print(f"Instrumentation turned {state} for '{target}'.")
+
+
 def reboot(args):
     sport = connect_to_target(args.serial, args.verbose)
     if not reboot_target(sport, args.verbose):
@@ -1053,6 +1185,8 @@ def status(args):
     print(f'Trace {trace_status}.')
     print(f'Profile {profile_status}.')
     print(f'Dynamic trigger configuration {dynamic_trigger_status}.')
+    if status["snapshot"]:
+        print('Trace buffer frozen by a snapshot.')
 
 
 def trace(args):
@@ -1279,6 +1413,33 @@ if __name__ == "__main__":
     )
     trace_parser.set_defaults(func=trace)
 
+    filter_parser = subparsers.add_parser(
+        "filter", help="turn instrumentation on or off for functions or address ranges."
+    )
+    filter_parser.add_argument('--verbose', '-v', action='store_true', help="verbose mode.")
+    filter_parser.add_argument(
+        '--enable-all', action='store_true', help="turn instrumentation on for all functions."
+    )
+    filter_parser.add_argument(
+        '--disable-all', action='store_true', help="turn instrumentation off for all functions."
+    )
+    filter_parser.add_argument(
+        '--enable',
+        '-e',
+        metavar="FUNC_NAME|START-END",
+        action='append',
+        help="turn instrumentation on for a function or an address range, e.g. the text of a "
+        "module from the map file. Applied after --disable.",
+    )
+    filter_parser.add_argument(
+        '--disable',
+        '-d',
+        metavar="FUNC_NAME|START-END",
+        action='append',
+        help="turn instrumentation off for a function or an address range.",
+    )
+    filter_parser.set_defaults(func=filter_cmd)
+
     profile_parser = subparsers.add_parser("profile", help="get profile info from target.")
     profile_parser.add_argument('--verbose', '-v', action='store_true', help="verbose mode.")
     profile_parser.add_argument(
@@ -46,6 +46,7 @@ FMT_MSG_HDR_64 = "BHHQ"
 # Message type
 # 0: normal message
 # 1: number of dropped messages
+# 2: sync record
 FMT_MSG_TYPE = "B"
 
 # Depends on CONFIG_LOG_TIMESTAMP_64BIT
@@ -55,10 +56,19 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_SYNC = 2
+
+# Padding and erased flash between records
+MSG_TYPE_PAD = 0xFF
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
 
+# Sync record: magic followed by sequence number
+SYNC_MAGIC = b"ZLOGSYN"
+FMT_SYNC = "7sI"
+SYNC_PATTERN = bytes([MSG_TYPE_SYNC]) + SYNC_MAGIC
+
 
 logger = logging.getLogger("parser")
 
@@ -78,6 +88,7 @@ class LogParserV3(LogParser):
 
         self.fmt_msg_type = endian + FMT_MSG_TYPE
         self.fmt_dropped_cnt = endian + FMT_DROPPED_CNT
+        self.fmt_sync = endian + FMT_SYNC
 
         if self.database.is_tgt_64bit():
             self.fmt_msg_hdr = endian + FMT_MSG_HDR_64
@@ -383,6 +394,16 @@ class LogParserV3(LogParser):
 
             print(f"--- {num_dropped} messages dropped ---")
 
+        elif msg_type == MSG_TYPE_SYNC:
+            if offset + 1 + struct.calcsize(self.fmt_sync) > len(logdata):
+                return False, offset
+
+            offset += struct.calcsize(self.fmt_msg_type)
+            offset += struct.calcsize(self.fmt_sync)
+
+        elif msg_type == MSG_TYPE_PAD:
+            offset += struct.calcsize(self.fmt_msg_type)
+
         elif msg_type == MSG_TYPE_NORMAL:
             if (offset + self.get_full_msg_hdr_size() > len(logdata)) or (
                 offset + self.get_normal_msg_size(logdata, offset) > len(logdata)
@@ -398,11 +419,45 @@ class LogParserV3(LogParser):
             offset = ret
 
         else:
-            logger.error("------ Unknown message type: %s", msg_type)
-            raise ValueError(f"Unknown message type: {msg_type}")
+            sync_offset = logdata.find(SYNC_PATTERN, offset + 1)
+            if sync_offset < 0:
+                logger.error("------ Unknown message type: %s", msg_type)
+                raise ValueError(f"Unknown message type: {msg_type}")
+
+            logger.error(
+                "------ Unknown message type: %s, skipping %d bytes to next sync record",
+                msg_type,
+                sync_offset - offset,
+            )
+            offset = sync_offset
 
         return True, offset
 
+    def order_blocks(self, logdata):
+        """Reorder blocks starting with sync records by their sequence number
+
+        Data before the first sync record is dropped. This is used with
+        stores written as a ring, like the flash log backend.
+        """
+        starts = []
+        offset = logdata.find(SYNC_PATTERN)
+        while offset >= 0:
+            starts.append(offset)
+            offset = logdata.find(SYNC_PATTERN, offset + len(SYNC_PATTERN))
+
+        blocks = []
+        for idx, start in enumerate(starts):
+            end = starts[idx + 1] if idx + 1 < len(starts) else len(logdata)
+            if start + 1 + struct.calcsize(self.fmt_sync) > end:
+                continue
+
+            _, seq = struct.unpack_from(self.fmt_sync, logdata, start + 1)
+            blocks.append((seq, logdata[start:end]))
+
+        blocks.sort(key=lambda block: block[0])
+
+        return b"".join(block for _, block in blocks)
+
     def parse_log_data(self, logdata, debug=False):
         """Parse binary log data and print the encoded log messages"""
         offset = 0
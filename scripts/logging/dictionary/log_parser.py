@@ -38,6 +38,11 @@ def parse_args():
     argparser.add_argument(
         "--rawhex", action="store_true", help="Log file only contains hexadecimal log data"
     )
+    argparser.add_argument(
+        "--sync-order",
+        action="store_true",
+        help="Order blocks by their sync record, for raw dumps of the flash log backend",
+    )
     argparser.add_argument("--debug", action="store_true", help="Print extra debugging information")
 
     return argparser.parse_args()
@@ -128,6 +133,13 @@ def main():
         logger.error("ERROR: cannot read log from file: %s, exiting...", args.logfile)
         sys.exit(1)
 
+    if args.sync_order:
+        if not hasattr(log_parser, "order_blocks"):
+            logger.error("ERROR: database version does not support sync records, exiting...")
+            sys.exit(1)
+
+        logdata = log_parser.order_blocks(logdata)
+
     parsed_data_offset = parserlib.parser(logdata, log_parser, logger)
     if parsed_data_offset != len(logdata):
         logger.error(
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+#
+# Copyright The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Boot Gantt chart renderer
+
+This renders the records of the boot profiler (CONFIG_BOOT_PROFILE) as an
+SVG Gantt chart, with one lane per thread running init steps, the init levels
+as background bands and the boot milestones as vertical lines.
+
+The input is either the output of the "boot_profile show" shell command, or
+the JSON list of records read with the MCUmgr Zephyr basic group boot profile
+command. SYS_INIT entries are named after their init function using the ELF
+file when given.
+
+Usage:
+    ./scripts/profiling/boot_gantt.py <profile> <output.svg> [<ELF file>]
+"""
+
+import argparse
+import html
+import json
+import sys
+
+TYPES = ["level", "sys_init", "device", "mark"]
+LEVELS = ["EARLY", "PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL", "APPLICATION", "SMP"]
+
+LANE_HEIGHT = 18
+LABEL_WIDTH = 160
+CHART_WIDTH = 1200
+TOP = 40
+COLORS = {"sys_init": "#4e79a7", "device": "#f28e2b"}
+LEVEL_COLORS = ["#f4f4f4", "#e8eef7"]
+
+
+def parse_shell(lines):
+    records = []
+
+    for line in lines:
+        fields = line.strip().split(maxsplit=7)
+        if len(fields) < 8 or not fields[0].isdigit() or fields[1] not in TYPES:
+            continue
+
+        records.append({
+            "type": fields[1],
+            "level": int(fields[2]),
+            "start": int(fields[3]),
+            "end": int(fields[4]),
+            "rc": int(fields[5]),
+            "thread": fields[6],
+            "name": fields[7],
+        })
+
+    return records
+
+
+def parse_json(text):
+    records = []
+
+    for record in json.loads(text):
+        name = record.get("name", hex(record.get("addr", 0)))
+        thread = record.get("thread", 0)
+
+        records.append({
+            "type": TYPES[record["type"]],
+            "level": record["level"],
+            "start": record["start"],
+            "end": record["end"],
+            "rc": record["rc"],
+            "thread": "boot" if thread == 0 else hex(thread),
+            "name": name,
+        })
+
+    return records
+
+
+def symbolize(records, elf_path):
+    from elftools.elf.elffile import ELFFile
+
+    with open(elf_path, "rb") as f:
+        symtab = ELFFile(f).get_section_by_name(".symtab")
+        functions = {}
+        for sym in symtab.iter_symbols():
+            if sym["st_info"]["type"] == "STT_FUNC":
+                # Clear the Thumb bit
+                functions[sym["st_value"] & ~1] = sym.name
+
+    for record in records:
+        if record["type"] == "sys_init" and record["name"].startswith("0x"):
+            addr = int(record["name"], 16) & ~1
+            record["name"] = functions.get(addr, record["name"])
+
+
+def render(records, out):
+    steps = [r for r in records if r["type"] in COLORS]
+    end = max([r["end"] for r in records] + [1])
+    scale = CHART_WIDTH / end
+    lanes = []
+
+    for record in steps:
+        if record["thread"] not in lanes:
+            lanes.append(record["thread"])
+
+    height = TOP + LANE_HEIGHT * (len(lanes) + 1)
+    width = LABEL_WIDTH + CHART_WIDTH + 20
+
+    def x(t):
+        return LABEL_WIDTH + t * scale
+
+    out.write(f'<svg xmlns="http://www.w3.org/2000/svg" width="{width}" height="{height}" '
+              'font-family="sans-serif" font-size="10">\n')
+
+    # Init levels
+    levels = [r for r in records if r["type"] == "level"]
+    for i, record in enumerate(levels):
+        w = max(x(record["end"]) - x(record["start"]), 1)
+        out.write(f'<rect x="{x(record["start"]):.1f}" y="{TOP - 20}" width="{w:.1f}" '
+                  f'height="{height - TOP + 20}" fill="{LEVEL_COLORS[i % 2]}"/>\n')
+        out.write(f'<text x="{x(record["start"]) + 2:.1f}" y="{TOP - 8}">'
+                  f'{html.escape(record["name"])}</text>\n')
+
+    for i, lane in enumerate(lanes):
+        out.write(f'<text x="4" y="{TOP + i * LANE_HEIGHT + 12}">{html.escape(lane)}</text>\n')
+
+    # Init steps, failed ones in red
+    for record in steps:
+        y = TOP + lanes.index(record["thread"]) * LANE_HEIGHT
+        w = max(x(record["end"]) - x(record["start"]), 1)
+        color = "#e15759" if record["rc"] != 0 else COLORS[record["type"]]
+        duration = record["end"] - record["start"]
+        out.write(f'<rect x="{x(record["start"]):.1f}" y="{y + 2}" width="{w:.1f}" '
+                  f'height="{LANE_HEIGHT - 4}" fill="{color}"><title>'
+                  f'{html.escape(record["name"])}: {duration} us, rc {record["rc"]}'
+                  '</title></rect>\n')
+
+    # Boot milestones
+    for record in (r for r in records if r["type"] == "mark"):
+        out.write(f'<line x1="{x(record["start"]):.1f}" y1="{TOP - 20}" '
+                  f'x2="{x(record["start"]):.1f}" y2="{height}" stroke="#333" '
+                  'stroke-dasharray="4,2"/>\n')
+        out.write(f'<text x="{x(record["start"]) + 2:.1f}" y="{height - 4}">'
+                  f'{html.escape(record["name"])}</text>\n')
+
+    out.write(f'<text x="{LABEL_WIDTH}" y="12">Boot profile, {end} us</text>\n')
+    out.write('</svg>\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     allow_abbrev=False)
+    parser.add_argument("profile", help="boot_profile show output or MCUmgr JSON records")
+    parser.add_argument("output", help="SVG file to write")
+    parser.add_argument("elf", nargs="?", help="ELF file to name SYS_INIT entries")
+    args = parser.parse_args()
+
+    with open(args.profile) as f:
+        text = f.read()
+
+    if text.lstrip().startswith("["):
+        records = parse_json(text)
+    else:
+        records = parse_shell(text.splitlines())
+
+    if not records:
+        sys.exit("No boot profile records found")
+
+    if args.elf:
+        symbolize(records, args.elf)
+
+    with open(args.output, "w") as out:
+        render(records, out)
+
+
+if __name__ == "__main__":
+    main()
@@ -12,8 +12,11 @@ This translate stack samples captured by perf subsystem into format
 used by flamegraph.pl. Translation uses .elf file to get function names
 from addresses
 
+The input is either the output of "perf printbuf", or the collapsed stacks
+of addresses printed or written to a file by "perf collapse".
+
 Usage:
-    ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+    ./script/perf/stackcollapse.py <file with perf output> <ELF file>
 """
 
 import re
@@ -35,6 +38,17 @@ def addr_to_sym(addr, elf):
     return "[unknown]"
 
 
+def symbolize(func_trace):
+    prev_func = next(func_trace)
+    line = prev_func
+    # merge dublicate functions
+    for func in func_trace:
+        if prev_func != func:
+            prev_func = func
+            line += ";" + func
+    return line
+
+
 def collapse(buf, elf):
     while buf:
         count, = struct.unpack_from(">Q", buf)
@@ -42,24 +56,31 @@ def collapse(buf, elf):
         addrs = struct.unpack_from(f">{count}Q", buf, 8)
 
         func_trace = reversed(list(map(lambda a: addr_to_sym(a, elf), addrs)))
-        prev_func = next(func_trace)
-        line = prev_func
-        # merge dublicate functions
-        for func in func_trace:
-            if prev_func != func:
-                prev_func = func
-                line += ";" + func
-
-        print(line, 1)
+        print(symbolize(func_trace), 1)
         buf = buf[8 + 8 * count:]
 
 
+def collapse_folded(lines, elf):
+    for line in lines:
+        match = re.fullmatch(r"\s*((?:0x[0-9a-fA-F]+;)*0x[0-9a-fA-F]+) (\d+)\s*", line)
+        if match is None:
+            continue
+
+        addrs = [int(a, 16) for a in match.group(1).split(";")]
+        func_trace = iter([addr_to_sym(a, elf) for a in addrs])
+        print(symbolize(func_trace), match.group(2))
+
+
 if __name__ == "__main__":
     elf = ELFFile(open(sys.argv[2], "rb"))
     with open(sys.argv[1], "r") as f:
         inp = f.read()
 
     lines = inp.splitlines()
+    if not lines[0].startswith("Perf buf length"):
+        collapse_folded(lines, elf)
+        sys.exit(0)
+
     assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
     buf = binascii.unhexlify("".join(lines[1:]))
     collapse(buf, elf)
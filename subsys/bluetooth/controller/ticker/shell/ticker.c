@@ -9,6 +9,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+
 #include <zephyr/kernel.h>
 
 #include <zephyr/bluetooth/bluetooth.h>
@@ -122,10 +124,68 @@ int cmd_ticker_info(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_BT_TICKER_STATS)
+static int cmd_ticker_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct ticker_stats stats;
+	uint32_t permille;
+	uint8_t i;
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset")) {
+			shell_help(sh);
+			return -EINVAL;
+		}
+
+		ticker_stats_reset(0);
+
+		return 0;
+	}
+
+	ticker_stats_get(0, &stats);
+
+	if (stats.ticks_elapsed) {
+		permille = (stats.ticks_slot * 1000U) / stats.ticks_elapsed;
+	} else {
+		permille = 0U;
+	}
+
+	shell_print(sh, "Worker: %u (deferred %u).", stats.worker,
+		    stats.worker_deferred);
+	shell_print(sh, "Job: %u.", stats.job);
+	shell_print(sh, "Expired: %u.", stats.expire);
+	shell_print(sh, "Collisions: %u skipped, %u must expire.",
+		    stats.collision_skip, stats.collision_must_expire);
+	shell_print(sh, "Slot utilization: %u.%u%%.", permille / 10U,
+		    permille % 10U);
+	shell_print(sh, "Worker latency max: %u (%uus).", stats.latency_max,
+		    HAL_TICKER_TICKS_TO_US(stats.latency_max));
+	shell_print(sh, "---------------------");
+	shell_print(sh, " latency       count");
+	shell_print(sh, "  (tick)");
+	shell_print(sh, "---------------------");
+	for (i = 0U; i < TICKER_STATS_LATENCY_BUCKETS; i++) {
+		if (i == 0U) {
+			shell_print(sh, "%8u %11u", 0U, stats.latency[i]);
+		} else if (i < (TICKER_STATS_LATENCY_BUCKETS - 1U)) {
+			shell_print(sh, "%8u %11u", BIT(i) - 1U, stats.latency[i]);
+		} else {
+			shell_print(sh, "%7u+ %11u", BIT(i - 1U), stats.latency[i]);
+		}
+	}
+	shell_print(sh, "---------------------");
+
+	return 0;
+}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #define HELP_NONE "[none]"
 
 SHELL_STATIC_SUBCMD_SET_CREATE(ticker_cmds,
 	SHELL_CMD_ARG(info, NULL, HELP_NONE, cmd_ticker_info, 1, 0),
+#if defined(CONFIG_BT_TICKER_STATS)
+	SHELL_CMD_ARG(stats, NULL, "[reset]", cmd_ticker_stats, 1, 1),
+#endif /* CONFIG_BT_TICKER_STATS */
 	SHELL_SUBCMD_SET_END
 );
 
@@ -336,6 +336,10 @@ struct ticker_instance {
 	bool expire_infos_outdated;
 #endif /* CONFIG_BT_TICKER_EXT_EXPIRE_INFO */
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	struct ticker_stats stats;	/* Scheduling statistics */
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	ticker_caller_id_get_cb_t caller_id_get_cb; /* Function for retrieving
 						     * the caller id from user
 						     * id
@@ -1249,6 +1253,30 @@ static void ticker_job_update_expire_infos(struct ticker_instance *instance)
 
 #endif /* CONFIG_BT_TICKER_EXT_EXPIRE_INFO */
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/**
+ * @brief Account ticker_worker latency
+ *
+ * @param stats Statistics of the ticker instance
+ * @param ticks Ticks elapsed since the first node expired
+ *
+ * @internal
+ */
+static void ticker_stats_latency(struct ticker_stats *stats, uint32_t ticks)
+{
+	uint8_t bucket = 0U;
+
+	while ((bucket < (TICKER_STATS_LATENCY_BUCKETS - 1U)) && (ticks >> bucket)) {
+		bucket++;
+	}
+
+	stats->latency[bucket]++;
+	if (ticks > stats->latency_max) {
+		stats->latency_max = ticks;
+	}
+}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /**
  * @brief Ticker worker
  *
@@ -1274,6 +1302,9 @@ void ticker_worker(void *param)
 	/* Defer worker if job running */
 	instance->worker_trigger = 1U;
 	if (instance->job_guard) {
+#if defined(CONFIG_BT_TICKER_STATS)
+		instance->stats.worker_deferred++;
+#endif /* CONFIG_BT_TICKER_STATS */
 		return;
 	}
 
@@ -1283,6 +1314,10 @@ void ticker_worker(void *param)
 		return;
 	}
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	instance->stats.worker++;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	ticks_now = cntr_cnt_get();
 
 	/* Get ticks elapsed since last job execution */
@@ -1295,6 +1330,14 @@ void ticker_worker(void *param)
 	/* Auto variable containing the head of tickers expiring */
 	ticker_id_head = instance->ticker_id_head;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	/* Latency of the worker from the first expiry */
+	if (ticks_elapsed >= instance->nodes[ticker_id_head].ticks_to_expire) {
+		ticker_stats_latency(&instance->stats, ticks_elapsed -
+				     instance->nodes[ticker_id_head].ticks_to_expire);
+	}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #if !defined(CONFIG_BT_TICKER_LOW_LAT) && \
 	!defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
 	/* Check if the previous ticker node which had air-time, is still
@@ -1390,11 +1433,17 @@ void ticker_worker(void *param)
 				 * ticker node. Mark it as elapsed.
 				 */
 				ticker->ack--;
+#if defined(CONFIG_BT_TICKER_STATS)
+				instance->stats.collision_skip++;
+#endif /* CONFIG_BT_TICKER_STATS */
 				continue;
 			}
 
 			/* Continue but perform shallow expiry */
 			must_expire_skip = 1U;
+#if defined(CONFIG_BT_TICKER_STATS)
+			instance->stats.collision_must_expire++;
+#endif /* CONFIG_BT_TICKER_STATS */
 		}
 
 #if defined(CONFIG_BT_TICKER_EXT)
@@ -1427,6 +1476,10 @@ void ticker_worker(void *param)
 			uint32_t remainder_current;
 			uint32_t ticks_at_expire;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+			instance->stats.expire++;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 			ticks_at_expire = (instance->ticks_current +
 					   ticks_expired -
 					   ticker->ticks_to_expire_minus) &
@@ -1498,6 +1551,10 @@ void ticker_worker(void *param)
 					/* Any further nodes will be skipped */
 					slot_reserved = 1U;
 				}
+
+#if defined(CONFIG_BT_TICKER_STATS)
+				instance->stats.ticks_slot += ticker_ticks_slot;
+#endif /* CONFIG_BT_TICKER_STATS */
 #endif /* !CONFIG_BT_TICKER_LOW_LAT &&
 	* !CONFIG_BT_TICKER_SLOT_AGNOSTIC
 	*/
@@ -1512,6 +1569,10 @@ void ticker_worker(void *param)
 	}
 	instance->ticks_elapsed[instance->ticks_elapsed_last] = ticks_expired;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	instance->stats.ticks_elapsed += ticks_expired;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	instance->worker_trigger = 0U;
 
 	/* Enqueue the ticker job with chain=1 (do not inline) */
@@ -3248,6 +3309,10 @@ void ticker_job(void *param)
 	}
 	instance->job_guard = 1U;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	instance->stats.job++;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	/* Back up the previous known tick */
 	ticks_previous = instance->ticks_current;
 
@@ -4249,6 +4314,33 @@ void ticker_job_sched(uint8_t instance_index, uint8_t user_id)
 			   TICKER_CALL_ID_JOB, 0, instance);
 }
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/**
+ * @brief Get ticker scheduling statistics
+ *
+ * @details Counters are updated in the ticker_worker and ticker_job contexts
+ * without locking, a copy taken from another context may mix values from
+ * before and after an update.
+ *
+ * @param instance_index Index of ticker instance
+ * @param stats          Pointer to statistics to fill
+ */
+void ticker_stats_get(uint8_t instance_index, struct ticker_stats *stats)
+{
+	*stats = _instance[instance_index].stats;
+}
+
+/**
+ * @brief Reset ticker scheduling statistics
+ *
+ * @param instance_index Index of ticker instance
+ */
+void ticker_stats_reset(uint8_t instance_index)
+{
+	_instance[instance_index].stats = (struct ticker_stats){ 0 };
+}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /**
  * @brief Get current absolute tick count
  *
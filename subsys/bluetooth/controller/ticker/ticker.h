@@ -222,6 +222,39 @@ void ticker_job_sched(uint8_t instance_index, uint8_t user_id);
 uint32_t ticker_ticks_now_get(void);
 uint32_t ticker_ticks_diff_get(uint32_t ticks_now, uint32_t ticks_old);
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/** Number of ticker_worker latency buckets. Bucket 0 counts no latency,
+ *  bucket n latencies of 2^(n-1) to 2^n - 1 ticks and the last bucket
+ *  all longer ones.
+ */
+#define TICKER_STATS_LATENCY_BUCKETS 8
+
+struct ticker_stats {
+	uint32_t worker;                /* ticker_worker executions */
+	uint32_t worker_deferred;       /* ticker_worker deferred by an active
+					 * ticker_job
+					 */
+	uint32_t job;                   /* ticker_job executions */
+	uint32_t expire;                /* Timeout callbacks invoked */
+	uint32_t collision_skip;        /* Expiries skipped on slot collision */
+	uint32_t collision_must_expire; /* Must-expire nodes called without
+					 * their slot on collision
+					 */
+	uint32_t latency[TICKER_STATS_LATENCY_BUCKETS]; /* ticker_worker
+							 * latency from the
+							 * first expiry
+							 */
+	uint32_t latency_max;           /* Longest ticker_worker latency */
+	uint64_t ticks_slot;            /* Slot ticks reserved by expired
+					 * nodes
+					 */
+	uint64_t ticks_elapsed;         /* Ticks consumed by ticker_worker */
+};
+
+void ticker_stats_get(uint8_t instance_index, struct ticker_stats *stats);
+void ticker_stats_reset(uint8_t instance_index);
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #if !defined(CONFIG_BT_TICKER_LOW_LAT) && \
 	!defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
 uint8_t ticker_priority_set(uint8_t instance_index, uint8_t user_id,
@@ -838,13 +838,19 @@ static bool should_stop_tx(struct bt_conn *conn)
 		return true;
 	}
 
-	/* Queue only 3 buffers per-conn for now */
-	if (atomic_get(&conn->in_ll) < 3) {
+	/* Let the other connections have their turn after a burst */
+	if ((CONFIG_BT_CONN_TX_BURST > 0) &&
+	    (conn->tx_burst + 1 >= CONFIG_BT_CONN_TX_BURST)) {
+		LOG_DBG("End of burst for %p", conn);
+		return true;
+	}
+
+	if (atomic_get(&conn->in_ll) < CONFIG_BT_CONN_TX_IN_LL_MAX) {
 		/* The goal of this heuristic is to allow the link-layer to
 		 * extend an ACL connection event as long as the application
 		 * layer can provide data.
 		 *
-		 * Here we chose three buffers, as some LLs need two enqueued
+		 * Three buffers is the default, as some LLs need two enqueued
 		 * packets to be able to set the more-data bit, and one more
 		 * buffer to allow refilling by the app while one of them is
 		 * being sent over-the-air.
@@ -962,6 +968,8 @@ static struct bt_conn *get_conn_ready(void)
 		}
 
 		if (should_stop_tx(conn)) {
+			conn->tx_burst = 0;
+
 			/* Move reference off the list */
 			__ASSERT_NO_MSG(prev != &conn->_conn_ready);
 			sys_slist_remove(&bt_dev.le.conn_ready, prev, &conn->_conn_ready);
@@ -975,6 +983,8 @@ static struct bt_conn *get_conn_ready(void)
 			return conn;
 		}
 
+		conn->tx_burst++;
+
 		return bt_conn_ref(conn);
 	}
 
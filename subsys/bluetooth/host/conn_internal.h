@@ -331,6 +331,11 @@ struct bt_conn {
 	 */
 	atomic_t		in_ll;
 
+	/* Number of buffers sent in a row by the TX processor for this
+	 * connection, see CONFIG_BT_CONN_TX_BURST.
+	 */
+	uint8_t			tx_burst;
+
 	/* Next buffer should be an ACL/ISO HCI fragment */
 	bool			next_is_frag;
 
@@ -52,9 +52,12 @@ enum {
 
 static ATOMIC_DEFINE(flags, NUM_FLAGS);
 
-static struct {
-	uint8_t private_key_be[BT_PRIV_KEY_LEN];
+/* Local key pair, kept in the crypto backend for the DHKey computations so the
+ * private key is neither exported nor imported again for every pairing.
+ */
+static psa_key_id_t key_pair_id = PSA_KEY_ID_NULL;
 
+static struct {
 	union {
 		uint8_t public_key_be[BT_PUB_KEY_LEN];
 		uint8_t dhkey_be[BT_DH_KEY_LEN];
@@ -121,7 +124,7 @@ static void set_key_attributes(psa_key_attributes_t *attr)
 {
 	psa_set_key_type(attr, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
 	psa_set_key_bits(attr, 256);
-	psa_set_key_usage_flags(attr, PSA_KEY_USAGE_EXPORT | PSA_KEY_USAGE_DERIVE);
+	psa_set_key_usage_flags(attr, PSA_KEY_USAGE_DERIVE);
 	psa_set_key_algorithm(attr, PSA_ALG_ECDH);
 }
 
@@ -137,6 +140,15 @@ static void generate_pub_key(struct k_work *work)
 
 	set_key_attributes(&attr);
 
+	if (key_pair_id != PSA_KEY_ID_NULL) {
+		ret = psa_destroy_key(key_pair_id);
+		if (ret != PSA_SUCCESS) {
+			LOG_WRN("Failed to destroy previous ECC key ID %d", ret);
+		}
+
+		key_pair_id = PSA_KEY_ID_NULL;
+	}
+
 	ret = psa_generate_key(&attr, &key_id);
 	if (ret != PSA_SUCCESS) {
 		LOG_ERR("Failed to generate ECC key %d", ret);
@@ -147,6 +159,7 @@ static void generate_pub_key(struct k_work *work)
 	ret = psa_export_public_key(key_id, tmp_pub_key_buf, sizeof(tmp_pub_key_buf), &tmp_len);
 	if (ret != PSA_SUCCESS) {
 		LOG_ERR("Failed to export ECC public key %d", ret);
+		(void)psa_destroy_key(key_id);
 		err = BT_HCI_ERR_UNSPECIFIED;
 		goto done;
 	}
@@ -156,19 +169,7 @@ static void generate_pub_key(struct k_work *work)
 	 */
 	memcpy(ecc.public_key_be, &tmp_pub_key_buf[1], BT_PUB_KEY_LEN);
 
-	ret = psa_export_key(key_id, ecc.private_key_be, BT_PRIV_KEY_LEN, &tmp_len);
-	if (ret != PSA_SUCCESS) {
-		LOG_ERR("Failed to export ECC private key %d", ret);
-		err = BT_HCI_ERR_UNSPECIFIED;
-		goto done;
-	}
-
-	ret = psa_destroy_key(key_id);
-	if (ret != PSA_SUCCESS) {
-		LOG_ERR("Failed to destroy ECC key ID %d", ret);
-		err = BT_HCI_ERR_UNSPECIFIED;
-		goto done;
-	}
+	key_pair_id = key_id;
 
 	sys_memcpy_swap(pub_key, ecc.public_key_be, BT_PUB_KEY_COORD_LEN);
 	sys_memcpy_swap(&pub_key[BT_PUB_KEY_COORD_LEN],
@@ -207,16 +208,17 @@ static void generate_dh_key(struct k_work *work)
 	uint8_t tmp_pub_key_buf[BT_PUB_KEY_LEN + 1] = { 0x04 };
 	size_t tmp_len;
 
-	set_key_attributes(&attr);
+	if (IS_ENABLED(CONFIG_BT_USE_DEBUG_KEYS)) {
+		set_key_attributes(&attr);
 
-	const uint8_t *priv_key = (IS_ENABLED(CONFIG_BT_USE_DEBUG_KEYS) ?
-				   debug_private_key_be :
-				   ecc.private_key_be);
-	ret = psa_import_key(&attr, priv_key, BT_PRIV_KEY_LEN, &key_id);
-	if (ret != PSA_SUCCESS) {
-		err = -EIO;
-		LOG_ERR("Failed to import the private key for key agreement %d", ret);
-		goto exit;
+		ret = psa_import_key(&attr, debug_private_key_be, BT_PRIV_KEY_LEN, &key_id);
+		if (ret != PSA_SUCCESS) {
+			err = -EIO;
+			LOG_ERR("Failed to import the private key for key agreement %d", ret);
+			goto exit;
+		}
+	} else {
+		key_id = key_pair_id;
 	}
 
 	memcpy(&tmp_pub_key_buf[1], ecc.public_key_be, BT_PUB_KEY_LEN);
@@ -228,11 +230,13 @@ static void generate_dh_key(struct k_work *work)
 		goto exit;
 	}
 
-	ret = psa_destroy_key(key_id);
-	if (ret != PSA_SUCCESS) {
-		LOG_ERR("Failed to destroy the key %d", ret);
-		err = -EIO;
-		goto exit;
+	if (IS_ENABLED(CONFIG_BT_USE_DEBUG_KEYS)) {
+		ret = psa_destroy_key(key_id);
+		if (ret != PSA_SUCCESS) {
+			LOG_ERR("Failed to destroy the key %d", ret);
+			err = -EIO;
+			goto exit;
+		}
 	}
 
 	err = 0;
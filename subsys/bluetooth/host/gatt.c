@@ -1072,6 +1072,35 @@ BT_GATT_SERVICE_DEFINE(_1_gatt_svc,
 #endif /* CONFIG_BT_GATT_SERVICE_CHANGED */
 );
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+/* Attributes by handle - 1, NULL for unused handles */
+static const struct bt_gatt_attr *attr_index[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+static bool attr_index_valid;
+
+static uint8_t attr_index_add(const struct bt_gatt_attr *attr, uint16_t handle,
+			      void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	attr_index[handle - 1] = attr;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+/* Called with the scheduler locked, as registering and unregistering services */
+static void attr_index_rebuild(void)
+{
+	attr_index_valid = false;
+	memset(attr_index, 0, sizeof(attr_index));
+
+	bt_gatt_foreach_attr(0x0001, ARRAY_SIZE(attr_index), attr_index_add, NULL);
+
+	attr_index_valid = true;
+}
+#else
+static inline void attr_index_rebuild(void) {}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 #if defined(CONFIG_BT_GATT_DYNAMIC_DB)
 static uint8_t found_attr(const struct bt_gatt_attr *attr, uint16_t handle,
 			  void *user_data)
@@ -1155,6 +1184,7 @@ populate:
 	}
 
 	gatt_insert(svc, last_handle);
+	attr_index_rebuild();
 
 	return 0;
 }
@@ -1388,6 +1418,8 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+	attr_index_rebuild();
 }
 
 void bt_gatt_init(void)
@@ -1579,6 +1611,8 @@ static int gatt_unregister(struct bt_gatt_service *svc)
 		}
 	}
 
+	attr_index_rebuild();
+
 	return 0;
 }
 
@@ -1951,6 +1985,35 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+/* Iterate over the indexed handles of the range, returns false if the range
+ * goes on past the index.
+ */
+static bool foreach_attr_type_index(uint16_t start_handle, uint16_t end_handle,
+				    const struct bt_uuid *uuid,
+				    const void *attr_data, uint16_t *num_matches,
+				    bt_gatt_attr_func_t func, void *user_data)
+{
+	uint16_t last = MIN(end_handle, ARRAY_SIZE(attr_index));
+
+	for (uint16_t handle = MAX(start_handle, 1); handle <= last; handle++) {
+		const struct bt_gatt_attr *attr = attr_index[handle - 1];
+
+		if (attr == NULL) {
+			continue;
+		}
+
+		if (gatt_foreach_iter(attr, handle, start_handle, end_handle,
+				      uuid, attr_data, num_matches,
+				      func, user_data) == BT_GATT_ITER_STOP) {
+			return true;
+		}
+	}
+
+	return end_handle <= ARRAY_SIZE(attr_index);
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 			       const struct bt_uuid *uuid,
 			       const void *attr_data, uint16_t num_matches,
@@ -1962,6 +2025,19 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	if (attr_index_valid && start_handle <= ARRAY_SIZE(attr_index)) {
+		if (foreach_attr_type_index(start_handle, end_handle, uuid,
+					    attr_data, &num_matches, func,
+					    user_data)) {
+			return;
+		}
+
+		/* Walk the database for the handles past the index */
+		start_handle = ARRAY_SIZE(attr_index) + 1;
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -2374,8 +2450,9 @@ static int gatt_notify_mult(struct bt_conn *conn, uint16_t handle,
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE_FLUSH_MS != 0 */
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
 
-static int gatt_notify(struct bt_conn *conn, uint16_t handle,
-		       struct bt_gatt_notify_params *params)
+/* Send a notification to a peer known to be subscribed */
+static int gatt_notify_subscriber(struct bt_conn *conn, uint16_t handle,
+				  struct bt_gatt_notify_params *params)
 {
 	struct net_buf *buf;
 	struct bt_att_notify *nfy;
@@ -2399,17 +2476,6 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 		return -EPERM;
 	}
 
-	if (IS_ENABLED(CONFIG_BT_GATT_ENFORCE_SUBSCRIPTION)) {
-		/* Check if client has subscribed before sending notifications.
-		 * This is not really required in the Bluetooth specification,
-		 * but follows its spirit.
-		 */
-		if (!bt_gatt_is_subscribed(conn, params->attr, BT_GATT_CCC_NOTIFY)) {
-			LOG_DBG("Device is not subscribed to characteristic");
-			return -EINVAL;
-		}
-	}
-
 	if (IS_ENABLED(CONFIG_BT_EATT) &&
 	    !bt_att_chan_opt_valid(conn, BT_ATT_CHAN_OPT(params))) {
 		return -EINVAL;
@@ -2438,6 +2504,23 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 	return bt_att_send(conn, buf);
 }
 
+static int gatt_notify(struct bt_conn *conn, uint16_t handle,
+		       struct bt_gatt_notify_params *params)
+{
+	if (IS_ENABLED(CONFIG_BT_GATT_ENFORCE_SUBSCRIPTION)) {
+		/* Check if client has subscribed before sending notifications.
+		 * This is not really required in the Bluetooth specification,
+		 * but follows its spirit.
+		 */
+		if (!bt_gatt_is_subscribed(conn, params->attr, BT_GATT_CCC_NOTIFY)) {
+			LOG_DBG("Device is not subscribed to characteristic");
+			return -EINVAL;
+		}
+	}
+
+	return gatt_notify_subscriber(conn, handle, params);
+}
+
 /* Converts error (negative errno) to ATT Error code */
 static uint8_t att_err_from_int(int err)
 {
@@ -2701,7 +2784,8 @@ static uint8_t notify_cb(const struct bt_gatt_attr *attr, uint16_t handle,
 			}
 		} else if ((data->type == BT_GATT_CCC_NOTIFY) &&
 			   (cfg->value & BT_GATT_CCC_NOTIFY)) {
-			err = gatt_notify(conn, data->handle, data->nfy_params);
+			/* Subscription was checked above */
+			err = gatt_notify_subscriber(conn, data->handle, data->nfy_params);
 		} else {
 			err = 0;
 		}
@@ -975,10 +975,20 @@ int bt_iso_chan_send(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq
 	return conn_iso_send(iso_conn, buf, BT_ISO_TS_ABSENT);
 }
 
+static void push_ts_hdr(struct net_buf *buf, uint16_t seq_num, uint32_t ts)
+{
+	struct bt_hci_iso_sdu_ts_hdr *hdr;
+
+	hdr = net_buf_push(buf, sizeof(*hdr));
+	hdr->ts = sys_cpu_to_le32(ts);
+	hdr->sdu.sn = sys_cpu_to_le16(seq_num);
+	hdr->sdu.slen = sys_cpu_to_le16(
+		bt_iso_pkt_len_pack(net_buf_frags_len(buf) - sizeof(*hdr), BT_ISO_DATA_VALID));
+}
+
 int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
 			uint32_t ts)
 {
-	struct bt_hci_iso_sdu_ts_hdr *hdr;
 	struct bt_conn *iso_conn;
 	int err;
 
@@ -989,17 +999,55 @@ int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t
 
 	BT_ISO_DATA_DBG("chan %p len %zu ts %u", chan, net_buf_frags_len(buf), ts);
 
-	hdr = net_buf_push(buf, sizeof(*hdr));
-	hdr->ts = sys_cpu_to_le32(ts);
-	hdr->sdu.sn = sys_cpu_to_le16(seq_num);
-	hdr->sdu.slen = sys_cpu_to_le16(
-		bt_iso_pkt_len_pack(net_buf_frags_len(buf) - sizeof(*hdr), BT_ISO_DATA_VALID));
+	push_ts_hdr(buf, seq_num, ts);
 
 	iso_conn = chan->iso;
 
 	return conn_iso_send(iso_conn, buf, BT_ISO_TS_PRESENT);
 }
 
+int bt_iso_chan_send_ts_batch(struct bt_iso_chan *chans[], struct net_buf *bufs[],
+			      size_t count, uint16_t seq_num, uint32_t ts)
+{
+	int err;
+
+	CHECKIF(chans == NULL || bufs == NULL || count == 0U) {
+		LOG_DBG("Invalid parameters: chans %p bufs %p count %zu", chans, bufs, count);
+		return -EINVAL;
+	}
+
+	/* Validate all SDUs first, so that either all or none are sent */
+	for (size_t i = 0U; i < count; i++) {
+		err = validate_send(chans[i], bufs[i], BT_HCI_ISO_SDU_TS_HDR_SIZE);
+		if (err != 0) {
+			return err;
+		}
+
+		if (bufs[i]->user_data_size < CONFIG_BT_CONN_TX_USER_DATA_SIZE) {
+			LOG_DBG("Not enough room in user_data %d < %d", bufs[i]->user_data_size,
+				CONFIG_BT_CONN_TX_USER_DATA_SIZE);
+			return -EINVAL;
+		}
+	}
+
+	/* Queue all SDUs before the TX processor gets to run, so that they
+	 * are sent to the controller back to back.
+	 */
+	k_sched_lock();
+
+	for (size_t i = 0U; i < count; i++) {
+		BT_ISO_DATA_DBG("chan %p len %zu ts %u", chans[i], net_buf_frags_len(bufs[i]), ts);
+
+		push_ts_hdr(bufs[i], seq_num, ts);
+		err = conn_iso_send(chans[i]->iso, bufs[i], BT_ISO_TS_PRESENT);
+		__ASSERT_NO_MSG(err == 0);
+	}
+
+	k_sched_unlock();
+
+	return 0;
+}
+
 #if defined(CONFIG_BT_ISO_CENTRAL) || defined(CONFIG_BT_ISO_BROADCASTER)
 static bool valid_chan_io_qos(const struct bt_iso_chan_io_qos *io_qos, bool is_tx,
 			      bool is_broadcast, bool advanced)
@@ -125,6 +125,64 @@ K_MEM_SLAB_DEFINE(loopback_buf_pool,
 static uint32_t dup_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
 static int   dup_cache_next;
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_FILTER)
+/* Counting bloom filters in front of the caches, with two counters per
+ * value. A value with a zero counter is not cached, so the cache scan is
+ * skipped. Counters saturate and then stay set. Zero values are empty cache
+ * entries and are not tracked.
+ */
+#define CACHE_FILTER_SIZE (CONFIG_BT_MESH_MSG_CACHE_SIZE * 4)
+
+static uint8_t dup_filter[CACHE_FILTER_SIZE];
+static uint8_t msg_filter[CACHE_FILTER_SIZE];
+
+static inline uint32_t cache_filter_hash(uint32_t val)
+{
+	return ((val * 2654435761U) >> 16) % CACHE_FILTER_SIZE;
+}
+
+static void cache_filter_add(uint8_t *filter, uint32_t val)
+{
+	uint32_t slots[] = { val % CACHE_FILTER_SIZE, cache_filter_hash(val) };
+
+	if (!val) {
+		return;
+	}
+
+	ARRAY_FOR_EACH(slots, i) {
+		if (filter[slots[i]] < UINT8_MAX) {
+			filter[slots[i]]++;
+		}
+	}
+}
+
+static void cache_filter_del(uint8_t *filter, uint32_t val)
+{
+	uint32_t slots[] = { val % CACHE_FILTER_SIZE, cache_filter_hash(val) };
+
+	if (!val) {
+		return;
+	}
+
+	ARRAY_FOR_EACH(slots, i) {
+		if (filter[slots[i]] < UINT8_MAX) {
+			filter[slots[i]]--;
+		}
+	}
+}
+
+static bool cache_filter_match(const uint8_t *filter, uint32_t val)
+{
+	return !val || (filter[val % CACHE_FILTER_SIZE] && filter[cache_filter_hash(val)]);
+}
+#else
+static inline void cache_filter_add(uint8_t *filter, uint32_t val) {}
+static inline void cache_filter_del(uint8_t *filter, uint32_t val) {}
+static inline bool cache_filter_match(const uint8_t *filter, uint32_t val) { return true; }
+#define dup_filter NULL
+#define msg_filter NULL
+#endif /* CONFIG_BT_MESH_MSG_CACHE_FILTER */
+
 static bool check_dup(struct net_buf_simple *data)
 {
 	const uint8_t *tail = net_buf_simple_tail(data);
@@ -133,6 +191,10 @@ static bool check_dup(struct net_buf_simple *data)
 
 	val = sys_get_be32(tail - 4) ^ sys_get_be32(tail - 8);
 
+	if (!cache_filter_match(dup_filter, val)) {
+		goto add;
+	}
+
 	for (i = dup_cache_next; i > 0;) {
 		if (dup_cache[--i] == val) {
 			return true;
@@ -145,16 +207,34 @@ static bool check_dup(struct net_buf_simple *data)
 		}
 	}
 
+add:
 	dup_cache_next %= ARRAY_SIZE(dup_cache);
+	cache_filter_del(dup_filter, dup_cache[dup_cache_next]);
+	cache_filter_add(dup_filter, val);
 	dup_cache[dup_cache_next++] = val;
 
 	return false;
 }
 
+/* Filter value of a message cache entry, zero for empty entries */
+static uint32_t msg_cache_key(uint16_t src, uint32_t seq, uint16_t net_idx)
+{
+	if (src == BT_MESH_ADDR_UNASSIGNED) {
+		return 0;
+	}
+
+	return (((uint32_t)src << 17) | (seq & BIT_MASK(17))) ^ net_idx;
+}
+
 static bool msg_cache_match(struct net_buf_simple *pdu, uint16_t net_idx)
 {
 	uint16_t i;
 
+	if (!cache_filter_match(msg_filter,
+				msg_cache_key(SRC(pdu->data), SEQ(pdu->data), net_idx))) {
+		return false;
+	}
+
 	for (i = msg_cache_next; i > 0U;) {
 		if (msg_cache[--i].src == SRC(pdu->data) &&
 		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17)) &&
@@ -177,6 +257,10 @@ static bool msg_cache_match(struct net_buf_simple *pdu, uint16_t net_idx)
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
 	msg_cache_next %= ARRAY_SIZE(msg_cache);
+	cache_filter_del(msg_filter, msg_cache_key(msg_cache[msg_cache_next].src,
+						   msg_cache[msg_cache_next].seq,
+						   msg_cache[msg_cache_next].net_idx));
+	cache_filter_add(msg_filter, msg_cache_key(rx->ctx.addr, rx->seq, rx->sub->net_idx));
 	msg_cache[msg_cache_next].src = rx->ctx.addr;
 	msg_cache[msg_cache_next].seq = rx->seq;
 	msg_cache[msg_cache_next].net_idx = rx->sub->net_idx;
@@ -226,6 +310,9 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 
 	(void)memset(msg_cache, 0, sizeof(msg_cache));
 	msg_cache_next = 0U;
+#if defined(CONFIG_BT_MESH_MSG_CACHE_FILTER)
+	(void)memset(msg_filter, 0, sizeof(msg_filter));
+#endif
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -920,8 +1007,14 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		 */
 		LOG_WRN("Removing rejected message from Network Message Cache");
 		/* Rewind the next index now that we're not using this entry */
-		msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
-		dup_cache[--dup_cache_next] = 0;
+		msg_cache_next--;
+		cache_filter_del(msg_filter, msg_cache_key(msg_cache[msg_cache_next].src,
+							   msg_cache[msg_cache_next].seq,
+							   msg_cache[msg_cache_next].net_idx));
+		msg_cache[msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+		dup_cache_next--;
+		cache_filter_del(dup_filter, dup_cache[dup_cache_next]);
+		dup_cache[dup_cache_next] = 0;
 		return;
 	} else if (err == -EBADMSG) {
 		LOG_DBG("Not relaying message rejected by the Transport layer");
@@ -49,6 +49,82 @@ static inline int rpl_idx(const struct bt_mesh_rpl *rpl)
 	return rpl - &replay_list[0];
 }
 
+#if defined(CONFIG_BT_MESH_RPL_INDEX)
+/* Open addressing index of the replay list by source address. Slots hold the
+ * list index plus one, zero marks an empty slot. The index is twice the size
+ * of the list, so probing always ends on an empty slot.
+ */
+#define RPL_INDEX_SIZE (CONFIG_BT_MESH_CRPL * 2)
+
+static uint16_t rpl_index[RPL_INDEX_SIZE];
+static bool rpl_index_valid = true;
+
+static inline uint16_t rpl_index_slot(uint16_t src)
+{
+	return (src * 40503U) % RPL_INDEX_SIZE;
+}
+
+static void rpl_index_add(const struct bt_mesh_rpl *rpl)
+{
+	uint16_t slot = rpl_index_slot(rpl->src);
+
+	if (!rpl_index_valid) {
+		return;
+	}
+
+	while (rpl_index[slot]) {
+		slot = (slot + 1) % RPL_INDEX_SIZE;
+	}
+
+	rpl_index[slot] = rpl_idx(rpl) + 1;
+}
+
+static struct bt_mesh_rpl *rpl_index_find(uint16_t src)
+{
+	uint16_t slot;
+
+	if (!rpl_index_valid) {
+		return NULL;
+	}
+
+	for (slot = rpl_index_slot(src); rpl_index[slot];
+	     slot = (slot + 1) % RPL_INDEX_SIZE) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_index[slot] - 1];
+
+		if (rpl->src == src) {
+			return rpl;
+		}
+	}
+
+	return NULL;
+}
+
+/* Entries are moved around when the list is compacted, lookups fall back to
+ * scanning the list until the index is rebuilt.
+ */
+static void rpl_index_invalidate(void)
+{
+	rpl_index_valid = false;
+}
+
+static void rpl_index_rebuild(void)
+{
+	(void)memset(rpl_index, 0, sizeof(rpl_index));
+	rpl_index_valid = true;
+
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src) {
+			rpl_index_add(&replay_list[i]);
+		}
+	}
+}
+#else
+static inline void rpl_index_add(const struct bt_mesh_rpl *rpl) {}
+static inline struct bt_mesh_rpl *rpl_index_find(uint16_t src) { return NULL; }
+static inline void rpl_index_invalidate(void) {}
+static inline void rpl_index_rebuild(void) {}
+#endif /* CONFIG_BT_MESH_RPL_INDEX */
+
 static void clear_rpl(struct bt_mesh_rpl *rpl)
 {
 	int err;
@@ -92,7 +168,11 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
-	rpl->src = rx->ctx.addr;
+	if (rpl->src != rx->ctx.addr) {
+		rpl->src = rx->ctx.addr;
+		rpl_index_add(rpl);
+	}
+
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 
@@ -101,6 +181,27 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 	}
 }
 
+/* Check a message against the existing slot for its source address. */
+static bool rpl_replayed(const struct bt_mesh_rpl *rpl, const struct bt_mesh_net_rx *rx)
+{
+	if (!rpl->old_iv &&
+	    atomic_test_bit(rpl_flags, PENDING_RESET) &&
+	    !atomic_test_bit(store, rpl_idx(rpl))) {
+		/* Until rpl reset is finished, entry with old_iv == false and
+		 * without "store" bit set will be removed, therefore it can be
+		 * reused. If such entry is reused, "store" bit will be set and
+		 * the entry won't be removed.
+		 */
+		return false;
+	}
+
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
+
+	return !((!rx->old_iv && rpl->old_iv) || rpl->seq < rx->seq);
+}
+
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
  * parameter is given the RPL slot is returned, but it is not immediately
  * updated. This is used to prevent storing data in RPL that has been rejected
@@ -122,6 +223,15 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bo
 		return false;
 	}
 
+	rpl = rpl_index_find(rx->ctx.addr);
+	if (rpl) {
+		if (rpl_replayed(rpl, rx)) {
+			return true;
+		}
+
+		goto match;
+	}
+
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		rpl = &replay_list[i];
 
@@ -132,27 +242,11 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bo
 
 		/* Existing slot for given address */
 		if (rpl->src == rx->ctx.addr) {
-			if (!rpl->old_iv &&
-			    atomic_test_bit(rpl_flags, PENDING_RESET) &&
-			    !atomic_test_bit(store, i)) {
-				/* Until rpl reset is finished, entry with old_iv == false and
-				 * without "store" bit set will be removed, therefore it can be
-				 * reused. If such entry is reused, "store" bit will be set and
-				 * the entry won't be removed.
-				 */
-				goto match;
-			}
-
-			if (rx->old_iv && !rpl->old_iv) {
+			if (rpl_replayed(rpl, rx)) {
 				return true;
 			}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				goto match;
-			} else {
-				return true;
-			}
+			goto match;
 		}
 	}
 
@@ -175,6 +269,7 @@ void bt_mesh_rpl_clear(void)
 
 	if (!IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		rpl_index_rebuild();
 		return;
 	}
 
@@ -185,8 +280,14 @@ void bt_mesh_rpl_clear(void)
 
 static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
 {
+	struct bt_mesh_rpl *rpl;
 	int i;
 
+	rpl = rpl_index_find(src);
+	if (rpl) {
+		return rpl;
+	}
+
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		if (replay_list[i].src == src) {
 			return &replay_list[i];
@@ -203,6 +304,7 @@ static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		if (!replay_list[i].src) {
 			replay_list[i].src = src;
+			rpl_index_add(&replay_list[i]);
 			return &replay_list[i];
 		}
 	}
@@ -261,6 +363,7 @@ void bt_mesh_rpl_reset(void)
 		}
 
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_rebuild();
 	}
 }
 
@@ -288,6 +391,7 @@ static int rpl_set(const char *name, size_t len_rd,
 		LOG_DBG("val (null)");
 		if (entry) {
 			(void)memset(entry, 0, sizeof(*entry));
+			rpl_index_rebuild();
 		} else {
 			LOG_WRN("Unable to find RPL entry for 0x%04x", src);
 		}
@@ -365,6 +469,10 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 	clr = atomic_test_and_clear_bit(rpl_flags, PENDING_CLEAR);
 	rst = atomic_test_bit(rpl_flags, PENDING_RESET);
 
+	if (addr == BT_MESH_ADDR_ALL_NODES) {
+		rpl_index_invalidate();
+	}
+
 	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		struct bt_mesh_rpl *rpl = &replay_list[i];
 
@@ -406,6 +514,7 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 
 	if (addr == BT_MESH_ADDR_ALL_NODES) {
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_rebuild();
 	}
 }
 
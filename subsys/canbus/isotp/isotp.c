@@ -39,6 +39,33 @@ NET_BUF_POOL_VAR_DEFINE(isotp_tx_pool, CONFIG_ISOTP_TX_BUF_COUNT,
 			CONFIG_ISOTP_BUF_TX_DATA_POOL_SIZE, 0, NULL);
 #endif
 
+#ifdef CONFIG_ISOTP_WORKQUEUE
+static K_KERNEL_STACK_DEFINE(isotp_workq_stack, CONFIG_ISOTP_WORKQUEUE_STACK_SIZE);
+static struct k_work_q isotp_workq;
+
+static int isotp_workq_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "isotp_workq"};
+
+	k_work_queue_start(&isotp_workq, isotp_workq_stack,
+			   K_KERNEL_STACK_SIZEOF(isotp_workq_stack),
+			   CONFIG_ISOTP_WORKQUEUE_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(isotp_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_ISOTP_WORKQUEUE */
+
+static inline void isotp_work_submit(struct k_work *work)
+{
+#ifdef CONFIG_ISOTP_WORKQUEUE
+	(void)k_work_submit_to_queue(&isotp_workq, work);
+#else
+	(void)k_work_submit(work);
+#endif /* CONFIG_ISOTP_WORKQUEUE */
+}
+
 static void receive_state_machine(struct isotp_recv_ctx *rctx);
 
 static inline void prepare_frame(struct can_frame *frame, struct isotp_msg_id *addr)
@@ -69,7 +96,7 @@ static void receive_pool_free(struct net_buf *buf)
 
 	SYS_SLIST_FOR_EACH_NODE(&global_ctx.alloc_list, rctx_node) {
 		rctx = CONTAINER_OF(rctx_node, struct isotp_recv_ctx, alloc_node);
-		k_work_submit(&rctx->work);
+		isotp_work_submit(&rctx->work);
 	}
 }
 
@@ -82,7 +109,7 @@ static void receive_ff_sf_pool_free(struct net_buf *buf)
 
 	SYS_SLIST_FOR_EACH_NODE(&global_ctx.ff_sf_alloc_list, rctx_node) {
 		rctx = CONTAINER_OF(rctx_node, struct isotp_recv_ctx, alloc_node);
-		k_work_submit(&rctx->work);
+		isotp_work_submit(&rctx->work);
 	}
 }
 
@@ -101,7 +128,7 @@ static void receive_can_tx(const struct device *dev, int error, void *arg)
 	if (error != 0) {
 		LOG_ERR("Error sending FC frame (%d)", error);
 		receive_report_error(rctx, ISOTP_N_ERROR);
-		k_work_submit(&rctx->work);
+		isotp_work_submit(&rctx->work);
 	}
 }
 
@@ -217,7 +244,7 @@ static void receive_timeout_handler(struct k_timer *timer)
 		break;
 	}
 
-	k_work_submit(&rctx->work);
+	isotp_work_submit(&rctx->work);
 }
 
 static int receive_alloc_buffer(struct isotp_recv_ctx *rctx)
@@ -498,7 +525,7 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 		LOG_DBG("Waiting for CF but got something else (%d)",
 			frame->data[index] >> ISOTP_PCI_TYPE_POS);
 		receive_report_error(rctx, ISOTP_N_UNEXP_PDU);
-		k_work_submit(&rctx->work);
+		isotp_work_submit(&rctx->work);
 		return;
 	}
 
@@ -507,7 +534,7 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 	if ((frame->data[index++] & ISOTP_PCI_SN_MASK) != rctx->sn_expected++) {
 		LOG_ERR("Sequence number mismatch");
 		receive_report_error(rctx, ISOTP_N_WRONG_SN);
-		k_work_submit(&rctx->work);
+		isotp_work_submit(&rctx->work);
 		return;
 	}
 
@@ -585,7 +612,7 @@ static void receive_can_rx(const struct device *dev, struct can_frame *frame, vo
 		LOG_INF("Got a frame in a state where it is unexpected.");
 	}
 
-	k_work_submit(&rctx->work);
+	isotp_work_submit(&rctx->work);
 }
 
 static inline int add_ff_sf_filter(struct isotp_recv_ctx *rctx)
@@ -762,21 +789,8 @@ static void send_can_tx_cb(const struct device *dev, int error, void *arg)
 
 	ARG_UNUSED(dev);
 
-	if (sctx->tx_backlog > 0) {
-		sctx->tx_backlog--;
-	}
-
-	k_sem_give(&sctx->tx_sem);
-
-	if (sctx->state == ISOTP_TX_WAIT_BACKLOG) {
-		if (sctx->tx_backlog > 0) {
-			return;
-		}
-
-		sctx->state = ISOTP_TX_WAIT_FIN;
-	}
-
-	k_work_submit(&sctx->work);
+	(void)atomic_dec(&sctx->tx_backlog);
+	isotp_work_submit(&sctx->work);
 }
 
 static void send_timeout_handler(struct k_timer *timer)
@@ -788,7 +802,7 @@ static void send_timeout_handler(struct k_timer *timer)
 		LOG_ERR("Reception of next FC has timed out");
 	}
 
-	k_work_submit(&sctx->work);
+	isotp_work_submit(&sctx->work);
 }
 
 static void send_process_fc(struct isotp_send_ctx *sctx, struct can_frame *frame)
@@ -820,8 +834,6 @@ static void send_process_fc(struct isotp_send_ctx *sctx, struct can_frame *frame
 	case ISOTP_PCI_FS_CTS:
 		sctx->state = ISOTP_TX_SEND_CF;
 		sctx->wft = 0;
-		sctx->tx_backlog = 0;
-		k_sem_reset(&sctx->tx_sem);
 		sctx->opts.bs = *data++;
 		sctx->opts.stmin = *data++;
 		sctx->bs = sctx->opts.bs;
@@ -868,7 +880,7 @@ static void send_can_rx_cb(const struct device *dev, struct can_frame *frame, vo
 		send_report_error(sctx, ISOTP_N_UNEXP_PDU);
 	}
 
-	k_work_submit(&sctx->work);
+	isotp_work_submit(&sctx->work);
 }
 
 static size_t get_send_ctx_data_len(struct isotp_send_ctx *sctx)
@@ -942,7 +954,12 @@ static inline int send_sf(struct isotp_send_ctx *sctx)
 	}
 
 	sctx->state = ISOTP_TX_SEND_SF;
+	(void)atomic_inc(&sctx->tx_backlog);
 	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	if (ret != 0) {
+		(void)atomic_dec(&sctx->tx_backlog);
+	}
+
 	return ret;
 }
 
@@ -982,7 +999,12 @@ static inline int send_ff(struct isotp_send_ctx *sctx)
 	pull_send_ctx_data(sctx, sctx->tx_addr.dl - index);
 	memcpy(&frame.data[index], data, sctx->tx_addr.dl - index);
 
+	(void)atomic_inc(&sctx->tx_backlog);
 	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	if (ret != 0) {
+		(void)atomic_dec(&sctx->tx_backlog);
+	}
+
 	return ret;
 }
 
@@ -1024,12 +1046,15 @@ static inline int send_cf(struct isotp_send_ctx *sctx)
 		frame.dlc = can_bytes_to_dlc(len + index);
 	}
 
+	/* Counted before sending, as the frame may be sent before can_send() returns */
+	(void)atomic_inc(&sctx->tx_backlog);
 	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
 	if (ret == 0) {
 		sctx->sn++;
 		pull_send_ctx_data(sctx, len);
 		sctx->bs--;
-		sctx->tx_backlog++;
+	} else {
+		(void)atomic_dec(&sctx->tx_backlog);
 	}
 
 	ret = ret ? ret : rem_len;
@@ -1098,6 +1123,11 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 		LOG_DBG("SM send CF");
 		k_timer_stop(&sctx->timer);
 		do {
+			if (atomic_get(&sctx->tx_backlog) >= CONFIG_ISOTP_TX_CF_BACKLOG) {
+				/* Resumed by send_can_tx_cb once a queued frame is sent */
+				break;
+			}
+
 			ret = send_cf(sctx);
 			if (!ret) {
 				sctx->state = ISOTP_TX_WAIT_BACKLOG;
@@ -1121,9 +1151,6 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 				sctx->state = ISOTP_TX_WAIT_ST;
 				break;
 			}
-
-			/* Ensure FIFO style transmission of CF */
-			k_sem_take(&sctx->tx_sem, K_FOREVER);
 		} while (ret > 0);
 
 		break;
@@ -1136,6 +1163,13 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 
 	case ISOTP_TX_ERR:
 		LOG_DBG("SM error");
+		__fallthrough;
+	case ISOTP_TX_WAIT_BACKLOG:
+		if (atomic_get(&sctx->tx_backlog) > 0) {
+			/* Resumed by send_can_tx_cb once the queued frames are sent */
+			break;
+		}
+
 		__fallthrough;
 	case ISOTP_TX_SEND_SF:
 		__fallthrough;
@@ -1222,7 +1256,7 @@ static int send(struct isotp_send_ctx *sctx, const struct device *can_dev,
 		sctx->has_callback = 0;
 	}
 
-	k_sem_init(&sctx->tx_sem, 0, 1);
+	atomic_clear(&sctx->tx_backlog);
 	sctx->can_dev = can_dev;
 	sctx->tx_addr = *tx_addr;
 	sctx->rx_addr = *rx_addr;
@@ -1273,7 +1307,7 @@ static int send(struct isotp_send_ctx *sctx, const struct device *can_dev,
 
 		LOG_DBG("Starting work to send FF");
 		sctx->state = ISOTP_TX_SEND_FF;
-		k_work_submit(&sctx->work);
+		isotp_work_submit(&sctx->work);
 	} else {
 		LOG_DBG("Sending single frame");
 		sctx->filter_id = -1;
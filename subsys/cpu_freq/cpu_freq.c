@@ -69,6 +69,21 @@ static void cpu_freq_next_pstate(void)
 
 }
 
+int cpu_freq_pstate_fast_set(const struct pstate *state)
+{
+	int ret;
+
+	ret = cpu_freq_pstate_set(state);
+
+#ifndef CONFIG_SMP
+	if (ret == 0) {
+		pstate_last = state;
+	}
+#endif /* CONFIG_SMP */
+
+	return ret;
+}
+
 #if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1)
 static void cpu_freq_ipi_handler(struct k_ipi_work *work)
 {
@@ -0,0 +1,223 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/cpu_freq/policy.h>
+#include <zephyr/cpu_freq/cpu_freq.h>
+
+LOG_MODULE_REGISTER(cpu_freq_policy_util, CONFIG_CPU_FREQ_LOG_LEVEL);
+
+const struct pstate *soc_pstates[] = {
+	DT_FOREACH_CHILD_STATUS_OKAY_SEP(DT_PATH(performance_states), PSTATE_DT_GET, (,))
+};
+
+const size_t soc_pstates_count = ARRAY_SIZE(soc_pstates);
+
+#ifdef CONFIG_CPU_FREQ_PER_CPU_SCALING
+#define DOMAIN_CPUS CONFIG_CPU_FREQ_POLICY_UTIL_DOMAIN_CPUS
+#else
+#define DOMAIN_CPUS CONFIG_MP_MAX_NUM_CPUS
+#endif /* CONFIG_CPU_FREQ_PER_CPU_SCALING */
+
+#define NUM_DOMAINS DIV_ROUND_UP(CONFIG_MP_MAX_NUM_CPUS, DOMAIN_CPUS)
+
+#if defined(CONFIG_SMP) && (DOMAIN_CPUS > 1)
+
+/*
+ * IPI tracking is needed when CPUs share a frequency. The last CPU of each
+ * domain to call cpu_freq_policy_pstate_set() sets the best P-state for the
+ * whole domain.
+ */
+
+#define CPU_FREQ_IPI_TRACKING
+
+#endif /* CONFIG_SMP && (DOMAIN_CPUS > 1) */
+
+/* CPUs sharing a frequency, DOMAIN_CPUS consecutive CPU ids */
+struct util_domain {
+	const struct pstate *pstate; /* P-state applied to the domain */
+	uint8_t wake_load;           /* highest load of the threads woken since */
+#ifdef CPU_FREQ_IPI_TRACKING
+	const struct pstate *pstate_best;
+	unsigned int num_unprocessed_cpus;
+#endif /* CPU_FREQ_IPI_TRACKING */
+};
+
+static struct k_spinlock lock;
+static struct util_domain domains[NUM_DOMAINS];
+
+static struct util_domain *cpu_domain(unsigned int cpu_id)
+{
+	return &domains[cpu_id / DOMAIN_CPUS];
+}
+
+/* Load in percent needed to run a utilization with some headroom */
+static uint8_t util_to_load(uint32_t util)
+{
+	uint32_t load = (util * (100U + CONFIG_CPU_FREQ_POLICY_UTIL_HEADROOM)) /
+			K_THREAD_UTIL_SCALE;
+
+	return (uint8_t)MIN(load, 100U);
+}
+
+/* First P-state whose threshold the load reaches, P-states are in decreasing order */
+static const struct pstate *load_to_pstate(uint8_t load)
+{
+	for (int i = 0; i < soc_pstates_count; i++) {
+		if (load >= soc_pstates[i]->load_threshold) {
+			return soc_pstates[i];
+		}
+	}
+
+	return soc_pstates[soc_pstates_count - 1];
+}
+
+/*
+ * The utilization policy selects the P-state from the decayed utilization of
+ * the current CPU, as tracked by the scheduler, with some headroom so that
+ * the CPU is not run at full capacity. Threads woken since the last
+ * evaluation keep their frequency domain at the load matching their own
+ * utilization, so that a thread waking up after a long sleep does not wait
+ * for the CPU utilization to build up again.
+ */
+int cpu_freq_policy_select_pstate(const struct pstate **pstate_out)
+{
+	k_thread_runtime_stats_t stats;
+	struct util_domain *domain;
+	k_spinlock_key_t key;
+	int cpu_id = 0;
+	uint8_t load;
+
+	if (pstate_out == NULL) {
+		LOG_ERR("Util Policy: pstate_out is NULL");
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_SMP)
+	/* The caller has already ensured that the CPU is fixed */
+	cpu_id = arch_curr_cpu()->id;
+#endif
+
+	(void)k_thread_runtime_stats_cpu_get(cpu_id, &stats);
+	load = util_to_load(stats.util);
+
+	domain = cpu_domain(cpu_id);
+
+	key = k_spin_lock(&lock);
+	load = MAX(load, domain->wake_load);
+	domain->wake_load = 0U;
+	k_spin_unlock(&lock, key);
+
+	*pstate_out = load_to_pstate(load);
+
+	LOG_DBG("CPU%d Util: %u Load: %d%% Selected P-state with load_threshold=%d%%", cpu_id,
+		stats.util, load, (*pstate_out)->load_threshold);
+
+	return 0;
+}
+
+void cpu_freq_policy_reset(void)
+{
+#ifdef CPU_FREQ_IPI_TRACKING
+	unsigned int num_cpus = arch_num_cpus();
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (unsigned int i = 0; i < NUM_DOMAINS; i++) {
+		unsigned int first_cpu = i * DOMAIN_CPUS;
+
+		domains[i].pstate_best = NULL;
+		domains[i].num_unprocessed_cpus =
+			(num_cpus > first_cpu) ? MIN(num_cpus - first_cpu, DOMAIN_CPUS) : 0U;
+	}
+
+	k_spin_unlock(&lock, key);
+#endif
+}
+
+const struct pstate *cpu_freq_policy_pstate_set(const struct pstate *state)
+{
+	struct util_domain *domain;
+	k_spinlock_key_t key;
+	int cpu_id = 0;
+	int ret;
+
+#if defined(CONFIG_SMP)
+	cpu_id = arch_curr_cpu()->id;
+#endif
+
+	domain = cpu_domain(cpu_id);
+
+	key = k_spin_lock(&lock);
+
+#ifdef CPU_FREQ_IPI_TRACKING
+	if ((domain->pstate_best == NULL) ||
+	    (state->load_threshold > domain->pstate_best->load_threshold)) {
+		domain->pstate_best = state;
+	}
+
+	__ASSERT(domain->num_unprocessed_cpus != 0U, "cpu_freq: Out of sync");
+
+	domain->num_unprocessed_cpus--;
+	if (domain->num_unprocessed_cpus > 0) {
+		k_spin_unlock(&lock, key);
+		return NULL;
+	}
+	state = domain->pstate_best;
+#endif
+
+	/* Under the lock, not to race with the ramp up on thread wake up */
+	ret = cpu_freq_pstate_set(state);
+	if (ret == 0) {
+		domain->pstate = state;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ret != 0) {
+		LOG_ERR("Failed to set P-state: %d", ret);
+		return NULL;
+	}
+
+	return state;
+}
+
+/*
+ * Called by the scheduler when a thread becomes ready. The load of the thread
+ * is kept for the next evaluation of its frequency domain, which is its last
+ * CPU's. Latency critical threads need the highest P-state, and get it right
+ * away when woken up from their own domain rather than at the next evaluation.
+ * P-states of other domains can only be applied from one of their CPUs.
+ */
+void cpu_freq_policy_thread_ready(const struct k_thread *thread, uint32_t util)
+{
+	bool critical = thread->base.prio <= CONFIG_CPU_FREQ_POLICY_UTIL_BOOST_PRIO;
+	uint8_t load = critical ? 100U : util_to_load(util);
+	const struct pstate *state = soc_pstates[0];
+	struct util_domain *domain;
+	k_spinlock_key_t key;
+	int cpu_id = 0;
+
+#if defined(CONFIG_SMP)
+	cpu_id = thread->base.cpu;
+#endif
+
+	domain = cpu_domain(cpu_id);
+
+	key = k_spin_lock(&lock);
+
+	domain->wake_load = MAX(domain->wake_load, load);
+
+	/* Nothing applied yet means that the subsystem is not running */
+	if (critical && (domain == cpu_domain(arch_curr_cpu()->id)) && (domain->pstate != NULL) &&
+	    (state->load_threshold > domain->pstate->load_threshold)) {
+		if (cpu_freq_pstate_fast_set(state) == 0) {
+			domain->pstate = state;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/debug/boot_profile.h>
+#include <zephyr/debug/symtab.h>
+
+static const char *const level_names[] = {
+	"EARLY",
+	"PRE_KERNEL_1",
+	"PRE_KERNEL_2",
+	"POST_KERNEL",
+	"APPLICATION",
+	"SMP",
+};
+
+/*
+ * The profile lives in non-initialized RAM: it is filled before the BSS would
+ * be of any use to the early init levels, and stays readable by a debugger
+ * when the boot hangs in some init function.
+ */
+static struct {
+	timing_t epoch;
+	atomic_t count;
+	atomic_t dropped;
+	int level_index;
+	uint8_t level;
+	struct boot_profile_record records[CONFIG_BOOT_PROFILE_RECORDS];
+} profile __noinit;
+
+static uint64_t profile_now(void)
+{
+	timing_t now = timing_counter_get();
+	uint64_t cycles = timing_cycles_get(&profile.epoch, &now);
+
+	/* 0 is the end time of running steps */
+	return MAX(cycles, 1U);
+}
+
+void z_boot_profile_start(void)
+{
+	timing_init();
+	timing_start();
+
+	atomic_clear(&profile.count);
+	atomic_clear(&profile.dropped);
+	profile.level_index = -1;
+	profile.level = BOOT_PROFILE_LEVEL_NONE;
+	profile.epoch = timing_counter_get();
+}
+
+static int profile_alloc(enum boot_profile_type type, const void *what)
+{
+	atomic_val_t index = atomic_inc(&profile.count);
+	struct boot_profile_record *record;
+
+	if (index >= CONFIG_BOOT_PROFILE_RECORDS) {
+		(void)atomic_dec(&profile.count);
+		(void)atomic_inc(&profile.dropped);
+		return -1;
+	}
+
+	record = &profile.records[index];
+	record->end = 0U;
+	record->name = what;
+	record->thread = k_is_pre_kernel() ? NULL : k_current_get();
+	record->result = 0;
+	record->type = type;
+	record->level = profile.level;
+	record->start = profile_now();
+
+	return (int)index;
+}
+
+void z_boot_profile_level(uint8_t level)
+{
+	/* Init levels run one after the other from the boot thread */
+	z_boot_profile_exit(profile.level_index, 0);
+
+	profile.level = level;
+	profile.level_index = -1;
+
+	if (level < ARRAY_SIZE(level_names)) {
+		profile.level_index = profile_alloc(BOOT_PROFILE_LEVEL, level_names[level]);
+	}
+}
+
+int z_boot_profile_enter(enum boot_profile_type type, const void *what)
+{
+	return profile_alloc(type, what);
+}
+
+void z_boot_profile_exit(int index, int result)
+{
+	struct boot_profile_record *record;
+
+	if (index < 0) {
+		return;
+	}
+
+	record = &profile.records[index];
+	record->result = result;
+	record->end = profile_now();
+}
+
+void boot_profile_mark(const char *name)
+{
+	int index = profile_alloc(BOOT_PROFILE_MARK, name);
+
+	if (index >= 0) {
+		profile.records[index].end = profile.records[index].start;
+	}
+}
+
+size_t boot_profile_count(void)
+{
+	/* Steps being dropped bump the count for a moment */
+	return MIN((size_t)atomic_get(&profile.count), CONFIG_BOOT_PROFILE_RECORDS);
+}
+
+size_t boot_profile_dropped(void)
+{
+	return (size_t)atomic_get(&profile.dropped);
+}
+
+const struct boot_profile_record *boot_profile_get(size_t index)
+{
+	if (index >= boot_profile_count()) {
+		return NULL;
+	}
+
+	return &profile.records[index];
+}
+
+const char *boot_profile_name(const struct boot_profile_record *record)
+{
+	uint32_t offset;
+
+	switch (record->type) {
+	case BOOT_PROFILE_DEVICE:
+		return record->dev->name;
+	case BOOT_PROFILE_SYS_INIT:
+		if (!IS_ENABLED(CONFIG_SYMTAB)) {
+			return NULL;
+		}
+
+		return symtab_find_symbol_name((uintptr_t)record->init_fn, &offset);
+	default:
+		return record->name;
+	}
+}
+
+uint64_t boot_profile_cycles_to_ns(uint64_t cycles)
+{
+	return timing_cycles_to_ns(cycles);
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/debug/boot_profile.h>
+
+static const char *const type_names[] = {
+	[BOOT_PROFILE_LEVEL] = "level",
+	[BOOT_PROFILE_SYS_INIT] = "sys_init",
+	[BOOT_PROFILE_DEVICE] = "device",
+	[BOOT_PROFILE_MARK] = "mark",
+};
+
+static const char *thread_name(const struct boot_profile_record *record)
+{
+	const char *name = NULL;
+
+	if (record->thread == NULL) {
+		return "boot";
+	}
+
+	if (IS_ENABLED(CONFIG_THREAD_NAME)) {
+		name = k_thread_name_get((k_tid_t)record->thread);
+	}
+
+	return (name != NULL) && (name[0] != '\0') ? name : "?";
+}
+
+/*
+ * One line per record, with times in microseconds:
+ * <index> <type> <level> <start> <end> <result> <thread> <name>
+ * This format is parsed by scripts/profiling/boot_gantt.py.
+ */
+static int cmd_boot_profile_show(const struct shell *sh, size_t argc, char **argv)
+{
+	size_t count = boot_profile_count();
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "# index type level start_us end_us result thread name");
+
+	for (size_t i = 0; i < count; i++) {
+		const struct boot_profile_record *record = boot_profile_get(i);
+		const char *name = boot_profile_name(record);
+		char addr[2 + 2 * sizeof(uintptr_t) + 1];
+
+		if (name == NULL) {
+			snprintk(addr, sizeof(addr), "%p", (void *)record->init_fn);
+			name = addr;
+		}
+
+		shell_print(sh, "%u %s %u %llu %llu %d %s %s", (unsigned int)i,
+			    type_names[record->type], record->level,
+			    boot_profile_cycles_to_ns(record->start) / NSEC_PER_USEC,
+			    boot_profile_cycles_to_ns(record->end) / NSEC_PER_USEC,
+			    record->result, thread_name(record), name);
+	}
+
+	if (boot_profile_dropped() != 0U) {
+		shell_warn(sh, "%u steps dropped, increase CONFIG_BOOT_PROFILE_RECORDS",
+			   (unsigned int)boot_profile_dropped());
+	}
+
+	return 0;
+}
+
+static int cmd_boot_profile_top(const struct shell *sh, size_t argc, char **argv)
+{
+	size_t count = boot_profile_count();
+	uint64_t last = UINT64_MAX;
+	unsigned long num = 10;
+	int err = 0;
+
+	if (argc > 1) {
+		num = shell_strtoul(argv[1], 10, &err);
+		if (err != 0) {
+			shell_error(sh, "Invalid count: %s", argv[1]);
+			return err;
+		}
+	}
+
+	/* Longest steps first, the table is small enough for repeated scans */
+	for (unsigned long n = 0; n < num; n++) {
+		const struct boot_profile_record *longest = NULL;
+		uint64_t longest_cycles = 0U;
+
+		for (size_t i = 0; i < count; i++) {
+			const struct boot_profile_record *record = boot_profile_get(i);
+			uint64_t cycles;
+
+			if ((record->type != BOOT_PROFILE_SYS_INIT &&
+			     record->type != BOOT_PROFILE_DEVICE) ||
+			    (record->end == 0U)) {
+				continue;
+			}
+
+			cycles = record->end - record->start;
+			if ((cycles > longest_cycles) && (cycles < last)) {
+				longest = record;
+				longest_cycles = cycles;
+			}
+		}
+
+		if (longest == NULL) {
+			break;
+		}
+
+		last = longest_cycles;
+		shell_print(sh, "%10llu us %-8s %s",
+			    boot_profile_cycles_to_ns(longest_cycles) / NSEC_PER_USEC,
+			    type_names[longest->type],
+			    boot_profile_name(longest) != NULL ? boot_profile_name(longest) : "?");
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_boot_profile,
+	SHELL_CMD(show, NULL, "Show all the boot profile records", cmd_boot_profile_show),
+	SHELL_CMD_ARG(top, NULL, "Show the longest init steps [count]", cmd_boot_profile_top, 1, 1),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(boot_profile, &sub_boot_profile, "Boot profiler commands", NULL);
@@ -0,0 +1,108 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* A "hand" goes round the page frames. A frame accessed since the hand
+ * last passed it gets a second chance: its accessed flag is cleared and
+ * the hand moves on. The first frame found not accessed and clean is
+ * evicted. Writing back a dirty page is only accepted if a whole
+ * revolution found no clean candidate. If every frame was accessed, the
+ * second revolution finds the ones whose flag was just cleared.
+ *
+ * Unlike NRU, there is no periodic timer clearing the accessed flag of
+ * every page: frames are only looked at when eviction is needed, and the
+ * accessed flag tells whether a page was used since the previous
+ * revolution, which approximates its working set under the current
+ * memory pressure.
+ */
+static uint32_t clock_hand;
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	const uint32_t num_frames = ARRAY_SIZE(k_mem_page_frames);
+	struct k_mem_page_frame *dirty_pf = NULL, *pf;
+	uintptr_t flags;
+
+	for (uint32_t n = 0; n < 2 * num_frames; n++) {
+		if ((n == num_frames) && (dirty_pf != NULL)) {
+			break;
+		}
+
+		pf = &k_mem_page_frames[clock_hand];
+		clock_hand = (clock_hand + 1) % num_frames;
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Read and clear the accessed flag */
+		flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		k_mem_paging_prefetch_check(pf, flags);
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			/* Second chance */
+			continue;
+		}
+
+		if ((flags & ARCH_DATA_PAGE_DIRTY) == 0UL) {
+			*dirty_ptr = false;
+			return pf;
+		}
+
+		if (dirty_pf == NULL) {
+			dirty_pf = pf;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(dirty_pf != NULL, "no page to evict");
+
+	*dirty_ptr = true;
+
+	return dirty_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * The accessed flag is all this algorithm needs. These are only defined
+ * for architectures which unconditionally implement eviction tracking.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
@@ -121,7 +121,7 @@ static void lru_pf_remove(uint32_t pf_idx)
 
 		/* clearing the accessed flag expected only on loaded pages */
 		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0, "");
-		ARG_UNUSED(flags);
+		k_mem_paging_prefetch_check(pf, flags);
 	}
 }
 
@@ -152,6 +152,8 @@ void k_mem_paging_eviction_accessed(uintptr_t phys)
 	uint32_t pf_idx = pf_to_idx(pf);
 	k_spinlock_key_t key = k_spin_lock(&lru_lock);
 
+	k_mem_paging_prefetch_check(pf, ARCH_DATA_PAGE_ACCESSED);
+
 	if (lru_pf_in_queue(pf_idx)) {
 		lru_pf_remove(pf_idx);
 		lru_pf_append(pf_idx);
@@ -36,8 +36,10 @@ static void nru_periodic_update(struct k_timer *timer)
 		}
 
 		/* Clear accessed bit in page tables */
-		(void)arch_page_info_get(k_mem_page_frame_to_virt(pf),
-					 NULL, true);
+		uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf),
+						     NULL, true);
+
+		k_mem_paging_prefetch_check(pf, flags);
 	}
 
 	irq_unlock(key);
@@ -0,0 +1,347 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/dfu/mcuboot.h>
+#include <zephyr/dfu/flash_img.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(flash_img, CONFIG_IMG_MANAGER_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_IMG_DELTA_BUF_SIZE >= FLASH_IMG_DELTA_HEADER_SIZE,
+	     "CONFIG_IMG_DELTA_BUF_SIZE cannot hold the patch header");
+
+#define HEADER_SOURCE_SIZE_OFF 4
+#define HEADER_TARGET_SIZE_OFF 8
+#define HEADER_SOURCE_SHA_OFF 12
+#define HEADER_TARGET_SHA_OFF 44
+
+enum delta_state {
+	DELTA_STATE_HEADER,
+	DELTA_STATE_OP,
+	DELTA_STATE_ARG,
+	DELTA_STATE_DATA,
+};
+
+bool flash_img_delta_is_patch(const uint8_t *data, size_t len)
+{
+	return (len >= sizeof(uint32_t)) && (sys_get_le32(data) == FLASH_IMG_DELTA_MAGIC);
+}
+
+int flash_img_delta_init_id(struct flash_img_delta_context *ctx, uint8_t area_id,
+			    uint8_t source_area_id)
+{
+	int rc;
+
+	memset(ctx, 0, offsetof(struct flash_img_delta_context, buf));
+
+	rc = flash_area_open(source_area_id, &ctx->source);
+	if (rc != 0) {
+		return rc;
+	}
+
+	rc = flash_img_init_id(&ctx->img, area_id);
+	if (rc != 0) {
+		flash_area_close(ctx->source);
+		ctx->source = NULL;
+		return rc;
+	}
+
+	ctx->source_start = boot_get_image_start_offset(source_area_id);
+	ctx->area_id = area_id;
+	ctx->state = DELTA_STATE_HEADER;
+
+	return 0;
+}
+
+int flash_img_delta_init(struct flash_img_delta_context *ctx)
+{
+#ifdef CONFIG_MCUBOOT_BOOTLOADER_MODE_RAM_LOAD
+	/* The running image is loaded from the active slot */
+	uint8_t source_area_id = boot_fetch_active_slot();
+#else
+	uint8_t source_area_id = DT_FIXED_PARTITION_ID(DT_CHOSEN(zephyr_code_partition));
+#endif
+
+	return flash_img_delta_init_id(ctx, flash_img_get_upload_slot(), source_area_id);
+}
+
+size_t flash_img_delta_bytes_read(struct flash_img_delta_context *ctx)
+{
+	return ctx->patch_off;
+}
+
+static int delta_start(struct flash_img_delta_context *ctx)
+{
+	uint8_t source_sha[32];
+
+	if (sys_get_le32(ctx->buf) != FLASH_IMG_DELTA_MAGIC) {
+		LOG_ERR("Not a patch");
+		return -EINVAL;
+	}
+
+	ctx->source_size = sys_get_le32(&ctx->buf[HEADER_SOURCE_SIZE_OFF]);
+	ctx->target_size = sys_get_le32(&ctx->buf[HEADER_TARGET_SIZE_OFF]);
+	memcpy(source_sha, &ctx->buf[HEADER_SOURCE_SHA_OFF], sizeof(source_sha));
+	memcpy(ctx->target_sha, &ctx->buf[HEADER_TARGET_SHA_OFF], sizeof(ctx->target_sha));
+
+	if (ctx->source_start + ctx->source_size > ctx->source->fa_size) {
+		LOG_ERR("Source image larger than its slot: %zu", ctx->source_size);
+		return -EINVAL;
+	}
+
+	if (ctx->target_size > ctx->img.stream.available) {
+		LOG_ERR("Target image larger than its slot: %zu", ctx->target_size);
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
+	struct flash_area_check fac = {
+		.match = source_sha,
+		.clen = ctx->source_size,
+		.off = ctx->source_start,
+		.rbuf = ctx->buf,
+		.rblen = sizeof(ctx->buf),
+	};
+
+	if (flash_area_check_int_sha256(ctx->source, &fac) != 0) {
+		LOG_ERR("Patch does not apply to the source image");
+		return -EINVAL;
+	}
+#endif
+
+	return 0;
+}
+
+static int delta_emit(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len)
+{
+	int rc;
+
+	if (len > ctx->target_size - ctx->target_off) {
+		LOG_ERR("Patch overruns the target image");
+		return -EINVAL;
+	}
+
+	rc = flash_img_buffered_write(&ctx->img, data, len, false);
+	if (rc != 0) {
+		return rc;
+	}
+
+	ctx->target_off += len;
+
+	return 0;
+}
+
+/* Reads len bytes of the source image at the current position into ctx->buf */
+static int delta_read_source(struct flash_img_delta_context *ctx, size_t len)
+{
+	int rc;
+
+	if (len > ctx->source_size - ctx->source_off) {
+		LOG_ERR("Patch overruns the source image");
+		return -EINVAL;
+	}
+
+	rc = flash_area_read(ctx->source, ctx->source_start + ctx->source_off, ctx->buf, len);
+	if (rc != 0) {
+		return rc;
+	}
+
+	ctx->source_off += len;
+
+	return 0;
+}
+
+static int delta_copy(struct flash_img_delta_context *ctx, size_t len)
+{
+	while (len > 0) {
+		size_t n = MIN(len, sizeof(ctx->buf));
+		int rc;
+
+		rc = delta_read_source(ctx, n);
+		if (rc == 0) {
+			rc = delta_emit(ctx, ctx->buf, n);
+		}
+
+		if (rc != 0) {
+			return rc;
+		}
+
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int delta_add(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		size_t n = MIN(len, sizeof(ctx->buf));
+		int rc;
+
+		rc = delta_read_source(ctx, n);
+		if (rc != 0) {
+			return rc;
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			ctx->buf[i] += data[i];
+		}
+
+		rc = delta_emit(ctx, ctx->buf, n);
+		if (rc != 0) {
+			return rc;
+		}
+
+		data += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int delta_seek(struct flash_img_delta_context *ctx, uint32_t arg)
+{
+	/* Zigzag encoding, even arguments move forward and odd ones back */
+	size_t dist = (arg >> 1) + (arg & 1U);
+
+	if ((arg & 1U) == 0U) {
+		if (dist > ctx->source_size - ctx->source_off) {
+			return -EINVAL;
+		}
+
+		ctx->source_off += dist;
+	} else {
+		if (dist > ctx->source_off) {
+			return -EINVAL;
+		}
+
+		ctx->source_off -= dist;
+	}
+
+	return 0;
+}
+
+/* Runs an operation once its argument is decoded */
+static int delta_op(struct flash_img_delta_context *ctx)
+{
+	ctx->state = DELTA_STATE_OP;
+
+	switch (ctx->op) {
+	case FLASH_IMG_DELTA_OP_COPY:
+		return delta_copy(ctx, ctx->arg);
+	case FLASH_IMG_DELTA_OP_ADD:
+	case FLASH_IMG_DELTA_OP_INSERT:
+		if (ctx->arg > 0) {
+			ctx->state = DELTA_STATE_DATA;
+		}
+		return 0;
+	case FLASH_IMG_DELTA_OP_SEEK:
+		return delta_seek(ctx, ctx->arg);
+	default:
+		LOG_ERR("Unknown patch operation %u", ctx->op);
+		return -EINVAL;
+	}
+}
+
+int flash_img_delta_write(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len,
+			  bool flush)
+{
+	int rc = 0;
+	int ret;
+
+	while ((len > 0) && (rc == 0)) {
+		size_t n = 1;
+
+		switch (ctx->state) {
+		case DELTA_STATE_HEADER:
+			n = MIN(len, FLASH_IMG_DELTA_HEADER_SIZE - ctx->patch_off);
+			memcpy(&ctx->buf[ctx->patch_off], data, n);
+			if (ctx->patch_off + n == FLASH_IMG_DELTA_HEADER_SIZE) {
+				rc = delta_start(ctx);
+				ctx->state = DELTA_STATE_OP;
+			}
+			break;
+		case DELTA_STATE_OP:
+			ctx->op = *data;
+			ctx->arg = 0U;
+			ctx->arg_shift = 0U;
+			ctx->state = DELTA_STATE_ARG;
+			break;
+		case DELTA_STATE_ARG:
+			if ((ctx->arg_shift > 28U) ||
+			    ((ctx->arg_shift == 28U) && ((*data & 0x70U) != 0U))) {
+				LOG_ERR("Patch operation argument too large");
+				rc = -EINVAL;
+				break;
+			}
+
+			ctx->arg |= (uint32_t)(*data & 0x7fU) << ctx->arg_shift;
+			ctx->arg_shift += 7U;
+			if ((*data & 0x80U) == 0U) {
+				rc = delta_op(ctx);
+			}
+			break;
+		case DELTA_STATE_DATA:
+			n = MIN(len, ctx->arg);
+			if (ctx->op == FLASH_IMG_DELTA_OP_ADD) {
+				rc = delta_add(ctx, data, n);
+			} else {
+				rc = delta_emit(ctx, data, n);
+			}
+
+			ctx->arg -= n;
+			if (ctx->arg == 0U) {
+				ctx->state = DELTA_STATE_OP;
+			}
+			break;
+		}
+
+		data += n;
+		len -= n;
+		ctx->patch_off += n;
+	}
+
+	if (!flush) {
+		return rc;
+	}
+
+	if ((rc == 0) && ((ctx->state != DELTA_STATE_OP) || (ctx->target_off != ctx->target_size))) {
+		LOG_ERR("Patch truncated at %zu bytes", ctx->patch_off);
+		rc = -EINVAL;
+	}
+
+	if (ctx->source != NULL) {
+		flash_area_close(ctx->source);
+		ctx->source = NULL;
+	}
+
+	/* Let the image writer release the slot even if the patch failed */
+	ret = flash_img_buffered_write(&ctx->img, NULL, 0, true);
+
+	return (rc != 0) ? rc : ret;
+}
+
+int flash_img_delta_check(struct flash_img_delta_context *ctx)
+{
+#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
+	const struct flash_img_check fic = {
+		.match = ctx->target_sha,
+		.clen = ctx->target_size,
+	};
+
+	return flash_img_check(&ctx->img, &fic, ctx->area_id);
+#else
+	ARG_UNUSED(ctx);
+
+	return -ENOTSUP;
+#endif
+}
@@ -13,6 +13,7 @@
 #include <zephyr/storage/disk_access.h>
 #include <errno.h>
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
 
 #define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -54,6 +55,175 @@ struct disk_info *disk_access_get_di(const char *name)
 	return disk;
 }
 
+#ifdef CONFIG_DISK_ACCESS_WRITE_CACHE
+#ifdef CONFIG_SDHC_BUFFER_ALIGNMENT
+#define WRITE_CACHE_ALIGN MAX(CONFIG_SDHC_BUFFER_ALIGNMENT, sizeof(void *))
+#else
+#define WRITE_CACHE_ALIGN sizeof(void *)
+#endif
+
+/* Run of adjacent sectors written to a single disk and not yet written to
+ * it. The buffer is aligned for DMA, so the run is written as is.
+ */
+static struct {
+	struct disk_info *disk;
+	uint32_t sector_size;
+	uint32_t start;
+	uint32_t count;
+} write_cache;
+
+static uint8_t write_cache_buf[CONFIG_DISK_ACCESS_WRITE_CACHE_SECTORS *
+			       CONFIG_DISK_ACCESS_WRITE_CACHE_SECTOR_SIZE] __aligned(WRITE_CACHE_ALIGN);
+
+static K_MUTEX_DEFINE(write_cache_lock);
+
+/* Called with write_cache_lock held. Buffered sectors are dropped on error,
+ * which is reported to the caller.
+ */
+static int write_cache_flush(void)
+{
+	int rc = 0;
+
+	if (write_cache.count != 0U) {
+		rc = write_cache.disk->ops->write(write_cache.disk, write_cache_buf,
+						  write_cache.start, write_cache.count);
+		if (rc != 0) {
+			LOG_ERR("Failed to write %u sectors at %u (%d)", write_cache.count,
+				write_cache.start, rc);
+		}
+
+		write_cache.count = 0U;
+	}
+
+	return rc;
+}
+
+static bool write_cache_overlaps(struct disk_info *disk, uint32_t start_sector,
+				 uint32_t num_sector)
+{
+	return (write_cache.count != 0U) && (write_cache.disk == disk) &&
+	       (start_sector < (write_cache.start + write_cache.count)) &&
+	       (write_cache.start < (start_sector + num_sector));
+}
+
+static int write_cache_sync(struct disk_info *disk)
+{
+	int rc = 0;
+
+	k_mutex_lock(&write_cache_lock, K_FOREVER);
+	if (write_cache.disk == disk) {
+		rc = write_cache_flush();
+	}
+	k_mutex_unlock(&write_cache_lock);
+
+	return rc;
+}
+
+static int write_cache_read(struct disk_info *disk, uint8_t *data_buf,
+			    uint32_t start_sector, uint32_t num_sector)
+{
+	int rc = 0;
+
+	k_mutex_lock(&write_cache_lock, K_FOREVER);
+	if (write_cache_overlaps(disk, start_sector, num_sector)) {
+		if ((start_sector >= write_cache.start) &&
+		    ((start_sector + num_sector) <= (write_cache.start + write_cache.count))) {
+			memcpy(data_buf,
+			       &write_cache_buf[(start_sector - write_cache.start) *
+						write_cache.sector_size],
+			       num_sector * write_cache.sector_size);
+			k_mutex_unlock(&write_cache_lock);
+			return 0;
+		}
+
+		rc = write_cache_flush();
+	}
+	k_mutex_unlock(&write_cache_lock);
+
+	if (rc == 0) {
+		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	return rc;
+}
+
+static int write_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+			     uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t capacity = 0U;
+	int rc = 0;
+
+	k_mutex_lock(&write_cache_lock, K_FOREVER);
+
+	if (write_cache.disk != disk) {
+		(void)write_cache_flush();
+		write_cache.disk = disk;
+		if ((disk->ops->ioctl == NULL) ||
+		    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+				      &write_cache.sector_size) != 0)) {
+			write_cache.sector_size = 0U;
+		}
+	}
+
+	if ((write_cache.sector_size != 0U) &&
+	    (write_cache.sector_size <= CONFIG_DISK_ACCESS_WRITE_CACHE_SECTOR_SIZE)) {
+		capacity = sizeof(write_cache_buf) / write_cache.sector_size;
+	}
+
+	if (num_sector > capacity) {
+		/* Already large enough, written directly after older data */
+		if (write_cache_overlaps(disk, start_sector, num_sector)) {
+			rc = write_cache_flush();
+		}
+
+		if (rc == 0) {
+			rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		}
+
+		k_mutex_unlock(&write_cache_lock);
+		return rc;
+	}
+
+	/* Extend the run if the sectors are adjacent to or within it */
+	if ((write_cache.count != 0U) &&
+	    ((start_sector < write_cache.start) ||
+	     (start_sector > (write_cache.start + write_cache.count)) ||
+	     ((start_sector + num_sector) > (write_cache.start + capacity)))) {
+		rc = write_cache_flush();
+	}
+
+	if (rc == 0) {
+		if (write_cache.count == 0U) {
+			write_cache.start = start_sector;
+		}
+
+		memcpy(&write_cache_buf[(start_sector - write_cache.start) *
+					write_cache.sector_size],
+		       data_buf, num_sector * write_cache.sector_size);
+		write_cache.count = MAX(write_cache.count,
+					start_sector + num_sector - write_cache.start);
+	}
+
+	k_mutex_unlock(&write_cache_lock);
+
+	return rc;
+}
+
+static int write_cache_erase(struct disk_info *disk, uint32_t start_sector,
+			     uint32_t num_sector)
+{
+	int rc = 0;
+
+	k_mutex_lock(&write_cache_lock, K_FOREVER);
+	if (write_cache_overlaps(disk, start_sector, num_sector)) {
+		rc = write_cache_flush();
+	}
+	k_mutex_unlock(&write_cache_lock);
+
+	return rc;
+}
+#endif /* CONFIG_DISK_ACCESS_WRITE_CACHE */
+
 int disk_access_init(const char *pdrv)
 {
 	struct disk_info *disk = disk_access_get_di(pdrv);
@@ -98,7 +268,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_WRITE_CACHE
+		rc = write_cache_read(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -112,7 +286,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_WRITE_CACHE
+		rc = write_cache_write(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -142,6 +320,12 @@ int disk_access_erase(const char *pdrv, uint32_t start_sector, uint32_t num_sect
 	}
 
 	if ((disk != NULL) && (disk->ops != NULL) && (disk->ops->erase != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_WRITE_CACHE
+		rc = write_cache_erase(disk, start_sector, num_sector);
+		if (rc != 0) {
+			return rc;
+		}
+#endif
 		rc = disk->ops->erase(disk, start_sector, num_sector);
 	}
 
@@ -155,6 +339,14 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->ioctl != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_WRITE_CACHE
+		if ((cmd == DISK_IOCTL_CTRL_SYNC) || (cmd == DISK_IOCTL_CTRL_DEINIT)) {
+			rc = write_cache_sync(disk);
+			if ((rc != 0) && (cmd == DISK_IOCTL_CTRL_SYNC)) {
+				return rc;
+			}
+		}
+#endif
 		switch (cmd) {
 		case DISK_IOCTL_CTRL_INIT:
 			if (disk->refcnt == 0U) {
@@ -234,6 +426,15 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DISK_ACCESS_WRITE_CACHE
+	(void)write_cache_sync(disk);
+	k_mutex_lock(&write_cache_lock, K_FOREVER);
+	if (write_cache.disk == disk) {
+		write_cache.disk = NULL;
+	}
+	k_mutex_unlock(&write_cache_lock);
+#endif
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
@@ -286,6 +286,32 @@ static inline void zdsp_not_u32(const DSP_DATA uint32_t *src, DSP_DATA uint32_t
 	arm_not_u32(src, dst, block_size);
 }
 
+/* The MWDT DSP library has no drop-in FIR and biquad filters, use the CMSIS-DSP ones */
+static inline void zdsp_fir_f32(const struct zdsp_fir_f32 *fir, const DSP_DATA float32_t *src,
+				DSP_DATA float32_t *dst, uint32_t block_size)
+{
+	const arm_fir_instance_f32 instance = {
+		.numTaps = fir->num_taps,
+		.pState = fir->state,
+		.pCoeffs = fir->coeffs,
+	};
+
+	arm_fir_f32(&instance, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_f32(const struct zdsp_biquad_f32 *biquad,
+				   const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+				   uint32_t block_size)
+{
+	const arm_biquad_cascade_df2T_instance_f32 instance = {
+		.numStages = biquad->num_stages,
+		.pState = biquad->state,
+		.pCoeffs = biquad->coeffs,
+	};
+
+	arm_biquad_cascade_df2T_f32(&instance, src, dst, block_size);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -269,6 +269,30 @@ static inline void zdsp_not_u32(const uint32_t *src, uint32_t *dst, uint32_t blo
 	arm_not_u32(src, dst, block_size);
 }
 
+static inline void zdsp_fir_f32(const struct zdsp_fir_f32 *fir, const float32_t *src,
+				float32_t *dst, uint32_t block_size)
+{
+	const arm_fir_instance_f32 instance = {
+		.numTaps = fir->num_taps,
+		.pState = fir->state,
+		.pCoeffs = fir->coeffs,
+	};
+
+	arm_fir_f32(&instance, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_f32(const struct zdsp_biquad_f32 *biquad, const float32_t *src,
+				   float32_t *dst, uint32_t block_size)
+{
+	const arm_biquad_cascade_df2T_instance_f32 instance = {
+		.numStages = biquad->num_stages,
+		.pState = biquad->state,
+		.pCoeffs = biquad->coeffs,
+	};
+
+	arm_biquad_cascade_df2T_f32(&instance, src, dst, block_size);
+}
+
 #ifdef __cplusplus
 }
 #endif
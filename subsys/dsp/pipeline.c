@@ -0,0 +1,59 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/dsp/pipeline.h>
+
+void zdsp_pipeline_fir_f32(const struct zdsp_pipeline_stage *stage, const float32_t *src,
+			   float32_t *dst, uint32_t block_size)
+{
+	zdsp_fir_f32(stage->data, src, dst, block_size);
+}
+
+void zdsp_pipeline_biquad_f32(const struct zdsp_pipeline_stage *stage, const float32_t *src,
+			      float32_t *dst, uint32_t block_size)
+{
+	zdsp_biquad_f32(stage->data, src, dst, block_size);
+}
+
+void zdsp_pipeline_scale_f32(const struct zdsp_pipeline_stage *stage, const float32_t *src,
+			     float32_t *dst, uint32_t block_size)
+{
+	zdsp_scale_f32(src, *(const float32_t *)stage->data, dst, block_size);
+}
+
+int zdsp_pipeline_process(struct zdsp_pipeline *pipeline, float32_t *data, uint32_t block_size)
+{
+	float32_t *cur = data;
+
+	if (block_size > pipeline->block_size) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < pipeline->num_stages; i++) {
+		const struct zdsp_pipeline_stage *stage = &pipeline->stages[i];
+		float32_t *dst;
+
+		if (stage->in_place) {
+			dst = cur;
+		} else {
+			/* Ping-pong between the block and the work buffer */
+			dst = (cur == data) ? pipeline->work : data;
+		}
+
+		stage->process(stage, cur, dst, block_size);
+		cur = dst;
+	}
+
+	if (cur != data) {
+		memcpy(data, cur, block_size * sizeof(*data));
+	}
+
+	return 0;
+}
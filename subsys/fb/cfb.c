@@ -63,10 +63,45 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+	/** First row modified since the last finalize */
+	uint16_t dirty_y0;
+
+	/** Row after the last row modified since the last finalize */
+	uint16_t dirty_y1;
 };
 
 static struct char_framebuffer char_fb;
 
+/*
+ * Record the rows modified in the framebuffer, so that the finalize only
+ * transfers those to the display.
+ */
+static void mark_dirty(struct char_framebuffer *fb, int16_t y, int16_t height)
+{
+	const int32_t y0 = MAX(y, 0);
+	const int32_t y1 = MIN(y + height, fb->y_res);
+
+	if (y0 >= y1) {
+		return;
+	}
+
+	fb->dirty_y0 = MIN(fb->dirty_y0, y0);
+	fb->dirty_y1 = MAX(fb->dirty_y1, y1);
+}
+
+static inline void mark_all_dirty(struct char_framebuffer *fb)
+{
+	fb->dirty_y0 = 0U;
+	fb->dirty_y1 = fb->y_res;
+}
+
+static inline void mark_clean(struct char_framebuffer *fb)
+{
+	fb->dirty_y0 = fb->y_res;
+	fb->dirty_y1 = 0U;
+}
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, uint8_t c)
 {
 	if (c < fptr->first_char || c > fptr->last_char) {
@@ -300,6 +335,7 @@ static inline void draw_point(struct char_framebuffer *fb, int16_t x, int16_t y)
 	}
 
 	fb->buf[index] |= m;
+	mark_dirty(fb, y, 1);
 }
 
 static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
@@ -335,7 +371,7 @@ static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16
 static int draw_text(const struct device *dev, const char *const str, int16_t x, int16_t y,
 		     bool wrap)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const struct cfb_font *fptr;
 
 	if (!fb->fonts || !fb->buf) {
@@ -356,6 +392,7 @@ static int draw_text(const struct device *dev, const char *const str, int16_t x,
 			x = 0U;
 			y += fptr->height;
 		}
+		mark_dirty(fb, y, fptr->height);
 		if (fb->screen_info & SCREEN_INFO_MONO_VTILED) {
 			x += fb->kerning + draw_char_vtmono(fb, str[i], x, y, wrap);
 		} else {
@@ -440,7 +477,7 @@ int cfb_print(const struct device *dev, const char *const str, uint16_t x, uint1
 int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 		    uint16_t width, uint16_t height)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const bool need_reverse = ((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0);
 
 	if (x >= fb->x_res || y >= fb->y_res) {
@@ -465,6 +502,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 		height = fb->y_res - y;
 	}
 
+	mark_dirty(fb, y, height);
+
 	if ((fb->screen_info & SCREEN_INFO_MONO_VTILED)) {
 		for (size_t i = x; i < x + width; i++) {
 			for (size_t j = y; j < (y + height); j++) {
@@ -549,24 +588,23 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 	return 0;
 }
 
-static int cfb_invert(const struct char_framebuffer *fb)
+static void cfb_invert(uint8_t *buf, size_t size)
 {
-	for (size_t i = 0; i < fb->x_res * fb->y_res / 8U; i++) {
-		fb->buf[i] = ~fb->buf[i];
+	for (size_t i = 0; i < size; i++) {
+		buf[i] = ~buf[i];
 	}
-
-	return 0;
 }
 
 int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 
 	if (!fb->buf) {
 		return -ENODEV;
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_all_dirty(fb);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -580,6 +618,7 @@ int cfb_framebuffer_invert(const struct device *dev)
 	struct char_framebuffer *fb = &char_fb;
 
 	fb->inverted = !fb->inverted;
+	mark_all_dirty(fb);
 
 	return 0;
 }
@@ -587,7 +626,10 @@ int cfb_framebuffer_invert(const struct device *dev)
 int cfb_framebuffer_finalize(const struct device *dev)
 {
 	const struct display_driver_api *api = dev->api;
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
+	uint16_t y0 = fb->dirty_y0;
+	uint16_t y1 = fb->dirty_y1;
+	uint8_t *buf;
 	int err;
 
 	__ASSERT_NO_MSG(DEVICE_API_IS(display, dev));
@@ -596,21 +638,42 @@ int cfb_framebuffer_finalize(const struct device *dev)
 		return -ENODEV;
 	}
 
+	if (y0 >= y1) {
+		return 0;
+	}
+
+	/*
+	 * Only write the band of modified rows, over the full width, as it is
+	 * contiguous in the framebuffer for both tiling directions.
+	 */
+	if (fb->screen_info & SCREEN_INFO_MONO_VTILED) {
+		y0 = ROUND_DOWN(y0, fb->ppt);
+		y1 = MIN(ROUND_UP(y1, fb->ppt), fb->y_res);
+		buf = fb->buf + (y0 / fb->ppt) * fb->x_res;
+	} else {
+		buf = fb->buf + y0 * (fb->x_res / fb->ppt);
+	}
+
 	struct display_buffer_descriptor desc = {
-		.buf_size = fb->size,
+		.buf_size = (y1 - y0) * fb->x_res / fb->ppt,
 		.width = fb->x_res,
-		.height = fb->y_res,
+		.height = y1 - y0,
 		.pitch = fb->x_res,
 	};
 
 	if ((fb->pixel_format == PIXEL_FORMAT_MONO10) != fb->inverted) {
-		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
-		cfb_invert(fb);
-		return err;
+		cfb_invert(buf, desc.buf_size);
+		err = api->write(dev, 0, y0, &desc, buf);
+		cfb_invert(buf, desc.buf_size);
+	} else {
+		err = api->write(dev, 0, y0, &desc, buf);
+	}
+
+	if (err == 0) {
+		mark_clean(fb);
 	}
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+	return err;
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -719,6 +782,9 @@ int cfb_framebuffer_init(const struct device *dev)
 
 	memset(fb->buf, 0, fb->size);
 
+	/* The display contents are unknown until the first finalize */
+	mark_all_dirty(fb);
+
 	return 0;
 }
 
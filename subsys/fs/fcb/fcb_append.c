@@ -136,5 +136,11 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	if (rc) {
 		return -EIO;
 	}
+
+	/* Program the element written in pieces with write combining */
+	rc = flash_area_flush(fcb->fap);
+	if (rc) {
+		return -EIO;
+	}
 	return 0;
 }
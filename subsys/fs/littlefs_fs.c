@@ -173,13 +173,76 @@ static int errno_to_lfs(int error)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
+#if CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE > 0
+/* littlefs reads files one cache at a time. Reading ahead up to the end of
+ * the block turns sequential reads into a few large flash reads, which burst
+ * or XIP capable drivers serve much faster.
+ */
+static int read_ahead(const struct lfs_config *c, lfs_block_t block,
+		      lfs_off_t off, void *buffer, lfs_size_t size)
+{
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+	const struct flash_area *fa = c->context;
+	lfs_size_t len;
+	int rc;
+
+	if ((block != fs->ra_block) || (off < fs->ra_off) ||
+	    ((off + size) > (fs->ra_off + fs->ra_len))) {
+		len = MIN(sizeof(fs->ra_buffer), c->block_size - off);
+		fs->ra_len = 0;
+
+		rc = flash_area_read(fa, block * c->block_size + off, fs->ra_buffer, len);
+		if (rc < 0) {
+			return rc;
+		}
+
+		fs->ra_block = block;
+		fs->ra_off = off;
+		fs->ra_len = len;
+	}
+
+	memcpy(buffer, &fs->ra_buffer[off - fs->ra_off], size);
+
+	return 0;
+}
+
+static void read_ahead_invalidate(const struct lfs_config *c, lfs_block_t block)
+{
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	if (block == fs->ra_block) {
+		fs->ra_len = 0;
+	}
+}
+#else
+static inline void read_ahead_invalidate(const struct lfs_config *c, lfs_block_t block)
+{
+}
+#endif /* CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE > 0 */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
+	int rc;
+#if CONFIG_FLASH_MAP_MMAP
+	const void *src;
+
+	if (flash_area_mmap(fa, offset, size, &src) == 0) {
+		memcpy(buffer, src, size);
+		return LFS_ERR_OK;
+	}
+#endif
+
+#if CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE > 0
+	if (size < CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE) {
+		rc = read_ahead(c, block, off, buffer, size);
+		return errno_to_lfs(rc);
+	}
+#endif
 
-	int rc = flash_area_read(fa, offset, buffer, size);
+	rc = flash_area_read(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
 }
@@ -190,6 +253,8 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+	read_ahead_invalidate(c, block);
+
 	int rc = flash_area_write(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
@@ -200,6 +265,8 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
 
+	read_ahead_invalidate(c, block);
+
 	int rc = flash_area_flatten(fa, offset, c->block_size);
 
 	return errno_to_lfs(rc);
@@ -258,7 +325,13 @@ static int lfs_api_erase_blk(const struct lfs_config *c, lfs_block_t block)
 
 static int lfs_api_sync(const struct lfs_config *c)
 {
+#ifdef CONFIG_FLASH_MAP_WRITE_COMBINE
+	int rc = flash_area_flush(c->context);
+
+	return errno_to_lfs(rc);
+#else
 	return LFS_ERR_OK;
+#endif
 }
 
 static void release_file_data(struct fs_file_t *fp)
@@ -909,6 +982,12 @@ static int littlefs_init_cfg(struct fs_littlefs *fs, int flags)
 		lcp->cache_size = cache_size;
 		lcp->lookahead_size = lookahead_size;
 		lcp->sync = lfs_api_sync;
+
+#if CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE > 0
+		__ASSERT((CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE % read_size) == 0,
+			 "read-ahead size must be a multiple of read size");
+		fs->ra_len = 0;
+#endif
 	}
 
 #ifdef CONFIG_FS_LITTLEFS_DISK_VERSION
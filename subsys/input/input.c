@@ -73,6 +73,91 @@ int input_report(const struct device *dev,
 
 #ifdef CONFIG_INPUT_MODE_THREAD
 
+#ifdef CONFIG_INPUT_COALESCE
+
+/* Events of one device waiting for dispatch, updated by the queued ones */
+static struct input_event frame[CONFIG_INPUT_COALESCE_MAX_EVENTS];
+static uint8_t frame_len;
+static bool frame_sync;
+
+static void input_frame_flush(void)
+{
+	for (uint8_t i = 0; i < frame_len; i++) {
+		frame[i].sync = (i == frame_len - 1) && frame_sync;
+		input_process(&frame[i]);
+	}
+
+	frame_len = 0;
+}
+
+static void input_frame_add(struct input_event *evt)
+{
+	struct input_event *entry = NULL;
+
+	if (frame_len > 0 && frame[0].dev != evt->dev) {
+		input_frame_flush();
+	}
+
+	for (uint8_t i = 0; i < frame_len; i++) {
+		if (frame[i].type == evt->type && frame[i].code == evt->code) {
+			entry = &frame[i];
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		if (frame_len == ARRAY_SIZE(frame)) {
+			input_frame_flush();
+		}
+		frame[frame_len++] = *evt;
+	} else if (evt->type == INPUT_EV_ABS) {
+		entry->value = evt->value;
+	} else if (evt->type == INPUT_EV_REL) {
+		entry->value += evt->value;
+	} else if (entry->value != evt->value) {
+		/* Other events, such as a key release, must not be merged */
+		input_frame_flush();
+		frame[frame_len++] = *evt;
+	}
+
+	frame_sync = evt->sync;
+}
+
+static void input_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct input_event evt;
+	int ret;
+
+	while (true) {
+		ret = k_msgq_get(&input_msgq, &evt, K_FOREVER);
+		if (ret) {
+			LOG_ERR("k_msgq_get error: %d", ret);
+			continue;
+		}
+
+		/* Merge the events queued behind while the listeners were
+		 * busy, so that they only see the latest state. Bounded so
+		 * that a steady stream of events does not hold the dispatch.
+		 */
+		for (int i = 1; true; i++) {
+			input_frame_add(&evt);
+
+			if (i == CONFIG_INPUT_QUEUE_MAX_MSGS ||
+			    k_msgq_get(&input_msgq, &evt, K_NO_WAIT) != 0) {
+				break;
+			}
+		}
+
+		input_frame_flush();
+	}
+}
+
+#else /* CONFIG_INPUT_COALESCE */
+
 static void input_thread(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1);
@@ -93,6 +178,8 @@ static void input_thread(void *p1, void *p2, void *p3)
 	}
 }
 
+#endif /* CONFIG_INPUT_COALESCE */
+
 #define INPUT_THREAD_PRIORITY \
 	COND_CODE_1(CONFIG_INPUT_THREAD_PRIORITY_OVERRIDE, \
 		    (CONFIG_INPUT_THREAD_PRIORITY), (K_LOWEST_APPLICATION_THREAD_PRIO))
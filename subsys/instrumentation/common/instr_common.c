@@ -16,6 +16,7 @@
 #include <zephyr/drivers/uart.h>
 #include <zephyr/kernel.h>
 #include <zephyr/kernel_structs.h>
+#include <zephyr/linker/linker-defs.h>
 #include <zephyr/retention/retention.h>
 #include <zephyr/sys/reboot.h>
 
@@ -49,6 +50,34 @@ static bool _instr_profiling_disabled;
 static bool _instr_tracing_supported = IS_ENABLED(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH);
 static bool _instr_profiling_supported = IS_ENABLED(CONFIG_INSTRUMENTATION_MODE_STATISTICAL);
 static bool _instr_dynamic_trigger_supported = IS_ENABLED(CONFIG_INSTRUMENTATION_DYNAMIC_TRIGGER);
+static bool _instr_snapshot_taken;
+
+#if CONFIG_INSTRUMENTATION_SNAPSHOT_LATENCY_US > 0
+/* Time the trigger function was called, to check the latency of the region */
+static uint64_t region_start_ns;
+#endif
+
+#if defined(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH_COMPACT)
+/*
+ * Compact records only carry the time elapsed since the previous record. A full
+ * record, with the absolute timestamp, is still written at least every
+ * COMPACT_RUN_MAX records so the host can recover absolute time even if the
+ * oldest records were overwritten.
+ */
+#define COMPACT_RUN_MAX 256
+static uint64_t last_record_ns;
+static uint32_t compact_run = COMPACT_RUN_MAX;
+#endif
+
+#if defined(CONFIG_INSTRUMENTATION_FILTER)
+#define FILTER_GRANULE CONFIG_INSTRUMENTATION_FILTER_GRANULE
+#define FILTER_BITS (CONFIG_INSTRUMENTATION_FILTER_TEXT_SIZE / FILTER_GRANULE)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(FILTER_GRANULE), "Filter granule must be a power of two");
+
+/* One bit per granule of the text region, set when the code is not instrumented */
+static uint32_t filter_off[DIV_ROUND_UP(FILTER_BITS, 32)];
+#endif
 
 #if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
 /*
@@ -217,6 +246,10 @@ bool instr_enabled(void)
 __no_instrumentation__
 int instr_turn_on(void)
 {
+#if CONFIG_INSTRUMENTATION_SNAPSHOT_LATENCY_US > 0
+	region_start_ns = instr_timestamp_ns();
+#endif
+
 	_instr_on = true;
 
 	return 0;
@@ -227,9 +260,78 @@ int instr_turn_off(void)
 {
 	_instr_on = false;
 
+#if CONFIG_INSTRUMENTATION_SNAPSHOT_LATENCY_US > 0
+	if ((instr_timestamp_ns() - region_start_ns) >
+	    (CONFIG_INSTRUMENTATION_SNAPSHOT_LATENCY_US * NSEC_PER_USEC)) {
+		instr_snapshot();
+	}
+#endif
+
 	return 0;
 }
 
+__no_instrumentation__
+void instr_snapshot(void)
+{
+	/* Keep the trace buffer as is until it is dumped */
+	_instr_snapshot_taken = true;
+	_instr_tracing_disabled = true;
+}
+
+__no_instrumentation__
+bool instr_snapshot_taken(void)
+{
+	return _instr_snapshot_taken;
+}
+
+#if defined(CONFIG_INSTRUMENTATION_FILTER)
+__no_instrumentation__
+void instr_filter_set(void *start, void *end, bool enable)
+{
+	uintptr_t base = (uintptr_t)__text_region_start;
+	uintptr_t first, last;
+
+	if (((uintptr_t)end <= (uintptr_t)start) || ((uintptr_t)end <= base)) {
+		return;
+	}
+
+	first = ((uintptr_t)start > base) ? (((uintptr_t)start - base) / FILTER_GRANULE) : 0;
+	last = MIN(DIV_ROUND_UP((uintptr_t)end - base, FILTER_GRANULE), FILTER_BITS);
+
+	for (uintptr_t idx = first; idx < last; idx++) {
+		if (enable) {
+			filter_off[idx / 32] &= ~BIT(idx % 32);
+		} else {
+			filter_off[idx / 32] |= BIT(idx % 32);
+		}
+	}
+}
+
+__no_instrumentation__
+void instr_filter_set_all(bool enable)
+{
+	memset(filter_off, enable ? 0x00 : 0xff, sizeof(filter_off));
+}
+#endif
+
+/*
+ * Checked for every event, so kept to a single test. Addresses below the text
+ * region wrap around to an index out of the filter and are instrumented.
+ */
+__no_instrumentation__
+static inline bool instr_filtered(void *callee)
+{
+#if defined(CONFIG_INSTRUMENTATION_FILTER)
+	uintptr_t idx = ((uintptr_t)callee - (uintptr_t)__text_region_start) / FILTER_GRANULE;
+
+	return (idx < FILTER_BITS) && ((filter_off[idx / 32] & BIT(idx % 32)) != 0);
+#else
+	ARG_UNUSED(callee);
+
+	return false;
+#endif
+}
+
 __no_instrumentation__
 bool instr_turned_on(void)
 {
@@ -505,16 +607,45 @@ static void set_up_record(struct instr_record *record, enum instr_event_types ty
 
 }
 
-static bool instr_record_data_put(struct instr_record *record)
+__no_instrumentation__
+static uint32_t instr_record_size(enum instr_event_types type)
+{
+	if ((type == INSTR_EVENT_ENTRY_COMPACT) || (type == INSTR_EVENT_EXIT_COMPACT)) {
+		return sizeof(struct instr_record_compact);
+	}
+
+	return sizeof(struct instr_record);
+}
+
+/* Drop the oldest record, records can have different sizes */
+__no_instrumentation__
+static bool instr_buffer_drop_oldest(void)
+{
+	uint8_t *type;
+
+	if (instr_buffer_get_claim(&type, 1) == 0) {
+		return false;
+	}
+
+	instr_buffer_get_finish(0);
+	instr_buffer_get(NULL, instr_record_size(*type));
+
+	return true;
+}
+
+__no_instrumentation__
+static bool instr_record_data_put(void *record, uint32_t length)
 {
 	uint32_t total_size = 0U;
 
 	uint8_t *data = (uint8_t *) record, *buf;
-	uint32_t length = sizeof(struct instr_record), claimed_size;
+	uint32_t claimed_size;
 
 	/* If record won't fit, free enough space in the buffer */
-	if (instr_buffer_space_get() < sizeof(struct instr_record)) {
-		instr_buffer_get(NULL, sizeof(struct instr_record));
+	while (instr_buffer_space_get() < length) {
+		if (!instr_buffer_drop_oldest()) {
+			break;
+		}
 	}
 
 	do {
@@ -534,6 +665,47 @@ static bool instr_record_data_put(struct instr_record *record)
 	return true;
 }
 
+__no_instrumentation__
+static bool instr_record_put(enum instr_event_types type, void *callee, void *caller)
+{
+	struct instr_record record;
+
+#if defined(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH_COMPACT)
+	uint64_t now = instr_timestamp_ns();
+	uint64_t delta_t = now - last_record_ns;
+
+	last_record_ns = now;
+
+	if (((type == INSTR_EVENT_ENTRY) || (type == INSTR_EVENT_EXIT)) &&
+	    (delta_t <= UINT32_MAX) && (compact_run < COMPACT_RUN_MAX)) {
+		struct instr_record_compact compact;
+
+		compact_run++;
+
+		compact.header.type = (type == INSTR_EVENT_ENTRY) ? INSTR_EVENT_ENTRY_COMPACT
+								  : INSTR_EVENT_EXIT_COMPACT;
+		compact.callee = callee;
+		compact.delta_t = (uint32_t)delta_t;
+		compact.cpu = arch_proc_id();
+		compact.thread_id = k_current_get();
+		compact.mode = compact.thread_id ? k_thread_priority_get(compact.thread_id) : 0;
+
+		return instr_record_data_put(&compact, sizeof(compact));
+	}
+
+	compact_run = 0;
+#endif
+
+	set_up_record(&record, type, callee, caller);
+
+#if defined(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH_COMPACT)
+	/* Same time base as the following compact records */
+	record.timestamp = now;
+#endif
+
+	return instr_record_data_put(&record, sizeof(record));
+}
+
 __no_instrumentation__
 void instr_event_handler(enum instr_event_types type, void *callee, void *caller)
 {
@@ -550,7 +722,7 @@ void instr_event_handler(enum instr_event_types type, void *callee, void *caller
 	 */
 	assert(type == INSTR_EVENT_ENTRY || type == INSTR_EVENT_EXIT);
 
-	if (!instr_turned_on()) {
+	if (!instr_turned_on() || instr_filtered(callee)) {
 		return;
 	}
 
@@ -583,16 +755,13 @@ void instr_event_handler(enum instr_event_types type, void *callee, void *caller
 
 	/* Tracing */
 	if (!_instr_tracing_disabled) {
-		struct instr_record record;
-
 		if (!IS_ENABLED(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH_BUFFER_OVERWRITE) &&
 				instr_buffer_space_get() < sizeof(struct instr_record)) {
 			_instr_tracing_disabled = true;
 			return;
 		}
 
-		set_up_record(&record, type, callee, caller);
-		instr_record_data_put(&record);
+		instr_record_put(type, callee, caller);
 	}
 
 	if (type == INSTR_EVENT_SCHED_IN ||
@@ -27,8 +27,8 @@ void handle_cmd(char *cmd, uint32_t length)
 	if (strncmp("reboot", cmd, length) == 0) {
 		sys_reboot(SYS_REBOOT_COLD);
 	} else if (strncmp("status", cmd, length) == 0) {
-		printk("%d %d %d\n", instr_tracing_supported(), instr_profiling_supported(),
-		       instr_dynamic_trigger_supported());
+		printk("%d %d %d %d\n", instr_tracing_supported(), instr_profiling_supported(),
+		       instr_dynamic_trigger_supported(), instr_snapshot_taken());
 	} else if (strncmp("ping", cmd, length) == 0) {
 		printk("pong\n");
 	} else if (strncmp("dump_trace", cmd, length) == 0) {
@@ -51,6 +51,26 @@ void handle_cmd(char *cmd, uint32_t length)
 		} else {
 			printk("stopper: invalid argument in: '%s'\n", cmd);
 		}
+#if defined(CONFIG_INSTRUMENTATION_FILTER)
+	} else if (strncmp(cmd, "enable_all", strlen("enable_all")) == 0) {
+		instr_filter_set_all(true);
+	} else if (strncmp(cmd, "disable_all", strlen("disable_all")) == 0) {
+		instr_filter_set_all(false);
+	} else if ((strncmp(cmd, "enable", strlen("enable")) == 0) ||
+		   (strncmp(cmd, "disable", strlen("disable")) == 0)) {
+		bool enable = (cmd[0] == 'e');
+		long end;
+
+		beginptr = cmd + (enable ? strlen("enable") : strlen("disable"));
+		address = strtol(beginptr, &endptr, 16);
+		beginptr = endptr;
+		end = strtol(beginptr, &endptr, 16);
+		if (endptr != beginptr) {
+			instr_filter_set((void *)address, (void *)end, enable);
+		} else {
+			printk("filter: invalid argument in: '%s'\n", cmd);
+		}
+#endif
 	} else if (strncmp("listsets", cmd, length) == 0) {
 		void *address;
 
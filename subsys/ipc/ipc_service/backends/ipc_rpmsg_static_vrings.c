@@ -38,6 +38,28 @@
 
 K_THREAD_STACK_ARRAY_DEFINE(mbox_stack, NUM_INSTANCES, WQ_STACK_SIZE);
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX)
+#define DEFERRED_RX_QUEUE_SIZE	CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX_QUEUE_SIZE
+
+static K_THREAD_STACK_DEFINE(deferred_rx_stack,
+			     CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX_STACK_SIZE);
+static struct k_work_q deferred_rx_wq;
+
+struct deferred_rx_msg {
+	void *data;
+	size_t len;
+};
+
+/* Messages of a low priority endpoint, held in the RX vring until processed */
+struct deferred_rx {
+	struct ipc_rpmsg_ept *ept;
+	bool enabled;
+	struct k_work work;
+	struct k_msgq msgq;
+	char msgq_buf[DEFERRED_RX_QUEUE_SIZE * sizeof(struct deferred_rx_msg)];
+};
+#endif /* CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX */
+
 struct backend_data_t {
 	/* RPMsg */
 	struct ipc_rpmsg_instance rpmsg_inst;
@@ -55,6 +77,11 @@ struct backend_data_t {
 
 	/* TX buffer size */
 	int tx_buffer_size;
+
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX)
+	/* Low priority endpoints */
+	struct deferred_rx deferred_rx[NUM_ENDPOINTS];
+#endif
 };
 
 struct backend_config_t {
@@ -216,6 +243,64 @@ static void bound_cb(struct ipc_rpmsg_ept *ept)
 	}
 }
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX)
+static struct deferred_rx *get_deferred_rx(struct ipc_rpmsg_ept *ept)
+{
+	struct rpmsg_virtio_device *p_rvdev;
+	struct ipc_rpmsg_instance *rpmsg_inst;
+	struct backend_data_t *data;
+	struct deferred_rx *drx;
+
+	p_rvdev = CONTAINER_OF(ept->ep.rdev, struct rpmsg_virtio_device, rdev);
+	rpmsg_inst = CONTAINER_OF(p_rvdev, struct ipc_rpmsg_instance, rvdev);
+	data = CONTAINER_OF(rpmsg_inst, struct backend_data_t, rpmsg_inst);
+	drx = &data->deferred_rx[ept - rpmsg_inst->endpoint];
+
+	return drx->enabled ? drx : NULL;
+}
+
+static void deferred_rx_process(struct k_work *item)
+{
+	struct deferred_rx *drx = CONTAINER_OF(item, struct deferred_rx, work);
+	struct ipc_rpmsg_ept *ept = drx->ept;
+	struct deferred_rx_msg msg;
+
+	while (k_msgq_get(&drx->msgq, &msg, K_NO_WAIT) == 0) {
+		ept->cb->received(msg.data, msg.len, ept->priv);
+		rpmsg_release_rx_buffer(&ept->ep, msg.data);
+	}
+}
+
+static void deferred_rx_flush(struct deferred_rx *drx)
+{
+	static struct k_work_sync sync;
+	struct deferred_rx_msg msg;
+
+	drx->enabled = false;
+	k_work_flush(&drx->work, &sync);
+
+	/* Give back buffers queued after the work ran */
+	while (k_msgq_get(&drx->msgq, &msg, K_NO_WAIT) == 0) {
+		rpmsg_release_rx_buffer(&drx->ept->ep, msg.data);
+	}
+}
+
+static int deferred_rx_wq_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "rpmsg_deferred_rx",
+	};
+
+	k_work_queue_start(&deferred_rx_wq, deferred_rx_stack,
+			   K_THREAD_STACK_SIZEOF(deferred_rx_stack),
+			   CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(deferred_rx_wq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX */
+
 static int ept_cb(struct rpmsg_endpoint *ep, void *data, size_t len, uint32_t src, void *priv)
 {
 	struct ipc_rpmsg_ept *ept;
@@ -242,6 +327,27 @@ static int ept_cb(struct rpmsg_endpoint *ep, void *data, size_t len, uint32_t sr
 		return RPMSG_SUCCESS;
 	}
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX)
+	struct deferred_rx *drx = get_deferred_rx(ept);
+
+	if (drx != NULL && ept->cb->received) {
+		struct deferred_rx_msg msg = {
+			.data = data,
+			.len = len,
+		};
+
+		/*
+		 * Hand the message over in place to the deferred work queue, so
+		 * that the messages of other endpoints are not delayed by it.
+		 */
+		rpmsg_hold_rx_buffer(ep, data);
+		(void)k_msgq_put(&drx->msgq, &msg, K_FOREVER);
+		(void)k_work_submit_to_queue(&deferred_rx_wq, &drx->work);
+
+		return RPMSG_SUCCESS;
+	}
+#endif
+
 	if (ept->cb->received) {
 		ept->cb->received(data, len, ept->priv);
 	}
@@ -464,6 +570,11 @@ static int register_ept(const struct device *instance, void **token,
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX)
+	/* Endpoints with a lower priority than the default one are deferred */
+	data->deferred_rx[rpmsg_ept - rpmsg_inst->endpoint].enabled = (cfg->prio > 0);
+#endif
+
 	(*token) = rpmsg_ept;
 
 	return 0;
@@ -494,6 +605,10 @@ static int deregister_ept(const struct device *instance, void *token)
 	 */
 	k_work_flush(&data->mbox_work, &sync);
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX)
+	deferred_rx_flush(&data->deferred_rx[rpmsg_ept - data->rpmsg_inst.endpoint]);
+#endif
+
 	rpmsg_destroy_ept(&rpmsg_ept->ep);
 
 	memset(rpmsg_ept, 0, sizeof(struct ipc_rpmsg_ept));
@@ -596,6 +711,18 @@ static int open(const struct device *instance)
 	rpmsg_inst->bound_cb = bound_cb;
 	rpmsg_inst->cb = ept_cb;
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_DEFERRED_RX)
+	for (size_t i = 0; i < NUM_ENDPOINTS; i++) {
+		struct deferred_rx *drx = &data->deferred_rx[i];
+
+		drx->ept = &rpmsg_inst->endpoint[i];
+		drx->enabled = false;
+		k_work_init(&drx->work, deferred_rx_process);
+		k_msgq_init(&drx->msgq, drx->msgq_buf, sizeof(struct deferred_rx_msg),
+			    DEFERRED_RX_QUEUE_SIZE);
+	}
+#endif
+
 	err = ipc_rpmsg_init(rpmsg_inst, data->role, conf->buffer_size,
 			     &data->vr.shm_io, &data->vr.vdev,
 			     (void *)data->vr.shm_addr,
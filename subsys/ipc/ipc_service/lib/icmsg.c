@@ -153,6 +153,8 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 {
 	int ret;
 	uint8_t rx_buffer[CONFIG_PBUF_RX_READ_BUF_SIZE] __aligned(4);
+	const char *rx_data = (const char *)rx_buffer;
+	bool rx_in_place = false;
 	uint32_t len = 0;
 	uint32_t len_available;
 	bool rerun = false;
@@ -259,7 +261,17 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 		len_available = data_available(dev_data);
 
 		if (len_available > 0 && sizeof(rx_buffer) >= len_available) {
-			len = pbuf_read(dev_data->rx_pb, rx_buffer, sizeof(rx_buffer));
+			/* Deliver the message from shared memory if it does not wrap
+			 * around the end of the buffer, copy it otherwise.
+			 */
+			ret = pbuf_read_claim(dev_data->rx_pb, &rx_data);
+			if (ret > 0) {
+				len = ret;
+				rx_in_place = true;
+			} else {
+				rx_data = (const char *)rx_buffer;
+				len = pbuf_read(dev_data->rx_pb, rx_buffer, sizeof(rx_buffer));
+			}
 		}
 
 		if (state == ICMSG_STATE_CONNECTED_SID_ENABLED &&
@@ -292,14 +304,14 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 
 		if (state != ICMSG_STATE_INITIALIZING_SID_DISABLED || !UNBOUND_DISABLED) {
 			if (dev_data->cb->received) {
-				dev_data->cb->received(rx_buffer, len, dev_data->ctx);
+				dev_data->cb->received(rx_data, len, dev_data->ctx);
 			}
 		} else {
 			/* Allow magic number longer than sizeof(magic) for future protocol
 			 * version.
 			 */
 			bool endpoint_invalid = (len < sizeof(magic) ||
-						memcmp(magic, rx_buffer, sizeof(magic)));
+						memcmp(magic, rx_data, sizeof(magic)));
 
 			if (endpoint_invalid) {
 				__ASSERT_NO_MSG(false);
@@ -314,6 +326,13 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 			notify_remote = true;
 		}
 
+		if (rx_in_place) {
+			(void)pbuf_read_finish(dev_data->rx_pb, len);
+		}
+
+		/* The remote may skip notifying messages sent before this one is
+		 * released, check for them after releasing it.
+		 */
 		rerun = (data_available(dev_data) > 0);
 		break;
 
@@ -505,6 +524,8 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	int write_ret;
 	int release_ret;
 	int sent_bytes;
+	uint32_t wr_idx;
+	bool notify = true;
 	uint32_t state = atomic_get(&dev_data->state);
 
 	if (!is_endpoint_ready(state)) {
@@ -524,8 +545,17 @@ int icmsg_send(const struct icmsg_config_t *conf,
 		return -ENOBUFS;
 	}
 
+	wr_idx = dev_data->tx_pb->data.wr_idx;
 	write_ret = pbuf_write(dev_data->tx_pb, msg, len);
 
+	if (IS_ENABLED(CONFIG_IPC_SERVICE_ICMSG_COALESCE_NOTIFY) && write_ret > 0) {
+		/* The remote checks for new messages after releasing each one, so
+		 * it only needs a notification if it already released everything
+		 * written before this message and may have stopped reading.
+		 */
+		notify = (pbuf_rd_idx_read(dev_data->tx_pb) == wr_idx);
+	}
+
 	release_ret = release_tx_buffer(dev_data);
 	__ASSERT_NO_MSG(!release_ret);
 
@@ -536,6 +566,10 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	}
 	sent_bytes = write_ret;
 
+	if (!notify) {
+		return sent_bytes;
+	}
+
 	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
 
 	ret = mbox_send_dt(&conf->mbox_tx, NULL);
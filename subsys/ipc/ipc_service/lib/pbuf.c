@@ -218,6 +218,15 @@ int pbuf_get_initial_buf(struct pbuf *pb, volatile char **buf, uint16_t *len)
 	return 0;
 }
 
+/* Publishes the read index, freeing the space of the packets read before it. */
+static void rd_idx_update(struct pbuf *pb, uint32_t rd_idx)
+{
+	pb->data.rd_idx = rd_idx;
+	*(pb->cfg->rd_idx_loc) = rd_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->rd_idx_loc, sizeof(*(pb->cfg->rd_idx_loc)));
+}
+
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 {
 	if (pb == NULL) {
@@ -286,14 +295,78 @@ int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 	}
 
 	/* Update rd_idx. */
-	rd_idx = idx_wrap(blen, ROUND_UP(rd_idx + len, _PBUF_IDX_SIZE));
+	rd_idx_update(pb, idx_wrap(blen, ROUND_UP(rd_idx + len, _PBUF_IDX_SIZE)));
 
-	pb->data.rd_idx = rd_idx;
-	*(pb->cfg->rd_idx_loc) = rd_idx;
+	return len;
+}
+
+int pbuf_read_claim(struct pbuf *pb, const char **buf)
+{
+	if (pb == NULL || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	sys_cache_data_invd_range((void *)(pb->cfg->wr_idx_loc), sizeof(*(pb->cfg->wr_idx_loc)));
 	__sync_synchronize();
-	sys_cache_data_flush_range((void *)pb->cfg->rd_idx_loc, sizeof(*(pb->cfg->rd_idx_loc)));
 
-	return len;
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = *(pb->cfg->wr_idx_loc);
+	uint32_t rd_idx = pb->data.rd_idx;
+
+	__ASSERT_NO_MSG(IS_PTR_ALIGNED_BYTES(rd_idx, _PBUF_IDX_SIZE));
+	if (!IS_PTR_ALIGNED_BYTES(wr_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	if (rd_idx == wr_idx) {
+		/* Buffer is empty. */
+		return 0;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], PBUF_PACKET_LEN_SZ);
+	uint16_t plen = sys_get_be16(&data_loc[rd_idx]);
+
+	if (idx_occupied(blen, wr_idx, rd_idx) < plen + PBUF_PACKET_LEN_SZ) {
+		/* This should never happen. */
+		return -EAGAIN;
+	}
+
+	rd_idx = idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ);
+
+	if (plen > blen - rd_idx) {
+		/* Wrapped around the end of the buffer, has to be copied. */
+		return -ENOBUFS;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], plen);
+	*buf = (const char *)&data_loc[rd_idx];
+
+	return (int)plen;
+}
+
+int pbuf_read_finish(struct pbuf *pb, uint16_t len)
+{
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	const uint32_t blen = pb->cfg->len;
+	uint32_t rd_idx = idx_wrap(blen, pb->data.rd_idx + PBUF_PACKET_LEN_SZ);
+
+	rd_idx_update(pb, idx_wrap(blen, ROUND_UP(rd_idx + len, _PBUF_IDX_SIZE)));
+
+	return 0;
+}
+
+uint32_t pbuf_rd_idx_read(struct pbuf *pb)
+{
+	sys_cache_data_invd_range((void *)(pb->cfg->rd_idx_loc), sizeof(*(pb->cfg->rd_idx_loc)));
+	__sync_synchronize();
+
+	return *(pb->cfg->rd_idx_loc);
 }
 
 uint32_t pbuf_handshake_read(struct pbuf *pb)
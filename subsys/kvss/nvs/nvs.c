@@ -7,6 +7,7 @@
  */
 
 #include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
 #include <string.h>
 #include <errno.h>
 #include <inttypes.h>
@@ -1214,6 +1215,62 @@ end:
 	return rc;
 }
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+static K_THREAD_STACK_DEFINE(nvs_gc_stack, CONFIG_NVS_GC_BACKGROUND_STACK_SIZE);
+static struct k_work_q nvs_gc_work_q;
+
+static bool nvs_gc_needed(struct nvs_fs *fs)
+{
+	return ((fs->ate_wra - fs->data_wra) <
+		((fs->sector_size / 100U) * CONFIG_NVS_GC_BACKGROUND_THRESHOLD)) &&
+	       ((fs->ate_wra >> ADDR_SECT_SHIFT) != fs->gc_skip_sector);
+}
+
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* A write may have moved to the next sector in the meantime. */
+	if (!fs->ready || !nvs_gc_needed(fs)) {
+		goto end;
+	}
+
+	rc = nvs_sector_close(fs);
+	if (rc == 0) {
+		rc = nvs_gc(fs, NULL);
+	}
+
+	if (rc) {
+		LOG_ERR("Background garbage collection failed (%d)", rc);
+	}
+
+	/* If live data fills most of the new sector, closing it early would
+	 * only garbage collect the same data again.
+	 */
+	if (nvs_gc_needed(fs)) {
+		fs->gc_skip_sector = fs->ate_wra >> ADDR_SECT_SHIFT;
+	}
+
+end:
+	k_mutex_unlock(&fs->nvs_lock);
+}
+
+static int nvs_gc_work_q_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "nvs_gc"};
+
+	k_work_queue_start(&nvs_gc_work_q, nvs_gc_stack, K_THREAD_STACK_SIZEOF(nvs_gc_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(nvs_gc_work_q_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 int nvs_clear(struct nvs_fs *fs)
 {
 	int rc;
@@ -1224,6 +1281,12 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1245,6 +1308,10 @@ int nvs_mount(struct nvs_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->nvs_lock);
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+	fs->gc_skip_sector = UINT16_MAX;
+#endif /* CONFIG_NVS_GC_BACKGROUND */
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1453,6 +1520,12 @@ no_cached_entry:
 		}
 	}
 	rc = len;
+
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	if (nvs_gc_needed(fs)) {
+		(void)k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+	}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -27,9 +27,9 @@ static int zms_get_sector_header(struct zms_fs *fs, uint64_t addr, struct zms_at
 static int zms_ate_valid_different_sector(struct zms_fs *fs, const struct zms_ate *entry,
 					  uint8_t cycle_cnt);
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#ifdef CONFIG_ZMS_LOOKUP
 
-static inline size_t zms_lookup_cache_pos(zms_id_t id)
+static inline uint64_t zms_lookup_hash(zms_id_t id)
 {
 #ifdef CONFIG_ZMS_LOOKUP_CACHE_FOR_SETTINGS
 	/*
@@ -78,20 +78,191 @@ static inline size_t zms_lookup_cache_pos(zms_id_t id)
 	hash ^= hash >> 16;
 #endif /* CONFIG_ZMS_LOOKUP_CACHE_FOR_SETTINGS */
 
-	return hash % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
+	return hash;
+}
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+
+static inline size_t zms_lookup_cache_pos(zms_id_t id)
+{
+	return zms_lookup_hash(id) % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
+}
+
+static inline uint64_t zms_lookup_get(struct zms_fs *fs, zms_id_t id)
+{
+	return fs->lookup_cache[zms_lookup_cache_pos(id)];
+}
+
+static inline void zms_lookup_set(struct zms_fs *fs, zms_id_t id, uint64_t addr)
+{
+	fs->lookup_cache[zms_lookup_cache_pos(id)] = addr;
+}
+
+/* Make every lookup start from @p addr */
+static void zms_lookup_reset(struct zms_fs *fs, uint64_t addr)
+{
+	for (size_t i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_SIZE; i++) {
+		fs->lookup_cache[i] = addr;
+	}
+}
+
+static void zms_lookup_invalidate(struct zms_fs *fs, uint32_t sector)
+{
+	uint64_t *cache_entry = fs->lookup_cache;
+	uint64_t *const cache_end = &fs->lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+
+	for (; cache_entry < cache_end; ++cache_entry) {
+		if (SECTOR_NUM(*cache_entry) == sector) {
+			*cache_entry = ZMS_LOOKUP_CACHE_NO_ADDR;
+		}
+	}
+}
+
+#else /* CONFIG_ZMS_LOOKUP_INDEX */
+
+static K_HEAP_DEFINE(zms_lookup_index_heap, CONFIG_ZMS_LOOKUP_INDEX_HEAP_SIZE);
+
+/* Slot holding @p id, or the free slot where it belongs. Slots are never
+ * freed: IDs whose ATEs were erased keep theirs, set to ZMS_LOOKUP_CACHE_NO_ADDR,
+ * until the index grows.
+ */
+static struct zms_lookup_entry *zms_lookup_index_slot(struct zms_lookup_entry *index,
+						      uint32_t size, zms_id_t id)
+{
+	uint32_t pos = zms_lookup_hash(id) & (size - 1U);
+
+	while ((index[pos].id != id) && (index[pos].id != ZMS_HEAD_ID)) {
+		pos = (pos + 1U) & (size - 1U);
+	}
+
+	return &index[pos];
+}
+
+static int zms_lookup_index_grow(struct zms_fs *fs)
+{
+	uint32_t size = MAX(fs->lookup_index_size * 2U, ZMS_LOOKUP_INDEX_MIN_SIZE);
+	struct zms_lookup_entry *index;
+	struct zms_lookup_entry *entry;
+	uint32_t used = 0U;
+
+	index = k_heap_alloc(&zms_lookup_index_heap, size * sizeof(*index), K_NO_WAIT);
+	if (index == NULL) {
+		return -ENOMEM;
+	}
+
+	for (uint32_t i = 0; i < size; i++) {
+		index[i].id = ZMS_HEAD_ID;
+		index[i].addr = ZMS_LOOKUP_CACHE_NO_ADDR;
+	}
+
+	for (uint32_t i = 0; i < fs->lookup_index_size; i++) {
+		entry = &fs->lookup_index[i];
+		if ((entry->id != ZMS_HEAD_ID) && (entry->addr != ZMS_LOOKUP_CACHE_NO_ADDR)) {
+			*zms_lookup_index_slot(index, size, entry->id) = *entry;
+			used++;
+		}
+	}
+
+	if (fs->lookup_index != NULL) {
+		k_heap_free(&zms_lookup_index_heap, fs->lookup_index);
+	}
+
+	fs->lookup_index = index;
+	fs->lookup_index_size = size;
+	fs->lookup_index_used = used;
+
+	return 0;
+}
+
+static void zms_lookup_index_free(struct zms_fs *fs)
+{
+	if (fs->lookup_index != NULL) {
+		k_heap_free(&zms_lookup_index_heap, fs->lookup_index);
+	}
+
+	fs->lookup_index = NULL;
+	fs->lookup_index_size = 0U;
+	fs->lookup_index_used = 0U;
 }
 
-static int zms_lookup_cache_rebuild(struct zms_fs *fs)
+static uint64_t zms_lookup_get(struct zms_fs *fs, zms_id_t id)
+{
+	struct zms_lookup_entry *entry;
+
+	if (fs->lookup_index_size != 0U) {
+		entry = zms_lookup_index_slot(fs->lookup_index, fs->lookup_index_size, id);
+		if (entry->id == id) {
+			return entry->addr;
+		}
+	}
+
+	/* IDs missing from an incomplete index are searched in the whole storage */
+	return fs->lookup_index_complete ? ZMS_LOOKUP_CACHE_NO_ADDR : fs->ate_wra;
+}
+
+static void zms_lookup_set(struct zms_fs *fs, zms_id_t id, uint64_t addr)
+{
+	struct zms_lookup_entry *entry = NULL;
+
+	if (fs->lookup_index_size != 0U) {
+		entry = zms_lookup_index_slot(fs->lookup_index, fs->lookup_index_size, id);
+	}
+
+	if ((entry == NULL) || (entry->id != id)) {
+		/* Keep the load factor of the index below 3/4 */
+		if ((4U * (fs->lookup_index_used + 1U)) > (3U * fs->lookup_index_size)) {
+			if (zms_lookup_index_grow(fs)) {
+				if (fs->lookup_index_complete) {
+					LOG_WRN("Lookup index heap exhausted");
+				}
+				fs->lookup_index_complete = false;
+				return;
+			}
+		}
+
+		entry = zms_lookup_index_slot(fs->lookup_index, fs->lookup_index_size, id);
+		entry->id = id;
+		fs->lookup_index_used++;
+	}
+
+	entry->addr = addr;
+}
+
+/* Empty the index, @p addr is either ZMS_LOOKUP_CACHE_NO_ADDR for an index
+ * about to be rebuilt or fs->ate_wra to search every ID in the whole storage.
+ */
+static void zms_lookup_reset(struct zms_fs *fs, uint64_t addr)
+{
+	for (uint32_t i = 0; i < fs->lookup_index_size; i++) {
+		fs->lookup_index[i].id = ZMS_HEAD_ID;
+		fs->lookup_index[i].addr = ZMS_LOOKUP_CACHE_NO_ADDR;
+	}
+
+	fs->lookup_index_used = 0U;
+	fs->lookup_index_complete = (addr == ZMS_LOOKUP_CACHE_NO_ADDR);
+}
+
+static void zms_lookup_invalidate(struct zms_fs *fs, uint32_t sector)
+{
+	for (uint32_t i = 0; i < fs->lookup_index_size; i++) {
+		if (SECTOR_NUM(fs->lookup_index[i].addr) == sector) {
+			fs->lookup_index[i].addr = ZMS_LOOKUP_CACHE_NO_ADDR;
+		}
+	}
+}
+
+#endif /* CONFIG_ZMS_LOOKUP_CACHE */
+
+static int zms_lookup_rebuild(struct zms_fs *fs)
 {
 	int rc;
 	int previous_sector_num = ZMS_INVALID_SECTOR_NUM;
 	uint64_t addr;
 	uint64_t ate_addr;
-	uint64_t *cache_entry;
 	uint8_t current_cycle;
 	struct zms_ate ate;
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	zms_lookup_reset(fs, ZMS_LOOKUP_CACHE_NO_ADDR);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -103,9 +274,8 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[zms_lookup_cache_pos(ate.id)];
-
-		if (ate.id != ZMS_HEAD_ID && *cache_entry == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		if (ate.id != ZMS_HEAD_ID &&
+		    zms_lookup_get(fs, ate.id) == ZMS_LOOKUP_CACHE_NO_ADDR) {
 			/* read the ate cycle only when we change the sector
 			 * or if it is the first read
 			 */
@@ -120,7 +290,7 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 				}
 			}
 			if (zms_ate_valid_different_sector(fs, &ate, current_cycle)) {
-				*cache_entry = ate_addr;
+				zms_lookup_set(fs, ate.id, ate_addr);
 			}
 			previous_sector_num = SECTOR_NUM(ate_addr);
 		}
@@ -133,19 +303,7 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 	return 0;
 }
 
-static void zms_lookup_cache_invalidate(struct zms_fs *fs, uint32_t sector)
-{
-	uint64_t *cache_entry = fs->lookup_cache;
-	uint64_t *const cache_end = &fs->lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
-
-	for (; cache_entry < cache_end; ++cache_entry) {
-		if (SECTOR_NUM(*cache_entry) == sector) {
-			*cache_entry = ZMS_LOOKUP_CACHE_NO_ADDR;
-		}
-	}
-}
-
-#endif /* CONFIG_ZMS_LOOKUP_CACHE */
+#endif /* CONFIG_ZMS_LOOKUP */
 
 /* Helper to compute offset given the address */
 static inline off_t zms_addr_to_offset(struct zms_fs *fs, uint64_t addr)
@@ -249,10 +407,10 @@ static int zms_flash_ate_wrt(struct zms_fs *fs, const struct zms_ate *entry)
 	if (rc) {
 		goto end;
 	}
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#ifdef CONFIG_ZMS_LOOKUP
 	/* ZMS_HEAD_ID is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != ZMS_HEAD_ID) {
-		fs->lookup_cache[zms_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		zms_lookup_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= zms_al_size(fs, sizeof(struct zms_ate));
@@ -386,8 +544,8 @@ static int zms_flash_erase_sector(struct zms_fs *fs, uint64_t addr)
 	LOG_DBG("Erasing flash at offset 0x%lx ( 0x%llx ), len %u", (long)offset, addr,
 		fs->sector_size);
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-	zms_lookup_cache_invalidate(fs, SECTOR_NUM(addr));
+#ifdef CONFIG_ZMS_LOOKUP
+	zms_lookup_invalidate(fs, SECTOR_NUM(addr));
 #endif
 	rc = flash_erase(fs->flash_device, offset, fs->sector_size);
 
@@ -1047,8 +1205,8 @@ static int zms_gc(struct zms_fs *fs)
 			continue;
 		}
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(gc_ate.id)];
+#ifdef CONFIG_ZMS_LOOKUP
+		wlk_addr = zms_lookup_get(fs, gc_ate.id);
 
 		if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -1117,8 +1275,8 @@ gc_done:
 		return rc;
 	}
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-	zms_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#ifdef CONFIG_ZMS_LOOKUP
+	zms_lookup_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
 #endif
 	rc = zms_add_empty_ate(fs, sec_addr);
 
@@ -1155,6 +1313,9 @@ int zms_clear(struct zms_fs *fs)
 
 	/* zms needs to be reinitialized after clearing */
 	fs->ready = false;
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	zms_lookup_index_free(fs);
+#endif
 
 end:
 	k_mutex_unlock(&fs->zms_lock);
@@ -1428,24 +1589,22 @@ static int zms_init(struct zms_fs *fs)
 		fs->ate_wra &= ADDR_SECT_MASK;
 		fs->ate_wra += (fs->sector_size - 3 * fs->ate_size);
 		fs->data_wra = (fs->ate_wra & ADDR_SECT_MASK);
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#ifdef CONFIG_ZMS_LOOKUP
 		/**
 		 * At this point, the lookup cache wasn't built but the gc function need to use it.
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
-		for (i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_SIZE; i++) {
-			fs->lookup_cache[i] = fs->ate_wra;
-		}
+		zms_lookup_reset(fs, fs->ate_wra);
 #endif
 		rc = zms_gc(fs);
 		goto end;
 	}
 
 end:
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#ifdef CONFIG_ZMS_LOOKUP
 	if (!rc) {
-		rc = zms_lookup_cache_rebuild(fs);
+		rc = zms_lookup_rebuild(fs);
 	}
 #endif
 	/* If the sector is empty add a gc done ate to avoid having insufficient
@@ -1566,8 +1725,8 @@ ssize_t zms_write(struct zms_fs *fs, zms_id_t id, const void *data, size_t len)
 	uint64_t wlk_addr;
 
 	/* find latest entry with same id */
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+#ifdef CONFIG_ZMS_LOOKUP
+	wlk_addr = zms_lookup_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		if (len > 0) {
@@ -1579,7 +1738,7 @@ ssize_t zms_write(struct zms_fs *fs, zms_id_t id, const void *data, size_t len)
 	}
 #else
 	wlk_addr = fs->ate_wra;
-#endif /* CONFIG_ZMS_LOOKUP_CACHE */
+#endif /* CONFIG_ZMS_LOOKUP */
 	uint64_t rd_addr = wlk_addr;
 
 	/* Search for a previous valid ATE with the same ID */
@@ -1625,9 +1784,9 @@ ssize_t zms_write(struct zms_fs *fs, zms_id_t id, const void *data, size_t len)
 			return 0;
 		}
 	}
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#ifdef CONFIG_ZMS_LOOKUP
 no_cached_entry:
-#endif /* CONFIG_ZMS_LOOKUP_CACHE */
+#endif /* CONFIG_ZMS_LOOKUP */
 #endif /* CONFIG_ZMS_NO_DOUBLE_WRITE */
 
 	/* calculate required space if the entry contains data */
@@ -1714,8 +1873,8 @@ ssize_t zms_read_hist(struct zms_fs *fs, zms_id_t id, void *data, size_t len, ui
 
 	cnt_his = 0U;
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+#ifdef CONFIG_ZMS_LOOKUP
+	wlk_addr = zms_lookup_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -28,6 +28,7 @@
 #endif
 
 #define ZMS_LOOKUP_CACHE_NO_ADDR GENMASK64(63, 0)
+#define ZMS_LOOKUP_INDEX_MIN_SIZE 64U
 
 #define ZMS_VERSION_MASK        GENMASK(7, 0)
 #define ZMS_GET_VERSION(x)      FIELD_GET(ZMS_VERSION_MASK, x)
@@ -108,4 +109,12 @@ struct zms_ate {
 
 #define ZMS_DATA_IN_ATE_SIZE SIZEOF_FIELD(struct zms_ate, data)
 
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+/* Lookup index entry, free when id is ZMS_HEAD_ID */
+struct zms_lookup_entry {
+	zms_id_t id;
+	uint64_t addr;
+};
+#endif
+
 #endif /* __ZMS_PRIV_H_ */
@@ -11,6 +11,7 @@
 #include <zephyr/llext/llext.h>
 #include <zephyr/kernel.h>
 #include <zephyr/cache.h>
+#include <zephyr/init.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(llext, CONFIG_LLEXT_LOG_LEVEL);
@@ -127,25 +128,110 @@ int llext_iterate(int (*fn)(struct llext *ext, void *arg), void *arg)
 	return ret;
 }
 
+#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+/* The llext_const_symbol_area section is sorted in ascending SLID order
+ * (see scripts/build/llext_prepare_exptab.py).
+ */
+static const void *llext_find_builtin_slid(uintptr_t slid)
+{
+	const struct llext_const_symbol *syms;
+	size_t lo = 0, hi;
+
+	STRUCT_SECTION_GET(llext_const_symbol, 0, &syms);
+	STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (syms[mid].slid == slid) {
+			return syms[mid].addr;
+		}
+
+		if (syms[mid].slid < slid) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID */
+
+#ifdef CONFIG_LLEXT_EXPORT_HASH
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_LLEXT_EXPORT_HASH_SIZE),
+	     "LLEXT export hash table size must be a power of two");
+
+#define EXPORT_HASH_MASK (CONFIG_LLEXT_EXPORT_HASH_SIZE - 1U)
+
+/* Built-in exported symbols by FNV-1a hash of their name, with linear
+ * probing. Built once at boot, as the exported symbols are constant.
+ */
+static const struct llext_const_symbol *export_hash[CONFIG_LLEXT_EXPORT_HASH_SIZE];
+static bool export_hash_ready;
+
+static uint32_t export_name_hash(const char *name)
+{
+	uint32_t hash = 2166136261U;
+
+	for (const char *c = name; *c != '\0'; c++) {
+		hash = (hash ^ (uint8_t)*c) * 16777619U;
+	}
+
+	return hash;
+}
+
+static int llext_export_hash_init(void)
+{
+	size_t used = 0;
+
+	STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+		uint32_t pos;
+
+		/* Keep a free slot to end the probes */
+		if (used == EXPORT_HASH_MASK) {
+			LOG_WRN("Export hash table too small, using linear lookup");
+			return 0;
+		}
+
+		pos = export_name_hash(sym->name) & EXPORT_HASH_MASK;
+		while (export_hash[pos] != NULL) {
+			pos = (pos + 1U) & EXPORT_HASH_MASK;
+		}
+
+		export_hash[pos] = sym;
+		used++;
+	}
+
+	export_hash_ready = true;
+
+	return 0;
+}
+
+SYS_INIT(llext_export_hash_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_LLEXT_EXPORT_HASH */
+
 const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
 {
 	if (sym_table == NULL) {
 		/* Built-in symbol table */
 #ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
 		/* 'sym_name' is actually a SLID to search for */
-		uintptr_t slid = (uintptr_t)sym_name;
-
-		/* TODO: perform a binary search instead of linear.
-		 * Note that - as of writing - the llext_const_symbol_area
-		 * section is sorted in ascending SLID order.
-		 * (see scripts/build/llext_prepare_exptab.py)
-		 */
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (slid == sym->slid) {
-				return sym->addr;
+		return llext_find_builtin_slid((uintptr_t)sym_name);
+#else
+#ifdef CONFIG_LLEXT_EXPORT_HASH
+		if (export_hash_ready) {
+			for (uint32_t pos = export_name_hash(sym_name) & EXPORT_HASH_MASK;
+			     export_hash[pos] != NULL; pos = (pos + 1U) & EXPORT_HASH_MASK) {
+				if (strcmp(export_hash[pos]->name, sym_name) == 0) {
+					return export_hash[pos]->addr;
+				}
 			}
+
+			return NULL;
 		}
-#else
+#endif /* CONFIG_LLEXT_EXPORT_HASH */
+
 		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
 			if (strcmp(sym->name, sym_name) == 0) {
 				return sym->addr;
@@ -54,6 +54,44 @@ static void llext_init_mem_part(struct llext *ext, enum llext_mem mem_idx,
 	LOG_DBG("region %d: start %#zx, size %zd", mem_idx, (size_t)start, len);
 }
 
+/*
+ * Initialize a writable region of an extension executing in place at the
+ * address it was linked for.
+ */
+static int llext_init_xip_region(struct llext_loader *ldr, struct llext *ext,
+				 enum llext_mem mem_idx)
+{
+	elf_shdr_t *region = ldr->sects + mem_idx;
+	size_t prepad = region->sh_info;
+	uint8_t *base = (uint8_t *)region->sh_addr;
+	int ret;
+
+	if (base == NULL) {
+		LOG_ERR("Region %d has no pre-defined address", mem_idx);
+		return -ENOEXEC;
+	}
+
+	if (region->sh_type == SHT_NOBITS) {
+		memset(base + prepad, 0, region->sh_size - prepad);
+	} else {
+		ret = llext_seek(ldr, region->sh_offset + prepad);
+		if (ret != 0) {
+			return ret;
+		}
+
+		ret = llext_read(ldr, base + prepad, region->sh_size - prepad);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	ext->mem[mem_idx] = base;
+	ext->mem_on_heap[mem_idx] = false;
+	llext_init_mem_part(ext, mem_idx, (uintptr_t)base, region->sh_size);
+
+	return 0;
+}
+
 static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 			      enum llext_mem mem_idx, const struct llext_load_param *ldr_parm)
 {
@@ -67,6 +105,11 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 	}
 	ext->mem_size[mem_idx] = region_alloc;
 
+	if (ldr_parm->pre_located && ldr_parm->xip &&
+	    (region->sh_flags & SHF_ALLOC) && (region->sh_flags & SHF_WRITE)) {
+		return llext_init_xip_region(ldr, ext, mem_idx);
+	}
+
 	/*
 	 * Calculate the minimum region size and alignment that can satisfy
 	 * MMU/MPU requirements. This only applies to regions that contain
@@ -66,4 +66,15 @@ config LOG_BACKEND_FS_FILES_LIMIT
 	  Limit of number of files with logs. It is also limited by
 	  size of file system partition.
 
+config LOG_BACKEND_FS_DICT_BLOCK_SIZE
+	int "Dictionary block size"
+	depends on LOG_BACKEND_FS_OUTPUT_DICTIONARY
+	default 1024
+	range 64 65536
+	help
+	  In dictionary mode, records are collected in a RAM block of this size
+	  and written to the file at once, when the block is full or when the
+	  log thread has processed all pending messages. Each block starts with
+	  a sync record, from which the decoder can resume after damaged data.
+
 endif # LOG_BACKEND_FS
@@ -0,0 +1,221 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+
+/* Dictionary records are stored in a ring of sectors in the log_partition.
+ * Each sector starts with a sync record carrying an increasing sequence
+ * number and records never span two sectors, so the decoder can put the
+ * sectors in order and skip the erased tail of each one.
+ */
+#define SECTOR_SIZE CONFIG_LOG_BACKEND_FLASH_SECTOR_SIZE
+#define PAD_VAL 0xff
+
+BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
+	     "Immediate logging is not supported by LOG flash backend.");
+BUILD_ASSERT(FIXED_PARTITION_SIZE(log_partition) >= (2 * SECTOR_SIZE),
+	     "Log partition must hold at least two sectors.");
+
+static const struct flash_area *fa;
+static bool ready;
+static uint32_t seq;
+static size_t align;
+static off_t sector_off;
+
+/* Records are staged in RAM and programmed in multiples of the write block. */
+static uint8_t __aligned(4) wbuf[CONFIG_LOG_BACKEND_FLASH_WRITE_BUF_SIZE];
+static size_t wbuf_len;
+static off_t wbuf_off;
+
+static void wbuf_flush(bool pad)
+{
+	size_t len = pad ? ROUND_UP(wbuf_len, align) : wbuf_len;
+
+	if (len == 0) {
+		return;
+	}
+
+	memset(&wbuf[wbuf_len], PAD_VAL, len - wbuf_len);
+
+	if (flash_area_write(fa, wbuf_off, wbuf, len) < 0) {
+		ready = false;
+	}
+
+	wbuf_off += len;
+	wbuf_len = 0;
+}
+
+static int out_write(uint8_t *data, size_t length, void *ctx)
+{
+	size_t left = length;
+
+	ARG_UNUSED(ctx);
+
+	while (left > 0) {
+		size_t chunk = MIN(left, sizeof(wbuf) - wbuf_len);
+
+		memcpy(&wbuf[wbuf_len], data, chunk);
+		wbuf_len += chunk;
+		data += chunk;
+		left -= chunk;
+
+		if (wbuf_len == sizeof(wbuf)) {
+			wbuf_flush(false);
+		}
+	}
+
+	return length;
+}
+
+static uint8_t out_buf[sizeof(struct log_dict_output_sync_msg_t)];
+LOG_OUTPUT_DEFINE(log_output_flash, out_write, out_buf, sizeof(out_buf));
+
+static void sector_start(off_t off)
+{
+	if (flash_area_erase(fa, off, SECTOR_SIZE) < 0) {
+		ready = false;
+		return;
+	}
+
+	sector_off = off;
+	wbuf_off = off;
+	wbuf_len = 0;
+
+	log_dict_output_sync_process(&log_output_flash, seq++);
+}
+
+static bool reserve(size_t len)
+{
+	size_t used = (wbuf_off - sector_off) + wbuf_len;
+
+	if ((used + len) <= SECTOR_SIZE) {
+		return true;
+	}
+
+	if ((sizeof(struct log_dict_output_sync_msg_t) + len) > SECTOR_SIZE) {
+		/* Record can never fit in a sector. */
+		return false;
+	}
+
+	wbuf_flush(true);
+
+	off_t next = sector_off + SECTOR_SIZE;
+
+	if ((next + SECTOR_SIZE) > fa->fa_size) {
+		next = 0;
+	}
+
+	sector_start(next);
+
+	return ready;
+}
+
+/* Continue after the sector with the highest sequence number. */
+static off_t ring_recover(void)
+{
+	struct log_dict_output_sync_msg_t sync;
+	off_t last = -SECTOR_SIZE;
+
+	for (off_t off = 0; (off + SECTOR_SIZE) <= fa->fa_size; off += SECTOR_SIZE) {
+		if (flash_area_read(fa, off, &sync, sizeof(sync)) < 0) {
+			continue;
+		}
+
+		if ((sync.type != MSG_SYNC) ||
+		    (memcmp(sync.magic, LOG_DICT_OUTPUT_SYNC_MAGIC, sizeof(sync.magic)) != 0)) {
+			continue;
+		}
+
+		if ((last < 0) || ((int32_t)(sync.seq - seq) >= 0)) {
+			seq = sync.seq + 1;
+			last = off;
+		}
+	}
+
+	last += SECTOR_SIZE;
+
+	return ((last + SECTOR_SIZE) > fa->fa_size) ? 0 : last;
+}
+
+static void log_backend_flash_init(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+
+	if (flash_area_open(FIXED_PARTITION_ID(log_partition), &fa) < 0) {
+		return;
+	}
+
+	align = flash_area_align(fa);
+
+	/* Padding and the erased tail of a sector must read as PAD_VAL. */
+	if ((flash_area_erased_val(fa) != PAD_VAL) || (sizeof(wbuf) % align) ||
+	    (SECTOR_SIZE % align)) {
+		return;
+	}
+
+	ready = true;
+	sector_start(ring_recover());
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	ARG_UNUSED(backend);
+
+	if (ready) {
+		wbuf_flush(true);
+	}
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (ready && reserve(sizeof(struct log_dict_output_dropped_msg_t))) {
+		log_dict_output_dropped_process(&log_output_flash, cnt);
+	}
+}
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	size_t len = sizeof(struct log_dict_output_normal_msg_hdr_t) +
+		     msg->log.hdr.desc.package_len + msg->log.hdr.desc.data_len;
+
+	ARG_UNUSED(backend);
+
+	if (ready && reserve(len)) {
+		log_dict_output_msg_process(&log_output_flash, &msg->log,
+					    log_backend_std_get_flags());
+	}
+}
+
+static void notify(const struct log_backend *const backend, enum log_backend_evt event,
+		   union log_backend_evt_arg *arg)
+{
+	ARG_UNUSED(backend);
+	ARG_UNUSED(arg);
+
+	if ((event == LOG_BACKEND_EVT_PROCESS_THREAD_DONE) && ready) {
+		wbuf_flush(true);
+	}
+}
+
+static const struct log_backend_api log_backend_flash_api = {
+	.process = process,
+	.panic = panic,
+	.init = log_backend_flash_init,
+	.dropped = dropped,
+	.notify = notify,
+};
+
+LOG_BACKEND_DEFINE(log_backend_flash, log_backend_flash_api,
+		   IS_ENABLED(CONFIG_LOG_BACKEND_FLASH_AUTOSTART));
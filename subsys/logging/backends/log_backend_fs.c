@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
@@ -432,6 +433,54 @@ BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
 static uint8_t __aligned(4) buf[MAX_FLASH_WRITE_SIZE];
 LOG_OUTPUT_DEFINE(log_output, write_log_to_file, buf, MAX_FLASH_WRITE_SIZE);
 
+#ifdef CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY
+BUILD_ASSERT(CONFIG_LOG_BACKEND_FS_DICT_BLOCK_SIZE <= CONFIG_LOG_BACKEND_FS_FILE_SIZE,
+	     "Dictionary block does not fit in a log file.");
+
+/* Dictionary records are collected in a block which is written to the file
+ * at once. Each block starts with a sync record and never spans two files.
+ */
+static uint8_t dict_block[CONFIG_LOG_BACKEND_FS_DICT_BLOCK_SIZE];
+static size_t dict_block_len;
+static uint32_t dict_seq;
+
+static int dict_block_write(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	/* Space is reserved by dict_block_reserve() before each record. */
+	memcpy(&dict_block[dict_block_len], data, length);
+	dict_block_len += length;
+
+	return length;
+}
+
+static uint8_t dict_output_buf[sizeof(struct log_dict_output_sync_msg_t)];
+LOG_OUTPUT_DEFINE(dict_output, dict_block_write, dict_output_buf, sizeof(dict_output_buf));
+
+static void dict_block_flush(void)
+{
+	if (dict_block_len > sizeof(struct log_dict_output_sync_msg_t)) {
+		(void)write_log_to_file(dict_block, dict_block_len, NULL);
+	}
+
+	dict_block_len = 0;
+}
+
+static bool dict_block_reserve(size_t len)
+{
+	if ((dict_block_len + len) > sizeof(dict_block)) {
+		dict_block_flush();
+	}
+
+	if (dict_block_len == 0) {
+		log_dict_output_sync_process(&dict_output, dict_seq++);
+	}
+
+	return (dict_block_len + len) <= sizeof(dict_block);
+}
+#endif /* CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY */
+
 static void log_backend_fs_init(const struct log_backend *const backend)
 {
 }
@@ -449,6 +498,12 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 	ARG_UNUSED(backend);
 
 	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY)) {
+#ifdef CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY
+		if (dict_block_reserve(sizeof(struct log_dict_output_dropped_msg_t))) {
+			log_dict_output_dropped_process(&dict_output, cnt);
+			return;
+		}
+#endif
 		log_dict_output_dropped_process(&log_output, cnt);
 	} else {
 		log_backend_std_dropped(&log_output, cnt);
@@ -460,6 +515,21 @@ static void process(const struct log_backend *const backend,
 {
 	uint32_t flags = log_backend_std_get_flags() & ~LOG_OUTPUT_FLAG_COLORS;
 
+#ifdef CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY
+	if (log_format_current == LOG_OUTPUT_DICT) {
+		size_t len = sizeof(struct log_dict_output_normal_msg_hdr_t) +
+			     msg->log.hdr.desc.package_len + msg->log.hdr.desc.data_len;
+
+		if (dict_block_reserve(len)) {
+			log_dict_output_msg_process(&dict_output, &msg->log, flags);
+			return;
+		}
+
+		/* Record larger than a block is written on its own. */
+		dict_block_flush();
+	}
+#endif
+
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output, &msg->log, flags);
@@ -467,6 +537,9 @@ static void process(const struct log_backend *const backend,
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
+#ifdef CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY
+	dict_block_flush();
+#endif
 	log_format_current = log_type;
 	return 0;
 }
@@ -475,6 +548,9 @@ static void notify(const struct log_backend *const backend, enum log_backend_evt
 		   union log_backend_evt_arg *arg)
 {
 	if (event == LOG_BACKEND_EVT_PROCESS_THREAD_DONE) {
+#ifdef CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY
+		dict_block_flush();
+#endif
 		if (backend_state == BACKEND_FS_OK) {
 			int rc = fs_sync(&fs_file);
 
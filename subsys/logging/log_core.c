@@ -119,20 +119,28 @@ static atomic_t unordered_cnt;
 static uint64_t last_failure_report;
 static struct k_spinlock process_lock;
 
-static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_msg_ptr);
-static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer, log_buffer);
+/* With CONFIG_LOG_BUFFER_PER_CPU each CPU allocates messages from its own
+ * buffer and the processing merges them by timestamp, the same way as
+ * buffers of remote domains.
+ */
+#define LOG_BUFFER_CNT COND_CODE_1(CONFIG_LOG_BUFFER_PER_CPU, \
+				   (CONFIG_MP_MAX_NUM_CPUS), (1))
+
+static STRUCT_SECTION_ITERABLE_ARRAY(log_msg_ptr, log_msg_ptr, LOG_BUFFER_CNT);
+static STRUCT_SECTION_ITERABLE_ARRAY_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer, log_buffer,
+					       LOG_BUFFER_CNT);
 static struct mpsc_pbuf_buffer *curr_log_buffer;
 
 #ifdef CONFIG_MPSC_PBUF
 static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
-	buf32[CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+	buf32[LOG_BUFFER_CNT][CONFIG_LOG_BUFFER_SIZE / LOG_BUFFER_CNT / sizeof(int)];
 
 static void z_log_notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			      const union mpsc_pbuf_generic *item);
 
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
-	.buf = (uint32_t *)buf32,
-	.size = ARRAY_SIZE(buf32),
+	.buf = (uint32_t *)buf32[0],
+	.size = ARRAY_SIZE(buf32[0]),
 	.notify_drop = z_log_notify_drop,
 	.get_wlen = log_msg_generic_get_wlen,
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
@@ -655,11 +663,44 @@ bool z_log_dropped_pending(void)
 void z_log_msg_init(void)
 {
 #ifdef CONFIG_MPSC_PBUF
-	mpsc_pbuf_init(&log_buffer, &mpsc_config);
-	curr_log_buffer = &log_buffer;
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = (uint32_t *)buf32[i];
+		mpsc_pbuf_init(&log_buffer[i], &config);
+	}
+	curr_log_buffer = &log_buffer[0];
 #endif
 }
 
+/* Buffer to which messages created on the current CPU are written. A thread
+ * migrating to another CPU in between is harmless, buffers are multi-producer.
+ */
+static struct mpsc_pbuf_buffer *local_log_buffer(void)
+{
+	if (LOG_BUFFER_CNT == 1) {
+		return &log_buffer[0];
+	}
+
+	return &log_buffer[arch_curr_cpu()->id];
+}
+
+/* Buffer from which the message was allocated. */
+static struct mpsc_pbuf_buffer *msg_log_buffer(const struct log_msg *msg)
+{
+#ifdef CONFIG_MPSC_PBUF
+	for (int i = 1; i < LOG_BUFFER_CNT; i++) {
+		const uint32_t *ptr = (const uint32_t *)msg;
+
+		if ((ptr >= buf32[i]) && (ptr < &buf32[i][ARRAY_SIZE(buf32[i])])) {
+			return &log_buffer[i];
+		}
+	}
+#endif
+
+	return &log_buffer[0];
+}
+
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 {
 	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -675,7 +716,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(local_log_buffer(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -707,13 +748,13 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_log_buffer(msg), msg);
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
 {
 #ifdef CONFIG_MPSC_PBUF
-	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer);
+	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer[0]);
 #else
 	return NULL;
 #endif
@@ -794,7 +835,7 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (LOG_BUFFER_CNT > 1)) && len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -829,8 +870,8 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
-		return msg_pending(&log_buffer);
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && (LOG_BUFFER_CNT == 1)) || (len == 1)) {
+		return msg_pending(&log_buffer[0]);
 	}
 
 	STRUCT_SECTION_FOREACH(log_msg_ptr, msg_ptr) {
@@ -856,7 +897,7 @@ void z_log_msg_enqueue(const struct log_link *link, const void *data, size_t len
 {
 	struct log_msg *log_msg = (struct log_msg *)data;
 	size_t wlen = DIV_ROUND_UP(ROUND_UP(len, Z_LOG_MSG_ALIGNMENT), sizeof(int));
-	struct mpsc_pbuf_buffer *mpsc_pbuffer = link->mpsc_pbuf ? link->mpsc_pbuf : &log_buffer;
+	struct mpsc_pbuf_buffer *mpsc_pbuffer = link->mpsc_pbuf ? link->mpsc_pbuf : local_log_buffer();
 	struct log_msg *local_msg = msg_alloc(mpsc_pbuffer, wlen);
 
 	if (!local_msg) {
@@ -909,7 +950,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 		return -EINVAL;
 	}
 
-	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
+	*buf_size = 0;
+	*usage = 0;
+
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		uint32_t size;
+		uint32_t now;
+
+		mpsc_pbuf_get_utilization(&log_buffer[i], &size, &now);
+		*buf_size += size;
+		*usage += now;
+	}
 
 	return 0;
 }
@@ -922,7 +973,21 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
-	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+	*max = 0;
+
+	/* Sum of per buffer peaks, an upper bound when buffers are per CPU. */
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		uint32_t buf_max;
+		int err = mpsc_pbuf_get_max_utilization(&log_buffer[i], &buf_max);
+
+		if (err < 0) {
+			return err;
+		}
+
+		*max += buf_max;
+	}
+
+	return 0;
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
@@ -0,0 +1,86 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_msg.h>
+#include <zephyr/sys/util.h>
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_LOG_DEDUP_SLOTS),
+	     "Number of slots must be a power of two");
+
+/* Messages are tracked in a direct mapped table keyed by source and format
+ * string pointer. A colliding message takes the slot over, reporting what
+ * was suppressed for the previous owner.
+ */
+struct log_dedup_slot {
+	const void *source;
+	const char *fmt;
+	uint32_t window_start;
+	uint32_t suppressed;
+	uint16_t count;
+	uint8_t level;
+};
+
+static struct log_dedup_slot slots[CONFIG_LOG_DEDUP_SLOTS];
+static struct k_spinlock lock;
+
+/* Format strings are not present in the image when they are stripped. */
+static const char repeated_fmt[] =
+	COND_CODE_1(CONFIG_LOG_FMT_SECTION_STRIP, ("Message repeated %u times"),
+		    ("Message repeated %u times: \"%s\""));
+
+static uint32_t slot_idx(const void *source, const char *fmt)
+{
+	uint32_t key = (uint32_t)(uintptr_t)source ^ ((uint32_t)(uintptr_t)fmt >> 2);
+
+	/* Fibonacci hashing, top bits of the product select the slot. */
+	return (key * 0x9E3779B1U) >> (32 - LOG2(CONFIG_LOG_DEDUP_SLOTS));
+}
+
+static void repeated_report(const void *source, uint8_t level, const char *fmt,
+			    uint32_t cnt)
+{
+	z_log_msg_runtime_create(Z_LOG_LOCAL_DOMAIN_ID, source, level, NULL, 0, 0,
+				 repeated_fmt, cnt, fmt);
+}
+
+bool z_log_dedup_check(const void *source, uint8_t level, const char *fmt)
+{
+	struct log_dedup_slot *slot;
+	struct log_dedup_slot report = { 0 };
+	uint32_t now = k_uptime_get_32();
+	bool pass = true;
+
+	if ((fmt == NULL) || (fmt == repeated_fmt) || (level == LOG_LEVEL_NONE)) {
+		return true;
+	}
+
+	slot = &slots[slot_idx(source, fmt)];
+
+	K_SPINLOCK(&lock) {
+		if ((slot->fmt != fmt) || (slot->source != source) ||
+		    ((now - slot->window_start) >= CONFIG_LOG_DEDUP_INTERVAL_MS)) {
+			report = *slot;
+			slot->source = source;
+			slot->fmt = fmt;
+			slot->level = level;
+			slot->window_start = now;
+			slot->suppressed = 0;
+			slot->count = 1;
+		} else if (slot->count < CONFIG_LOG_DEDUP_BURST) {
+			slot->count++;
+		} else {
+			slot->suppressed++;
+			pass = false;
+		}
+	}
+
+	if (report.suppressed > 0) {
+		repeated_report(report.source, report.level, report.fmt, report.suppressed);
+	}
+
+	return pass;
+}
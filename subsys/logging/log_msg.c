@@ -51,6 +51,12 @@ void z_log_msg_finalize(struct log_msg *msg, const void *source,
 	z_log_msg_commit(msg);
 }
 
+/* Returns true if message passes the repeated messages filter. */
+static inline bool dedup_check(const void *source, uint32_t level, const char *fmt)
+{
+	return !IS_ENABLED(CONFIG_LOG_DEDUP) || z_log_dedup_check(source, level, fmt);
+}
+
 static bool frontend_runtime_filtering(const void *source, uint32_t level)
 {
 	if (!IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING)) {
@@ -129,6 +135,9 @@ static void z_log_msg_simple_create(const void *source, uint32_t level, uint32_t
 
 void z_impl_z_log_msg_simple_create_0(const void *source, uint32_t level, const char *fmt)
 {
+	if (!dedup_check(source, level, fmt)) {
+		return;
+	}
 
 	if (IS_ENABLED(CONFIG_LOG_FRONTEND) && frontend_runtime_filtering(source, level)) {
 		if (IS_ENABLED(CONFIG_LOG_FRONTEND_OPT_API)) {
@@ -179,6 +188,10 @@ void z_impl_z_log_msg_simple_create_0(const void *source, uint32_t level, const
 void z_impl_z_log_msg_simple_create_1(const void *source, uint32_t level,
 				      const char *fmt, uint32_t arg)
 {
+	if (!dedup_check(source, level, fmt)) {
+		return;
+	}
+
 	if (IS_ENABLED(CONFIG_LOG_FRONTEND) && frontend_runtime_filtering(source, level)) {
 		if (IS_ENABLED(CONFIG_LOG_FRONTEND_OPT_API)) {
 			log_frontend_simple_1(source, level, fmt, arg);
@@ -229,6 +242,10 @@ void z_impl_z_log_msg_simple_create_1(const void *source, uint32_t level,
 void z_impl_z_log_msg_simple_create_2(const void *source, uint32_t level,
 				      const char *fmt, uint32_t arg0, uint32_t arg1)
 {
+	if (!dedup_check(source, level, fmt)) {
+		return;
+	}
+
 	if (IS_ENABLED(CONFIG_LOG_FRONTEND) && frontend_runtime_filtering(source, level)) {
 		if (IS_ENABLED(CONFIG_LOG_FRONTEND_OPT_API)) {
 			log_frontend_simple_2(source, level, fmt, arg0, arg1);
@@ -277,10 +294,66 @@ void z_impl_z_log_msg_simple_create_2(const void *source, uint32_t level,
 	z_log_msg_simple_create(source, level, data, ARRAY_SIZE(data));
 }
 
+void z_impl_z_log_msg_simple_create_3(const void *source, uint32_t level,
+				      const char *fmt, uint32_t arg0, uint32_t arg1,
+				      uint32_t arg2)
+{
+	if (!dedup_check(source, level, fmt)) {
+		return;
+	}
+
+	/* Frontend optimized API stops at two arguments, use the generic call. */
+	if (IS_ENABLED(CONFIG_LOG_FRONTEND) && frontend_runtime_filtering(source, level)) {
+		uint32_t plen32 = CBPRINTF_DESC_SIZE32 + 4;
+		union cbprintf_package_hdr hdr = {
+			.desc = {
+				.len = plen32,
+				.ro_str_cnt = IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC) ? 1 : 0
+			}
+		};
+		uint8_t package[sizeof(uint32_t) * (CBPRINTF_DESC_SIZE32 + 4) +
+			(IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC) ? 1 : 0)]
+			__aligned(sizeof(uint32_t));
+		uint32_t *p32 = (uint32_t *)package;
+
+		*p32++ = (uint32_t)(uintptr_t)hdr.raw;
+		*p32++ = (uint32_t)(uintptr_t)fmt;
+		*p32++ = arg0;
+		*p32++ = arg1;
+		*p32++ = arg2;
+		if (IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC)) {
+			/* fmt string located at index 1 */
+			*(uint8_t *)p32 = 1;
+		}
+
+		struct log_msg_desc desc = {
+			.level = level,
+			.package_len = sizeof(package),
+			.data_len = 0,
+		};
+
+		log_frontend_msg(source, desc, package, NULL);
+	}
+
+	if (!BACKENDS_IN_USE()) {
+		return;
+	}
+
+	uint32_t data[] = {(uint32_t)(uintptr_t)fmt, arg0, arg1, arg2};
+
+	z_log_msg_simple_create(source, level, data, ARRAY_SIZE(data));
+}
+
 void z_impl_z_log_msg_static_create(const void *source,
 			      const struct log_msg_desc desc,
 			      uint8_t *package, const void *data)
 {
+	if ((desc.package_len > 0) &&
+	    !dedup_check(source, desc.level,
+			 ((struct cbprintf_package_hdr_ext *)package)->fmt)) {
+		return;
+	}
+
 	if (IS_ENABLED(CONFIG_LOG_FRONTEND) && frontend_runtime_filtering(source, desc.level)) {
 		log_frontend_msg(source, desc, package, data);
 	}
@@ -348,6 +421,12 @@ void z_log_msg_runtime_vcreate(uint8_t domain_id, const void *source,
 {
 	int plen;
 
+	/* In user context message is filtered by z_log_msg_static_create(). */
+	if (!(IS_ENABLED(CONFIG_USERSPACE) && k_is_user_context()) &&
+	    !dedup_check(source, level, fmt)) {
+		return;
+	}
+
 	if (fmt) {
 		va_list ap2;
 
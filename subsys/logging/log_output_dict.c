@@ -11,6 +11,7 @@
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
@@ -56,3 +57,15 @@ void log_dict_output_dropped_process(const struct log_output *output, uint32_t c
 	log_output_write(output->func, (uint8_t *)&msg, sizeof(msg),
 			 (void *)output->control_block->ctx);
 }
+
+void log_dict_output_sync_process(const struct log_output *output, uint32_t seq)
+{
+	struct log_dict_output_sync_msg_t msg;
+
+	msg.type = MSG_SYNC;
+	memcpy(msg.magic, LOG_DICT_OUTPUT_SYNC_MAGIC, sizeof(msg.magic));
+	msg.seq = seq;
+
+	log_output_write(output->func, (uint8_t *)&msg, sizeof(msg),
+			 (void *)output->control_block->ctx);
+}
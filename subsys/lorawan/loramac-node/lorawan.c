@@ -95,6 +95,20 @@ static lorawan_battery_level_cb_t battery_level_cb;
 static lorawan_dr_changed_cb_t dr_changed_cb;
 static lorawan_link_check_ans_cb_t link_check_cb;
 
+#ifdef CONFIG_LORAWAN_MAC_WORKQ
+static K_THREAD_STACK_DEFINE(mac_workq_stack, CONFIG_LORAWAN_MAC_WORKQ_STACK_SIZE);
+static struct k_work_q mac_workq;
+
+static void mac_process_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	LoRaMacProcess();
+}
+
+static K_WORK_DEFINE(mac_process_work, mac_process_handler);
+#endif /* CONFIG_LORAWAN_MAC_WORKQ */
+
 /* implementation required by the soft-se (software secure element) */
 void BoardGetUniqueId(uint8_t *id)
 {
@@ -112,7 +126,12 @@ static uint8_t get_battery_level(void)
 
 static void mac_process_notify(void)
 {
+#ifdef CONFIG_LORAWAN_MAC_WORKQ
+	/* Events notified while the work runs resubmit it, none are missed */
+	k_work_submit_to_queue(&mac_workq, &mac_process_work);
+#else
 	LoRaMacProcess();
+#endif
 }
 
 static void datarate_observe(bool force_notification)
@@ -824,6 +843,17 @@ static int lorawan_init(void)
 
 	mac_callbacks.MacProcessNotify = mac_process_notify;
 
+#ifdef CONFIG_LORAWAN_MAC_WORKQ
+	const struct k_work_queue_config cfg = {
+		.name = "lorawan_mac",
+	};
+
+	k_work_queue_init(&mac_workq);
+	k_work_queue_start(&mac_workq, mac_workq_stack,
+			   K_THREAD_STACK_SIZEOF(mac_workq_stack),
+			   CONFIG_LORAWAN_MAC_WORKQ_PRIORITY, &cfg);
+#endif
+
 	return 0;
 }
 
@@ -72,6 +72,18 @@ void *mem_attr_heap_aligned_alloc(uint32_t attr, size_t align, size_t bytes)
 					    (void *)(long) attr, align, bytes);
 }
 
+void *mem_attr_heap_aligned_alloc_prefer(const uint32_t *attrs, size_t num_attrs,
+					 size_t align, size_t bytes)
+{
+	void *block = NULL;
+
+	for (size_t idx = 0; (idx < num_attrs) && (block == NULL); idx++) {
+		block = mem_attr_heap_aligned_alloc(attrs[idx], align, bytes);
+	}
+
+	return block;
+}
+
 const struct mem_attr_region_t *mem_attr_heap_get_region(void *addr)
 {
 	const struct sys_multi_heap_rec *heap_rec;
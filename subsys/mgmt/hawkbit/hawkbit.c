@@ -150,6 +150,10 @@ struct hawkbit_context {
 	int32_t json_action_id;
 	struct hawkbit_download dl;
 	struct flash_img_context flash_ctx;
+#ifdef CONFIG_HAWKBIT_DELTA
+	struct flash_img_delta_context delta_ctx;
+	bool delta;
+#endif
 	enum hawkbit_response code_status;
 	bool final_data_received;
 	enum hawkbit_http_request type;
@@ -1022,8 +1026,30 @@ static void response_download_cb(struct http_response *rsp, enum http_final_call
 	body_data = rsp->body_frag_start;
 	body_len = rsp->body_frag_len;
 
-	ret = flash_img_buffered_write(&hb_context->flash_ctx, body_data, body_len,
-				       final_data == HTTP_DATA_FINAL);
+#ifdef CONFIG_HAWKBIT_DELTA
+	if ((hb_context->dl.downloaded_size == 0) && !hb_context->delta &&
+	    flash_img_delta_is_patch(body_data, body_len)) {
+		ret = flash_img_delta_init(&hb_context->delta_ctx);
+		if (ret < 0) {
+			LOG_ERR("Failed to init patch: %d", ret);
+			hb_context->code_status = HAWKBIT_DOWNLOAD_ERROR;
+			return;
+		}
+
+		LOG_INF("Artifact is a patch");
+		hb_context->delta = true;
+	}
+
+	if (hb_context->delta) {
+		ret = flash_img_delta_write(&hb_context->delta_ctx, body_data, body_len,
+					    final_data == HTTP_DATA_FINAL);
+	} else
+#endif
+	{
+		ret = flash_img_buffered_write(&hb_context->flash_ctx, body_data, body_len,
+					       final_data == HTTP_DATA_FINAL);
+	}
+
 	if (ret < 0) {
 		LOG_ERR("Failed to write flash: %d", ret);
 		hb_context->code_status = HAWKBIT_DOWNLOAD_ERROR;
@@ -1034,7 +1060,15 @@ static void response_download_cb(struct http_response *rsp, enum http_final_call
 	stream_flash_progress_save(&hb_context->flash_ctx.stream, "hawkbit/flash_progress");
 #endif
 
-	hb_context->dl.downloaded_size = flash_img_bytes_written(&hb_context->flash_ctx);
+#ifdef CONFIG_HAWKBIT_DELTA
+	if (hb_context->delta) {
+		hb_context->dl.downloaded_size =
+			flash_img_delta_bytes_read(&hb_context->delta_ctx);
+	} else
+#endif
+	{
+		hb_context->dl.downloaded_size = flash_img_bytes_written(&hb_context->flash_ctx);
+	}
 
 	downloaded = hb_context->dl.downloaded_size * 100 / hb_context->dl.file_size;
 
@@ -1591,6 +1625,9 @@ static enum smf_state_result s_download(void *o)
 	}
 
 	flash_img_init(&s->hb_context.flash_ctx);
+#ifdef CONFIG_HAWKBIT_DELTA
+	s->hb_context.delta = false;
+#endif
 
 	/* The flash_area pointer has to be copied before the download starts
 	 * because the flash_area will be set to NULL after the download has finished.
@@ -1620,9 +1657,19 @@ static enum smf_state_result s_download(void *o)
 #endif
 
 	/* Verify the hash of the stored firmware */
-	fic.match = s->hb_context.dl.file_hash;
-	fic.clen = s->hb_context.dl.downloaded_size;
-	if (flash_img_check(&s->hb_context.flash_ctx, &fic, flash_area_ptr->fa_id)) {
+#ifdef CONFIG_HAWKBIT_DELTA
+	if (s->hb_context.delta) {
+		/* The artifact hash is the one of the patch */
+		ret = flash_img_delta_check(&s->hb_context.delta_ctx);
+	} else
+#endif
+	{
+		fic.match = s->hb_context.dl.file_hash;
+		fic.clen = s->hb_context.dl.downloaded_size;
+		ret = flash_img_check(&s->hb_context.flash_ctx, &fic, flash_area_ptr->fa_id);
+	}
+
+	if (ret != 0) {
 		LOG_ERR("Failed to validate stored firmware");
 		s->hb_context.code_status = HAWKBIT_DOWNLOAD_ERROR;
 		smf_set_state(SMF_CTX(s), &hawkbit_states[S_HAWKBIT_TERMINATE]);
@@ -414,6 +414,125 @@ img_mgmt_find_by_hash(uint8_t *find, struct image_version *ver)
 	return -1;
 }
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/* Upload chunks received ahead of the expected offset, written once the data
+ * before them has been received. Slots with a zero length are unused.
+ */
+static struct {
+	size_t off;
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE];
+} img_mgmt_upload_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW];
+
+static void img_mgmt_upload_window_clear(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_upload_window); i++) {
+		img_mgmt_upload_window[i].len = 0;
+	}
+}
+
+/**
+ * Keeps a chunk of an upload in progress received ahead of the expected offset.
+ *
+ * @return true if the chunk is kept; false if it is dropped.
+ */
+static bool img_mgmt_upload_window_keep(const struct img_mgmt_upload_req *req)
+{
+	int free_slot = -1;
+
+	if ((g_img_mgmt_state.area_id == -1) || (req->off <= g_img_mgmt_state.off) ||
+	    (req->img_data.len == 0) ||
+	    (req->img_data.len > CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE) ||
+	    (req->off + req->img_data.len > g_img_mgmt_state.size)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_upload_window); i++) {
+		if (img_mgmt_upload_window[i].len == 0) {
+			if (free_slot < 0) {
+				free_slot = (int)i;
+			}
+		} else if (img_mgmt_upload_window[i].off == req->off) {
+			/* Already kept */
+			return true;
+		}
+	}
+
+	if (free_slot < 0) {
+		return false;
+	}
+
+	img_mgmt_upload_window[free_slot].off = req->off;
+	img_mgmt_upload_window[free_slot].len = req->img_data.len;
+	memcpy(img_mgmt_upload_window[free_slot].data, req->img_data.value, req->img_data.len);
+
+	return true;
+}
+
+/**
+ * Writes the kept chunks following the data written so far.
+ *
+ * @param last	Set to true if the last chunk of the image was written.
+ *
+ * @return 0 on success; IMG_MGMT_ERR code on failure.
+ */
+static int img_mgmt_upload_window_flush(bool *last)
+{
+	bool written;
+	int rc;
+
+	do {
+		written = false;
+
+		for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_upload_window); i++) {
+			size_t off = img_mgmt_upload_window[i].off;
+			size_t len = img_mgmt_upload_window[i].len;
+
+			if ((len == 0) || (off > g_img_mgmt_state.off)) {
+				continue;
+			}
+
+			img_mgmt_upload_window[i].len = 0;
+
+			if (off < g_img_mgmt_state.off) {
+				/* Already written with another chunk */
+				continue;
+			}
+
+			*last = (off + len == g_img_mgmt_state.size);
+			rc = img_mgmt_write_image_data(off, img_mgmt_upload_window[i].data, len,
+						       *last);
+			if (rc != 0) {
+				return rc;
+			}
+
+			g_img_mgmt_state.off += len;
+			written = true;
+		}
+	} while (written);
+
+	return 0;
+}
+#else
+static inline void img_mgmt_upload_window_clear(void)
+{
+}
+
+static inline bool img_mgmt_upload_window_keep(const struct img_mgmt_upload_req *req)
+{
+	ARG_UNUSED(req);
+
+	return false;
+}
+
+static inline int img_mgmt_upload_window_flush(bool *last)
+{
+	ARG_UNUSED(last);
+
+	return 0;
+}
+#endif /* CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0 */
+
 /*
  * Resets upload status to defaults (no upload in progress)
  */
@@ -426,6 +545,7 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+	img_mgmt_upload_window_clear();
 	img_mgmt_release_lock();
 }
 
@@ -822,8 +942,9 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 	if (!action.proceed) {
 		/* Request specifies incorrect offset.  Respond with a success code and
-		 * the correct offset.
+		 * the correct offset, keeping the data if it is ahead of that offset.
 		 */
+		(void)img_mgmt_upload_window_keep(&req);
 		rc = img_mgmt_upload_good_rsp(ctxt);
 		img_mgmt_release_lock();
 		return rc;
@@ -865,6 +986,7 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #endif
 
 		g_img_mgmt_state.off = 0;
+		img_mgmt_upload_window_clear();
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
@@ -942,7 +1064,12 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+
+			/* Write the chunks received ahead of this one */
+			rc = img_mgmt_upload_window_flush(&last);
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
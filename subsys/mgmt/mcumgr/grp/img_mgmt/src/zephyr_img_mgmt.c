@@ -472,6 +472,51 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 	return 0;
 }
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+/* Whether the upload in progress is a patch, and the flash area it applies to */
+static bool upload_delta;
+static int upload_delta_source_area_id;
+
+static int img_mgmt_write_delta_data(unsigned int offset, const void *data,
+				     unsigned int num_bytes, bool last)
+{
+	static struct flash_img_delta_context ctx;
+	int rc;
+
+	if (offset == 0) {
+		if (flash_img_delta_init_id(&ctx, g_img_mgmt_state.area_id,
+					    upload_delta_source_area_id) != 0) {
+			return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
+		}
+	}
+
+	rc = flash_img_delta_write(&ctx, data, num_bytes, last);
+	if (rc == -EINVAL) {
+		return IMG_MGMT_ERR_INVALID_IMAGE_HEADER;
+	} else if (rc != 0) {
+		return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
+	}
+
+	return IMG_MGMT_ERR_OK;
+}
+
+static inline bool img_mgmt_upload_is_delta(void)
+{
+	return upload_delta;
+}
+#else
+static inline bool img_mgmt_upload_is_delta(void)
+{
+	return false;
+}
+
+static inline int img_mgmt_write_delta_data(unsigned int offset, const void *data,
+					    unsigned int num_bytes, bool last)
+{
+	return IMG_MGMT_ERR_UNKNOWN;
+}
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_USE_HEAP_FOR_FLASH_IMG_CONTEXT)
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last)
@@ -487,6 +532,10 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 	int rc = IMG_MGMT_ERR_OK;
 	static struct flash_img_context *ctx;
 
+	if (img_mgmt_upload_is_delta()) {
+		return img_mgmt_write_delta_data(offset, data, num_bytes, last);
+	}
+
 	if (offset != 0 && ctx == NULL) {
 		return IMG_MGMT_ERR_FLASH_CONTEXT_NOT_SET;
 	}
@@ -526,6 +575,10 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 {
 	static struct flash_img_context ctx;
 
+	if (img_mgmt_upload_is_delta()) {
+		return img_mgmt_write_delta_data(offset, data, num_bytes, last);
+	}
+
 	if (offset == 0) {
 		if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) != 0) {
 			return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
@@ -707,7 +760,17 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		action->size = req->size;
 
 		hdr = (struct image_header *)req->img_data.value;
-		if (hdr->ih_magic != IMAGE_MAGIC) {
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+		upload_delta = flash_img_delta_is_patch(req->img_data.value, req->img_data.len);
+		if (upload_delta) {
+			/* The image header is only known once the patch is applied */
+			hdr = NULL;
+			upload_delta_source_area_id =
+				img_mgmt_flash_area_id(img_mgmt_active_slot(req->image));
+		}
+#endif
+
+		if (hdr != NULL && hdr->ih_magic != IMAGE_MAGIC) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_magic_mismatch);
 			LOG_DBG("Magic mismatch: %08X != %08X", hdr->ih_magic, IMAGE_MAGIC);
 			return IMG_MGMT_ERR_INVALID_IMAGE_HEADER_MAGIC;
@@ -828,7 +891,7 @@ skip_size_check:
 #endif
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_REJECT_DIRECT_XIP_MISMATCHED_SLOT)
-		if (hdr->ih_flags & IMAGE_F_ROM_FIXED) {
+		if (hdr != NULL && (hdr->ih_flags & IMAGE_F_ROM_FIXED)) {
 			if (fa->fa_off != hdr->ih_load_addr) {
 				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 					img_mgmt_err_str_image_bad_flash_addr);
@@ -842,7 +905,7 @@ skip_size_check:
 
 		flash_area_close(fa);
 
-		if (req->upgrade) {
+		if (req->upgrade && hdr != NULL) {
 			/* User specified upgrade-only. Make sure new image version is
 			 * greater than that of the currently running image.
 			 */
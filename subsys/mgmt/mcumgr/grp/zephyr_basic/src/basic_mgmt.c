@@ -8,6 +8,13 @@
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/storage/flash_map.h>
+#include <zephyr/debug/boot_profile.h>
+
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+
+#include <mgmt/mcumgr/util/zcbor_bulk.h>
 
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
 #include <zephyr/mgmt/mcumgr/mgmt/handlers.h>
@@ -15,6 +22,8 @@
 
 LOG_MODULE_REGISTER(mcumgr_zbasic_grp, CONFIG_MCUMGR_GRP_ZBASIC_LOG_LEVEL);
 
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE
+
 #define ERASE_TARGET		storage_partition
 #define ERASE_TARGET_ID		FIXED_PARTITION_ID(ERASE_TARGET)
 
@@ -63,6 +72,86 @@ static int storage_erase_handler(struct smp_streamer *ctxt)
 
 	return MGMT_ERR_EOK;
 }
+#endif /* CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE */
+
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE
+/* Keys of a boot profile record */
+#define BOOT_PROFILE_RECORD_KEYS 7
+
+static bool boot_profile_record_encode(zcbor_state_t *zse,
+				       const struct boot_profile_record *record)
+{
+	const char *name = boot_profile_name(record);
+	bool ok;
+
+	ok = zcbor_map_start_encode(zse, BOOT_PROFILE_RECORD_KEYS)			&&
+	     zcbor_tstr_put_lit(zse, "type")						&&
+	     zcbor_uint32_put(zse, record->type)					&&
+	     zcbor_tstr_put_lit(zse, "level")						&&
+	     zcbor_uint32_put(zse, record->level)					&&
+	     zcbor_tstr_put_lit(zse, "start")						&&
+	     zcbor_uint64_put(zse, boot_profile_cycles_to_ns(record->start) / NSEC_PER_USEC) &&
+	     zcbor_tstr_put_lit(zse, "end")						&&
+	     zcbor_uint64_put(zse, boot_profile_cycles_to_ns(record->end) / NSEC_PER_USEC) &&
+	     zcbor_tstr_put_lit(zse, "rc")						&&
+	     zcbor_int32_put(zse, record->result)					&&
+	     zcbor_tstr_put_lit(zse, "thread")						&&
+	     zcbor_uint64_put(zse, (uintptr_t)record->thread);
+
+	/* Unnamed SYS_INIT entries are identified by their init function */
+	if (ok && name != NULL) {
+		ok = zcbor_tstr_put_lit(zse, "name")					&&
+		     zcbor_tstr_put_term(zse, name, CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE_NAME_LEN);
+	} else if (ok) {
+		ok = zcbor_tstr_put_lit(zse, "addr")					&&
+		     zcbor_uint64_put(zse, (uintptr_t)record->init_fn);
+	}
+
+	return ok && zcbor_map_end_encode(zse, BOOT_PROFILE_RECORD_KEYS);
+}
+
+static int boot_profile_handler(struct smp_streamer *ctxt)
+{
+	zcbor_state_t *zse = ctxt->writer->zs;
+	zcbor_state_t *zsd = ctxt->reader->zs;
+	size_t count = boot_profile_count();
+	size_t decoded;
+	size_t off = 0;
+	size_t num;
+	bool ok;
+
+	struct zcbor_map_decode_key_val boot_profile_decode[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_size_decode, &off),
+	};
+
+	if (zcbor_map_decode_bulk(zsd, boot_profile_decode, ARRAY_SIZE(boot_profile_decode),
+				  &decoded) != 0) {
+		return MGMT_ERR_EINVAL;
+	}
+
+	off = MIN(off, count);
+	num = MIN(count - off, CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE_PAGE);
+
+	ok = zcbor_tstr_put_lit(zse, "total")						&&
+	     zcbor_uint32_put(zse, count)						&&
+	     zcbor_tstr_put_lit(zse, "dropped")						&&
+	     zcbor_uint32_put(zse, boot_profile_dropped())				&&
+	     zcbor_tstr_put_lit(zse, "off")						&&
+	     zcbor_uint32_put(zse, off)							&&
+	     zcbor_tstr_put_lit(zse, "records")						&&
+	     zcbor_list_start_encode(zse, num);
+
+	for (size_t i = off; ok && i < off + num; i++) {
+		ok = boot_profile_record_encode(zse, boot_profile_get(i));
+	}
+
+	if (!ok || !zcbor_list_end_encode(zse, num)) {
+		return MGMT_ERR_EMSGSIZE;
+	}
+
+	return MGMT_ERR_EOK;
+}
+#endif /* CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE */
 
 #ifdef CONFIG_MCUMGR_SMP_SUPPORT_ORIGINAL_PROTOCOL
 /*
@@ -95,10 +184,18 @@ static int zephyr_basic_group_translate_error_code(uint16_t ret)
 #endif
 
 static const struct mgmt_handler zephyr_mgmt_basic_handlers[] = {
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE
 	[ZEPHYR_MGMT_GRP_BASIC_CMD_ERASE_STORAGE] = {
 		.mh_read  = NULL,
 		.mh_write = storage_erase_handler,
 	},
+#endif
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE
+	[ZEPHYR_MGMT_GRP_BASIC_CMD_BOOT_PROFILE] = {
+		.mh_read  = boot_profile_handler,
+		.mh_write = NULL,
+	},
+#endif
 };
 
 static struct mgmt_group zephyr_basic_mgmt_group = {
@@ -56,6 +56,8 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 	struct modem_backend_uart *backend = (struct modem_backend_uart *) user_data;
 	k_spinlock_key_t key;
 	uint32_t received;
+	uint32_t space;
+	bool was_empty;
 
 	switch (evt->type) {
 	case UART_TX_DONE:
@@ -114,6 +116,7 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 
 	case UART_RX_RDY:
 		key = k_spin_lock(&backend->async.receive_rb_lock);
+		was_empty = ring_buf_is_empty(&backend->async.receive_rb);
 		received = ring_buf_put(&backend->async.receive_rb,
 					&evt->data.rx.buf[evt->data.rx.offset],
 					evt->data.rx.len);
@@ -129,8 +132,19 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 			break;
 		}
 
+		space = ring_buf_space_get(&backend->async.receive_rb);
 		k_spin_unlock(&backend->async.receive_rb_lock, key);
-		modem_work_schedule(&backend->receive_ready_work, K_NO_WAIT);
+
+		if (was_empty || space < (ring_buf_capacity_get(&backend->async.receive_rb) / 2)) {
+			/* Notify right away when data starts arriving, or to free up space */
+			modem_work_reschedule(&backend->receive_ready_work, K_NO_WAIT);
+		} else {
+			/* The receiver has not drained the data of earlier events yet and picks
+			 * this data up along with it. Only make sure it is notified eventually.
+			 */
+			modem_work_schedule(&backend->receive_ready_work,
+					    K_MSEC(CONFIG_MODEM_BACKEND_UART_ASYNC_RECEIVE_BATCH_MS));
+		}
 		break;
 
 	case UART_RX_DISABLED:
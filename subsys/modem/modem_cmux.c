@@ -1148,7 +1148,9 @@ static void modem_cmux_on_dlci_frame_uih(struct modem_cmux_dlci *dlci)
 	if (previous_state != dlci->rx_full) {
 		modem_cmux_send_msc(cmux, dlci);
 	}
-	modem_pipe_notify_receive_ready(&dlci->pipe);
+
+	/* Notified once all the frames received at once are processed */
+	dlci->rx_pending = true;
 }
 
 static void modem_cmux_on_dlci_frame_sabm(struct modem_cmux_dlci *dlci)
@@ -1463,6 +1465,68 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+/*
+ * Process as many received bytes as can be handled at once, which is the payload of a frame
+ * or anything up to the next flag while looking for the start of a frame. Other bytes are
+ * processed one at a time.
+ */
+static size_t modem_cmux_process_received_data(struct modem_cmux *cmux, const uint8_t *data,
+					       size_t len)
+{
+	const uint8_t *sof;
+	size_t count;
+
+	switch (cmux->receive_state) {
+	case MODEM_CMUX_RECEIVE_STATE_SOF:
+		sof = memchr(data, MODEM_CMUX_SOF, len);
+		count = (sof == NULL) ? len : (size_t)(sof - data);
+		if (count == 0) {
+			break;
+		}
+
+		cmux->frame_header_len = 0;
+		return count;
+
+	case MODEM_CMUX_RECEIVE_STATE_DATA:
+		count = MIN(len, cmux->frame.data_len - cmux->receive_buf_len);
+
+		/* Bytes not fitting the receive buffer are dropped along with the frame */
+		if (cmux->receive_buf_len < cmux->config.receive_buf_size) {
+			memcpy(&cmux->config.receive_buf[cmux->receive_buf_len], data,
+			       MIN(count, cmux->config.receive_buf_size - cmux->receive_buf_len));
+		}
+
+		cmux->receive_buf_len += count;
+
+		if (cmux->frame.data_len == cmux->receive_buf_len) {
+			/* Await FCS */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+		}
+
+		return count;
+
+	default:
+		break;
+	}
+
+	modem_cmux_process_received_byte(cmux, data[0]);
+	return 1;
+}
+
+static void modem_cmux_dlci_notify_receive_ready(struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+		if (dlci->rx_pending) {
+			dlci->rx_pending = false;
+			modem_pipe_notify_receive_ready(&dlci->pipe);
+		}
+	}
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
@@ -1474,9 +1538,11 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	/* Receive data from pipe */
 	while ((ret = modem_pipe_receive(cmux->pipe, cmux->work_buf, sizeof(cmux->work_buf))) > 0) {
 		/* Process received data */
-		for (int i = 0; i < ret; i++) {
-			modem_cmux_process_received_byte(cmux, cmux->work_buf[i]);
+		for (int i = 0; i < ret;) {
+			i += modem_cmux_process_received_data(cmux, &cmux->work_buf[i], ret - i);
 		}
+
+		modem_cmux_dlci_notify_receive_ready(cmux);
 	}
 	if (ret < 0) {
 		LOG_ERR("Pipe receiving error: %d", ret);
@@ -22,6 +22,9 @@ LOG_MODULE_REGISTER(modem_ppp, CONFIG_MODEM_MODULES_LOG_LEVEL);
 #define MODEM_PPP_CODE_ESCAPE		(0x7D)
 #define MODEM_PPP_VALUE_ESCAPE		(0x20)
 
+/* Data bytes read from the packet and added to the FCS at once */
+#define MODEM_PPP_WRAP_CHUNK_SIZE	(64)
+
 static uint16_t modem_ppp_fcs_init(uint8_t byte)
 {
 	return crc16_ccitt(0xFFFF, &byte, 1);
@@ -67,15 +70,41 @@ static bool modem_ppp_needs_escape(uint32_t async_map, uint8_t byte)
 	return byte_bit & async_map;
 }
 
+/* Wrap as many data bytes as fit in the buffer even if they all need escaping */
+static uint32_t modem_ppp_wrap_data(struct modem_ppp *ppp, uint32_t async_map, uint8_t *buffer,
+				    uint32_t available)
+{
+	uint8_t chunk[MODEM_PPP_WRAP_CHUNK_SIZE];
+	uint32_t offset = 0;
+	size_t len;
+
+	len = MIN(net_pkt_remaining_data(ppp->tx_pkt), MIN(available / 2, sizeof(chunk)));
+	(void)net_pkt_read(ppp->tx_pkt, chunk, len);
+
+	/* FCS is computed without the escape/modification */
+	ppp->tx_pkt_fcs = crc16_ccitt(ppp->tx_pkt_fcs, chunk, len);
+
+	for (size_t i = 0; i < len; i++) {
+		if (modem_ppp_needs_escape(async_map, chunk[i])) {
+			buffer[offset++] = MODEM_PPP_CODE_ESCAPE;
+			buffer[offset++] = chunk[i] ^ MODEM_PPP_VALUE_ESCAPE;
+		} else {
+			buffer[offset++] = chunk[i];
+		}
+	}
+
+	return offset;
+}
+
 static uint32_t modem_ppp_wrap(struct modem_ppp *ppp, uint8_t *buffer, uint32_t available)
 {
 	uint32_t async_map = ppp_peer_async_control_character_map(ppp->iface);
 	uint32_t offset = 0;
 	uint32_t remaining;
+	uint32_t pushed;
 	uint16_t protocol;
 	uint8_t upper;
 	uint8_t lower;
-	uint8_t byte;
 
 	while (offset < available) {
 		remaining = available - offset;
@@ -142,18 +171,10 @@ static uint32_t modem_ppp_wrap(struct modem_ppp *ppp, uint8_t *buffer, uint32_t
 				if (remaining < 2) {
 					goto end;
 				}
-				/* Pull next byte we're sending */
-				(void)net_pkt_read_u8(ppp->tx_pkt, &byte);
-				/* FCS is computed without the escape/modification */
-				ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
-				/* Push encoded bytes into buffer*/
-				if (modem_ppp_needs_escape(async_map, byte)) {
-					buffer[offset++] = MODEM_PPP_CODE_ESCAPE;
-					byte ^= MODEM_PPP_VALUE_ESCAPE;
-					remaining--;
-				}
-				buffer[offset++] = byte;
-				remaining--;
+				/* Push encoded bytes into buffer */
+				pushed = modem_ppp_wrap_data(ppp, async_map, &buffer[offset], remaining);
+				offset += pushed;
+				remaining -= pushed;
 			}
 			/* Data phase finished */
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_EOF;
@@ -313,6 +334,56 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+static void modem_ppp_write_received_data(struct modem_ppp *ppp, const uint8_t *data, size_t len)
+{
+	/* Keep a spare byte, as when writing byte by byte */
+	while (net_pkt_available_buffer(ppp->rx_pkt) <= len) {
+		if (net_pkt_alloc_buffer(ppp->rx_pkt, CONFIG_MODEM_PPP_NET_BUF_FRAG_SIZE,
+					 NET_AF_INET, K_NO_WAIT) < 0) {
+			LOG_WRN("Failed to alloc buffer");
+			net_pkt_unref(ppp->rx_pkt);
+			ppp->rx_pkt = NULL;
+			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+			return;
+		}
+	}
+
+	if (net_pkt_write(ppp->rx_pkt, data, len) < 0) {
+		LOG_WRN("Dropped PPP frame");
+		net_pkt_unref(ppp->rx_pkt);
+		ppp->rx_pkt = NULL;
+		ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+		ppp->stats.drop++;
+#endif
+	}
+}
+
+/*
+ * Process as many received bytes as can be handled at once, which is the frame data up to the
+ * next delimiter or escape. Other bytes are processed one at a time.
+ */
+static size_t modem_ppp_process_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					      size_t len)
+{
+	size_t count = 0;
+
+	if (ppp->receive_state == MODEM_PPP_RECEIVE_STATE_WRITING) {
+		while ((count < len) && (data[count] != MODEM_PPP_CODE_DELIMITER) &&
+		       (data[count] != MODEM_PPP_CODE_ESCAPE)) {
+			count++;
+		}
+	}
+
+	if (count == 0) {
+		modem_ppp_process_received_byte(ppp, data[0]);
+		return 1;
+	}
+
+	modem_ppp_write_received_data(ppp, data, count);
+	return count;
+}
+
 #if CONFIG_MODEM_STATS
 static uint32_t get_transmit_buf_length(struct modem_ppp *ppp)
 {
@@ -424,8 +495,8 @@ static void modem_ppp_process_handler(struct k_work *item)
 	advertise_receive_buf_stats(ppp, ret);
 #endif
 
-	for (int i = 0; i < ret; i++) {
-		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
+	for (int i = 0; i < ret;) {
+		i += modem_ppp_process_received_data(ppp, &ppp->receive_buf[i], ret - i);
 	}
 
 	modem_work_submit(&ppp->process_work);
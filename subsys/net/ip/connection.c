@@ -24,6 +24,7 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 #include <zephyr/net/udp.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/socketcan.h>
+#include <zephyr/sys/hash_function.h>
 
 #include "net_private.h"
 #include "icmpv6.h"
@@ -56,6 +57,10 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Both addresses and ports specified */
+#define NET_CONN_EXACT (NET_CONN_REMOTE_PORT_SPEC | NET_CONN_LOCAL_PORT_SPEC | \
+			NET_CONN_REMOTE_ADDR_SPEC | NET_CONN_LOCAL_ADDR_SPEC)
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
@@ -113,6 +118,110 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CONN_HASH_SIZE),
+	     "CONFIG_NET_CONN_HASH_SIZE must be a power of two");
+
+/* Every used connection is in exactly one of these lists, ordered like
+ * conn_used. Exact connections are hashed on their remote address and
+ * both ports, connections with a local port on that port.
+ */
+static sys_slist_t conn_hash_exact[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_hash_port[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_hash_any;
+static uint32_t conn_seq;
+
+static sys_slist_t *conn_hash_exact_bucket(uint16_t proto, const uint8_t *addr,
+					   size_t addr_len, uint16_t remote_port,
+					   uint16_t local_port)
+{
+	uint8_t key[NET_IPV6_ADDR_SIZE + 3 * sizeof(uint16_t)];
+	size_t len = addr_len;
+
+	memcpy(key, addr, addr_len);
+	memcpy(&key[len], &remote_port, sizeof(remote_port));
+	len += sizeof(remote_port);
+	memcpy(&key[len], &local_port, sizeof(local_port));
+	len += sizeof(local_port);
+	memcpy(&key[len], &proto, sizeof(proto));
+	len += sizeof(proto);
+
+	return &conn_hash_exact[sys_hash32_murmur3(key, len) &
+				(CONFIG_NET_CONN_HASH_SIZE - 1)];
+}
+
+static sys_slist_t *conn_hash_port_bucket(uint16_t local_port)
+{
+	return &conn_hash_port[sys_hash32_murmur3(&local_port, sizeof(local_port)) &
+			       (CONFIG_NET_CONN_HASH_SIZE - 1)];
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	uint16_t remote_port = net_sin(&conn->remote_addr)->sin_port;
+
+	if ((conn->flags & NET_CONN_EXACT) == NET_CONN_EXACT) {
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    conn->remote_addr.sa_family == NET_AF_INET6) {
+			return conn_hash_exact_bucket(conn->proto,
+				(const uint8_t *)&net_sin6(&conn->remote_addr)->sin6_addr,
+				sizeof(struct net_in6_addr), remote_port, local_port);
+		}
+
+		if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		    conn->remote_addr.sa_family == NET_AF_INET) {
+			return conn_hash_exact_bucket(conn->proto,
+				(const uint8_t *)&net_sin(&conn->remote_addr)->sin_addr,
+				sizeof(struct net_in_addr), remote_port, local_port);
+		}
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0) {
+		return conn_hash_port_bucket(local_port);
+	}
+
+	return &conn_hash_any;
+}
+
+/* Called with conn_lock held */
+static void conn_hash_add(struct net_conn *conn)
+{
+	sys_slist_t *list = conn_hash_list(conn);
+	sys_snode_t *prev = NULL;
+	struct net_conn *tmp;
+
+	/* Keep the registration order, so that connections of the same
+	 * rank are chosen the same way as when walking conn_used.
+	 */
+	SYS_SLIST_FOR_EACH_CONTAINER(list, tmp, hash_node) {
+		if ((int32_t)(tmp->seq - conn->seq) < 0) {
+			break;
+		}
+
+		prev = &tmp->hash_node;
+	}
+
+	sys_slist_insert(list, prev, &conn->hash_node);
+}
+
+/* Called with conn_lock held */
+static void conn_hash_remove(struct net_conn *conn)
+{
+	sys_slist_find_and_remove(conn_hash_list(conn), &conn->hash_node);
+}
+#else
+static inline void conn_hash_add(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void conn_hash_remove(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -138,6 +247,10 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	conn->seq = conn_seq++;
+#endif
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -463,6 +576,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_remove(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -491,12 +605,17 @@ int net_conn_update(struct net_conn_handle *handle,
 
 	net_conn_change_callback(conn, cb, user_data);
 
+	/* The addresses and ports select the hash bucket */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_remove(conn);
+
 	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	if (ret == 0) {
+		ret = net_conn_change_remote(conn, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_hash_add(conn);
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -844,6 +963,154 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+/* Is the candidate connection matching the received TCP/UDP packet? */
+static bool conn_is_matching(struct net_conn *conn, struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr, uint8_t proto,
+			     uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return false; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != NET_AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == NET_AF_INET6 && pkt_family == NET_AF_INET &&
+			      !conn->v6only && conn->type != NET_SOCK_RAW)) {
+				return false;
+			}
+		} else {
+			return false; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return false; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	uint8_t conn_family = conn->family;
+
+	if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+	    (conn_family == NET_AF_INET || conn_family == NET_AF_INET6 ||
+	     conn_family == NET_AF_UNSPEC)) {
+		/* Is the candidate connection matching the packet's TCP/UDP
+		 * address and port?
+		 */
+		if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
+		    net_sin(&conn->remote_addr)->sin_port != src_port) {
+			return false; /* wrong remote port */
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			return false; /* wrong local port */
+		}
+
+		if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+			return false; /* wrong remote address */
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+			/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+			 * has no IPV6_V6ONLY option set and if the local IPV6 address
+			 * is unspecified, then we could accept a connection from IPv4
+			 * address by mapping it to IPv6 address.
+			 */
+			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+				if (!(conn->family == NET_AF_INET6 &&
+				      pkt_family == NET_AF_INET &&
+				      !conn->v6only &&
+				      net_ipv6_is_addr_unspecified(
+					      &net_sin6(&conn->local_addr)->sin6_addr))) {
+					return false; /* wrong local address */
+				}
+			} else {
+				return false; /* wrong local address */
+			}
+
+			/* We might have a match for v4-to-v6 mapping,
+			 * continue with rank checking.
+			 */
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+/* Called with conn_lock held */
+static struct net_conn *conn_hash_find(struct net_pkt *pkt,
+				       union net_ip_header *ip_hdr,
+				       uint8_t proto, uint16_t src_port,
+				       uint16_t dst_port)
+{
+	sys_slist_t *lists[] = {
+		conn_hash_port_bucket(dst_port),
+		&conn_hash_any,
+	};
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	struct net_conn *conn;
+	sys_slist_t *exact;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == NET_AF_INET6) {
+		exact = conn_hash_exact_bucket(proto, ip_hdr->ipv6->src,
+					       sizeof(struct net_in6_addr),
+					       src_port, dst_port);
+	} else {
+		exact = conn_hash_exact_bucket(proto, ip_hdr->ipv4->src,
+					       sizeof(struct net_in_addr),
+					       src_port, dst_port);
+	}
+
+	/* Exact connections have the highest possible rank */
+	SYS_SLIST_FOR_EACH_CONTAINER(exact, conn, hash_node) {
+		if (conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			return conn;
+		}
+	}
+
+	/* Connections of one rank are all in the same list */
+	ARRAY_FOR_EACH(lists, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, hash_node) {
+			if (best_rank < NET_CONN_RANK(conn->flags) &&
+			    conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
+			}
+		}
+	}
+
+	return best_match;
+}
+#else
+static inline struct net_conn *conn_hash_find(struct net_pkt *pkt,
+					      union net_ip_header *ip_hdr,
+					      uint8_t proto, uint16_t src_port,
+					      uint16_t dst_port)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(src_port);
+	ARG_UNUSED(dst_port);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -909,120 +1176,61 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
+	/* Multicast packets go to all matching handlers, only look up the
+	 * best one in the hash table for unicast ones.
+	 */
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) && !is_mcast_pkt) {
+		best_match = conn_hash_find(pkt, ip_hdr, proto, src_port, dst_port);
+		goto unlock;
+	}
 
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != NET_AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == NET_AF_INET6 && pkt_family == NET_AF_INET &&
-				      !conn->v6only && conn->type != NET_SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
-			}
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+		struct net_pkt *mcast_pkt;
 
-			/* We might have a match for v4-to-v6 mapping, check more */
+		if (!conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			continue;
 		}
 
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
+		if (best_rank >= NET_CONN_RANK(conn->flags)) {
+			continue;
 		}
 
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
+		if (!is_mcast_pkt) {
+			best_rank = NET_CONN_RANK(conn->flags);
+			best_match = conn;
 
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == NET_AF_INET || conn_family == NET_AF_INET6 ||
-		     conn_family == NET_AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
-			 */
-			if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == NET_AF_INET6 &&
-					      pkt_family == NET_AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
-			}
-
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
+			continue; /* found a match - but maybe not yet the best */
+		}
 
-					continue; /* found a match - but maybe not yet the best */
-				}
+		/* If we have a multicast packet, and we found
+		 * a match, then deliver the packet immediately
+		 * to the handler. As there might be several
+		 * sockets interested about these, we need to
+		 * clone the received pkt.
+		 */
 
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
+		NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+			conn->user_data);
 
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
+		mcast_pkt = net_pkt_clone(
+			pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+		if (!mcast_pkt) {
+			k_mutex_unlock(&conn_lock);
+			goto drop;
+		}
 
-				mcast_pkt_delivered = true;
-			}
+		if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
+		    NET_DROP) {
+			net_stats_update_per_proto_drop(pkt_iface, proto);
+			net_pkt_unref(mcast_pkt);
+		} else {
+			net_stats_update_per_proto_recv(pkt_iface, proto);
 		}
+
+		mcast_pkt_delivered = true;
 	} /* loop end */
 
+unlock:
 	if (best_match != NULL) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -85,6 +85,14 @@ struct net_conn {
 
 	/** Is v4-mapping-to-v6 enabled for this connection */
 	uint8_t v6only : 1;
+
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Internal hash bucket node */
+	sys_snode_t hash_node;
+
+	/** Registration order, newest connections are matched first */
+	uint32_t seq;
+#endif /* CONFIG_NET_CONN_HASH */
 };
 
 /**
@@ -647,7 +647,8 @@ use_interface_mtu:
 			mtu = MAX(NET_IPV4_MTU, mtu);
 		}
 
-		if (pkt_len > mtu) {
+		/* GSO packets are split into segments by the L2 */
+		if (pkt_len > mtu && net_pkt_gso_size(pkt) == 0U) {
 			ret = net_ipv4_send_fragmented_pkt(net_pkt_iface(pkt), pkt, pkt_len, mtu);
 
 			if (ret < 0) {
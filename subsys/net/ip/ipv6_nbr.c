@@ -297,6 +297,8 @@ static inline void nbr_free(struct net_nbr *nbr)
 {
 	NET_DBG("nbr %p", nbr);
 
+	net_route_dst_cache_flush();
+
 	nbr_clear_ns_pending(net_ipv6_nbr_data(nbr));
 
 	net_ipv6_nbr_data(nbr)->reachable = 0;
@@ -492,6 +494,7 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 	}
 
 	nbr_init(nbr, iface, addr, is_router, state);
+	net_route_dst_cache_flush();
 
 	NET_DBG("nbr %p iface %p/%d state %d IPv6 %s",
 		nbr, iface, net_if_get_by_iface(iface), state,
@@ -880,7 +883,8 @@ use_interface_mtu:
 			mtu = MAX(NET_IPV6_MTU, mtu);
 		}
 
-		if (mtu < pkt_len) {
+		/* GSO packets are split into segments by the L2 */
+		if (mtu < pkt_len && net_pkt_gso_size(pkt) == 0U) {
 			ret = net_ipv6_send_fragmented_pkt(net_pkt_iface(pkt),
 							   pkt, pkt_len, mtu);
 			if (ret < 0) {
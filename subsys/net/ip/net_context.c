@@ -2128,8 +2128,10 @@ static int get_context_ipv6_mcast_loop(struct net_context *context,
 /* If buf is not NULL, then use it. Otherwise read the data to be written
  * to net_pkt from msghdr.
  */
-static int context_write_data(struct net_pkt *pkt, const void *buf,
-			      int buf_len, const struct net_msghdr *msghdr)
+static int context_write_data_op(struct net_pkt *pkt, const void *buf,
+				 int buf_len, const struct net_msghdr *msghdr,
+				 int (*write)(struct net_pkt *pkt, const void *data,
+					      size_t length))
 {
 	int ret = 0;
 
@@ -2139,8 +2141,7 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 		for (i = 0; i < msghdr->msg_iovlen; i++) {
 			int len = MIN(msghdr->msg_iov[i].iov_len, buf_len);
 
-			ret = net_pkt_write(pkt, msghdr->msg_iov[i].iov_base,
-					    len);
+			ret = write(pkt, msghdr->msg_iov[i].iov_base, len);
 			if (ret < 0) {
 				break;
 			}
@@ -2151,18 +2152,44 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 			}
 		}
 	} else {
-		ret = net_pkt_write(pkt, buf, buf_len);
+		ret = write(pkt, buf, buf_len);
 	}
 
 	return ret;
 }
 
+static int context_write_data(struct net_pkt *pkt, const void *buf,
+			      int buf_len, const struct net_msghdr *msghdr)
+{
+	return context_write_data_op(pkt, buf, buf_len, msghdr, net_pkt_write);
+}
+
+/* Write the UDP payload, summing it on the way if the checksum is
+ * computed in software anyway.
+ */
+static int context_write_udp_data(struct net_pkt *pkt, net_sa_family_t family,
+				  const void *buf, int buf_len,
+				  const struct net_msghdr *msghdr)
+{
+	enum net_if_checksum_type type = family == NET_AF_INET6 ?
+		NET_IF_CHECKSUM_IPV6_UDP : NET_IF_CHECKSUM_IPV4_UDP;
+
+	if (IS_ENABLED(CONFIG_NET_UDP_TX_CHECKSUM_COPY) &&
+	    net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type)) {
+		return context_write_data_op(pkt, buf, buf_len, msghdr,
+					     net_pkt_write_chksum);
+	}
+
+	return context_write_data(pkt, buf, buf_len, msghdr);
+}
+
 static int context_setup_udp_packet(struct net_context *context,
 				    net_sa_family_t family,
 				    struct net_pkt *pkt,
 				    const void *buf,
 				    size_t len,
 				    const struct net_msghdr *msg,
+				    struct net_buf *frags,
 				    const struct net_sockaddr *dst_addr,
 				    net_socklen_t addrlen)
 {
@@ -2202,9 +2229,16 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
-	if (ret) {
-		return ret;
+	if (frags != NULL) {
+		/* The payload is linked after the headers, the caller
+		 * reference is only dropped once the packet is sent.
+		 */
+		net_pkt_append_buffer(pkt, net_buf_ref(frags));
+	} else {
+		ret = context_write_udp_data(pkt, family, buf, len, msg);
+		if (ret) {
+			return ret;
+		}
 	}
 
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
@@ -2385,6 +2419,7 @@ static void set_pkt_hoplimit(struct net_pkt *pkt, const struct net_msghdr *msg_h
 static int context_sendto(struct net_context *context,
 			  const void *buf,
 			  size_t len,
+			  struct net_buf *frags,
 			  const struct net_sockaddr *dst_addr,
 			  net_socklen_t addrlen,
 			  net_context_send_cb_t cb,
@@ -2688,7 +2723,17 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	/* Caller provided buffers are only linked to UDP packets */
+	if (frags != NULL &&
+	    (!IS_ENABLED(CONFIG_NET_UDP) ||
+	     net_context_get_type(context) != NET_SOCK_DGRAM ||
+	     net_context_get_proto(context) != NET_IPPROTO_UDP ||
+	     net_if_is_ip_offloaded(net_context_get_iface(context)))) {
+		return -EOPNOTSUPP;
+	}
+
+	pkt = context_alloc_pkt(context, family, frags != NULL ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2696,7 +2741,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (frags == NULL && tmp_len < len) {
 		if (net_context_get_type(context) == NET_SOCK_DGRAM ||
 		    net_context_get_type(context) == NET_SOCK_RAW) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2762,7 +2807,7 @@ skip_alloc:
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == NET_IPPROTO_UDP) {
 		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+					       frags, dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2828,6 +2873,10 @@ skip_alloc:
 		goto fail;
 	}
 
+	if (frags != NULL) {
+		net_buf_unref(frags);
+	}
+
 	return len;
 fail:
 	if (pkt != NULL) {
@@ -2954,7 +3003,7 @@ int net_context_send(struct net_context *context,
 		}
 	}
 
-	ret = context_sendto(context, buf, len, &context->remote,
+	ret = context_sendto(context, buf, len, NULL, &context->remote,
 			     addrlen, cb, timeout, user_data, false);
 unlock:
 	k_mutex_unlock(&context->lock);
@@ -2973,7 +3022,7 @@ int net_context_sendmsg(struct net_context *context,
 
 	k_mutex_lock(&context->lock, K_FOREVER);
 
-	ret = context_sendto(context, msghdr, 0, NULL, 0,
+	ret = context_sendto(context, msghdr, 0, NULL, NULL, 0,
 			     cb, timeout, user_data, true);
 
 	k_mutex_unlock(&context->lock);
@@ -2994,7 +3043,7 @@ int net_context_sendto(struct net_context *context,
 
 	k_mutex_lock(&context->lock, K_FOREVER);
 
-	ret = context_sendto(context, buf, len, dst_addr, addrlen,
+	ret = context_sendto(context, buf, len, NULL, dst_addr, addrlen,
 			     cb, timeout, user_data, true);
 
 	k_mutex_unlock(&context->lock);
@@ -3002,6 +3051,43 @@ int net_context_sendto(struct net_context *context,
 	return ret;
 }
 
+int net_context_sendto_buf(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct net_sockaddr *dst_addr,
+			   net_socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data)
+{
+	int ret;
+
+	if (frags == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (dst_addr == NULL) {
+		if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+		    net_sin(&context->remote)->sin_port == 0) {
+			ret = -EDESTADDRREQ;
+			goto unlock;
+		}
+
+		dst_addr = &context->remote;
+		addrlen = net_context_get_family(context) == NET_AF_INET6 ?
+			  sizeof(struct net_sockaddr_in6) :
+			  sizeof(struct net_sockaddr_in);
+	}
+
+	ret = context_sendto(context, NULL, net_buf_frags_len(frags), frags,
+			     dst_addr, addrlen, cb, timeout, user_data, true);
+unlock:
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+
 enum net_verdict net_context_packet_received(struct net_conn *conn,
 					     struct net_pkt *pkt,
 					     union net_ip_header *ip_hdr,
@@ -605,6 +605,93 @@ err:
 	return ret;
 }
 
+int net_recv_data_batch(struct net_if *iface, struct net_pkt **pkts, size_t count)
+{
+	sys_slist_t batch[MAX(NET_TC_RX_COUNT, 1)];
+#if defined(CONFIG_NET_DSA) && !defined(CONFIG_NET_DSA_DEPRECATED)
+	struct ethernet_context *eth_ctx;
+#endif
+
+	if (!pkts || !iface) {
+		return -EINVAL;
+	}
+
+	if (!net_if_flag_is_set(iface, NET_IF_UP)) {
+		return -ENETDOWN;
+	}
+
+#if defined(CONFIG_NET_DSA) && !defined(CONFIG_NET_DSA_DEPRECATED)
+	/* DSA may redirect each packet to a different user interface */
+	eth_ctx = net_if_l2_data(iface);
+	if (eth_ctx != NULL && (eth_ctx->dsa_port == DSA_CONDUIT_PORT)) {
+		for (size_t i = 0; i < count; i++) {
+			if (net_recv_data(iface, pkts[i]) < 0 && pkts[i] != NULL) {
+				net_pkt_unref(pkts[i]);
+			}
+		}
+
+		return 0;
+	}
+#endif
+
+	for (int tc = 0; tc < ARRAY_SIZE(batch); tc++) {
+		sys_slist_init(&batch[tc]);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct net_pkt *pkt = pkts[i];
+		uint8_t prio;
+		uint8_t tc;
+		size_t len;
+
+		if (!pkt) {
+			continue;
+		}
+
+		if (net_pkt_is_empty(pkt)) {
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+		net_pkt_set_overwrite(pkt, true);
+		net_pkt_cursor_init(pkt);
+
+		if (IS_ENABLED(CONFIG_NET_ROUTING)) {
+			net_pkt_set_orig_iface(pkt, iface);
+		}
+
+		net_pkt_set_iface(pkt, iface);
+
+		if (!net_pkt_filter_recv_ok(pkt)) {
+			net_stats_update_filter_rx_drop(iface);
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+		len = net_pkt_get_len(pkt);
+		prio = net_pkt_priority(pkt);
+		tc = net_rx_priority2tc(prio);
+
+		if (net_tc_rx_is_immediate(tc, prio)) {
+			net_process_rx_packet(pkt);
+		} else if (net_tc_rx_batch_add(tc, pkt, &batch[tc]) != NET_OK) {
+			net_pkt_unref(pkt);
+			net_stats_update_tc_recv_dropped(iface, tc);
+			continue;
+		}
+
+		net_stats_update_tc_recv_pkt(iface, tc);
+		net_stats_update_tc_recv_bytes(iface, tc, len);
+		net_stats_update_tc_recv_priority(iface, tc, prio);
+	}
+
+	for (int tc = 0; tc < ARRAY_SIZE(batch); tc++) {
+		net_tc_rx_batch_submit(tc, &batch[tc]);
+	}
+
+	return 0;
+}
+
 static inline void l3_init(void)
 {
 	net_pmtu_init();
@@ -645,12 +732,23 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 
 	return -ENOTSUP;
 }
+
+int net_recv_data_batch(struct net_if *iface, struct net_pkt **pkts, size_t count)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkts);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
 #endif /* CONFIG_NET_NATIVE */
 
 static void init_rx_queues(void)
 {
 	net_tc_rx_init();
 
+	net_rx_poll_queue_init();
+
 	/* Starting TX side. The ordering is important here and the TX
 	 * can only be started when RX side is ready to receive packets.
 	 */
@@ -275,6 +275,7 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 						    pkt_priority,
 						    create_time,
 						    end_tick);
+			net_stats_hist_tx_time(pkt_priority, create_time, end_tick);
 
 			SYS_PORT_TRACING_FUNC(net, tx_time, pkt, end_tick);
 
@@ -287,6 +288,7 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 				net_stats_update_tc_tx_time_detail(
 					iface, pkt_priority,
 					net_pkt_stats_tick(pkt));
+				net_stats_hist_tx_time_detail(net_pkt_stats_tick(pkt));
 
 				/* For TCP connections, we might keep the pkt
 				 * longer so that we can resend it if needed.
@@ -1997,6 +1997,63 @@ int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length)
 	return net_pkt_cursor_operate(pkt, (void *)data, length, true, true);
 }
 
+#if defined(CONFIG_NET_UDP_TX_CHECKSUM_COPY)
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length)
+{
+	struct net_pkt_cursor *c_op = &pkt->cursor;
+	bool overwrite = net_pkt_is_being_overwritten(pkt);
+	const uint8_t *src = data;
+
+	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
+
+	pkt->chksum_payload_valid = 1U;
+
+	while ((c_op->buf != NULL) && (length > 0U)) {
+		uint32_t sum;
+		size_t d_len, len;
+
+		pkt_cursor_advance(pkt, !overwrite);
+		if (c_op->buf == NULL) {
+			break;
+		}
+
+		d_len = overwrite ? c_op->buf->len : net_buf_max_len(c_op->buf);
+		d_len -= c_op->pos - c_op->buf->data;
+		if (d_len == 0U) {
+			break;
+		}
+
+		len = MIN(length, d_len);
+
+		sum = calc_chksum_copy(0U, c_op->pos, src, len);
+		if (pkt->chksum_payload_odd) {
+			/* This part starts at an odd offset of the summed data */
+			sum = BSWAP_16(sum);
+		}
+
+		sum += pkt->chksum_payload;
+		pkt->chksum_payload = (sum & 0xffff) + (sum >> 16);
+		pkt->chksum_payload_odd ^= len & 1U;
+
+		if (!overwrite) {
+			net_buf_add(c_op->buf, len);
+		}
+
+		pkt_cursor_update(pkt, len, true);
+
+		src += len;
+		length -= len;
+	}
+
+	if (length > 0U) {
+		NET_DBG("Still some length to go %zu", length);
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_UDP_TX_CHECKSUM_COPY */
+
 int net_pkt_copy(struct net_pkt *pkt_dst,
 		 struct net_pkt *pkt_src,
 		 size_t length)
@@ -2088,6 +2145,7 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_ip_reassembled(pkt, net_pkt_is_ip_reassembled(pkt));
 	net_pkt_set_cooked_mode(clone_pkt, net_pkt_is_cooked_mode(pkt));
 	net_pkt_set_ipv4_pmtu(clone_pkt, net_pkt_ipv4_pmtu(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
 	net_pkt_set_ll_proto_type(clone_pkt, net_pkt_ll_proto_type(pkt));
@@ -155,6 +155,12 @@ extern void dns_dispatcher_init(void);
 static inline void dns_dispatcher_init(void) { }
 #endif
 
+#if defined(CONFIG_NET_RX_POLL)
+extern void net_rx_poll_queue_init(void);
+#else
+static inline void net_rx_poll_queue_init(void) { }
+#endif /* CONFIG_NET_RX_POLL */
+
 #if defined(CONFIG_MDNS_RESPONDER)
 extern void mdns_init_responder(void);
 #else
@@ -209,6 +215,9 @@ static inline void net_tc_rx_init(void) { }
 enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 					       k_timeout_t timeout);
 extern enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+extern enum net_verdict net_tc_rx_batch_add(uint8_t tc, struct net_pkt *pkt,
+					    sys_slist_t *batch);
+extern void net_tc_rx_batch_submit(uint8_t tc, sys_slist_t *batch);
 extern int net_tc_tx_thread_priority(int tc);
 extern int net_tc_rx_thread_priority(int tc);
 static inline bool net_tc_tx_is_immediate(int tc, int prio)
@@ -302,7 +311,11 @@ extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
+extern uint16_t calc_chksum_copy(uint16_t sum_in, uint8_t *dst, const uint8_t *src, size_t len);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
+extern uint16_t net_calc_chksum_partial(struct net_pkt *pkt, uint8_t proto,
+					const uint8_t *hdr, size_t hdr_len,
+					uint16_t payload_sum);
 
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
@@ -364,6 +377,18 @@ static inline uint16_t net_calc_chksum_udp(struct net_pkt *pkt)
 	return chksum == 0U ? 0xffff : chksum;
 }
 
+/* Checksum of a UDP packet whose payload was summed by net_pkt_write_chksum() */
+static inline uint16_t net_calc_chksum_udp_hdr(struct net_pkt *pkt,
+					       const struct net_udp_hdr *hdr,
+					       uint16_t payload_sum)
+{
+	uint16_t chksum = net_calc_chksum_partial(pkt, NET_IPPROTO_UDP,
+						  (const uint8_t *)hdr, sizeof(*hdr),
+						  payload_sum);
+
+	return chksum == 0U ? 0xffff : chksum;
+}
+
 static inline uint16_t net_calc_verify_chksum_udp(struct net_pkt *pkt)
 {
 	return net_calc_chksum(pkt, NET_IPPROTO_UDP);
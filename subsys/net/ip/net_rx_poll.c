@@ -0,0 +1,56 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+
+#include "net_private.h"
+
+#if defined(CONFIG_NET_TC_THREAD_COOPERATIVE)
+#define THREAD_PRIORITY K_PRIO_COOP(CONFIG_NET_RX_POLL_THREAD_PRIO)
+#else
+#define THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_NET_RX_POLL_THREAD_PRIO)
+#endif
+
+static struct k_work_q rx_poll_work_q;
+static K_KERNEL_STACK_DEFINE(rx_poll_stack, CONFIG_NET_RX_POLL_STACK_SIZE);
+
+static void rx_poll_handler(struct k_work *work)
+{
+	struct net_rx_poll *poll = CONTAINER_OF(work, struct net_rx_poll, work);
+
+	/* The whole budget was used, so more packets are likely pending.
+	 * Queue the next round behind the other devices waiting to be polled.
+	 */
+	if (poll->cb(poll, poll->budget) >= poll->budget) {
+		(void)k_work_submit_to_queue(&rx_poll_work_q, &poll->work);
+	}
+}
+
+void net_rx_poll_init(struct net_rx_poll *poll, net_rx_poll_cb_t cb, int budget)
+{
+	__ASSERT_NO_MSG(cb != NULL && budget > 0);
+
+	k_work_init(&poll->work, rx_poll_handler);
+	poll->cb = cb;
+	poll->budget = budget;
+}
+
+int net_rx_poll_schedule(struct net_rx_poll *poll)
+{
+	return k_work_submit_to_queue(&rx_poll_work_q, &poll->work);
+}
+
+void net_rx_poll_queue_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "net_rx_poll",
+	};
+
+	k_work_queue_start(&rx_poll_work_q, rx_poll_stack,
+			   K_KERNEL_STACK_SIZEOF(rx_poll_stack), THREAD_PRIORITY,
+			   &cfg);
+}
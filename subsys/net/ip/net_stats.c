@@ -23,6 +23,7 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
 #include <zephyr/net/prometheus/gauge.h>
 #include <zephyr/net/prometheus/histogram.h>
 #include <zephyr/net/prometheus/summary.h>
+#include <zephyr/sys/hist.h>
 
 #include "net_stats.h"
 #include "net_private.h"
@@ -34,6 +35,97 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
  */
 struct net_stats net_stats = { 0 };
 
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST)
+
+/* The histograms are shared by all the network interfaces, and named
+ * net_<rx|tx>_time_<tc|stage><index> so that "net stats" can find them.
+ */
+#define NET_STATS_HIST_DEFINE(_name, _desc, _key, _index)			\
+	SYS_HIST_DEFINE(_name##_index, NET_STATS_HIST_SUB_BITS,		\
+			NET_STATS_HIST_MAX_BITS);				\
+	IF_ENABLED(CONFIG_PROMETHEUS_SYS_HIST,				\
+		   (PROMETHEUS_SYS_HIST_DEFINE(_name##_index##_us, _desc,	\
+			({ .key = _key, .value = STRINGIFY(_index) }),		\
+			_name##_index)))
+
+#define NET_STATS_HIST_PTR(_index, _name) &_name##_index
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS)
+#define NET_TX_TIME_TC_HIST(i, _)						\
+	NET_STATS_HIST_DEFINE(net_tx_time_tc, "Packet TX time in us", "tc", i)
+
+LISTIFY(NET_TC_TX_STATS_COUNT, NET_TX_TIME_TC_HIST, (;));
+
+static struct sys_hist *const tx_time_hist[] = {
+	LISTIFY(NET_TC_TX_STATS_COUNT, NET_STATS_HIST_PTR, (,), net_tx_time_tc)
+};
+
+void net_stats_hist_tx_time(uint8_t priority, uint32_t start_time, uint32_t end_time)
+{
+	int tc = net_tx_priority2tc(priority);
+
+	sys_hist_record(tx_time_hist[tc], k_cyc_to_us_floor32(end_time - start_time));
+}
+#endif /* CONFIG_NET_PKT_TXTIME_STATS */
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+#define NET_TX_TIME_STAGE_HIST(i, _)						\
+	NET_STATS_HIST_DEFINE(net_tx_time_stage, "Packet TX stage time in us", \
+			      "stage", i)
+
+LISTIFY(NET_PKT_DETAIL_STATS_COUNT, NET_TX_TIME_STAGE_HIST, (;));
+
+static struct sys_hist *const tx_time_stage_hist[] = {
+	LISTIFY(NET_PKT_DETAIL_STATS_COUNT, NET_STATS_HIST_PTR, (,), net_tx_time_stage)
+};
+
+void net_stats_hist_tx_time_detail(const uint32_t detail_stat[])
+{
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		sys_hist_record(tx_time_stage_hist[i], k_cyc_to_us_floor32(detail_stat[i]));
+	}
+}
+#endif /* CONFIG_NET_PKT_TXTIME_STATS_DETAIL */
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS)
+#define NET_RX_TIME_TC_HIST(i, _)						\
+	NET_STATS_HIST_DEFINE(net_rx_time_tc, "Packet RX time in us", "tc", i)
+
+LISTIFY(NET_TC_RX_STATS_COUNT, NET_RX_TIME_TC_HIST, (;));
+
+static struct sys_hist *const rx_time_hist[] = {
+	LISTIFY(NET_TC_RX_STATS_COUNT, NET_STATS_HIST_PTR, (,), net_rx_time_tc)
+};
+
+void net_stats_hist_rx_time(uint8_t priority, uint32_t start_time, uint32_t end_time)
+{
+	int tc = net_rx_priority2tc(priority);
+
+	sys_hist_record(rx_time_hist[tc], k_cyc_to_us_floor32(end_time - start_time));
+}
+#endif /* CONFIG_NET_PKT_RXTIME_STATS */
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+#define NET_RX_TIME_STAGE_HIST(i, _)						\
+	NET_STATS_HIST_DEFINE(net_rx_time_stage, "Packet RX stage time in us", \
+			      "stage", i)
+
+LISTIFY(NET_PKT_DETAIL_STATS_COUNT, NET_RX_TIME_STAGE_HIST, (;));
+
+static struct sys_hist *const rx_time_stage_hist[] = {
+	LISTIFY(NET_PKT_DETAIL_STATS_COUNT, NET_STATS_HIST_PTR, (,), net_rx_time_stage)
+};
+
+void net_stats_hist_rx_time_detail(const uint32_t detail_stat[])
+{
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		sys_hist_record(rx_time_stage_hist[i], k_cyc_to_us_floor32(detail_stat[i]));
+	}
+}
+#endif /* CONFIG_NET_PKT_RXTIME_STATS_DETAIL */
+
+#endif /* CONFIG_NET_PKT_TIME_STATS_HIST */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT)
 
 #define PRINT_STATISTICS_INTERVAL (30 * MSEC_PER_SEC)
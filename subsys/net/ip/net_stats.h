@@ -471,6 +471,36 @@ static inline void net_stats_update_tx_time(struct net_if *iface,
 #define net_stats_update_tx_time(iface, start_time, end_time)
 #endif /* NET_PKT_TXTIME_STATS && NET_STATISTICS */
 
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST)
+/* Layout of the RX/TX time histograms, in microseconds up to about 1 s */
+#define NET_STATS_HIST_SUB_BITS 2
+#define NET_STATS_HIST_MAX_BITS 20
+#endif
+
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST) && defined(CONFIG_NET_PKT_TXTIME_STATS)
+void net_stats_hist_tx_time(uint8_t priority, uint32_t start_time, uint32_t end_time);
+#else
+#define net_stats_hist_tx_time(priority, start_time, end_time)
+#endif
+
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST) && defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+void net_stats_hist_tx_time_detail(const uint32_t detail_stat[]);
+#else
+#define net_stats_hist_tx_time_detail(detail_stat)
+#endif
+
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST) && defined(CONFIG_NET_PKT_RXTIME_STATS)
+void net_stats_hist_rx_time(uint8_t priority, uint32_t start_time, uint32_t end_time);
+#else
+#define net_stats_hist_rx_time(priority, start_time, end_time)
+#endif
+
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST) && defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+void net_stats_hist_rx_time_detail(const uint32_t detail_stat[]);
+#else
+#define net_stats_hist_rx_time_detail(detail_stat)
+#endif
+
 #if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
 static inline void net_stats_update_tx_time_detail(struct net_if *iface,
 						   uint32_t detail_stat[])
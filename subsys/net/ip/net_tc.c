@@ -13,6 +13,8 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/hash_function.h>
 
 #include "net_private.h"
 #include "net_stats.h"
@@ -60,6 +62,118 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
 #endif
 
+#if defined(CONFIG_NET_RPS)
+/* Stacks for the receive packet steering queues */
+K_KERNEL_STACK_ARRAY_DEFINE(rps_stack, CONFIG_NET_RPS_QUEUES,
+			    CONFIG_NET_RX_STACK_SIZE);
+
+static struct net_traffic_class rps_queues[CONFIG_NET_RPS_QUEUES];
+
+/* Ethernet, VLAN, IPv6 and port headers */
+#define RPS_HDR_LEN (sizeof(struct net_eth_vlan_hdr) + \
+		     sizeof(struct net_ipv6_hdr) + 2 * sizeof(uint16_t))
+
+/* Hash the addresses and ports of a received Ethernet frame. Returns 0 if
+ * the frame is not IP, so that it is not steered.
+ */
+static uint32_t rps_flow_hash(struct net_pkt *pkt)
+{
+	struct net_pkt_cursor backup;
+	uint8_t hdr[RPS_HDR_LEN];
+	uint8_t key[2 * sizeof(struct net_in6_addr) + 2 * sizeof(uint16_t)];
+	size_t len = MIN(net_pkt_get_len(pkt), sizeof(hdr));
+	size_t key_len = 0;
+	size_t off = offsetof(struct net_eth_hdr, type);
+	uint16_t type;
+	uint8_t proto;
+	size_t l4;
+	int ret;
+
+	if (net_if_l2(net_pkt_iface(pkt)) != &NET_L2_GET_NAME(ETHERNET) ||
+	    net_pkt_is_l2_processed(pkt)) {
+		return 0;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+	ret = net_pkt_read(pkt, hdr, len);
+	net_pkt_cursor_restore(pkt, &backup);
+
+	if (ret < 0 || len < sizeof(struct net_eth_hdr)) {
+		return 0;
+	}
+
+	type = sys_get_be16(&hdr[off]);
+	off = sizeof(struct net_eth_hdr);
+
+	if (type == NET_ETH_PTYPE_VLAN) {
+		if (len < sizeof(struct net_eth_vlan_hdr)) {
+			return 0;
+		}
+
+		type = sys_get_be16(&hdr[offsetof(struct net_eth_vlan_hdr, type)]);
+		off = sizeof(struct net_eth_vlan_hdr);
+	}
+
+	if (type == NET_ETH_PTYPE_IP && len >= off + sizeof(struct net_ipv4_hdr)) {
+		struct net_ipv4_hdr *ip_hdr = (struct net_ipv4_hdr *)&hdr[off];
+
+		key_len = 2 * sizeof(struct net_in_addr);
+		memcpy(key, ip_hdr->src, key_len);
+		proto = ip_hdr->proto;
+		l4 = off + (ip_hdr->vhl & 0x0f) * 4U;
+
+		/* Fragments are hashed on the addresses only, as just the
+		 * first one carries the ports.
+		 */
+		if ((sys_get_be16(ip_hdr->offset) &
+		     (NET_IPV4_FRAGH_OFFSET_MASK | NET_IPV4_MORE_FRAG_MASK)) != 0U) {
+			proto = 0U;
+		}
+	} else if (type == NET_ETH_PTYPE_IPV6 && len >= off + sizeof(struct net_ipv6_hdr)) {
+		struct net_ipv6_hdr *ip_hdr = (struct net_ipv6_hdr *)&hdr[off];
+
+		key_len = 2 * sizeof(struct net_in6_addr);
+		memcpy(key, ip_hdr->src, key_len);
+		proto = ip_hdr->nexthdr;
+		l4 = off + sizeof(struct net_ipv6_hdr);
+	} else {
+		return 0;
+	}
+
+	if ((proto == NET_IPPROTO_TCP || proto == NET_IPPROTO_UDP) &&
+	    len >= l4 + 2 * sizeof(uint16_t)) {
+		memcpy(&key[key_len], &hdr[l4], 2 * sizeof(uint16_t));
+		key_len += 2 * sizeof(uint16_t);
+	}
+
+	return sys_hash32_murmur3(key, key_len) | 1U;
+}
+
+/* Queue the packet to the steering queue of its flow. Only the lowest
+ * traffic class is steered, higher classes keep their own threads.
+ */
+static bool rps_submit(uint8_t tc, struct net_pkt *pkt)
+{
+	uint32_t hash;
+
+	if (tc != 0U || !net_if_flag_is_set(net_pkt_iface(pkt), NET_IF_RPS)) {
+		return false;
+	}
+
+	hash = rps_flow_hash(pkt);
+	if (hash == 0U) {
+		return false;
+	}
+
+	k_fifo_put(&rps_queues[hash % CONFIG_NET_RPS_QUEUES].fifo, pkt);
+
+	return true;
+}
+#else
+#define rps_submit(...) false
+#endif /* CONFIG_NET_RPS */
+
 enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 					       k_timeout_t timeout)
 {
@@ -89,6 +203,10 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
+	if (rps_submit(tc, pkt)) {
+		return NET_OK;
+	}
+
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	while (k_sem_take(&rx_classes[tc].fifo_slot, K_NO_WAIT) != 0) {
 		if (k_is_in_isr() || retry_cnt == 0) {
@@ -112,6 +230,46 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+enum net_verdict net_tc_rx_batch_add(uint8_t tc, struct net_pkt *pkt,
+				     sys_slist_t *batch)
+{
+#if NET_TC_RX_COUNT > 0
+	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
+
+	if (rps_submit(tc, pkt)) {
+		return NET_OK;
+	}
+
+#if NET_TC_RX_EFFECTIVE_COUNT > 1
+	/* Batches come from the driver poll context, do not wait for a slot */
+	if (k_sem_take(&rx_classes[tc].fifo_slot, K_NO_WAIT) != 0) {
+		return NET_DROP;
+	}
+#endif
+
+	/* The fifo word at the start of net_pkt doubles as the list node */
+	sys_slist_append(batch, (sys_snode_t *)&pkt->fifo);
+	return NET_OK;
+#else
+	ARG_UNUSED(tc);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(batch);
+	return NET_DROP;
+#endif
+}
+
+void net_tc_rx_batch_submit(uint8_t tc, sys_slist_t *batch)
+{
+#if NET_TC_RX_COUNT > 0
+	if (!sys_slist_is_empty(batch)) {
+		(void)k_fifo_put_slist(&rx_classes[tc].fifo, batch);
+	}
+#else
+	ARG_UNUSED(tc);
+	ARG_UNUSED(batch);
+#endif
+}
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -280,6 +438,68 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 }
 #endif
 
+#if defined(CONFIG_NET_RPS)
+static void rps_handler(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct k_fifo *fifo = p1;
+	struct net_pkt *pkt;
+
+	while (1) {
+		pkt = k_fifo_get(fifo, K_FOREVER);
+		if (pkt == NULL) {
+			continue;
+		}
+
+		net_process_rx_packet(pkt);
+	}
+}
+
+/* Start one steering queue per CPU, each handled by a thread pinned to it */
+static void rps_init(void)
+{
+	int priority = net_tc_rx_thread_priority(0);
+
+	for (int i = 0; i < CONFIG_NET_RPS_QUEUES; i++) {
+		int cpu = i % arch_num_cpus();
+		k_tid_t tid;
+
+		NET_DBG("[%d] Starting RPS handler %p stack size %zd prio %d cpu %d", i,
+			&rps_queues[i].handler,
+			K_KERNEL_STACK_SIZEOF(rps_stack[i]),
+			priority, cpu);
+
+		k_fifo_init(&rps_queues[i].fifo);
+
+		tid = k_thread_create(&rps_queues[i].handler, rps_stack[i],
+				      K_KERNEL_STACK_SIZEOF(rps_stack[i]),
+				      rps_handler, &rps_queues[i].fifo, NULL, NULL,
+				      priority, 0, K_FOREVER);
+		if (!tid) {
+			NET_ERR("Cannot create RPS handler thread %d", i);
+			continue;
+		}
+
+		if (k_thread_cpu_pin(tid, cpu) < 0) {
+			NET_WARN("Cannot pin RPS handler thread %d to CPU %d", i, cpu);
+		}
+
+		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
+			char name[sizeof("rps_q[yy]")];
+
+			snprintk(name, sizeof(name), "rps_q[%d]", i);
+			k_thread_name_set(tid, name);
+		}
+
+		k_thread_start(tid);
+	}
+}
+#else
+static inline void rps_init(void) { }
+#endif /* CONFIG_NET_RPS */
+
 #if NET_TC_TX_COUNT > 0
 static void tc_tx_handler(void *p1, void *p2, void *p3)
 {
@@ -423,5 +643,7 @@ void net_tc_rx_init(void)
 
 		k_thread_start(tid);
 	}
+
+	rps_init();
 #endif
 }
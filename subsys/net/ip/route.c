@@ -16,6 +16,8 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 #include <limits.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/math_extras.h>
 
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_core.h>
@@ -125,6 +127,300 @@ static inline struct net_route_entry *net_route_data(struct net_nbr *nbr)
 	return (struct net_route_entry *)nbr->data;
 }
 
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+/*
+ * Path compressed binary trie of the route prefixes. A node either holds
+ * the routes of one prefix, or only branches into two children. Each
+ * route adds at most one prefix node and one branching node.
+ */
+struct route_trie_node {
+	struct route_trie_node *parent;
+	struct route_trie_node *child[2];
+
+	/** Routes with exactly this prefix, on different interfaces */
+	sys_slist_t routes;
+
+	struct net_in6_addr prefix;
+	uint8_t prefix_len;
+	bool is_used;
+};
+
+static struct route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node *route_trie_root;
+
+static inline int route_trie_bit(const struct net_in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8] >> (7 - (bit % 8))) & 1;
+}
+
+/* Number of leading bits that the addresses have in common, up to max */
+static uint8_t route_trie_common_len(const struct net_in6_addr *addr1,
+				     const struct net_in6_addr *addr2,
+				     uint8_t max)
+{
+	uint8_t len = 0U;
+
+	for (int i = 0; i < sizeof(addr1->s6_addr) && len < max; i++) {
+		uint8_t diff = addr1->s6_addr[i] ^ addr2->s6_addr[i];
+
+		if (diff != 0U) {
+			len += u32_count_leading_zeros(diff) - 24;
+			break;
+		}
+
+		len += 8U;
+	}
+
+	return MIN(len, max);
+}
+
+static struct route_trie_node *route_trie_node_new(const struct net_in6_addr *prefix,
+						   uint8_t prefix_len,
+						   struct route_trie_node *parent)
+{
+	ARRAY_FOR_EACH_PTR(route_trie_nodes, node) {
+		if (node->is_used) {
+			continue;
+		}
+
+		memset(node, 0, sizeof(*node));
+		node->is_used = true;
+		node->parent = parent;
+		node->prefix_len = prefix_len;
+		net_ipaddr_copy(&node->prefix, prefix);
+		sys_slist_init(&node->routes);
+
+		return node;
+	}
+
+	NET_ASSERT(false, "Out of route trie nodes");
+
+	return NULL;
+}
+
+static struct route_trie_node **route_trie_link(struct route_trie_node *node)
+{
+	if (node->parent == NULL) {
+		return &route_trie_root;
+	}
+
+	return &node->parent->child[node->parent->child[1] == node];
+}
+
+static void route_trie_insert(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node *parent = NULL;
+	struct route_trie_node *node, *branch;
+	uint8_t len = route->prefix_len;
+	uint8_t common;
+
+	while (*link != NULL) {
+		node = *link;
+		common = route_trie_common_len(&node->prefix, &route->addr,
+					       MIN(node->prefix_len, len));
+
+		if (common < node->prefix_len) {
+			/* The prefixes diverge within this node, put a new
+			 * node at the common part in between.
+			 */
+			branch = route_trie_node_new(&route->addr, common, parent);
+			if (branch == NULL) {
+				return;
+			}
+
+			*link = branch;
+			node->parent = branch;
+			branch->child[route_trie_bit(&node->prefix, common)] = node;
+
+			if (common == len) {
+				node = branch;
+				goto add;
+			}
+
+			parent = branch;
+			link = &branch->child[route_trie_bit(&route->addr, common)];
+			break;
+		}
+
+		if (node->prefix_len == len) {
+			goto add;
+		}
+
+		parent = node;
+		link = &node->child[route_trie_bit(&route->addr, node->prefix_len)];
+	}
+
+	node = route_trie_node_new(&route->addr, len, parent);
+	if (node == NULL) {
+		return;
+	}
+
+	*link = node;
+
+add:
+	sys_slist_append(&node->routes, &route->trie_node);
+}
+
+static struct route_trie_node *route_trie_find(const struct net_in6_addr *prefix,
+					       uint8_t prefix_len)
+{
+	struct route_trie_node *node = route_trie_root;
+
+	while (node != NULL && node->prefix_len <= prefix_len) {
+		if (route_trie_common_len(&node->prefix, prefix,
+					  node->prefix_len) < node->prefix_len) {
+			break;
+		}
+
+		if (node->prefix_len == prefix_len) {
+			return node;
+		}
+
+		node = node->child[route_trie_bit(prefix, node->prefix_len)];
+	}
+
+	return NULL;
+}
+
+static void route_trie_remove(struct net_route_entry *route)
+{
+	struct route_trie_node *node, *child, *parent;
+
+	node = route_trie_find(&route->addr, route->prefix_len);
+	if (node == NULL ||
+	    !sys_slist_find_and_remove(&node->routes, &route->trie_node)) {
+		return;
+	}
+
+	/* Drop the nodes that neither hold routes nor branch anymore */
+	while (node != NULL && sys_slist_is_empty(&node->routes) &&
+	       (node->child[0] == NULL || node->child[1] == NULL)) {
+		child = node->child[0] != NULL ? node->child[0] : node->child[1];
+		parent = node->parent;
+
+		*route_trie_link(node) = child;
+		if (child != NULL) {
+			child->parent = parent;
+		}
+
+		node->is_used = false;
+
+		/* Only a removed leaf can leave a parent with one child */
+		node = child == NULL ? parent : NULL;
+	}
+}
+
+static struct net_route_entry *route_trie_lookup(struct net_if *iface,
+						 struct net_in6_addr *dst)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *route, *found = NULL;
+
+	while (node != NULL &&
+	       net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr, node->prefix_len)) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, trie_node) {
+			if (iface == NULL || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[route_trie_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_LPM_TRIE */
+
+#if defined(CONFIG_NET_ROUTE_DST_CACHE)
+/*
+ * Remembers the result of net_route_get_info() and of the next hop
+ * neighbor lookup of net_route_packet() for recently forwarded
+ * destinations. Any change to the routes or neighbors invalidates all
+ * the entries by bumping the generation.
+ */
+struct route_dst_cache_entry {
+	struct net_in6_addr dst;
+
+	/** Interface the lookup was restricted to, NULL for any */
+	struct net_if *iface;
+
+	/** Route to the destination, NULL if it is a neighbor */
+	struct net_route_entry *route;
+
+	/** Neighbor entry of the next hop */
+	struct net_nbr *nbr;
+
+	uint32_t gen;
+};
+
+static struct route_dst_cache_entry route_dst_cache[CONFIG_NET_ROUTE_DST_CACHE_SIZE];
+static uint32_t route_dst_cache_gen = 1U;
+
+void net_route_dst_cache_flush(void)
+{
+	net_ipv6_nbr_lock();
+
+	if (++route_dst_cache_gen == 0U) {
+		/* Generation 0 marks unused entries */
+		memset(route_dst_cache, 0, sizeof(route_dst_cache));
+		route_dst_cache_gen = 1U;
+	}
+
+	net_ipv6_nbr_unlock();
+}
+
+static struct route_dst_cache_entry *route_dst_cache_slot(const struct net_in6_addr *dst)
+{
+	uint32_t hash = sys_get_be32(&dst->s6_addr[8]) ^ sys_get_be32(&dst->s6_addr[12]);
+
+	return &route_dst_cache[hash % CONFIG_NET_ROUTE_DST_CACHE_SIZE];
+}
+
+static struct route_dst_cache_entry *route_dst_cache_get(struct net_if *iface,
+							  const struct net_in6_addr *dst)
+{
+	struct route_dst_cache_entry *entry = route_dst_cache_slot(dst);
+
+	if (entry->gen != route_dst_cache_gen || entry->iface != iface ||
+	    !net_ipv6_addr_cmp(&entry->dst, dst)) {
+		return NULL;
+	}
+
+	return entry;
+}
+
+static void route_dst_cache_add(struct net_if *iface, const struct net_in6_addr *dst,
+				struct net_route_entry *route, struct net_nbr *nbr)
+{
+	struct route_dst_cache_entry *entry = route_dst_cache_slot(dst);
+
+	net_ipaddr_copy(&entry->dst, dst);
+	entry->iface = iface;
+	entry->route = route;
+	entry->nbr = nbr;
+	entry->gen = route_dst_cache_gen;
+}
+
+static struct net_nbr *route_nexthop_nbr(struct net_route_entry *route)
+{
+	struct net_route_nexthop *nexthop_route;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&route->nexthop, nexthop_route, node) {
+		if (nexthop_route->nbr != NULL) {
+			return nexthop_route->nbr;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_NET_ROUTE_DST_CACHE */
+
 struct net_nbr *net_route_get_nbr(struct net_route_entry *route)
 {
 	struct net_nbr *ret = NULL;
@@ -263,19 +559,28 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 /* Route was accessed, so place it in front of the routes list */
 static inline void update_route_access(struct net_route_entry *route)
 {
+	if (sys_slist_peek_head(&routes) == &route->node) {
+		return;
+	}
+
 	sys_slist_find_and_remove(&routes, &route->node);
 	sys_slist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct net_in6_addr *dst)
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+static struct net_route_entry *route_lookup(struct net_if *iface,
+					    struct net_in6_addr *dst)
+{
+	return route_trie_lookup(iface, dst);
+}
+#else
+static struct net_route_entry *route_lookup(struct net_if *iface,
+					    struct net_in6_addr *dst)
 {
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
 
-	net_ipv6_nbr_lock();
-
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -298,6 +603,18 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		}
 	}
 
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_LPM_TRIE */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct net_in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	net_ipv6_nbr_lock();
+
+	found = route_lookup(iface, dst);
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -446,6 +763,11 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	sys_slist_prepend(&routes, &route->node);
 
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+	route_trie_insert(route);
+#endif
+	net_route_dst_cache_flush();
+
 	tmp = nbr_nexthop_get(iface, nexthop);
 
 	NET_ASSERT(tmp == nbr_nexthop);
@@ -596,6 +918,11 @@ int net_route_del(struct net_route_entry *route)
 
 	net_route_info("Deleted", route, &route->addr);
 
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+	route_trie_remove(route);
+#endif
+	net_route_dst_cache_flush();
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&route->nexthop, nexthop_route, node) {
 		if (!nexthop_route->nbr) {
 			continue;
@@ -989,16 +1316,39 @@ bool net_route_get_info(struct net_if *iface,
 			struct net_in6_addr **nexthop)
 {
 	struct net_if_router *router;
+	struct net_nbr *nbr;
 	bool ret = false;
 
 	net_ipv6_nbr_lock();
 
+#if defined(CONFIG_NET_ROUTE_DST_CACHE)
+	struct route_dst_cache_entry *entry = route_dst_cache_get(iface, dst);
+
+	if (entry != NULL) {
+		*route = entry->route;
+
+		if (entry->route != NULL) {
+			*nexthop = &net_ipv6_nbr_data(entry->nbr)->addr;
+			update_route_access(entry->route);
+		} else {
+			*nexthop = dst;
+		}
+
+		ret = true;
+		goto exit;
+	}
+#endif
+
 	/* Search in neighbor table first, if not search in routing table. */
-	if (net_ipv6_nbr_lookup(iface, dst)) {
+	nbr = net_ipv6_nbr_lookup(iface, dst);
+	if (nbr) {
 		/* Found nexthop, no need to look into routing table. */
 		*route = NULL;
 		*nexthop = dst;
 
+#if defined(CONFIG_NET_ROUTE_DST_CACHE)
+		route_dst_cache_add(iface, dst, NULL, nbr);
+#endif
 		ret = true;
 		goto exit;
 	}
@@ -1010,11 +1360,18 @@ bool net_route_get_info(struct net_if *iface,
 			goto exit;
 		}
 
+#if defined(CONFIG_NET_ROUTE_DST_CACHE)
+		nbr = route_nexthop_nbr(*route);
+		if (nbr != NULL) {
+			route_dst_cache_add(iface, dst, *route, nbr);
+		}
+#endif
 		ret = true;
 		goto exit;
 	} else {
 		/* No specific route to this host, use the default
-		 * route instead.
+		 * route instead. This is not cached, the router list is
+		 * maintained by the interface and can change at any time.
 		 */
 		router = net_if_ipv6_router_find_default(NULL, dst);
 		if (!router) {
@@ -1061,7 +1418,20 @@ int net_route_packet(struct net_pkt *pkt, struct net_in6_addr *nexthop)
 
 	net_ipv6_nbr_lock();
 
+#if defined(CONFIG_NET_ROUTE_DST_CACHE)
+	struct route_dst_cache_entry *entry = route_dst_cache_get(NULL, nexthop);
+
+	if (entry != NULL && entry->route == NULL) {
+		nbr = entry->nbr;
+	} else {
+		nbr = net_ipv6_nbr_lookup(NULL, nexthop);
+		if (nbr) {
+			route_dst_cache_add(NULL, nexthop, NULL, nbr);
+		}
+	}
+#else
 	nbr = net_ipv6_nbr_lookup(NULL, nexthop);
+#endif
 	if (!nbr) {
 		NET_DBG("Cannot find %s neighbor",
 			net_sprint_ipv6_addr(nexthop));
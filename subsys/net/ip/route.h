@@ -68,6 +68,11 @@ struct net_route_entry {
 
 	/** Is the route valid forever */
 	uint8_t is_infinite : 1;
+
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+	/** Node in the list of routes of the same prefix in the route trie. */
+	sys_snode_t trie_node;
+#endif
 };
 
 /* Route preference values, as defined in RFC 4191 */
@@ -319,6 +324,20 @@ bool net_route_get_info(struct net_if *iface,
 			struct net_route_entry **route,
 			struct net_in6_addr **nexthop);
 
+/**
+ * @brief Invalidate all the entries of the route destination cache.
+ *
+ * Must be called when a change to the routes or neighbors may change the
+ * result of net_route_get_info().
+ */
+#if defined(CONFIG_NET_ROUTE_DST_CACHE)
+void net_route_dst_cache_flush(void);
+#else
+static inline void net_route_dst_cache_flush(void)
+{
+}
+#endif
+
 /**
  * @brief Send the network packet to network via some intermediate host.
  *
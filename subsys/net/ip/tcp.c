@@ -65,10 +65,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -566,29 +562,149 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+static const struct tcp_ca_ops tcp_ca_new_reno = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+static const struct tcp_ca_ops *const tcp_ca_algorithms[] = {
+	&tcp_ca_new_reno,
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+	&tcp_ca_cubic,
+#endif
+#ifdef CONFIG_NET_TCP_CC_BBR
+	&tcp_ca_bbr,
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_CC_DEFAULT_CUBIC)
+#define TCP_CA_DEFAULT (&tcp_ca_cubic)
+#elif defined(CONFIG_NET_TCP_CC_DEFAULT_BBR)
+#define TCP_CA_DEFAULT (&tcp_ca_bbr)
+#else
+#define TCP_CA_DEFAULT (&tcp_ca_new_reno)
+#endif
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca.rtt_pending = false;
+	conn->ca.delivered = 0;
+	conn->ca_ops->init(conn);
+}
+
+/* Karn's algorithm, retransmitted data gives no round trip time sample */
+static void tcp_ca_rtt_cancel(struct tcp *conn)
+{
+	conn->ca.rtt_pending = false;
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	tcp_ca_rtt_cancel(conn);
+	conn->ca_ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	tcp_ca_rtt_cancel(conn);
+	conn->ca_ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->dup_ack(conn);
 }
 
+/* Called before conn->seq is advanced by acked_len */
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	uint32_t rtt;
+
+	conn->ca.delivered += acked_len;
+	conn->ca_ops->pkts_acked(conn, acked_len);
+
+	if (!conn->ca.rtt_pending ||
+	    net_tcp_seq_greater(conn->ca.rtt_seq, conn->seq + acked_len)) {
+		return;
+	}
+
+	conn->ca.rtt_pending = false;
+
+	if (conn->ca_ops->rtt_sample != NULL) {
+		rtt = MAX(k_uptime_get_32() - conn->ca.rtt_start, 1U);
+		conn->ca_ops->rtt_sample(conn, rtt,
+					 conn->ca.delivered - conn->ca.rtt_delivered);
+	}
+}
+
+/* Time the segment ending at seq_end, unless one is already timed */
+static void tcp_ca_data_sent(struct tcp *conn, uint32_t seq_end)
+{
+	if (conn->ca.rtt_pending) {
+		return;
+	}
+
+	conn->ca.rtt_pending = true;
+	conn->ca.rtt_seq = seq_end;
+	conn->ca.rtt_start = k_uptime_get_32();
+	conn->ca.rtt_delivered = conn->ca.delivered;
+}
+
+static void tcp_ca_param_copy(struct tcp *to, struct tcp *from)
+{
+	to->ca_ops = from->ca_ops;
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	const char *name = value;
+
+	if (value == NULL || len == 0) {
+		return -EINVAL;
+	}
+
+	len = strnlen(name, MIN(len, TCP_CA_NAME_MAX));
+
+	ARRAY_FOR_EACH(tcp_ca_algorithms, i) {
+		const struct tcp_ca_ops *ops = tcp_ca_algorithms[i];
+
+		if (strlen(ops->name) != len || strncmp(ops->name, name, len) != 0) {
+			continue;
+		}
+
+		if (ops != conn->ca_ops) {
+			conn->ca_ops = ops;
+
+			/* Restart an established connection from the initial
+			 * window of the new algorithm.
+			 */
+			if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+				tcp_ca_init(conn);
+			}
+		}
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, uint32_t *len)
+{
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
+
+	if (value == NULL || len == NULL || *len == 0) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, name_len);
+	memcpy(value, conn->ca_ops->name, *len);
+
+	return 0;
 }
 #else
 
@@ -602,8 +718,54 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static void tcp_ca_data_sent(struct tcp *conn, uint32_t seq_end) { }
+
+static void tcp_ca_param_copy(struct tcp *to, struct tcp *from) { }
+
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
 #endif
 
+#ifdef CONFIG_NET_TCP_PACING
+/* Returns true, and arms the pacing timer, if it is too early to send */
+static bool tcp_pacing_wait(struct tcp *conn)
+{
+	int64_t now = k_uptime_ticks();
+
+	if (conn->ca.pacing_next <= now) {
+		return false;
+	}
+
+	k_work_reschedule_for_queue(&tcp_work_q, &conn->pacing_timer,
+				    K_TICKS(conn->ca.pacing_next - now));
+
+	return true;
+}
+
+static void tcp_pacing_sent(struct tcp *conn, int len)
+{
+	uint32_t rate = 0;
+	int64_t now;
+
+	if (conn->ca_ops->pacing_rate != NULL) {
+		rate = conn->ca_ops->pacing_rate(conn);
+	}
+
+	if (rate == 0) {
+		return;
+	}
+
+	now = k_uptime_ticks();
+	conn->ca.pacing_next = MAX(conn->ca.pacing_next, now) +
+			       (int64_t)len * CONFIG_SYS_CLOCK_TICKS_PER_SEC / rate;
+}
+#else
+static bool tcp_pacing_wait(struct tcp *conn) { return false; }
+
+static void tcp_pacing_sent(struct tcp *conn, int len) { }
+#endif /* CONFIG_NET_TCP_PACING */
+
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 
 static void tcp_send_keepalive_probe(struct k_work *work);
@@ -901,6 +1063,9 @@ static void tcp_conn_release(struct k_work *work)
 	(void)k_work_cancel_delayable(&conn->ack_timer);
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
+#ifdef CONFIG_NET_TCP_PACING
+	(void)k_work_cancel_delayable(&conn->pacing_timer);
+#endif
 	keep_alive_timer_stop(conn);
 
 	k_mutex_unlock(&conn->lock);
@@ -1109,6 +1274,7 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+	recv_options->sack_perm_found = false;
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1157,6 +1323,14 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
 		default:
 			continue;
 		}
@@ -1169,6 +1343,217 @@ end:
 	return result;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Called when receiving the SYN or SYN-ACK of the peer */
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_enabled = conn->recv_options.sack_perm_found;
+}
+
+/* The out of order queue is kept contiguous, so it is a single block */
+static bool tcp_sack_recv_block(struct tcp *conn, uint32_t *start, uint32_t *end)
+{
+	if (!conn->sack_enabled || conn->queue_recv_data == NULL) {
+		return false;
+	}
+
+	*start = tcp_get_seq(conn->queue_recv_data);
+	*end = *start + net_buf_frags_len(conn->queue_recv_data);
+
+	return net_tcp_seq_greater(*start, conn->ack);
+}
+
+static size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags, bool with_data)
+{
+	uint32_t start, end;
+
+	/* SACK permitted in our SYN, and in the SYN-ACK if the peer sent
+	 * it. Both options are preceded by two NOPs for alignment.
+	 */
+	if (flags & SYN) {
+		if (!(flags & ACK) || conn->sack_enabled) {
+			return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+		}
+
+		return 0;
+	}
+
+	/* Only pure ACKs carry a SACK block, so that data segments never
+	 * exceed the MSS.
+	 */
+	if ((flags & ACK) && !with_data && tcp_sack_recv_block(conn, &start, &end)) {
+		return 2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return 0;
+}
+
+static int tcp_sack_options_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
+				size_t len)
+{
+	uint8_t opts[2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE] = {
+		NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+	};
+	uint32_t start, end;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (flags & SYN) {
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
+	} else {
+		(void)tcp_sack_recv_block(conn, &start, &end);
+		opts[2] = NET_TCP_SACK_OPT;
+		opts[3] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		UNALIGNED_PUT(net_htonl(start), (uint32_t *)&opts[4]);
+		UNALIGNED_PUT(net_htonl(end), (uint32_t *)&opts[8]);
+	}
+
+	return net_pkt_write(pkt, opts, len);
+}
+
+static void tcp_sack_board_add(struct tcp *conn, uint32_t start, uint32_t end)
+{
+	struct tcp_sack_block *b = conn->sack_board;
+	int n = conn->sack_board_len;
+	int i = 0;
+	int j;
+
+	/* Skip the blocks ending before the new one */
+	while (i < n && net_tcp_seq_greater(start, b[i].end)) {
+		i++;
+	}
+
+	/* Merge the blocks overlapping or touching the new one */
+	for (j = i; j < n && !net_tcp_seq_greater(b[j].start, end); j++) {
+		if (net_tcp_seq_greater(start, b[j].start)) {
+			start = b[j].start;
+		}
+
+		if (net_tcp_seq_greater(b[j].end, end)) {
+			end = b[j].end;
+		}
+	}
+
+	if (j == i) {
+		if (n == ARRAY_SIZE(conn->sack_board)) {
+			if (i == n) {
+				return;
+			}
+
+			/* Forget the highest block to make room */
+			n--;
+		}
+
+		memmove(&b[i + 1], &b[i], (n - i) * sizeof(*b));
+		n++;
+	} else {
+		memmove(&b[i + 1], &b[j], (n - j) * sizeof(*b));
+		n -= j - i - 1;
+	}
+
+	b[i].start = start;
+	b[i].end = end;
+	conn->sack_board_len = n;
+}
+
+/* Forget what the cumulative ACK covers */
+static void tcp_sack_board_prune(struct tcp *conn)
+{
+	struct tcp_sack_block *b = conn->sack_board;
+	int n = conn->sack_board_len;
+	int i = 0;
+
+	while (i < n && !net_tcp_seq_greater(b[i].end, conn->seq)) {
+		i++;
+	}
+
+	memmove(b, &b[i], (n - i) * sizeof(*b));
+	n -= i;
+
+	if (n > 0 && net_tcp_seq_greater(conn->seq, b[0].start)) {
+		b[0].start = conn->seq;
+	}
+
+	conn->sack_board_len = n;
+}
+
+/* Record the SACK blocks of a received ACK, the option list has already
+ * been validated by tcp_options_check().
+ */
+static void tcp_sack_update(struct tcp *conn, struct net_pkt *pkt, size_t options_len)
+{
+	uint8_t options_buf[40];
+	uint8_t *options;
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+	uint8_t opt_len;
+
+	if (!conn->sack_enabled || options_len == 0) {
+		return;
+	}
+
+	options = tcp_options_get(pkt, options_len, options_buf, sizeof(options_buf));
+	options_len = MIN(options_len, sizeof(options_buf));
+
+	for ( ; options && options_len >= 2; options += opt_len, options_len -= opt_len) {
+		if (options[0] == NET_TCP_END_OPT) {
+			break;
+		}
+
+		if (options[0] == NET_TCP_NOP_OPT) {
+			opt_len = 1;
+			continue;
+		}
+
+		opt_len = options[1];
+		if (opt_len < 2 || opt_len > options_len) {
+			break;
+		}
+
+		if (options[0] != NET_TCP_SACK_OPT) {
+			continue;
+		}
+
+		for (int i = 2; i + NET_TCP_SACK_BLOCK_SIZE <= opt_len;
+		     i += NET_TCP_SACK_BLOCK_SIZE) {
+			uint32_t start = net_ntohl(UNALIGNED_GET((uint32_t *)&options[i]));
+			uint32_t end = net_ntohl(UNALIGNED_GET((uint32_t *)&options[i + 4]));
+
+			/* Ignore D-SACKs and blocks outside of the data in flight */
+			if (!net_tcp_seq_greater(end, start) ||
+			    !net_tcp_seq_greater(end, conn->seq) ||
+			    net_tcp_seq_greater(end, snd_nxt)) {
+				continue;
+			}
+
+			if (net_tcp_seq_greater(conn->seq, start)) {
+				start = conn->seq;
+			}
+
+			NET_DBG("[%p] SACK %u-%u", conn, start, end);
+			tcp_sack_board_add(conn, start, end);
+		}
+	}
+}
+#else
+static void tcp_sack_negotiate(struct tcp *conn) { }
+
+static size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags, bool with_data)
+{
+	return 0;
+}
+
+static int tcp_sack_options_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
+				size_t len)
+{
+	return 0;
+}
+
+static void tcp_sack_update(struct tcp *conn, struct net_pkt *pkt, size_t options_len) { }
+#endif /* CONFIG_NET_TCP_SACK */
+
 static bool tcp_short_window(struct tcp *conn)
 {
 	int32_t threshold = MIN(conn_mss(conn), conn->recv_win_max / 2);
@@ -1347,7 +1732,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t options_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1361,11 +1746,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_sport));
 	UNALIGNED_PUT(conn->dst.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_dport));
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + options_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(net_htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
@@ -1557,21 +1938,27 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	size_t sack_len = tcp_sack_options_len(conn, flags, data != NULL);
+	size_t options_len = sack_len;
 	struct net_pkt *pkt;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		options_len += sizeof(uint32_t);
 	}
 
-	pkt = tcp_pkt_alloc(conn, alloc_len);
+	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr) + options_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
 		goto out;
 	}
 
 	if (data) {
+		/* Let the L2 split data that does not fit in one segment */
+		if (net_pkt_get_len(data) > (size_t)conn_mss(conn)) {
+			net_pkt_set_gso_size(pkt, conn_mss(conn));
+		}
+
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
@@ -1583,7 +1970,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, options_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1597,6 +1984,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_sack_options_add(conn, pkt, flags, sack_len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1805,6 +2198,27 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+#if defined(CONFIG_NET_ETHERNET_GSO)
+/* The IP and TCP headers have to fit in the IP packet too */
+#define TCP_GSO_MAX_LEN (UINT16_MAX - 128)
+
+/* Data sent in one packet, several segments if the L2 splits them */
+static int tcp_send_max_len(struct tcp *conn)
+{
+	const struct net_l2 *l2 = net_if_l2(conn->iface);
+
+	if (l2 != NULL && l2->get_flags != NULL &&
+	    (l2->get_flags(conn->iface) & NET_L2_GSO)) {
+		return MIN(conn_mss(conn) * CONFIG_NET_ETHERNET_GSO_MAX_SEGMENTS,
+			   TCP_GSO_MAX_LEN);
+	}
+
+	return conn_mss(conn);
+}
+#else
+#define tcp_send_max_len(conn) conn_mss(conn)
+#endif /* CONFIG_NET_ETHERNET_GSO */
+
 /* A helper function to reduce code repeat. It should already be protected by mutex
  * and the 'conn' parameter is not NULL.
  */
@@ -1814,13 +2228,41 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
+/* Send len bytes of the send_data queue, starting offset bytes after seq */
+static int tcp_send_segment(struct tcp *conn, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt) {
+		NET_ERR("[%p] packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, &conn->send_data, offset, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
-	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_send_max_len(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1831,21 +2273,7 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
-	if (!pkt) {
-		NET_ERR("[%p] packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_pkt_peek(pkt, &conn->send_data, conn->unacked_len, len);
-	if (ret < 0) {
-		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_send_segment(conn, conn->unacked_len, len);
 	if (ret == 0) {
 		conn->unacked_len += len;
 
@@ -1855,21 +2283,109 @@ static int tcp_send_data(struct tcp *conn)
 		} else {
 			net_stats_update_tcp_sent(conn->iface, len);
 			net_stats_update_tcp_seg_sent(conn->iface);
+			tcp_ca_data_sent(conn, conn->seq + conn->unacked_len);
+			tcp_pacing_sent(conn, len);
 		}
 	}
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
-
 	conn_send_data_dump(conn);
 
  out:
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack_board_len = 0;
+	conn->sack_recovery = false;
+}
+
+static bool tcp_sack_in_recovery(struct tcp *conn)
+{
+	return conn->sack_recovery;
+}
+
+/* Called after the fast retransmit of the first unacknowledged segment */
+static void tcp_sack_recovery_start(struct tcp *conn)
+{
+	if (!conn->sack_enabled) {
+		return;
+	}
+
+	conn->sack_recovery = true;
+	conn->sack_recovery_point = conn->seq + conn->unacked_len;
+	conn->sack_rexmit_next = conn->seq + MIN(conn_mss(conn), conn->unacked_len);
+}
+
+/* Retransmit the next segment of the first hole below a SACKed block */
+static void tcp_sack_send_hole(struct tcp *conn)
+{
+	uint32_t next = conn->sack_rexmit_next;
+	int len;
+
+	if (net_tcp_seq_greater(conn->seq, next)) {
+		next = conn->seq;
+	}
+
+	for (int i = 0; i < conn->sack_board_len; i++) {
+		struct tcp_sack_block *b = &conn->sack_board[i];
+
+		if (!net_tcp_seq_greater(b->start, next)) {
+			if (net_tcp_seq_greater(b->end, next)) {
+				next = b->end;
+			}
+
+			continue;
+		}
+
+		len = MIN((int)(b->start - next), conn_mss(conn));
+
+		NET_DBG("[%p] SACK retransmit %u-%u", conn, next, next + len);
+
+		if (tcp_send_segment(conn, next - conn->seq, len) == 0) {
+			net_stats_update_tcp_resent(conn->iface, len);
+			net_stats_update_tcp_seg_rexmit(conn->iface);
+			conn->sack_rexmit_next = next + len;
+		}
+
+		return;
+	}
+}
+
+/* Each further duplicate ACK in recovery lets one more hole go out */
+static void tcp_sack_dup_ack(struct tcp *conn)
+{
+	if (conn->sack_recovery) {
+		tcp_sack_send_hole(conn);
+	}
+}
+
+/* Called once conn->seq has been advanced by a cumulative ACK */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	tcp_sack_board_prune(conn);
+
+	if (!conn->sack_recovery) {
+		return;
+	}
+
+	if (!net_tcp_seq_greater(conn->sack_recovery_point, conn->seq)) {
+		tcp_sack_reset(conn);
+		return;
+	}
+
+	/* Partial ACK, the segment right after it is lost as well */
+	tcp_sack_send_hole(conn);
+}
+#else
+static void tcp_sack_reset(struct tcp *conn) { }
+static bool tcp_sack_in_recovery(struct tcp *conn) { return false; }
+static void tcp_sack_recovery_start(struct tcp *conn) { }
+static void tcp_sack_dup_ack(struct tcp *conn) { }
+static void tcp_sack_acked(struct tcp *conn) { }
+#endif /* CONFIG_NET_TCP_SACK */
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1895,6 +2411,10 @@ static int tcp_send_queued_data(struct tcp *conn)
 			}
 		}
 
+		if (tcp_pacing_wait(conn)) {
+			break;
+		}
+
 		ret = tcp_send_data(conn);
 		if (ret < 0) {
 			break;
@@ -1916,6 +2436,22 @@ static int tcp_send_queued_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_PACING
+static void tcp_pacing_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, pacing_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		(void)tcp_send_queued_data(conn);
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#endif /* CONFIG_NET_TCP_PACING */
+
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -1971,6 +2507,7 @@ static void tcp_resend_data(struct k_work *work)
 
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
+		tcp_sack_reset(conn);
 
 		ret = tcp_send_data(conn);
 		if (ret == -ENODATA) {
@@ -2204,6 +2741,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca_ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2220,6 +2758,9 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#ifdef CONFIG_NET_TCP_PACING
+	k_work_init_delayable(&conn->pacing_timer, tcp_pacing_timeout);
+#endif
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -3094,6 +3635,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_sack_negotiate(conn);
 			conn->isn_peer = th_seq(th);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
@@ -3123,6 +3665,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+				tcp_ca_param_copy(conn, conn->accepted_conn);
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3207,6 +3750,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
+			tcp_sack_negotiate(conn);
 			conn->isn_peer = th_seq(th);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
@@ -3252,6 +3796,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		keep_alive_timer_restart(conn);
 
+		tcp_sack_update(conn, pkt, tcp_options_len);
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3271,7 +3817,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			/* Only do fast retransmit when not already in a resend state */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
-			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
+			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+			    !tcp_sack_in_recovery(conn)) {
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
 
@@ -3286,6 +3833,10 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+
+				tcp_sack_recovery_start(conn);
+			} else if ((conn->send_data_total > 0) && (len == 0)) {
+				tcp_sack_dup_ack(conn);
 			}
 		}
 #endif
@@ -3331,6 +3882,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
+			tcp_sack_acked(conn);
 
 			/* Receipt of an acknowledgment that covers a sequence number
 			 * not previously acknowledged indicates that the connection
@@ -4683,6 +5235,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4720,6 +5275,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -0,0 +1,233 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Model based congestion control following the ideas of BBR: the sending
+ * rate is paced at the bottleneck bandwidth, maximum of the delivery rate
+ * over the last rounds, and the congestion window is kept at a small
+ * multiple of the bandwidth delay product. Losses do not change the model.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include "tcp_internal.h"
+
+enum bbr_mode {
+	BBR_STARTUP,
+	BBR_DRAIN,
+	BBR_PROBE_BW,
+	BBR_PROBE_RTT,
+};
+
+/* Gains are fractions of 256 */
+#define BBR_UNIT       256
+#define BBR_HIGH_GAIN  739 /* 2 / ln(2) */
+#define BBR_DRAIN_GAIN 89  /* 1 / BBR_HIGH_GAIN */
+#define BBR_CWND_GAIN  512
+
+#define BBR_MIN_RTT_WIN_MS    10000
+#define BBR_PROBE_RTT_MS      200
+#define BBR_FULL_BW_ROUNDS    3
+#define BBR_MIN_CWND_SEGMENTS 4
+
+static const uint16_t bbr_cycle_gain[] = {
+	320, 192, 256, 256, 256, 256, 256, 256,
+};
+
+static uint32_t bbr_pacing_gain(struct tcp_ca_bbr *bbr)
+{
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		return BBR_HIGH_GAIN;
+	case BBR_DRAIN:
+		return BBR_DRAIN_GAIN;
+	case BBR_PROBE_BW:
+		return bbr_cycle_gain[bbr->cycle_idx];
+	default:
+		return BBR_UNIT;
+	}
+}
+
+/* Bandwidth delay product in bytes, 0 until it has been measured */
+static uint32_t bbr_bdp(struct tcp_ca_bbr *bbr)
+{
+	if (bbr->btl_bw == 0 || bbr->min_rtt == UINT32_MAX) {
+		return 0;
+	}
+
+	return (uint64_t)bbr->btl_bw * bbr->min_rtt / MSEC_PER_SEC;
+}
+
+static uint32_t bbr_target_cwnd(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca.bbr;
+	uint32_t min_cwnd = BBR_MIN_CWND_SEGMENTS * conn_mss(conn);
+	uint32_t gain = bbr->mode == BBR_STARTUP ? BBR_HIGH_GAIN : BBR_CWND_GAIN;
+
+	if (bbr->mode == BBR_PROBE_RTT) {
+		return min_cwnd;
+	}
+
+	return MAX((uint64_t)bbr_bdp(bbr) * gain / BBR_UNIT, min_cwnd);
+}
+
+static void bbr_log(struct tcp *conn, char *step)
+{
+	NET_DBG("[%p] bbr %s, mode=%d, cwnd=%d, btl_bw=%u, min_rtt=%u",
+		conn, step, conn->ca.bbr.mode, conn->ca.cwnd,
+		conn->ca.bbr.btl_bw, conn->ca.bbr.min_rtt);
+}
+
+static void bbr_init(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca.bbr;
+
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+
+	memset(bbr, 0, sizeof(*bbr));
+	bbr->min_rtt = UINT32_MAX;
+	bbr->min_rtt_stamp = k_uptime_get_32();
+	bbr->mode = BBR_STARTUP;
+	bbr_log(conn, "init");
+}
+
+static void bbr_fast_retransmit(struct tcp *conn)
+{
+	bbr_log(conn, "fast_retransmit");
+}
+
+/* Restart from one segment, the window grows back to the model quickly */
+static void bbr_timeout(struct tcp *conn)
+{
+	conn->ca.cwnd = conn_mss(conn);
+	bbr_log(conn, "timeout");
+}
+
+static void bbr_dup_ack(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void bbr_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	uint32_t target = bbr_target_cwnd(conn);
+	uint32_t cwnd = conn->ca.cwnd + acked_len;
+
+	/* Grow by what was delivered until the model gives a window */
+	if ((bbr_bdp(&conn->ca.bbr) != 0) || (conn->ca.bbr.mode == BBR_PROBE_RTT)) {
+		cwnd = MIN(cwnd, target);
+	}
+
+	conn->ca.cwnd = MIN(cwnd, UINT16_MAX);
+}
+
+static void bbr_update_bw(struct tcp_ca_bbr *bbr, uint32_t bw)
+{
+	bbr->round++;
+	bbr->bw[bbr->round % TCP_BBR_BW_ROUNDS] = bw;
+
+	bbr->btl_bw = 0;
+	for (int i = 0; i < TCP_BBR_BW_ROUNDS; i++) {
+		bbr->btl_bw = MAX(bbr->btl_bw, bbr->bw[i]);
+	}
+
+	/* The pipe is full once the bandwidth stops growing by 25% */
+	if (bbr->full_bw_reached) {
+		return;
+	}
+
+	if (bbr->btl_bw >= bbr->full_bw + bbr->full_bw / 4) {
+		bbr->full_bw = bbr->btl_bw;
+		bbr->full_bw_cnt = 0;
+	} else if (++bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS) {
+		bbr->full_bw_reached = true;
+	}
+}
+
+static void bbr_update_mode(struct tcp *conn, uint32_t now)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca.bbr;
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		if (bbr->full_bw_reached) {
+			bbr->mode = BBR_DRAIN;
+		}
+		break;
+	case BBR_DRAIN:
+		if ((uint32_t)conn->unacked_len <= bbr_bdp(bbr)) {
+			bbr->mode = BBR_PROBE_BW;
+			bbr->cycle_idx = 0;
+			bbr->cycle_stamp = now;
+		}
+		break;
+	case BBR_PROBE_BW:
+		if (now - bbr->cycle_stamp >= bbr->min_rtt) {
+			bbr->cycle_idx = (bbr->cycle_idx + 1) % ARRAY_SIZE(bbr_cycle_gain);
+			bbr->cycle_stamp = now;
+		}
+		break;
+	case BBR_PROBE_RTT:
+		if ((int32_t)(now - bbr->probe_rtt_done) >= 0) {
+			bbr->min_rtt_stamp = now;
+			bbr->mode = bbr->full_bw_reached ? BBR_PROBE_BW : BBR_STARTUP;
+			bbr->cycle_idx = 0;
+			bbr->cycle_stamp = now;
+		}
+		break;
+	}
+
+	/* Drain the queue once in a while to measure the real path delay */
+	if ((bbr->mode != BBR_PROBE_RTT) &&
+	    (now - bbr->min_rtt_stamp > BBR_MIN_RTT_WIN_MS)) {
+		bbr->mode = BBR_PROBE_RTT;
+		bbr->probe_rtt_done = now + MAX(bbr->min_rtt, BBR_PROBE_RTT_MS);
+		bbr->min_rtt = UINT32_MAX;
+	}
+}
+
+static void bbr_rtt_sample(struct tcp *conn, uint32_t rtt_ms, uint32_t delivered)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca.bbr;
+	uint32_t now = k_uptime_get_32();
+
+	bbr_update_bw(bbr, (uint64_t)delivered * MSEC_PER_SEC / rtt_ms);
+
+	if (rtt_ms <= bbr->min_rtt) {
+		bbr->min_rtt = rtt_ms;
+		bbr->min_rtt_stamp = now;
+	}
+
+	bbr_update_mode(conn, now);
+
+	if (bbr->mode == BBR_PROBE_RTT) {
+		conn->ca.cwnd = MIN(conn->ca.cwnd, bbr_target_cwnd(conn));
+	}
+
+	bbr_log(conn, "rtt_sample");
+}
+
+static uint32_t bbr_pacing_rate(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca.bbr;
+
+	return (uint64_t)bbr->btl_bw * bbr_pacing_gain(bbr) / BBR_UNIT;
+}
+
+const struct tcp_ca_ops tcp_ca_bbr = {
+	.name = "bbr",
+	.init = bbr_init,
+	.fast_retransmit = bbr_fast_retransmit,
+	.timeout = bbr_timeout,
+	.dup_ack = bbr_dup_ack,
+	.pkts_acked = bbr_pkts_acked,
+	.rtt_sample = bbr_rtt_sample,
+	.pacing_rate = bbr_pacing_rate,
+};
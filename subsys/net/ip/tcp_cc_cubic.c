@@ -0,0 +1,185 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, according to RFC 9438 */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include "tcp_internal.h"
+
+/* Multiplicative decrease factor 0.7, as a fraction of 1024 */
+#define CUBIC_BETA 717
+/* Additive increase of the Reno friendly estimate, 3 * (1 - beta) / (1 + beta) */
+#define CUBIC_ALPHA 542
+/* With C = 0.4 and times in ms, (w_max - cwnd) * CUBIC_K_SCALE / mss is K^3 */
+#define CUBIC_K_SCALE 2500000000ULL
+/* Larger differences from K would overflow the cubic term */
+#define CUBIC_MAX_DELTA_MS 100000
+
+static uint32_t cubic_root(uint64_t a)
+{
+	uint64_t x = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		x <<= 1;
+		b = 3 * x * (x + 1) + 1;
+		if ((a >> s) >= b) {
+			a -= b << s;
+			x++;
+		}
+	}
+
+	return (uint32_t)x;
+}
+
+static void cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("[%p] cubic %s, cwnd=%d, ssthres=%d, w_max=%d, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		conn->ca.cubic.w_max, conn->ca.cubic.k);
+}
+
+static void cubic_init(struct tcp *conn)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca.cubic;
+
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+
+	memset(cubic, 0, sizeof(*cubic));
+	cubic->min_rtt = UINT32_MAX;
+	cubic_log(conn, "init");
+}
+
+static void cubic_loss(struct tcp *conn)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca.cubic;
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence, release bandwidth when the window keeps shrinking */
+	if (cwnd < cubic->w_max) {
+		cubic->w_max = cwnd * (1024 + CUBIC_BETA) / 2048;
+	} else {
+		cubic->w_max = cwnd;
+	}
+
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, cwnd * CUBIC_BETA / 1024);
+	cubic->in_epoch = false;
+}
+
+static void cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		cubic_loss(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh, UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void cubic_timeout(struct tcp *conn)
+{
+	cubic_loss(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	cubic_log(conn, "timeout");
+}
+
+static void cubic_dup_ack(struct tcp *conn)
+{
+	conn->ca.cwnd = MIN(conn->ca.cwnd + conn_mss(conn), UINT16_MAX);
+}
+
+/* Congestion avoidance, grow towards the cubic curve */
+static void cubic_update(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca.cubic;
+	uint32_t now = k_uptime_get_32();
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	int64_t delta;
+	int64_t target;
+	uint32_t inc;
+
+	if (!cubic->in_epoch) {
+		cubic->in_epoch = true;
+		cubic->epoch_start = now;
+		cubic->w_est = cwnd;
+
+		if (cwnd < cubic->w_max) {
+			cubic->k = cubic_root((cubic->w_max - cwnd) * CUBIC_K_SCALE / mss);
+			cubic->origin = cubic->w_max;
+		} else {
+			cubic->k = 0;
+			cubic->origin = cwnd;
+		}
+	}
+
+	delta = (int64_t)(now - cubic->epoch_start) - cubic->k;
+	if (cubic->min_rtt != UINT32_MAX) {
+		delta += cubic->min_rtt;
+	}
+
+	delta = CLAMP(delta, -CUBIC_MAX_DELTA_MS, CUBIC_MAX_DELTA_MS);
+	target = cubic->origin + (int64_t)mss * delta * delta * delta * 2 / 5000000000LL;
+
+	/* Reno friendly region, never grow slower than NewReno would */
+	cubic->w_est += (uint64_t)acked_len * mss * CUBIC_ALPHA / 1024 / cwnd;
+	target = MAX(target, (int64_t)cubic->w_est);
+
+	target = MIN(target, (int64_t)cwnd * 3 / 2);
+	if (target > cwnd) {
+		inc = (target - cwnd) * acked_len / cwnd;
+	} else {
+		inc = acked_len * mss / (100 * cwnd);
+	}
+
+	conn->ca.cwnd = MIN(cwnd + inc, UINT16_MAX);
+}
+
+static void cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca.pending_fast_retransmit_bytes != 0) {
+		/* Check if it is still in fast recovery mode */
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+			conn->ca.cwnd = conn->ca.ssthresh;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+			conn->ca.cwnd = MAX((int)conn->ca.cwnd - (int)acked_len,
+					    (int)conn_mss(conn));
+		}
+	} else if (conn->ca.cwnd < conn->ca.ssthresh) {
+		conn->ca.cwnd = MIN(conn->ca.cwnd + MIN(acked_len, conn_mss(conn)), UINT16_MAX);
+	} else {
+		cubic_update(conn, acked_len);
+	}
+
+	cubic_log(conn, "pkts_acked");
+}
+
+static void cubic_rtt_sample(struct tcp *conn, uint32_t rtt_ms, uint32_t delivered)
+{
+	ARG_UNUSED(delivered);
+
+	conn->ca.cubic.min_rtt = MIN(conn->ca.cubic.min_rtt, rtt_ms);
+}
+
+const struct tcp_ca_ops tcp_ca_cubic = {
+	.name = "cubic",
+	.init = cubic_init,
+	.fast_retransmit = cubic_fast_retransmit,
+	.timeout = cubic_timeout,
+	.dup_ack = cubic_dup_ack,
+	.pkts_acked = cubic_pkts_acked,
+	.rtt_sample = cubic_rtt_sample,
+};
@@ -229,26 +229,119 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
 };
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Range of selectively acknowledged sequence numbers, end excluded */
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
+#endif
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
+/* Define the number of MSS sections the congestion window is initialized at */
+#define TCP_CONGESTION_INITIAL_WIN 1
+#define TCP_CONGESTION_INITIAL_SSTHRESH 3
+
+#define TCP_CA_NAME_MAX 16
+
+struct tcp;
+
+/* Congestion control algorithm, called with the connection lock held */
+struct tcp_ca_ops {
+	const char *name;
+	void (*init)(struct tcp *conn);
+	void (*fast_retransmit)(struct tcp *conn);
+	void (*timeout)(struct tcp *conn);
+	void (*dup_ack)(struct tcp *conn);
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+	/* Optional, called about once per round trip with the measured
+	 * round trip time and the number of bytes acknowledged during it.
+	 */
+	void (*rtt_sample)(struct tcp *conn, uint32_t rtt_ms, uint32_t delivered);
+	/* Optional, rate in bytes per second to pace segments at, 0 to
+	 * send them as soon as the window allows.
+	 */
+	uint32_t (*pacing_rate)(struct tcp *conn);
+};
+
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+struct tcp_ca_cubic {
+	uint32_t epoch_start;
+	uint32_t k;
+	uint32_t min_rtt;
+	uint32_t w_est;
+	uint16_t w_max;
+	uint16_t origin;
+	bool in_epoch;
+};
+
+extern const struct tcp_ca_ops tcp_ca_cubic;
+#endif
+
+#ifdef CONFIG_NET_TCP_CC_BBR
+#define TCP_BBR_BW_ROUNDS 10
+
+struct tcp_ca_bbr {
+	uint32_t bw[TCP_BBR_BW_ROUNDS];
+	uint32_t btl_bw;
+	uint32_t full_bw;
+	uint32_t min_rtt;
+	uint32_t min_rtt_stamp;
+	uint32_t probe_rtt_done;
+	uint32_t cycle_stamp;
+	uint32_t round;
+	uint8_t mode;
+	uint8_t cycle_idx;
+	uint8_t full_bw_cnt;
+	bool full_bw_reached;
+};
+
+extern const struct tcp_ca_ops tcp_ca_bbr;
+#endif
+
 struct tcp_collision_avoidance_reno {
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+	/* Round trip time of one segment at a time, not retransmitted */
+	bool rtt_pending;
+	uint32_t rtt_seq;
+	uint32_t rtt_start;
+	uint32_t rtt_delivered;
+	uint32_t delivered;
+#ifdef CONFIG_NET_TCP_PACING
+	int64_t pacing_next;
+#endif
+#if defined(CONFIG_NET_TCP_CC_CUBIC) || defined(CONFIG_NET_TCP_CC_BBR)
+	union {
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+		struct tcp_ca_cubic cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CC_BBR
+		struct tcp_ca_bbr bbr;
+#endif
+	};
+#endif
 };
 #endif
 
@@ -295,6 +388,9 @@ struct tcp { /* TCP connection */
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	struct k_work_delayable keepalive_timer;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
+#if defined(CONFIG_NET_TCP_PACING)
+	struct k_work_delayable pacing_timer;
+#endif /* CONFIG_NET_TCP_PACING */
 	struct k_work conn_release;
 
 	union {
@@ -336,10 +432,18 @@ struct tcp { /* TCP connection */
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_ca_ops *ca_ops;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	uint8_t dup_ack_cnt;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	/* Data SACKed by the peer above seq, sorted and disjoint */
+	struct tcp_sack_block sack_board[CONFIG_NET_TCP_SACK_SCOREBOARD_SIZE];
+	uint32_t sack_recovery_point;
+	uint32_t sack_rexmit_next;
+	uint8_t sack_board_len;
 #endif
 	uint8_t zwp_retries;
 	bool in_connect : 1;
@@ -350,6 +454,10 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_enabled : 1;
+	bool sack_recovery : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -54,7 +54,16 @@ int net_udp_finalize(struct net_pkt *pkt, bool force_chksum)
 	udp_hdr->len = net_htons(length);
 
 	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
-		udp_hdr->chksum = net_calc_chksum_udp(pkt);
+		uint16_t payload_sum;
+
+		if (net_pkt_chksum_payload(pkt, &payload_sum)) {
+			/* The payload was summed while it was copied */
+			udp_hdr->chksum = 0U;
+			udp_hdr->chksum = net_calc_chksum_udp_hdr(pkt, udp_hdr, payload_sum);
+		} else {
+			udp_hdr->chksum = net_calc_chksum_udp(pkt);
+		}
+
 		net_pkt_set_chksum_done(pkt, true);
 	}
 
@@ -569,18 +569,109 @@ static uint16_t offset_based_swap8(const uint8_t *data)
 	}
 }
 
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+/* Sum blocks of 16 bytes with an add with carry chain, which avoids
+ * widening every addition to 64 bits. The carry out of each block is
+ * counted separately, so the result is the exact sum of the words.
+ */
+static inline uint64_t chksum_blocks(uint64_t sum_in, const uint32_t *p, size_t blocks)
+{
+	uint32_t sum = 0U, carry = 0U;
+	uint32_t a, b, c, d;
+
+	__asm__ volatile("1:\n\t"
+			 "ldrd %[a], %[b], [%[p]], #8\n\t"
+			 "ldrd %[c], %[d], [%[p]], #8\n\t"
+			 "adds %[sum], %[sum], %[a]\n\t"
+			 "adcs %[sum], %[sum], %[b]\n\t"
+			 "adcs %[sum], %[sum], %[c]\n\t"
+			 "adcs %[sum], %[sum], %[d]\n\t"
+			 "adc %[carry], %[carry], #0\n\t"
+			 "subs %[n], %[n], #1\n\t"
+			 "bne 1b\n\t"
+			 : [sum] "+r"(sum), [carry] "+r"(carry), [p] "+r"(p), [n] "+r"(blocks),
+			   [a] "=&r"(a), [b] "=&r"(b), [c] "=&r"(c), [d] "=&r"(d)
+			 :
+			 : "cc", "memory");
+
+	return sum_in + sum + ((uint64_t)carry << 32);
+}
+
+/* Same as chksum_blocks() while copying the blocks from src to dst */
+static inline uint64_t chksum_copy_blocks(uint64_t sum_in, uint32_t *dst, const uint32_t *src,
+					  size_t blocks)
+{
+	uint32_t sum = 0U, carry = 0U;
+	uint32_t a, b, c, d;
+
+	__asm__ volatile("1:\n\t"
+			 "ldrd %[a], %[b], [%[src]], #8\n\t"
+			 "ldrd %[c], %[d], [%[src]], #8\n\t"
+			 "strd %[a], %[b], [%[dst]], #8\n\t"
+			 "strd %[c], %[d], [%[dst]], #8\n\t"
+			 "adds %[sum], %[sum], %[a]\n\t"
+			 "adcs %[sum], %[sum], %[b]\n\t"
+			 "adcs %[sum], %[sum], %[c]\n\t"
+			 "adcs %[sum], %[sum], %[d]\n\t"
+			 "adc %[carry], %[carry], #0\n\t"
+			 "subs %[n], %[n], #1\n\t"
+			 "bne 1b\n\t"
+			 : [sum] "+r"(sum), [carry] "+r"(carry), [src] "+r"(src), [dst] "+r"(dst),
+			   [n] "+r"(blocks), [a] "=&r"(a), [b] "=&r"(b), [c] "=&r"(c), [d] "=&r"(d)
+			 :
+			 : "cc", "memory");
+
+	return sum_in + sum + ((uint64_t)carry << 32);
+}
+#else
+static inline uint64_t chksum_blocks(uint64_t sum, const uint32_t *p, size_t blocks)
+{
+	while (blocks-- > 0) {
+		uint64_t sum_a = p[0];
+		uint64_t sum_b = p[1];
+
+		sum_a += p[2];
+		sum_b += p[3];
+		p += 4;
+		sum += sum_a + sum_b;
+	}
+
+	return sum;
+}
+
+static inline uint64_t chksum_copy_blocks(uint64_t sum, uint32_t *dst, const uint32_t *src,
+					  size_t blocks)
+{
+	while (blocks-- > 0) {
+		uint64_t sum_a = dst[0] = src[0];
+		uint64_t sum_b = dst[1] = src[1];
+
+		sum_a += (dst[2] = src[2]);
+		sum_b += (dst[3] = src[3]);
+		src += 4;
+		dst += 4;
+		sum += sum_a + sum_b;
+	}
+
+	return sum;
+}
+#endif /* CONFIG_ARMV7_M_ARMV8_M_MAINLINE */
+
 /* Word based checksum calculation based on:
  * https://blogs.igalia.com/dpino/2018/06/14/fast-checksum-computation/
  * It’s not necessary to add octets as 16-bit words. Due to the associative property of addition,
  * it is possible to do parallel addition using larger word sizes such as 32-bit or 64-bit words.
  * In those cases the variable that stores the accumulative sum has to be bigger too.
  * Once the sum is computed a final step folds the sum to a 16-bit word (adding carry if any).
+ *
+ * If dst is not NULL, the data is also copied there. src and dst must then have the same
+ * alignment.
  */
-uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
+static ALWAYS_INLINE uint16_t chksum(uint16_t sum_in, uint8_t *dst, const uint8_t *data,
+				     size_t len)
 {
 	uint64_t sum;
 	uint32_t *p;
-	size_t i = 0;
 	size_t pending = len;
 	int odd_start = ((uintptr_t)data & 0x01);
 
@@ -596,39 +687,61 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	/* Process up to 3 data elements up front, so the data is aligned further down the line */
 	if ((((uintptr_t)data & 0x01) != 0) && (pending >= 1)) {
 		sum += offset_based_swap8(data);
+		if (dst != NULL) {
+			*dst++ = *data;
+		}
 		data++;
 		pending--;
 	}
 	if ((((uintptr_t)data & 0x02) != 0) && (pending >= sizeof(uint16_t))) {
 		pending -= sizeof(uint16_t);
 		sum = sum + *((uint16_t *)data);
+		if (dst != NULL) {
+			*((uint16_t *)dst) = *((uint16_t *)data);
+			dst += sizeof(uint16_t);
+		}
 		data += sizeof(uint16_t);
 	}
 	p = (uint32_t *)data;
 
 	/* Do loop unrolling for the very large data sets */
-	while (pending >= sizeof(uint32_t) * 4) {
-		uint64_t sum_a = p[i];
-		uint64_t sum_b = p[i + 1];
-
-		pending -= sizeof(uint32_t) * 4;
-		sum_a += p[i + 2];
-		sum_b += p[i + 3];
-		i += 4;
-		sum += sum_a + sum_b;
+	if (pending >= sizeof(uint32_t) * 4) {
+		size_t blocks = pending / (sizeof(uint32_t) * 4);
+
+		if (dst != NULL) {
+			sum += chksum_copy_blocks(0, (uint32_t *)dst, p, blocks);
+			dst += blocks * sizeof(uint32_t) * 4;
+		} else {
+			sum += chksum_blocks(0, p, blocks);
+		}
+
+		p += blocks * 4;
+		pending -= blocks * sizeof(uint32_t) * 4;
 	}
 	while (pending >= sizeof(uint32_t)) {
 		pending -= sizeof(uint32_t);
-		sum = sum + p[i++];
+		sum = sum + *p;
+		if (dst != NULL) {
+			*((uint32_t *)dst) = *p;
+			dst += sizeof(uint32_t);
+		}
+		p++;
 	}
-	data = (uint8_t *)(p + i);
+	data = (uint8_t *)p;
 	if (pending >= 2) {
 		pending -= sizeof(uint16_t);
 		sum = sum + *((uint16_t *)data);
+		if (dst != NULL) {
+			*((uint16_t *)dst) = *((uint16_t *)data);
+			dst += sizeof(uint16_t);
+		}
 		data += sizeof(uint16_t);
 	}
 	if (pending == 1) {
 		sum += offset_based_swap8(data);
+		if (dst != NULL) {
+			*dst = *data;
+		}
 	}
 
 	/* Fold sum into 16-bit word. */
@@ -646,6 +759,23 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 }
 
+uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
+{
+	return chksum(sum_in, NULL, data, len);
+}
+
+uint16_t calc_chksum_copy(uint16_t sum_in, uint8_t *dst, const uint8_t *src, size_t len)
+{
+	if ((((uintptr_t)dst ^ (uintptr_t)src) & 0x03) != 0) {
+		/* Word accesses cannot be aligned on both sides */
+		memcpy(dst, src, len);
+
+		return chksum(sum_in, NULL, dst, len);
+	}
+
+	return chksum(sum_in, dst, src, len);
+}
+
 #if defined(CONFIG_NET_NATIVE_IP)
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 {
@@ -684,7 +814,12 @@ static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 	return sum;
 }
 
-uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
+/* If hdr is set, only the transport header there is summed and the
+ * checksum of the payload is given by payload_sum.
+ */
+static uint16_t pkt_calc_chksum_proto(struct net_pkt *pkt, uint8_t proto,
+				      const uint8_t *hdr, size_t hdr_len,
+				      uint16_t payload_sum)
 {
 	size_t len = 0U;
 	uint16_t sum = 0U;
@@ -721,7 +856,16 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 	sum = calc_chksum(sum, pkt->cursor.pos, len);
 	net_pkt_skip(pkt, len + net_pkt_ip_opts_len(pkt));
 
-	sum = pkt_calc_chksum(pkt, sum);
+	if (hdr != NULL) {
+		uint32_t sum32;
+
+		sum = calc_chksum(sum, hdr, hdr_len);
+
+		sum32 = (uint32_t)sum + payload_sum;
+		sum = (sum32 & 0xffff) + (sum32 >> 16);
+	} else {
+		sum = pkt_calc_chksum(pkt, sum);
+	}
 
 	sum = (sum == 0U) ? 0xffff : net_htons(sum);
 
@@ -731,6 +875,18 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 
 	return ~sum;
 }
+
+uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
+{
+	return pkt_calc_chksum_proto(pkt, proto, NULL, 0U, 0U);
+}
+
+uint16_t net_calc_chksum_partial(struct net_pkt *pkt, uint8_t proto,
+				 const uint8_t *hdr, size_t hdr_len,
+				 uint16_t payload_sum)
+{
+	return pkt_calc_chksum_proto(pkt, proto, hdr, hdr_len, payload_sum);
+}
 #endif
 
 #if defined(CONFIG_NET_NATIVE_IPV4)
@@ -679,6 +679,158 @@ static void ethernet_update_tx_stats(struct net_if *iface, struct net_pkt *pkt)
 	}
 }
 
+#if defined(CONFIG_NET_ETHERNET_GSO)
+/* TCP flags that only belong to the last segment */
+#define GSO_TCP_FIN BIT(0)
+#define GSO_TCP_PSH BIT(3)
+
+/* Build a segment from the IP and TCP headers of pkt followed by len bytes
+ * of its payload, starting offset bytes after the headers.
+ */
+static struct net_pkt *ethernet_gso_segment(struct net_pkt *pkt, size_t hdr_len,
+					    size_t offset, size_t len, bool last)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(tcp_access, struct net_tcp_hdr);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+	struct net_pkt *seg;
+	int ret;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len + len,
+					net_pkt_family(pkt), NET_IPPROTO_TCP,
+					NET_BUF_TIMEOUT);
+	if (!seg) {
+		return NULL;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		goto fail;
+	}
+
+	net_pkt_set_ll_proto_type(seg, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+	net_pkt_set_vlan_tci(seg, net_pkt_vlan_tci(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	*net_pkt_lladdr_src(seg) = *net_pkt_lladdr_src(pkt);
+	*net_pkt_lladdr_dst(seg) = *net_pkt_lladdr_dst(pkt);
+
+	if (net_pkt_family(pkt) == NET_AF_INET) {
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+		/* Recalculated by net_ipv4_finalize() */
+		NET_IPV4_HDR(seg)->chksum = 0U;
+	} else {
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, ip_len)) {
+		goto fail;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!tcp_hdr) {
+		goto fail;
+	}
+
+	sys_put_be32(sys_get_be32(tcp_hdr->seq) + offset, tcp_hdr->seq);
+
+	if (!last) {
+		tcp_hdr->flags &= ~(GSO_TCP_FIN | GSO_TCP_PSH);
+	}
+
+	net_pkt_set_data(seg, &tcp_access);
+	net_pkt_cursor_init(seg);
+
+	if (net_pkt_family(seg) == NET_AF_INET) {
+		ret = net_ipv4_finalize(seg, NET_IPPROTO_TCP);
+	} else {
+		ret = net_ipv6_finalize(seg, NET_IPPROTO_TCP);
+	}
+
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return seg;
+
+fail:
+	net_pkt_unref(seg);
+
+	return NULL;
+}
+
+/* Split a TCP packet into segments of its GSO size and send them */
+static int ethernet_gso_send(struct ethernet_context *ctx, struct net_if *iface,
+			     struct net_pkt *pkt, uint16_t ptype)
+{
+	const struct ethernet_api *api = net_if_get_device(iface)->api;
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	size_t gso_size = net_pkt_gso_size(pkt);
+	size_t hdr_len, data_len, offset, len;
+	uint8_t tcp_off;
+	int sent = 0;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_skip(pkt, ip_len + offsetof(struct net_tcp_hdr, offset)) ||
+	    net_pkt_read_u8(pkt, &tcp_off)) {
+		return -ENOBUFS;
+	}
+
+	hdr_len = ip_len + (tcp_off >> 4) * 4U;
+	data_len = net_pkt_get_len(pkt) - hdr_len;
+
+	for (offset = 0; offset < data_len; offset += len) {
+		struct net_pkt *seg;
+
+		len = MIN(data_len - offset, gso_size);
+
+		seg = ethernet_gso_segment(pkt, hdr_len, offset, len,
+					   offset + len == data_len);
+		if (!seg) {
+			return -ENOMEM;
+		}
+
+		if (!ethernet_fill_header(ctx, iface, seg, ptype)) {
+			net_pkt_unref(seg);
+			return -ENOMEM;
+		}
+
+		net_pkt_cursor_init(seg);
+
+		ret = net_l2_send(api->send, net_if_get_device(iface), iface, seg);
+		if (ret != 0) {
+			eth_stats_update_errors_tx(iface);
+			net_pkt_unref(seg);
+			return ret;
+		}
+
+		ethernet_update_tx_stats(iface, seg);
+		sent += net_pkt_get_len(seg);
+		net_pkt_unref(seg);
+	}
+
+	return sent;
+}
+
+static bool ethernet_gso_needed(struct net_if *iface, struct net_pkt *pkt)
+{
+	return net_pkt_gso_size(pkt) > 0U &&
+		!(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO);
+}
+#else
+#define ethernet_gso_send(...) (-ENOTSUP)
+#define ethernet_gso_needed(...) false
+#endif /* CONFIG_NET_ETHERNET_GSO */
+
 static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	const struct ethernet_api *api = net_if_get_device(iface)->api;
@@ -764,6 +916,19 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 				       sizeof(struct net_eth_addr));
 	}
 
+	/* Large TCP packets are split into segments here, unless the
+	 * driver can do that.
+	 */
+	if (ethernet_gso_needed(iface, pkt)) {
+		ret = ethernet_gso_send(ctx, iface, pkt, ptype);
+		if (ret < 0) {
+			goto error;
+		}
+
+		net_pkt_unref(pkt);
+		return ret;
+	}
+
 	/* Then set the ethernet header. Note that the iface parameter tells
 	 * where we are actually sending the packet. The interface in net_pkt
 	 * is used to determine if the VLAN header is added to Ethernet frame.
@@ -1090,6 +1255,10 @@ void ethernet_init(struct net_if *iface)
 		ctx->ethernet_l2_flags |= NET_L2_PROMISC_MODE;
 	}
 
+	if (IS_ENABLED(CONFIG_NET_ETHERNET_GSO)) {
+		ctx->ethernet_l2_flags |= NET_L2_GSO;
+	}
+
 #if defined(CONFIG_NET_NATIVE_IP) && !defined(CONFIG_NET_RAW_MODE)
 	if (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_FILTERING) {
 		net_if_mcast_mon_register(&mcast_monitor, NULL, ethernet_mcast_monitor_cb);
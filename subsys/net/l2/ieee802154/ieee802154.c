@@ -177,24 +177,24 @@ inline int ieee802154_wait_for_ack(struct net_if *iface, bool ack_required)
 
 int ieee802154_radio_send(struct net_if *iface, struct net_pkt *pkt, struct net_buf *frag)
 {
+	enum ieee802154_hw_caps hw_caps = ieee802154_radio_get_hw_capabilities(iface);
 	uint8_t remaining_attempts = CONFIG_NET_L2_IEEE802154_RADIO_TX_RETRIES + 1;
 	bool hw_csma, ack_required;
 	int ret;
 
 	NET_DBG("frag %p", frag);
 
-	if (ieee802154_radio_get_hw_capabilities(iface) & IEEE802154_HW_RETRANSMISSION) {
+	if (hw_caps & IEEE802154_HW_RETRANSMISSION) {
 		/* A driver that claims retransmission capability must also be able
 		 * to wait for ACK frames otherwise it could not decide whether or
 		 * not retransmission is required in a standard conforming way.
 		 */
-		__ASSERT_NO_MSG(ieee802154_radio_get_hw_capabilities(iface) &
-				IEEE802154_HW_TX_RX_ACK);
+		__ASSERT_NO_MSG(hw_caps & IEEE802154_HW_TX_RX_ACK);
 		remaining_attempts = 1;
 	}
 
 	hw_csma = IS_ENABLED(CONFIG_NET_L2_IEEE802154_RADIO_CSMA_CA) &&
-		  ieee802154_radio_get_hw_capabilities(iface) & IEEE802154_HW_CSMA;
+		  (hw_caps & IEEE802154_HW_CSMA);
 
 	/* Media access (CSMA, ALOHA, ...) and retransmission, see section 6.7.4.4. */
 	while (remaining_attempts) {
@@ -42,6 +42,9 @@ struct frag_cache {
 	struct net_pkt *pkt;	       /* Reassemble packet */
 	uint16_t size;		       /* Datagram size */
 	uint16_t tag;		       /* Datagram tag */
+	uint16_t received;	       /* Fragment payload received */
+	int hdr_diff;		       /* Uncompressed header growth, INT_MAX until known */
+	uint8_t offsets[32];	       /* Offsets received, one bit per 8 octets */
 	bool used;
 };
 
@@ -313,6 +316,9 @@ static inline struct frag_cache *set_reass_cache(struct net_pkt *pkt, uint16_t s
 		cache[i].pkt = pkt;
 		cache[i].size = size;
 		cache[i].tag = tag;
+		cache[i].received = 0U;
+		cache[i].hdr_diff = INT_MAX;
+		memset(cache[i].offsets, 0, sizeof(cache[i].offsets));
 		cache[i].used = true;
 
 		k_work_init_delayable(&cache[i].timer, reass_timeout);
@@ -355,29 +361,41 @@ static inline void fragment_append(struct net_pkt *pkt, struct net_buf *frag)
 	}
 }
 
-static inline size_t fragment_cached_pkt_len(struct net_pkt *pkt)
+/**
+ *  Account for a fragment in the cache, and return false if a fragment
+ *  with the same offset was already received.
+ */
+static inline bool fragment_account(struct frag_cache *fcache, struct net_buf *frag)
 {
-	size_t len = 0U;
-	struct net_buf *frag;
-	int hdr_diff;
-	uint8_t *data;
+	uint16_t frag_hdr_len = NET_6LO_FRAGN_HDR_LEN;
+	uint8_t unit = 0U;
 
-	frag = pkt->buffer;
-	while (frag) {
-		uint16_t frag_hdr_len = NET_6LO_FRAGN_HDR_LEN;
+	if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
+		frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
+	} else {
+		unit = frag->data[NET_FRAG_OFFSET_POS];
+	}
 
-		if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
-			frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
-		}
+	if (fcache->offsets[unit / 8U] & BIT(unit % 8U)) {
+		return false;
+	}
 
-		len += frag->len - frag_hdr_len;
+	fcache->offsets[unit / 8U] |= BIT(unit % 8U);
+	fcache->received += frag->len - frag_hdr_len;
 
-		frag = frag->frags;
-	}
+	return true;
+}
 
-	/* 6lo assumes that fragment header has been removed,
-	 * and in our side we assume first buffer is always the first fragment.
-	 */
+/**
+ *  Header growth once the first fragment is uncompressed, which is
+ *  always the first buffer of the packet once received.
+ */
+static inline int fragment_hdr_diff(struct net_pkt *pkt)
+{
+	int hdr_diff;
+	uint8_t *data;
+
+	/* 6lo assumes that fragment header has been removed */
 	data = pkt->buffer->data;
 	pkt->buffer->data += NET_6LO_FRAG1_HDR_LEN;
 
@@ -385,11 +403,7 @@ static inline size_t fragment_cached_pkt_len(struct net_pkt *pkt)
 
 	pkt->buffer->data = data;
 
-	if (hdr_diff == INT_MAX) {
-		return 0;
-	}
-
-	return len + hdr_diff;
+	return hdr_diff;
 }
 
 static inline uint16_t fragment_offset(struct net_buf *frag)
@@ -521,9 +535,19 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 		first_frag = true;
 	}
 
+	if (!fragment_account(fcache, frag)) {
+		NET_DBG("Duplicate fragment: fragment dropped");
+		pkt->buffer = frag;
+		return NET_DROP;
+	}
+
 	fragment_append(fcache->pkt, frag);
 
-	if (fragment_cached_pkt_len(fcache->pkt) == fcache->size) {
+	if (type == NET_6LO_DISPATCH_FRAG1) {
+		fcache->hdr_diff = fragment_hdr_diff(fcache->pkt);
+	}
+
+	if (fcache->hdr_diff != INT_MAX && fcache->received + fcache->hdr_diff == fcache->size) {
 		/* All fragments received - reassemble packet. */
 
 		if (!first_frag) {
@@ -25,6 +25,28 @@ BUILD_ASSERT(CONFIG_NET_L2_IEEE802154_RADIO_CSMA_CA_MIN_BE <=
 		     CONFIG_NET_L2_IEEE802154_RADIO_CSMA_CA_MAX_BE,
 	     "The CSMA/CA min backoff exponent must be less or equal max backoff exponent.");
 
+/* Backoffs reach several milliseconds at higher backoff exponents: sleep
+ * through the whole ticks so that the CPU is left to other threads, and only
+ * busy wait for the remainder, so that the backoff is not extended to a tick
+ * boundary.
+ */
+static void csma_ca_backoff(uint32_t backoff_us)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t ticks = k_us_to_ticks_floor32(backoff_us);
+	uint32_t elapsed_us;
+
+	/* A relative sleep may last up to one tick more than requested */
+	if (ticks > 1U) {
+		k_sleep(K_TICKS(ticks - 1U));
+	}
+
+	elapsed_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	if (elapsed_us < backoff_us) {
+		k_busy_wait(backoff_us - elapsed_us);
+	}
+}
+
 /* See section 6.2.5.1. */
 static inline int unslotted_csma_ca_channel_access(struct net_if *iface)
 {
@@ -48,7 +70,7 @@ static inline int unslotted_csma_ca_channel_access(struct net_if *iface)
 			 * radio API should expose a precise radio clock instead (which may
 			 * fall back to k_busy_wait() if the radio does not have a clock).
 			 */
-			k_busy_wait(bo_n * unit_backoff_period_us);
+			csma_ca_backoff(bo_n * unit_backoff_period_us);
 		}
 
 		ret = ieee802154_radio_cca(iface);
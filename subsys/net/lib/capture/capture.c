@@ -84,6 +84,21 @@ struct net_capture {
 	 */
 	struct net_sockaddr local;
 
+	/**
+	 * Filter selecting the packets to capture, NULL to capture all.
+	 */
+	net_capture_filter_cb_t filter;
+
+	/**
+	 * User data of the filter.
+	 */
+	void *filter_user_data;
+
+	/**
+	 * Maximum number of bytes captured per packet, 0 for no limit.
+	 */
+	size_t snaplen;
+
 	/**
 	 * Is this context setup already
 	 */
@@ -458,6 +473,9 @@ static int capture_cleanup(const struct device *dev)
 	(void)cleanup_iface(ctx->tunnel_iface, &ctx->local);
 
 	ctx->tunnel_iface = NULL;
+	ctx->filter = NULL;
+	ctx->filter_user_data = NULL;
+	ctx->snaplen = 0;
 	ctx->in_use = false;
 
 	return 0;
@@ -536,6 +554,12 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 			continue;
 		}
 
+		if (ctx->filter != NULL &&
+		    !ctx->filter(iface, pkt, ctx->filter_user_data)) {
+			ret = 0;
+			goto out;
+		}
+
 		/* If the packet is marked as "cooked", then it means that the
 		 * packet was directed here by "any" interface and was already
 		 * cooked mode captured. So no need to clone it here.
@@ -560,6 +584,15 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 				ret = -ENOMEM;
 				goto out;
 			}
+
+			if (ctx->snaplen > 0 &&
+			    net_pkt_get_len(captured) > ctx->snaplen) {
+				/* Release the tail right away, rather than
+				 * holding the capture buffers until sent.
+				 */
+				(void)net_pkt_update_length(captured, ctx->snaplen);
+				net_pkt_trim_buffer(captured);
+			}
 		}
 
 		net_pkt_set_orig_iface(captured, iface);
@@ -584,6 +617,34 @@ out:
 	return ret;
 }
 
+int net_capture_filter_set(const struct device *dev, net_capture_filter_cb_t cb,
+			   void *user_data)
+{
+	struct net_capture *ctx = dev->data;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	ctx->filter = cb;
+	ctx->filter_user_data = user_data;
+
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+
+int net_capture_snaplen_set(const struct device *dev, size_t snaplen)
+{
+	struct net_capture *ctx = dev->data;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	ctx->snaplen = snaplen;
+
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+
 void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 {
 	(void)net_capture_pkt_with_status(iface, pkt);
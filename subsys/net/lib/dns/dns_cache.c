@@ -12,6 +12,63 @@ LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
 
+static int query_type_to_family(enum dns_query_type type, net_sa_family_t *family)
+{
+	if (type == DNS_QUERY_TYPE_A) {
+		*family = NET_AF_INET;
+	} else if (type == DNS_QUERY_TYPE_AAAA) {
+		*family = NET_AF_INET6;
+	} else {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static bool is_same_address(struct dns_addrinfo const *a, struct dns_addrinfo const *b)
+{
+	if (a->ai_family != b->ai_family ||
+	    (a->ai_family != NET_AF_INET && a->ai_family != NET_AF_INET6)) {
+		return false;
+	}
+
+	return a->ai_addrlen == b->ai_addrlen &&
+	       memcmp(&a->ai_addr, &b->ai_addr, a->ai_addrlen) == 0;
+}
+
+/* Needs to be called when lock is already acquired */
+static void dns_cache_store(struct dns_cache *cache, char const *query,
+			    struct dns_addrinfo const *addrinfo, uint32_t ttl, bool negative)
+{
+	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
+	size_t index_to_replace = 0;
+	bool found_empty = false;
+
+	for (size_t i = 0; i < cache->size; i++) {
+		if (!cache->entries[i].in_use) {
+			index_to_replace = i;
+			found_empty = true;
+			break;
+		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
+			index_to_replace = i;
+			closest_to_expiry = cache->entries[i].expiry;
+		}
+	}
+
+	if (!found_empty) {
+		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+	}
+
+	strncpy(cache->entries[index_to_replace].query, query,
+		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	cache->entries[index_to_replace].data = *addrinfo;
+	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	cache->entries[index_to_replace].ttl = ttl;
+	cache->entries[index_to_replace].negative = negative;
+	cache->entries[index_to_replace].prefetched = false;
+	cache->entries[index_to_replace].in_use = true;
+}
+
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
@@ -26,10 +83,6 @@ int dns_cache_flush(struct dns_cache *cache)
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl)
 {
-	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
-	size_t index_to_replace = 0;
-	bool found_empty = false;
-
 	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
 		return -EINVAL;
 	}
@@ -48,25 +101,66 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
-			index_to_replace = i;
-			found_empty = true;
-			break;
-		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
-			index_to_replace = i;
-			closest_to_expiry = cache->entries[i].expiry;
+		struct dns_cache_entry *entry = &cache->entries[i];
+
+		if (!entry->in_use || strcmp(entry->query, query) != 0) {
+			continue;
+		}
+
+		if (entry->negative && entry->data.ai_family == addrinfo->ai_family) {
+			entry->in_use = false;
+		} else if (entry->prefetched && is_same_address(&entry->data, addrinfo)) {
+			/* Answer to a prefetch, refresh the entry instead of duplicating it */
+			entry->expiry = sys_timepoint_calc(K_SECONDS(ttl));
+			entry->ttl = ttl;
+			entry->prefetched = false;
+			k_mutex_unlock(cache->lock);
+			return 0;
 		}
 	}
 
-	if (!found_empty) {
-		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+	dns_cache_store(cache, query, addrinfo, ttl, false);
+
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl)
+{
+	struct dns_addrinfo addrinfo = { 0 };
+	net_sa_family_t family;
+
+	if (cache == NULL || query == NULL || ttl == 0 ||
+	    query_type_to_family(type, &family) < 0) {
+		return -EINVAL;
 	}
 
-	strncpy(cache->entries[index_to_replace].query, query,
-		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
-	cache->entries[index_to_replace].data = *addrinfo;
-	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
-	cache->entries[index_to_replace].in_use = true;
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		return -EINVAL;
+	}
+
+	addrinfo.ai_family = family;
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	NET_DBG("Add negative \"%s\" with TTL %" PRIu32, query, ttl);
+
+	dns_cache_clean(cache);
+
+	for (size_t i = 0; i < cache->size; i++) {
+		struct dns_cache_entry *entry = &cache->entries[i];
+
+		/* Keep the answers other servers gave */
+		if (entry->in_use && entry->data.ai_family == family &&
+		    strcmp(entry->query, query) == 0) {
+			k_mutex_unlock(cache->lock);
+			return 0;
+		}
+	}
+
+	dns_cache_store(cache, query, &addrinfo, ttl, true);
 
 	k_mutex_unlock(cache->lock);
 
@@ -106,17 +200,14 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len)
 {
 	size_t found = 0;
+	bool negative = false;
 	net_sa_family_t family;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
 		return -EINVAL;
 	}
-	if (type == DNS_QUERY_TYPE_A) {
-		family = NET_AF_INET;
-	} else if (type == DNS_QUERY_TYPE_AAAA) {
-		family = NET_AF_INET6;
-	} else {
+	if (query_type_to_family(type, &family) < 0) {
 		return -EINVAL;
 	}
 	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
@@ -140,6 +231,10 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		if (cache->entries[i].data.ai_family != family) {
 			continue;
 		}
+		if (cache->entries[i].negative) {
+			negative = true;
+			continue;
+		}
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
@@ -156,12 +251,52 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -ENOSR;
 	}
 
+	if (found == 0 && negative) {
+		NET_DBG("\"%s\" cached as not existing", query);
+		return -ENOENT;
+	}
+
 	if (found == 0) {
 		NET_DBG("Could not find \"%s\"", query);
 	}
 	return found;
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE_PREFETCH)
+bool dns_cache_prefetch_due(struct dns_cache *cache, const char *query, enum dns_query_type type)
+{
+	net_sa_family_t family;
+	bool due = false;
+
+	if (cache == NULL || query == NULL || query_type_to_family(type, &family) < 0) {
+		return false;
+	}
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	for (size_t i = 0; i < cache->size; i++) {
+		struct dns_cache_entry *entry = &cache->entries[i];
+		uint64_t remaining_ms;
+
+		if (!entry->in_use || entry->negative || entry->prefetched ||
+		    entry->data.ai_family != family || strcmp(entry->query, query) != 0) {
+			continue;
+		}
+
+		remaining_ms = k_ticks_to_ms_floor64(sys_timepoint_timeout(entry->expiry).ticks);
+		if (remaining_ms * 100U <
+		    (uint64_t)entry->ttl * MSEC_PER_SEC * CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT) {
+			entry->prefetched = true;
+			due = true;
+		}
+	}
+
+	k_mutex_unlock(cache->lock);
+
+	return due;
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_PREFETCH */
+
 /* Needs to be called when lock is already acquired */
 static void dns_cache_clean(struct dns_cache const *cache)
 {
@@ -22,7 +22,12 @@ struct dns_cache_entry {
 	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
+	uint32_t ttl;
 	bool in_use;
+	/* The query has no answer, only data.ai_family is valid */
+	bool negative;
+	/* A refresh of the entry was requested */
+	bool prefetched;
 };
 
 struct dns_cache {
@@ -57,7 +62,8 @@ int dns_cache_flush(struct dns_cache *cache);
 
 /**
  * @brief Adds a new entry to the dns cache removing the one closest to expiry
- * if no free space is available.
+ * if no free space is available. Negative entries of the query are removed,
+ * and an entry due for refresh with the same address is refreshed instead.
  *
  * @param cache Cache where the entry should be added.
  * @param query Query which should be persisted in the cache.
@@ -71,6 +77,20 @@ int dns_cache_flush(struct dns_cache *cache);
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl);
 
+/**
+ * @brief Adds a negative entry to the dns cache, recording that the query
+ * has no answer of the given type.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which should be persisted in the cache.
+ * @param type Query type which has no answer.
+ * @param ttl Time to live for the entry in seconds, see RFC 2308.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl);
+
 /**
  * @brief Removes all entries with the given query
  *
@@ -94,8 +114,23 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
  * @retval On error a negative value is returned.
  * -ENOSR means there was not enough space in the addrinfo array to accommodate all cache hits the
  * array will however be filled with valid data.
+ * -ENOENT means the query is cached as having no answer of this type.
  */
 int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len);
 
+/**
+ * @brief Checks whether the entries of a query should be refreshed.
+ *
+ * This is the case once per entry, when its remaining time to live is below
+ * CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT of the original one.
+ *
+ * @param cache Cache where the entry should be searched.
+ * @param query Query which should be searched for.
+ * @param type Query type of the entries.
+ * @retval true if the query should be resolved again.
+ * @retval false otherwise.
+ */
+bool dns_cache_prefetch_due(struct dns_cache *cache, const char *query, enum dns_query_type type);
+
 #endif /* ZEPHYR_INCLUDE_NET_DNS_CACHE_H_ */
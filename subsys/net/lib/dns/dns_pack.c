@@ -367,6 +367,92 @@ int dns_unpack_response_query(struct dns_msg_t *dns_msg)
 	return 0;
 }
 
+/* Skip a resource record, returns its size or negative error code. */
+static int skip_rr(uint8_t *rr, int buf_sz)
+{
+	int dname_len;
+	int len;
+
+	dname_len = skip_fqdn(rr, buf_sz);
+	if (dname_len < 0) {
+		return dname_len;
+	}
+
+	len = dname_len + DNS_COMMON_UINT_SIZE + DNS_COMMON_UINT_SIZE +
+	      DNS_TTL_LEN + DNS_RDLENGTH_LEN;
+	if (len > buf_sz) {
+		return -EINVAL;
+	}
+
+	len += dns_answer_rdlength(dname_len, rr);
+	if (len > buf_sz) {
+		return -EINVAL;
+	}
+
+	return len;
+}
+
+int dns_unpack_negative_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl)
+{
+	int pos = DNS_MSG_HEADER_SIZE;
+	int size = dns_msg->msg_size;
+	uint8_t *rr;
+	int dname_len;
+	int len;
+	int i;
+
+	if (size < DNS_MSG_HEADER_SIZE) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < dns_header_qdcount(dns_msg->msg); i++) {
+		len = skip_fqdn(dns_msg->msg + pos, size - pos);
+		if (len < 0) {
+			return len;
+		}
+
+		pos += len + DNS_QTYPE_LEN + DNS_QCLASS_LEN;
+		if (pos > size) {
+			return -EINVAL;
+		}
+	}
+
+	for (i = 0; i < dns_header_ancount(dns_msg->msg); i++) {
+		len = skip_rr(dns_msg->msg + pos, size - pos);
+		if (len < 0) {
+			return len;
+		}
+
+		pos += len;
+	}
+
+	for (i = 0; i < dns_header_nscount(dns_msg->msg); i++) {
+		rr = dns_msg->msg + pos;
+
+		len = skip_rr(rr, size - pos);
+		if (len < 0) {
+			return len;
+		}
+
+		dname_len = skip_fqdn(rr, size - pos);
+
+		/* The MINIMUM field ends the SOA RDATA, RFC 1035 ch. 3.3.13 */
+		if (dns_answer_type(dname_len, rr) == DNS_RR_TYPE_SOA &&
+		    dns_answer_rdlength(dname_len, rr) >= DNS_TTL_LEN) {
+			uint32_t minimum = net_ntohl(UNALIGNED_GET(
+						(uint32_t *)(rr + len - DNS_TTL_LEN)));
+
+			*ttl = MIN((uint32_t)dns_answer_ttl(dname_len, rr), minimum);
+
+			return 0;
+		}
+
+		pos += len;
+	}
+
+	return -ENOENT;
+}
+
 int dns_copy_qname(uint8_t *buf, uint16_t *len, uint16_t size,
 		   struct dns_msg_t *dns_msg, uint16_t pos)
 {
@@ -89,6 +89,7 @@ enum dns_rr_type {
 	DNS_RR_TYPE_INVALID = 0,
 	DNS_RR_TYPE_A	= 1,		/* IPv4  */
 	DNS_RR_TYPE_CNAME = 5,		/* CNAME */
+	DNS_RR_TYPE_SOA = 6,		/* SOA   */
 	DNS_RR_TYPE_PTR = 12,		/* PTR   */
 	DNS_RR_TYPE_TXT = 16,		/* TXT   */
 	DNS_RR_TYPE_AAAA = 28,		/* IPv6  */
@@ -420,6 +421,21 @@ int dns_msg_pack_query(uint8_t *buf, uint16_t *len, uint16_t size,
  */
 int dns_unpack_response_query(struct dns_msg_t *dns_msg);
 
+/**
+ * @brief Gets the time a negative answer can be cached
+ *
+ * @details As described in RFC 2308, the time is the smaller of the TTL of
+ *          the SOA record found in the authority section and of its MINIMUM
+ *          field.
+ *
+ * @param dns_msg Structure containing the message.
+ * @param ttl Time to cache the answer, in seconds.
+ * @retval 0 on success
+ * @retval -ENOENT if the message has no SOA record in its authority section
+ * @retval -EINVAL if the message is malformed
+ */
+int dns_unpack_negative_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl);
+
 /**
  * @brief Copies the qname from dns_msg to buf
  *
@@ -271,6 +271,24 @@ static void dns_postprocess_server(struct dns_resolve_context *ctx, int idx)
 	}
 }
 
+#if defined(CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS)
+/* Tells whether the response is a definite one, i.e. the name exists or
+ * does not exist, so that there is no point waiting for other servers.
+ */
+static bool is_final_answer(struct net_buf *dns_data, size_t len)
+{
+	uint8_t rcode;
+
+	if (len < DNS_MSG_HEADER_SIZE) {
+		return false;
+	}
+
+	rcode = dns_header_rcode(dns_data->data);
+
+	return rcode == DNS_HEADER_NOERROR || rcode == DNS_HEADER_NAMEERROR;
+}
+#endif /* CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS */
+
 static int dispatcher_cb(struct dns_socket_dispatcher *my_ctx, int sock,
 			 struct net_sockaddr *addr, size_t addrlen,
 			 struct net_buf *dns_data, size_t len)
@@ -338,6 +356,10 @@ static int dispatcher_cb(struct dns_socket_dispatcher *my_ctx, int sock,
 
 		ctx->queries[i].additional_queries++;
 
+#if defined(CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS)
+		ctx->queries[i].servers_pending = ntry - nfail;
+#endif /* CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS */
+
 		if (nfail > 0) {
 			NET_DBG("DNS cname query %d fails on %d attempts",
 				nfail, ntry);
@@ -356,6 +378,16 @@ quit:
 		goto free_buf;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS)
+	/* A server failing to answer does not end the query as long as
+	 * other servers may still answer it.
+	 */
+	if (ctx->queries[i].servers_pending > 1 && !is_final_answer(dns_data, len)) {
+		ctx->queries[i].servers_pending--;
+		goto free_buf;
+	}
+#endif /* CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS */
+
 	invoke_query_callback(ret, NULL, &ctx->queries[i]);
 
 	/* Marks the end of the results */
@@ -1263,6 +1295,42 @@ static int dns_validate_record(struct dns_resolve_context *ctx, struct dns_msg_t
 	return 0;
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+/* Remember that the name, or the requested record type of it, does not
+ * exist. As per RFC 2308, the negative answer is only cached if the
+ * server sent the SOA record of the zone.
+ */
+static void cache_negative_answer(struct dns_resolve_context *ctx,
+				  struct dns_msg_t *dns_msg,
+				  uint16_t dns_id)
+{
+	uint8_t rcode = dns_header_rcode(dns_msg->msg);
+	uint32_t ttl;
+	int i;
+
+	if (rcode != DNS_HEADER_NOERROR && rcode != DNS_HEADER_NAMEERROR) {
+		return;
+	}
+
+	i = get_slot_by_id(ctx, dns_id, 0);
+	if (i < 0) {
+		return;
+	}
+
+	if (dns_unpack_negative_ttl(dns_msg, &ttl) < 0) {
+		return;
+	}
+
+	ttl = MIN(ttl, CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_MAX_TTL);
+
+	NET_DBG("Caching negative answer for \"%s\" (TTL %u)",
+		ctx->queries[i].query, ttl);
+
+	(void)dns_cache_add_negative(&dns_cache, ctx->queries[i].query,
+				     ctx->queries[i].query_type, ttl);
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_NEGATIVE */
+
 /* Unit test needs to be able to call this function */
 #if !defined(CONFIG_NET_TEST)
 static
@@ -1325,6 +1393,9 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 	if (dns_header_ancount(dns_msg->msg) < 1) {
 		/* there are no useful records in this message */
 		if (*dns_id > 0) {
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+			cache_negative_answer(ctx, dns_msg, *dns_id);
+#endif /* CONFIG_DNS_RESOLVER_CACHE_NEGATIVE */
 			ret = DNS_EAI_FAIL;
 			goto quit;
 		}
@@ -1831,6 +1902,55 @@ static void query_timeout(struct k_work *work)
 	k_mutex_unlock(&pending_query->ctx->lock);
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE_PREFETCH)
+/* Only one prefetch runs at a time, so a single copy of the name is needed */
+static char prefetch_query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
+static atomic_t prefetch_running;
+
+static void prefetch_cb(enum dns_resolve_status status,
+			struct dns_addrinfo *info,
+			void *user_data)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	/* The answers are added to the cache while they are received */
+	if (status != DNS_EAI_INPROGRESS) {
+		atomic_clear(&prefetch_running);
+	}
+}
+
+/* Resolve a cached name again in the background when its entries are
+ * about to expire, so that the following lookups keep hitting the cache.
+ */
+static void dns_prefetch(struct dns_resolve_context *ctx, const char *query,
+			 enum dns_query_type type, int32_t timeout)
+{
+	int ret;
+
+	if (!atomic_cas(&prefetch_running, 0, 1)) {
+		return;
+	}
+
+	if (!dns_cache_prefetch_due(&dns_cache, query, type)) {
+		atomic_clear(&prefetch_running);
+		return;
+	}
+
+	strncpy(prefetch_query, query, sizeof(prefetch_query) - 1);
+	prefetch_query[sizeof(prefetch_query) - 1] = '\0';
+
+	NET_DBG("Prefetching \"%s\"", prefetch_query);
+
+	ret = dns_resolve_name_internal(ctx, prefetch_query, type, NULL,
+					prefetch_cb, NULL, timeout, false);
+	if (ret < 0) {
+		NET_DBG("Cannot prefetch \"%s\" (%d)", prefetch_query, ret);
+		atomic_clear(&prefetch_running);
+	}
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_PREFETCH */
+
 int dns_resolve_name_internal(struct dns_resolve_context *ctx,
 			      const char *query,
 			      enum dns_query_type type,
@@ -1926,6 +2046,17 @@ try_resolve:
 
 			cb(DNS_EAI_ALLDONE, NULL, user_data);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE_PREFETCH)
+			dns_prefetch(ctx, query, type, timeout);
+#endif /* CONFIG_DNS_RESOLVER_CACHE_PREFETCH */
+
+			return 0;
+		}
+
+		if (ret == -ENOENT) {
+			/* The name is cached as not existing */
+			cb(DNS_EAI_FAIL, NULL, user_data);
+
 			return 0;
 		}
 	}
@@ -2139,13 +2270,19 @@ try_resolve:
 			continue;
 		}
 
-		/* Do one concurrent query only for each name resolve.
-		 * TODO: Change the i (query index) to do multiple concurrent
-		 *       to each server.
+		/* With CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS the query is sent
+		 * to every server and the first answer wins. Otherwise do one
+		 * concurrent query only for each name resolve.
 		 */
-		break;
+		if (!IS_ENABLED(CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS)) {
+			break;
+		}
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS)
+	ctx->queries[i].servers_pending = ntry - nfail;
+#endif /* CONFIG_DNS_RESOLVER_QUERY_ALL_SERVERS */
+
 	if (nfail > 0) {
 		NET_DBG("DNS query %d fails on %d attempts", nfail, ntry);
 	}
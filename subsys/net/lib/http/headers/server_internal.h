@@ -43,11 +43,31 @@ void http_compression_parse_accept_encoding(const char *accept_encoding, size_t
 const char *http_compression_text(enum http_compression compression);
 int http_compression_from_text(enum http_compression *compression, const char *text);
 bool compression_value_is_valid(enum http_compression compression);
+const struct http_resource_static_variant *
+http_compression_pick_variant(const struct http_resource_static_variant *variants,
+			      size_t num_variants, uint8_t supported_compression);
+
+/* Static resource handling */
+#define HTTP_SERVER_ETAG_LEN sizeof("\"01234567\"")
+void http_server_get_static_content(struct http_client_ctx *client,
+				    struct http_resource_detail_static *static_detail,
+				    const void **data, size_t *len, const char **encoding);
+uint32_t http_server_etag_digest(const void *data, size_t len);
+void http_server_etag_text(uint32_t digest, char *buf, size_t buflen);
+void http_server_parse_if_none_match(struct http_client_ctx *client, const char *value,
+				     size_t len);
+bool http_server_etag_match(struct http_client_ctx *client, uint32_t digest);
 
 /* Others */
 struct http_resource_detail *get_resource_detail(const struct http_service_desc *service,
 						 const char *path, int *len, bool is_ws);
 int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len);
+int http_server_sendv(struct http_client_ctx *client, struct net_iovec *iov, size_t iovcnt);
+int http_server_send_static(struct http_client_ctx *client, const void *hdr, size_t hdr_len,
+			    const void *data, size_t len);
+bool http_server_tx_pending(struct http_client_ctx *client);
+int http_server_tx_flush(struct http_client_ctx *client, bool wait);
+int send_pending_data_frames(struct http_client_ctx *client);
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size);
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size,
@@ -381,6 +381,7 @@ static int on_message_complete(struct http_parser *parser)
 		http_method_str(req->method));
 
 	req->internal.response.message_complete = 1;
+	req->internal.response.keep_alive = http_should_keep_alive(parser) != 0;
 
 	return 0;
 }
@@ -638,6 +639,7 @@ int http_client_req(int sock, struct http_request *req,
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
 	int ret, total_recv, i;
+	size_t payload_len = 0;
 	const char *method;
 	k_timeout_t req_timeout = (timeout == SYS_FOREVER_MS) ? K_FOREVER : K_MSEC(timeout);
 	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
@@ -768,36 +770,44 @@ int http_client_req(int sock, struct http_request *req,
 
 		total_sent += ret;
 
-		ret = http_flush_data(sock, send_buf, send_buf_pos, req_end_timepoint);
-		if (ret < 0) {
-			goto out;
+		if (req->payload_cb == NULL) {
+			payload_len = (req->payload_len == 0) ? strlen(req->payload)
+							      : req->payload_len;
 		}
 
-		send_buf_pos = 0;
-		total_sent += ret;
-
-		if (req->payload_cb) {
-			ret = req->payload_cb(sock, req, user_data);
+		if (req->payload_cb == NULL &&
+		    payload_len <= send_buf_max_len - send_buf_pos) {
+			/* Send a small payload together with the headers, so that
+			 * the whole request goes out at once instead of the payload
+			 * being held back until the headers are acknowledged, which
+			 * shows most on kept-alive connections.
+			 */
+			memcpy(&send_buf[send_buf_pos], req->payload, payload_len);
+			send_buf_pos += payload_len;
+		} else {
+			ret = http_flush_data(sock, send_buf, send_buf_pos, req_end_timepoint);
 			if (ret < 0) {
 				goto out;
 			}
 
+			send_buf_pos = 0;
 			total_sent += ret;
-		} else {
-			uint32_t length;
 
-			if (req->payload_len == 0) {
-				length = strlen(req->payload);
+			if (req->payload_cb) {
+				ret = req->payload_cb(sock, req, user_data);
+				if (ret < 0) {
+					goto out;
+				}
+
+				total_sent += ret;
 			} else {
-				length = req->payload_len;
-			}
+				ret = sendall(sock, req->payload, payload_len, req_end_timepoint);
+				if (ret < 0) {
+					goto out;
+				}
 
-			ret = sendall(sock, req->payload, length, req_end_timepoint);
-			if (ret < 0) {
-				goto out;
+				total_sent += payload_len;
 			}
-
-			total_sent += length;
 		}
 	} else {
 		ret = http_send_data(sock, send_buf, send_buf_max_len,
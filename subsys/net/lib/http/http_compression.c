@@ -72,6 +72,30 @@ void http_compression_parse_accept_encoding(const char *accept_encoding, size_t
 	}
 }
 
+const struct http_resource_static_variant *
+http_compression_pick_variant(const struct http_resource_static_variant *variants,
+			      size_t num_variants, uint8_t supported_compression)
+{
+	/* Same order of preference as for the files of the file system */
+	static const enum http_compression preference[] = {
+		HTTP_BR, HTTP_GZIP, HTTP_ZSTD, HTTP_COMPRESS, HTTP_DEFLATE,
+	};
+
+	ARRAY_FOR_EACH(preference, i) {
+		if (!IS_BIT_SET(supported_compression, preference[i])) {
+			continue;
+		}
+
+		for (size_t j = 0; j < num_variants; j++) {
+			if (variants[j].compression == preference[i]) {
+				return &variants[j];
+			}
+		}
+	}
+
+	return NULL;
+}
+
 const char *http_compression_text(enum http_compression compression)
 {
 	switch (compression) {
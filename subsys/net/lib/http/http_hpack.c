@@ -465,7 +465,7 @@ static int hpack_integer_encode(uint8_t *buf, size_t buflen, int value,
 			return -ENOBUFS;
 		}
 
-		*buf = (uint8_t)((value % 128) + 128);
+		*buf++ = (uint8_t)((value % 128) + 128);
 		len++;
 		value /= 128;
 	}
@@ -529,14 +529,12 @@ static int hpack_string_encode(uint8_t *buf, size_t buflen,
 	return len;
 }
 
-static int hpack_encode_literal(uint8_t *buf, size_t buflen,
+static int hpack_encode_literal(uint8_t *buf, size_t buflen, uint8_t prefix, uint8_t n,
 				struct http_hpack_header_buf *header)
 {
 	int ret, len = 0;
 
-	ret = hpack_integer_encode(buf, buflen, 0,
-				   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
-				   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
+	ret = hpack_integer_encode(buf, buflen, 0, prefix, n);
 	if (ret < 0) {
 		return ret;
 	}
@@ -564,14 +562,13 @@ static int hpack_encode_literal(uint8_t *buf, size_t buflen,
 	return len;
 }
 
-static int hpack_encode_literal_value(uint8_t *buf, size_t buflen, int index,
+static int hpack_encode_literal_value(uint8_t *buf, size_t buflen, uint8_t prefix,
+				      uint8_t n, int index,
 				      struct http_hpack_header_buf *header)
 {
 	int ret, len = 0;
 
-	ret = hpack_integer_encode(buf, buflen, index,
-				   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
-				   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
+	ret = hpack_integer_encode(buf, buflen, index, prefix, n);
 	if (ret < 0) {
 		return ret;
 	}
@@ -615,10 +612,13 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 	ret = http_hpack_find_index(header, &name_only);
 	if (ret < 0) {
 		/* All literal */
-		len = hpack_encode_literal(buf, buflen, header);
+		len = hpack_encode_literal(buf, buflen, HPACK_PREFIX_LITERAL_NEVER_INDEXED,
+					   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED, header);
 	} else if (name_only) {
 		/* Literal value */
-		len = hpack_encode_literal_value(buf, buflen, ret, header);
+		len = hpack_encode_literal_value(buf, buflen, HPACK_PREFIX_LITERAL_NEVER_INDEXED,
+						 HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED, ret,
+						 header);
 	} else {
 		/* Indexed */
 		len = hpack_encode_indexed(buf, buflen, ret);
@@ -626,3 +626,196 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 
 	return len;
 }
+
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+/* Size of an entry as defined in RFC7541, ch 4.1. */
+#define HPACK_ENTRY_OVERHEAD 32
+#define HPACK_DYNAMIC_INDEX_FIRST (HTTP_SERVER_HPACK_WWW_AUTHENTICATE + 1)
+
+/* Entries are stored as name length, value length, name and value, from
+ * the oldest to the newest.
+ */
+static void hpack_table_evict_oldest(struct http_hpack_table *table)
+{
+	size_t entry_len = 2 + table->buf[0] + table->buf[1];
+
+	table->size -= entry_len - 2 + HPACK_ENTRY_OVERHEAD;
+	table->used -= entry_len;
+	table->count--;
+	memmove(table->buf, table->buf + entry_len, table->used);
+}
+
+static void hpack_table_add(struct http_hpack_table *table,
+			    struct http_hpack_header_buf *header)
+{
+	size_t entry_size = header->name_len + header->value_len + HPACK_ENTRY_OVERHEAD;
+	uint8_t *entry;
+
+	while (table->count > 0 && table->size + entry_size > table->max_size) {
+		hpack_table_evict_oldest(table);
+	}
+
+	entry = table->buf + table->used;
+	entry[0] = header->name_len;
+	entry[1] = header->value_len;
+	memcpy(&entry[2], header->name, header->name_len);
+	memcpy(&entry[2 + header->name_len], header->value, header->value_len);
+
+	table->used += 2 + header->name_len + header->value_len;
+	table->size += entry_size;
+	table->count++;
+}
+
+/* Returns the position of the entry from the newest one, preferring an
+ * exact match over a match of the name only.
+ */
+static int hpack_table_find(struct http_hpack_table *table,
+			    struct http_hpack_header_buf *header, bool *name_only)
+{
+	const uint8_t *entry = table->buf;
+	int candidate = -1;
+
+	for (int i = table->count - 1; i >= 0; i--) {
+		const uint8_t *name = &entry[2];
+		const uint8_t *value = &entry[2 + entry[0]];
+
+		if (entry[0] == header->name_len &&
+		    memcmp(name, header->name, header->name_len) == 0) {
+			if (entry[1] == header->value_len &&
+			    memcmp(value, header->value, header->value_len) == 0) {
+				*name_only = false;
+				return i;
+			}
+
+			candidate = i;
+		}
+
+		entry += 2 + entry[0] + entry[1];
+	}
+
+	if (candidate >= 0) {
+		*name_only = true;
+	}
+
+	return candidate;
+}
+
+void http_hpack_table_init(struct http_hpack_table *table, size_t max_size)
+{
+	table->used = 0;
+	table->count = 0;
+	table->size = 0;
+	table->max_size = 0;
+
+	http_hpack_table_set_max_size(table, max_size);
+}
+
+void http_hpack_table_set_max_size(struct http_hpack_table *table, size_t max_size)
+{
+	/* Entries never take more storage than their accounted size. */
+	max_size = MIN(max_size, sizeof(table->buf));
+	if (max_size == table->max_size) {
+		return;
+	}
+
+	table->max_size = max_size;
+	table->size_update = true;
+
+	while (table->count > 0 && table->size > table->max_size) {
+		hpack_table_evict_oldest(table);
+	}
+}
+
+int http_hpack_encode_header_table(struct http_hpack_table *table, uint8_t *buf,
+				   size_t buflen, struct http_hpack_header_buf *header)
+{
+	bool name_only = false;
+	size_t entry_size;
+	int static_index;
+	int dynamic_index;
+	int ret, len = 0;
+
+	if (table == NULL || buf == NULL || header == NULL ||
+	    header->name == NULL || header->name_len == 0 ||
+	    header->value == NULL || header->value_len == 0) {
+		return -EINVAL;
+	}
+
+	if (buflen == 0) {
+		return -ENOBUFS;
+	}
+
+	/* A change of the maximum size is signaled at the beginning of the
+	 * next header block.
+	 */
+	if (table->size_update) {
+		ret = hpack_integer_encode(buf, buflen, table->max_size,
+					   HPACK_PREFIX_DYNAMIC_TABLE_SIZE_UPDATE,
+					   HPACK_PREFIX_LEN_DYNAMIC_TABLE_SIZE_UPDATE);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	static_index = http_hpack_find_index(header, &name_only);
+	if (static_index > 0 && !name_only) {
+		ret = hpack_encode_indexed(buf, buflen, static_index);
+		goto out;
+	}
+
+	dynamic_index = hpack_table_find(table, header, &name_only);
+	if (dynamic_index >= 0 && !name_only) {
+		ret = hpack_encode_indexed(buf, buflen,
+					   HPACK_DYNAMIC_INDEX_FIRST + dynamic_index);
+		goto out;
+	}
+
+	if (static_index < 0 && dynamic_index >= 0) {
+		static_index = HPACK_DYNAMIC_INDEX_FIRST + dynamic_index;
+	}
+
+	entry_size = header->name_len + header->value_len + HPACK_ENTRY_OVERHEAD;
+	if (entry_size > table->max_size ||
+	    header->name_len > UINT8_MAX || header->value_len > UINT8_MAX) {
+		/* Would flush the whole table, do not index it. */
+		if (static_index < 0) {
+			ret = hpack_encode_literal(buf, buflen,
+						   HPACK_PREFIX_LITERAL_NO_INDEXING,
+						   HPACK_PREFIX_LEN_LITERAL_NO_INDEXING, header);
+		} else {
+			ret = hpack_encode_literal_value(buf, buflen,
+							 HPACK_PREFIX_LITERAL_NO_INDEXING,
+							 HPACK_PREFIX_LEN_LITERAL_NO_INDEXING,
+							 static_index, header);
+		}
+
+		goto out;
+	}
+
+	if (static_index < 0) {
+		ret = hpack_encode_literal(buf, buflen, HPACK_PREFIX_LITERAL_INDEXING,
+					   HPACK_PREFIX_LEN_LITERAL_INDEXING, header);
+	} else {
+		ret = hpack_encode_literal_value(buf, buflen, HPACK_PREFIX_LITERAL_INDEXING,
+						 HPACK_PREFIX_LEN_LITERAL_INDEXING,
+						 static_index, header);
+	}
+
+	if (ret >= 0) {
+		hpack_table_add(table, header);
+	}
+
+out:
+	if (ret < 0) {
+		return ret;
+	}
+
+	table->size_update = false;
+
+	return len + ret;
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
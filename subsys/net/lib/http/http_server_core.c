@@ -22,6 +22,7 @@
 #include <zephyr/net/tls_credentials.h>
 #include <zephyr/zvfs/eventfd.h>
 #include <zephyr/posix/fnmatch.h>
+#include <zephyr/sys/crc.h>
 #include <zephyr/sys/util_macro.h>
 
 LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
@@ -432,6 +433,21 @@ static void init_client_ctx(struct http_client_ctx *client, const struct http_se
 	client->has_upgrade_header = false;
 	client->preface_sent = false;
 	client->window_size = HTTP_SERVER_INITIAL_WINDOW_SIZE;
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	client->send_window = HTTP2_DEFAULT_WINDOW_SIZE;
+	client->peer_initial_window_size = HTTP2_DEFAULT_WINDOW_SIZE;
+	client->peer_max_frame_size = HTTP2_DEFAULT_MAX_FRAME_SIZE;
+	client->next_stream = 0;
+#endif
+#if defined(CONFIG_HTTP_SERVER_NONBLOCKING)
+	client->tx_head = 0;
+	client->tx_len = 0;
+	client->tx_ref_data = NULL;
+	client->tx_ref_len = 0;
+#endif
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+	http_hpack_table_init(&client->hpack_table, CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE);
+#endif
 
 	memset(client->buffer, 0, sizeof(client->buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
@@ -479,6 +495,13 @@ static int handle_http_done(struct http_client_ctx *client)
 
 int enter_http_done_state(struct http_client_ctx *client)
 {
+	if (http_server_tx_pending(client)) {
+		/* The connection is closed once the queued output is sent. */
+		client->server_state = HTTP_SERVER_DONE_STATE;
+
+		return -EAGAIN;
+	}
+
 	close_client_connection(client);
 
 	client->server_state = HTTP_SERVER_DONE_STATE;
@@ -551,6 +574,70 @@ static int handle_http_request(struct http_client_ctx *client)
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_NONBLOCKING)
+/* Clients with queued output are polled for writing only, so that they
+ * don't submit new requests before reading the previous responses. Clients
+ * not reading their output before the deadline are dropped. Returns the
+ * poll timeout until the nearest deadline.
+ */
+static int update_client_events(struct http_server_ctx *ctx)
+{
+	int64_t now = k_uptime_get();
+	int64_t timeout = -1;
+
+	for (int i = ctx->listen_fds; i < ARRAY_SIZE(ctx->fds); i++) {
+		struct http_client_ctx *client = &ctx->clients[i - ctx->listen_fds];
+
+		if (ctx->fds[i].fd < 0) {
+			continue;
+		}
+
+		if (!http_server_tx_pending(client)) {
+			ctx->fds[i].events = ZSOCK_POLLIN;
+			continue;
+		}
+
+		if (client->tx_deadline <= now) {
+			LOG_DBG("Client #%d not reading its output", i - ctx->listen_fds);
+			close_client_connection(client);
+			continue;
+		}
+
+		ctx->fds[i].events = ZSOCK_POLLOUT;
+
+		if (timeout < 0 || client->tx_deadline - now < timeout) {
+			timeout = client->tx_deadline - now;
+		}
+	}
+
+	return (int)timeout;
+}
+
+static int handle_http_output(struct http_client_ctx *client)
+{
+	int ret;
+
+	ret = http_server_tx_flush(client, false);
+	if (ret < 0 || http_server_tx_pending(client)) {
+		return ret;
+	}
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	/* Continue with the static content of HTTP/2 streams. */
+	ret = send_pending_data_frames(client);
+	if (ret < 0 || http_server_tx_pending(client)) {
+		return ret;
+	}
+#endif
+
+	if (client->server_state == HTTP_SERVER_DONE_STATE) {
+		close_client_connection(client);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_HTTP_SERVER_NONBLOCKING */
+
 static int http_server_run(struct http_server_ctx *ctx)
 {
 	struct http_client_ctx *client;
@@ -560,12 +647,17 @@ static int http_server_run(struct http_server_ctx *ctx)
 	int new_socket;
 	int ret, i, j;
 	int sock_error;
+	int timeout = -1;
 	net_socklen_t optlen = sizeof(int);
 
 	value = 0;
 
 	while (1) {
-		ret = zsock_poll(ctx->fds, HTTP_SERVER_SOCK_COUNT, -1);
+#if defined(CONFIG_HTTP_SERVER_NONBLOCKING)
+		timeout = update_client_events(ctx);
+#endif
+
+		ret = zsock_poll(ctx->fds, HTTP_SERVER_SOCK_COUNT, timeout);
 		if (ret < 0) {
 			ret = -errno;
 			LOG_DBG("poll failed (%d)", ret);
@@ -573,6 +665,11 @@ static int http_server_run(struct http_server_ctx *ctx)
 		}
 
 		if (ret == 0) {
+			if (IS_ENABLED(CONFIG_HTTP_SERVER_NONBLOCKING)) {
+				/* Output deadline of a client */
+				continue;
+			}
+
 			/* should not happen because timeout is -1 */
 			break;
 		}
@@ -624,6 +721,21 @@ static int http_server_run(struct http_server_ctx *ctx)
 
 			}
 
+#if defined(CONFIG_HTTP_SERVER_NONBLOCKING)
+			if (i >= ctx->listen_fds && (ctx->fds[i].revents & ZSOCK_POLLOUT)) {
+				client = &ctx->clients[i - ctx->listen_fds];
+
+				ret = handle_http_output(client);
+				if (ret < 0) {
+					LOG_DBG("Cannot write to client #%d (%d)",
+						i - ctx->listen_fds, ret);
+					close_client_connection(client);
+				}
+
+				continue;
+			}
+#endif
+
 			if (!(ctx->fds[i].revents & ZSOCK_POLLIN)) {
 				continue;
 			}
@@ -897,6 +1009,370 @@ void http_server_get_content_type_from_extension(char *url, char *content_type,
 	}
 }
 
+void http_server_get_static_content(struct http_client_ctx *client,
+				    struct http_resource_detail_static *static_detail,
+				    const void **data, size_t *len, const char **encoding)
+{
+	__maybe_unused const struct http_resource_static_variant *variant;
+
+	*data = static_detail->static_data;
+	*len = static_detail->static_data_len;
+	*encoding = static_detail->common.content_encoding;
+
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+	variant = http_compression_pick_variant(static_detail->variants,
+						static_detail->num_variants,
+						client->supported_compression);
+	if (variant != NULL) {
+		*data = variant->data;
+		*len = variant->data_len;
+		*encoding = http_compression_text(variant->compression);
+	}
+#else
+	ARG_UNUSED(client);
+#endif
+}
+
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+/* Digests of the static content, keyed by the content address. The table is
+ * only accessed from the server thread.
+ */
+static struct {
+	const void *data;
+	uint32_t digest;
+} etag_cache[CONFIG_HTTP_SERVER_ETAG_CACHE_SIZE];
+
+uint32_t http_server_etag_digest(const void *data, size_t len)
+{
+	size_t slot = ((uintptr_t)data / sizeof(void *)) % ARRAY_SIZE(etag_cache);
+
+	for (size_t i = 0; i < ARRAY_SIZE(etag_cache); i++) {
+		size_t idx = (slot + i) % ARRAY_SIZE(etag_cache);
+
+		if (etag_cache[idx].data == data) {
+			return etag_cache[idx].digest;
+		}
+
+		if (etag_cache[idx].data == NULL) {
+			etag_cache[idx].data = data;
+			etag_cache[idx].digest = crc32_ieee(data, len);
+
+			return etag_cache[idx].digest;
+		}
+	}
+
+	/* Table full, do not cache */
+	return crc32_ieee(data, len);
+}
+
+void http_server_etag_text(uint32_t digest, char *buf, size_t buflen)
+{
+	snprintk(buf, buflen, "\"%08x\"", digest);
+}
+
+void http_server_parse_if_none_match(struct http_client_ctx *client, const char *value,
+				     size_t len)
+{
+	char tag[HTTP_SERVER_ETAG_LEN];
+	char *end;
+
+	client->if_none_match_valid = false;
+	client->if_none_match_any = false;
+
+	while (len > 0 && *value == ' ') {
+		value++;
+		len--;
+	}
+
+	if (len > 0 && *value == '*') {
+		client->if_none_match_valid = true;
+		client->if_none_match_any = true;
+		return;
+	}
+
+	/* Weak tags are compared the same way, only the first tag is used */
+	if (len >= 2 && value[0] == 'W' && value[1] == '/') {
+		value += 2;
+		len -= 2;
+	}
+
+	if (len < sizeof(tag) - 1 || value[0] != '"' || value[sizeof(tag) - 2] != '"') {
+		return;
+	}
+
+	memcpy(tag, value + 1, sizeof(tag) - 3);
+	tag[sizeof(tag) - 3] = '\0';
+
+	client->if_none_match = strtoul(tag, &end, 16);
+	client->if_none_match_valid = (*end == '\0');
+}
+
+bool http_server_etag_match(struct http_client_ctx *client, uint32_t digest)
+{
+	if (!client->if_none_match_valid) {
+		return false;
+	}
+
+	return client->if_none_match_any || client->if_none_match == digest;
+}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
+/* Skip the first len bytes of an I/O vector. */
+static void iov_skip(struct net_iovec *iov, size_t iovcnt, size_t len)
+{
+	for (size_t i = 0; i < iovcnt && len > 0; i++) {
+		if (len < iov[i].iov_len) {
+			iov[i].iov_len -= len;
+			iov[i].iov_base = (uint8_t *)iov[i].iov_base + len;
+			break;
+		}
+
+		len -= iov[i].iov_len;
+		iov[i].iov_len = 0;
+	}
+}
+
+#if defined(CONFIG_HTTP_SERVER_NONBLOCKING)
+bool http_server_tx_pending(struct http_client_ctx *client)
+{
+	return client->tx_len > 0 || client->tx_ref_len > 0;
+}
+
+static void tx_queue_consume(struct http_client_ctx *client, size_t len)
+{
+	size_t queued = MIN(len, client->tx_len);
+
+	client->tx_head = (client->tx_head + queued) % sizeof(client->tx_queue);
+	client->tx_len -= queued;
+	len -= queued;
+
+	if (client->tx_len == 0) {
+		client->tx_head = 0;
+	}
+
+	client->tx_ref_data += len;
+	client->tx_ref_len -= len;
+
+	if (client->tx_ref_len == 0) {
+		client->tx_ref_data = NULL;
+	}
+}
+
+/* Send as much of the output queue as the socket accepts without blocking. */
+static int tx_queue_send(struct http_client_ctx *client)
+{
+	struct net_iovec iov[3];
+	struct net_msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = 0,
+	};
+	size_t first = MIN(client->tx_len, sizeof(client->tx_queue) - client->tx_head);
+	ssize_t out_len;
+
+	if (first > 0) {
+		iov[msg.msg_iovlen].iov_base = &client->tx_queue[client->tx_head];
+		iov[msg.msg_iovlen++].iov_len = first;
+	}
+
+	if (client->tx_len > first) {
+		iov[msg.msg_iovlen].iov_base = client->tx_queue;
+		iov[msg.msg_iovlen++].iov_len = client->tx_len - first;
+	}
+
+	if (client->tx_ref_len > 0) {
+		iov[msg.msg_iovlen].iov_base = (void *)client->tx_ref_data;
+		iov[msg.msg_iovlen++].iov_len = client->tx_ref_len;
+	}
+
+	out_len = zsock_sendmsg(client->fd, &msg, ZSOCK_MSG_DONTWAIT);
+	if (out_len < 0) {
+		return errno == EAGAIN ? 0 : -errno;
+	}
+
+	tx_queue_consume(client, out_len);
+	client->tx_deadline = k_uptime_get() +
+			      CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT * MSEC_PER_SEC;
+	http_client_timer_restart(client);
+
+	return 0;
+}
+
+int http_server_tx_flush(struct http_client_ctx *client, bool wait)
+{
+	struct zsock_pollfd pfd = {
+		.fd = client->fd,
+		.events = ZSOCK_POLLOUT,
+	};
+	int ret;
+
+	while (http_server_tx_pending(client)) {
+		ret = tx_queue_send(client);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (!wait || !http_server_tx_pending(client)) {
+			break;
+		}
+
+		ret = zsock_poll(&pfd, 1, CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT *
+					  MSEC_PER_SEC);
+		if (ret < 0) {
+			return -errno;
+		}
+
+		if (ret == 0) {
+			return -ETIMEDOUT;
+		}
+
+		if (pfd.revents & (ZSOCK_POLLERR | ZSOCK_POLLHUP | ZSOCK_POLLNVAL)) {
+			return -ENOTCONN;
+		}
+	}
+
+	return 0;
+}
+
+/* Copy data at the end of the output queue. Data can only be copied after
+ * static content queued by reference once that content has been sent, and
+ * data not fitting in the queue has to wait for the client to read, so in
+ * these cases the server blocks on the client.
+ */
+static int tx_queue_append(struct http_client_ctx *client, const void *buf, size_t len)
+{
+	int ret;
+
+	while (len > 0) {
+		size_t space = sizeof(client->tx_queue) - client->tx_len;
+		size_t tail, chunk;
+
+		if (space == 0 || client->tx_ref_len > 0) {
+			ret = http_server_tx_flush(client, true);
+			if (ret < 0) {
+				return ret;
+			}
+
+			continue;
+		}
+
+		if (client->tx_len == 0) {
+			client->tx_deadline = k_uptime_get() +
+				CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT * MSEC_PER_SEC;
+		}
+
+		tail = (client->tx_head + client->tx_len) % sizeof(client->tx_queue);
+		chunk = MIN(len, space);
+		chunk = MIN(chunk, sizeof(client->tx_queue) - tail);
+
+		memcpy(&client->tx_queue[tail], buf, chunk);
+		client->tx_len += chunk;
+
+		buf = (const uint8_t *)buf + chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+/* Send directly if nothing is queued yet, queue what the socket did not
+ * accept. The last num_refs segments are not copied, what is left of them
+ * is for the caller to queue by reference.
+ */
+static int tx_send_or_queue(struct http_client_ctx *client, struct net_iovec *iov,
+			    size_t iovcnt, size_t num_refs)
+{
+	struct net_msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = iovcnt,
+	};
+	ssize_t out_len;
+	int ret;
+
+	if (!http_server_tx_pending(client)) {
+		out_len = zsock_sendmsg(client->fd, &msg, ZSOCK_MSG_DONTWAIT);
+		if (out_len < 0) {
+			if (errno != EAGAIN) {
+				return -errno;
+			}
+		} else {
+			iov_skip(iov, iovcnt, out_len);
+			http_client_timer_restart(client);
+		}
+	}
+
+	for (size_t i = 0; i < iovcnt - num_refs; i++) {
+		ret = tx_queue_append(client, iov[i].iov_base, iov[i].iov_len);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len)
+{
+	struct net_iovec iov = {
+		.iov_base = (void *)buf,
+		.iov_len = len,
+	};
+
+	return tx_send_or_queue(client, &iov, 1, 0);
+}
+
+int http_server_sendv(struct http_client_ctx *client, struct net_iovec *iov, size_t iovcnt)
+{
+	return tx_send_or_queue(client, iov, iovcnt, 0);
+}
+
+int http_server_send_static(struct http_client_ctx *client, const void *hdr, size_t hdr_len,
+			    const void *data, size_t len)
+{
+	struct net_iovec iov[2] = {
+		{ .iov_base = (void *)hdr, .iov_len = hdr_len },
+		{ .iov_base = (void *)data, .iov_len = len },
+	};
+	int ret;
+
+	/* Only one static content can be queued by reference. */
+	if (client->tx_ref_len > 0) {
+		ret = http_server_tx_flush(client, true);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	ret = tx_send_or_queue(client, iov, ARRAY_SIZE(iov), 1);
+	if (ret < 0) {
+		return ret;
+	}
+
+	client->tx_ref_data = iov[1].iov_base;
+	client->tx_ref_len = iov[1].iov_len;
+
+	if (client->tx_len == 0 && client->tx_ref_len > 0) {
+		client->tx_deadline = k_uptime_get() +
+				      CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT * MSEC_PER_SEC;
+	}
+
+	return 0;
+}
+#else
+bool http_server_tx_pending(struct http_client_ctx *client)
+{
+	ARG_UNUSED(client);
+
+	return false;
+}
+
+int http_server_tx_flush(struct http_client_ctx *client, bool wait)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(wait);
+
+	return 0;
+}
+
 int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len)
 {
 	while (len) {
@@ -915,6 +1391,49 @@ int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t
 	return 0;
 }
 
+int http_server_sendv(struct http_client_ctx *client, struct net_iovec *iov, size_t iovcnt)
+{
+	struct net_msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = iovcnt,
+	};
+	size_t total_len = 0;
+	size_t offset = 0;
+
+	for (size_t i = 0; i < iovcnt; i++) {
+		total_len += iov[i].iov_len;
+	}
+
+	while (offset < total_len) {
+		ssize_t out_len = zsock_sendmsg(client->fd, &msg, 0);
+
+		if (out_len < 0) {
+			return -errno;
+		}
+
+		offset += out_len;
+
+		/* Skip what was sent for the next iteration. */
+		iov_skip(iov, iovcnt, out_len);
+
+		http_client_timer_restart(client);
+	}
+
+	return 0;
+}
+
+int http_server_send_static(struct http_client_ctx *client, const void *hdr, size_t hdr_len,
+			    const void *data, size_t len)
+{
+	struct net_iovec iov[2] = {
+		{ .iov_base = (void *)hdr, .iov_len = hdr_len },
+		{ .iov_base = (void *)data, .iov_len = len },
+	};
+
+	return http_server_sendv(client, iov, ARRAY_SIZE(iov));
+}
+#endif /* CONFIG_HTTP_SERVER_NONBLOCKING */
+
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_transaction_status status)
 {
 	if (status != HTTP_SERVER_REQUEST_DATA_FINAL) {
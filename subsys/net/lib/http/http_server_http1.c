@@ -135,36 +135,68 @@ static int handle_http1_static_resource(
 	char http_response[sizeof(RESPONSE_TEMPLATE) +
 			   sizeof("Content-Encoding: 01234567890123456789\r\n") +
 			   sizeof("Content-Type: \r\n") + HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
+			   sizeof("Vary: Accept-Encoding\r\n") +
+			   sizeof("ETag: \r\n") + HTTP_SERVER_ETAG_LEN +
 			   sizeof("xxxx") +
 			   sizeof("\r\n")];
-	const char *data;
-	int len;
+	char etag[HTTP_SERVER_ETAG_LEN] = "";
+	__maybe_unused uint32_t digest;
+	const char *encoding;
+	const void *data;
+	size_t len;
+	int offset;
 	int ret;
 
 	if (client->method != HTTP_GET) {
 		return send_http1_405(client);
 	}
 
-	data = static_detail->static_data;
-	len = static_detail->static_data_len;
+	http_server_get_static_content(client, static_detail, &data, &len, &encoding);
 
-	if (static_detail->common.content_encoding != NULL &&
-	    static_detail->common.content_encoding[0] != '\0') {
-		snprintk(http_response, sizeof(http_response),
-			 RESPONSE_TEMPLATE "Content-Encoding: %s\r\n\r\n",
-			 "Content-Type: ",
-			 static_detail->common.content_type == NULL ?
-			 "text/html" : static_detail->common.content_type,
-			 len, static_detail->common.content_encoding);
-	} else {
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	digest = http_server_etag_digest(data, len);
+
+	http_server_etag_text(digest, etag, sizeof(etag));
+
+	if (http_server_etag_match(client, digest)) {
 		snprintk(http_response, sizeof(http_response),
-			 RESPONSE_TEMPLATE "\r\n",
-			 "Content-Type: ",
-			 static_detail->common.content_type == NULL ?
-			 "text/html" : static_detail->common.content_type,
-			 len);
+			 "HTTP/1.1 304 Not Modified\r\nETag: %s\r\n\r\n", etag);
+
+		ret = http_server_sendall(client, http_response, strlen(http_response));
+		if (ret < 0) {
+			return ret;
+		}
+
+		client->http1_headers_sent = true;
+
+		return 0;
+	}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
+	offset = snprintk(http_response, sizeof(http_response),
+			  RESPONSE_TEMPLATE,
+			  "Content-Type: ",
+			  static_detail->common.content_type == NULL ?
+			  "text/html" : static_detail->common.content_type,
+			  (int)len);
+
+	if (encoding != NULL && encoding[0] != '\0') {
+		offset += snprintk(http_response + offset, sizeof(http_response) - offset,
+				   "Content-Encoding: %s\r\n", encoding);
+	}
+
+	if (static_detail->num_variants > 0) {
+		offset += snprintk(http_response + offset, sizeof(http_response) - offset,
+				   "Vary: Accept-Encoding\r\n");
+	}
+
+	if (etag[0] != '\0') {
+		offset += snprintk(http_response + offset, sizeof(http_response) - offset,
+				   "ETag: %s\r\n", etag);
 	}
 
+	snprintk(http_response + offset, sizeof(http_response) - offset, "\r\n");
+
 	ret = http_server_sendall(client, http_response, strlen(http_response));
 	if (ret < 0) {
 		return ret;
@@ -172,7 +204,7 @@ static int handle_http1_static_resource(
 
 	client->http1_headers_sent = true;
 
-	ret = http_server_sendall(client, data, len);
+	ret = http_server_send_static(client, NULL, 0, data, len);
 	if (ret < 0) {
 		return ret;
 	}
@@ -815,6 +847,11 @@ static int on_header_field(struct http_parser *parser, const char *at,
 				ctx->accept_encoding_next = true;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+			else if (strcasecmp(ctx->header_buffer, "If-None-Match") == 0) {
+				ctx->if_none_match_next = true;
+			}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -907,6 +944,12 @@ static int on_header_value(struct http_parser *parser,
 				ctx->accept_encoding_next = false;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+			if (ctx->if_none_match_next) {
+				http_server_parse_if_none_match(ctx, ctx->header_buffer, offset);
+				ctx->if_none_match_next = false;
+			}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -991,6 +1034,11 @@ int enter_http1_request(struct http_client_ctx *client)
 		client->header_capture_ctx.store_next_value = false;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	client->if_none_match_next = false;
+	client->if_none_match_valid = false;
+#endif
+
 	memset(client->header_buffer, 0, sizeof(client->header_buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
 
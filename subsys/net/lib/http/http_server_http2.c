@@ -87,6 +87,11 @@ static struct http2_stream_ctx *allocate_http_stream_context(
 				HTTP_SERVER_INITIAL_WINDOW_SIZE;
 			client->streams[i].headers_sent = false;
 			client->streams[i].end_stream_sent = false;
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+			client->streams[i].send_window = client->peer_initial_window_size;
+			client->streams[i].pending_data = NULL;
+			client->streams[i].pending_len = 0;
+#endif
 			return &client->streams[i];
 		}
 	}
@@ -102,11 +107,42 @@ static void release_http_stream_context(struct http_client_ctx *client,
 			client->streams[i].stream_id = 0;
 			client->streams[i].stream_state = HTTP2_STREAM_IDLE;
 			client->streams[i].current_detail = NULL;
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+			client->streams[i].pending_len = 0;
+#endif
 			break;
 		}
 	}
 }
 
+static bool http_stream_has_pending_data(struct http2_stream_ctx *stream)
+{
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	return stream->pending_len > 0;
+#else
+	ARG_UNUSED(stream);
+
+	return false;
+#endif
+}
+
+/* The peer is done with the stream. A stream with static content left to
+ * send is only released once the last DATA frame has been sent.
+ */
+static void close_http_stream_remote(struct http_client_ctx *client,
+				     uint32_t stream_id)
+{
+	struct http2_stream_ctx *stream = find_http_stream_context(client, stream_id);
+
+	if (stream != NULL && http_stream_has_pending_data(stream)) {
+		stream->stream_state = HTTP2_STREAM_HALF_CLOSED_REMOTE;
+		stream->current_detail = NULL;
+		return;
+	}
+
+	release_http_stream_context(client, stream_id);
+}
+
 static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 			    size_t *buflen, const char *name, const char *value)
 {
@@ -117,7 +153,12 @@ static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 	client->header_field.value = value;
 	client->header_field.value_len = strlen(value);
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+	ret = http_hpack_encode_header_table(&client->hpack_table, *buf, *buflen,
+					     &client->header_field);
+#else
 	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field);
+#endif
 	if (ret < 0) {
 		LOG_DBG("Failed to encode header, err %d", ret);
 		return ret;
@@ -214,10 +255,13 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 	return 0;
 }
 
-static int send_data_frame(struct http_client_ctx *client, const char *payload,
-			   size_t length, uint32_t stream_id, uint8_t flags)
+static int send_data_frame_common(struct http_client_ctx *client, const char *payload,
+				  size_t length, uint32_t stream_id, uint8_t flags,
+				  bool is_static)
 {
 	uint8_t frame_header[HTTP2_FRAME_HEADER_SIZE];
+	__maybe_unused struct http2_stream_ctx *stream;
+	struct net_iovec iov[2];
 	int ret;
 
 	encode_frame_header(frame_header, length, HTTP2_DATA_FRAME,
@@ -225,20 +269,116 @@ static int send_data_frame(struct http_client_ctx *client, const char *payload,
 			    HTTP2_FLAG_END_STREAM : 0,
 			    stream_id);
 
-	ret = http_server_sendall(client, frame_header, sizeof(frame_header));
+	/* Send the payload straight from the caller buffer, together with
+	 * the frame header.
+	 */
+	iov[0].iov_base = frame_header;
+	iov[0].iov_len = sizeof(frame_header);
+	iov[1].iov_base = (void *)payload;
+	iov[1].iov_len = payload != NULL ? length : 0;
+
+	if (is_static) {
+		/* Static content may be queued by reference. */
+		ret = http_server_send_static(client, frame_header, sizeof(frame_header),
+					      payload, iov[1].iov_len);
+	} else {
+		ret = http_server_sendv(client, iov, ARRAY_SIZE(iov));
+	}
+
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
-	} else {
-		if (payload != NULL && length > 0) {
-			ret = http_server_sendall(client, payload, length);
+		return ret;
+	}
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	stream = find_http_stream_context(client, stream_id);
+
+	client->send_window -= length;
+	if (stream != NULL) {
+		stream->send_window -= length;
+	}
+#endif
+
+	return ret;
+}
+
+static int send_data_frame(struct http_client_ctx *client, const char *payload,
+			   size_t length, uint32_t stream_id, uint8_t flags)
+{
+	return send_data_frame_common(client, payload, length, stream_id, flags, false);
+}
+
+static int send_static_data_frame(struct http_client_ctx *client, const char *payload,
+				  size_t length, uint32_t stream_id, uint8_t flags)
+{
+	return send_data_frame_common(client, payload, length, stream_id, flags, true);
+}
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+/* Send the pending static content of all streams, one DATA frame per stream
+ * in turn, so that concurrent requests progress together, until either the
+ * content or the peer windows are exhausted, or the socket does not accept
+ * more data. In the latter case, sending resumes once the output queue of
+ * the client has drained.
+ */
+int send_pending_data_frames(struct http_client_ctx *client)
+{
+	bool progress = true;
+	int ret;
+
+	while (progress) {
+		progress = false;
+
+		for (int n = 0; n < ARRAY_SIZE(client->streams); n++) {
+			int i = (client->next_stream + n) % ARRAY_SIZE(client->streams);
+			struct http2_stream_ctx *stream = &client->streams[i];
+			int32_t window;
+			size_t len;
+
+			if (http_server_tx_pending(client)) {
+				return 0;
+			}
+
+			if (stream->stream_state == HTTP2_STREAM_IDLE ||
+			    stream->pending_len == 0) {
+				continue;
+			}
+
+			window = MIN(stream->send_window, client->send_window);
+			if (window <= 0) {
+				continue;
+			}
+
+			len = MIN(stream->pending_len, client->peer_max_frame_size);
+			len = MIN(len, window);
+
+			ret = send_static_data_frame(client, stream->pending_data, len,
+					      stream->stream_id,
+					      len == stream->pending_len ?
+					      HTTP2_FLAG_END_STREAM : 0);
 			if (ret < 0) {
-				LOG_DBG("Cannot write to socket (%d)", ret);
+				return ret;
+			}
+
+			stream->pending_data += len;
+			stream->pending_len -= len;
+			progress = true;
+
+			if (stream->pending_len == 0) {
+				stream->end_stream_sent = true;
+
+				if (stream->stream_state == HTTP2_STREAM_HALF_CLOSED_REMOTE) {
+					release_http_stream_context(client, stream->stream_id);
+				}
 			}
 		}
+
+		client->next_stream = (client->next_stream + 1) % ARRAY_SIZE(client->streams);
 	}
 
-	return ret;
+	return 0;
 }
+#endif /* CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL */
 
 int send_settings_frame(struct http_client_ctx *client, bool ack)
 {
@@ -414,7 +554,12 @@ static int handle_http2_static_resource(
 	struct http_resource_detail_static *static_detail,
 	struct http2_frame *frame, struct http_client_ctx *client)
 {
-	const char *content_200;
+	struct http_header extra_headers[3];
+	size_t extra_headers_count = 0;
+	__maybe_unused char etag[HTTP_SERVER_ETAG_LEN];
+	__maybe_unused uint32_t digest;
+	const void *content_200;
+	const char *encoding;
 	size_t content_len;
 	int ret;
 
@@ -426,19 +571,78 @@ static int handle_http2_static_resource(
 		return -ENOENT;
 	}
 
-	content_200 = static_detail->static_data;
-	content_len = static_detail->static_data_len;
+	http_server_get_static_content(client, static_detail, &content_200, &content_len,
+				       &encoding);
+
+	if (encoding != static_detail->common.content_encoding && encoding != NULL &&
+	    encoding[0] != '\0') {
+		extra_headers[extra_headers_count++] = (struct http_header){
+			.name = "content-encoding",
+			.value = encoding,
+		};
+	}
+
+	if (static_detail->num_variants > 0) {
+		extra_headers[extra_headers_count++] = (struct http_header){
+			.name = "vary",
+			.value = "accept-encoding",
+		};
+	}
+
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	digest = http_server_etag_digest(content_200, content_len);
+	http_server_etag_text(digest, etag, sizeof(etag));
+
+	if (http_server_etag_match(client, digest)) {
+		const struct http_header etag_header = {
+			.name = "etag",
+			.value = etag,
+		};
+
+		ret = send_headers_frame(client, HTTP_304_NOT_MODIFIED, frame->stream_identifier,
+					 NULL, HTTP2_FLAG_END_STREAM, &etag_header, 1);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			goto out;
+		}
+
+		client->current_stream->end_stream_sent = true;
+		goto out;
+	}
+
+	extra_headers[extra_headers_count++] = (struct http_header){
+		.name = "etag",
+		.value = etag,
+	};
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 
 	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier,
-				 &static_detail->common, 0, NULL, 0);
+				 &static_detail->common, 0, extra_headers, extra_headers_count);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		goto out;
 	}
 
-	ret = send_data_frame(client, content_200, content_len,
-			      frame->stream_identifier,
-			      HTTP2_FLAG_END_STREAM);
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	if (content_len > 0) {
+		/* The content stays in place, DATA frames are sent as the
+		 * peer windows allow, interleaved with other streams.
+		 */
+		client->current_stream->pending_data = content_200;
+		client->current_stream->pending_len = content_len;
+
+		ret = send_pending_data_frames(client);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+		}
+
+		goto out;
+	}
+#endif
+
+	ret = send_static_data_frame(client, content_200, content_len,
+				     frame->stream_identifier,
+				     HTTP2_FLAG_END_STREAM);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		goto out;
@@ -957,6 +1161,10 @@ static int enter_http_frame_headers_state(struct http_client_ctx *client)
 		client->header_capture_ctx.current_stream = stream;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	client->if_none_match_valid = false;
+#endif
+
 	client->server_state = HTTP_SERVER_FRAME_HEADERS_STATE;
 
 	return 0;
@@ -1164,7 +1372,7 @@ int handle_http1_to_http2_upgrade(struct http_client_ctx *client)
 	 * to HTTP2.
 	 */
 	if (client->parser_state == HTTP1_MESSAGE_COMPLETE_STATE) {
-		release_http_stream_context(client, frame->stream_identifier);
+		close_http_stream_remote(client, frame->stream_identifier);
 		client->current_detail = NULL;
 		client->server_state = HTTP_SERVER_PREFACE_STATE;
 		client->cursor += client->data_len;
@@ -1428,6 +1636,12 @@ static int process_header(struct http_client_ctx *client,
 						       &client->supported_compression);
 	}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+	else if (header->name_len == (sizeof("if-none-match") - 1) &&
+		 memcmp(header->name, "if-none-match", header->name_len) == 0) {
+		http_server_parse_if_none_match(client, header->value, header->value_len);
+	}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 	else {
 		/* Just ignore for now. */
 		LOG_DBG("Ignoring field %.*s", (int)header->name_len, header->name);
@@ -1551,7 +1765,8 @@ static int handle_http_frame_headers_end_stream(struct http_client_ctx *client)
 			LOG_DBG("Cannot write to socket (%d)", ret);
 			goto out;
 		}
-	} else if (!client->current_stream->end_stream_sent) {
+	} else if (!client->current_stream->end_stream_sent &&
+		   !http_stream_has_pending_data(client->current_stream)) {
 		ret = send_data_frame(client, NULL, 0, frame->stream_identifier,
 				      HTTP2_FLAG_END_STREAM);
 		if (ret < 0) {
@@ -1562,7 +1777,11 @@ static int handle_http_frame_headers_end_stream(struct http_client_ctx *client)
 	client->current_stream->current_detail = NULL;
 
 out:
-	release_http_stream_context(client, frame->stream_identifier);
+	if (ret < 0) {
+		release_http_stream_context(client, frame->stream_identifier);
+	} else {
+		close_http_stream_remote(client, frame->stream_identifier);
+	}
 
 	return ret;
 }
@@ -1757,6 +1976,63 @@ int handle_http_frame_rst_stream(struct http_client_ctx *client)
 	return 0;
 }
 
+/* Apply the peer settings that affect sending, the others are ignored. */
+static int parse_http_frame_settings(struct http_client_ctx *client)
+{
+	struct http2_frame *frame = &client->current_frame;
+	const uint8_t *field = client->cursor;
+
+	if (frame->length % sizeof(struct http2_settings_field) != 0) {
+		return -EBADMSG;
+	}
+
+	for (size_t i = 0; i < frame->length / sizeof(struct http2_settings_field); i++) {
+		uint16_t id = sys_get_be16(field);
+		uint32_t value = sys_get_be32(field + sizeof(uint16_t));
+		__maybe_unused int32_t delta;
+
+		field += sizeof(struct http2_settings_field);
+
+		switch (id) {
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+		case HTTP2_SETTINGS_HEADER_TABLE_SIZE:
+			http_hpack_table_set_max_size(
+				&client->hpack_table,
+				MIN(value, CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE));
+			break;
+#endif
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+		case HTTP2_SETTINGS_INITIAL_WINDOW_SIZE:
+			if (value > HTTP2_MAX_WINDOW_SIZE) {
+				return -EBADMSG;
+			}
+
+			/* The change applies to the windows of all open streams */
+			delta = (int32_t)value - (int32_t)client->peer_initial_window_size;
+			client->peer_initial_window_size = value;
+
+			ARRAY_FOR_EACH(client->streams, j) {
+				if (client->streams[j].stream_state != HTTP2_STREAM_IDLE) {
+					client->streams[j].send_window += delta;
+				}
+			}
+			break;
+		case HTTP2_SETTINGS_MAX_FRAME_SIZE:
+			if (value < HTTP2_DEFAULT_MAX_FRAME_SIZE || value > HTTP2_MAX_FRAME_SIZE) {
+				return -EBADMSG;
+			}
+
+			client->peer_max_frame_size = value;
+			break;
+#endif /* CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL */
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
 int handle_http_frame_settings(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1768,6 +2044,15 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 		return -EAGAIN;
 	}
 
+	if (!is_header_flag_set(frame->flags, HTTP2_FLAG_SETTINGS_ACK)) {
+		int ret;
+
+		ret = parse_http_frame_settings(client);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
@@ -1780,6 +2065,14 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 			LOG_DBG("Cannot write to socket (%d)", ret);
 			return ret;
 		}
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+		/* A larger initial window may unblock pending streams */
+		ret = send_pending_data_frames(client);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
 	}
 
 	client->server_state = HTTP_SERVER_FRAME_HEADER_STATE;
@@ -1810,20 +2103,58 @@ int handle_http_frame_goaway(struct http_client_ctx *client)
 int handle_http_frame_window_update(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
+	__maybe_unused uint32_t increment;
 	int bytes_consumed;
+	__maybe_unused int ret;
 
 	LOG_DBG("HTTP_SERVER_FRAME_WINDOW_UPDATE");
 
-	/* TODO Implement flow control, for now just ignore. */
-
 	if (client->data_len < frame->length) {
 		return -EAGAIN;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	if (frame->length != HTTP2_WINDOW_UPDATE_FRAME_LEN) {
+		return -EBADMSG;
+	}
+
+	increment = sys_get_be32(client->cursor) & HTTP2_MAX_WINDOW_SIZE;
+	if (increment == 0) {
+		return -EBADMSG;
+	}
+
+	if (frame->stream_identifier == 0) {
+		if ((int64_t)client->send_window + increment > HTTP2_MAX_WINDOW_SIZE) {
+			return -EBADMSG;
+		}
+
+		client->send_window += increment;
+	} else {
+		struct http2_stream_ctx *stream;
+
+		/* Updates for already closed streams are ignored */
+		stream = find_http_stream_context(client, frame->stream_identifier);
+		if (stream != NULL) {
+			if ((int64_t)stream->send_window + increment > HTTP2_MAX_WINDOW_SIZE) {
+				return -EBADMSG;
+			}
+
+			stream->send_window += increment;
+		}
+	}
+#endif
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+	ret = send_pending_data_frames(client);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
 	client->server_state = HTTP_SERVER_FRAME_HEADER_STATE;
 
 	return 0;
@@ -31,6 +31,8 @@ static K_SEM_DEFINE(lwm2m_pull_sem, 1, 1);
 static char proxy_uri[LWM2M_PACKAGE_URI_LEN];
 #endif
 
+#define PULL_BLOCKS_IN_FLIGHT CONFIG_LWM2M_FIRMWARE_UPDATE_PULL_BLOCKS_IN_FLIGHT
+
 static void do_transmit_timeout_cb(struct lwm2m_message *msg);
 
 static struct firmware_pull_context {
@@ -42,6 +44,10 @@ static struct firmware_pull_context {
 
 	struct lwm2m_ctx firmware_ctx;
 	struct coap_block_context block_ctx;
+
+	/* Next block to request and requests outstanding, with PULL_BLOCKS_IN_FLIGHT > 1 */
+	size_t next_block;
+	uint8_t in_flight;
 } context;
 
 static enum service_state {
@@ -216,6 +222,48 @@ cleanup:
 	return ret;
 }
 
+static int do_firmware_transfer_reply_cb(const struct coap_packet *response,
+					 struct coap_reply *reply, const struct net_sockaddr *from);
+
+/*
+ * Keep up to PULL_BLOCKS_IN_FLIGHT block requests outstanding, each with its
+ * own token. Blocks are only requested ahead once the total size is known.
+ */
+static int request_blocks(void)
+{
+	struct coap_block_context ctx = context.block_ctx;
+	size_t block_len = coap_block_size_to_bytes(ctx.block_size);
+	uint8_t max_in_flight = ctx.total_size > 0 ? PULL_BLOCKS_IN_FLIGHT : 1;
+	int ret;
+
+	context.next_block = MAX(context.next_block, ctx.current / block_len);
+
+	while (context.in_flight < max_in_flight &&
+	       (ctx.total_size == 0 || context.next_block * block_len < ctx.total_size)) {
+		ctx.current = context.next_block * block_len;
+		ret = transfer_request(&ctx, coap_next_token(), 8, do_firmware_transfer_reply_cb);
+		if (ret < 0) {
+			return ret;
+		}
+
+		context.next_block++;
+		context.in_flight++;
+	}
+
+	return 0;
+}
+
+static int write_block_in_place(const uint8_t *payload, uint16_t payload_len, bool last_block,
+				size_t offset)
+{
+	if (!context.write_cb) {
+		return 0;
+	}
+
+	return context.write_cb(context.obj_inst_id, 0, 0, (uint8_t *)payload, payload_len,
+				last_block, context.block_ctx.total_size, offset);
+}
+
 static int do_firmware_transfer_reply_cb(const struct coap_packet *response,
 					 struct coap_reply *reply, const struct net_sockaddr *from)
 {
@@ -273,17 +321,55 @@ static int do_firmware_transfer_reply_cb(const struct coap_packet *response,
 		/* restore main firmware block context */
 		memcpy(&context.block_ctx, &received_block_ctx, sizeof(context.block_ctx));
 
+		if (PULL_BLOCKS_IN_FLIGHT > 1) {
+			/* Reply to a block requested again, release the request */
+			context.in_flight--;
+			ret = request_blocks();
+			if (ret < 0) {
+				goto error;
+			}
+
+			return 0;
+		}
+
 		/* set reply->user_data to error to avoid releasing */
 		reply->user_data = (void *)COAP_REPLY_STATUS_ERROR;
 		return 0;
 	}
 
+	if (PULL_BLOCKS_IN_FLIGHT > 1) {
+		context.in_flight--;
+
+		/* A block ahead of a missing one, request it again later */
+		if (context.block_ctx.current > received_block_ctx.current) {
+			LOG_DBG("Block at %zu received before %zu, dropped",
+				context.block_ctx.current, received_block_ctx.current);
+			context.next_block = MIN(context.next_block,
+						 context.block_ctx.current /
+						 coap_block_size_to_bytes(context.block_ctx.block_size));
+			memcpy(&context.block_ctx, &received_block_ctx, sizeof(context.block_ctx));
+
+			ret = request_blocks();
+			if (ret < 0) {
+				goto error;
+			}
+
+			return 0;
+		}
+	}
+
 	/* Reach last block if ret equals to 0 */
 	last_block = !coap_next_block(check_response, &context.block_ctx);
 
 	/* Process incoming data */
 	payload_start = coap_packet_get_payload(response, &payload_len);
-	if (payload_len > 0) {
+	if (payload_len > 0 && IS_ENABLED(CONFIG_LWM2M_FIRMWARE_UPDATE_PULL_ZERO_COPY)) {
+		ret = write_block_in_place(payload_start, payload_len, last_block,
+					   received_block_ctx.current);
+		if (ret < 0) {
+			goto error;
+		}
+	} else if (payload_len > 0) {
 		payload_offset = payload_start - response->data;
 		LOG_DBG("total: %zd, current: %zd", context.block_ctx.total_size,
 			context.block_ctx.current);
@@ -338,8 +424,12 @@ static int do_firmware_transfer_reply_cb(const struct coap_packet *response,
 
 	if (!last_block) {
 		/* More block(s) to come, setup next transfer */
-		ret = transfer_request(&context.block_ctx, token, tkl,
-				       do_firmware_transfer_reply_cb);
+		if (PULL_BLOCKS_IN_FLIGHT > 1) {
+			ret = request_blocks();
+		} else {
+			ret = transfer_request(&context.block_ctx, token, tkl,
+					       do_firmware_transfer_reply_cb);
+		}
 		if (ret < 0) {
 			goto error;
 		}
@@ -404,8 +494,9 @@ static void firmware_transfer(void)
 
 	/* reset block transfer context */
 	coap_block_transfer_init(&context.block_ctx, lwm2m_default_block_size(), 0);
-	ret = transfer_request(&context.block_ctx, coap_next_token(), 8,
-			       do_firmware_transfer_reply_cb);
+	context.next_block = 0;
+	context.in_flight = 0;
+	ret = request_blocks();
 	if (ret < 0) {
 		goto error;
 	}
@@ -94,6 +94,19 @@ sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
 
 sys_slist_t *lwm2m_engine_obj_inst_list(void) { return &engine_obj_inst_list; }
 
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+/* Direct mapped index of the registered object instances */
+static struct lwm2m_engine_obj_inst *obj_inst_index[CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE];
+
+static inline struct lwm2m_engine_obj_inst **obj_inst_index_slot(int obj_id, int obj_inst_id)
+{
+	uint32_t key = ((uint32_t)obj_id << 16) | (uint16_t)obj_inst_id;
+
+	/* Knuth multiplicative hash, spreads consecutive instance ids */
+	return &obj_inst_index[(key * 2654435761U) % CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE];
+}
+#endif
+
 #if defined(CONFIG_LWM2M_RESOURCE_DATA_CACHE_SUPPORT)
 static void lwm2m_engine_cache_write(const struct lwm2m_engine_obj_field *obj_field,
 				     const struct lwm2m_obj_path *path, const void *value,
@@ -145,6 +158,12 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		/* Fields are usually listed in resource ID order */
+		if (res_id >= 0 && res_id < obj->field_count &&
+		    obj->fields[res_id].res_id == res_id) {
+			return &obj->fields[res_id];
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -185,14 +204,35 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+	struct lwm2m_engine_obj_inst **slot =
+		obj_inst_index_slot(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
+
+	if (*slot == obj_inst) {
+		*slot = NULL;
+	}
+#endif
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+	struct lwm2m_engine_obj_inst **slot = obj_inst_index_slot(obj_id, obj_inst_id);
+
+	obj_inst = *slot;
+	if (obj_inst && obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+		return obj_inst;
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+			*slot = obj_inst;
+#endif
 			return obj_inst;
 		}
 	}
@@ -392,10 +432,14 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
+	if (path->res_id < oi->resource_count &&
+	    oi->resources[path->res_id].res_id == path->res_id) {
+		r = &oi->resources[path->res_id];
+	}
+
+	for (i = 0; !r && i < oi->resource_count; i++) {
 		if (oi->resources[i].res_id == path->res_id) {
 			r = &oi->resources[i];
-			break;
 		}
 	}
 
@@ -44,6 +44,7 @@ struct cbor_out_fmt_data {
 		char names[CONFIG_LWM2M_RW_SENML_CBOR_RECORDS][SENML_MAX_NAME_SIZE];
 		size_t name_sz; /* Name buff size */
 		uint8_t name_cnt;
+		char *basename; /* Basename in effect */
 	};
 
 	/* Basetime for Cached data timestamp */
@@ -158,6 +159,16 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 		return len;
 	}
 
+	if ((len < sizeof("/0/0") - 1) || (len >= SENML_MAX_NAME_SIZE)) {
+		__ASSERT_NO_MSG(false);
+		return -EINVAL;
+	}
+
+	/* A basename applies to all the following records, don't repeat it */
+	if (fd->basename && strcmp(basename, fd->basename) == 0) {
+		return 0;
+	}
+
 	/* Tell CBOR encoder where to find the name */
 	struct record *record = GET_CBOR_FD_REC(fd);
 
@@ -165,11 +176,7 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 	record->record_bn.record_bn.len = len;
 	record->record_bn_present = true;
 
-	if ((len < sizeof("/0/0") - 1) || (len >= SENML_MAX_NAME_SIZE)) {
-		__ASSERT_NO_MSG(false);
-		return -EINVAL;
-	}
-
+	fd->basename = basename;
 	fd->name_cnt++;
 
 	return 0;
@@ -236,6 +236,10 @@ void mqtt_client_init(struct mqtt_client *client)
 				   MQTT_VERSION_5_0 : MQTT_VERSION_3_1_1;
 	client->clean_session = MQTT_CLEAN_SESSION;
 	client->keepalive = MQTT_KEEPALIVE;
+
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+	client->internal.inflight_max = CONFIG_MQTT_INFLIGHT_MAX;
+#endif
 }
 
 #if defined(CONFIG_SOCKS)
@@ -293,14 +297,258 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
-int mqtt_publish(struct mqtt_client *client,
-		 const struct mqtt_publish_param *param)
+static int client_publish(struct mqtt_client *client,
+			  const struct mqtt_publish_param *param)
 {
 	int err_code;
 	struct buf_ctx packet;
 	struct net_iovec io_vector[2];
 	struct net_msghdr msg;
 
+	tx_buf_init(client, &packet);
+
+	err_code = publish_encode(client, param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	io_vector[0].iov_base = packet.cur;
+	io_vector[0].iov_len = packet.end - packet.cur;
+	io_vector[1].iov_base = param->message.payload.data;
+	io_vector[1].iov_len = param->message.payload.len;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+
+	return client_write_msg(client, &msg);
+}
+
+static int client_publish_release(struct mqtt_client *client,
+				  const struct mqtt_pubrel_param *param)
+{
+	int err_code;
+	struct buf_ctx packet;
+
+	tx_buf_init(client, &packet);
+
+	err_code = publish_release_encode(client, param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	return client_write(client, packet.cur, packet.end - packet.cur);
+}
+
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+enum mqtt_inflight_state {
+	MQTT_INFLIGHT_FREE = 0,
+	/* PUBLISH sent, waiting for PUBACK or PUBREC. */
+	MQTT_INFLIGHT_PUBLISH,
+	/* PUBREC received, waiting for PUBCOMP. */
+	MQTT_INFLIGHT_PUBREL,
+};
+
+static struct mqtt_inflight_msg *inflight_find(struct mqtt_client *client,
+					       uint16_t message_id)
+{
+	ARRAY_FOR_EACH_PTR(client->internal.inflight, msg) {
+		if (msg->state != MQTT_INFLIGHT_FREE &&
+		    msg->param.message_id == message_id) {
+			return msg;
+		}
+	}
+
+	return NULL;
+}
+
+static void inflight_free(struct mqtt_client *client, struct mqtt_inflight_msg *msg)
+{
+	msg->state = MQTT_INFLIGHT_FREE;
+	msg->resend = false;
+	client->internal.inflight_count--;
+}
+
+static uint16_t inflight_message_id_get(struct mqtt_client *client)
+{
+	uint16_t message_id = client->internal.last_message_id;
+
+	/* The window is smaller than the message id space, so this ends. */
+	do {
+		message_id++;
+	} while (message_id == 0U || inflight_find(client, message_id) != NULL);
+
+	client->internal.last_message_id = message_id;
+
+	return message_id;
+}
+
+/* Reserve an entry for a QoS 1 or QoS 2 publication, or reuse the entry of
+ * a publication being retransmitted by the application.
+ */
+static int inflight_add(struct mqtt_client *client,
+			const struct mqtt_publish_param *param,
+			struct mqtt_inflight_msg **entry)
+{
+	struct mqtt_inflight_msg *msg = NULL;
+
+	if (param->message_id != 0U) {
+		msg = inflight_find(client, param->message_id);
+		if (msg != NULL && !param->dup_flag) {
+			return -EBUSY;
+		}
+	}
+
+	if (msg == NULL) {
+		if (client->internal.inflight_count >= client->internal.inflight_max) {
+			return -EAGAIN;
+		}
+
+		ARRAY_FOR_EACH_PTR(client->internal.inflight, free_msg) {
+			if (free_msg->state == MQTT_INFLIGHT_FREE) {
+				msg = free_msg;
+				break;
+			}
+		}
+
+		__ASSERT_NO_MSG(msg != NULL);
+
+		client->internal.inflight_count++;
+	}
+
+	msg->param = *param;
+	msg->state = MQTT_INFLIGHT_PUBLISH;
+	msg->resend = false;
+
+	if (msg->param.message_id == 0U) {
+		msg->param.message_id = inflight_message_id_get(client);
+	}
+
+	*entry = msg;
+
+	return 0;
+}
+
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id, uint8_t reason_code)
+{
+	struct mqtt_inflight_msg *msg = inflight_find(client, message_id);
+
+	if (msg == NULL) {
+		return;
+	}
+
+	switch (type) {
+	case MQTT_PKT_TYPE_PUBACK:
+		if (msg->state == MQTT_INFLIGHT_PUBLISH) {
+			inflight_free(client, msg);
+		}
+
+		break;
+
+	case MQTT_PKT_TYPE_PUBREC:
+		/* A failure reason code ends the QoS 2 flow. */
+		if (reason_code >= 0x80) {
+			inflight_free(client, msg);
+			break;
+		}
+
+		msg->state = MQTT_INFLIGHT_PUBREL;
+		msg->last_sent = mqtt_sys_tick_in_ms_get();
+		msg->resend = false;
+		break;
+
+	case MQTT_PKT_TYPE_PUBCOMP:
+		inflight_free(client, msg);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void mqtt_inflight_connack(struct mqtt_client *client,
+			   const struct mqtt_connack_param *param)
+{
+	client->internal.inflight_max = CONFIG_MQTT_INFLIGHT_MAX;
+
+#if defined(CONFIG_MQTT_VERSION_5_0)
+	if (mqtt_is_version_5_0(client) && param->prop.rx.has_receive_maximum) {
+		client->internal.inflight_max = MIN(CONFIG_MQTT_INFLIGHT_MAX,
+						    param->prop.receive_maximum);
+	}
+#endif
+
+	ARRAY_FOR_EACH_PTR(client->internal.inflight, msg) {
+		if (msg->state == MQTT_INFLIGHT_FREE) {
+			continue;
+		}
+
+		/* Without a session on the server there is nothing to
+		 * complete, otherwise all publications are resent.
+		 */
+		if (!param->session_present_flag) {
+			inflight_free(client, msg);
+		} else {
+			msg->resend = true;
+		}
+	}
+}
+
+static int inflight_retransmit(struct mqtt_client *client)
+{
+	uint32_t timeout = CONFIG_MQTT_INFLIGHT_RETRY_TIMEOUT;
+	int err_code;
+
+	if (!MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+		return 0;
+	}
+
+	ARRAY_FOR_EACH_PTR(client->internal.inflight, msg) {
+		if (msg->state == MQTT_INFLIGHT_FREE) {
+			continue;
+		}
+
+		if (!msg->resend &&
+		    (mqtt_is_version_5_0(client) || timeout == 0U ||
+		     mqtt_elapsed_time_in_ms_get(msg->last_sent) < timeout)) {
+			continue;
+		}
+
+		NET_DBG("[CID %p]: Retransmitting message id 0x%04x", client,
+			msg->param.message_id);
+
+		if (msg->state == MQTT_INFLIGHT_PUBLISH) {
+			msg->param.dup_flag = 1U;
+
+			err_code = client_publish(client, &msg->param);
+		} else {
+			const struct mqtt_pubrel_param rel_param = {
+				.message_id = msg->param.message_id,
+			};
+
+			err_code = client_publish_release(client, &rel_param);
+		}
+
+		if (err_code < 0) {
+			return err_code;
+		}
+
+		msg->resend = false;
+		msg->last_sent = mqtt_sys_tick_in_ms_get();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_MQTT_INFLIGHT_TRACKING */
+
+int mqtt_publish(struct mqtt_client *client,
+		 const struct mqtt_publish_param *param)
+{
+	int err_code;
+	__maybe_unused struct mqtt_inflight_msg *msg = NULL;
+
 	NULL_PARAM_CHECK(client);
 	NULL_PARAM_CHECK(param);
 
@@ -311,33 +559,141 @@ int mqtt_publish(struct mqtt_client *client,
 
 	mqtt_mutex_lock(client);
 
-	tx_buf_init(client, &packet);
-
 	err_code = verify_tx_state(client);
 	if (err_code < 0) {
 		goto error;
 	}
 
-	err_code = publish_encode(client, param, &packet);
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+	if (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE) {
+		err_code = inflight_add(client, param, &msg);
+		if (err_code < 0) {
+			goto error;
+		}
+
+		param = &msg->param;
+	}
+#endif
+
+	err_code = client_publish(client, param);
+
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+	if (msg != NULL) {
+		if (err_code < 0 && MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+			/* Failed to encode, never sent. A failed transport
+			 * write disconnects, the publication is then resent
+			 * on reconnection if the session is kept.
+			 */
+			inflight_free(client, msg);
+		} else {
+			msg->last_sent = mqtt_sys_tick_in_ms_get();
+		}
+	}
+#endif
+
+error:
+	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
+			 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
+int mqtt_publish_batch(struct mqtt_client *client,
+		       const struct mqtt_publish_param *params, size_t count)
+{
+	int err_code;
+	struct buf_ctx packet;
+	struct net_iovec io_vector[2 * CONFIG_MQTT_PUBLISH_BATCH_MAX];
+	__maybe_unused struct mqtt_inflight_msg *msgs[CONFIG_MQTT_PUBLISH_BATCH_MAX] = { 0 };
+	struct net_msghdr msg;
+	uint8_t *tx_buf_end;
+	size_t encoded = 0;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(params);
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Message count %zu", client,
+		 client->internal.state, count);
+
+	count = MIN(count, CONFIG_MQTT_PUBLISH_BATCH_MAX);
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
 	if (err_code < 0) {
 		goto error;
 	}
 
-	io_vector[0].iov_base = packet.cur;
-	io_vector[0].iov_len = packet.end - packet.cur;
-	io_vector[1].iov_base = param->message.payload.data;
-	io_vector[1].iov_len = param->message.payload.len;
+	tx_buf_init(client, &packet);
+	tx_buf_end = packet.end;
+
+	/* Encode the messages one after another, the payloads are not
+	 * copied but referenced from the I/O vector.
+	 */
+	while (encoded < count) {
+		const struct mqtt_publish_param *param = &params[encoded];
+
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+		if (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE) {
+			err_code = inflight_add(client, param, &msgs[encoded]);
+			if (err_code < 0) {
+				break;
+			}
+
+			param = &msgs[encoded]->param;
+		}
+#endif
+
+		packet.end = tx_buf_end;
+
+		err_code = publish_encode(client, param, &packet);
+		if (err_code < 0) {
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+			if (msgs[encoded] != NULL) {
+				inflight_free(client, msgs[encoded]);
+				msgs[encoded] = NULL;
+			}
+#endif
+			break;
+		}
+
+		io_vector[2 * encoded].iov_base = packet.cur;
+		io_vector[2 * encoded].iov_len = packet.end - packet.cur;
+		io_vector[2 * encoded + 1].iov_base = param->message.payload.data;
+		io_vector[2 * encoded + 1].iov_len = param->message.payload.len;
+
+		packet.cur = packet.end;
+		encoded++;
+	}
+
+	/* Report the error only if no message fits. */
+	if (encoded == 0) {
+		goto error;
+	}
 
 	memset(&msg, 0, sizeof(msg));
 
 	msg.msg_iov = io_vector;
-	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	msg.msg_iovlen = 2 * encoded;
 
 	err_code = client_write_msg(client, &msg);
+	if (err_code == 0) {
+		err_code = encoded;
+	}
+
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+	for (size_t i = 0; i < encoded; i++) {
+		if (msgs[i] != NULL) {
+			msgs[i]->last_sent = mqtt_sys_tick_in_ms_get();
+		}
+	}
+#endif
 
 error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
-			 client, client->internal.state, err_code);
+		 client, client->internal.state, err_code);
 
 	mqtt_mutex_unlock(client);
 
@@ -422,7 +778,6 @@ int mqtt_publish_qos2_release(struct mqtt_client *client,
 			      const struct mqtt_pubrel_param *param)
 {
 	int err_code;
-	struct buf_ctx packet;
 
 	NULL_PARAM_CHECK(client);
 	NULL_PARAM_CHECK(param);
@@ -432,19 +787,12 @@ int mqtt_publish_qos2_release(struct mqtt_client *client,
 
 	mqtt_mutex_lock(client);
 
-	tx_buf_init(client, &packet);
-
 	err_code = verify_tx_state(client);
 	if (err_code < 0) {
 		goto error;
 	}
 
-	err_code = publish_release_encode(client, param, &packet);
-	if (err_code < 0) {
-		goto error;
-	}
-
-	err_code = client_write(client, packet.cur, packet.end - packet.cur);
+	err_code = client_publish_release(client, param);
 
 error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
@@ -711,6 +1059,14 @@ int mqtt_live(struct mqtt_client *client)
 
 	mqtt_mutex_lock(client);
 
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+	err_code = inflight_retransmit(client);
+	if (err_code < 0) {
+		mqtt_mutex_unlock(client);
+		return err_code;
+	}
+#endif
+
 	elapsed_time = mqtt_elapsed_time_in_ms_get(
 				client->internal.last_activity);
 	if ((client->keepalive > 0) &&
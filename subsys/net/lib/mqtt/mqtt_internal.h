@@ -208,6 +208,45 @@ int mqtt_handle_rx(struct mqtt_client *client);
  */
 void mqtt_client_disconnect(struct mqtt_client *client, int result, bool notify);
 
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+/**@brief Updates the in-flight publications on reception of an acknowledgment.
+ *
+ * @param[in] client Identifies the client which received the acknowledgment.
+ * @param[in] type Type of the acknowledgment, PUBACK, PUBREC or PUBCOMP.
+ * @param[in] message_id Message id of the acknowledged publication.
+ * @param[in] reason_code MQTT 5.0 reason code of the acknowledgment, 0 otherwise.
+ */
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id, uint8_t reason_code);
+
+/**@brief Updates the in-flight publications when the connection is accepted.
+ *
+ * Publications are scheduled for retransmission if the server kept the
+ * session, dropped otherwise.
+ *
+ * @param[in] client Identifies the client which received the CONNACK.
+ * @param[in] param Decoded CONNACK parameters.
+ */
+void mqtt_inflight_connack(struct mqtt_client *client,
+			   const struct mqtt_connack_param *param);
+#else
+static inline void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+				     uint16_t message_id, uint8_t reason_code)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(type);
+	ARG_UNUSED(message_id);
+	ARG_UNUSED(reason_code);
+}
+
+static inline void mqtt_inflight_connack(struct mqtt_client *client,
+					 const struct mqtt_connack_param *param)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(param);
+}
+#endif /* CONFIG_MQTT_INFLIGHT_TRACKING */
+
 /**@brief Constructs/encodes Connect packet.
  *
  * @param[in] client Identifies the client for which the procedure is requested.
@@ -16,6 +16,12 @@ LOG_MODULE_REGISTER(net_mqtt_rx, CONFIG_MQTT_LOG_LEVEL);
  * @brief MQTT Received data handling.
  */
 
+#if defined(CONFIG_MQTT_VERSION_5_0)
+#define ACK_REASON_CODE(param) ((param)->reason_code)
+#else
+#define ACK_REASON_CODE(param) 0U
+#endif
+
 static int mqtt_handle_packet(struct mqtt_client *client,
 			      uint8_t type_and_flags,
 			      uint32_t var_length,
@@ -45,6 +51,8 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 						MQTT_CONNECTION_ACCEPTED) {
 				/* Set state. */
 				MQTT_SET_STATE(client, MQTT_STATE_CONNECTED);
+
+				mqtt_inflight_connack(client, &evt.param.connack);
 			} else {
 				err_code = -ECONNREFUSED;
 			}
@@ -80,6 +88,11 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBACK;
 		err_code = publish_ack_decode(client, buf, &evt.param.puback);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_ack(client, MQTT_PKT_TYPE_PUBACK,
+					  evt.param.puback.message_id,
+					  ACK_REASON_CODE(&evt.param.puback));
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREC:
@@ -89,6 +102,11 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		err_code = publish_receive_decode(client, buf,
 						  &evt.param.pubrec);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_ack(client, MQTT_PKT_TYPE_PUBREC,
+					  evt.param.pubrec.message_id,
+					  ACK_REASON_CODE(&evt.param.pubrec));
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREL:
@@ -107,6 +125,11 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		err_code = publish_complete_decode(client, buf,
 						   &evt.param.pubcomp);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_ack(client, MQTT_PKT_TYPE_PUBCOMP,
+					  evt.param.pubcomp.message_id,
+					  ACK_REASON_CODE(&evt.param.pubcomp));
+		}
 		break;
 
 	case MQTT_PKT_TYPE_SUBACK:
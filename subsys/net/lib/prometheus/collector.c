@@ -169,35 +169,32 @@ int prometheus_collector_walk_metrics(struct prometheus_collector_walk_context *
 		return -EINVAL;
 	}
 
+	if (ctx->state == PROMETHEUS_WALK_STOP) {
+		return 0;
+	}
+
 	if (ctx->state == PROMETHEUS_WALK_START) {
 		k_mutex_lock(&ctx->collector->lock, K_FOREVER);
 		ctx->state = PROMETHEUS_WALK_CONTINUE;
 
-		/* Start of the loop is taken from
-		 * SYS_SLIST_FOR_EACH_CONTAINER_SAFE macro to simulate
-		 * a loop.
-		 */
-
-		ctx->metric = Z_GENLIST_PEEK_HEAD_CONTAINER(slist,
-							    &ctx->collector->metrics,
-							    ctx->metric,
-							    node);
-		ctx->tmp = Z_GENLIST_PEEK_NEXT_CONTAINER(slist,
-							 ctx->metric,
+		ctx->tmp = Z_GENLIST_PEEK_HEAD_CONTAINER(slist,
+							 &ctx->collector->metrics,
+							 ctx->tmp,
 							 node);
 	}
 
-	if (ctx->state == PROMETHEUS_WALK_CONTINUE) {
-		int len = 0;
+	/* Format as many metrics as the buffer holds, so that a scrape takes
+	 * few calls while the collector is locked.
+	 */
+	while (ctx->state == PROMETHEUS_WALK_CONTINUE) {
+		size_t len = strnlen((char *)buffer, buffer_size);
+		int written = 0;
 
 		ctx->metric = ctx->tmp;
-		ctx->tmp = Z_GENLIST_PEEK_NEXT_CONTAINER(slist,
-							 ctx->metric,
-							 node);
-
 		if (ctx->metric == NULL) {
 			ctx->state = PROMETHEUS_WALK_STOP;
-			goto out;
+			ret = 0;
+			break;
 		}
 
 		/* If there is a user callback, use it to update the metric data. */
@@ -207,28 +204,34 @@ int prometheus_collector_walk_metrics(struct prometheus_collector_walk_context *
 			if (ret < 0) {
 				if (ret != -EAGAIN) {
 					ctx->state = PROMETHEUS_WALK_STOP;
-					goto out;
+					break;
 				}
 
 				/* Skip this metric for now */
-				goto out;
+				ctx->tmp = Z_GENLIST_PEEK_NEXT_CONTAINER(slist, ctx->metric, node);
+				continue;
 			}
 		}
 
-		ret = prometheus_format_one_metric(ctx->metric, buffer, buffer_size, &len);
+		ret = prometheus_format_one_metric(ctx->metric, (char *)buffer, buffer_size,
+						   &written);
 		if (ret < 0) {
-			ctx->state = PROMETHEUS_WALK_STOP;
-			goto out;
+			if (len == 0) {
+				LOG_ERR("Metric %s does not fit in buffer", ctx->metric->name);
+				ctx->state = PROMETHEUS_WALK_STOP;
+				break;
+			}
+
+			/* Drop the partial output, the metric goes in the next buffer. */
+			buffer[len] = '\0';
+			return -EAGAIN;
 		}
 
-		ret = -EAGAIN;
+		ctx->tmp = Z_GENLIST_PEEK_NEXT_CONTAINER(slist, ctx->metric, node);
 	}
 
-out:
-	if (ctx->state == PROMETHEUS_WALK_STOP) {
-		k_mutex_unlock(&ctx->collector->lock);
-		ret = 0;
-	}
+	/* ctx->state is PROMETHEUS_WALK_STOP */
+	k_mutex_unlock(&ctx->collector->lock);
 
 	return ret;
 }
@@ -0,0 +1,127 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net/prometheus/collector.h>
+#include <zephyr/net/prometheus/counter.h>
+#include <zephyr/net/prometheus/histogram.h>
+
+#include <math.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(pm_sched_stats, CONFIG_PROMETHEUS_LOG_LEVEL);
+
+#define NUM_BUCKETS CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS
+
+static int sched_stats_scrape(struct prometheus_collector *collector,
+			      struct prometheus_metric *metric,
+			      void *user_data);
+
+PROMETHEUS_COLLECTOR_DEFINE(prometheus_sched_stats_collector, sched_stats_scrape);
+
+static struct prometheus_histogram_bucket latency_buckets[NUM_BUCKETS];
+
+PROMETHEUS_HISTOGRAM_DEFINE(sched_latency_cycles,
+			    "Ready to running latency in cycles",
+			    ({ .key = "scope", .value = "system" }),
+			    &prometheus_sched_stats_collector);
+
+PROMETHEUS_COUNTER_DEFINE(sched_ready_cycles_total,
+			  "Cycles spent ready but not running",
+			  ({ .key = "scope", .value = "system" }),
+			  &prometheus_sched_stats_collector);
+
+PROMETHEUS_COUNTER_DEFINE(sched_preempted_cycles_total,
+			  "Ready cycles following a preemption",
+			  ({ .key = "scope", .value = "system" }),
+			  &prometheus_sched_stats_collector);
+
+PROMETHEUS_COUNTER_DEFINE(sched_preemptions_total,
+			  "Number of thread preemptions",
+			  ({ .key = "scope", .value = "system" }),
+			  &prometheus_sched_stats_collector);
+
+PROMETHEUS_COUNTER_DEFINE(sched_ipis_total,
+			  "Number of IPIs raised by the scheduler",
+			  ({ .key = "scope", .value = "system" }),
+			  &prometheus_sched_stats_collector);
+
+/* Do not track the kernel statistics in the metrics themselves, take a
+ * snapshot of the amalgamated CPU statistics when scraped instead.
+ */
+static int sched_stats_scrape(struct prometheus_collector *collector,
+			      struct prometheus_metric *metric,
+			      void *user_data)
+{
+	k_thread_runtime_stats_t stats;
+	int ret;
+
+	ARG_UNUSED(collector);
+	ARG_UNUSED(user_data);
+
+	ret = k_thread_runtime_stats_all_get(&stats);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (metric == &sched_latency_cycles.base) {
+		unsigned long count = 0;
+
+		for (size_t i = 0; i < NUM_BUCKETS; i++) {
+			count += stats.latency_hist[i];
+			latency_buckets[i].count = count;
+		}
+
+		sched_latency_cycles.count = count;
+		sched_latency_cycles.sum = (double)stats.ready_cycles;
+	} else if (metric == &sched_ready_cycles_total.base) {
+		prometheus_counter_set(&sched_ready_cycles_total,
+				       stats.ready_cycles);
+	} else if (metric == &sched_preempted_cycles_total.base) {
+		prometheus_counter_set(&sched_preempted_cycles_total,
+				       stats.preempted_cycles);
+	} else if (metric == &sched_preemptions_total.base) {
+		prometheus_counter_set(&sched_preemptions_total,
+				       stats.num_preemptions);
+	} else if (metric == &sched_ipis_total.base) {
+		prometheus_counter_set(&sched_ipis_total, stats.num_ipis);
+	} else {
+		LOG_DBG("Unknown metric %s", metric->name);
+	}
+
+	return 0;
+}
+
+static int sched_stats_init(void)
+{
+	/* Bucket N counts latencies below 2^(N+1) cycles, the last one
+	 * everything else.
+	 */
+	for (size_t i = 0; i < NUM_BUCKETS - 1; i++) {
+		latency_buckets[i].upper_bound = (double)(BIT64(i + 1) - 1);
+	}
+
+	latency_buckets[NUM_BUCKETS - 1].upper_bound = INFINITY;
+
+	sched_latency_cycles.buckets = latency_buckets;
+	sched_latency_cycles.num_buckets = NUM_BUCKETS;
+
+	prometheus_collector_register_metric(&prometheus_sched_stats_collector,
+					     &sched_latency_cycles.base);
+	prometheus_collector_register_metric(&prometheus_sched_stats_collector,
+					     &sched_ready_cycles_total.base);
+	prometheus_collector_register_metric(&prometheus_sched_stats_collector,
+					     &sched_preempted_cycles_total.base);
+	prometheus_collector_register_metric(&prometheus_sched_stats_collector,
+					     &sched_preemptions_total.base);
+	prometheus_collector_register_metric(&prometheus_sched_stats_collector,
+					     &sched_ipis_total.base);
+
+	return 0;
+}
+
+SYS_INIT(sched_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,121 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net/prometheus/collector.h>
+#include <zephyr/net/prometheus/histogram.h>
+
+#include <math.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/hist.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(pm_sys_hist, CONFIG_PROMETHEUS_LOG_LEVEL);
+
+static int sys_hist_scrape(struct prometheus_collector *collector,
+			   struct prometheus_metric *metric,
+			   void *user_data);
+
+PROMETHEUS_COLLECTOR_DEFINE(prometheus_sys_hist_collector, sys_hist_scrape);
+
+/* Prometheus bucket holding a sys_hist bucket. The sub buckets of a sys_hist
+ * never straddle a power of two, so they fold into bucket N counting values
+ * below 2^(N+1).
+ */
+static uint32_t pm_bucket_get(const struct sys_hist_layout *layout, uint32_t idx)
+{
+	uint32_t max = sys_hist_bucket_max(layout, idx);
+
+	if (max == UINT32_MAX) {
+		return layout->max_bits;
+	}
+
+	return (max < 2U) ? 0U : (31U - __builtin_clz(max));
+}
+
+/* Take a snapshot of the histogram when scraped, the recording side is not
+ * aware of Prometheus.
+ */
+static int sys_hist_scrape(struct prometheus_collector *collector,
+			   struct prometheus_metric *metric,
+			   void *user_data)
+{
+	struct prometheus_histogram *histogram =
+		CONTAINER_OF(metric, struct prometheus_histogram, base);
+	struct prometheus_sys_hist_binding *binding = histogram->user_data;
+	const struct sys_hist_layout *layout;
+	unsigned long count = 0;
+	double sum = 0.0;
+
+	ARG_UNUSED(collector);
+	ARG_UNUSED(user_data);
+
+	if ((metric->type != PROMETHEUS_HISTOGRAM) || (binding == NULL)) {
+		LOG_DBG("Unknown metric %s", metric->name);
+		return 0;
+	}
+
+	layout = &binding->hist->layout;
+
+	for (size_t i = 0; i < histogram->num_buckets; i++) {
+		binding->buckets[i].count = 0;
+	}
+
+	for (uint32_t i = 0; i < layout->num_buckets; i++) {
+		uint32_t n = sys_hist_bucket_count(binding->hist, i);
+		uint32_t max = sys_hist_bucket_max(layout, i);
+
+		if (n == 0) {
+			continue;
+		}
+
+		binding->buckets[pm_bucket_get(layout, i)].count += n;
+		count += n;
+		sum += (double)n * ((max == UINT32_MAX) ? (double)BIT64(layout->max_bits) : max);
+	}
+
+	for (size_t i = 1; i < histogram->num_buckets; i++) {
+		binding->buckets[i].count += binding->buckets[i - 1].count;
+	}
+
+	histogram->count = count;
+	histogram->sum = sum;
+
+	return 0;
+}
+
+static int sys_hist_init(void)
+{
+	STRUCT_SECTION_FOREACH(prometheus_histogram, histogram) {
+		struct prometheus_sys_hist_binding *binding = histogram->user_data;
+		size_t num_buckets;
+
+		if (histogram->base.collector != &prometheus_sys_hist_collector) {
+			continue;
+		}
+
+		/* Bucket N counts values below 2^(N+1), the last one everything
+		 * beyond the range of the histogram.
+		 */
+		num_buckets = binding->hist->layout.max_bits + 1U;
+
+		for (size_t i = 0; i < num_buckets - 1; i++) {
+			binding->buckets[i].upper_bound = (double)(BIT64(i + 1) - 1);
+		}
+
+		binding->buckets[num_buckets - 1].upper_bound = INFINITY;
+
+		histogram->buckets = binding->buckets;
+		histogram->num_buckets = num_buckets;
+
+		prometheus_collector_register_metric(&prometheus_sys_hist_collector,
+						     &histogram->base);
+	}
+
+	return 0;
+}
+
+SYS_INIT(sys_hist_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
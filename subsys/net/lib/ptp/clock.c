@@ -54,6 +54,7 @@ struct ptp_clock {
 		uint64_t	    t4;
 	} timestamp;			/* latest timestamps in nanoseconds */
 	double pi_drift;
+	double last_ppb;		/* frequency adjustment last applied */
 };
 
 __maybe_unused static struct ptp_clock ptp_clk = { 0 };
@@ -509,14 +510,18 @@ int ptp_clock_management_msg_process(struct ptp_port *port, struct ptp_msg *msg)
 
 static double ptp_servo_pi(int64_t nanosecond_diff)
 {
+	const double max_ppb = CONFIG_PTP_SERVO_MAX_FREQ_ADJ_PPB;
 	double kp = 0.7;
 	double ki = 0.3;
 	double ppb;
 
+	/* Clamp the integral term to prevent it from winding up */
 	ptp_clk.pi_drift += ki * nanosecond_diff;
+	ptp_clk.pi_drift = CLAMP(ptp_clk.pi_drift, -max_ppb, max_ppb);
+
 	ppb = kp * nanosecond_diff + ptp_clk.pi_drift;
 
-	return ppb;
+	return CLAMP(ppb, -max_ppb, max_ppb);
 }
 
 void ptp_clock_synchronize(uint64_t ingress, uint64_t egress)
@@ -565,7 +570,15 @@ void ptp_clock_synchronize(uint64_t ingress, uint64_t egress)
 	ptp_clk.current_ds.offset_from_tt = clock_ns_to_timeinterval(offset);
 
 	ppb = ptp_servo_pi(-offset);
-	ptp_clock_rate_adjust(ptp_clk.phc, 1.0 + (ppb / 1000000000.0));
+
+	if ((ppb - ptp_clk.last_ppb) < CONFIG_PTP_SERVO_MIN_FREQ_ADJ_PPB &&
+	    (ptp_clk.last_ppb - ppb) < CONFIG_PTP_SERVO_MIN_FREQ_ADJ_PPB) {
+		return;
+	}
+
+	if (ptp_clock_rate_adjust(ptp_clk.phc, 1.0 + (ppb / 1000000000.0)) == 0) {
+		ptp_clk.last_ppb = ppb;
+	}
 }
 
 void ptp_clock_delay(uint64_t egress, uint64_t ingress)
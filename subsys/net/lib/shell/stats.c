@@ -10,6 +10,7 @@ LOG_MODULE_DECLARE(net_shell);
 
 #include <zephyr/net/net_stats.h>
 #include <zephyr/net/ethernet.h>
+#include <zephyr/sys/hist.h>
 
 #include "net_shell_private.h"
 
@@ -716,6 +717,26 @@ static void parse_stats_options(size_t argc, char *argv[], int start_idx,
 }
 #endif /* CONFIG_NET_STATISTICS */
 
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST)
+static void print_net_time_hist(const struct shell *sh)
+{
+	SYS_HIST_SNAPSHOT_DEFINE(snap, NET_STATS_HIST_SUB_BITS, NET_STATS_HIST_MAX_BITS);
+
+	PR("\nPacket time (us)     count   p50   p90   p99 p99.9\n");
+
+	STRUCT_SECTION_FOREACH(sys_hist, hist) {
+		if (strncmp(hist->name, "net_", 4) != 0 ||
+		    sys_hist_snapshot(hist, &snap) < 0 || snap.count == 0) {
+			continue;
+		}
+
+		PR("%-18s %7llu %5u %5u %5u %5u\n", hist->name + 4, snap.count,
+		   sys_hist_percentile(&snap, 500000), sys_hist_percentile(&snap, 900000),
+		   sys_hist_percentile(&snap, 990000), sys_hist_percentile(&snap, 999000));
+	}
+}
+#endif /* CONFIG_NET_PKT_TIME_STATS_HIST */
+
 int cmd_net_stats_all(const struct shell *sh, size_t argc, char *argv[])
 {
 #if defined(CONFIG_NET_STATISTICS)
@@ -731,6 +752,10 @@ int cmd_net_stats_all(const struct shell *sh, size_t argc, char *argv[])
 
 	/* Print global network statistics */
 	net_shell_print_statistics_all(&user_data);
+
+#if defined(CONFIG_NET_PKT_TIME_STATS_HIST)
+	print_net_time_hist(sh);
+#endif
 #else
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
@@ -474,6 +474,60 @@ fail:
 #include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_sendmmsg(int sock, struct net_mmsghdr *msgvec,
+			  unsigned int vlen, int flags)
+{
+	unsigned int i;
+	ssize_t ret;
+
+	for (i = 0; i < vlen; i++) {
+		ret = z_impl_zsock_sendmsg(sock, &msgvec[i].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+	}
+
+	/* Report the error only if nothing was sent, the next call will
+	 * hit it again otherwise.
+	 */
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct net_mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int len;
+	unsigned int i;
+	ssize_t ret;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	for (i = 0; i < vlen; i++) {
+		ret = z_vrfy_zsock_sendmsg(sock, &msgvec[i].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &len, sizeof(len)));
+	}
+
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 			     struct net_sockaddr *src_addr, net_socklen_t *addrlen)
 {
@@ -711,6 +765,70 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_recvmmsg(int sock, struct net_mmsghdr *msgvec,
+			  unsigned int vlen, int flags)
+{
+	unsigned int i;
+	ssize_t ret;
+
+	for (i = 0; i < vlen; i++) {
+		ret = z_impl_zsock_recvmsg(sock, &msgvec[i].msg_hdr,
+					   flags & ~ZSOCK_MSG_WAITFORONE);
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+
+		/* Only block for the first message, then drain what is
+		 * already queued.
+		 */
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+	}
+
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct net_mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int len;
+	unsigned int i;
+	ssize_t ret;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	for (i = 0; i < vlen; i++) {
+		ret = z_vrfy_zsock_recvmsg(sock, &msgvec[i].msg_hdr,
+					   flags & ~ZSOCK_MSG_WAITFORONE);
+		if (ret < 0) {
+			break;
+		}
+
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &len, sizeof(len)));
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+	}
+
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -1152,3 +1270,64 @@ int zsock_sendmsg_all(int sock, const struct net_msghdr *message, int flags,
 
 	return 0;
 }
+
+static int zsock_buf_ioctl(int sock, unsigned long request, ...)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	va_list args;
+	void *obj;
+	int ret;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	va_start(args, request);
+	ret = vtable->fd_vtable.ioctl(obj, request, args);
+	va_end(args);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+ssize_t zsock_recvfrom_buf(int sock, struct net_buf **frags, int flags,
+			   struct net_sockaddr *src_addr, net_socklen_t *addrlen)
+{
+	ssize_t bytes_received;
+
+	if (!IS_ENABLED(CONFIG_NET_SOCKETS_ZEROCOPY)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	bytes_received = zsock_buf_ioctl(sock, ZFD_IOCTL_RECV_BUF, frags, flags,
+					 src_addr, addrlen);
+
+	sock_obj_core_update_recv_stats(sock, bytes_received);
+
+	return bytes_received;
+}
+
+ssize_t zsock_sendto_buf(int sock, struct net_buf *frags, int flags,
+			 const struct net_sockaddr *dest_addr, net_socklen_t addrlen)
+{
+	ssize_t bytes_sent;
+
+	if (!IS_ENABLED(CONFIG_NET_SOCKETS_ZEROCOPY)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	bytes_sent = zsock_buf_ioctl(sock, ZFD_IOCTL_SEND_BUF, frags, flags,
+				     dest_addr, addrlen);
+
+	sock_obj_core_update_send_stats(sock, bytes_sent);
+
+	return bytes_sent;
+}
@@ -957,6 +957,7 @@ void net_socket_update_tc_rx_time(struct net_pkt *pkt, uint32_t end_tick)
 				    net_pkt_priority(pkt),
 				    net_pkt_create_time(pkt),
 				    end_tick);
+	net_stats_hist_rx_time(net_pkt_priority(pkt), net_pkt_create_time(pkt), end_tick);
 
 	SYS_PORT_TRACING_FUNC(net, rx_time, pkt, end_tick);
 
@@ -978,6 +979,7 @@ void net_socket_update_tc_rx_time(struct net_pkt *pkt, uint32_t end_tick)
 			net_pkt_iface(pkt),
 			net_pkt_priority(pkt),
 			net_pkt_stats_tick(pkt));
+		net_stats_hist_rx_time_detail(net_pkt_stats_tick(pkt));
 	}
 }
 
@@ -1361,6 +1363,164 @@ fail:
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+static bool zsock_buf_supported(struct net_context *ctx)
+{
+	return net_context_get_type(ctx) == NET_SOCK_DGRAM &&
+	       net_context_get_proto(ctx) == NET_IPPROTO_UDP &&
+	       !net_if_is_ip_offloaded(net_context_get_iface(ctx));
+}
+
+static ssize_t zsock_recv_buf_ctx(struct net_context *ctx, struct net_buf **frags,
+				  int flags, struct net_sockaddr *src_addr,
+				  net_socklen_t *addrlen)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+	size_t len;
+	int ret;
+
+	if (!zsock_buf_supported(ctx)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (frags == NULL || (flags & ZSOCK_MSG_PEEK)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, timeout);
+	if (!pkt) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (src_addr && addrlen) {
+		ret = sock_get_pkt_src_addr(ctx, pkt, src_addr, *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_pkt_src_addr %d", ret);
+			net_pkt_unref(pkt);
+			errno = -ret;
+			return -1;
+		}
+
+		*addrlen = src_addr->sa_family == NET_AF_INET6 ?
+			   sizeof(struct net_sockaddr_in6) :
+			   sizeof(struct net_sockaddr_in);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	/* The cursor is at the start of the payload, release the buffers
+	 * holding the headers and hand the rest of the chain over.
+	 */
+	len = net_pkt_remaining_data(pkt);
+	buf = pkt->buffer;
+	pkt->buffer = NULL;
+
+	while (buf != NULL && buf != pkt->cursor.buf) {
+		buf = net_buf_frag_del(NULL, buf);
+	}
+
+	if (buf != NULL) {
+		net_buf_pull(buf, pkt->cursor.pos - buf->data);
+		if (buf->len == 0U) {
+			buf = net_buf_frag_del(NULL, buf);
+		}
+	}
+
+	net_pkt_unref(pkt);
+
+	if (len == 0U && buf != NULL) {
+		net_buf_unref(buf);
+		buf = NULL;
+	}
+
+	*frags = buf;
+
+	return len;
+}
+
+static ssize_t zsock_send_buf_ctx(struct net_context *ctx, struct net_buf *frags,
+				  int flags, const struct net_sockaddr *dest_addr,
+				  net_socklen_t addrlen)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if (!zsock_buf_supported(ctx)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (frags == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	if (!sock_is_eof(ctx)) {
+		status = net_context_recv(ctx, zsock_received_cb,
+					  K_NO_WAIT, ctx->user_data);
+		if (status < 0) {
+			errno = -status;
+			return -1;
+		}
+	}
+
+	while (1) {
+		status = net_context_sendto_buf(ctx, frags, dest_addr, addrlen,
+						NULL, timeout, ctx->user_data);
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status, buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 static size_t zsock_recv_stream_immediate(struct net_context *ctx, uint8_t **buf, size_t *max_len,
 					  int flags)
 {
@@ -2018,6 +2178,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case ZSOCK_TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 
@@ -2649,6 +2823,20 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case ZSOCK_TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 		break;
@@ -3137,6 +3325,36 @@ static int sock_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 		return 0;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	case ZFD_IOCTL_RECV_BUF: {
+		struct net_buf **frags;
+		struct net_sockaddr *src_addr;
+		net_socklen_t *addrlen;
+		int flags;
+
+		frags = va_arg(args, struct net_buf **);
+		flags = va_arg(args, int);
+		src_addr = va_arg(args, struct net_sockaddr *);
+		addrlen = va_arg(args, net_socklen_t *);
+
+		return zsock_recv_buf_ctx(obj, frags, flags, src_addr, addrlen);
+	}
+
+	case ZFD_IOCTL_SEND_BUF: {
+		const struct net_sockaddr *dest_addr;
+		struct net_buf *frags;
+		net_socklen_t addrlen;
+		int flags;
+
+		frags = va_arg(args, struct net_buf *);
+		flags = va_arg(args, int);
+		dest_addr = va_arg(args, const struct net_sockaddr *);
+		addrlen = va_arg(args, net_socklen_t);
+
+		return zsock_send_buf_ctx(obj, frags, flags, dest_addr, addrlen);
+	}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 	default:
 		errno = EOPNOTSUPP;
 		return -1;
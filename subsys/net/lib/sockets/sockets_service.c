@@ -98,22 +98,6 @@ out:
 	return ret;
 }
 
-static struct net_socket_service_desc *find_svc_and_event(
-	struct zsock_pollfd *pev,
-	struct net_socket_service_event **event)
-{
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int i = 0; i < svc->pev_len; i++) {
-			if (svc->pev[i].event.fd == pev->fd) {
-				*event = &svc->pev[i];
-				return svc;
-			}
-		}
-	}
-
-	return NULL;
-}
-
 /* We do not set the user callback to our work struct because we need to
  * hook into the flow and restore the global poll array so that the next poll
  * round will not notice it and call the callback again while we are
@@ -145,17 +129,17 @@ static int call_work(struct zsock_pollfd *pev, struct net_socket_service_event *
 	return ret;
 }
 
-static int trigger_work(struct zsock_pollfd *pev)
+static int trigger_work(const struct net_socket_service_desc *svc, int j,
+			struct zsock_pollfd *pev)
 {
-	struct net_socket_service_event *event;
-	struct net_socket_service_desc *svc;
+	struct net_socket_service_event *event = &svc->pev[j];
 
-	svc = find_svc_and_event(pev, &event);
-	if (svc == NULL) {
+	/* The service was registered again since the poll array was built */
+	if (event->event.fd != pev->fd) {
 		return -ENOENT;
 	}
 
-	event->svc = svc;
+	event->svc = (struct net_socket_service_desc *)svc;
 
 	/* Copy the triggered event to our event so that we know what
 	 * was actually causing the event.
@@ -171,7 +155,7 @@ static void socket_service_thread(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
-	int ret, i, fd, count = 0;
+	int ret, fd, count = 0;
 	zvfs_eventfd_t value;
 
 	STRUCT_SECTION_COUNT(net_socket_service_desc, &ret);
@@ -218,8 +202,6 @@ static void socket_service_thread(void *p1, void *p2, void *p3)
 	ctx.events[0].events = ZSOCK_POLLIN;
 
 restart:
-	i = 1;
-
 	k_mutex_lock(&lock, K_FOREVER);
 
 	/* Copy individual events to the big array */
@@ -244,16 +226,26 @@ restart:
 			break;
 		}
 
-		/* Process work here */
-		for (i = 1; i < (count + 1); i++) {
-			if (ctx.events[i].fd < 0) {
-				continue;
+		/* Process work here. The poll entries of each service are at a
+		 * known place in the array, so walk the services directly and
+		 * stop as soon as all the ready entries have been served.
+		 */
+		STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
+			if (ret == 0) {
+				break;
 			}
 
-			if (ctx.events[i].revents > 0) {
-				ret = trigger_work(&ctx.events[i]);
-				if (ret < 0) {
-					NET_DBG("Triggering work failed (%d)", ret);
+			for (int j = 0; j < svc->pev_len && ret > 0; j++) {
+				struct zsock_pollfd *pev = &ctx.events[get_idx(svc) + j];
+
+				if (pev->fd < 0 || pev->revents == 0) {
+					continue;
+				}
+
+				ret--;
+
+				if (trigger_work(svc, j, pev) < 0) {
+					NET_DBG("Triggering work failed for service %p", svc);
 					goto restart;
 				}
 			}
@@ -46,6 +46,9 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -123,6 +126,9 @@ struct tls_session_cache {
 	/** Peer address. */
 	struct net_sockaddr peer_addr;
 
+	/** Peer hostname (SNI), NULL if not set. */
+	char *hostname;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -245,6 +251,11 @@ __net_socket struct tls_context {
 		/** Session cache enabled on a socket. */
 		bool cache_enabled;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+		/** Small writes are coalesced into records. */
+		bool record_cork;
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 		/** Socket TX timeout */
 		k_timeout_t timeout_tx;
 
@@ -266,6 +277,14 @@ __net_socket struct tls_context {
 #endif /* CONFIG_NET_SOCKETS_TLS_CERT_VERIFY_CALLBACK */
 	} options;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+	/** Data written while the socket is corked. */
+	uint8_t cork_buf[CONFIG_NET_SOCKETS_TLS_RECORD_CORK_BUF_SIZE];
+
+	/** Length of the data in cork_buf. */
+	size_t cork_len;
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	/** mbedTLS cookie context for DTLS */
 	mbedtls_ssl_cookie_ctx cookie;
@@ -310,6 +329,12 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+/* Ticket keys shared by all server sockets, set up on first use. */
+static mbedtls_ssl_ticket_context server_tickets;
+static bool server_tickets_ready;
+#endif
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -320,12 +345,23 @@ static struct k_mutex context_lock;
 
 static int tls_mbedtls_reset_session(struct tls_context *context);
 
+static void tls_session_cache_entry_free(struct tls_session_cache *entry)
+{
+	if (entry->session != NULL) {
+		mbedtls_free(entry->session);
+		entry->session = NULL;
+	}
+
+	if (entry->hostname != NULL) {
+		mbedtls_free(entry->hostname);
+		entry->hostname = NULL;
+	}
+}
+
 static void tls_session_cache_reset(void)
 {
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
-		if (client_cache[i].session != NULL) {
-			mbedtls_free(client_cache[i].session);
-		}
+		tls_session_cache_entry_free(&client_cache[i]);
 	}
 
 	(void)memset(client_cache, 0, sizeof(client_cache));
@@ -553,6 +589,8 @@ static struct tls_context *tls_alloc(void)
 			tls->options.verify_level = -1;
 			tls->options.timeout_tx = K_FOREVER;
 			tls->options.timeout_rx = K_FOREVER;
+			tls->options.cache_enabled =
+				IS_ENABLED(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE_DEFAULT);
 			tls->sock = -1;
 
 			sys_slist_init(&tls->sessions);
@@ -680,7 +718,17 @@ static bool peer_addr_cmp(const struct net_sockaddr *addr,
 	return false;
 }
 
+static bool hostname_cmp(const char *hostname, const char *peer_hostname)
+{
+	if (hostname == NULL || peer_hostname == NULL) {
+		return hostname == peer_hostname;
+	}
+
+	return strcmp(hostname, peer_hostname) == 0;
+}
+
 static int tls_session_save(const struct net_sockaddr *peer_addr,
+			    const char *hostname,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -694,8 +742,9 @@ static int tls_session_save(const struct net_sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
-				/* Reuse old entry for given address. */
+			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr) &&
+			    hostname_cmp(client_cache[i].hostname, hostname)) {
+				/* Reuse old entry for given address and hostname. */
 				entry = &client_cache[i];
 				break;
 			}
@@ -711,10 +760,7 @@ static int tls_session_save(const struct net_sockaddr *peer_addr,
 
 	/* Allocate session and save */
 
-	if (entry->session != NULL) {
-		mbedtls_free(entry->session);
-		entry->session = NULL;
-	}
+	tls_session_cache_entry_free(entry);
 
 	(void)mbedtls_ssl_session_save(session, NULL, 0, &session_len);
 
@@ -733,6 +779,17 @@ static int tls_session_save(const struct net_sockaddr *peer_addr,
 		return -ENOMEM;
 	}
 
+	if (hostname != NULL) {
+		entry->hostname = mbedtls_calloc(1, strlen(hostname) + 1);
+		if (entry->hostname == NULL) {
+			NET_ERR("Failed to allocate hostname buffer.");
+			tls_session_cache_entry_free(entry);
+			return -ENOMEM;
+		}
+
+		strcpy(entry->hostname, hostname);
+	}
+
 	entry->session_len = session_len;
 	entry->timestamp = k_uptime_get();
 	memcpy(&entry->peer_addr, peer_addr, sizeof(*peer_addr));
@@ -741,6 +798,7 @@ static int tls_session_save(const struct net_sockaddr *peer_addr,
 }
 
 static int tls_session_get(const struct net_sockaddr *peer_addr,
+			   const char *hostname,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -748,7 +806,8 @@ static int tls_session_get(const struct net_sockaddr *peer_addr,
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
 		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr) &&
+		    hostname_cmp(client_cache[i].hostname, hostname)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -762,8 +821,7 @@ static int tls_session_get(const struct net_sockaddr *peer_addr,
 				       entry->session_len);
 	if (ret < 0) {
 		/* Discard corrupted session data. */
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_cache_entry_free(entry);
 		NET_ERR("Failed to load TLS session %d", ret);
 		return -EIO;
 	}
@@ -771,6 +829,20 @@ static int tls_session_get(const struct net_sockaddr *peer_addr,
 	return 0;
 }
 
+/* Sessions are only resumed with the server name they were established
+ * with, as the server certificate is not verified again on resumption.
+ */
+static const char *tls_session_hostname(struct tls_context *context)
+{
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+	if (context->options.is_hostname_set) {
+		return context->active_session->ssl.hostname;
+	}
+#endif
+
+	return NULL;
+}
+
 static void tls_session_store(struct tls_context *context,
 			      const struct net_sockaddr *addr,
 			      net_socklen_t addrlen)
@@ -792,7 +864,7 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	ret = tls_session_save(&peer_addr, tls_session_hostname(context), &session);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -816,7 +888,7 @@ static void tls_session_restore(struct tls_context *context,
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	ret = tls_session_get(&peer_addr, tls_session_hostname(context), &session);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -839,7 +911,56 @@ static void tls_session_purge(void)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
+
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	/* Invalidate the tickets issued so far, new keys are generated on
+	 * next use.
+	 */
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	if (server_tickets_ready) {
+		mbedtls_ssl_ticket_free(&server_tickets);
+		server_tickets_ready = false;
+	}
+
+	k_mutex_unlock(&context_lock);
+#endif
+}
+
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+static int tls_server_tickets_setup(struct tls_context *context)
+{
+	int ret = 0;
+
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	if (!server_tickets_ready) {
+		mbedtls_ssl_ticket_init(&server_tickets);
+
+		ret = mbedtls_ssl_ticket_setup(&server_tickets, tls_ctr_drbg_random, NULL,
+					       MBEDTLS_CIPHER_AES_256_GCM,
+					       CONFIG_NET_SOCKETS_TLS_SESSION_TICKET_LIFETIME);
+		if (ret != 0) {
+			NET_ERR("Failed to set up session tickets, err: -0x%x.", -ret);
+			mbedtls_ssl_ticket_free(&server_tickets);
+			ret = -ENOMEM;
+			goto unlock;
+		}
+
+		server_tickets_ready = true;
+	}
+
+	mbedtls_ssl_conf_session_tickets_cb(&context->config,
+					    mbedtls_ssl_ticket_write,
+					    mbedtls_ssl_ticket_parse,
+					    &server_tickets);
+
+unlock:
+	k_mutex_unlock(&context_lock);
+
+	return ret;
 }
+#endif /* CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS */
 
 static inline int time_left(uint32_t start, uint32_t timeout)
 {
@@ -1886,6 +2007,15 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	if (is_server && context->options.cache_enabled) {
+		ret = tls_server_tickets_setup(context);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+#endif
+
 #if defined(MBEDTLS_SSL_EARLY_DATA)
 	mbedtls_ssl_conf_early_data(&context->config, MBEDTLS_SSL_EARLY_DATA_ENABLED);
 #endif
@@ -2593,6 +2723,47 @@ static int tls_opt_session_cache_get(struct tls_context *context,
 	return 0;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+static int tls_opt_record_cork_set(struct tls_context *context,
+				   const void *optval, net_socklen_t optlen)
+{
+	int *val = (int *)optval;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (sizeof(int) != optlen) {
+		return -EINVAL;
+	}
+
+	if (context->type != NET_SOCK_STREAM) {
+		return -EOPNOTSUPP;
+	}
+
+	context->options.record_cork = (*val != 0);
+
+	/* Uncorking sends the pending data right away. */
+	if (!context->options.record_cork && tls_cork_flush(context, 0) < 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+static int tls_opt_record_cork_get(struct tls_context *context,
+				   void *optval, net_socklen_t *optlen)
+{
+	if (*optlen != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = context->options.record_cork ? 1 : 0;
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 static int tls_opt_cert_verify_result_get(struct tls_context *context,
 					  void *optval, net_socklen_t *optlen)
 {
@@ -2819,6 +2990,14 @@ int ztls_close_ctx(struct tls_context *ctx, int sock)
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+	/* Data written while corked is sent before the connection is closed. */
+	if (ctx->type == NET_SOCK_STREAM && ctx->active_session != NULL &&
+	    is_handshake_complete(ctx->active_session)) {
+		(void)tls_cork_flush(ctx, 0);
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->sessions, session_ctx, node) {
 		(void)mbedtls_ssl_close_notify(&session_ctx->ssl);
 	}
@@ -2984,8 +3163,8 @@ error:
 	return -1;
 }
 
-static ssize_t send_tls(struct tls_context *ctx, const void *buf,
-			size_t len, int flags)
+static ssize_t send_tls_record(struct tls_context *ctx, const void *buf,
+			       size_t len, int flags)
 {
 	const bool is_block = is_blocking(ctx->sock, flags);
 	k_timeout_t timeout;
@@ -3063,6 +3242,59 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+/* Send the data collected while the socket was corked. On failure, errno is
+ * set and the data not sent yet is kept.
+ */
+static int tls_cork_flush(struct tls_context *ctx, int flags)
+{
+	ssize_t ret;
+
+	while (ctx->cork_len > 0) {
+		ret = send_tls_record(ctx, ctx->cork_buf, ctx->cork_len, flags);
+		if (ret < 0) {
+			return -1;
+		}
+
+		ctx->cork_len -= ret;
+		memmove(ctx->cork_buf, ctx->cork_buf + ret, ctx->cork_len);
+	}
+
+	return 0;
+}
+
+static ssize_t send_tls(struct tls_context *ctx, const void *buf,
+			size_t len, int flags)
+{
+	if (!ctx->options.record_cork) {
+		return send_tls_record(ctx, buf, len, flags);
+	}
+
+	if (ctx->error != 0) {
+		errno = ctx->error;
+		return -1;
+	}
+
+	if (len > sizeof(ctx->cork_buf) - ctx->cork_len) {
+		if (tls_cork_flush(ctx, flags) < 0) {
+			return -1;
+		}
+
+		/* Too large to be worth buffering. */
+		if (len >= sizeof(ctx->cork_buf)) {
+			return send_tls_record(ctx, buf, len, flags);
+		}
+	}
+
+	memcpy(ctx->cork_buf + ctx->cork_len, buf, len);
+	ctx->cork_len += len;
+
+	return len;
+}
+#else
+#define send_tls send_tls_record
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 				  size_t len, int flags,
@@ -4376,6 +4608,12 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_get(ctx, optval, optlen);
 		break;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+	case ZSOCK_TLS_RECORD_CORK:
+		err = tls_opt_record_cork_get(ctx, optval, optlen);
+		break;
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 	case ZSOCK_TLS_CERT_VERIFY_RESULT:
 		err = tls_opt_cert_verify_result_get(ctx, optval, optlen);
 		break;
@@ -4502,6 +4740,12 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_purge_set(ctx, optval, optlen);
 		break;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+	case ZSOCK_TLS_RECORD_CORK:
+		err = tls_opt_record_cork_set(ctx, optval, optlen);
+		break;
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 	case ZSOCK_TLS_CERT_VERIFY_CALLBACK:
 		err = tls_opt_cert_verify_callback_set(ctx, optval, optlen);
 		break;
@@ -661,6 +661,39 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* Apply the masking key to len bytes of payload starting at offset in the
+ * frame. Whole machine words are processed at once, with the key rotated to
+ * the payload offset of the first aligned byte.
+ */
+static void websocket_mask(uint8_t *buf, size_t len, uint32_t masking_value, size_t offset)
+{
+	uint8_t key[sizeof(uintptr_t)];
+	uintptr_t word_key;
+	size_t i = 0;
+
+	for (; i < len && !IS_PTR_ALIGNED(&buf[i], uintptr_t); i++, offset++) {
+		buf[i] ^= masking_value >> (8 * (3 - offset % 4));
+	}
+
+	if (len - i >= sizeof(uintptr_t)) {
+		for (size_t k = 0; k < sizeof(key); k++) {
+			key[k] = masking_value >> (8 * (3 - (offset + k) % 4));
+		}
+		memcpy(&word_key, key, sizeof(word_key));
+
+		/* sizeof(uintptr_t) is a multiple of 4, so the offset
+		 * modulo 4 does not change from one word to the next.
+		 */
+		for (; len - i >= sizeof(uintptr_t); i += sizeof(uintptr_t)) {
+			*(uintptr_t *)&buf[i] ^= word_key;
+		}
+	}
+
+	for (; i < len; i++, offset++) {
+		buf[i] ^= masking_value >> (8 * (3 - offset % 4));
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -730,8 +763,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -746,10 +777,7 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 			}
 
 			memcpy(data_to_send, payload, payload_len);
-
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+			websocket_mask(data_to_send, payload_len, ctx->masking_value, 0);
 		}
 	}
 
@@ -1063,15 +1091,9 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
 		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
 
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask(payload.buf, payload.count, ctx->masking_value, data_buf_offset);
 	}
 
 	if (ctx->message_type == WEBSOCKET_FLAG_CLOSE) {
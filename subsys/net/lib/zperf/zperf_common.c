@@ -99,6 +99,28 @@ void start_jobs(void)
 {
 	k_event_set(&start_event, START_EVENT);
 }
+
+void zperf_set_cpu_mask(k_tid_t tid, uint32_t cpu_mask)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	/* The work queue thread is idle, waiting for the session work */
+	if (cpu_mask == 0U) {
+		(void)k_thread_cpu_mask_enable_all(tid);
+		return;
+	}
+
+	(void)k_thread_cpu_mask_clear(tid);
+
+	for (int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		if ((cpu_mask & BIT(cpu)) != 0U) {
+			(void)k_thread_cpu_mask_enable(tid, cpu);
+		}
+	}
+#else
+	ARG_UNUSED(tid);
+	ARG_UNUSED(cpu_mask);
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
 #else /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
 K_THREAD_STACK_DEFINE(zperf_work_q_stack, CONFIG_ZPERF_WORK_Q_STACK_SIZE);
@@ -128,6 +128,7 @@ struct zperf_work {
 #define START_EVENT 0x0001
 extern void start_jobs(void);
 extern struct zperf_work *get_queue(enum session_proto proto, int session_id);
+extern void zperf_set_cpu_mask(k_tid_t tid, uint32_t cpu_mask);
 
 int zperf_prepare_upload_sock(const struct net_sockaddr *peer_addr, uint8_t tos,
 			      int priority, int tcp_nodelay, int proto);
@@ -1036,6 +1036,23 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			param.options.wait_for_start = true;
 			opt_cnt += 1;
 			break;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		case 'c': {
+			int cpu = parse_arg(&i, argc, argv);
+
+			if (cpu < 0 || cpu >= arch_num_cpus()) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.cpu_mask |= BIT(cpu);
+			opt_cnt += 2;
+			async = true;
+			break;
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
@@ -1289,6 +1306,23 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			param.options.wait_for_start = true;
 			opt_cnt += 1;
 			break;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		case 'c': {
+			int cpu = parse_arg(&i, argc, argv);
+
+			if (cpu < 0 || cpu >= arch_num_cpus()) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.cpu_mask |= BIT(cpu);
+			opt_cnt += 2;
+			async = true;
+			break;
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
@@ -1927,6 +1961,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Run the session on the given CPU, can be repeated\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -1951,6 +1988,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Run the session on the given CPU, can be repeated\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -2004,6 +2044,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Run the session on the given CPU, can be repeated\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -2029,6 +2072,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Run the session on the given CPU, can be repeated\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -306,6 +306,7 @@ int zperf_tcp_upload_async(const struct zperf_upload_params *param,
 
 	tid = k_work_queue_thread_get(queue);
 	k_thread_priority_set(tid, ses->async_upload_ctx.param.options.thread_priority);
+	zperf_set_cpu_mask(tid, ses->async_upload_ctx.param.options.cpu_mask);
 
 	k_work_init(&ses->async_upload_ctx.work, tcp_upload_async_work);
 
@@ -226,6 +226,28 @@ static int cal_compensate_delay(struct compensate_ctx *ctx, int64_t loop_time, i
 }
 #endif
 
+#ifdef CONFIG_NET_ZPERF_UDP_PRECISE_PACING
+/*
+ * Wait until the given hardware cycle count, sleeping for the whole system
+ * ticks before it and busy-waiting the rest, so that the packets follow the
+ * schedule much closer than the tick period. A late packet is sent right
+ * away, the schedule being absolute the following ones catch up.
+ */
+static void udp_pace_until(uint64_t deadline_cyc)
+{
+	uint32_t tick_cyc = k_ticks_to_cyc_ceil32(1);
+	int64_t remaining = (int64_t)(deadline_cyc - k_cycle_get_64());
+
+	if (remaining > 2 * (int64_t)tick_cyc) {
+		k_sleep(K_CYC(remaining - tick_cyc));
+	}
+
+	while ((int64_t)(deadline_cyc - k_cycle_get_64()) > 0) {
+		/* Busy-wait */
+	}
+}
+#endif /* CONFIG_NET_ZPERF_UDP_PRECISE_PACING */
+
 static int udp_upload(int sock, int port,
 		      const struct zperf_upload_params *param,
 		      struct zperf_results *results)
@@ -247,9 +269,15 @@ static int udp_upload(int sock, int port,
 	bool is_mcast_pkt = false;
 	int ret;
 	int compensate_delay;
+	struct zperf_client_hdr_v1 *hdr;
 #ifdef ZPERF_UDP_UPLOAD_CLOCK_COMPENSATE
 	struct compensate_ctx ctx = {0};
 #endif
+#ifdef CONFIG_NET_ZPERF_UDP_PRECISE_PACING
+	uint64_t start_cyc;
+	uint64_t period_q16;
+	uint64_t next_q16 = 0U;
+#endif
 
 	if (packet_size > PACKET_SIZE_MAX) {
 		NET_WARN("Packet size too large! max size: %u", PACKET_SIZE_MAX);
@@ -278,9 +306,27 @@ static int udp_upload(int sock, int port,
 	ctx.packet_duration_us = packet_duration_us;
 #endif
 
+	/* The client header is the same for all the packets, only the
+	 * datagram header is updated in the loop.
+	 */
+	hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
+					     sizeof(struct zperf_udp_datagram));
+	hdr->flags = 0;
+	hdr->num_of_threads = net_htonl(1);
+	hdr->port = net_htonl(port);
+	hdr->buffer_len = sizeof(sample_packet) -
+		sizeof(struct zperf_udp_datagram) - sizeof(*hdr);
+	hdr->bandwidth = net_htonl(rate_in_kbps);
+	hdr->num_of_bytes = net_htonl(packet_size);
+
+#ifdef CONFIG_NET_ZPERF_UDP_PRECISE_PACING
+	period_q16 = ((uint64_t)packet_size * 8U * sys_clock_hw_cycles_per_sec() << 16) /
+		     (rate_in_kbps * 1024U);
+	start_cyc = k_cycle_get_64();
+#endif
+
 	do {
 		struct zperf_udp_datagram *datagram;
-		struct zperf_client_hdr_v1 *hdr;
 		uint32_t secs, usecs;
 		int64_t loop_time;
 		int32_t adjust;
@@ -324,16 +370,6 @@ static int udp_upload(int sock, int port,
 		datagram->tv_sec = net_htonl(secs);
 		datagram->tv_usec = net_htonl(usecs);
 
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = net_htonl(1);
-		hdr->port = net_htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = net_htonl(rate_in_kbps);
-		hdr->num_of_bytes = net_htonl(packet_size);
-
 		/* Load custom data payload if requested */
 		if (param->data_loader != NULL) {
 			ret = param->data_loader(param->data_loader_ctx, data_offset,
@@ -364,7 +400,10 @@ static int udp_upload(int sock, int port,
 		}
 
 		/* Wait */
-#if defined(CONFIG_ARCH_POSIX)
+#if defined(CONFIG_NET_ZPERF_UDP_PRECISE_PACING)
+		next_q16 += period_q16;
+		udp_pace_until(start_cyc + (next_q16 >> 16));
+#elif defined(CONFIG_ARCH_POSIX)
 		k_busy_wait(USEC_PER_MSEC);
 #else
 		if (compensate_delay > 0) {
@@ -537,6 +576,7 @@ int zperf_udp_upload_async(const struct zperf_upload_params *param,
 
 	tid = k_work_queue_thread_get(queue);
 	k_thread_priority_set(tid, ses->async_upload_ctx.param.options.thread_priority);
+	zperf_set_cpu_mask(tid, ses->async_upload_ctx.param.options.cpu_mask);
 
 	k_work_init(&ses->async_upload_ctx.work, udp_upload_async_work);
 
@@ -33,6 +33,46 @@ static struct k_work_q pm_device_runtime_wq;
 
 #define EVENT_MASK		(EVENT_STATE_ACTIVE | EVENT_STATE_SUSPENDED)
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY
+/* Called with the device lock held, on the first get following an async put. */
+static void adaptive_delay_update(struct pm_device *pm)
+{
+	uint32_t idle_time;
+
+	if (!pm->put_pending) {
+		return;
+	}
+
+	pm->put_pending = false;
+	idle_time = k_uptime_get_32() - pm->put_time;
+	if (idle_time > CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY_MAX_MS) {
+		/* Suspending was worth it, do not extend the delay for this */
+		idle_time = 0U;
+	}
+
+	/* Moving average, so that a single long pause does not undo a burst */
+	pm->idle_time = pm->idle_time - pm->idle_time / 4U + idle_time / 4U;
+}
+
+/* Called with the device lock held, when an async suspend is queued. */
+static k_timeout_t adaptive_delay_get(struct pm_device *pm, k_timeout_t delay)
+{
+	/* Leave some margin so that the next access of a burst comes before the suspend */
+	uint32_t adaptive = MIN(pm->idle_time + pm->idle_time / 4U,
+				CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY_MAX_MS);
+
+	pm->put_time = k_uptime_get_32();
+	pm->put_pending = true;
+
+	if (K_TIMEOUT_EQ(delay, K_FOREVER) || !Z_IS_TIMEOUT_RELATIVE(delay) ||
+	    delay.ticks >= K_MSEC(adaptive).ticks) {
+		return delay;
+	}
+
+	return K_MSEC(adaptive);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY */
+
 /**
  * @brief Suspend a device
  *
@@ -89,6 +129,9 @@ static int runtime_suspend(const struct device *dev, bool async,
 		/* queue suspend */
 #ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
 		pm->base.state = PM_DEVICE_STATE_SUSPENDING;
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY
+		delay = adaptive_delay_get(pm, delay);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY */
 #ifdef CONFIG_PM_DEVICE_RUNTIME_USE_SYSTEM_WQ
 		(void)k_work_schedule(&pm->work, delay);
 #else
@@ -254,6 +297,12 @@ int pm_device_runtime_get(const struct device *dev)
 	pm->base.usage++;
 
 #ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY
+	if (pm->base.usage == 1U) {
+		adaptive_delay_update(pm);
+	}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ADAPTIVE_DELAY */
+
 	/*
 	 * Check if the device has a pending suspend operation (not started
 	 * yet) and cancel it. This way we avoid unnecessary operations because
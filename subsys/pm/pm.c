@@ -158,6 +158,7 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	k_spinlock_key_t key;
 	int32_t ticks, events_ticks;
 	uint32_t exit_latency_ticks;
+	uint32_t idle_start = 0;
 
 	SYS_PORT_TRACING_FUNC_ENTER(pm, system_suspend, kernel_ticks);
 
@@ -237,6 +238,9 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	if (IS_ENABLED(CONFIG_PM_STATS)) {
 		pm_stats_start();
 	}
+	if (IS_ENABLED(CONFIG_PM_POLICY_PREDICTIVE)) {
+		idle_start = k_cycle_get_32();
+	}
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
@@ -244,6 +248,10 @@ bool pm_system_suspend(int32_t kernel_ticks)
 
 	/* Wake up sequence starts here */
 
+	if (IS_ENABLED(CONFIG_PM_POLICY_PREDICTIVE)) {
+		pm_policy_idle_report(id, ticks, k_cyc_to_us_floor32(k_cycle_get_32() - idle_start));
+	}
+
 	if (IS_ENABLED(CONFIG_PM_STATS)) {
 		pm_stats_stop();
 		pm_stats_update(z_cpus_pm_state[id] ?
@@ -0,0 +1,185 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/pm/policy.h>
+#include <zephyr/sys_clock.h>
+#include <zephyr/pm/device.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * The idle time is predicted as in the Linux menu governor:
+ *
+ * - The time to the next scheduled event is scaled by a correction factor,
+ *   learnt from how long the CPU actually stayed idle the last times the
+ *   next event was that far. Factors are kept per CPU, in buckets of
+ *   expected idle time growing by decades.
+ * - Interrupts with a steady pattern, e.g. periodic network traffic, are
+ *   caught by the typical interval of the last idle periods, if they are
+ *   close enough to each other.
+ *
+ * All the computations are done from the idle thread of each CPU, with
+ * interrupts locked, so the per CPU data needs no locking.
+ */
+
+#define HISTORY CONFIG_PM_POLICY_PREDICTIVE_HISTORY
+#define BUCKETS 6
+
+/* Fixed point unit of the correction factors, and their decay */
+#define FACTOR_ONE   1024U
+#define FACTOR_DECAY 8U
+
+struct idle_data {
+	uint32_t history[HISTORY];
+	uint32_t factor[BUCKETS];
+	uint8_t next;
+	uint8_t count;
+};
+
+static struct idle_data idle_data[CONFIG_MP_MAX_NUM_CPUS];
+
+static uint32_t ticks_to_us(int32_t ticks)
+{
+	if (ticks == K_TICKS_FOREVER) {
+		return UINT32_MAX;
+	}
+
+	return (uint32_t)MIN(k_ticks_to_us_floor64(ticks), UINT32_MAX);
+}
+
+static uint8_t bucket_of(uint32_t expected_us)
+{
+	uint8_t bucket = 0U;
+
+	for (uint32_t limit = 10U; (expected_us >= limit) && (bucket < BUCKETS - 1U);
+	     limit *= 10U) {
+		bucket++;
+	}
+
+	return bucket;
+}
+
+/*
+ * Returns the average of the recent idle periods if they are close enough
+ * to each other, dropping the longest ones as outliers. UINT32_MAX if the
+ * periods are too spread to tell.
+ */
+static uint32_t typical_interval(const struct idle_data *data)
+{
+	uint32_t threshold = UINT32_MAX;
+
+	if (data->count < HISTORY) {
+		return UINT32_MAX;
+	}
+
+	/* At most a quarter of the periods can be dropped */
+	for (int pass = 0; pass <= HISTORY / 4; pass++) {
+		uint64_t sum = 0U;
+		uint64_t sq_sum = 0U;
+		uint32_t max = 0U;
+		uint32_t n = 0U;
+		uint64_t avg, variance;
+
+		for (int i = 0; i < HISTORY; i++) {
+			uint32_t value = data->history[i];
+
+			if (value <= threshold) {
+				sum += value;
+				sq_sum += (uint64_t)value * value;
+				max = MAX(max, value);
+				n++;
+			}
+		}
+
+		avg = sum / n;
+		variance = (sq_sum / n) - (avg * avg);
+
+		/* Standard deviation within 20us, or a sixth of the average */
+		if ((variance <= 400U) || ((variance * 36U) <= (avg * avg))) {
+			return (uint32_t)avg;
+		}
+
+		threshold = max - 1U;
+	}
+
+	return UINT32_MAX;
+}
+
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	struct idle_data *data = &idle_data[cpu];
+	uint32_t expected_us = ticks_to_us(ticks);
+	uint32_t factor = data->factor[bucket_of(expected_us)];
+	uint32_t predicted_us;
+	uint8_t num_cpu_states;
+	const struct pm_state_info *cpu_states;
+	const struct pm_state_info *out_state = NULL;
+
+#ifdef CONFIG_PM_NEED_ALL_DEVICES_IDLE
+	if (pm_device_is_any_busy()) {
+		return NULL;
+	}
+#endif
+
+	/* Buckets never updated yet trust the next event */
+	if (factor == 0U) {
+		factor = FACTOR_ONE;
+	}
+
+	predicted_us = (uint32_t)(((uint64_t)expected_us * factor) / FACTOR_ONE);
+	predicted_us = MIN(predicted_us, typical_interval(data));
+
+	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+
+	for (uint32_t i = 0; i < num_cpu_states; i++) {
+		const struct pm_state_info *state = &cpu_states[i];
+		uint32_t min_residency_us = state->min_residency_us + state->exit_latency_us;
+
+		/* The state must pay off its exit latency within the predicted idle time */
+		if (predicted_us < min_residency_us) {
+			break;
+		}
+
+		/* check if state is available. */
+		if (!pm_policy_state_is_available(state->state, state->substate_id)) {
+			continue;
+		}
+
+		out_state = state;
+	}
+
+	return out_state;
+}
+
+void pm_policy_idle_report(uint8_t cpu, int32_t ticks, uint32_t idle_us)
+{
+	struct idle_data *data = &idle_data[cpu];
+	uint32_t expected_us = ticks_to_us(ticks);
+	uint32_t *factor = &data->factor[bucket_of(expected_us)];
+	uint32_t ratio = FACTOR_ONE;
+	uint32_t sum;
+
+	if (*factor == 0U) {
+		*factor = FACTOR_ONE;
+	}
+
+	/* Waking up early lowers the factor, timer wakeups bring it back to one */
+	if ((expected_us != UINT32_MAX) && (idle_us < expected_us)) {
+		ratio = (uint32_t)(((uint64_t)idle_us * FACTOR_ONE) / expected_us);
+	}
+
+	/* Round towards the ratio so that it can be reached */
+	sum = (*factor * (FACTOR_DECAY - 1U)) + ratio;
+	if (ratio > *factor) {
+		sum += FACTOR_DECAY - 1U;
+	}
+
+	/* Zero is kept for buckets never updated */
+	*factor = MAX(sum / FACTOR_DECAY, 1U);
+
+	data->history[data->next] = idle_us;
+	data->next = (data->next + 1U) % HISTORY;
+	data->count = MIN(data->count + 1U, HISTORY);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/linker/linker-defs.h>
+
+static bool valid_stack(uintptr_t addr, k_tid_t current)
+{
+	return current->stack_info.start <= addr &&
+		addr < current->stack_info.start + current->stack_info.size;
+}
+
+static inline bool in_text_region(uintptr_t addr)
+{
+	return (addr >= (uintptr_t)__text_region_start) && (addr < (uintptr_t)__text_region_end);
+}
+
+/*
+ * This function use frame pointers to unwind stack and get trace of return addresses.
+ * Return addresses are translated in corresponding function's names using .elf file.
+ * So we get function call trace
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	if (size < 2U) {
+		return 0;
+	}
+
+	size_t idx = 0;
+
+	/*
+	 * In arm64 (arch/arm64/core/vector_table.S) the exception stack frame,
+	 * including x29 ($fp), is pushed on the thread stack on exception entry.
+	 * Then _isr_wrapper (arch/arm64/core/isr_wrapper.S) switches $sp to
+	 * _current_cpu->irq_stack and saves the thread $sp, which points to the
+	 * exception stack frame, with offset -16 on irq stack
+	 */
+	const struct arch_esf * const esf =
+		*((struct arch_esf **)(((uintptr_t)_current_cpu->irq_stack) - 16));
+
+	/*
+	 * x29 is frame pointer.
+	 *
+	 * stack frame in memory:
+	 * (addresses growth up)
+	 *  ....
+	 *  $lr
+	 *  $fp (next) <- $fp (curr)
+	 *  ....
+	 */
+	void **fp = (void **)esf->fp;
+
+	buf[idx++] = (uintptr_t)esf->elr;
+
+	/*
+	 * $lr is not saved yet in function prologue and is the only
+	 * trace of the caller in leaf functions.
+	 */
+	buf[idx++] = (uintptr_t)esf->lr;
+
+	while (valid_stack((uintptr_t)fp, _current)) {
+		if (idx >= size) {
+			return 0;
+		}
+
+		if (!in_text_region((uintptr_t)fp[1])) {
+			break;
+		}
+
+		buf[idx++] = (uintptr_t)fp[1];
+		void **new_fp = (void **)fp[0];
+
+		/*
+		 * anti-infinity-loop if
+		 * new_fp can't be smaller than fp, cause the stack is growing down
+		 * and trace moves deeper into the stack
+		 */
+		if (new_fp <= fp) {
+			break;
+		}
+		fp = new_fp;
+	}
+
+	return idx;
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <cmsis_core.h>
+
+/*
+ * Cortex-M code is not built with a frame pointer chain that could be walked
+ * from an interrupt, so only the interrupted location and the return address
+ * held in $lr are reported.
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	if (size < 2U) {
+		return 0;
+	}
+
+	/*
+	 * Threads run on the process stack. On exception entry the core pushes
+	 * r0-r3, r12, $lr, $pc and xPSR there, in the layout of struct arch_esf,
+	 * so $psp points to the interrupted thread context.
+	 */
+	const struct arch_esf * const esf = (struct arch_esf *)__get_PSP();
+
+	buf[0] = (uintptr_t)esf->basic.pc;
+	buf[1] = (uintptr_t)esf->basic.lr;
+
+	return 2;
+}
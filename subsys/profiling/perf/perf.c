@@ -10,11 +10,25 @@
 #include <zephyr/arch/cpu.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/shell/shell_uart.h>
+#include <zephyr/fs/fs.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
+/* Samples are stored as the trace length followed by the return addresses,
+ * innermost first. The top bit of the length marks samples already folded
+ * by the collapse command.
+ */
+#define SAMPLE_FOLDED (UINTPTR_MAX ^ (UINTPTR_MAX >> 1))
+
+/* Each CPU samples itself, so the buffers need no locking. */
+struct perf_cpu_buf {
+	size_t idx;
+	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
+};
+
 struct perf_data_t {
 	struct k_timer timer;
 
@@ -22,8 +36,11 @@ struct perf_data_t {
 
 	struct k_work_delayable dwork;
 
-	size_t idx;
-	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
+#ifdef CONFIG_PROFILING_PERF_SMP_IPI
+	struct k_ipi_work ipi_work;
+#endif
+
+	struct perf_cpu_buf cpu[CONFIG_MP_MAX_NUM_CPUS];
 	bool buf_full;
 };
 
@@ -34,29 +51,79 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
-static void perf_tracer(struct k_timer *timer)
+static void perf_sample(struct perf_data_t *perf_data_ptr)
 {
-	struct perf_data_t *perf_data_ptr =
-		(struct perf_data_t *)k_timer_user_data_get(timer);
-
+	struct perf_cpu_buf *cpu_buf = &perf_data_ptr->cpu[arch_curr_cpu()->id];
 	size_t trace_length = 0;
 
-	if (++perf_data_ptr->idx < CONFIG_PROFILING_PERF_BUFFER_SIZE) {
+	if (++cpu_buf->idx < CONFIG_PROFILING_PERF_BUFFER_SIZE) {
 		trace_length = arch_perf_current_stack_trace(
-					perf_data_ptr->buf + perf_data_ptr->idx,
-					CONFIG_PROFILING_PERF_BUFFER_SIZE - perf_data_ptr->idx);
+					cpu_buf->buf + cpu_buf->idx,
+					CONFIG_PROFILING_PERF_BUFFER_SIZE - cpu_buf->idx);
 	}
 
 	if (trace_length != 0) {
-		perf_data_ptr->buf[perf_data_ptr->idx - 1] = trace_length;
-		perf_data_ptr->idx += trace_length;
+		cpu_buf->buf[cpu_buf->idx - 1] = trace_length;
+		cpu_buf->idx += trace_length;
 	} else {
-		--perf_data_ptr->idx;
+		--cpu_buf->idx;
 		perf_data_ptr->buf_full = true;
 		k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
 	}
 }
 
+#ifdef CONFIG_PROFILING_PERF_SMP_IPI
+static int perf_init(void)
+{
+	k_ipi_work_init(&perf_data.ipi_work);
+
+	return 0;
+}
+
+SYS_INIT(perf_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+static void perf_ipi_tracer(struct k_ipi_work *work)
+{
+	perf_sample(CONTAINER_OF(work, struct perf_data_t, ipi_work));
+}
+
+/* The timer only interrupts one CPU, the others are sampled from an IPI. */
+static void perf_sample_others(struct perf_data_t *perf_data_ptr)
+{
+	uint32_t others = BIT_MASK(arch_num_cpus()) & ~BIT(arch_curr_cpu()->id);
+
+	/* A CPU that has not handled the previous request misses this tick. */
+	if (k_ipi_work_add(&perf_data_ptr->ipi_work, others, perf_ipi_tracer) == 0) {
+		k_ipi_work_signal();
+	}
+}
+#endif
+
+static void perf_tracer(struct k_timer *timer)
+{
+	struct perf_data_t *perf_data_ptr =
+		(struct perf_data_t *)k_timer_user_data_get(timer);
+
+	perf_sample(perf_data_ptr);
+
+#ifdef CONFIG_PROFILING_PERF_SMP_IPI
+	if (!perf_data_ptr->buf_full) {
+		perf_sample_others(perf_data_ptr);
+	}
+#endif
+}
+
+static size_t perf_buf_len(void)
+{
+	size_t len = 0;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		len += perf_data.cpu[i].idx;
+	}
+
+	return len;
+}
+
 static void perf_dwork_handler(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -107,7 +174,9 @@ static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 		shell_print(sh, "Perf buffer cleared");
 	}
 
-	perf_data.idx = 0;
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		perf_data.cpu[i].idx = 0;
+	}
 	perf_data.buf_full = false;
 
 	return 0;
@@ -119,8 +188,16 @@ static int cmd_perf_info(const struct shell *sh, size_t argc, char **argv)
 		shell_print(sh, "Perf is running");
 	}
 
-	shell_print(sh, "Perf buf: %zu/%d %s", perf_data.idx, CONFIG_PROFILING_PERF_BUFFER_SIZE,
-		    perf_data.buf_full ? "(full)" : "");
+	if (arch_num_cpus() == 1) {
+		shell_print(sh, "Perf buf: %zu/%d %s", perf_data.cpu[0].idx,
+			    CONFIG_PROFILING_PERF_BUFFER_SIZE, perf_data.buf_full ? "(full)" : "");
+		return 0;
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		shell_print(sh, "Perf buf CPU%u: %zu/%d %s", i, perf_data.cpu[i].idx,
+			    CONFIG_PROFILING_PERF_BUFFER_SIZE, perf_data.buf_full ? "(full)" : "");
+	}
 
 	return 0;
 }
@@ -132,9 +209,11 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 		return -EINPROGRESS;
 	}
 
-	shell_print(sh, "Perf buf length %zu", perf_data.idx);
-	for (size_t i = 0; i < perf_data.idx; i++) {
-		shell_print(sh, "%016lx", perf_data.buf[i]);
+	shell_print(sh, "Perf buf length %zu", perf_buf_len());
+	for (unsigned int c = 0; c < arch_num_cpus(); c++) {
+		for (size_t i = 0; i < perf_data.cpu[c].idx; i++) {
+			shell_print(sh, "%016lx", perf_data.cpu[c].buf[i]);
+		}
 	}
 
 	cmd_perf_clear(NULL, 0, NULL);
@@ -142,13 +221,142 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+struct perf_collapse_out {
+	const struct shell *sh;
+	struct fs_file_t *file;
+	int err;
+};
+
+static void collapse_write(struct perf_collapse_out *out, const char *str)
+{
+	if (out->file == NULL) {
+		shell_fprintf(out->sh, SHELL_NORMAL, "%s", str);
+	} else if (out->err == 0) {
+		ssize_t ret = fs_write(out->file, str, strlen(str));
+
+		out->err = (ret < 0) ? (int)ret : 0;
+	}
+}
+
+/* Count the samples with the same trace as the one at @p idx of CPU @p cpu,
+ * from there to the end of all buffers, and mark them as folded.
+ */
+static uint32_t collapse_count(unsigned int cpu, size_t idx)
+{
+	const uintptr_t *trace = &perf_data.cpu[cpu].buf[idx];
+	size_t len = trace[0];
+	uint32_t count = 0;
+
+	for (unsigned int c = cpu; c < arch_num_cpus(); c++) {
+		struct perf_cpu_buf *cpu_buf = &perf_data.cpu[c];
+
+		for (size_t i = (c == cpu) ? idx : 0; i < cpu_buf->idx;
+		     i += (cpu_buf->buf[i] & ~SAMPLE_FOLDED) + 1) {
+			if ((cpu_buf->buf[i] == len) &&
+			    (memcmp(&cpu_buf->buf[i + 1], &trace[1], len * sizeof(uintptr_t)) == 0)) {
+				cpu_buf->buf[i] |= SAMPLE_FOLDED;
+				count++;
+			}
+		}
+	}
+
+	return count;
+}
+
+/* Print one line per distinct trace in the collapsed stack format used by
+ * flamegraph tools: frames outermost first separated by ';', then the number
+ * of samples. Frames are left as addresses to be symbolized on the host.
+ */
+static void collapse(struct perf_collapse_out *out)
+{
+	char str[32];
+
+	for (unsigned int c = 0; c < arch_num_cpus(); c++) {
+		struct perf_cpu_buf *cpu_buf = &perf_data.cpu[c];
+
+		for (size_t i = 0; i < cpu_buf->idx; i += (cpu_buf->buf[i] & ~SAMPLE_FOLDED) + 1) {
+			size_t len = cpu_buf->buf[i];
+
+			if ((len & SAMPLE_FOLDED) != 0) {
+				continue;
+			}
+
+			uint32_t count = collapse_count(c, i);
+
+			for (size_t j = len; j > 0; j--) {
+				snprintf(str, sizeof(str), "%s0x%lx", (j == len) ? "" : ";",
+					 cpu_buf->buf[i + j]);
+				collapse_write(out, str);
+			}
+
+			snprintf(str, sizeof(str), " %u\n", count);
+			collapse_write(out, str);
+		}
+	}
+}
+
+static int cmd_perf_collapse(const struct shell *sh, size_t argc, char **argv)
+{
+	struct perf_collapse_out out = {
+		.sh = sh,
+	};
+
+	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+		shell_warn(sh, "Perf is running");
+		return -EINPROGRESS;
+	}
+
+#ifdef CONFIG_FILE_SYSTEM
+	struct fs_file_t file;
+
+	if (argc > 1) {
+		fs_file_t_init(&file);
+		out.err = fs_open(&file, argv[1], FS_O_CREATE | FS_O_WRITE | FS_O_TRUNC);
+		if (out.err < 0) {
+			shell_error(sh, "Failed to open %s (%d)", argv[1], out.err);
+			return out.err;
+		}
+		out.file = &file;
+	}
+#else
+	if (argc > 1) {
+		shell_error(sh, "File system support is disabled");
+		return -ENOTSUP;
+	}
+#endif
+
+	collapse(&out);
+
+#ifdef CONFIG_FILE_SYSTEM
+	if (out.file != NULL) {
+		int ret = fs_close(out.file);
+
+		out.err = (out.err == 0) ? ret : out.err;
+		if (out.err < 0) {
+			shell_error(sh, "Failed to write %s (%d)", argv[1], out.err);
+			return out.err;
+		}
+		shell_print(sh, "Collapsed stacks written to %s", argv[1]);
+	}
+#endif
+
+	cmd_perf_clear(NULL, 0, NULL);
+
+	return 0;
+}
+
 #define CMD_HELP_RECORD                                                                            \
 	"Start recording for <duration> ms on <frequency> Hz\n"                                    \
 	"Usage: record <duration> <frequency>"
 
+#define CMD_HELP_COLLAPSE                                                                          \
+	"Print the samples as collapsed stacks, or write them to [file]\n"                         \
+	"Usage: collapse [file]"
+
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
 	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
+	SHELL_CMD_ARG(collapse, NULL, CMD_HELP_COLLAPSE, cmd_perf_collapse, 1, 1),
 	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
 	SHELL_SUBCMD_SET_END
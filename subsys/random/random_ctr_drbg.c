@@ -28,6 +28,34 @@ static K_MUTEX_DEFINE(ctr_lock);
 
 static mbedtls_ctr_drbg_context ctr_ctx;
 
+#if CONFIG_CS_CTR_DRBG_BUFFER_SIZE > 0
+static uint8_t ctr_buf[CONFIG_CS_CTR_DRBG_BUFFER_SIZE];
+/* Number of bytes not handed out yet, at the end of ctr_buf */
+static size_t ctr_buf_avail;
+
+static int ctr_drbg_buffered_random(uint8_t *dst, size_t outlen)
+{
+	uint8_t *src;
+	int ret;
+
+	if (ctr_buf_avail < outlen) {
+		ret = mbedtls_ctr_drbg_random(&ctr_ctx, ctr_buf, sizeof(ctr_buf));
+		if (ret != 0) {
+			return ret;
+		}
+
+		ctr_buf_avail = sizeof(ctr_buf);
+	}
+
+	src = &ctr_buf[sizeof(ctr_buf) - ctr_buf_avail];
+	memcpy(dst, src, outlen);
+	memset(src, 0, outlen);
+	ctr_buf_avail -= outlen;
+
+	return 0;
+}
+#endif /* CONFIG_CS_CTR_DRBG_BUFFER_SIZE > 0 */
+
 static int ctr_drbg_entropy_func(void *ctx, unsigned char *buf, size_t len)
 {
 	return entropy_get_entropy(entropy_dev, (void *)buf, len);
@@ -76,6 +104,13 @@ int z_impl_sys_csrand_get(void *dst, size_t outlen)
 		}
 	}
 
+#if CONFIG_CS_CTR_DRBG_BUFFER_SIZE > 0
+	if (outlen < sizeof(ctr_buf)) {
+		ret = ctr_drbg_buffered_random(dst, outlen);
+		goto end;
+	}
+#endif /* CONFIG_CS_CTR_DRBG_BUFFER_SIZE > 0 */
+
 	ret = mbedtls_ctr_drbg_random(&ctr_ctx, (unsigned char *)dst, outlen);
 
 end:
@@ -81,10 +81,8 @@ static inline void rtio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe, int last_
  * @brief Submit operations in the queue to iodevs
  *
  * @param r RTIO context
- *
- * @retval 0 Always succeeds
  */
-void rtio_executor_submit(struct rtio *r)
+static void rtio_executor_drain(struct rtio *r)
 {
 	const uint16_t cancel_no_response = (RTIO_SQE_CANCELED | RTIO_SQE_NO_RESPONSE);
 	struct mpsc_node *node = mpsc_pop(&r->sq);
@@ -143,6 +141,31 @@ void rtio_executor_submit(struct rtio *r)
 	}
 }
 
+/**
+ * @brief Submit operations in the queue to iodevs
+ *
+ * @param r RTIO context
+ *
+ * @retval 0 Always succeeds
+ */
+void rtio_executor_submit(struct rtio *r)
+{
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	/* The queue has a single consumer, concurrent callers leave one more
+	 * pass to the one draining it, which then picks their submissions up.
+	 */
+	if (atomic_inc(&r->submit_pending) != 0) {
+		return;
+	}
+
+	do {
+		rtio_executor_drain(r);
+	} while (atomic_dec(&r->submit_pending) != 1);
+#else
+	rtio_executor_drain(r);
+#endif
+}
+
 /**
  * @brief Handle common logic when :c:macro:`RTIO_SQE_MULTISHOT` is set
  *
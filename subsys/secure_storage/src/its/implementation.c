@@ -4,6 +4,7 @@
 #include <zephyr/secure_storage/its.h>
 #include <zephyr/secure_storage/its/store.h>
 #include <zephyr/secure_storage/its/transform.h>
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/toolchain.h>
@@ -43,6 +44,171 @@ static void log_failed_operation(const char *operation, const char *preposition,
 	LOG_ERR("Failed to %s data %s storage. (%d)", operation, preposition, ret);
 }
 
+#if CONFIG_SECURE_STORAGE_ITS_CACHE_SIZE > 0
+
+/* Plain text copies of recently read entries, least recently used ones are evicted first. */
+static struct {
+	secure_storage_its_uid_t uid;
+	bool valid;
+	psa_storage_create_flags_t create_flags;
+	uint32_t last_use;
+	size_t data_len;
+	uint8_t data[CONFIG_SECURE_STORAGE_ITS_MAX_DATA_SIZE];
+} cache[CONFIG_SECURE_STORAGE_ITS_CACHE_SIZE];
+
+static uint32_t cache_clock;
+
+/* Incremented whenever an entry is invalidated, so that data read from storage before
+ * a concurrent write or removal of the entry does not get cached.
+ */
+static uint32_t cache_generation;
+
+static K_MUTEX_DEFINE(cache_mutex);
+
+/* Not optimized away even though the buffer is not read again afterwards. */
+static void *(*const volatile cache_memset)(void *, int, size_t) = memset;
+
+static bool cache_allowed(secure_storage_its_uid_t uid)
+{
+	switch (uid.caller_id) {
+	case SECURE_STORAGE_ITS_CALLER_PSA_ITS:
+		return IS_ENABLED(CONFIG_SECURE_STORAGE_ITS_CACHE_PSA_ITS);
+	case SECURE_STORAGE_ITS_CALLER_PSA_PS:
+		return IS_ENABLED(CONFIG_SECURE_STORAGE_ITS_CACHE_PSA_PS);
+	case SECURE_STORAGE_ITS_CALLER_MBEDTLS:
+		return IS_ENABLED(CONFIG_SECURE_STORAGE_ITS_CACHE_MBEDTLS);
+	default:
+		return false;
+	}
+}
+
+static int cache_find(secure_storage_its_uid_t uid)
+{
+	for (int i = 0; i < ARRAY_SIZE(cache); ++i) {
+		if (cache[i].valid && cache[i].uid.caller_id == uid.caller_id &&
+		    cache[i].uid.uid == uid.uid) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static void cache_clear(int i)
+{
+	cache_memset(cache[i].data, 0, cache[i].data_len);
+	cache[i].valid = false;
+}
+
+static uint32_t cache_get_generation(void)
+{
+	uint32_t generation;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	generation = cache_generation;
+	k_mutex_unlock(&cache_mutex);
+	return generation;
+}
+
+static bool cache_get(secure_storage_its_uid_t uid, size_t data_size, uint8_t *data,
+		      size_t *data_len, psa_storage_create_flags_t *create_flags)
+{
+	bool found = false;
+	int i;
+
+	if (!cache_allowed(uid)) {
+		return false;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	i = cache_find(uid);
+	if (i >= 0 && cache[i].data_len <= data_size) {
+		memcpy(data, cache[i].data, cache[i].data_len);
+		*data_len = cache[i].data_len;
+		*create_flags = cache[i].create_flags;
+		cache[i].last_use = ++cache_clock;
+		found = true;
+	}
+	k_mutex_unlock(&cache_mutex);
+	return found;
+}
+
+static void cache_put(secure_storage_its_uid_t uid, size_t data_len, const uint8_t *data,
+		      psa_storage_create_flags_t create_flags, uint32_t generation)
+{
+	int i;
+
+	if (!cache_allowed(uid) || data_len > sizeof(cache[0].data)) {
+		return;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	if (generation != cache_generation || cache_find(uid) >= 0) {
+		k_mutex_unlock(&cache_mutex);
+		return;
+	}
+	i = 0;
+	for (int j = 0; j < ARRAY_SIZE(cache); ++j) {
+		if (!cache[j].valid) {
+			i = j;
+			break;
+		}
+		if (cache[j].last_use < cache[i].last_use) {
+			i = j;
+		}
+	}
+	if (cache[i].valid) {
+		cache_clear(i);
+	}
+	cache[i].uid = uid;
+	cache[i].create_flags = create_flags;
+	cache[i].data_len = data_len;
+	memcpy(cache[i].data, data, data_len);
+	cache[i].last_use = ++cache_clock;
+	cache[i].valid = true;
+	k_mutex_unlock(&cache_mutex);
+}
+
+static void cache_invalidate(secure_storage_its_uid_t uid)
+{
+	int i;
+
+	if (!cache_allowed(uid)) {
+		return;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	i = cache_find(uid);
+	if (i >= 0) {
+		cache_clear(i);
+	}
+	++cache_generation;
+	k_mutex_unlock(&cache_mutex);
+}
+
+#else
+
+static inline uint32_t cache_get_generation(void)
+{
+	return 0;
+}
+
+static inline bool cache_get(secure_storage_its_uid_t uid, size_t data_size, uint8_t *data,
+			     size_t *data_len, psa_storage_create_flags_t *create_flags)
+{
+	return false;
+}
+
+static inline void cache_put(secure_storage_its_uid_t uid, size_t data_len, const uint8_t *data,
+			     psa_storage_create_flags_t create_flags, uint32_t generation)
+{
+}
+
+static inline void cache_invalidate(secure_storage_its_uid_t uid)
+{
+}
+
+#endif /* CONFIG_SECURE_STORAGE_ITS_CACHE_SIZE > 0 */
+
 static psa_status_t get_stored_data(
 		secure_storage_its_uid_t uid,
 		uint8_t stored_data[static SECURE_STORAGE_ITS_TRANSFORM_MAX_STORED_DATA_SIZE],
@@ -83,14 +249,24 @@ static psa_status_t get_entry(secure_storage_its_uid_t uid, size_t data_size, ui
 	psa_status_t ret;
 	uint8_t stored_data[SECURE_STORAGE_ITS_TRANSFORM_MAX_STORED_DATA_SIZE];
 	size_t stored_data_len;
+	uint32_t generation;
+
+	if (cache_get(uid, data_size, data, data_len, create_flags)) {
+		return PSA_SUCCESS;
+	}
+	generation = cache_get_generation();
 
 	ret = get_stored_data(uid, stored_data, &stored_data_len);
 	if (ret != PSA_SUCCESS) {
 		return ret;
 	}
 
-	return transform_stored_data(uid, stored_data_len, stored_data, data_size, data, data_len,
-				     create_flags);
+	ret = transform_stored_data(uid, stored_data_len, stored_data, data_size, data, data_len,
+				    create_flags);
+	if (ret == PSA_SUCCESS) {
+		cache_put(uid, *data_len, data, *create_flags, generation);
+	}
+	return ret;
 }
 
 static bool keep_stored_entry(secure_storage_its_uid_t uid, size_t data_length, const void *p_data,
@@ -143,7 +319,12 @@ static psa_status_t store_entry(secure_storage_its_uid_t uid, size_t data_length
 		return PSA_ERROR_GENERIC_ERROR;
 	}
 
+	/* Invalidate before and after the write so that a concurrent read cannot cache either
+	 * the old data after the write, or data it read from storage before the write.
+	 */
+	cache_invalidate(uid);
 	ret = secure_storage_its_store_set(uid, stored_data_len, stored_data);
+	cache_invalidate(uid);
 	if (ret != PSA_SUCCESS) {
 		log_failed_operation("write", "to", ret);
 	}
@@ -194,31 +375,45 @@ psa_status_t secure_storage_its_get(secure_storage_its_caller_id_t caller_id, ps
 		return PSA_SUCCESS;
 	}
 
-	ret = get_stored_data(its_uid, stored_data, &stored_data_len);
-	if (ret != PSA_SUCCESS) {
-		return ret;
-	}
-	if (data_offset == 0
-	 && data_size >= SECURE_STORAGE_ITS_TRANSFORM_DATA_SIZE(stored_data_len)) {
-		/* All the data fits directly in the provided buffer. */
-		return transform_stored_data(its_uid, stored_data_len, stored_data, data_size,
-					     p_data, p_data_length, &create_flags);
-	}
 	uint8_t data[CONFIG_SECURE_STORAGE_ITS_MAX_DATA_SIZE];
 	size_t data_len;
 
-	ret = transform_stored_data(its_uid, stored_data_len, stored_data, sizeof(data), data,
-				    &data_len, &create_flags);
-	if (ret == PSA_SUCCESS) {
-		if (data_offset > data_len) {
-			LOG_DBG("Passed data offset (%zu) exceeds existing data length (%zu).",
-				data_offset, data_len);
-			return PSA_ERROR_INVALID_ARGUMENT;
+	if (!cache_get(its_uid, sizeof(data), data, &data_len, &create_flags)) {
+		const uint32_t generation = cache_get_generation();
+
+		ret = get_stored_data(its_uid, stored_data, &stored_data_len);
+		if (ret != PSA_SUCCESS) {
+			return ret;
+		}
+		if (data_offset == 0
+		 && data_size >= SECURE_STORAGE_ITS_TRANSFORM_DATA_SIZE(stored_data_len)) {
+			/* All the data fits directly in the provided buffer. */
+			ret = transform_stored_data(its_uid, stored_data_len, stored_data,
+						    data_size, p_data, p_data_length,
+						    &create_flags);
+			if (ret == PSA_SUCCESS) {
+				cache_put(its_uid, *p_data_length, p_data, create_flags,
+					  generation);
+			}
+			return ret;
+		}
+
+		ret = transform_stored_data(its_uid, stored_data_len, stored_data, sizeof(data),
+					    data, &data_len, &create_flags);
+		if (ret != PSA_SUCCESS) {
+			return ret;
 		}
-		*p_data_length = MIN(data_size, data_len - data_offset);
-		memcpy(p_data, data + data_offset, *p_data_length);
+		cache_put(its_uid, data_len, data, create_flags, generation);
 	}
-	return ret;
+
+	if (data_offset > data_len) {
+		LOG_DBG("Passed data offset (%zu) exceeds existing data length (%zu).",
+			data_offset, data_len);
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+	*p_data_length = MIN(data_size, data_len - data_offset);
+	memcpy(p_data, data + data_offset, *p_data_length);
+	return PSA_SUCCESS;
 }
 
 psa_status_t secure_storage_its_get_info(secure_storage_its_caller_id_t caller_id,
@@ -260,7 +455,9 @@ psa_status_t secure_storage_its_remove(secure_storage_its_caller_id_t caller_id,
 	if (ret == PSA_SUCCESS ||
 	    ret == PSA_ERROR_STORAGE_FAILURE ||
 	    ret == PSA_ERROR_GENERIC_ERROR) {
+		cache_invalidate(its_uid);
 		ret = secure_storage_its_store_remove(its_uid);
+		cache_invalidate(its_uid);
 		if (ret != PSA_SUCCESS) {
 			log_failed_operation("remove", "from", ret);
 			return PSA_ERROR_STORAGE_FAILURE;
@@ -23,23 +23,28 @@ static inline bool sensor_test_consume_time(struct sensing_sensor *sensor,
 }
 
 static void update_client_consume_time(struct sensing_sensor *sensor,
-				       struct sensing_connection *conn)
+				       struct sensing_connection *conn,
+				       uint64_t cur_time)
 {
 	uint32_t interval = conn->interval;
 
 	if (conn->next_consume_time == 0) {
-		conn->next_consume_time = get_us();
+		conn->next_consume_time = cur_time;
 	}
 
 	conn->next_consume_time += interval;
 }
 
-/* send data to clients based on interval and sensitivity */
+/* send data to clients based on interval and sensitivity, all of them get
+ * the same sample buffer
+ */
 static int send_data_to_clients(struct sensing_sensor *sensor,
 				void *data)
 {
 	struct sensing_sensor *client;
 	struct sensing_connection *conn;
+	/* Read once per sample, it is a system call from user mode */
+	uint64_t cur_time = get_us();
 
 	for_each_client_conn(sensor, conn) {
 		client = conn->sink;
@@ -53,11 +58,11 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 		 * true: it's time for client consuming the data
 		 * false: client time not arrived yet, not consume the data
 		 */
-		if (!sensor_test_consume_time(sensor, conn, get_us())) {
+		if (!sensor_test_consume_time(sensor, conn, cur_time)) {
 			continue;
 		}
 
-		update_client_consume_time(sensor, conn);
+		update_client_consume_time(sensor, conn, cur_time);
 
 		if (!conn->callback_list->on_data_event) {
 			LOG_WRN("sensor:%s event callback not registered",
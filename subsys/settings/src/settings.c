@@ -27,6 +27,132 @@ sys_slist_t settings_handlers;
 static K_MUTEX_DEFINE(settings_lock);
 #endif
 
+#ifdef CONFIG_SETTINGS_HANDLER_HASH
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_SETTINGS_HANDLER_HASH_SIZE),
+	     "Settings handler hash table size must be a power of two");
+
+#define HANDLER_HASH_MASK (CONFIG_SETTINGS_HANDLER_HASH_SIZE - 1U)
+
+/* Static handlers by hash of their name, with linear probing. Names are
+ * hashed with FNV-1a so that the hashes of all the prefixes of a key are
+ * obtained in one pass.
+ */
+static struct settings_handler_static *handler_hash[CONFIG_SETTINGS_HANDLER_HASH_SIZE];
+static bool handler_hash_ready;
+
+#define NAME_HASH_INIT 2166136261U
+
+static inline uint32_t name_hash_step(uint32_t hash, char c)
+{
+	return (hash ^ (uint8_t)c) * 16777619U;
+}
+
+static void handler_hash_init(void)
+{
+	size_t used = 0;
+
+	memset(handler_hash, 0, sizeof(handler_hash));
+	handler_hash_ready = false;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		uint32_t hash = NAME_HASH_INIT;
+		uint32_t pos;
+
+		/* Keep a free slot to end the probes */
+		if (used == HANDLER_HASH_MASK) {
+			LOG_WRN("Handler hash table too small, using linear lookup");
+			return;
+		}
+
+		for (const char *c = ch->name; *c != '\0'; c++) {
+			hash = name_hash_step(hash, *c);
+		}
+
+		pos = hash & HANDLER_HASH_MASK;
+		while (handler_hash[pos] != NULL) {
+			pos = (pos + 1U) & HANDLER_HASH_MASK;
+		}
+
+		handler_hash[pos] = ch;
+		used++;
+	}
+
+	handler_hash_ready = true;
+}
+
+static struct settings_handler_static *handler_hash_find(const char *name, size_t len,
+							 uint32_t hash)
+{
+	struct settings_handler_static *ch;
+
+	for (uint32_t pos = hash & HANDLER_HASH_MASK; handler_hash[pos] != NULL;
+	     pos = (pos + 1U) & HANDLER_HASH_MASK) {
+		ch = handler_hash[pos];
+		if ((strncmp(ch->name, name, len) == 0) && (ch->name[len] == '\0')) {
+			return ch;
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the static handler with the longest name matching a prefix of @p name,
+ * as the linear lookup of settings_parse_and_lookup() would.
+ */
+static bool handler_hash_lookup(const char *name, struct settings_handler_static **bestmatch,
+				const char **next)
+{
+	uint32_t hashes[SETTINGS_MAX_DIR_DEPTH + 1];
+	size_t lens[SETTINGS_MAX_DIR_DEPTH + 1];
+	uint32_t hash = NAME_HASH_INIT;
+	size_t num = 0;
+
+	if (!handler_hash_ready) {
+		return false;
+	}
+
+	for (size_t len = 0; num < ARRAY_SIZE(hashes); len++) {
+		char c = name[len];
+
+		if ((c == '\0') || (c == SETTINGS_NAME_END) || (c == SETTINGS_NAME_SEPARATOR)) {
+			hashes[num] = hash;
+			lens[num] = len;
+			num++;
+			if (c != SETTINGS_NAME_SEPARATOR) {
+				break;
+			}
+		}
+
+		hash = name_hash_step(hash, c);
+	}
+
+	*bestmatch = NULL;
+
+	while (num-- > 0) {
+		*bestmatch = handler_hash_find(name, lens[num], hashes[num]);
+		if (*bestmatch != NULL) {
+			if (next && (name[lens[num]] == SETTINGS_NAME_SEPARATOR)) {
+				*next = &name[lens[num] + 1];
+			}
+			break;
+		}
+	}
+
+	return true;
+}
+#else
+static inline void handler_hash_init(void)
+{
+}
+
+static inline bool handler_hash_lookup(const char *name,
+				       struct settings_handler_static **bestmatch,
+				       const char **next)
+{
+	return false;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_HASH */
+
 void settings_store_init(void);
 
 void settings_init(void)
@@ -34,6 +160,7 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+	handler_hash_init();
 	settings_store_init();
 }
 
@@ -154,21 +281,23 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
-	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
-		if (!settings_name_steq(name, ch->name, &tmpnext)) {
-			continue;
-		}
-		if (!bestmatch) {
-			bestmatch = ch;
-			if (next) {
-				*next = tmpnext;
+	if (!handler_hash_lookup(name, &bestmatch, next)) {
+		STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+			if (!settings_name_steq(name, ch->name, &tmpnext)) {
+				continue;
 			}
-			continue;
-		}
-		if (settings_name_steq(ch->name, bestmatch->name, NULL)) {
-			bestmatch = ch;
-			if (next) {
-				*next = tmpnext;
+			if (!bestmatch) {
+				bestmatch = ch;
+				if (next) {
+					*next = tmpnext;
+				}
+				continue;
+			}
+			if (settings_name_steq(ch->name, bestmatch->name, NULL)) {
+				bestmatch = ch;
+				if (next) {
+					*next = tmpnext;
+				}
 			}
 		}
 	}
@@ -117,6 +117,15 @@ void settings_lock_take(void);
 /** Releases the settings mutex lock (if multithreading is enabled) */
 void settings_lock_release(void);
 
+/** Completes a transaction interrupted during its commit, with the lock held */
+#ifdef CONFIG_SETTINGS_TRANSACTION
+void settings_transaction_recover(void);
+#else
+static inline void settings_transaction_recover(void)
+{
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,6 +53,7 @@ int settings_load_subtree(const char *subtree)
 	 *    commit all
 	 */
 	settings_lock_take();
+	settings_transaction_recover();
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -80,6 +81,7 @@ int settings_load_subtree_direct(
 	 *    commit all
 	 */
 	settings_lock_take();
+	settings_transaction_recover();
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -0,0 +1,199 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/byteorder.h>
+#include "settings_priv.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
+
+/* Key of the journal, written in one piece as the commit point of a
+ * transaction and deleted once all its items are saved.
+ */
+#define SETTINGS_TRANSACTION_JOURNAL "stxn"
+
+/* Journal records: NUL terminated name, little endian 16 bit value length
+ * and value. A zero length deletes the item.
+ */
+static uint8_t journal[CONFIG_SETTINGS_TRANSACTION_BUF_SIZE];
+static size_t journal_len;
+static bool in_transaction;
+
+static int journal_apply(struct settings_store *cs, const uint8_t *buf, size_t len)
+{
+	size_t off = 0;
+	int rc = 0;
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	while (off < len) {
+		const char *name = (const char *)&buf[off];
+		size_t name_len = strnlen(name, len - off);
+		uint16_t val_len;
+
+		if ((off + name_len + 1 + sizeof(val_len)) > len) {
+			rc = -EINVAL;
+			break;
+		}
+
+		off += name_len + 1;
+		val_len = sys_get_le16(&buf[off]);
+		off += sizeof(val_len);
+
+		if ((off + val_len) > len) {
+			rc = -EINVAL;
+			break;
+		}
+
+		rc = cs->cs_itf->csi_save(cs, name, (val_len != 0) ? (const char *)&buf[off] : NULL,
+					  val_len);
+		if (rc) {
+			break;
+		}
+
+		off += val_len;
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		cs->cs_itf->csi_save_end(cs);
+	}
+
+	return rc;
+}
+
+int settings_transaction_begin(void)
+{
+	if (settings_save_dst == NULL) {
+		return -ENOENT;
+	}
+
+	settings_lock_take();
+
+	if (in_transaction) {
+		settings_lock_release();
+		return -EBUSY;
+	}
+
+	in_transaction = true;
+	journal_len = 0;
+
+	return 0;
+}
+
+int settings_transaction_set(const char *name, const void *value, size_t val_len)
+{
+	size_t name_len = strlen(name) + 1;
+
+	if (!in_transaction) {
+		return -EINVAL;
+	}
+
+	if ((val_len > UINT16_MAX) || ((val_len > 0) && (value == NULL))) {
+		return -EINVAL;
+	}
+
+	if ((journal_len + name_len + sizeof(uint16_t) + val_len) > sizeof(journal)) {
+		return -ENOMEM;
+	}
+
+	memcpy(&journal[journal_len], name, name_len);
+	journal_len += name_len;
+	sys_put_le16(val_len, &journal[journal_len]);
+	journal_len += sizeof(uint16_t);
+	if (val_len > 0) {
+		memcpy(&journal[journal_len], value, val_len);
+		journal_len += val_len;
+	}
+
+	return 0;
+}
+
+int settings_transaction_commit(void)
+{
+	struct settings_store *cs = settings_save_dst;
+	int rc = 0;
+
+	if (!in_transaction) {
+		return -EINVAL;
+	}
+
+	if (journal_len == 0) {
+		goto end;
+	}
+
+	rc = cs->cs_itf->csi_save(cs, SETTINGS_TRANSACTION_JOURNAL, (const char *)journal,
+				  journal_len);
+	if (rc) {
+		goto end;
+	}
+
+	/* From here on the transaction is completed on the next load if
+	 * interrupted.
+	 */
+	rc = journal_apply(cs, journal, journal_len);
+	if (rc == 0) {
+		rc = cs->cs_itf->csi_save(cs, SETTINGS_TRANSACTION_JOURNAL, NULL, 0);
+	}
+
+end:
+	in_transaction = false;
+	settings_lock_release();
+
+	return rc;
+}
+
+void settings_transaction_abort(void)
+{
+	if (!in_transaction) {
+		return;
+	}
+
+	in_transaction = false;
+	settings_lock_release();
+}
+
+void settings_transaction_recover(void)
+{
+	struct settings_store *cs = settings_save_dst;
+	ssize_t len;
+	int rc;
+
+	/* Called with the settings lock held, the journal buffer is only free
+	 * outside of transactions.
+	 */
+	if ((cs == NULL) || in_transaction) {
+		return;
+	}
+
+	len = settings_load_one(SETTINGS_TRANSACTION_JOURNAL, journal, sizeof(journal));
+	if (len <= 0) {
+		return;
+	}
+
+	if (len > sizeof(journal)) {
+		LOG_ERR("Transaction journal too large (%zd), dropped", len);
+	} else {
+		rc = journal_apply(cs, journal, len);
+		if (rc == -EINVAL) {
+			LOG_ERR("Invalid transaction journal, dropped");
+		} else if (rc) {
+			/* Retried on the next load */
+			LOG_ERR("Failed to complete transaction (%d)", rc);
+			return;
+		} else {
+			LOG_INF("Completed interrupted transaction");
+		}
+	}
+
+	(void)cs->cs_itf->csi_save(cs, SETTINGS_TRANSACTION_JOURNAL, NULL, 0);
+}
@@ -28,6 +28,7 @@ struct shell_telnet *sh_telnet;
 #define TELNET_PORT      CONFIG_SHELL_TELNET_PORT
 #define TELNET_LINE_SIZE CONFIG_SHELL_TELNET_LINE_BUF_SIZE
 #define TELNET_TIMEOUT   CONFIG_SHELL_TELNET_SEND_TIMEOUT
+#define TELNET_TX_RING_SIZE CONFIG_SHELL_TELNET_TX_RING_BUFFER_SIZE
 
 #define TELNET_MIN_COMMAND_LEN 2
 #define TELNET_WILL_DO_COMMAND_LEN 3
@@ -41,6 +42,7 @@ struct shell_telnet *sh_telnet;
 
 static void telnet_server_cb(struct net_socket_service_event *evt);
 static int telnet_init(struct shell_telnet *ctx);
+static void telnet_tx_reset(void);
 
 NET_SOCKET_SERVICE_SYNC_DEFINE_STATIC(telnet_server, telnet_server_cb,
 				      SHELL_TELNET_POLLFD_COUNT);
@@ -162,9 +164,9 @@ static void telnet_reply_command(struct telnet_simple_command *cmd)
 	case NVT_CMD_AO:
 		/* OK, no output then */
 		sh_telnet->output_lock = true;
-		sh_telnet->line_out.len = 0;
 		k_work_cancel_delayable_sync(&sh_telnet->send_work,
 					     &sh_telnet->work_sync);
+		telnet_tx_reset();
 		break;
 	case NVT_CMD_AYT:
 		telnet_reply_ay_command();
@@ -181,6 +183,109 @@ static void telnet_reply_command(struct telnet_simple_command *cmd)
 	}
 }
 
+#if TELNET_TX_RING_SIZE > 0
+static void telnet_tx_reset(void)
+{
+	k_mutex_lock(&sh_telnet->tx_lock, K_FOREVER);
+	ring_buf_reset(&sh_telnet->tx_ringbuf);
+	k_mutex_unlock(&sh_telnet->tx_lock);
+}
+
+/* Sends queued output without blocking. Returns the number of bytes sent, or
+ * -EAGAIN if none could be.
+ */
+static int telnet_tx_drain(void)
+{
+	uint8_t *data;
+	uint32_t len;
+	int sent = 0;
+	int ret;
+
+	if (sh_telnet->fds[SOCK_ID_CLIENT].fd < 0) {
+		return -ENOTCONN;
+	}
+
+	k_mutex_lock(&sh_telnet->tx_lock, K_FOREVER);
+
+	while ((len = ring_buf_get_claim(&sh_telnet->tx_ringbuf, &data,
+					 TELNET_TX_RING_SIZE)) > 0) {
+		ret = zsock_send(sh_telnet->fds[SOCK_ID_CLIENT].fd, data, len,
+				 ZSOCK_MSG_DONTWAIT);
+		if (ret < 0) {
+			ret = -errno;
+			(void)ring_buf_get_finish(&sh_telnet->tx_ringbuf, 0);
+			k_mutex_unlock(&sh_telnet->tx_lock);
+			return ((ret == -EAGAIN) && (sent > 0)) ? sent : ret;
+		}
+
+		(void)ring_buf_get_finish(&sh_telnet->tx_ringbuf, ret);
+		sent += ret;
+	}
+
+	k_mutex_unlock(&sh_telnet->tx_lock);
+
+	return sent;
+}
+
+/* Queues output, sent from the system workqueue once enough of it is queued
+ * or after TELNET_TIMEOUT.
+ */
+static int telnet_tx_queue(const void *data, size_t length, size_t *cnt)
+{
+	uint32_t queued;
+
+	k_mutex_lock(&sh_telnet->tx_lock, K_FOREVER);
+	*cnt = ring_buf_put(&sh_telnet->tx_ringbuf, data, length);
+	queued = ring_buf_size_get(&sh_telnet->tx_ringbuf);
+	k_mutex_unlock(&sh_telnet->tx_lock);
+
+	if (*cnt < length) {
+		/* Full, do not hurry a pending retry of a blocked socket */
+		k_work_schedule(&sh_telnet->send_work, K_NO_WAIT);
+
+		if (IS_ENABLED(CONFIG_SHELL_TELNET_TX_OVERFLOW_DROP)) {
+			*cnt = length;
+		}
+	} else if (queued >= (TELNET_TX_RING_SIZE / 2)) {
+		k_work_reschedule(&sh_telnet->send_work, K_NO_WAIT);
+	} else {
+		/* Keeps the deadline of output queued earlier */
+		k_work_schedule(&sh_telnet->send_work, K_MSEC(TELNET_TIMEOUT));
+	}
+
+	return 0;
+}
+
+static void telnet_send_prematurely(struct k_work *work)
+{
+	int ret;
+
+	ret = telnet_tx_drain();
+	if (ret == -EAGAIN) {
+		/* Nothing was sent, retry without waking up the shell. */
+		k_work_reschedule(&sh_telnet->send_work, K_MSEC(TELNET_TIMEOUT));
+		return;
+	}
+
+	if ((ret < 0) && (ret != -ENOTCONN)) {
+		LOG_ERR("Failed to send %d, shutting down", -ret);
+		telnet_end_client_connection();
+	} else if ((ret > 0) && (ring_buf_size_get(&sh_telnet->tx_ringbuf) > 0)) {
+		/* Not all data was sent, reschedule the work. */
+		k_work_reschedule(&sh_telnet->send_work, K_MSEC(TELNET_TIMEOUT));
+	}
+
+	/* Let the shell write again if it waits for space, output is
+	 * discarded once disconnected.
+	 */
+	sh_telnet->shell_handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_telnet->shell_context);
+}
+#else
+static void telnet_tx_reset(void)
+{
+	sh_telnet->line_out.len = 0;
+}
+
 static int telnet_send(bool block)
 {
 	int ret;
@@ -235,6 +340,7 @@ static void telnet_send_prematurely(struct k_work *work)
 		k_work_reschedule(&sh_telnet->send_work, K_MSEC(TELNET_TIMEOUT));
 	}
 }
+#endif
 
 static int telnet_command_length(uint8_t op)
 {
@@ -432,7 +538,7 @@ static void telnet_accept(struct zsock_pollfd *pollfd)
 	sh_telnet->fds[SOCK_ID_CLIENT].events = ZSOCK_POLLIN;
 	sh_telnet->rx_len = 0;
 	sh_telnet->cmd_len = 0;
-	sh_telnet->line_out.len = 0;
+	telnet_tx_reset();
 
 	ret = net_socket_service_register(&telnet_server, sh_telnet->fds,
 					  ARRAY_SIZE(sh_telnet->fds), NULL);
@@ -645,6 +751,10 @@ static int init(const struct shell_transport *transport,
 
 	k_work_init_delayable(&sh_telnet->send_work, telnet_send_prematurely);
 	k_mutex_init(&sh_telnet->rx_lock);
+#if TELNET_TX_RING_SIZE > 0
+	ring_buf_init(&sh_telnet->tx_ringbuf, sizeof(sh_telnet->tx_buf), sh_telnet->tx_buf);
+	k_mutex_init(&sh_telnet->tx_lock);
+#endif
 
 	return 0;
 }
@@ -667,8 +777,8 @@ static int enable(const struct shell_transport *transport, bool blocking)
 	return 0;
 }
 
-static int telnet_write(const struct shell_transport *transport,
-			const void *data, size_t length, size_t *cnt)
+#if TELNET_TX_RING_SIZE == 0
+static int telnet_line_write(const void *data, size_t length, size_t *cnt)
 {
 	struct shell_telnet_line_buf *lb;
 	size_t copy_len;
@@ -676,16 +786,6 @@ static int telnet_write(const struct shell_transport *transport,
 	uint32_t timeout;
 	bool was_running;
 
-	if (sh_telnet == NULL) {
-		*cnt = 0;
-		return -ENODEV;
-	}
-
-	if (sh_telnet->fds[SOCK_ID_CLIENT].fd < 0 || sh_telnet->output_lock) {
-		*cnt = length;
-		return 0;
-	}
-
 	*cnt = 0;
 	lb = &sh_telnet->line_out;
 
@@ -739,6 +839,27 @@ static int telnet_write(const struct shell_transport *transport,
 
 	return 0;
 }
+#endif /* TELNET_TX_RING_SIZE == 0 */
+
+static int telnet_write(const struct shell_transport *transport,
+			const void *data, size_t length, size_t *cnt)
+{
+	if (sh_telnet == NULL) {
+		*cnt = 0;
+		return -ENODEV;
+	}
+
+	if (sh_telnet->fds[SOCK_ID_CLIENT].fd < 0 || sh_telnet->output_lock) {
+		*cnt = length;
+		return 0;
+	}
+
+#if TELNET_TX_RING_SIZE > 0
+	return telnet_tx_queue(data, length, cnt);
+#else
+	return telnet_line_write(data, length, cnt);
+#endif
+}
 
 static int telnet_read(const struct shell_transport *transport,
 		       void *data, size_t length, size_t *cnt)
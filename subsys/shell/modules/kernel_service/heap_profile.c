@@ -0,0 +1,78 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/heap_profiler.h>
+
+static void print_site(const struct sys_heap_profiler_site *site, void *user_data)
+{
+	const struct shell *sh = user_data;
+	const char *name = "";
+
+	if (site->thread == NULL) {
+		name = "(isr/pre-kernel)";
+	} else if (IS_ENABLED(CONFIG_THREAD_NAME) && z_thread_is_valid(site->thread)) {
+		name = k_thread_name_get((k_tid_t)site->thread);
+	}
+
+	shell_print(sh, "%#lx %p %-16s %8u %8u %8zu %8zu", (unsigned long)site->heap_id,
+		    site->thread, name, site->allocs, site->frees, site->live_bytes,
+		    site->peak_bytes);
+
+	shell_fprintf(sh, SHELL_NORMAL, "    sizes:");
+	for (unsigned int n = 0; n < SYS_HEAP_PROFILER_HIST_BUCKETS; n++) {
+		if (n < SYS_HEAP_PROFILER_HIST_BUCKETS - 1) {
+			shell_fprintf(sh, SHELL_NORMAL, " <=%u:%u",
+				      SYS_HEAP_PROFILER_HIST_LIMIT(n), site->hist[n]);
+		} else {
+			shell_fprintf(sh, SHELL_NORMAL, " more:%u", site->hist[n]);
+		}
+	}
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+}
+
+static int cmd_kernel_heap_profile(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct sys_heap_profiler_stats stats;
+
+	sys_heap_profiler_stats_get(&stats);
+
+	shell_print(sh, "allocs:         %u", stats.allocs);
+	shell_print(sh, "frees:          %u", stats.frees);
+	shell_print(sh, "live:           %zu", stats.live_bytes);
+	shell_print(sh, "peak:           %zu", stats.peak_bytes);
+	shell_print(sh, "untracked:      %u", stats.untracked);
+	shell_print(sh, "dropped:        %u", stats.dropped);
+	shell_print(sh, "\nheap       thread     name               allocs    frees     live     peak");
+
+	sys_heap_profiler_foreach(print_site, (void *)sh);
+
+	return 0;
+}
+
+static int cmd_kernel_heap_profile_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_heap_profiler_reset();
+	shell_print(sh, "Heap profile reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_heap_profile,
+	SHELL_CMD(reset, NULL, "Reset allocation profile.", cmd_kernel_heap_profile_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+KERNEL_CMD_ADD(heap_profile, &sub_kernel_heap_profile, "Heap allocation profile per site.",
+	       cmd_kernel_heap_profile);
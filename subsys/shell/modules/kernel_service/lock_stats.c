@@ -0,0 +1,61 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/lock_stats.h>
+
+static uint64_t mean_ns(uint64_t total, uint32_t count)
+{
+	return (count == 0U) ? 0U : k_cyc_to_ns_floor64(total / count);
+}
+
+static void print_lock(const struct k_lock_stats *stats, void *user_data)
+{
+	const struct shell *sh = user_data;
+
+	shell_print(sh, "%-20s %10u %10u %10llu %10llu %10llu %10llu", stats->name,
+		    stats->acquires, stats->contended,
+		    mean_ns(stats->wait_total, stats->acquires),
+		    k_cyc_to_ns_floor64(stats->wait_max),
+		    mean_ns(stats->hold_total, stats->acquires),
+		    k_cyc_to_ns_floor64(stats->hold_max));
+}
+
+static int cmd_kernel_lockstat(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-20s %10s %10s %10s %10s %10s %10s", "lock", "acquires", "contended",
+		    "wait avg", "wait max", "hold avg", "hold max");
+	shell_print(sh, "%-20s %10s %10s %10s %10s %10s %10s", "", "", "", "[ns]", "[ns]",
+		    "[ns]", "[ns]");
+
+	k_lock_stats_foreach(print_lock, (void *)sh);
+
+	return 0;
+}
+
+static int cmd_kernel_lockstat_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_lock_stats_reset();
+	shell_print(sh, "Lock statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_lockstat,
+	SHELL_CMD(reset, NULL, "Reset lock statistics.", cmd_kernel_lockstat_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+KERNEL_CMD_ADD(lockstat, &sub_kernel_lockstat, "Lock contention statistics.",
+	       cmd_kernel_lockstat);
@@ -48,6 +48,22 @@ static void rt_stats_dump(const struct shell *sh, struct k_thread *thread)
 		shell_print(sh, "\tAverage execution cycles: %u",
 			    (uint32_t)rt_stats_thread.average_cycles);
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		shell_print(sh, "\tReady cycles: %u (preempted: %u)",
+			    (uint32_t)rt_stats_thread.ready_cycles,
+			    (uint32_t)rt_stats_thread.preempted_cycles);
+		shell_print(sh, "\tPreemptions: %u, IPIs: %u",
+			    rt_stats_thread.num_preemptions,
+			    rt_stats_thread.num_ipis);
+		shell_print(sh, "\tScheduling latency (cycles):");
+		for (unsigned int i = 0;
+		     i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+			if (rt_stats_thread.latency_hist[i] != 0) {
+				shell_print(sh, "\t\t>= 2^%-2u: %u", i,
+					    rt_stats_thread.latency_hist[i]);
+			}
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	} else {
 		shell_print(sh, "\tTotal execution cycles: ? (? %%)");
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -55,6 +71,10 @@ static void rt_stats_dump(const struct shell *sh, struct k_thread *thread)
 		shell_print(sh, "\tPeak execution cycles: ?");
 		shell_print(sh, "\tAverage execution cycles: ?");
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		shell_print(sh, "\tReady cycles: ? (preempted: ?)");
+		shell_print(sh, "\tPreemptions: ?, IPIs: ?");
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	}
 }
 #endif /* CONFIG_THREAD_RUNTIME_STATS */
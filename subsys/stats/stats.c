@@ -100,6 +100,12 @@ stats_walk(struct stats_hdr *hdr, stats_walk_fn *walk_func, void *arg)
 	int rc;
 	int i;
 
+#ifdef CONFIG_STATS_UPDATE_HOOK
+	if (hdr->s_update != NULL) {
+		hdr->s_update(hdr);
+	}
+#endif
+
 	for (i = 0; i < hdr->s_cnt; i++) {
 		name = stats_get_name(hdr, i);
 		if (name == NULL) {
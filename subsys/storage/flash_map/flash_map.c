@@ -18,6 +18,7 @@
 #include "flash_map_priv.h"
 #include <zephyr/drivers/flash.h>
 #include <zephyr/init.h>
+#include <zephyr/cache.h>
 
 void flash_area_foreach(flash_area_cb_t user_cb, void *user_data)
 {
@@ -50,16 +51,32 @@ int flash_area_open(uint8_t id, const struct flash_area **fap)
 
 void flash_area_close(const struct flash_area *fa)
 {
-	/* nothing to do for now */
+	(void)flash_area_flush(fa);
 }
 
+#ifndef CONFIG_FLASH_MAP_WRITE_COMBINE
+int flash_area_flush(const struct flash_area *fa)
+{
+	ARG_UNUSED(fa);
+
+	return 0;
+}
+#endif
+
 int flash_area_read(const struct flash_area *fa, off_t off, void *dst,
 		    size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
+	rc = flash_area_wc_sync(fa->fa_dev, fa->fa_off + off, len);
+	if (rc != 0) {
+		return rc;
+	}
+
 	return flash_read(fa->fa_dev, fa->fa_off + off, dst, len);
 }
 
@@ -70,15 +87,26 @@ int flash_area_write(const struct flash_area *fa, off_t off, const void *src,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FLASH_MAP_WRITE_COMBINE
+	return flash_area_wc_write(fa, off, src, len);
+#else
 	return flash_write(fa->fa_dev, fa->fa_off + off, (void *)src, len);
+#endif
 }
 
 int flash_area_erase(const struct flash_area *fa, off_t off, size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
+	rc = flash_area_wc_sync(fa->fa_dev, fa->fa_off + off, len);
+	if (rc != 0) {
+		return rc;
+	}
+
 	return flash_erase(fa->fa_dev, fa->fa_off + off, len);
 }
 
@@ -86,11 +114,22 @@ int flash_area_copy(const struct flash_area *src_fa, off_t src_off,
 		    const struct flash_area *dst_fa, off_t dst_off,
 		    off_t len, uint8_t *buf, size_t buf_size)
 {
+	int rc;
+
 	if (!(is_in_flash_area_bounds(src_fa, src_off, len) &&
 	      is_in_flash_area_bounds(dst_fa, dst_off, len))) {
 		return -EINVAL;
 	}
 
+	rc = flash_area_wc_sync(src_fa->fa_dev, src_fa->fa_off + src_off, len);
+	if (rc == 0) {
+		rc = flash_area_wc_sync(dst_fa->fa_dev, dst_fa->fa_off + dst_off, len);
+	}
+
+	if (rc != 0) {
+		return rc;
+	}
+
 	return flash_copy(src_fa->fa_dev, src_fa->fa_off + src_off,
 			  dst_fa->fa_dev, dst_fa->fa_off + dst_off, len, buf,
 			  buf_size);
@@ -98,13 +137,54 @@ int flash_area_copy(const struct flash_area *src_fa, off_t src_off,
 
 int flash_area_flatten(const struct flash_area *fa, off_t off, size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
+	rc = flash_area_wc_sync(fa->fa_dev, fa->fa_off + off, len);
+	if (rc != 0) {
+		return rc;
+	}
+
 	return flash_flatten(fa->fa_dev, fa->fa_off + off, len);
 }
 
+int flash_area_mmap(const struct flash_area *fa, off_t off, size_t len, const void **ptr)
+{
+#if CONFIG_FLASH_MAP_MMAP
+	int rc;
+
+	if (!is_in_flash_area_bounds(fa, off, len)) {
+		return -EINVAL;
+	}
+
+	if (fa->fa_mmap == NULL) {
+		return -ENOTSUP;
+	}
+
+	rc = flash_area_wc_sync(fa->fa_dev, fa->fa_off + off, len);
+	if (rc != 0) {
+		return rc;
+	}
+
+	*ptr = (const uint8_t *)fa->fa_mmap + off;
+
+	/* Lines may hold data from before the last write or erase */
+	(void)sys_cache_data_invd_range((void *)*ptr, len);
+
+	return 0;
+#else
+	ARG_UNUSED(fa);
+	ARG_UNUSED(off);
+	ARG_UNUSED(len);
+	ARG_UNUSED(ptr);
+
+	return -ENOTSUP;
+#endif
+}
+
 uint32_t flash_area_align(const struct flash_area *fa)
 {
 	return flash_get_write_block_size(fa->fa_dev);
@@ -10,11 +10,22 @@
 #include <zephyr/kernel.h>
 #include <zephyr/storage/flash_map.h>
 
+/* Internal flash is mapped at the address of its node */
+#if CONFIG_FLASH_MAP_MMAP
+#define FLASH_AREA_MMAP(part, mtd)						\
+	.fa_mmap = COND_CODE_1(DT_NODE_HAS_COMPAT(mtd, soc_nv_flash),		\
+		((const void *)(DT_REG_ADDR(mtd) +				\
+				FIXED_PARTITION_NODE_OFFSET(part))), (NULL)),
+#else
+#define FLASH_AREA_MMAP(part, mtd)
+#endif
+
 #if CONFIG_FLASH_MAP_LABELS
 #define FLASH_AREA_FOO(part, mtd_from_partition)				\
 	{.fa_id = DT_FIXED_PARTITION_ID(part),					\
 	 .fa_off = FIXED_PARTITION_NODE_OFFSET(part),				\
 	 .fa_dev = DEVICE_DT_GET(mtd_from_partition(part)),		        \
+	 FLASH_AREA_MMAP(part, mtd_from_partition(part))			\
 	 .fa_size = DT_REG_SIZE(part),						\
 	 .fa_label = DT_PROP_OR(part, label, NULL),	},
 #else
@@ -22,6 +33,7 @@
 	{.fa_id = DT_FIXED_PARTITION_ID(part),					\
 	 .fa_off = FIXED_PARTITION_NODE_OFFSET(part),				\
 	 .fa_dev = DEVICE_DT_GET(mtd_from_partition(part)),		        \
+	 FLASH_AREA_MMAP(part, mtd_from_partition(part))			\
 	 .fa_size = DT_REG_SIZE(part), },
 #endif
 
@@ -58,6 +70,7 @@ const struct flash_area *flash_map = default_flash_map;
 		.fa_id = DT_FIXED_PARTITION_ID(part),						\
 		.fa_off = FIXED_PARTITION_NODE_OFFSET(part),					\
 		.fa_dev = DEVICE_DT_GET(DT_MTD_FROM_FIXED_PARTITION(part)),			\
+		FLASH_AREA_MMAP(part, DT_MTD_FROM_FIXED_PARTITION(part))			\
 		.fa_size = DT_REG_SIZE(part),							\
 	};
 
@@ -73,6 +86,7 @@ DT_FOREACH_STATUS_OKAY(fixed_partitions, FOR_EACH_PARTITION_TABLE)
 		.fa_id = DT_FIXED_PARTITION_ID(part),						\
 		.fa_off = FIXED_PARTITION_NODE_OFFSET(part),					\
 		.fa_dev = DEVICE_DT_GET(DT_MTD_FROM_FIXED_SUBPARTITION(part)),			\
+		FLASH_AREA_MMAP(part, DT_MTD_FROM_FIXED_SUBPARTITION(part))			\
 		.fa_size = DT_REG_SIZE(part),							\
 	};
 
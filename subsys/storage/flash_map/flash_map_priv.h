@@ -36,4 +36,23 @@ static inline bool is_in_flash_area_bounds(const struct flash_area *fa,
 	return (off >= 0) && (off < fa->fa_size) && (len <= (fa->fa_size - off));
 }
 
+#ifdef CONFIG_FLASH_MAP_WRITE_COMBINE
+/* Buffer a write to the flash area, programmed once a program window is
+ * complete, on flash_area_flush() or after a timeout.
+ */
+int flash_area_wc_write(const struct flash_area *fa, off_t off, const void *src, size_t len);
+
+/* Program buffered writes overlapping the given device range. */
+int flash_area_wc_sync(const struct device *dev, off_t off, size_t len);
+#else
+static inline int flash_area_wc_sync(const struct device *dev, off_t off, size_t len)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(off);
+	ARG_UNUSED(len);
+
+	return 0;
+}
+#endif
+
 #endif /* ZEPHYR_SUBSYS_STORAGE_FLASH_MAP_PRIV_H_ */
@@ -0,0 +1,217 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include "flash_map_priv.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(flash_map_wc, CONFIG_FLASH_LOG_LEVEL);
+
+#define WC_SIZE CONFIG_FLASH_MAP_WRITE_COMBINE_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(WC_SIZE), "Write combine size must be a power of two");
+
+/* Data written to [start, end) of a WC_SIZE aligned window of a device, not
+ * yet programmed, held from the beginning of buf. Offsets are absolute within
+ * the device.
+ */
+struct wc_slot {
+	const struct flash_area *fa;
+	off_t start;
+	off_t end;
+	int rc;
+#if CONFIG_FLASH_MAP_WRITE_COMBINE_TIMEOUT_MS > 0
+	struct k_work_delayable work;
+#endif
+	uint8_t buf[WC_SIZE] __aligned(sizeof(void *));
+};
+
+static struct wc_slot wc_slots[CONFIG_FLASH_MAP_WRITE_COMBINE_SLOTS];
+static unsigned int wc_victim;
+static K_MUTEX_DEFINE(wc_lock);
+
+/* Called with wc_lock held. Errors are also kept for flash_area_flush(). */
+static int wc_slot_flush(struct wc_slot *slot)
+{
+	int rc = 0;
+
+	if (slot->end > slot->start) {
+		rc = flash_write(slot->fa->fa_dev, slot->start, slot->buf, slot->end - slot->start);
+		if (rc != 0) {
+			LOG_ERR("Failed to write %ld bytes at 0x%lx (%d)",
+				(long)(slot->end - slot->start), (long)slot->start, rc);
+			slot->rc = rc;
+		}
+	}
+
+	slot->start = 0;
+	slot->end = 0;
+
+	return rc;
+}
+
+static bool wc_slot_overlaps(const struct wc_slot *slot, const struct device *dev, off_t off,
+			     size_t len)
+{
+	return (slot->end > slot->start) && (slot->fa->fa_dev == dev) &&
+	       (off < slot->end) && (slot->start < (off + (off_t)len));
+}
+
+#if CONFIG_FLASH_MAP_WRITE_COMBINE_TIMEOUT_MS > 0
+static void wc_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct wc_slot *slot = CONTAINER_OF(dwork, struct wc_slot, work);
+
+	k_mutex_lock(&wc_lock, K_FOREVER);
+	(void)wc_slot_flush(slot);
+	k_mutex_unlock(&wc_lock);
+}
+#endif
+
+static struct wc_slot *wc_slot_get(const struct flash_area *fa)
+{
+	struct wc_slot *slot;
+
+	for (size_t i = 0; i < ARRAY_SIZE(wc_slots); i++) {
+		if (wc_slots[i].fa == fa) {
+			return &wc_slots[i];
+		}
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(wc_slots); i++) {
+		if (wc_slots[i].fa == NULL) {
+			slot = &wc_slots[i];
+#if CONFIG_FLASH_MAP_WRITE_COMBINE_TIMEOUT_MS > 0
+			k_work_init_delayable(&slot->work, wc_work_handler);
+#endif
+			goto assign;
+		}
+	}
+
+	slot = &wc_slots[wc_victim];
+	wc_victim = (wc_victim + 1U) % ARRAY_SIZE(wc_slots);
+	(void)wc_slot_flush(slot);
+#if CONFIG_FLASH_MAP_WRITE_COMBINE_TIMEOUT_MS > 0
+	(void)k_work_cancel_delayable(&slot->work);
+#endif
+
+assign:
+	slot->fa = fa;
+	slot->rc = 0;
+
+	return slot;
+}
+
+int flash_area_wc_write(const struct flash_area *fa, off_t off, const void *src, size_t len)
+{
+	const uint8_t *data = src;
+	struct wc_slot *slot;
+	off_t window_end;
+	size_t chunk;
+	int rc = 0;
+
+	off += fa->fa_off;
+
+	k_mutex_lock(&wc_lock, K_FOREVER);
+
+	/* Areas may share a device, keep programming in order */
+	for (size_t i = 0; i < ARRAY_SIZE(wc_slots); i++) {
+		if ((wc_slots[i].fa != fa) && wc_slot_overlaps(&wc_slots[i], fa->fa_dev, off, len)) {
+			(void)wc_slot_flush(&wc_slots[i]);
+		}
+	}
+
+	slot = wc_slot_get(fa);
+
+	while ((len > 0) && (rc == 0)) {
+		window_end = ROUND_DOWN(off, WC_SIZE) + WC_SIZE;
+		chunk = MIN(len, (size_t)(window_end - off));
+
+		if ((slot->end > slot->start) && (off != slot->end)) {
+			rc = wc_slot_flush(slot);
+			if (rc != 0) {
+				break;
+			}
+		}
+
+		if ((slot->end == slot->start) && (chunk == WC_SIZE)) {
+			/* Whole window, nothing to combine with */
+			rc = flash_write(fa->fa_dev, off, data, chunk);
+		} else {
+			if (slot->end == slot->start) {
+				slot->start = off;
+				slot->end = off;
+			}
+
+			memcpy(&slot->buf[slot->end - slot->start], data, chunk);
+			slot->end += chunk;
+
+			if (slot->end == window_end) {
+				rc = wc_slot_flush(slot);
+			}
+		}
+
+		off += chunk;
+		data += chunk;
+		len -= chunk;
+	}
+
+#if CONFIG_FLASH_MAP_WRITE_COMBINE_TIMEOUT_MS > 0
+	if (slot->end > slot->start) {
+		(void)k_work_reschedule(&slot->work, K_MSEC(CONFIG_FLASH_MAP_WRITE_COMBINE_TIMEOUT_MS));
+	}
+#endif
+
+	k_mutex_unlock(&wc_lock);
+
+	return rc;
+}
+
+int flash_area_wc_sync(const struct device *dev, off_t off, size_t len)
+{
+	int rc = 0;
+
+	k_mutex_lock(&wc_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(wc_slots); i++) {
+		if (wc_slot_overlaps(&wc_slots[i], dev, off, len)) {
+			rc = wc_slot_flush(&wc_slots[i]);
+			if (rc != 0) {
+				break;
+			}
+		}
+	}
+
+	k_mutex_unlock(&wc_lock);
+
+	return rc;
+}
+
+int flash_area_flush(const struct flash_area *fa)
+{
+	int rc = 0;
+
+	k_mutex_lock(&wc_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(wc_slots); i++) {
+		if (wc_slots[i].fa == fa) {
+			(void)wc_slot_flush(&wc_slots[i]);
+			rc = wc_slots[i].rc;
+			wc_slots[i].rc = 0;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&wc_lock);
+
+	return rc;
+}
@@ -13,6 +13,8 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 #include <zephyr/types.h>
 #include <string.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 
 #include <zephyr/storage/stream_flash.h>
 
@@ -184,7 +186,10 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+/* Erase if needed, pad and program len bytes of buf at the write position,
+ * then hand them to the callback.
+ */
+static int flash_program(struct stream_flash_ctx *ctx, uint8_t *buf, size_t len)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
@@ -192,33 +197,28 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
-		rc = stream_flash_erase_to_append(ctx, ctx->buf_bytes);
+		rc = stream_flash_erase_to_append(ctx, len);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_forward_erase %d range=0x%08zx",
-				rc, ctx->buf_bytes);
+				rc, len);
 			return rc;
 		}
 	}
 
 	fill_length = ctx->write_block_size;
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (len % fill_length) {
+		fill_length -= len % fill_length;
 		filler = ctx->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + len, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = len + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -232,18 +232,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < len; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, len);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, len, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
@@ -252,11 +251,138 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 
 #endif
 
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+static K_THREAD_STACK_DEFINE(stream_flash_stack, CONFIG_STREAM_FLASH_ASYNC_STACK_SIZE);
+static struct k_work_q stream_flash_work_q;
+
+/* Runs while the caller fills ctx->buf, bytes_written only accounts for
+ * pending_bytes once the caller collected the result.
+ */
+static void stream_flash_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx, work);
+
+	ctx->pending_rc = flash_program(ctx, ctx->buf_alt, ctx->pending_bytes);
+
+	/* Erase ahead for the half being filled, a half never spans more than
+	 * the page following the erased range.
+	 */
+	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE) && (ctx->pending_rc == 0) &&
+	    (ctx->bytes_written + ctx->pending_bytes + ctx->buf_len <= ctx->available)) {
+		(void)stream_flash_erase_to_append(ctx, ctx->pending_bytes + ctx->buf_len);
+	}
+
+	k_sem_give(&ctx->idle);
+}
+
+/* Take ownership of buf_alt, waiting for it to be programmed. Must be
+ * followed by k_sem_give(&ctx->idle) unless buf_alt is submitted again.
+ */
+static int stream_flash_collect(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	(void)k_sem_take(&ctx->idle, K_FOREVER);
+
+	rc = ctx->pending_rc;
+	if (rc == 0) {
+		ctx->bytes_written += ctx->pending_bytes;
+	}
+
+	ctx->pending_bytes = 0U;
+	ctx->pending_rc = 0;
+
+	return rc;
+}
+
+static int stream_flash_wait(struct stream_flash_ctx *ctx)
+{
+	int rc = stream_flash_collect(ctx);
+
+	k_sem_give(&ctx->idle);
+
+	return rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	uint8_t *buf = ctx->buf;
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = stream_flash_collect(ctx);
+	if (rc != 0) {
+		k_sem_give(&ctx->idle);
+		return rc;
+	}
+
+	ctx->buf = ctx->buf_alt;
+	ctx->buf_alt = buf;
+	ctx->pending_bytes = ctx->buf_bytes;
+	ctx->buf_bytes = 0U;
+
+	(void)k_work_submit_to_queue(&stream_flash_work_q, &ctx->work);
+
+	return 0;
+}
+
+static int stream_flash_work_q_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "stream_flash"};
+
+	k_work_queue_start(&stream_flash_work_q, stream_flash_stack,
+			   K_THREAD_STACK_SIZEOF(stream_flash_stack),
+			   K_PRIO_PREEMPT(CONFIG_STREAM_FLASH_ASYNC_PRIORITY), &cfg);
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_work_q_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
+#else
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = flash_program(ctx, ctx->buf, ctx->buf_bytes);
+	if (rc != 0) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
 	return rc;
 }
+#endif /* CONFIG_STREAM_FLASH_ASYNC */
+
+/* Whether data can be programmed from the caller's memory: flash_program()
+ * only writes to its buffer to pad a partial block or to read back for the
+ * callback, and asynchronous programming outlives the caller's data.
+ */
+static inline bool can_program_direct(struct stream_flash_ctx *ctx)
+{
+	if (IS_ENABLED(CONFIG_STREAM_FLASH_ASYNC) || (ctx->buf_bytes != 0U)) {
+		return false;
+	}
+
+#ifdef CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK
+	if (ctx->callback != NULL) {
+		return false;
+	}
+#endif
+
+	return true;
+}
 
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
@@ -269,12 +395,26 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (ctx->bytes_written + stream_flash_bytes_buffered(ctx) + len > ctx->available) {
 		return -ENOMEM;
 	}
 
 	while ((len - processed) >=
 	       (buf_empty_bytes = ctx->buf_len - ctx->buf_bytes)) {
+		if (can_program_direct(ctx)) {
+			/* Nothing is buffered, program a whole buffer worth of
+			 * data in place instead of copying it first.
+			 */
+			rc = flash_program(ctx, (uint8_t *)data + processed, ctx->buf_len);
+			if (rc != 0) {
+				return rc;
+			}
+
+			ctx->bytes_written += ctx->buf_len;
+			processed += ctx->buf_len;
+			continue;
+		}
+
 		memcpy(ctx->buf + ctx->buf_bytes, data + processed,
 		       buf_empty_bytes);
 
@@ -299,6 +439,12 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	if (flush && (rc == 0)) {
+		rc = stream_flash_wait(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -309,7 +455,11 @@ size_t stream_flash_bytes_written(const struct stream_flash_ctx *ctx)
 
 size_t stream_flash_bytes_buffered(const struct stream_flash_ctx *ctx)
 {
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	return ctx->buf_bytes + ctx->pending_bytes;
+#else
 	return ctx->buf_bytes;
+#endif
 }
 
 #ifdef CONFIG_STREAM_FLASH_INSPECT
@@ -377,6 +527,16 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 
 	params = flash_get_parameters(fdev);
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	/* Each half must be aligned */
+	if (buf_len % (2 * params->write_block_size)) {
+		LOG_ERR("Buffer size is not aligned to minimal write-block-size");
+		return -EFAULT;
+	}
+
+	buf_len /= 2;
+#endif
+
 	if (buf_len % params->write_block_size) {
 		LOG_ERR("Buffer size is not aligned to minimal write-block-size");
 		return -EFAULT;
@@ -401,6 +561,14 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->available = size;
 	ctx->write_block_size = params->write_block_size;
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	ctx->buf_alt = buf + buf_len;
+	ctx->pending_bytes = 0U;
+	ctx->pending_rc = 0;
+	k_work_init(&ctx->work, stream_flash_work_handler);
+	k_sem_init(&ctx->idle, 1, 1);
+#endif
+
 #if !defined(CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK)
 	ARG_UNUSED(cb);
 #else
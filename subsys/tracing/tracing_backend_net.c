@@ -0,0 +1,89 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/util.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+
+/* Largest datagram sent when streaming over UDP, small enough to avoid
+ * IP fragmentation on a standard Ethernet link.
+ */
+#define UDP_CHUNK_MAX 1024
+
+static struct net_sockaddr server_addr;
+static bool server_valid;
+static int sock = -1;
+
+static int server_connect(void)
+{
+	int type = IS_ENABLED(CONFIG_TRACING_BACKEND_NET_TCP) ? NET_SOCK_STREAM : NET_SOCK_DGRAM;
+	int proto = IS_ENABLED(CONFIG_TRACING_BACKEND_NET_TCP) ? NET_IPPROTO_TCP : NET_IPPROTO_UDP;
+	net_socklen_t addrlen = (server_addr.sa_family == NET_AF_INET6) ?
+				sizeof(struct net_sockaddr_in6) : sizeof(struct net_sockaddr_in);
+
+	sock = zsock_socket(server_addr.sa_family, type, proto);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	if (zsock_connect(sock, &server_addr, addrlen) < 0) {
+		int err = -errno;
+
+		zsock_close(sock);
+		sock = -1;
+		return err;
+	}
+
+	/* Nothing is ever received from the server. */
+	(void)zsock_shutdown(sock, ZSOCK_SHUT_RD);
+
+	return 0;
+}
+
+static void tracing_backend_net_output(const struct tracing_backend *backend,
+				       uint8_t *data, uint32_t length)
+{
+	size_t chunk_max = IS_ENABLED(CONFIG_TRACING_BACKEND_NET_TCP) ? length : UDP_CHUNK_MAX;
+
+	ARG_UNUSED(backend);
+
+	if (!server_valid || ((sock < 0) && (server_connect() < 0))) {
+		return;
+	}
+
+	while (length > 0) {
+		ssize_t ret = zsock_send(sock, data, MIN(length, chunk_max), 0);
+
+		if (ret < 0) {
+			/* Drop the rest and reconnect on the next output. */
+			zsock_close(sock);
+			sock = -1;
+			return;
+		}
+
+		data += ret;
+		length -= ret;
+	}
+}
+
+static void tracing_backend_net_init(void)
+{
+	const char *server = CONFIG_TRACING_BACKEND_NET_SERVER;
+
+	server_valid = net_ipaddr_parse(server, strlen(server), &server_addr) &&
+		       (net_sin(&server_addr)->sin_port != 0);
+}
+
+const struct tracing_backend_api tracing_backend_net_api = {
+	.init = tracing_backend_net_init,
+	.output = tracing_backend_net_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_net, tracing_backend_net_api);
@@ -4,12 +4,47 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/ring_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+/* With CONFIG_TRACING_BUFFER_PER_CPU each CPU puts packets into its own ring
+ * with only local interrupts masked, the tracing thread is the single
+ * consumer of all rings and drains them one after another.
+ */
+#define TRACING_BUFFER_CNT COND_CODE_1(CONFIG_TRACING_BUFFER_PER_CPU, \
+				       (CONFIG_MP_MAX_NUM_CPUS), (1))
+
+static struct ring_buf tracing_ring_buf[TRACING_BUFFER_CNT];
+static uint8_t tracing_buffer[TRACING_BUFFER_CNT][CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+/* Ring currently drained by the consumer. */
+static uint8_t get_idx;
+
+static inline struct ring_buf *put_ring(void)
+{
+	if (TRACING_BUFFER_CNT == 1) {
+		return &tracing_ring_buf[0];
+	}
+
+	return &tracing_ring_buf[arch_curr_cpu()->id];
+}
+
+static struct ring_buf *get_ring(void)
+{
+	for (int i = 0; i < TRACING_BUFFER_CNT; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[get_idx])) {
+			break;
+		}
+
+		get_idx = (get_idx + 1) % TRACING_BUFFER_CNT;
+	}
+
+	return &tracing_ring_buf[get_idx];
+}
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,51 +54,104 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(put_ring(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	if (TRACING_BUFFER_CNT > 1) {
+		/* Packet must be visible before the consumer on another CPU
+		 * sees the updated ring.
+		 */
+		barrier_dmem_fence_full();
+	}
+
+	return ring_buf_put_finish(put_ring(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	struct ring_buf *rb = put_ring();
+	uint32_t total = 0;
+	uint32_t partial;
+
+	if (TRACING_BUFFER_CNT == 1) {
+		return ring_buf_put(rb, data, size);
+	}
+
+	do {
+		uint8_t *dst;
+
+		partial = ring_buf_put_claim(rb, &dst, size - total);
+		memcpy(dst, &data[total], partial);
+		total += partial;
+	} while ((partial > 0) && (total < size));
+
+	barrier_dmem_fence_full();
+	ring_buf_put_finish(rb, total);
+
+	return total;
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	uint32_t len = ring_buf_get_claim(get_ring(), data, size);
+
+	if (TRACING_BUFFER_CNT > 1) {
+		barrier_dmem_fence_full();
+	}
+
+	return len;
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+	int err;
+
+	if (TRACING_BUFFER_CNT == 1) {
+		return ring_buf_get_finish(&tracing_ring_buf[0], size);
+	}
+
+	/* Data must be consumed before the space is handed back. */
+	barrier_dmem_fence_full();
+	err = ring_buf_get_finish(&tracing_ring_buf[get_idx], size);
+
+	/* Alternate between rings so that a busy CPU cannot starve others. */
+	get_idx = (get_idx + 1) % TRACING_BUFFER_CNT;
+
+	return err;
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	return ring_buf_get(get_ring(), data, size);
 }
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (int i = 0; i < TRACING_BUFFER_CNT; i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	for (int i = 0; i < TRACING_BUFFER_CNT; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[i])) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(put_ring());
 }
@@ -35,15 +35,17 @@ enum {
 	CDC_NCM_IFACE_UP,
 	CDC_NCM_DATA_IFACE_ENABLED,
 	CDC_NCM_CLASS_SUSPENDED,
-	CDC_NCM_OUT_ENGAGED,
 };
 
 /* Chapter 6.2.7 table 6-4 */
 #define CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_MAX_DGRAM_PER_NTB
-#define CDC_NCM_RECV_NTB_MAX_SIZE 2048
+#define CDC_NCM_RECV_NTB_MAX_SIZE CONFIG_USBD_CDC_NCM_OUT_NTB_SIZE
 
-#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB 1
-#define CDC_NCM_SEND_NTB_MAX_SIZE 2048
+#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_IN_MAX_DGRAM_PER_NTB
+#define CDC_NCM_SEND_NTB_MAX_SIZE CONFIG_USBD_CDC_NCM_IN_NTB_SIZE
+
+/* Smallest dwNtbInMaxSize the host may set, chapter 6.2.7 */
+#define CDC_NCM_SEND_NTB_MIN_SIZE 2048U
 
 /* Chapter 6.3 table 6-5 and 6-6 */
 struct cdc_ncm_notification {
@@ -152,6 +154,10 @@ struct ncm_notify_connection_speed_change {
 	uint32_t uplink;
 } __packed;
 
+/*
+ * Sent NTBs have their NDP right after the NTH, with room for the maximum
+ * number of datagrams, which follow as they are aggregated.
+ */
 union send_ntb {
 	struct {
 		struct nth16 nth;
@@ -162,6 +168,14 @@ union send_ntb {
 	uint8_t data[CDC_NCM_SEND_NTB_MAX_SIZE];
 } __packed;
 
+#define CDC_NCM_SEND_DGRAM_OFFSET                                                                  \
+	ROUND_UP(sizeof(struct nth16) + sizeof(struct ndp16) +                                     \
+		 (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) * sizeof(struct ndp16_datagram),         \
+		 CDC_NCM_ALIGNMENT)
+
+BUILD_ASSERT(CDC_NCM_SEND_DGRAM_OFFSET + NET_ETH_MAX_FRAME_SIZE <= CDC_NCM_SEND_NTB_MIN_SIZE,
+	     "Too many datagrams per NTB to fit a frame in the smallest NTB");
+
 union recv_ntb {
 	struct {
 		struct nth16 nth;
@@ -171,12 +185,17 @@ union recv_ntb {
 } __packed;
 
 /*
- * Transfers through two endpoints proceed in a synchronous manner,
- * with maximum block of CDC_NCM_SEND_NTB_MAX_SIZE.
+ * Each instance queues several transfers on both bulk endpoints, and fills
+ * one more NTB while the IN transfers are in flight.
  */
-UDC_BUF_POOL_DEFINE(cdc_ncm_ep_pool,
-		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
-		    MAX(CDC_NCM_SEND_NTB_MAX_SIZE, CDC_NCM_RECV_NTB_MAX_SIZE),
+UDC_BUF_POOL_DEFINE(cdc_ncm_ep_in_pool,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * (CONFIG_USBD_CDC_NCM_IN_REQUESTS + 1),
+		    CDC_NCM_SEND_NTB_MAX_SIZE,
+		    sizeof(struct udc_buf_info), NULL);
+
+UDC_BUF_POOL_DEFINE(cdc_ncm_ep_out_pool,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CONFIG_USBD_CDC_NCM_OUT_REQUESTS,
+		    CDC_NCM_RECV_NTB_MAX_SIZE,
 		    sizeof(struct udc_buf_info), NULL);
 
 /*
@@ -230,7 +249,19 @@ struct cdc_ncm_eth_data {
 	uint16_t tx_seq;
 	uint16_t rx_seq;
 
-	struct k_sem sync_sem;
+	/* Number of transfers queued on the bulk OUT endpoint */
+	atomic_t out_queued;
+
+	/* NTB being filled, and number of datagrams in it */
+	struct net_buf *tx_ntb;
+	uint16_t tx_dgram_count;
+	/* Limits set by the host with SetNtbInputSize */
+	uint32_t ntb_in_max_size;
+	uint16_t ntb_in_max_dgrams;
+	struct k_mutex tx_lock;
+	/* Transfers which can still be queued on the bulk IN endpoint */
+	struct k_sem tx_slots;
+	struct k_work_delayable tx_flush_work;
 
 	struct k_work_delayable notif_work;
 };
@@ -304,7 +335,8 @@ static struct net_buf *cdc_ncm_buf_alloc(const uint8_t ep)
 	struct net_buf *buf = NULL;
 	struct udc_buf_info *bi;
 
-	buf = net_buf_alloc(&cdc_ncm_ep_pool, K_NO_WAIT);
+	buf = net_buf_alloc(USB_EP_DIR_IS_IN(ep) ? &cdc_ncm_ep_in_pool : &cdc_ncm_ep_out_pool,
+			    K_NO_WAIT);
 	if (!buf) {
 		return NULL;
 	}
@@ -315,33 +347,36 @@ static struct net_buf *cdc_ncm_buf_alloc(const uint8_t ep)
 	return buf;
 }
 
+/* Queue transfers on the bulk OUT endpoint up to CONFIG_USBD_CDC_NCM_OUT_REQUESTS */
 static int cdc_ncm_out_start(struct usbd_class_data *const c_data)
 {
 	const struct device *dev = usbd_class_get_private(c_data);
 	struct cdc_ncm_eth_data *data = dev->data;
+	uint8_t ep = cdc_ncm_get_bulk_out(c_data);
 	struct net_buf *buf;
-	uint8_t ep;
 	int ret;
 
-	if (atomic_test_and_set_bit(&data->state, CDC_NCM_OUT_ENGAGED)) {
-		return -EBUSY;
-	}
+	while (atomic_inc(&data->out_queued) < CONFIG_USBD_CDC_NCM_OUT_REQUESTS) {
+		buf = cdc_ncm_buf_alloc(ep);
+		if (buf == NULL) {
+			atomic_dec(&data->out_queued);
+			return -ENOMEM;
+		}
 
-	ep = cdc_ncm_get_bulk_out(c_data);
-	buf = cdc_ncm_buf_alloc(ep);
-	if (buf == NULL) {
-		return -ENOMEM;
-	}
+		ret = usbd_ep_enqueue(c_data, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			net_buf_unref(buf);
+			atomic_dec(&data->out_queued);
+			return ret;
+		}
 
-	ret = usbd_ep_enqueue(c_data, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
-		net_buf_unref(buf);
-	} else {
 		LOG_DBG("enqueue out %u", buf->size);
 	}
 
-	return  ret;
+	atomic_dec(&data->out_queued);
+
+	return 0;
 }
 
 static int verify_nth16(struct cdc_ncm_eth_data *const data,
@@ -512,7 +547,7 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 	const struct ndp16_datagram *ndp_datagram;
 	const struct nth16 *nthdr16;
 	const struct ndp16 *ndp;
-	struct net_pkt *pkt, *src;
+	struct net_pkt *pkt;
 	uint16_t start, len;
 	uint16_t count;
 	int ret;
@@ -531,18 +566,6 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 		goto restart_out_transfer;
 	}
 
-	/* Temporary source pkt we use to copy one Ethernet frame from
-	 * the list of USB net_buf's.
-	 */
-	src = net_pkt_alloc(K_MSEC(NET_PKT_ALLOC_TIMEOUT));
-	if (src == NULL) {
-		LOG_ERR("src packet alloc fail");
-		goto restart_out_transfer;
-	}
-
-	net_pkt_append_buffer(src, buf);
-	net_pkt_set_overwrite(src, true);
-
 	nthdr16 = &ntb->nth;
 	LOG_DBG("NTH16: wSequence %u wBlockLength %u wNdpIndex %u",
 		nthdr16->wSequence, nthdr16->wBlockLength, nthdr16->wNdpIndex);
@@ -571,26 +594,19 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 			break;
 		}
 
-		pkt = net_pkt_rx_alloc_with_buffer(data->iface, len, NET_AF_UNSPEC, 0, K_FOREVER);
+		pkt = net_pkt_rx_alloc_with_buffer(data->iface, len, NET_AF_UNSPEC, 0,
+						   K_MSEC(NET_PKT_ALLOC_TIMEOUT));
 		if (!pkt) {
 			LOG_ERR("No memory for net_pkt");
-			goto unref_packet;
-		}
-
-		net_pkt_cursor_init(src);
-
-		ret = net_pkt_skip(src, start);
-		if (ret < 0) {
-			LOG_ERR("Cannot advance pkt by %u bytes (%d)", start, ret);
-			net_pkt_unref(pkt);
-			goto unref_packet;
+			break;
 		}
 
-		ret = net_pkt_copy(pkt, src, len);
+		/* check_frame() verified that the datagram is within the NTB */
+		ret = net_pkt_write(pkt, ntb->data + start, len);
 		if (ret < 0) {
 			LOG_ERR("Cannot copy data (%d)", ret);
 			net_pkt_unref(pkt);
-			goto unref_packet;
+			break;
 		}
 
 		LOG_DBG("Received packet len %zu", net_pkt_get_len(pkt));
@@ -601,14 +617,10 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 		}
 	}
 
-unref_packet:
-	src->buffer = NULL;
-	net_pkt_unref(src);
-
 restart_out_transfer:
 	net_buf_unref(buf);
 
-	atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
+	atomic_dec(&data->out_queued);
 	if (atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
 		return cdc_ncm_out_start(c_data);
 	}
@@ -638,6 +650,93 @@ static void ncm_handle_notifications(const struct device *dev, const int err)
 	}
 }
 
+/* Queue the NTB being filled, the TX lock must be held */
+static int cdc_ncm_tx_flush(const struct device *dev, const k_timeout_t timeout)
+{
+	struct cdc_ncm_eth_data *const data = dev->data;
+	struct usbd_class_data *c_data = data->c_data;
+	struct net_buf *buf = data->tx_ntb;
+	union send_ntb *ntb;
+	int ret;
+
+	if (buf == NULL) {
+		return 0;
+	}
+
+	if (k_sem_take(&data->tx_slots, timeout) != 0) {
+		/* Sent once an IN transfer completes */
+		return -EAGAIN;
+	}
+
+	ntb = (union send_ntb *)buf->data;
+	ntb->ndp.wLength = sys_cpu_to_le16(sizeof(struct ndp16) +
+					   (data->tx_dgram_count + 1) *
+					   sizeof(struct ndp16_datagram));
+	ntb->ndp_datagram[data->tx_dgram_count].wDatagramIndex = 0;
+	ntb->ndp_datagram[data->tx_dgram_count].wDatagramLength = 0;
+	ntb->nth.wBlockLength = sys_cpu_to_le16(buf->len);
+
+	if (buf->len % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	data->tx_ntb = NULL;
+	LOG_DBG("Send NTB with %u datagram(s), len %u", data->tx_dgram_count, buf->len);
+
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue NTB (%d)", ret);
+		net_buf_unref(buf);
+		k_sem_give(&data->tx_slots);
+	}
+
+	return ret;
+}
+
+static void cdc_ncm_tx_flush_work(struct k_work *work)
+{
+	struct k_work_delayable *flush_work = k_work_delayable_from_work(work);
+	struct cdc_ncm_eth_data *data =
+		CONTAINER_OF(flush_work, struct cdc_ncm_eth_data, tx_flush_work);
+	const struct device *dev = usbd_class_get_private(data->c_data);
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	(void)cdc_ncm_tx_flush(dev, K_NO_WAIT);
+	k_mutex_unlock(&data->tx_lock);
+}
+
+static void cdc_ncm_in_done(const struct device *dev, struct net_buf *const buf)
+{
+	struct cdc_ncm_eth_data *const data = dev->data;
+
+	net_buf_unref(buf);
+	k_sem_give(&data->tx_slots);
+
+	/* Datagrams aggregated meanwhile go out right away */
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	if (atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+		(void)cdc_ncm_tx_flush(dev, K_NO_WAIT);
+	}
+	k_mutex_unlock(&data->tx_lock);
+}
+
+/* Drop the NTB being filled when the data interface goes away */
+static void cdc_ncm_tx_reset(struct cdc_ncm_eth_data *const data)
+{
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	if (data->tx_ntb != NULL) {
+		net_buf_unref(data->tx_ntb);
+		data->tx_ntb = NULL;
+	}
+
+	data->ntb_in_max_size = CDC_NCM_SEND_NTB_MAX_SIZE;
+	data->ntb_in_max_dgrams = CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB;
+	data->tx_seq = 0;
+
+	k_mutex_unlock(&data->tx_lock);
+}
+
 static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
 				struct net_buf *buf, int err)
 {
@@ -654,7 +753,7 @@ static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
 	}
 
 	if (bi->ep == cdc_ncm_get_bulk_in(c_data)) {
-		k_sem_give(&data->sync_sem);
+		cdc_ncm_in_done(dev, buf);
 		return 0;
 	}
 
@@ -840,7 +939,7 @@ static void usbd_cdc_ncm_update(struct usbd_class_data *const c_data,
 
 	if (data_iface == iface && alternate == 0) {
 		atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
-		data->tx_seq = 0;
+		cdc_ncm_tx_reset(data);
 		data->rx_seq = 0;
 	}
 
@@ -867,6 +966,7 @@ static void usbd_cdc_ncm_disable(struct usbd_class_data *const c_data)
 
 	atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
 	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+	cdc_ncm_tx_reset(data);
 
 	LOG_INF("Disabled %s", c_data->name);
 }
@@ -887,10 +987,38 @@ static void usbd_cdc_ncm_resumed(struct usbd_class_data *const c_data)
 	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
 }
 
+static void cdc_ncm_set_ntb_input_size(struct cdc_ncm_eth_data *const data,
+				       const struct net_buf *const buf)
+{
+	uint32_t size;
+	uint16_t dgrams = 0;
+
+	if (buf->len < sizeof(uint32_t)) {
+		errno = -EINVAL;
+		return;
+	}
+
+	size = sys_get_le32(buf->data);
+	if (buf->len >= sizeof(struct ntb_input_size)) {
+		dgrams = sys_get_le16(buf->data + sizeof(uint32_t));
+	}
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	data->ntb_in_max_size = CLAMP(size, CDC_NCM_SEND_NTB_MIN_SIZE, CDC_NCM_SEND_NTB_MAX_SIZE);
+	data->ntb_in_max_dgrams = (dgrams == 0U) ? CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB :
+				  MIN(dgrams, CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB);
+	k_mutex_unlock(&data->tx_lock);
+
+	LOG_DBG("NTB input size %u, %u datagrams", data->ntb_in_max_size,
+		data->ntb_in_max_dgrams);
+}
+
 static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
 			    const struct usb_setup_packet *const setup,
 			    const struct net_buf *const buf)
 {
+	const struct device *dev = usbd_class_get_private(c_data);
+
 	if (setup->RequestType.recipient == USB_REQTYPE_RECIPIENT_INTERFACE) {
 		if (setup->bRequest == SET_ETHERNET_PACKET_FILTER) {
 			LOG_DBG("bRequest 0x%02x (%s) not implemented",
@@ -899,8 +1027,7 @@ static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
 		}
 
 		if (setup->bRequest == SET_NTB_INPUT_SIZE) {
-			LOG_DBG("bRequest 0x%02x (%s) not implemented",
-				setup->bRequest, "SetNtbInputSize");
+			cdc_ncm_set_ntb_input_size(dev->data, buf);
 			return 0;
 		}
 
@@ -953,9 +1080,11 @@ static int usbd_cdc_ncm_cth(struct usbd_class_data *const c_data,
 	}
 
 	case GET_NTB_INPUT_SIZE: {
+		const struct device *dev = usbd_class_get_private(c_data);
+		struct cdc_ncm_eth_data *data = dev->data;
 		struct ntb_input_size input_size = {
-			.dwNtbInMaxSize = sys_cpu_to_le32(CDC_NCM_SEND_NTB_MAX_SIZE),
-			.wNtbInMaxDatagrams = sys_cpu_to_le16(CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB),
+			.dwNtbInMaxSize = sys_cpu_to_le32(data->ntb_in_max_size),
+			.wNtbInMaxDatagrams = sys_cpu_to_le16(data->ntb_in_max_dgrams),
 			.wReserved = sys_cpu_to_le16(0),
 		};
 
@@ -1023,13 +1152,43 @@ static void *usbd_cdc_ncm_get_desc(struct usbd_class_data *const c_data,
 	return data->fs_desc;
 }
 
+static struct net_buf *cdc_ncm_tx_ntb_alloc(struct cdc_ncm_eth_data *const data)
+{
+	struct net_buf *buf;
+	union send_ntb *ntb;
+
+	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(data->c_data));
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	ntb = (union send_ntb *)buf->data;
+
+	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
+	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
+	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
+	ntb->ndp.wNextNdpIndex = 0;
+
+	net_buf_add(buf, CDC_NCM_SEND_DGRAM_OFFSET);
+	data->tx_dgram_count = 0;
+
+	return buf;
+}
+
+/*
+ * Datagrams are aggregated in the NTB being filled. It is sent right away
+ * when no IN transfer is in flight, and otherwise once it is full, an IN
+ * transfer completes, or the flush timeout expires.
+ */
 static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 {
 	struct cdc_ncm_eth_data *const data = dev->data;
-	struct usbd_class_data *c_data = data->c_data;
 	size_t len = net_pkt_get_len(pkt);
-	struct net_buf *buf;
 	union send_ntb *ntb;
+	uint16_t offset;
+	int ret = 0;
 
 	if (len > NET_ETH_MAX_FRAME_SIZE) {
 		LOG_WRN("Trying to send too large packet, drop");
@@ -1044,53 +1203,55 @@ static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 		return -EACCES;
 	}
 
-	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(c_data));
-	if (buf == NULL) {
-		LOG_ERR("Failed to allocate buffer");
-		return -ENOMEM;
-	}
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
 
-	ntb = (union send_ntb *)buf->data;
+	if (data->tx_ntb != NULL) {
+		offset = ROUND_UP(data->tx_ntb->len, CDC_NCM_ALIGNMENT);
 
-	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
-	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
-	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
-	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
-	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
-	ntb->ndp.wLength = sys_cpu_to_le16(sizeof(struct ndp16) +
-					   (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) *
-					   sizeof(struct ndp16_datagram));
-	ntb->ndp.wNextNdpIndex = 0;
-	ntb->ndp_datagram[0].wDatagramIndex =
-		sys_cpu_to_le16(sys_le16_to_cpu(ntb->nth.wHeaderLength) +
-				sys_le16_to_cpu(ntb->ndp.wLength));
-	ntb->ndp_datagram[0].wDatagramLength = sys_cpu_to_le16(len);
-	ntb->ndp_datagram[1].wDatagramIndex  = 0;
-	ntb->ndp_datagram[1].wDatagramLength = 0;
-	ntb->nth.wBlockLength = sys_cpu_to_le16(
-		sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex) + len);
-
-	net_buf_add(buf, sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex));
-
-	if (net_pkt_read(pkt, buf->data + buf->len, len)) {
-		LOG_ERR("Failed copy net_pkt");
-		net_buf_unref(buf);
+		if ((offset + len > data->ntb_in_max_size) ||
+		    (data->tx_dgram_count == data->ntb_in_max_dgrams)) {
+			/* Waits for an IN transfer to complete */
+			ret = cdc_ncm_tx_flush(dev, K_FOREVER);
+			if (ret) {
+				goto out;
+			}
+		}
+	}
 
-		return -ENOBUFS;
+	if (data->tx_ntb == NULL) {
+		data->tx_ntb = cdc_ncm_tx_ntb_alloc(data);
+		if (data->tx_ntb == NULL) {
+			LOG_ERR("Failed to allocate buffer");
+			ret = -ENOMEM;
+			goto out;
+		}
 	}
 
-	net_buf_add(buf, len);
+	ntb = (union send_ntb *)data->tx_ntb->data;
+	offset = ROUND_UP(data->tx_ntb->len, CDC_NCM_ALIGNMENT);
 
-	if (sys_le16_to_cpu(ntb->nth.wBlockLength) % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
-		udc_ep_buf_set_zlp(buf);
+	if (net_pkt_read(pkt, data->tx_ntb->data + offset, len)) {
+		LOG_ERR("Failed copy net_pkt");
+		ret = -ENOBUFS;
+		goto out;
 	}
 
-	usbd_ep_enqueue(c_data, buf);
-	k_sem_take(&data->sync_sem, K_FOREVER);
+	net_buf_add(data->tx_ntb, offset + len - data->tx_ntb->len);
+	ntb->ndp_datagram[data->tx_dgram_count].wDatagramIndex = sys_cpu_to_le16(offset);
+	ntb->ndp_datagram[data->tx_dgram_count].wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_dgram_count++;
 
-	net_buf_unref(buf);
+	if (k_sem_count_get(&data->tx_slots) == CONFIG_USBD_CDC_NCM_IN_REQUESTS) {
+		(void)cdc_ncm_tx_flush(dev, K_NO_WAIT);
+	} else {
+		(void)k_work_schedule(&data->tx_flush_work,
+				      K_USEC(CONFIG_USBD_CDC_NCM_IN_FLUSH_TIMEOUT_US));
+	}
 
-	return 0;
+out:
+	k_mutex_unlock(&data->tx_lock);
+
+	return ret;
 }
 
 static int cdc_ncm_set_config(const struct device *dev,
@@ -1171,6 +1332,10 @@ static int usbd_cdc_ncm_preinit(const struct device *dev)
 	struct cdc_ncm_eth_data *data = dev->data;
 
 	k_work_init_delayable(&data->notif_work, send_notification_work);
+	k_work_init_delayable(&data->tx_flush_work, cdc_ncm_tx_flush_work);
+	k_mutex_init(&data->tx_lock);
+	data->ntb_in_max_size = CDC_NCM_SEND_NTB_MAX_SIZE;
+	data->ntb_in_max_dgrams = CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB;
 
 	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
 		gen_random_mac(data->mac_addr, 0, 0, 0);
@@ -1390,7 +1555,9 @@ const static struct usb_desc_header *cdc_ncm_hs_desc_##n[] = {			\
 	static struct cdc_ncm_eth_data eth_data_##n = {				\
 		.c_data = &cdc_ncm_##n,						\
 		.mac_addr = DT_INST_PROP_OR(n, local_mac_address, {0}),		\
-		.sync_sem = Z_SEM_INITIALIZER(eth_data_##n.sync_sem, 0, 1),	\
+		.tx_slots = Z_SEM_INITIALIZER(eth_data_##n.tx_slots,		\
+					      CONFIG_USBD_CDC_NCM_IN_REQUESTS,	\
+					      CONFIG_USBD_CDC_NCM_IN_REQUESTS),	\
 		.mac_desc_data = &mac_desc_data_##n,				\
 		.desc = &cdc_ncm_desc_##n,					\
 		.fs_desc = cdc_ncm_fs_desc_##n,					\
@@ -60,7 +60,19 @@ struct CSW {
 /* Single instance is likely enough because it can support multiple LUNs */
 #define MSC_NUM_INSTANCES CONFIG_USBD_MSC_INSTANCES_COUNT
 
-#define MSC_NUM_BUFFERS UTIL_INC(IS_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING))
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+#define MSC_NUM_BUFFERS CONFIG_USBD_MSC_SCSI_BUFFERS_COUNT
+#else
+#define MSC_NUM_BUFFERS 1
+#endif
+
+/* SCSI buffers are consecutive in memory, so that data spanning several full
+ * buffers can be read from or written to the disk in a single access.
+ */
+#define MSC_SCSI_BUF_STRIDE ROUND_UP(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE, UDC_BUF_GRANULARITY)
+
+/* Buffers accessed at once by the disk while the others are used by USB */
+#define MSC_BATCH_BUFFERS MAX(MSC_NUM_BUFFERS / 2, 1)
 
 #if USBD_MAX_BULK_MPS > CONFIG_USBD_MSC_SCSI_BUFFER_SIZE
 #error "SCSI buffer must be at least USB bulk endpoint wMaxPacketSize"
@@ -78,8 +90,11 @@ struct msc_event {
 	int err;
 };
 
-/* Each instance has 2 endpoints and can receive bulk only reset command */
-K_MSGQ_DEFINE(msc_msgq, sizeof(struct msc_event), MSC_NUM_INSTANCES * 3, 4);
+/* Each instance can have a transfer queued per SCSI buffer and can receive
+ * bulk only reset command
+ */
+K_MSGQ_DEFINE(msc_msgq, sizeof(struct msc_event),
+	      MSC_NUM_INSTANCES * (MSC_NUM_BUFFERS + 1), 4);
 
 /* Make supported vendor request visible for the device stack */
 static const struct usbd_cctx_vendor_req msc_bot_vregs =
@@ -115,10 +130,10 @@ struct msc_bot_ctx {
 	struct msc_bot_desc *const desc;
 	const struct usb_desc_header **const fs_desc;
 	const struct usb_desc_header **const hs_desc;
-	uint8_t *scsi_bufs[MSC_NUM_BUFFERS];
+	uint8_t *const scsi_bufs;
 	atomic_t bits;
 	enum msc_bot_state state;
-	uint8_t scsi_bufs_used;
+	uint16_t scsi_bufs_used;
 	uint8_t num_in_queued;
 	uint8_t num_out_queued;
 	uint8_t registered_luns;
@@ -127,6 +142,16 @@ struct msc_bot_ctx {
 	struct CSW csw;
 	uint32_t transferred_data;
 	size_t scsi_bytes;
+	/* Length of the OUT transfers queued */
+	size_t out_queued_len;
+	/* OUT data received but not written to the disk yet */
+	uint8_t *wb_data;
+	size_t wb_len;
+	/* Sectors read ahead after the last READ(10) */
+	struct scsi_ctx *ra_lun;
+	uint8_t *ra_data;
+	size_t ra_len;
+	uint32_t ra_lba;
 };
 
 static struct net_buf *msc_buf_alloc_data(const uint8_t ep, uint8_t *data, size_t len)
@@ -150,12 +175,22 @@ static struct net_buf *msc_buf_alloc_data(const uint8_t ep, uint8_t *data, size_
 	return buf;
 }
 
+static uint8_t *msc_scsi_buf(struct msc_bot_ctx *ctx, int i)
+{
+	return &ctx->scsi_bufs[i * MSC_SCSI_BUF_STRIDE];
+}
+
+static bool msc_has_free_scsi_buf(struct msc_bot_ctx *ctx)
+{
+	return ctx->scsi_bufs_used != BIT_MASK(MSC_NUM_BUFFERS);
+}
+
 static uint8_t *msc_alloc_scsi_buf(struct msc_bot_ctx *ctx)
 {
 	for (int i = 0; i < MSC_NUM_BUFFERS; i++) {
 		if (!(ctx->scsi_bufs_used & BIT(i))) {
 			ctx->scsi_bufs_used |= BIT(i);
-			return ctx->scsi_bufs[i];
+			return msc_scsi_buf(ctx, i);
 		}
 	}
 
@@ -164,16 +199,55 @@ static uint8_t *msc_alloc_scsi_buf(struct msc_bot_ctx *ctx)
 	return NULL;
 }
 
+/* Allocate the longest run of up to max consecutive free SCSI buffers,
+ * starting at or after buffer first.
+ */
+static uint8_t *msc_alloc_scsi_bufs(struct msc_bot_ctx *ctx, int first,
+				    int max, int *count)
+{
+	int start = 0;
+	int run = 0;
+
+	for (int i = first; i < MSC_NUM_BUFFERS; i++) {
+		int n = 0;
+
+		while ((i + n < MSC_NUM_BUFFERS) && (n < max) &&
+		       !(ctx->scsi_bufs_used & BIT(i + n))) {
+			n++;
+		}
+
+		if (n > run) {
+			start = i;
+			run = n;
+		}
+	}
+
+	*count = run;
+	if (run == 0) {
+		return NULL;
+	}
+
+	ctx->scsi_bufs_used |= BIT_MASK(run) << start;
+	return msc_scsi_buf(ctx, start);
+}
+
 void msc_free_scsi_buf(struct msc_bot_ctx *ctx, uint8_t *buf)
 {
 	for (int i = 0; i < MSC_NUM_BUFFERS; i++) {
-		if (buf == ctx->scsi_bufs[i]) {
+		if (buf == msc_scsi_buf(ctx, i)) {
 			ctx->scsi_bufs_used &= ~BIT(i);
 			return;
 		}
 	}
 }
 
+static void msc_free_scsi_bufs(struct msc_bot_ctx *ctx, uint8_t *buf, int count)
+{
+	for (int i = 0; i < count; i++) {
+		msc_free_scsi_buf(ctx, buf + i * MSC_SCSI_BUF_STRIDE);
+	}
+}
+
 static size_t clamp_transfer_length(struct usbd_context *uds_ctx,
 				    struct scsi_ctx *lun,
 				    size_t len)
@@ -213,21 +287,14 @@ static size_t msc_next_out_transfer_length(struct usbd_class_data *const c_data)
 	struct msc_bot_ctx *ctx = usbd_class_get_private(c_data);
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
 	size_t remaining = scsi_cmd_remaining_data_len(lun);
-	size_t len = clamp_transfer_length(uds_ctx, lun, remaining);
-
-	/* This function can only estimate one more transfer after the current
-	 * one. Queueing more buffers is not supported.
-	 */
-	__ASSERT_NO_MSG(ctx->num_out_queued < 2);
-
-	if (ctx->num_out_queued == 0) {
-		return len;
-	}
 
 	/* MSC BOT specification requires host to send all the data it intends
-	 * to send. Therefore it should be safe to use "remaining - len" here.
+	 * to send. Therefore it should be safe to skip the data of the queued
+	 * transfers and the data waiting to be written here.
 	 */
-	return clamp_transfer_length(uds_ctx, lun, remaining - len);
+	remaining -= MIN(remaining, ctx->out_queued_len + ctx->wb_len);
+
+	return clamp_transfer_length(uds_ctx, lun, remaining);
 }
 
 static uint8_t msc_get_bulk_in(struct usbd_class_data *const c_data)
@@ -294,7 +361,7 @@ static void msc_queue_write(struct msc_bot_ctx *ctx)
 	ep = msc_get_bulk_out(ctx->class_node);
 
 	/* Ensure there are as many OUT transfers queued as possible */
-	while ((ctx->num_out_queued < MSC_NUM_BUFFERS) &&
+	while (msc_has_free_scsi_buf(ctx) &&
 	       (len = msc_next_out_transfer_length(ctx->class_node))) {
 		scsi_buf = msc_alloc_scsi_buf(ctx);
 		buf = msc_buf_alloc_data(ep, scsi_buf, len);
@@ -315,6 +382,25 @@ static void msc_queue_write(struct msc_bot_ctx *ctx)
 		}
 
 		ctx->num_out_queued++;
+		ctx->out_queued_len += len;
+	}
+}
+
+static void msc_drop_read_ahead(struct msc_bot_ctx *ctx)
+{
+	if (ctx->ra_len) {
+		msc_free_scsi_bufs(ctx, ctx->ra_data,
+				   DIV_ROUND_UP(ctx->ra_len, MSC_SCSI_BUF_STRIDE));
+		ctx->ra_len = 0;
+	}
+}
+
+static void msc_drop_write_back(struct msc_bot_ctx *ctx)
+{
+	if (ctx->wb_len) {
+		msc_free_scsi_bufs(ctx, ctx->wb_data,
+				   DIV_ROUND_UP(ctx->wb_len, MSC_SCSI_BUF_STRIDE));
+		ctx->wb_len = 0;
 	}
 }
 
@@ -331,6 +417,9 @@ static void msc_queue_cbw(struct usbd_class_data *const c_data)
 		return;
 	}
 
+	/* Previous CBW transfer failed, data read ahead is not worth keeping */
+	msc_drop_read_ahead(ctx);
+
 	__ASSERT(ctx->scsi_bufs_used == 0,
 		 "CBW can only be queued when SCSI buffers are free");
 
@@ -367,6 +456,10 @@ static void msc_reset_handler(struct usbd_class_data *c_data)
 		scsi_reset(&ctx->luns[i]);
 	}
 
+	msc_drop_read_ahead(ctx);
+	msc_drop_write_back(ctx);
+	ctx->out_queued_len = 0;
+
 	atomic_clear_bit(&ctx->bits, MSC_BULK_IN_WEDGED);
 	atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_WEDGED);
 }
@@ -418,31 +511,144 @@ static void msc_queue_bulk_in_ep(struct msc_bot_ctx *ctx, uint8_t *data, int len
 	}
 }
 
-static void msc_process_read(struct msc_bot_ctx *ctx)
+/* Queue data spanning consecutive SCSI buffers, one transfer per buffer.
+ * The first buffer is always queued, buffers left without data are freed.
+ */
+static void msc_queue_bulk_in_bufs(struct msc_bot_ctx *ctx, uint8_t *data,
+				   size_t len, int count)
+{
+	for (int i = 0; i < count; i++) {
+		uint8_t *buf = data + i * MSC_SCSI_BUF_STRIDE;
+		size_t buf_len = MIN(len, MSC_SCSI_BUF_STRIDE);
+
+		if ((i > 0 && buf_len == 0) ||
+		    (ctx->state != MSC_BBB_PROCESS_READ)) {
+			msc_free_scsi_buf(ctx, buf);
+			continue;
+		}
+
+		msc_queue_bulk_in_ep(ctx, buf, buf_len);
+		len -= buf_len;
+	}
+}
+
+/* Consecutive buffers only hold consecutive data when transfers fill them */
+static bool msc_can_batch(size_t len)
+{
+	return (MSC_NUM_BUFFERS > 1) && (len == MSC_SCSI_BUF_STRIDE);
+}
+
+static void msc_use_read_ahead(struct msc_bot_ctx *ctx)
 {
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
-	int bytes_queued = 0;
-	uint8_t *scsi_buf;
+	size_t len = 0;
+
+	if (lun == ctx->ra_lun) {
+		len = scsi_read_skip(lun, ctx->ra_lba, ctx->ra_len);
+	}
+
+	if (len == 0) {
+		msc_drop_read_ahead(ctx);
+		return;
+	}
+
+	LOG_DBG("Using %zu bytes read ahead at LBA %u", len, ctx->ra_lba);
+	msc_queue_bulk_in_bufs(ctx, ctx->ra_data, len,
+			       DIV_ROUND_UP(ctx->ra_len, MSC_SCSI_BUF_STRIDE));
+	ctx->ra_len = 0;
+}
+
+/* Read the sectors following the last READ(10) into the free buffers while
+ * waiting for the next CBW. Buffer 0 is left for the CBW, command data and
+ * CSW.
+ */
+static void msc_read_ahead(struct msc_bot_ctx *ctx)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(ctx->class_node);
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	uint8_t *data;
+	int count;
+
+	/* Last CBW may not have been meaningful */
+	if (!IS_ENABLED(CONFIG_USBD_MSC_READ_AHEAD) || ctx->ra_len ||
+	    (ctx->cbw.bCBWLUN >= ctx->registered_luns) ||
+	    !msc_can_batch(clamp_transfer_length(uds_ctx, lun, MSC_SCSI_BUF_STRIDE))) {
+		return;
+	}
+
+	data = msc_alloc_scsi_bufs(ctx, 1, MSC_NUM_BUFFERS - 1, &count);
+	if (count == 0) {
+		return;
+	}
+
+	ctx->ra_len = scsi_read_ahead(lun, data, count * MSC_SCSI_BUF_STRIDE,
+				      &ctx->ra_lba);
+	if (ctx->ra_len == 0) {
+		msc_free_scsi_bufs(ctx, data, count);
+		return;
+	}
+
+	ctx->ra_lun = lun;
+	ctx->ra_data = data;
+}
+
+/* Read as much data as fits in the consecutive free buffers at once */
+static bool msc_read_batch(struct msc_bot_ctx *ctx, size_t len)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	int batch = 1;
+	size_t bytes;
+	uint8_t *data;
+	int count;
+
+	if (msc_can_batch(len)) {
+		batch = MIN(DIV_ROUND_UP(scsi_cmd_remaining_data_len(lun), len),
+			    MSC_BATCH_BUFFERS);
+	}
+
+	data = msc_alloc_scsi_bufs(ctx, 0, batch, &count);
+	if (count == 0) {
+		return false;
+	}
+
+	/* Wait for more buffers to be sent unless USB is idle */
+	if ((count < batch) && ctx->num_in_queued) {
+		msc_free_scsi_bufs(ctx, data, count);
+		return false;
+	}
+
+	bytes = scsi_read_data(lun, data, count * len);
+	msc_queue_bulk_in_bufs(ctx, data, bytes, count);
+
+	return true;
+}
+
+static void msc_process_read(struct msc_bot_ctx *ctx)
+{
 	size_t len;
 
 	/* Data can be already in scsi_buf0 only on first call after CBW */
 	if (ctx->scsi_bytes) {
-		__ASSERT_NO_MSG(ctx->scsi_bufs_used == 0);
-		ctx->scsi_bufs_used = BIT(0);
-		msc_queue_bulk_in_ep(ctx, ctx->scsi_bufs[0], ctx->scsi_bytes);
+		__ASSERT_NO_MSG(!(ctx->scsi_bufs_used & BIT(0)));
+		ctx->scsi_bufs_used |= BIT(0);
+		msc_queue_bulk_in_ep(ctx, msc_scsi_buf(ctx, 0), ctx->scsi_bytes);
 		/* All data is submitted in one go. Any potential new data will
 		 * have to be retrieved using scsi_read_data() later.
 		 */
 		ctx->scsi_bytes = 0;
 	}
 
-	/* Fill SCSI Data IN buffer if there is avaialble buffer and data */
-	while ((ctx->num_in_queued < MSC_NUM_BUFFERS) &&
-	       (ctx->state == MSC_BBB_PROCESS_READ) &&
+	/* Data read ahead can only be used on first call after CBW */
+	if (ctx->ra_len) {
+		msc_use_read_ahead(ctx);
+	}
+
+	/* Fill SCSI Data IN buffers if there are available buffers and data */
+	while ((ctx->state == MSC_BBB_PROCESS_READ) &&
 	       (len = msc_next_in_transfer_length(ctx->class_node))) {
-		scsi_buf = msc_alloc_scsi_buf(ctx);
-		bytes_queued = scsi_read_data(lun, scsi_buf, len);
-		msc_queue_bulk_in_ep(ctx, scsi_buf, bytes_queued);
+		if (!msc_read_batch(ctx, len)) {
+			break;
+		}
 	}
 }
 
@@ -453,11 +659,12 @@ static void msc_process_cbw(struct msc_bot_ctx *ctx)
 	size_t data_len;
 	int cb_len;
 
-	/* All SCSI buffers must be available */
-	__ASSERT_NO_MSG(ctx->scsi_bufs_used == 0);
+	/* All SCSI buffers but the ones read ahead must be available */
+	__ASSERT_NO_MSG(ctx->ra_len || ctx->scsi_bufs_used == 0);
+	__ASSERT_NO_MSG(!(ctx->scsi_bufs_used & BIT(0)));
 
 	cb_len = scsi_usb_boot_cmd_len(ctx->cbw.CBWCB, ctx->cbw.bCBWCBLength);
-	data_len = scsi_cmd(lun, ctx->cbw.CBWCB, cb_len, ctx->scsi_bufs[0]);
+	data_len = scsi_cmd(lun, ctx->cbw.CBWCB, cb_len, msc_scsi_buf(ctx, 0));
 	ctx->scsi_bytes = data_len;
 	cmd_is_data_read = scsi_cmd_is_data_read(lun);
 	cmd_is_data_write = scsi_cmd_is_data_write(lun);
@@ -528,27 +735,19 @@ static void msc_process_cbw(struct msc_bot_ctx *ctx)
 			ctx->state = MSC_BBB_PROCESS_WRITE;
 		}
 	}
+
+	if (ctx->state != MSC_BBB_PROCESS_READ) {
+		msc_drop_read_ahead(ctx);
+	}
 }
 
-static void msc_process_write(struct msc_bot_ctx *ctx,
-			      uint8_t *buf, size_t len)
+static void msc_check_write_done(struct msc_bot_ctx *ctx)
 {
-	size_t tmp;
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
 
-	ctx->transferred_data += len;
-
-	if ((len > 0) && (scsi_cmd_remaining_data_len(lun) > 0)) {
-		/* Pass data to SCSI layer. */
-		tmp = scsi_write_data(lun, buf, len);
-		__ASSERT(tmp <= len, "Processed more data than requested");
-		if (tmp == 0) {
-			LOG_WRN("SCSI handler didn't process %zu bytes", len);
-		} else {
-			LOG_DBG("SCSI processed %zu out of %zu bytes", tmp, len);
-		}
-
-		ctx->csw.dCSWDataResidue -= tmp;
+	/* Data waiting to be written must be passed to SCSI layer first */
+	if (ctx->wb_len) {
+		return;
 	}
 
 	if ((ctx->transferred_data >= ctx->cbw.dCBWDataTransferLength) ||
@@ -571,7 +770,90 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 	}
 }
 
-static void msc_handle_bulk_out(struct msc_bot_ctx *ctx,
+/* Write all the data waiting in consecutive SCSI buffers at once */
+static void msc_flush_write(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	size_t len = ctx->wb_len;
+	size_t tmp;
+
+	/* Pass data to SCSI layer. */
+	tmp = scsi_write_data(lun, ctx->wb_data, len);
+	__ASSERT(tmp <= len, "Processed more data than requested");
+	if (tmp == 0) {
+		LOG_WRN("SCSI handler didn't process %zu bytes", len);
+	} else {
+		LOG_DBG("SCSI processed %zu out of %zu bytes", tmp, len);
+	}
+
+	ctx->csw.dCSWDataResidue -= tmp;
+	msc_drop_write_back(ctx);
+	msc_check_write_done(ctx);
+}
+
+static bool msc_write_back_needed(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+
+	if (ctx->wb_len == 0) {
+		return false;
+	}
+
+	/* Write when no more data can be received before, when all the data
+	 * has been received, when enough buffers are waiting or when the next
+	 * buffer cannot follow the data in memory.
+	 */
+	return (ctx->num_out_queued == 0) ||
+	       (ctx->wb_len >= scsi_cmd_remaining_data_len(lun)) ||
+	       (ctx->transferred_data >= ctx->cbw.dCBWDataTransferLength) ||
+	       (ctx->wb_len >= MSC_BATCH_BUFFERS * MSC_SCSI_BUF_STRIDE) ||
+	       (ctx->wb_data + ctx->wb_len >= msc_scsi_buf(ctx, MSC_NUM_BUFFERS));
+}
+
+static void msc_write_back(struct msc_bot_ctx *ctx)
+{
+	/* Keep USB busy with the free buffers while the disk is written */
+	msc_queue_write(ctx);
+
+	if (ctx->state == MSC_BBB_PROCESS_WRITE && msc_write_back_needed(ctx)) {
+		msc_flush_write(ctx);
+
+		if (ctx->state == MSC_BBB_PROCESS_WRITE) {
+			msc_queue_write(ctx);
+		}
+	}
+}
+
+/* Returns true if the buffer is kept to be written to the disk later */
+static bool msc_process_write(struct msc_bot_ctx *ctx,
+			      uint8_t *buf, size_t len)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	bool keep = false;
+
+	ctx->transferred_data += len;
+
+	/* Only data following the waiting data in memory can be added to it */
+	if (ctx->wb_len && (ctx->wb_data + ctx->wb_len != buf)) {
+		msc_flush_write(ctx);
+	}
+
+	if ((ctx->state == MSC_BBB_PROCESS_WRITE) && (len > 0) &&
+	    (scsi_cmd_remaining_data_len(lun) > ctx->wb_len)) {
+		if (ctx->wb_len == 0) {
+			ctx->wb_data = buf;
+		}
+
+		ctx->wb_len += len;
+		keep = true;
+	}
+
+	msc_check_write_done(ctx);
+
+	return keep;
+}
+
+static bool msc_handle_bulk_out(struct msc_bot_ctx *ctx,
 				uint8_t *buf, size_t len)
 {
 	if (ctx->state == MSC_BBB_EXPECT_CBW) {
@@ -606,8 +888,10 @@ static void msc_handle_bulk_out(struct msc_bot_ctx *ctx,
 			msc_stall_and_wait_for_recovery(ctx);
 		}
 	} else if (ctx->state == MSC_BBB_PROCESS_WRITE) {
-		msc_process_write(ctx, buf, len);
+		return msc_process_write(ctx, buf, len);
 	}
+
+	return false;
 }
 
 static void msc_handle_bulk_in(struct msc_bot_ctx *ctx,
@@ -685,6 +969,7 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
 	struct msc_bot_ctx *ctx = usbd_class_get_private(c_data);
 	struct udc_buf_info *bi;
+	bool keep = false;
 
 	bi = udc_get_buf_info(buf);
 	if (err) {
@@ -700,7 +985,7 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	}
 
 	if (bi->ep == msc_get_bulk_out(c_data)) {
-		msc_handle_bulk_out(ctx, buf->data, buf->len);
+		keep = msc_handle_bulk_out(ctx, buf->data, buf->len);
 	} else if (bi->ep == msc_get_bulk_in(c_data)) {
 		msc_handle_bulk_in(ctx, buf->data, buf->len);
 	}
@@ -708,6 +993,7 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 ep_request_error:
 	if (bi->ep == msc_get_bulk_out(c_data)) {
 		ctx->num_out_queued--;
+		ctx->out_queued_len -= MIN(ctx->out_queued_len, buf->size);
 		if (buf->frags) {
 			ctx->num_out_queued--;
 		}
@@ -717,7 +1003,9 @@ ep_request_error:
 			ctx->num_in_queued--;
 		}
 	}
-	msc_free_scsi_buf(ctx, buf->__buf);
+	if (!keep) {
+		msc_free_scsi_buf(ctx, buf->__buf);
+	}
 	if (buf->frags) {
 		msc_free_scsi_buf(ctx, buf->frags->__buf);
 	}
@@ -749,10 +1037,12 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 		switch (ctx->state) {
 		case MSC_BBB_EXPECT_CBW:
 			msc_queue_cbw(evt.c_data);
+			/* Overlap disk access with the host sending next CBW */
+			msc_read_ahead(ctx);
 			break;
 		case MSC_BBB_PROCESS_WRITE:
 			/* Ensure we can accept next OUT packet */
-			msc_queue_write(ctx);
+			msc_write_back(ctx);
 			break;
 		case MSC_BBB_PROCESS_READ:
 			msc_process_read(ctx);
@@ -775,7 +1065,7 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 		if (ctx->state == MSC_BBB_PROCESS_READ) {
 			msc_process_read(ctx);
 		} else if (ctx->state == MSC_BBB_PROCESS_WRITE) {
-			msc_queue_write(ctx);
+			msc_write_back(ctx);
 		} else if (ctx->state == MSC_BBB_SEND_CSW) {
 			msc_send_csw(ctx);
 		}
@@ -994,18 +1284,10 @@ struct usbd_class_api msc_bot_api = {
 	.init = msc_bot_init,
 };
 
-#define BUF_NAME(x, i) scsi_buf##i##_##x
-
-#define DEFINE_SCSI_BUF(x, i)							\
-	UDC_STATIC_BUF_DEFINE(BUF_NAME(x, i), CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);
+#define BUF_NAME(x) scsi_bufs_##x
 
 #define DEFINE_SCSI_BUFS(x)							\
-	DEFINE_SCSI_BUF(x, 0)							\
-	IF_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING, (DEFINE_SCSI_BUF(x, 1)))
-
-#define NAME_SCSI_BUFS(x)							\
-	BUF_NAME(x, 0)								\
-	IF_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING, (, BUF_NAME(x, 1)))
+	UDC_STATIC_BUF_DEFINE(BUF_NAME(x), MSC_NUM_BUFFERS * MSC_SCSI_BUF_STRIDE);
 
 #define DEFINE_MSC_BOT_CLASS_DATA(x, _)						\
 	DEFINE_SCSI_BUFS(x)							\
@@ -1014,7 +1296,7 @@ struct usbd_class_api msc_bot_api = {
 		.desc = &msc_bot_desc_##x,					\
 		.fs_desc = msc_bot_fs_desc_##x,					\
 		.hs_desc = msc_bot_hs_desc_##x,					\
-		.scsi_bufs = { NAME_SCSI_BUFS(x) },				\
+		.scsi_bufs = BUF_NAME(x),					\
 	};									\
 										\
 	USBD_DEFINE_CLASS(msc_##x, &msc_bot_api, &msc_bot_ctx_##x,		\
@@ -417,6 +417,9 @@ void scsi_reset(struct scsi_ctx *ctx)
 {
 	ctx->prevent_removal = false;
 	ctx->medium_loaded = true;
+	ctx->remaining_data = 0;
+	ctx->read_cb = NULL;
+	ctx->write_cb = NULL;
 }
 
 /* SPC-5 TEST UNIT READY command */
@@ -950,6 +953,43 @@ size_t scsi_write_data(struct scsi_ctx *ctx, const uint8_t *buf, size_t length)
 	return processed;
 }
 
+size_t scsi_read_ahead(struct scsi_ctx *ctx, uint8_t *buf, size_t length, uint32_t *lba)
+{
+	uint32_t sectors;
+
+	/* Only the sectors following a completed READ(10) are read ahead */
+	if ((ctx->read_cb != fill_read_10) || (ctx->remaining_data > 0) ||
+	    (ctx->status != GOOD) || (ctx->lba >= ctx->sector_count)) {
+		return 0;
+	}
+
+	sectors = MIN(length / ctx->sector_size, ctx->sector_count - ctx->lba);
+	if ((sectors == 0) || disk_access_read(ctx->disk, buf, ctx->lba, sectors) != 0) {
+		return 0;
+	}
+
+	*lba = ctx->lba;
+	return sectors * ctx->sector_size;
+}
+
+size_t scsi_read_skip(struct scsi_ctx *ctx, uint32_t lba, size_t length)
+{
+	uint32_t sectors;
+
+	__ASSERT_NO_MSG(ctx->cmd_is_data_read);
+
+	/* Data read ahead is only valid for READ(10) starting at its LBA */
+	if ((ctx->read_cb != fill_read_10) || (ctx->lba != lba)) {
+		return 0;
+	}
+
+	sectors = MIN(length, ctx->remaining_data) / ctx->sector_size;
+	ctx->lba += sectors;
+	ctx->remaining_data -= sectors * ctx->sector_size;
+
+	return sectors * ctx->sector_size;
+}
+
 enum scsi_status_code scsi_cmd_get_status(struct scsi_ctx *ctx)
 {
 	return ctx->status;
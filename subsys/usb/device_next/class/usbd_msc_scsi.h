@@ -93,6 +93,8 @@ bool scsi_cmd_is_data_write(struct scsi_ctx *ctx);
 size_t scsi_cmd_remaining_data_len(struct scsi_ctx *ctx);
 size_t scsi_read_data(struct scsi_ctx *ctx, uint8_t *data_in_buf, size_t length);
 size_t scsi_write_data(struct scsi_ctx *ctx, const uint8_t *buf, size_t length);
+size_t scsi_read_ahead(struct scsi_ctx *ctx, uint8_t *buf, size_t length, uint32_t *lba);
+size_t scsi_read_skip(struct scsi_ctx *ctx, uint32_t lba, size_t length);
 
 enum scsi_status_code scsi_cmd_get_status(struct scsi_ctx *ctx);
 
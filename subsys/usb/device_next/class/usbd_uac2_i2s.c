@@ -0,0 +1,308 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/usb/usbd.h>
+#include <zephyr/usb/class/usbd_uac2.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(usbd_uac2_i2s, CONFIG_USBD_UAC2_LOG_LEVEL);
+
+/* Explicit feedback is Q10.14 samples per frame at Full-Speed and Q16.16
+ * samples per microframe at High-Speed.
+ */
+#define FEEDBACK_FS_SHIFT	14
+#define FEEDBACK_HS_SHIFT	16
+
+/* Number of blocks queued for I2S TX, moving average in Q16 format */
+#define LEVEL_SHIFT		16
+#define LEVEL_AVG_SHIFT		4
+
+static struct uac2_i2s_stream *find_stream(struct uac2_i2s_bridge *bridge,
+					   uint8_t terminal)
+{
+	for (size_t i = 0; i < bridge->num_streams; i++) {
+		if (bridge->streams[i].terminal == terminal) {
+			return &bridge->streams[i];
+		}
+	}
+
+	return NULL;
+}
+
+static uint32_t frames_per_second(struct uac2_i2s_bridge *bridge)
+{
+	return (USBD_SUPPORTS_HIGH_SPEED && bridge->microframes) ? 8000 : 1000;
+}
+
+static uint16_t nominal_size(struct uac2_i2s_bridge *bridge,
+			     struct uac2_i2s_stream *stream)
+{
+	return stream->sample_rate / frames_per_second(bridge) * stream->frame_size;
+}
+
+static void stream_stop(struct uac2_i2s_stream *stream)
+{
+	if (stream->started) {
+		(void)i2s_trigger(stream->i2s_dev, stream->dir, I2S_TRIGGER_DROP);
+	}
+
+	stream->started = false;
+	stream->blocks_written = 0;
+	stream->level = 0;
+}
+
+static void stream_start(struct uac2_i2s_stream *stream)
+{
+	int ret;
+
+	ret = i2s_trigger(stream->i2s_dev, stream->dir, I2S_TRIGGER_START);
+	if (ret) {
+		LOG_ERR("Failed to start I2S for terminal %u: %d",
+			stream->terminal, ret);
+		return;
+	}
+
+	stream->started = true;
+	stream->level = (int32_t)stream->prebuffer << LEVEL_SHIFT;
+}
+
+static void bridge_terminal_update(const struct device *dev, uint8_t terminal,
+				   bool enabled, bool microframes,
+				   void *user_data)
+{
+	struct uac2_i2s_bridge *bridge = user_data;
+	struct uac2_i2s_stream *stream = find_stream(bridge, terminal);
+
+	ARG_UNUSED(dev);
+
+	bridge->microframes = microframes;
+
+	if (stream == NULL) {
+		return;
+	}
+
+	stream->enabled = enabled;
+	if (!enabled) {
+		stream_stop(stream);
+	} else if (stream->dir == I2S_DIR_RX && !stream->started) {
+		stream_start(stream);
+	}
+}
+
+static void *bridge_get_recv_buf(const struct device *dev, uint8_t terminal,
+				 uint16_t size, void *user_data)
+{
+	struct uac2_i2s_bridge *bridge = user_data;
+	struct uac2_i2s_stream *stream = find_stream(bridge, terminal);
+	void *buf;
+
+	ARG_UNUSED(dev);
+
+	if (stream == NULL || stream->dir != I2S_DIR_TX || !stream->enabled) {
+		return NULL;
+	}
+
+	__ASSERT_NO_MSG(size <= stream->mem_slab->info.block_size);
+
+	/* Packet is received directly in the block queued for I2S TX */
+	if (k_mem_slab_alloc(stream->mem_slab, &buf, K_NO_WAIT) != 0) {
+		return NULL;
+	}
+
+	stream->usb_blocks++;
+
+	return buf;
+}
+
+static void bridge_data_recv(const struct device *dev, uint8_t terminal,
+			     void *buf, uint16_t size, void *user_data)
+{
+	struct uac2_i2s_bridge *bridge = user_data;
+	struct uac2_i2s_stream *stream = find_stream(bridge, terminal);
+	int ret;
+
+	ARG_UNUSED(dev);
+
+	__ASSERT_NO_MSG(stream != NULL);
+	stream->usb_blocks--;
+
+	if (!stream->enabled) {
+		k_mem_slab_free(stream->mem_slab, buf);
+		return;
+	}
+
+	if (size == 0) {
+		/* Zero fill to keep I2S going, the host will either resume
+		 * sending data or disable the terminal.
+		 */
+		size = nominal_size(bridge, stream);
+		memset(buf, 0, size);
+	}
+
+	ret = i2s_write(stream->i2s_dev, buf, size);
+	if (ret < 0) {
+		/* Most likely underrun occurred, restart once prebuffered */
+		stream->started = false;
+		stream->blocks_written = 0;
+		(void)i2s_trigger(stream->i2s_dev, I2S_DIR_TX, I2S_TRIGGER_PREPARE);
+
+		ret = i2s_write(stream->i2s_dev, buf, size);
+		if (ret < 0) {
+			k_mem_slab_free(stream->mem_slab, buf);
+			return;
+		}
+	}
+
+	if (stream->blocks_written < UINT8_MAX) {
+		stream->blocks_written++;
+	}
+}
+
+static void bridge_buf_release(const struct device *dev, uint8_t terminal,
+			       void *buf, void *user_data)
+{
+	struct uac2_i2s_bridge *bridge = user_data;
+	struct uac2_i2s_stream *stream = find_stream(bridge, terminal);
+
+	ARG_UNUSED(dev);
+
+	__ASSERT_NO_MSG(stream != NULL);
+	k_mem_slab_free(stream->mem_slab, buf);
+}
+
+static void bridge_send(const struct device *dev, struct uac2_i2s_stream *stream)
+{
+	void *block;
+	size_t size;
+	int ret;
+
+	/* Blocks filled by I2S RX are sent as they are. Blocks that cannot be
+	 * queued because I2S runs faster than USB are dropped.
+	 */
+	while ((ret = i2s_read(stream->i2s_dev, &block, &size)) == 0) {
+		if (usbd_uac2_send(dev, stream->terminal, block, size)) {
+			k_mem_slab_free(stream->mem_slab, block);
+		}
+	}
+
+	if (ret == -EIO) {
+		/* Overrun stopped I2S RX */
+		(void)i2s_trigger(stream->i2s_dev, I2S_DIR_RX, I2S_TRIGGER_PREPARE);
+		stream_start(stream);
+	}
+}
+
+static void bridge_sof(const struct device *dev, void *user_data)
+{
+	struct uac2_i2s_bridge *bridge = user_data;
+
+	for (size_t i = 0; i < bridge->num_streams; i++) {
+		struct uac2_i2s_stream *stream = &bridge->streams[i];
+		int32_t queued;
+
+		if (!stream->enabled) {
+			continue;
+		}
+
+		if (stream->dir == I2S_DIR_RX) {
+			bridge_send(dev, stream);
+			continue;
+		}
+
+		if (!stream->started) {
+			if (stream->blocks_written >= stream->prebuffer) {
+				stream_start(stream);
+			}
+
+			continue;
+		}
+
+		/* Blocks allocated from the slab are either waiting for USB
+		 * data or queued for I2S TX.
+		 */
+		queued = k_mem_slab_num_used_get(stream->mem_slab) - stream->usb_blocks;
+		stream->level += ((queued << LEVEL_SHIFT) - stream->level) >> LEVEL_AVG_SHIFT;
+	}
+}
+
+/*
+ * The host is asked for more samples when less blocks than prebuffered are
+ * queued for I2S TX, and for less samples when more blocks are queued. The
+ * difference is corrected over 2^CONFIG_USBD_UAC2_I2S_FEEDBACK_SHIFT frames,
+ * by at most one sample per frame.
+ */
+static uint32_t bridge_feedback(const struct device *dev, uint8_t terminal,
+				void *user_data)
+{
+	struct uac2_i2s_bridge *bridge = user_data;
+	struct uac2_i2s_stream *stream = find_stream(bridge, terminal);
+	int shift = FEEDBACK_FS_SHIFT;
+	int64_t correction;
+	uint32_t nominal;
+	int32_t error;
+
+	ARG_UNUSED(dev);
+
+	if (USBD_SUPPORTS_HIGH_SPEED && bridge->microframes) {
+		shift = FEEDBACK_HS_SHIFT;
+	}
+
+	__ASSERT_NO_MSG(stream != NULL);
+	nominal = ((uint64_t)stream->sample_rate << shift) / frames_per_second(bridge);
+
+	if (!stream->started) {
+		return nominal;
+	}
+
+	error = ((int32_t)stream->prebuffer << LEVEL_SHIFT) - stream->level;
+	correction = ((int64_t)error * nominal) >>
+		     (LEVEL_SHIFT + CONFIG_USBD_UAC2_I2S_FEEDBACK_SHIFT);
+	correction = CLAMP(correction, -(int64_t)BIT64(shift), (int64_t)BIT64(shift));
+
+	return nominal + correction;
+}
+
+static const struct uac2_ops bridge_ops = {
+	.sof_cb = bridge_sof,
+	.terminal_update_cb = bridge_terminal_update,
+	.get_recv_buf = bridge_get_recv_buf,
+	.data_recv_cb = bridge_data_recv,
+	.buf_release_cb = bridge_buf_release,
+	.feedback_cb = bridge_feedback,
+};
+
+int usbd_uac2_i2s_bridge_init(const struct device *dev,
+			      struct uac2_i2s_bridge *bridge)
+{
+	for (size_t i = 0; i < bridge->num_streams; i++) {
+		struct uac2_i2s_stream *stream = &bridge->streams[i];
+
+		if (stream->i2s_dev == NULL || stream->mem_slab == NULL ||
+		    stream->frame_size == 0 || stream->sample_rate == 0 ||
+		    (stream->dir != I2S_DIR_TX && stream->dir != I2S_DIR_RX)) {
+			LOG_ERR("Invalid stream for terminal %u", stream->terminal);
+			return -EINVAL;
+		}
+
+		if (!device_is_ready(stream->i2s_dev)) {
+			LOG_ERR("%s is not ready", stream->i2s_dev->name);
+			return -ENODEV;
+		}
+
+		stream->enabled = false;
+		stream->usb_blocks = 0;
+		stream_stop(stream);
+	}
+
+	bridge->microframes = false;
+	usbd_uac2_set_ops(dev, &bridge_ops, bridge);
+
+	return 0;
+}
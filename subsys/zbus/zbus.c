@@ -7,6 +7,7 @@
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/net_buf.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/check.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/printk.h>
@@ -33,6 +34,13 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 	return net_buf_alloc_len(pool, size, timeout);
 }
 
+/* Heap allocated data is reference counted, clones share it with the published buffer */
+static inline struct net_buf *_zbus_share_net_buf(const struct zbus_channel *chan,
+						  struct net_buf *buf, k_timeout_t timeout)
+{
+	return net_buf_clone(buf, timeout);
+}
+
 #else
 
 NET_BUF_POOL_FIXED_DEFINE(_zbus_msg_subscribers_pool,
@@ -49,6 +57,26 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 		 (int)size);
 	return net_buf_alloc(pool, timeout);
 }
+
+NET_BUF_POOL_VIEW_DEFINE(_zbus_msg_subscribers_view_pool,
+			 (CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_SIZE),
+			 sizeof(struct zbus_channel *));
+
+/* Fixed size data cannot be shared by clones, which would copy the message for each observer.
+ * Observers get views of the published buffer instead.
+ */
+static inline struct net_buf *_zbus_share_net_buf(const struct zbus_channel *chan,
+						  struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf *view =
+		net_buf_slice(&_zbus_msg_subscribers_view_pool, buf, 0, buf->len, timeout);
+
+	if (view != NULL) {
+		memcpy(net_buf_user_data(view), &chan, sizeof(struct zbus_channel *));
+	}
+
+	return view;
+}
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_ALLOC_DYNAMIC */
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
@@ -191,7 +219,8 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
 	case ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE: {
-		struct net_buf *cloned_buf = net_buf_clone(buf, sys_timepoint_timeout(end_time));
+		struct net_buf *cloned_buf =
+			_zbus_share_net_buf(chan, buf, sys_timepoint_timeout(end_time));
 
 		if (cloned_buf == NULL) {
 			return -ENOMEM;
@@ -205,7 +234,8 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 
 #if defined(CONFIG_ZBUS_ASYNC_LISTENER)
 	case ZBUS_OBSERVER_ASYNC_LISTENER_TYPE: {
-		struct net_buf *cloned_buf = net_buf_clone(buf, sys_timepoint_timeout(end_time));
+		struct net_buf *cloned_buf =
+			_zbus_share_net_buf(chan, buf, sys_timepoint_timeout(end_time));
 
 		if (cloned_buf == NULL) {
 			return -ENOMEM;
@@ -452,6 +482,58 @@ static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+/* Number of lock-free copies attempted before falling back to the semaphore */
+#define ZBUS_SEQLOCK_READ_ATTEMPTS 3
+
+/* Writers are serialized by the channel's semaphore, the atomic increments also act as
+ * barriers around the message update.
+ */
+static inline void chan_write_begin(const struct zbus_channel *chan)
+{
+	(void)atomic_inc(&chan->data->seq);
+}
+
+static inline void chan_write_end(const struct zbus_channel *chan)
+{
+	(void)atomic_inc(&chan->data->seq);
+}
+
+static bool chan_read_lockless(const struct zbus_channel *chan, void *msg)
+{
+	for (int i = 0; i < ZBUS_SEQLOCK_READ_ATTEMPTS; ++i) {
+		atomic_val_t seq = atomic_get(&chan->data->seq);
+
+		if ((seq & 1) != 0) {
+			/* A writer holds the channel, spinning would only delay it */
+			return false;
+		}
+
+		memcpy(msg, chan->message, chan->message_size);
+
+		barrier_dmem_fence_full();
+
+		if (atomic_get(&chan->data->seq) == seq) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#else
+
+static inline void chan_write_begin(const struct zbus_channel *chan)
+{
+}
+
+static inline void chan_write_end(const struct zbus_channel *chan)
+{
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
@@ -483,8 +565,12 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 	chan->data->publish_count += 1;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
 
+	chan_write_begin(chan);
+
 	memcpy(chan->message, msg, chan->message_size);
 
+	chan_write_end(chan);
+
 	err = _zbus_vded_exec(chan, end_time);
 
 	chan_unlock(chan, context_priority);
@@ -503,6 +589,12 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 		timeout = K_NO_WAIT;
 	}
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	if (chan_read_lockless(chan, msg)) {
+		return 0;
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	int err = k_sem_take(&chan->data->sem, timeout);
 	if (err) {
 		return err;
@@ -559,6 +651,9 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
+	/* The message may be changed in place until the channel is finished */
+	chan_write_begin(chan);
+
 	return 0;
 }
 
@@ -566,6 +661,8 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+	chan_write_end(chan);
+
 	k_sem_give(&chan->data->sem);
 
 	return 0;
@@ -611,6 +708,28 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 	return 0;
 }
 
+int zbus_sub_wait_msg_buf(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus_sub_wait_msg_buf cannot be used inside ISRs");
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(sub->type == ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+		     "sub must be a MSG_SUBSCRIBER");
+	_ZBUS_ASSERT(sub->message_fifo != NULL, "sub message_fifo is required");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+
+	*buf = k_fifo_get(sub->message_fifo, timeout);
+
+	if (*buf == NULL) {
+		return -ENOMSG;
+	}
+
+	*chan = *((struct zbus_channel **)net_buf_user_data(*buf));
+
+	return 0;
+}
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 int zbus_obs_set_chan_notification_mask(const struct zbus_observer *obs,
@@ -16,6 +16,7 @@
 #include <x86_mmu.h>
 #include <zephyr/linker/linker-defs.h>
 #include <mmu.h>
+#include <kernel_arch_interface.h>
 #include "main.h"
 
 #ifdef CONFIG_X86_64
@@ -226,6 +227,57 @@ ZTEST(x86_pagetables, test_null_map)
 	zassert_true((entry & MMU_P) == 0, "present NULL entry");
 }
 
+/**
+ * Test that physically contiguous mappings use large pages, which are
+ * split when partially unmapped
+ *
+ * @ingroup kernel_memprotect_tests
+ */
+ZTEST(x86_pagetables, test_large_pages)
+{
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+#if defined(CONFIG_X86_64) || defined(CONFIG_X86_PAE)
+	const size_t large_page_size = MB(2);
+#else
+	const size_t large_page_size = MB(4);
+#endif
+	/* Nothing is accessed, only the page tables are checked */
+	const uintptr_t phys = 0xC0000000UL;
+	uint8_t *virt;
+	uintptr_t page_phys;
+	pentry_t entry;
+	int level;
+
+	k_mem_map_phys_bare(&virt, phys, large_page_size,
+			    K_MEM_PERM_RW | K_MEM_CACHE_NONE);
+	zassert_not_null(virt, "mapping failed");
+
+	z_x86_pentry_get(&level, &entry, z_x86_page_tables_get(), virt);
+	zassert_equal(level, PT_LEVEL - 1, "not mapped with a large page");
+	zassert_true((entry & MMU_PS) != 0, "not mapped with a large page");
+
+	zassert_ok(arch_page_phys_get(virt + 5 * CONFIG_MMU_PAGE_SIZE, &page_phys));
+	zassert_equal(page_phys, phys + 5 * CONFIG_MMU_PAGE_SIZE, "wrong physical address");
+
+	/* Unmapping one page splits the large page */
+	k_mem_unmap_phys_bare(virt + CONFIG_MMU_PAGE_SIZE, CONFIG_MMU_PAGE_SIZE);
+
+	z_x86_pentry_get(&level, &entry, z_x86_page_tables_get(), virt);
+	zassert_equal(level, PT_LEVEL, "large page not split");
+	zassert_true((entry & MMU_P) != 0, "page unmapped with its neighbor");
+
+	zassert_not_ok(arch_page_phys_get(virt + CONFIG_MMU_PAGE_SIZE, NULL));
+	zassert_ok(arch_page_phys_get(virt + 5 * CONFIG_MMU_PAGE_SIZE, &page_phys));
+	zassert_equal(page_phys, phys + 5 * CONFIG_MMU_PAGE_SIZE, "wrong physical address");
+
+	k_mem_unmap_phys_bare(virt, CONFIG_MMU_PAGE_SIZE);
+	k_mem_unmap_phys_bare(virt + 2 * CONFIG_MMU_PAGE_SIZE,
+			      large_page_size - 2 * CONFIG_MMU_PAGE_SIZE);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+}
+
 void z_impl_dump_my_ptables(void)
 {
 	struct k_thread *cur = k_current_get();
@@ -0,0 +1,120 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measures the time of an allocation followed by a release, for the kernel
+ * heap, the system heap, memory slabs and the C library heap. Each sample is
+ * the average of a batch of allocations, all released afterwards, so that the
+ * heaps also go through their free block coalescing.
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+#include "bench_report.h"
+
+#define BATCH      16
+#define BLOCK_SIZE 32
+
+K_HEAP_DEFINE(bench_heap, BATCH * (BLOCK_SIZE + 16) + 256);
+K_MEM_SLAB_DEFINE_STATIC(bench_slab, BLOCK_SIZE, BATCH, sizeof(void *));
+
+static uint64_t samples[BENCH_REPETITIONS];
+static void *blocks[BATCH];
+
+typedef void *(*alloc_fn_t)(void);
+typedef void (*free_fn_t)(void *block);
+
+static void *k_heap_alloc_fn(void)
+{
+	return k_heap_alloc(&bench_heap, BLOCK_SIZE, K_NO_WAIT);
+}
+
+static void k_heap_free_fn(void *block)
+{
+	k_heap_free(&bench_heap, block);
+}
+
+static void *k_malloc_fn(void)
+{
+	return k_malloc(BLOCK_SIZE);
+}
+
+static void *k_mem_slab_alloc_fn(void)
+{
+	void *block;
+
+	return k_mem_slab_alloc(&bench_slab, &block, K_NO_WAIT) == 0 ? block : NULL;
+}
+
+static void k_mem_slab_free_fn(void *block)
+{
+	k_mem_slab_free(&bench_slab, block);
+}
+
+static void *malloc_fn(void)
+{
+	return malloc(BLOCK_SIZE);
+}
+
+static int bench_alloc(const char *metric, alloc_fn_t alloc_fn, free_fn_t free_fn)
+{
+	for (int i = 0; i < BENCH_REPETITIONS; i++) {
+		timing_t start, end;
+
+		start = timing_counter_get();
+
+		for (int j = 0; j < BATCH; j++) {
+			blocks[j] = alloc_fn();
+		}
+
+		for (int j = 0; j < BATCH; j++) {
+			if (blocks[j] != NULL) {
+				free_fn(blocks[j]);
+			}
+		}
+
+		end = timing_counter_get();
+
+		for (int j = 0; j < BATCH; j++) {
+			if (blocks[j] == NULL) {
+				printk("%s: allocation failed\n", metric);
+				return -ENOMEM;
+			}
+		}
+
+		samples[i] = timing_cycles_get(&start, &end) / BATCH;
+	}
+
+	bench_report_ns("allocators", metric, samples, BENCH_REPETITIONS);
+
+	return 0;
+}
+
+int main(void)
+{
+	int ret = 0;
+
+	timing_init();
+	timing_start();
+
+	ret |= bench_alloc("k_heap", k_heap_alloc_fn, k_heap_free_fn);
+	ret |= bench_alloc("k_malloc", k_malloc_fn, k_free);
+	ret |= bench_alloc("k_mem_slab", k_mem_slab_alloc_fn, k_mem_slab_free_fn);
+	ret |= bench_alloc("malloc", malloc_fn, free);
+
+	timing_stop();
+
+	if (ret == 0) {
+		printk("PROJECT EXECUTION SUCCESSFUL\n");
+	} else {
+		printk("PROJECT EXECUTION FAILED\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Common result reporting of the benchmarks.
+ *
+ * A benchmark repeats its measurement BENCH_REPETITIONS times and reports the
+ * statistics of the samples as a single line:
+ *
+ *   BENCH:<suite>:<metric>:{"unit":"ns","samples":32,"min":...,"median":...,
+ *                          "mean":...,"max":...,"stddev":...}
+ *
+ * which twister records into twister.json with the harness configuration
+ * below, for scripts/benchmarks/compare_benchmarks.py to check against a
+ * baseline:
+ *
+ *   harness_config:
+ *     type: one_line
+ *     record:
+ *       regex:
+ *         - "BENCH:(?P<suite>[^:]+):(?P<metric>[^:]+):(?P<stats>\\{.*\\})"
+ *       as_json: [stats]
+ *     regex:
+ *       - "PROJECT EXECUTION SUCCESSFUL"
+ *
+ * The median is used for comparisons, as it is not skewed by the samples
+ * disturbed by interrupts or cache misses.
+ */
+
+#ifndef ZEPHYR_BENCHMARK_COMMON_BENCH_REPORT_H_
+#define ZEPHYR_BENCHMARK_COMMON_BENCH_REPORT_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+#ifndef BENCH_REPETITIONS
+#define BENCH_REPETITIONS 32
+#endif
+
+struct bench_stats {
+	uint64_t min;
+	uint64_t median;
+	uint64_t mean;
+	uint64_t max;
+	uint64_t stddev;
+};
+
+static inline uint64_t bench_isqrt(uint64_t value)
+{
+	uint64_t root = 0;
+	uint64_t bit = BIT64(62);
+
+	while (bit > value) {
+		bit >>= 2;
+	}
+
+	while (bit != 0) {
+		if (value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+/* Sorts the samples in place */
+static inline void bench_stats_compute(uint64_t *samples, size_t num_samples,
+				       struct bench_stats *stats)
+{
+	uint64_t sum = 0;
+	uint64_t var = 0;
+
+	__ASSERT_NO_MSG(num_samples > 0);
+
+	for (size_t i = 1; i < num_samples; i++) {
+		uint64_t sample = samples[i];
+		size_t j = i;
+
+		while (j > 0 && samples[j - 1] > sample) {
+			samples[j] = samples[j - 1];
+			j--;
+		}
+		samples[j] = sample;
+	}
+
+	for (size_t i = 0; i < num_samples; i++) {
+		sum += samples[i];
+	}
+
+	stats->min = samples[0];
+	stats->max = samples[num_samples - 1];
+	stats->median = samples[num_samples / 2];
+	stats->mean = sum / num_samples;
+
+	for (size_t i = 0; i < num_samples; i++) {
+		int64_t delta = (int64_t)(samples[i] - stats->mean);
+
+		var += (uint64_t)(delta * delta);
+	}
+
+	stats->stddev = bench_isqrt(var / num_samples);
+}
+
+static inline void bench_report(const char *suite, const char *metric, const char *unit,
+				uint64_t *samples, size_t num_samples)
+{
+	struct bench_stats stats;
+
+	bench_stats_compute(samples, num_samples, &stats);
+
+	printk("BENCH:%s:%s:{\"unit\":\"%s\",\"samples\":%zu,\"min\":%llu,\"median\":%llu,"
+	       "\"mean\":%llu,\"max\":%llu,\"stddev\":%llu}\n",
+	       suite, metric, unit, num_samples, stats.min, stats.median, stats.mean, stats.max,
+	       stats.stddev);
+}
+
+/* Reports timing samples, converted from cycles to nanoseconds */
+static inline void bench_report_ns(const char *suite, const char *metric, uint64_t *cycles,
+				   size_t num_samples)
+{
+	for (size_t i = 0; i < num_samples; i++) {
+		cycles[i] = timing_cycles_to_ns(cycles[i]);
+	}
+
+	bench_report(suite, metric, "ns", cycles, num_samples);
+}
+
+#endif /* ZEPHYR_BENCHMARK_COMMON_BENCH_REPORT_H_ */
@@ -0,0 +1,151 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/avl.h>
+#include <zephyr/sys/rb.h>
+
+#define TREE_SIZE 512
+
+/* Worst case height of an AVL tree of TREE_SIZE nodes, 1.44 * log2(N) */
+#define AVL_MAX_HEIGHT 13
+
+struct item {
+	struct rbnode rb;
+	struct avlnode avl;
+	uint32_t key;
+};
+
+static struct item items[TREE_SIZE];
+static struct rbtree rb_tree;
+static struct avltree avl_tree;
+
+static bool rb_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return CONTAINER_OF(a, struct item, rb)->key < CONTAINER_OF(b, struct item, rb)->key;
+}
+
+static bool avl_lessthan(struct avlnode *a, struct avlnode *b)
+{
+	return CONTAINER_OF(a, struct item, avl)->key < CONTAINER_OF(b, struct item, avl)->key;
+}
+
+/* Same LCRNG as the rbtree unit test, repeatable across platforms */
+static uint32_t next_rand(void)
+{
+	static unsigned long long state = 123456789;
+
+	state = state * 2862933555777941757ul + 3037000493ul;
+
+	return (uint32_t)(state >> 32);
+}
+
+static void report(const char *op, uint32_t rb_cycles, uint32_t avl_cycles)
+{
+	TC_PRINT("%-10s rbtree %6u avltree %6u cycles per node\n", op, rb_cycles / TREE_SIZE,
+		 avl_cycles / TREE_SIZE);
+}
+
+static int avl_height(struct avlnode *n)
+{
+	int l, r;
+
+	if (n == NULL) {
+		return 0;
+	}
+
+	l = avl_height(n->children[0]);
+	r = avl_height(n->children[1]);
+
+	return 1 + MAX(l, r);
+}
+
+/**
+ * @brief Compare the AVL tree with the red/black tree
+ *
+ * @details Time inserting nodes in random order, looking them up,
+ * iterating and removing them lowest first as a priority queue does.
+ *
+ * @ingroup lib_avltree_tests
+ */
+ZTEST(avltree_perf, test_avltree_vs_rbtree)
+{
+	uint32_t rb_cycles, avl_cycles, start;
+	struct rbnode *rb_node;
+	struct avlnode *avl_node;
+	int count;
+
+	rb_tree.lessthan_fn = rb_lessthan;
+	avl_tree.lessthan_fn = avl_lessthan;
+
+	for (size_t i = 0; i < TREE_SIZE; i++) {
+		items[i].key = next_rand();
+	}
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < TREE_SIZE; i++) {
+		rb_insert(&rb_tree, &items[i].rb);
+	}
+	rb_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < TREE_SIZE; i++) {
+		avl_insert(&avl_tree, &items[i].avl);
+	}
+	avl_cycles = k_cycle_get_32() - start;
+
+	report("insert", rb_cycles, avl_cycles);
+	zassert_true(avl_height(avl_tree.root) <= AVL_MAX_HEIGHT);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < TREE_SIZE; i++) {
+		zassert_true(rb_contains(&rb_tree, &items[i].rb));
+	}
+	rb_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < TREE_SIZE; i++) {
+		zassert_true(avl_contains(&avl_tree, &items[i].avl));
+	}
+	avl_cycles = k_cycle_get_32() - start;
+
+	report("contains", rb_cycles, avl_cycles);
+
+	count = 0;
+	start = k_cycle_get_32();
+	RB_FOR_EACH(&rb_tree, rb_node) {
+		count++;
+	}
+	rb_cycles = k_cycle_get_32() - start;
+	zassert_equal(count, TREE_SIZE);
+
+	count = 0;
+	start = k_cycle_get_32();
+	AVL_FOR_EACH(&avl_tree, avl_node) {
+		count++;
+	}
+	avl_cycles = k_cycle_get_32() - start;
+	zassert_equal(count, TREE_SIZE);
+
+	report("iterate", rb_cycles, avl_cycles);
+
+	start = k_cycle_get_32();
+	while ((rb_node = rb_get_min(&rb_tree)) != NULL) {
+		rb_remove(&rb_tree, rb_node);
+	}
+	rb_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	while ((avl_node = avl_get_min(&avl_tree)) != NULL) {
+		avl_remove(&avl_tree, avl_node);
+	}
+	avl_cycles = k_cycle_get_32() - start;
+
+	report("pop min", rb_cycles, avl_cycles);
+	zassert_is_null(avl_tree.root);
+}
+
+ZTEST_SUITE(avltree_perf, NULL, NULL, NULL, NULL, NULL);
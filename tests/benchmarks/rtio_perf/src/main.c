@@ -0,0 +1,92 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measures the RTIO overhead, using no-op submissions completed by the
+ * executor itself: the round-trip of a single submission, and the time per
+ * submission of a batch submitted at once.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/timing/timing.h>
+
+#include "bench_report.h"
+
+#define BATCH 16
+
+RTIO_DEFINE(bench_rtio, BATCH, BATCH);
+
+static uint64_t samples[BENCH_REPETITIONS];
+
+static int submit_nops(int count)
+{
+	struct rtio_cqe *cqe;
+	int ret = 0;
+
+	for (int i = 0; i < count; i++) {
+		rtio_sqe_prep_nop(rtio_sqe_acquire(&bench_rtio), NULL, NULL);
+	}
+
+	ret = rtio_submit(&bench_rtio, count);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (int i = 0; i < count; i++) {
+		cqe = rtio_cqe_consume_block(&bench_rtio);
+		if (cqe->result < 0) {
+			ret = cqe->result;
+		}
+		rtio_cqe_release(&bench_rtio, cqe);
+	}
+
+	return ret;
+}
+
+static int bench_nops(const char *metric, int count)
+{
+	for (int i = 0; i < BENCH_REPETITIONS; i++) {
+		timing_t start, end;
+		int ret;
+
+		start = timing_counter_get();
+		ret = submit_nops(count);
+		end = timing_counter_get();
+
+		if (ret < 0) {
+			printk("%s: failed: %d\n", metric, ret);
+			return ret;
+		}
+
+		samples[i] = timing_cycles_get(&start, &end) / count;
+	}
+
+	bench_report_ns("rtio", metric, samples, BENCH_REPETITIONS);
+
+	return 0;
+}
+
+int main(void)
+{
+	int ret = 0;
+
+	timing_init();
+	timing_start();
+
+	ret |= bench_nops("nop_round_trip", 1);
+	ret |= bench_nops("nop_batch", BATCH);
+
+	timing_stop();
+
+	if (ret == 0) {
+		printk("PROJECT EXECUTION SUCCESSFUL\n");
+	} else {
+		printk("PROJECT EXECUTION FAILED\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/dma/dma_memcpy.h>
+#include <zephyr/ztest.h>
+
+/* Several blocks, with an unaligned tail */
+#define COPY_LEN ((2 * CONFIG_DMA_MEMCPY_MAX_BLOCK_SIZE) + 3)
+
+static uint8_t src[COPY_LEN];
+static uint8_t dst[COPY_LEN];
+static K_SEM_DEFINE(copy_done, 0, 2);
+static int copy_status;
+
+static void *dma_memcpy_setup(void)
+{
+	for (size_t i = 0; i < sizeof(src); i++) {
+		src[i] = (uint8_t)(i * 7);
+	}
+
+	return NULL;
+}
+
+static void dma_memcpy_before(void *f)
+{
+	ARG_UNUSED(f);
+
+	memset(dst, 0, sizeof(dst));
+}
+
+ZTEST(dma_memcpy, test_sync)
+{
+	zassert_ok(dma_memcpy(dst, src, sizeof(src)));
+	zassert_mem_equal(dst, src, sizeof(src));
+}
+
+ZTEST(dma_memcpy, test_below_threshold)
+{
+	zassert_ok(dma_memcpy(&dst[1], &src[1], CONFIG_DMA_MEMCPY_THRESHOLD - 1));
+	zassert_mem_equal(&dst[1], &src[1], CONFIG_DMA_MEMCPY_THRESHOLD - 1);
+	zassert_equal(dst[0], 0, "Copied out of range");
+	zassert_equal(dst[CONFIG_DMA_MEMCPY_THRESHOLD], 0, "Copied out of range");
+}
+
+static void copy_cb(struct dma_memcpy_req *req, int status)
+{
+	if (status != 0) {
+		copy_status = status;
+	}
+
+	k_sem_give(&copy_done);
+}
+
+ZTEST(dma_memcpy, test_async_queued)
+{
+	size_t half = COPY_LEN / 2;
+	struct dma_memcpy_req reqs[] = {
+		{ .dst = dst, .src = src, .len = half, .cb = copy_cb },
+		{ .dst = &dst[half], .src = &src[half], .len = COPY_LEN - half, .cb = copy_cb },
+	};
+
+	copy_status = 0;
+	k_sem_reset(&copy_done);
+
+	zassert_equal(dma_memcpy_submit(&(struct dma_memcpy_req){ 0 }), -EINVAL);
+	zassert_ok(dma_memcpy_submit(&reqs[0]));
+	zassert_ok(dma_memcpy_submit(&reqs[1]));
+
+	zassert_ok(k_sem_take(&copy_done, K_SECONDS(1)));
+	zassert_ok(k_sem_take(&copy_done, K_SECONDS(1)));
+	zassert_ok(copy_status);
+	zassert_mem_equal(dst, src, sizeof(src));
+}
+
+ZTEST_SUITE(dma_memcpy, NULL, dma_memcpy_setup, dma_memcpy_before, NULL, NULL);
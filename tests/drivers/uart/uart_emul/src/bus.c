@@ -7,6 +7,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/drivers/uart/rtio.h>
 #include <zephyr/ztest.h>
 
 #define EMUL_UART_NODE	       DT_NODELABEL(euart0)
@@ -354,4 +355,50 @@ ZTEST_F(uart_emul, test_async_rx_buffer_release)
 }
 #endif /* CONFIG_UART_ASYNC_API */
 
+#ifdef CONFIG_UART_RTIO
+UART_RTIO_IODEV_DEFINE(uart_emul_iodev, DEVICE_DT_GET(EMUL_UART_NODE), SYS_FOREVER_US);
+RTIO_DEFINE(uart_emul_rtio, 4, 4);
+
+ZTEST_F(uart_emul, test_rtio_tx)
+{
+	struct rtio_sqe *sqe = rtio_sqe_acquire(&uart_emul_rtio);
+	struct rtio_cqe *cqe;
+	size_t tx_len;
+
+	zassert_not_null(sqe);
+	rtio_sqe_prep_write(sqe, &uart_emul_iodev, RTIO_PRIO_NORM, fixture->sample_data,
+			    sizeof(fixture->sample_data), NULL);
+	zassert_ok(rtio_submit(&uart_emul_rtio, 1));
+
+	cqe = rtio_cqe_consume_block(&uart_emul_rtio);
+	zassert_equal(cqe->result, SAMPLE_DATA_SIZE, "Expected all data to be sent");
+	rtio_cqe_release(&uart_emul_rtio, cqe);
+
+	tx_len = uart_emul_get_tx_data(fixture->dev, fixture->tx_content, SAMPLE_DATA_SIZE);
+	zassert_equal(tx_len, SAMPLE_DATA_SIZE, "TX buffer length does not match");
+	zassert_mem_equal(fixture->tx_content, fixture->sample_data, SAMPLE_DATA_SIZE);
+}
+
+ZTEST_F(uart_emul, test_rtio_rx)
+{
+	struct rtio_sqe *sqe = rtio_sqe_acquire(&uart_emul_rtio);
+	struct rtio_cqe *cqe;
+
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read(sqe, &uart_emul_iodev, RTIO_PRIO_NORM, fixture->rx_content,
+			   sizeof(fixture->rx_content), fixture->rx_content);
+	zassert_ok(rtio_submit(&uart_emul_rtio, 0));
+
+	uart_emul_put_rx_data(fixture->dev, fixture->sample_data, SAMPLE_DATA_SIZE);
+
+	/* Completed once the buffer is full */
+	cqe = rtio_cqe_consume_block(&uart_emul_rtio);
+	zassert_equal(cqe->result, SAMPLE_DATA_SIZE, "Expected a full buffer");
+	zassert_equal_ptr(cqe->userdata, fixture->rx_content);
+	rtio_cqe_release(&uart_emul_rtio, cqe);
+
+	zassert_mem_equal(fixture->rx_content, fixture->sample_data, SAMPLE_DATA_SIZE);
+}
+#endif /* CONFIG_UART_RTIO */
+
 ZTEST_SUITE(uart_emul, NULL, uart_emul_setup, uart_emul_before, NULL, NULL);
@@ -143,4 +143,25 @@ ZTEST(video_common, test_video_closest_frmival_stepwise)
 	zassert_equal(video_frmival_nsec(&match), video_frmival_nsec(&stepwise.max), "100 / 1");
 }
 
+ZTEST(video_common, test_video_buffer_ref)
+{
+	struct video_buffer *vbuf;
+
+	vbuf = video_buffer_alloc(64, K_NO_WAIT);
+	zassert_not_null(vbuf);
+	zassert_equal_ptr(video_buffer_ref(vbuf), vbuf);
+
+	/* The pool has a single buffer, still held by the second reference */
+	video_buffer_release(vbuf);
+	zassert_not_null(vbuf->buffer);
+	zassert_is_null(video_buffer_alloc(64, K_NO_WAIT));
+
+	video_buffer_release(vbuf);
+	zassert_is_null(vbuf->buffer);
+
+	vbuf = video_buffer_alloc(64, K_NO_WAIT);
+	zassert_not_null(vbuf);
+	video_buffer_release(vbuf);
+}
+
 ZTEST_SUITE(video_common, NULL, NULL, NULL, NULL, NULL);
@@ -6,6 +6,7 @@
 
 #include <zephyr/ztest.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/atomic64.h>
 
 /* convenience macro - return either 64-bit or 32-bit value */
 #define ATOMIC_WORD(val_if_64, val_if_32)                                                          \
@@ -385,6 +386,41 @@ ZTEST(atomic, test_atomic_overflow)
 		atomic_value);
 }
 
+/**
+ * @brief Verify the 64-bit atomic operations
+ *
+ * @details Check that the 64-bit atomic operations return the previous value
+ * and update all the 64 bits, including carries across 32-bit halves, also
+ * on 32-bit targets.
+ */
+ZTEST_USER(atomic, test_atomic64)
+{
+	static ZTEST_BMEM atomic64_t target;
+	atomic64_val_t value = 0xffffffffLL;
+
+	atomic64_set(&target, value);
+	zassert_equal(atomic64_inc(&target), value);
+	zassert_equal(atomic64_get(&target), 0x100000000LL);
+	zassert_equal(atomic64_dec(&target), 0x100000000LL);
+	zassert_equal(atomic64_get(&target), value);
+
+	zassert_equal(atomic64_add(&target, 0x100000000LL), value);
+	zassert_equal(atomic64_sub(&target, 1), 0x1ffffffffLL);
+	zassert_equal(atomic64_get(&target), 0x1fffffffeLL);
+
+	zassert_false(atomic64_cas(&target, value, 0));
+	zassert_true(atomic64_cas(&target, 0x1fffffffeLL, INT64_MIN));
+	zassert_equal(atomic64_get(&target), INT64_MIN);
+	zassert_equal(atomic64_dec(&target), INT64_MIN);
+	zassert_equal(atomic64_get(&target), INT64_MAX);
+
+	zassert_equal(atomic64_clear(&target), INT64_MAX);
+	zassert_equal(atomic64_or(&target, 0x300000000LL), 0);
+	zassert_equal(atomic64_xor(&target, 0x100000001LL), 0x300000000LL);
+	zassert_equal(atomic64_and(&target, 0x200000001LL), 0x200000001LL);
+	zassert_equal(atomic64_get(&target), 0x200000001LL);
+}
+
 /**
  * @}
  */
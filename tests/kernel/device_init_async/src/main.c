@@ -0,0 +1,110 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ztest.h>
+
+#define DT_DRV_COMPAT test_async_init
+
+#define READY_TIMEOUT_MS 1000
+
+struct async_init_config {
+	const struct device *dep;
+	uint32_t delay_ms;
+};
+
+struct async_init_data {
+	int64_t start;
+	int64_t end;
+	bool dep_ready;
+};
+
+static int async_init(const struct device *dev)
+{
+	const struct async_init_config *config = dev->config;
+	struct async_init_data *data = dev->data;
+
+	data->start = k_uptime_get();
+	data->dep_ready = (config->dep == NULL) || device_is_ready(config->dep);
+
+	/* Wait for the hardware */
+	k_msleep(config->delay_ms);
+
+	data->end = k_uptime_get();
+
+	return 0;
+}
+
+#define ASYNC_INIT_DEFINE(inst)                                                                    \
+	static const struct async_init_config async_init_config_##inst = {                         \
+		.dep = COND_CODE_1(DT_INST_NODE_HAS_PROP(inst, dep),                               \
+				   (DEVICE_DT_GET(DT_INST_PHANDLE(inst, dep))), (NULL)),           \
+		.delay_ms = DT_INST_PROP(inst, delay_ms),                                          \
+	};                                                                                         \
+	static struct async_init_data async_init_data_##inst;                                      \
+	DEVICE_DT_INST_DEFINE(inst, async_init, NULL, &async_init_data_##inst,                     \
+			      &async_init_config_##inst, POST_KERNEL, 50, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(ASYNC_INIT_DEFINE)
+
+static const struct device *const async_a = DEVICE_DT_GET(DT_NODELABEL(async_a));
+static const struct device *const async_b = DEVICE_DT_GET(DT_NODELABEL(async_b));
+static const struct device *const async_c = DEVICE_DT_GET(DT_NODELABEL(async_c));
+static const struct device *const sync_d = DEVICE_DT_GET(DT_NODELABEL(sync_d));
+
+static void wait_ready(const struct device *dev)
+{
+	int64_t timeout = k_uptime_get() + READY_TIMEOUT_MS;
+
+	while (!device_is_ready(dev)) {
+		zassert_true(k_uptime_get() < timeout, "%s not initialized", dev->name);
+		k_msleep(10);
+	}
+}
+
+/**
+ * @brief Test that independent devices are initialized concurrently
+ */
+ZTEST(device_init_async, test_concurrent)
+{
+	struct async_init_data *a = async_a->data;
+	struct async_init_data *b = async_b->data;
+
+	wait_ready(async_a);
+	wait_ready(async_b);
+
+	zassert_true((a->start < b->end) && (b->start < a->end),
+		     "Expected overlapping initializations");
+}
+
+/**
+ * @brief Test that devices are initialized after the devices they require
+ */
+ZTEST(device_init_async, test_dependencies)
+{
+	struct async_init_data *c = async_c->data;
+	struct async_init_data *d = sync_d->data;
+
+	/* Synchronous devices are initialized by the time the application runs */
+	zassert_true(device_is_ready(sync_d));
+	zassert_true(d->dep_ready, "sync_d initialized before async_b");
+
+	wait_ready(async_c);
+	zassert_true(c->dep_ready, "async_c initialized before async_a");
+}
+
+/**
+ * @brief Test that asynchronous devices cannot be initialized again
+ */
+ZTEST(device_init_async, test_init_again)
+{
+	wait_ready(async_a);
+
+	zassert_equal(device_init(async_a), -EALREADY);
+}
+
+ZTEST_SUITE(device_init_async, NULL, NULL, NULL, NULL, NULL);
@@ -473,6 +473,42 @@ ZTEST(events_api, test_k_event_wait_all_safe)
 	zexpect_equal(events, 0x62, "expected 0x62, got %x", events);
 }
 
+static void entry_wait_mask(void *p1, void *p2, void *p3)
+{
+	test_events = k_event_wait(p1, 0x10, false, K_FOREVER);
+}
+
+/**
+ * Test that posting events which no thread waits for does not wake the
+ * waiters, and that the events waited for are tracked as threads pend and
+ * wake up.
+ */
+ZTEST(events_api, test_k_event_wait_mask)
+{
+	static struct k_event  event;
+	k_tid_t  tid;
+
+	k_event_init(&event);
+	zassert_equal(event.wait_mask, 0);
+
+	test_events = 0;
+	tid = k_thread_create(&treceiver, sreceiver, STACK_SIZE,
+			      entry_wait_mask, &event, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(DELAY);
+	zassert_equal(event.wait_mask, 0x10);
+
+	k_event_post(&event, 0x01);
+	k_sleep(DELAY);
+	zassert_equal(test_events, 0, "woken by events not waited for");
+	zassert_equal(event.events, 0x01);
+
+	k_event_post(&event, 0x10);
+	zassert_ok(k_thread_join(tid, LONG_TIMEOUT));
+	zassert_equal(test_events, 0x10, "expected 0x10, got %x", test_events);
+	zassert_equal(event.wait_mask, 0);
+}
+
 /**
  * @}
  */
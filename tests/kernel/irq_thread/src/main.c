@@ -0,0 +1,84 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/irq_thread.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_SEM_DEFINE(handled, 0, 10);
+static atomic_t runs;
+
+static void bottom_half(void *arg)
+{
+	atomic_inc(&runs);
+	k_sem_give(arg);
+}
+
+K_IRQ_THREAD_DEFINE(static_irq_thread, STACK_SIZE, bottom_half, &handled, K_IRQ_THREAD_PRIO(0));
+
+static struct k_irq_thread dyn_irq_thread;
+static struct k_thread dyn_thread;
+static K_THREAD_STACK_DEFINE(dyn_stack, STACK_SIZE);
+
+static void wake_isr(const void *arg)
+{
+	k_irq_thread_wake((struct k_irq_thread *)arg);
+}
+
+static void wake_thrice_isr(const void *arg)
+{
+	for (int i = 0; i < 3; i++) {
+		k_irq_thread_wake((struct k_irq_thread *)arg);
+	}
+}
+
+static void irq_thread_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_clear(&runs);
+	k_sem_reset(&handled);
+}
+
+ZTEST(irq_thread, test_wake_from_isr)
+{
+	for (int i = 0; i < 3; i++) {
+		irq_offload(wake_isr, &static_irq_thread);
+		zassert_ok(k_sem_take(&handled, K_MSEC(100)));
+	}
+
+	zassert_equal(atomic_get(&runs), 3);
+}
+
+ZTEST(irq_thread, test_coalesce)
+{
+	irq_offload(wake_thrice_isr, &static_irq_thread);
+
+	zassert_ok(k_sem_take(&handled, K_MSEC(100)));
+	zassert_equal(k_sem_take(&handled, K_MSEC(10)), -EAGAIN);
+	zassert_equal(atomic_get(&runs), 1);
+}
+
+ZTEST(irq_thread, test_create)
+{
+	k_tid_t tid = k_irq_thread_create(&dyn_irq_thread, &dyn_thread, dyn_stack,
+					  K_THREAD_STACK_SIZEOF(dyn_stack), bottom_half,
+					  &handled, K_IRQ_THREAD_PRIO(1));
+
+	zassert_not_null(tid);
+	zassert_equal(k_thread_priority_get(tid), K_IRQ_THREAD_PRIO(1));
+
+	irq_offload(wake_isr, &dyn_irq_thread);
+	zassert_ok(k_sem_take(&handled, K_MSEC(100)));
+	zassert_equal(atomic_get(&runs), 1);
+
+	k_thread_abort(tid);
+}
+
+ZTEST_SUITE(irq_thread, NULL, NULL, irq_thread_before, NULL, NULL);
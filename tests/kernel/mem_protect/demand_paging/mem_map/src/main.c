@@ -113,6 +113,12 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	printk("* Prefetch (%s):\n", scope);
+	printk("    - Pages prefetched: %lu\n", stats->prefetch.pages);
+	printk("    - Prefetched pages accessed: %lu\n", stats->prefetch.hits);
+#endif
 }
 
 static void touch_anon_pages(bool zig, bool zag)
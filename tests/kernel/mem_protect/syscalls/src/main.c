@@ -510,6 +510,33 @@ ZTEST(syscalls, test_syscall_context)
 	k_thread_user_mode_enter(test_syscall_context_user, NULL, NULL, NULL);
 }
 
+#ifdef CONFIG_SYSCALL_BATCH
+/**
+ * @brief Test to execute several syscalls with k_syscall_batch()
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_syscall_batch()
+ */
+ZTEST_USER(syscalls, test_syscall_batch)
+{
+	int err = -1;
+	struct k_syscall_batch_entry entries[] = {
+		{ .id = K_SYSCALL_SYSCALL_CONTEXT },
+		{
+			.id = K_SYSCALL_STRING_NLEN,
+			.args = { (uintptr_t)user_string, BUF_SIZE, (uintptr_t)&err },
+		},
+	};
+
+	zassert_equal(k_syscall_batch(entries, ARRAY_SIZE(entries)), 0,
+		      "batch not executed");
+	zassert_true((bool)entries[0].ret, "not reported in user syscall");
+	zassert_equal(entries[1].ret, strlen(user_string), "incorrect string length");
+	zassert_equal(err, 0, "unexpected error");
+}
+#endif /* CONFIG_SYSCALL_BATCH */
+
 K_HEAP_DEFINE(test_heap, BUF_SIZE * (4 * MAX_NR_THREADS));
 
 void *syscalls_setup(void)
@@ -0,0 +1,183 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+static char __aligned(4) zc_buffer[MSG_SIZE * MSGQ_LEN];
+static struct k_msgq zc_msgq;
+static struct k_thread zc_tdata;
+static K_THREAD_STACK_DEFINE(zc_tstack, STACK_SIZE);
+
+static void reserve_commit(struct k_msgq *q, uint32_t msg)
+{
+	void *slot;
+
+	zassert_ok(k_msgq_reserve(q, &slot, K_NO_WAIT));
+	*(uint32_t *)slot = msg;
+	zassert_ok(k_msgq_commit(q));
+}
+
+static uint32_t peek_release(struct k_msgq *q)
+{
+	void *slot;
+	uint32_t msg;
+
+	zassert_ok(k_msgq_peek_slot(q, &slot, K_NO_WAIT));
+	msg = *(uint32_t *)slot;
+	zassert_ok(k_msgq_release(q));
+
+	return msg;
+}
+
+/**
+ * @brief Pass messages in place through the ring buffer
+ *
+ * @details
+ * - Reserved slots are only visible to consumers once committed, and count
+ *   as used space until then.
+ * - Messages are read in place in FIFO order, mixed with copying
+ *   k_msgq_put() and k_msgq_get().
+ *
+ * @see k_msgq_reserve(), k_msgq_commit(), k_msgq_peek_slot(),
+ * k_msgq_release()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy)
+{
+	uint32_t msg = MSG1;
+	void *slot;
+
+	k_msgq_init(&zc_msgq, zc_buffer, MSG_SIZE, MSGQ_LEN);
+
+	zassert_equal(k_msgq_commit(&zc_msgq), -EINVAL);
+	zassert_equal(k_msgq_release(&zc_msgq), -EINVAL);
+	zassert_equal(k_msgq_peek_slot(&zc_msgq, &slot, K_NO_WAIT), -ENOMSG);
+
+	zassert_ok(k_msgq_reserve(&zc_msgq, &slot, K_NO_WAIT));
+	zassert_true((char *)slot >= zc_buffer &&
+		     (char *)slot < zc_buffer + sizeof(zc_buffer));
+	*(uint32_t *)slot = MSG0;
+
+	/* the reserved slot is neither readable nor free */
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+	zassert_equal(k_msgq_num_free_get(&zc_msgq), MSGQ_LEN - 1);
+	zassert_equal(k_msgq_peek_slot(&zc_msgq, &slot, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_reserve(&zc_msgq, &slot, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), -EBUSY);
+
+	zassert_ok(k_msgq_commit(&zc_msgq));
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 1);
+
+	zassert_ok(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT));
+	zassert_equal(k_msgq_reserve(&zc_msgq, &slot, K_NO_WAIT), -ENOMSG);
+
+	zassert_ok(k_msgq_peek_slot(&zc_msgq, &slot, K_NO_WAIT));
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_peek_slot(&zc_msgq, &slot, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_get(&zc_msgq, &msg, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_put_front(&zc_msgq, &msg), -EBUSY);
+	zassert_ok(k_msgq_release(&zc_msgq));
+
+	zassert_ok(k_msgq_get(&zc_msgq, &msg, K_NO_WAIT));
+	zassert_equal(msg, MSG1);
+
+	/* wrap around the ring a few times */
+	for (uint32_t i = 0; i < MSGQ_LEN * 3; i++) {
+		reserve_commit(&zc_msgq, i);
+		zassert_equal(peek_release(&zc_msgq), i);
+	}
+
+	zassert_equal(k_msgq_num_free_get(&zc_msgq), MSGQ_LEN);
+}
+
+/**
+ * @brief Purge discards a held message but keeps a reservation
+ *
+ * @see k_msgq_purge()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy_purge)
+{
+	void *slot;
+
+	k_msgq_init(&zc_msgq, zc_buffer, MSG_SIZE, MSGQ_LEN);
+
+	reserve_commit(&zc_msgq, MSG0);
+	zassert_ok(k_msgq_peek_slot(&zc_msgq, &slot, K_NO_WAIT));
+	zassert_ok(k_msgq_reserve(&zc_msgq, &slot, K_NO_WAIT));
+
+	k_msgq_purge(&zc_msgq);
+
+	zassert_equal(k_msgq_release(&zc_msgq), -EINVAL);
+	*(uint32_t *)slot = MSG1;
+	zassert_ok(k_msgq_commit(&zc_msgq));
+	zassert_equal(peek_release(&zc_msgq), MSG1);
+}
+
+static void zc_consumer_entry(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_ok(k_msgq_peek_slot(p1, &slot, K_FOREVER));
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_ok(k_msgq_release(p1));
+}
+
+static void zc_producer_entry(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_ok(k_msgq_reserve(p1, &slot, K_FOREVER));
+	*(uint32_t *)slot = MSG1;
+	zassert_ok(k_msgq_commit(p1));
+}
+
+/**
+ * @brief Zero-copy calls block on empty and full queues
+ *
+ * @details
+ * - A thread waiting in k_msgq_peek_slot() on an empty queue is handed the
+ *   next message in place, whether it is put or committed.
+ * - A thread waiting in k_msgq_reserve() on a full queue is handed the slot
+ *   freed by the next get or release.
+ *
+ * @see k_msgq_reserve(), k_msgq_peek_slot()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_pending)
+{
+	int pri = k_thread_priority_get(k_current_get()) - 1;
+	uint32_t msg = MSG0;
+	void *slot;
+	k_tid_t tid;
+
+	k_msgq_init(&zc_msgq, zc_buffer, MSG_SIZE, MSGQ_LEN);
+
+	zassert_equal(k_msgq_peek_slot(&zc_msgq, &slot, TIMEOUT), -EAGAIN);
+
+	tid = k_thread_create(&zc_tdata, zc_tstack, STACK_SIZE, zc_consumer_entry,
+			      &zc_msgq, NULL, NULL, pri, 0, K_NO_WAIT);
+	zassert_equal(tid->base.thread_state, _THREAD_PENDING);
+
+	/* only one zero-copy consumer at a time */
+	zassert_equal(k_msgq_get(&zc_msgq, &msg, K_NO_WAIT), -EBUSY);
+
+	zassert_ok(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT));
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+
+	for (uint32_t i = 0; i < MSGQ_LEN; i++) {
+		reserve_commit(&zc_msgq, MSG0);
+	}
+	zassert_equal(k_msgq_reserve(&zc_msgq, &slot, TIMEOUT), -EAGAIN);
+
+	tid = k_thread_create(&zc_tdata, zc_tstack, STACK_SIZE, zc_producer_entry,
+			      &zc_msgq, NULL, NULL, pri, 0, K_NO_WAIT);
+	zassert_equal(tid->base.thread_state, _THREAD_PENDING);
+
+	zassert_ok(k_msgq_get(&zc_msgq, &msg, K_NO_WAIT));
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_equal(peek_release(&zc_msgq), MSG0);
+	zassert_equal(peek_release(&zc_msgq), MSG1);
+}
@@ -164,6 +164,45 @@ ZTEST(k_pipe_concurrency, test_partial_write)
 	k_thread_join(tid, K_FOREVER);
 }
 
+static void thread_write_large(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t *data = arg2;
+
+	zassert_true(k_pipe_write((struct k_pipe *)arg1, data, 4 * DUMMY_DATA_SIZE,
+		K_FOREVER) == 4 * DUMMY_DATA_SIZE, "Failed to write to pipe");
+}
+
+ZTEST(k_pipe_concurrency, test_read_from_pending_writer)
+{
+	k_tid_t tid;
+	uint8_t buffer[DUMMY_DATA_SIZE];
+	uint8_t input[4 * DUMMY_DATA_SIZE];
+	uint8_t output[4 * DUMMY_DATA_SIZE];
+
+#ifdef CONFIG_KERNEL_COHERENCE
+	/* No direct copies between threads, see test_zero_size_pipe_read_write */
+	ztest_test_skip();
+#endif
+
+	for (int i = 0; i < sizeof(input); i++) {
+		input[i] = i;
+	}
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_write_large, &pipe, input, NULL, K_PRIO_COOP(0), 0, K_NO_WAIT);
+	k_msleep(100);
+
+	/* The writer filled the ring buffer and is waiting with the rest of its
+	 * data, which is taken directly from it without having to wait.
+	 */
+	zassert_true(k_pipe_read(&pipe, output, sizeof(output), K_NO_WAIT) == sizeof(output),
+		"Failed to read from pipe");
+	zassert_true(memcmp(input, output, sizeof(input)) == 0,
+		"Unexpected data received from pipe");
+	k_thread_join(tid, K_FOREVER);
+}
+
 static volatile bool zero_thread_read;
 static volatile bool zero_thread_write;
 static void zero_thread_read_write(void *arg1, void *arg2, void *arg3)
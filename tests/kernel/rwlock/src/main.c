@@ -0,0 +1,111 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define N_READERS  2
+
+static K_RWLOCK_DEFINE(rwlock);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, N_READERS + 1, STACK_SIZE);
+static struct k_thread threads[N_READERS + 1];
+
+static atomic_t readers_in;
+static atomic_t value;
+
+static void reader(void *p1, void *p2, void *p3)
+{
+	k_timeout_t hold = K_MSEC(POINTER_TO_INT(p1));
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_FOREVER));
+	atomic_inc(&readers_in);
+	k_sleep(hold);
+	atomic_dec(&readers_in);
+	k_rwlock_read_unlock(&rwlock);
+}
+
+static void writer(void *p1, void *p2, void *p3)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_FOREVER));
+	zassert_equal(atomic_get(&readers_in), 0, "writer runs along readers");
+	atomic_set(&value, 1);
+	k_rwlock_write_unlock(&rwlock);
+}
+
+static k_tid_t spawn(int i, k_thread_entry_t entry, int hold_ms)
+{
+	return k_thread_create(&threads[i], stacks[i], STACK_SIZE, entry,
+			       INT_TO_POINTER(hold_ms), NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+}
+
+ZTEST(rwlock_api, test_concurrent_readers)
+{
+	k_tid_t tids[N_READERS];
+
+	for (int i = 0; i < N_READERS; i++) {
+		tids[i] = spawn(i, reader, 50);
+	}
+
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&readers_in), N_READERS, "readers excluded each other");
+
+	/* Writers cannot get in while the readers hold the lock */
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_MSEC(5)), -EAGAIN);
+
+	/* A failed writer leaves the lock to readers */
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	k_rwlock_read_unlock(&rwlock);
+
+	for (int i = 0; i < N_READERS; i++) {
+		k_thread_join(tids[i], K_FOREVER);
+	}
+}
+
+ZTEST(rwlock_api, test_writer_preference)
+{
+	k_tid_t r, w;
+
+	atomic_set(&value, 0);
+
+	r = spawn(0, reader, 50);
+	k_sleep(K_MSEC(10));
+
+	/* The writer waits for the reader, new readers wait for the writer */
+	w = spawn(N_READERS, writer, 0);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_FOREVER));
+	zassert_equal(atomic_get(&value), 1, "reader went ahead of the pending writer");
+	k_rwlock_read_unlock(&rwlock);
+
+	k_thread_join(r, K_FOREVER);
+	k_thread_join(w, K_FOREVER);
+}
+
+ZTEST(rwlock_api, test_writer_exclusion)
+{
+	struct k_rwlock lock;
+
+	k_rwlock_init(&lock);
+
+	zassert_ok(k_rwlock_write_lock(&lock, K_NO_WAIT));
+	zassert_equal(k_rwlock_read_lock(&lock, K_NO_WAIT), -EBUSY);
+	k_rwlock_write_unlock(&lock);
+
+	zassert_ok(k_rwlock_read_lock(&lock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&lock, K_NO_WAIT));
+	k_rwlock_read_unlock(&lock);
+	k_rwlock_read_unlock(&lock);
+
+	zassert_ok(k_rwlock_write_lock(&lock, K_NO_WAIT));
+	k_rwlock_write_unlock(&lock);
+}
+
+ZTEST_SUITE(rwlock_api, NULL, NULL, NULL, NULL, NULL);
@@ -208,6 +208,57 @@ ZTEST(smp, test_cpu_id_threads)
 	k_thread_join(tid, K_FOREVER);
 }
 
+#ifdef CONFIG_CPU_ID_IN_TLS
+static void tls_cpu_id_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+	volatile bool *mismatch = p1;
+
+	for (int i = 0; i < 100; i++) {
+		unsigned int key = arch_irq_lock();
+
+		if (k_cpu_id_get() != arch_curr_cpu()->id) {
+			*mismatch = true;
+		}
+		arch_irq_unlock(key);
+
+		k_busy_wait(DELAY_US / 100);
+		k_yield();
+	}
+}
+
+/**
+ * @brief Verify the CPU ID stored in thread local storage
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details Run more threads than CPUs so that they migrate, and check
+ * that k_cpu_id_get() always matches the CPU the thread runs on.
+ */
+ZTEST(smp, test_cpu_id_tls)
+{
+	static volatile bool mismatch;
+	unsigned int num_threads = arch_num_cpus() + 1;
+
+	num_threads = MIN(num_threads, MAX_NUM_THREADS);
+	mismatch = false;
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_create(&tthread[i], tstack[i], STACK_SIZE, tls_cpu_id_fn,
+				(void *)&mismatch, NULL, NULL, K_PRIO_PREEMPT(1), 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_join(&tthread[i], K_FOREVER);
+	}
+
+	zassert_false(mismatch, "k_cpu_id_get() returned another CPU");
+	zassert_equal(k_cpu_id_get(), curr_cpu());
+}
+#endif /* CONFIG_CPU_ID_IN_TLS */
+
 static void thread_entry_fn(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p2);
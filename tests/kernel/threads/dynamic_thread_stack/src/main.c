@@ -122,6 +122,42 @@ ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_pool)
 	}
 }
 
+/** @brief Check that recycled pool stacks still report the right usage */
+ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_pool_recycle)
+{
+	static struct k_thread th;
+	size_t unused[2];
+	k_thread_stack_t *stack;
+	k_tid_t tid;
+
+	if (!IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_POOL)) {
+		ztest_test_skip();
+	}
+
+	if (CONFIG_DYNAMIC_THREAD_POOL_SIZE == 0) {
+		ztest_test_skip();
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(unused); ++i) {
+		stack = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE,
+					     IS_ENABLED(CONFIG_USERSPACE) ? K_USER : 0);
+		zassert_not_null(stack);
+
+		tflag[0] = false;
+		tid = k_thread_create(&th, stack, CONFIG_DYNAMIC_THREAD_STACK_SIZE, func,
+				      &tflag[0], NULL, NULL, 0,
+				      K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+
+		zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+		zassert_true(tflag[0]);
+		zassert_ok(k_thread_stack_space_get(tid, &unused[i]));
+		zassert_ok(k_thread_stack_free(stack));
+	}
+
+	/* The same work on a recycled stack must not look deeper */
+	zassert_true(unused[1] >= unused[0], "unused %zu < %zu", unused[1], unused[0]);
+}
+
 /** @brief Exercise the heap-based thread stack allocator */
 ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_alloc)
 {
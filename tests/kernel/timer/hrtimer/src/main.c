@@ -0,0 +1,140 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/hrtimer.h>
+#include <zephyr/ztest.h>
+
+#define PERIODS 5
+
+struct test_timer {
+	struct k_hrtimer timer;
+	uint64_t expiry;
+	uint64_t fired_at;
+	int count;
+	bool drifted;
+};
+
+static struct test_timer timers[3];
+static K_SEM_DEFINE(fired, 0, ARRAY_SIZE(timers));
+static int order[ARRAY_SIZE(timers)];
+static int num_fired;
+
+static uint64_t us_to_cyc(uint32_t us)
+{
+	return k_us_to_cyc_ceil64(us);
+}
+
+static void oneshot_handler(struct k_hrtimer *timer)
+{
+	struct test_timer *t = CONTAINER_OF(timer, struct test_timer, timer);
+
+	t->fired_at = k_cycle_get_64();
+	t->count++;
+	order[num_fired++] = t - timers;
+	k_sem_give(&fired);
+}
+
+static void periodic_handler(struct k_hrtimer *timer)
+{
+	struct test_timer *t = CONTAINER_OF(timer, struct test_timer, timer);
+
+	/* The next expiry is already set, on the initial schedule */
+	if (k_hrtimer_expiry_get(timer) != t->expiry + (t->count + 1) * us_to_cyc(500)) {
+		t->drifted = true;
+	}
+
+	if (++t->count == PERIODS) {
+		k_hrtimer_stop(timer);
+		k_sem_give(&fired);
+	}
+}
+
+static void hrtimer_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(timers, 0, sizeof(timers));
+	num_fired = 0;
+	k_sem_reset(&fired);
+}
+
+ZTEST(hrtimer, test_oneshot)
+{
+	struct test_timer *t = &timers[0];
+
+	k_hrtimer_init(&t->timer, oneshot_handler);
+	t->expiry = k_cycle_get_64() + us_to_cyc(250);
+	k_hrtimer_start(&t->timer, t->expiry, 0);
+
+	zassert_ok(k_sem_take(&fired, K_MSEC(100)));
+	zassert_equal(t->count, 1);
+	zassert_true(t->fired_at >= t->expiry, "expired early");
+	zassert_equal(k_hrtimer_expiry_get(&t->timer), 0);
+
+	TC_PRINT("expiry latency: %u us\n",
+		 (uint32_t)k_cyc_to_us_floor64(t->fired_at - t->expiry));
+}
+
+ZTEST(hrtimer, test_periodic)
+{
+	struct test_timer *t = &timers[0];
+
+	k_hrtimer_init(&t->timer, periodic_handler);
+	t->expiry = k_cycle_get_64() + us_to_cyc(500);
+	k_hrtimer_start(&t->timer, t->expiry, us_to_cyc(500));
+
+	zassert_ok(k_sem_take(&fired, K_MSEC(100)));
+	zassert_equal(t->count, PERIODS);
+	zassert_false(t->drifted, "periodic schedule drifted");
+	zassert_equal(k_hrtimer_expiry_get(&t->timer), 0);
+}
+
+ZTEST(hrtimer, test_order)
+{
+	static const uint32_t delays_us[ARRAY_SIZE(timers)] = {900, 300, 600};
+	uint64_t now = k_cycle_get_64();
+
+	for (int i = 0; i < ARRAY_SIZE(timers); i++) {
+		k_hrtimer_init(&timers[i].timer, oneshot_handler);
+		timers[i].expiry = now + us_to_cyc(delays_us[i]);
+		k_hrtimer_start(&timers[i].timer, timers[i].expiry, 0);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(timers); i++) {
+		zassert_ok(k_sem_take(&fired, K_MSEC(100)));
+	}
+
+	zassert_equal(order[0], 1);
+	zassert_equal(order[1], 2);
+	zassert_equal(order[2], 0);
+}
+
+ZTEST(hrtimer, test_stop)
+{
+	struct test_timer *t = &timers[0];
+
+	k_hrtimer_init(&t->timer, oneshot_handler);
+	k_hrtimer_start(&t->timer, k_cycle_get_64() + us_to_cyc(5000), 0);
+	zassert_not_equal(k_hrtimer_expiry_get(&t->timer), 0);
+	k_hrtimer_stop(&t->timer);
+
+	zassert_equal(k_sem_take(&fired, K_MSEC(20)), -EAGAIN);
+	zassert_equal(t->count, 0);
+}
+
+ZTEST(hrtimer, test_past_expiry)
+{
+	struct test_timer *t = &timers[0];
+
+	k_hrtimer_init(&t->timer, oneshot_handler);
+	k_hrtimer_start(&t->timer, k_cycle_get_64() - 1, 0);
+
+	zassert_ok(k_sem_take(&fired, K_MSEC(100)));
+	zassert_equal(t->count, 1);
+}
+
+ZTEST_SUITE(hrtimer, NULL, NULL, hrtimer_before, NULL, NULL);
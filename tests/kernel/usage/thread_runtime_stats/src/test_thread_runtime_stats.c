@@ -554,5 +554,105 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+static uint32_t latency_hist_count(const k_thread_runtime_stats_t *stats)
+{
+	uint32_t count = 0;
+
+	for (unsigned int i = 0;
+	     i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+		count += stats->latency_hist[i];
+	}
+
+	return count;
+}
+
+/**
+ * @brief Test the scheduling latency statistics
+ *
+ * 1. Create a lower priority helper thread and busy loop for 2 ticks.
+ *    The helper is ready, but does not get to run.
+ * 2. Sleep for 2 ticks twice. The helper runs and is preempted each
+ *    time the main thread wakes up.
+ *    - The helper recorded its ready windows in the histogram
+ *    - The helper has been preempted, and spent time waiting because
+ *      of it
+ *    - The main thread recorded the windows following its wake ups
+ */
+ZTEST(usage_api, test_thread_stats_latency)
+{
+	int  priority;
+	k_tid_t  tid;
+	k_thread_runtime_stats_t  helper_stats;
+	k_thread_runtime_stats_t  main_stats1;
+	k_thread_runtime_stats_t  main_stats2;
+
+	k_thread_runtime_stats_get(_current, &main_stats1);
+
+	priority = k_thread_priority_get(_current);
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper1, NULL, NULL, NULL,
+			      priority + 2, 0, K_NO_WAIT);
+
+	busy_loop(2);
+	k_sleep(K_TICKS(2));
+	k_sleep(K_TICKS(2));
+
+	k_thread_runtime_stats_get(tid, &helper_stats);
+	k_thread_runtime_stats_get(_current, &main_stats2);
+
+	zassert_true(latency_hist_count(&helper_stats) >= 2);
+	zassert_true(helper_stats.num_preemptions >= 2);
+	zassert_true(helper_stats.ready_cycles > 0);
+	zassert_true(helper_stats.preempted_cycles > 0);
+	zassert_true(helper_stats.preempted_cycles <= helper_stats.ready_cycles);
+
+	zassert_true(latency_hist_count(&main_stats2) >=
+		     latency_hist_count(&main_stats1) + 2);
+	zassert_true(main_stats2.ready_cycles > main_stats1.ready_cycles);
+
+	k_thread_abort(tid);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_UTIL
+/**
+ * @brief Test the utilization tracking
+ *
+ * 1. Busy loop for 64 tracking periods. The main thread and the CPU
+ *    get over half of the full utilization, as a period counts for
+ *    half after 32 periods.
+ * 2. Sleep for 64 tracking periods. The utilizations decay to a
+ *    quarter of what they were, at most half allowing for rounding.
+ */
+ZTEST(usage_api, test_thread_stats_util)
+{
+	uint32_t  ticks = k_us_to_ticks_ceil32(64 * CONFIG_SCHED_THREAD_USAGE_UTIL_PERIOD_US);
+	k_thread_runtime_stats_t  thread_stats1;
+	k_thread_runtime_stats_t  thread_stats2;
+	k_thread_runtime_stats_t  cpu_stats1;
+	k_thread_runtime_stats_t  cpu_stats2;
+
+	busy_loop(ticks);
+
+	k_thread_runtime_stats_get(_current, &thread_stats1);
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats1);
+
+	zassert_true(thread_stats1.util > K_THREAD_UTIL_SCALE / 2);
+	zassert_true(thread_stats1.util <= K_THREAD_UTIL_SCALE);
+	zassert_true(cpu_stats1.util > K_THREAD_UTIL_SCALE / 2);
+	zassert_true(cpu_stats1.util <= K_THREAD_UTIL_SCALE);
+
+	k_sleep(K_TICKS(ticks));
+
+	k_thread_runtime_stats_get(_current, &thread_stats2);
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats2);
+
+	zassert_true(thread_stats2.util < thread_stats1.util / 2);
+	zassert_true(cpu_stats2.util < cpu_stats1.util / 2);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_UTIL */
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
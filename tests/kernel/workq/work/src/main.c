@@ -328,6 +328,46 @@ ZTEST(work_1cpu, test_1cpu_simple_queue)
 	zassert_equal(rc, 0);
 }
 
+/* Single-CPU check of batched submission. */
+ZTEST(work_1cpu, test_1cpu_batch_queue)
+{
+	struct k_work *batch[] = { &common_work, &common_work1, &common_work };
+	int rc;
+
+	/* Both handlers signal completion, need two slots. */
+	k_sem_init(&sync_sem, 0, 2);
+	reset_counters();
+	k_work_init(&common_work, counter_handler);
+	k_work_init(&common_work1, counter_handler);
+
+	/* The duplicate entry is already queued by the time it is seen. */
+	rc = k_work_submit_batch_to_queue(&coophi_queue, batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, 2);
+	zassert_equal(k_work_busy_get(&common_work), K_WORK_QUEUED);
+	zassert_equal(k_work_busy_get(&common_work1), K_WORK_QUEUED);
+	zassert_equal(coophi_counter(), 0);
+
+	/* Let them run, then check both finished once. */
+	k_sleep(K_TICKS(1));
+	zassert_equal(coophi_counter(), 2);
+	zassert_equal(k_work_busy_get(&common_work), 0);
+	zassert_equal(k_work_busy_get(&common_work1), 0);
+
+	zassert_equal(k_sem_take(&sync_sem, K_NO_WAIT), 0);
+	zassert_equal(k_sem_take(&sync_sem, K_NO_WAIT), 0);
+
+	/* A rejected queue reports the error for the batch. */
+	rc = k_work_submit_batch_to_queue(&not_start_queue, batch, 2);
+	zassert_equal(rc, -ENODEV);
+	zassert_equal(k_work_busy_get(&common_work), 0);
+
+	/* An empty batch is a no-op. */
+	rc = k_work_submit_batch_to_queue(&coophi_queue, batch, 0);
+	zassert_equal(rc, 0);
+
+	k_sem_init(&sync_sem, 0, 1);
+}
+
 /* Basic SMP check submitting with a non-blocking handler. */
 ZTEST(work, test_smp_simple_queue)
 {
@@ -1457,6 +1497,86 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+static K_THREAD_STACK_DEFINE(pool_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(pool_worker_stack, STACK_SIZE);
+static struct k_work_q pool_queue;
+static struct k_work_q_worker pool_worker;
+static struct k_work pool_work[2];
+static struct k_sem pool_started;
+static struct k_sem pool_release;
+static atomic_t pool_active[2];
+static atomic_t pool_runs[2];
+
+static void pool_handler(struct k_work *work)
+{
+	size_t idx = work - pool_work;
+
+	/* A work item must never run on two workers at once. */
+	zassert_equal(atomic_inc(&pool_active[idx]), 0);
+	atomic_inc(&pool_runs[idx]);
+	k_sem_give(&pool_started);
+	k_sem_take(&pool_release, K_FOREVER);
+	atomic_dec(&pool_active[idx]);
+}
+
+/* Check that a queue with an extra worker processes independent items
+ * concurrently without running any item reentrantly.
+ */
+ZTEST(work, test_pool_queue)
+{
+	struct k_work_queue_config cfg = {
+		.name = "wq.pool",
+	};
+	int rc;
+
+	k_sem_init(&pool_started, 0, 2);
+	k_sem_init(&pool_release, 0, 3);
+	k_work_init(&pool_work[0], pool_handler);
+	k_work_init(&pool_work[1], pool_handler);
+
+	/* Workers can only be added to a started queue. */
+	rc = k_work_queue_add_worker(&pool_queue, &pool_worker,
+				     pool_worker_stack, STACK_SIZE,
+				     PREEMPT_PRIORITY, -1);
+	zassert_equal(rc, -ENODEV);
+
+	k_work_queue_start(&pool_queue, pool_stack, STACK_SIZE,
+			   PREEMPT_PRIORITY, &cfg);
+	rc = k_work_queue_add_worker(&pool_queue, &pool_worker,
+				     pool_worker_stack, STACK_SIZE,
+				     PREEMPT_PRIORITY, -1);
+	zassert_equal(rc, 0);
+
+	/* Both handlers block, so both workers must be busy. */
+	zassert_equal(k_work_submit_to_queue(&pool_queue, &pool_work[0]), 1);
+	zassert_equal(k_work_submit_to_queue(&pool_queue, &pool_work[1]), 1);
+	zassert_equal(k_sem_take(&pool_started, K_MSEC(DELAY_MS)), 0);
+	zassert_equal(k_sem_take(&pool_started, K_MSEC(DELAY_MS)), 0);
+
+	/* Resubmitting a running item queues it on the same queue, but
+	 * neither worker may pick it up until the first run returns.
+	 */
+	rc = k_work_submit_to_queue(&pool_queue, &pool_work[0]);
+	zassert_equal(rc, 2);
+	k_sem_give(&pool_release);
+	k_sem_give(&pool_release);
+	zassert_equal(k_sem_take(&pool_started, K_MSEC(DELAY_MS)), 0);
+	k_sem_give(&pool_release);
+
+	/* Flushing waits for the resubmitted run to finish. */
+	(void)k_work_flush(&pool_work[0], &work_sync);
+	zassert_equal(k_work_busy_get(&pool_work[0]), 0);
+	zassert_equal(atomic_get(&pool_runs[0]), 2);
+	zassert_equal(atomic_get(&pool_runs[1]), 1);
+
+	/* Stopping the queue stops all of its workers. */
+	zassert_equal(k_work_queue_drain(&pool_queue, true), 0);
+	zassert_equal(k_work_queue_stop(&pool_queue, K_MSEC(DELAY_MS)), 0);
+	zassert_equal(pool_queue.flags, 0);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
@@ -0,0 +1,101 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/arena.h>
+
+#define ARENA_SZ 256
+
+SYS_ARENA_DEFINE_STATIC(test_arena, ARENA_SZ);
+
+K_HEAP_DEFINE(test_heap, 1024);
+
+ZTEST(lib_arena, test_arena_alloc)
+{
+	uint8_t *p1, *p2, *p3;
+
+	p1 = sys_arena_alloc(&test_arena, 3);
+	zassert_not_null(p1, "allocation failed");
+	zassert_true(IS_ALIGNED(p1, SYS_ARENA_ALIGN), "misaligned %p", p1);
+
+	p2 = sys_arena_alloc(&test_arena, 5);
+	zassert_not_null(p2, "allocation failed");
+	zassert_true(IS_ALIGNED(p2, SYS_ARENA_ALIGN), "misaligned %p", p2);
+	zassert_true(p2 >= p1 + 3, "allocations overlap");
+
+	p3 = sys_arena_aligned_alloc(&test_arena, 64, 1);
+	zassert_not_null(p3, "allocation failed");
+	zassert_true(IS_ALIGNED(p3, 64), "misaligned %p", p3);
+
+	zassert_is_null(sys_arena_alloc(&test_arena, 0), "zero size allocation");
+	zassert_is_null(sys_arena_alloc(&test_arena, ARENA_SZ), "oversized allocation");
+	zassert_is_null(sys_arena_alloc(&test_arena, SIZE_MAX), "overflowing allocation");
+
+	sys_arena_reset(&test_arena);
+	zassert_equal(sys_arena_used_get(&test_arena), 0, "arena not reset");
+	zassert_equal(sys_arena_free_get(&test_arena), ARENA_SZ, "arena not reset");
+	zassert_equal(sys_arena_alloc(&test_arena, 3), p1, "reset did not rewind");
+	sys_arena_reset(&test_arena);
+}
+
+ZTEST(lib_arena, test_arena_exhaust)
+{
+	size_t n = 0;
+
+	while (sys_arena_alloc(&test_arena, SYS_ARENA_ALIGN) != NULL) {
+		n++;
+	}
+
+	zassert_true(n >= (ARENA_SZ / SYS_ARENA_ALIGN) - 1, "only %zu allocations", n);
+	zassert_true(sys_arena_free_get(&test_arena) < SYS_ARENA_ALIGN, "space left");
+	zassert_equal(sys_arena_max_used_get(&test_arena), sys_arena_used_get(&test_arena));
+
+	sys_arena_reset(&test_arena);
+	zassert_not_null(sys_arena_alloc(&test_arena, ARENA_SZ / 2), "reset failed");
+	sys_arena_reset(&test_arena);
+}
+
+ZTEST(lib_arena, test_arena_mark)
+{
+	void *p1, *p2;
+	size_t mark;
+
+	p1 = sys_arena_alloc(&test_arena, 16);
+	zassert_not_null(p1, "allocation failed");
+
+	mark = sys_arena_mark(&test_arena);
+	p2 = sys_arena_alloc(&test_arena, 32);
+	zassert_not_null(p2, "allocation failed");
+	zassert_not_null(sys_arena_alloc(&test_arena, 32), "allocation failed");
+
+	sys_arena_rewind(&test_arena, mark);
+	zassert_equal(sys_arena_used_get(&test_arena), mark, "rewind failed");
+	zassert_equal(sys_arena_alloc(&test_arena, 32), p2, "rewind did not reuse memory");
+
+	sys_arena_reset(&test_arena);
+}
+
+ZTEST(lib_arena, test_arena_heap)
+{
+	struct sys_arena arena;
+	void *p;
+
+	zassert_equal(sys_arena_init_from_heap(&arena, &test_heap, 4096, K_NO_WAIT), -ENOMEM,
+		      "oversized backing buffer allocated");
+
+	zassert_ok(sys_arena_init_from_heap(&arena, &test_heap, 512, K_NO_WAIT));
+	p = sys_arena_alloc(&arena, 100);
+	zassert_not_null(p, "allocation failed");
+	zassert_true(p >= (void *)arena.base && p < (void *)(arena.base + 512),
+		     "allocation outside of backing buffer");
+	sys_arena_deinit(&arena);
+
+	/* The backing buffer went back to the heap, so it fits again */
+	zassert_ok(sys_arena_init_from_heap(&arena, &test_heap, 512, K_NO_WAIT));
+	sys_arena_deinit(&arena);
+}
+
+ZTEST_SUITE(lib_arena, NULL, NULL, NULL, NULL, NULL);
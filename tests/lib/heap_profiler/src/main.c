@@ -0,0 +1,156 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/heap_profiler.h>
+
+#define HEAP_SIZE 2048
+
+static uint8_t heap_mem[HEAP_SIZE] __aligned(8);
+static struct sys_heap heap;
+
+static struct sys_heap_profiler_site found;
+static int found_count;
+
+static void find_site(const struct sys_heap_profiler_site *site, void *user_data)
+{
+	if ((site->heap_id == HEAP_ID_FROM_POINTER(&heap)) && (site->thread == user_data)) {
+		found = *site;
+		found_count++;
+	}
+}
+
+static void get_site(const struct k_thread *thread)
+{
+	found_count = 0;
+	sys_heap_profiler_foreach(find_site, (void *)thread);
+	zassert_equal(found_count, 1, "site not found");
+}
+
+static void *before(void)
+{
+	sys_heap_init(&heap, heap_mem, sizeof(heap_mem));
+	zassert_ok(sys_heap_profiler_attach(&heap));
+
+	return NULL;
+}
+
+static void before_each(void *data)
+{
+	ARG_UNUSED(data);
+
+	sys_heap_profiler_reset();
+}
+
+ZTEST(heap_profiler, test_attach)
+{
+	zassert_equal(sys_heap_profiler_attach(&heap), -EALREADY);
+}
+
+ZTEST(heap_profiler, test_site_counts)
+{
+	struct sys_heap_profiler_stats stats;
+	void *small = sys_heap_alloc(&heap, 10);
+	void *large = sys_heap_alloc(&heap, 300);
+
+	zassert_not_null(small);
+	zassert_not_null(large);
+
+	get_site(k_current_get());
+	zassert_equal(found.allocs, 2);
+	zassert_equal(found.frees, 0);
+	zassert_true(found.live_bytes >= 310);
+	zassert_equal(found.peak_bytes, found.live_bytes);
+	zassert_equal(found.hist[0], 1, "small allocation in first bucket");
+	zassert_equal(found.hist[5], 1, "300 bytes in the <= 512 bucket");
+
+	sys_heap_free(&heap, small);
+	sys_heap_free(&heap, large);
+
+	get_site(k_current_get());
+	zassert_equal(found.frees, 2);
+	zassert_equal(found.live_bytes, 0);
+	zassert_true(found.peak_bytes >= 310);
+
+	sys_heap_profiler_stats_get(&stats);
+	zassert_equal(stats.allocs, 2);
+	zassert_equal(stats.frees, 2);
+	zassert_equal(stats.live_bytes, 0);
+	zassert_equal(stats.untracked, 0);
+}
+
+ZTEST(heap_profiler, test_realloc_in_place)
+{
+	void *p = sys_heap_alloc(&heap, 64);
+	void *q = sys_heap_realloc(&heap, p, 32);
+
+	zassert_equal(p, q, "shrinking should be done in place");
+
+	get_site(k_current_get());
+	zassert_true(found.live_bytes >= 32 && found.live_bytes < 64);
+
+	sys_heap_free(&heap, q);
+
+	get_site(k_current_get());
+	zassert_equal(found.live_bytes, 0);
+}
+
+static void isr_alloc(const void *arg)
+{
+	*(void **)arg = sys_heap_alloc(&heap, 16);
+}
+
+ZTEST(heap_profiler, test_isr_site)
+{
+	void *p = NULL;
+
+	irq_offload(isr_alloc, &p);
+	zassert_not_null(p);
+
+	get_site(NULL);
+	zassert_equal(found.allocs, 1);
+
+	sys_heap_free(&heap, p);
+}
+
+ZTEST(heap_profiler, test_untracked)
+{
+	struct sys_heap_profiler_stats stats;
+	void *p[CONFIG_SYS_HEAP_PROFILER_ALLOCS + 1];
+
+	ARRAY_FOR_EACH(p, i) {
+		p[i] = sys_heap_alloc(&heap, 8);
+		zassert_not_null(p[i]);
+	}
+
+	sys_heap_profiler_stats_get(&stats);
+	zassert_equal(stats.untracked, 1);
+
+	ARRAY_FOR_EACH(p, i) {
+		sys_heap_free(&heap, p[i]);
+	}
+
+	sys_heap_profiler_stats_get(&stats);
+	zassert_equal(stats.live_bytes, 0);
+}
+
+ZTEST(heap_profiler, test_prior_allocations_ignored)
+{
+	struct sys_heap_profiler_stats stats;
+	void *p = sys_heap_alloc(&heap, 16);
+
+	sys_heap_profiler_reset();
+	sys_heap_free(&heap, p);
+
+	sys_heap_profiler_stats_get(&stats);
+	zassert_equal(stats.frees, 1);
+	zassert_equal(stats.live_bytes, 0);
+}
+
+ZTEST_SUITE(heap_profiler, NULL, before, before_each, NULL, NULL);
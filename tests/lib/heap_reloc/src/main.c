@@ -0,0 +1,135 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/heap_reloc.h>
+
+#define HEAP_SZ   2048
+#define NUM_OBJS  32
+#define OBJ_SZ    100
+
+static uint8_t __aligned(8) heap_mem[HEAP_SZ];
+static struct sys_heap_reloc_slot slots[NUM_OBJS];
+static struct sys_heap_reloc rheap;
+static int handles[NUM_OBJS];
+
+static void fill(int handle, uint8_t pattern)
+{
+	memset(sys_heap_reloc_pin(&rheap, handle), pattern, OBJ_SZ);
+	sys_heap_reloc_unpin(&rheap, handle);
+}
+
+static void check(int handle, uint8_t pattern)
+{
+	uint8_t *p = sys_heap_reloc_pin(&rheap, handle);
+
+	for (int i = 0; i < OBJ_SZ; i++) {
+		zassert_equal(p[i], pattern, "handle %d corrupted at %d", handle, i);
+	}
+	sys_heap_reloc_unpin(&rheap, handle);
+}
+
+/* Fill the heap with small objects, then free every other one */
+static int fragment(void)
+{
+	int n;
+
+	for (n = 0; n < NUM_OBJS; n++) {
+		handles[n] = sys_heap_reloc_alloc(&rheap, OBJ_SZ);
+		if (handles[n] < 0) {
+			zassert_equal(handles[n], -ENOMEM);
+			break;
+		}
+		fill(handles[n], n);
+	}
+	zassert_true(n > 4, "heap too small for the test");
+
+	for (int i = 0; i < n; i += 2) {
+		sys_heap_reloc_free(&rheap, handles[i]);
+		handles[i] = -1;
+	}
+
+	return n;
+}
+
+static void *before(void)
+{
+	sys_heap_reloc_init(&rheap, heap_mem, sizeof(heap_mem), slots, ARRAY_SIZE(slots));
+
+	return NULL;
+}
+
+ZTEST(lib_heap_reloc, test_alloc_free)
+{
+	int h1, h2;
+	void *p;
+
+	h1 = sys_heap_reloc_alloc(&rheap, 16);
+	zassert_true(h1 >= 0, "allocation failed");
+	h2 = sys_heap_reloc_alloc(&rheap, 16);
+	zassert_true(h2 >= 0, "allocation failed");
+	zassert_not_equal(h1, h2, "duplicate handle");
+
+	p = sys_heap_reloc_pin(&rheap, h1);
+	zassert_true(IS_ALIGNED(p, 8), "misaligned %p", p);
+	zassert_equal(sys_heap_reloc_pin(&rheap, h1), p, "pinned object moved");
+	sys_heap_reloc_unpin(&rheap, h1);
+	sys_heap_reloc_unpin(&rheap, h1);
+
+	zassert_equal(sys_heap_reloc_alloc(&rheap, HEAP_SZ), -ENOMEM);
+
+	sys_heap_reloc_free(&rheap, h1);
+	zassert_equal(sys_heap_reloc_alloc(&rheap, 16), h1, "handle not reused");
+
+	for (int i = 2; i < NUM_OBJS; i++) {
+		zassert_true(sys_heap_reloc_alloc(&rheap, 1) >= 0, "allocation failed");
+	}
+	zassert_equal(sys_heap_reloc_alloc(&rheap, 1), -ENOSPC);
+}
+
+ZTEST(lib_heap_reloc, test_compact)
+{
+	int n = fragment();
+	int big;
+
+	zassert_equal(sys_heap_reloc_alloc(&rheap, 4 * OBJ_SZ), -ENOMEM,
+		      "heap is not fragmented");
+
+	zassert_equal(sys_heap_reloc_compact(&rheap, 1), 1, "no object moved");
+	zassert_equal(sys_heap_reloc_compact(&rheap, SIZE_MAX), n / 2 - 1,
+		      "unexpected number of moves");
+	zassert_equal(sys_heap_reloc_compact(&rheap, SIZE_MAX), 0, "heap not compacted");
+
+	for (int i = 1; i < n; i += 2) {
+		check(handles[i], i);
+	}
+
+	big = sys_heap_reloc_alloc(&rheap, 4 * OBJ_SZ);
+	zassert_true(big >= 0, "compaction did not merge free memory");
+}
+
+ZTEST(lib_heap_reloc, test_compact_pinned)
+{
+	int n = fragment();
+	uint8_t *p1 = sys_heap_reloc_pin(&rheap, handles[1]);
+	uint8_t *p3 = sys_heap_reloc_pin(&rheap, handles[3]);
+
+	/* The object of handles[1] stays put, the others move around it */
+	sys_heap_reloc_unpin(&rheap, handles[3]);
+	zassert_true(sys_heap_reloc_compact(&rheap, SIZE_MAX) > 0, "no object moved");
+	zassert_equal(sys_heap_reloc_pin(&rheap, handles[1]), p1, "pinned object moved");
+	zassert_not_equal(sys_heap_reloc_pin(&rheap, handles[3]), p3, "object not moved");
+	sys_heap_reloc_unpin(&rheap, handles[1]);
+	sys_heap_reloc_unpin(&rheap, handles[1]);
+	sys_heap_reloc_unpin(&rheap, handles[3]);
+
+	for (int i = 1; i < n; i += 2) {
+		check(handles[i], i);
+	}
+}
+
+ZTEST_SUITE(lib_heap_reloc, NULL, NULL, before, NULL, NULL);
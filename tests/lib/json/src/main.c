@@ -387,6 +387,26 @@ static const struct json_mixed_arr_descr test_mixed_arr_descr[] = {
 };
 
 
+struct test_appender {
+	char *buffer;
+	size_t used;
+	size_t size;
+};
+
+static int append_to_test_buf(const char *bytes, size_t len, void *data)
+{
+	struct test_appender *appender = data;
+
+	if (len > appender->size - appender->used) {
+		return -ENOMEM;
+	}
+
+	memcpy(&appender->buffer[appender->used], bytes, len);
+	appender->used += len;
+
+	return 0;
+}
+
 ZTEST(lib_json_test, test_json_encoding)
 {
 	struct test_struct ts = {
@@ -482,6 +502,16 @@ ZTEST(lib_json_test, test_json_encoding)
 
 	ret = strncmp(buffer, encoded, sizeof(encoded) - 1);
 	zassert_equal(ret, 0, "Encoded contents not consistent");
+
+	struct test_appender appender = { .buffer = buffer, .size = sizeof(buffer) };
+
+	ret = json_obj_encode(test_descr, ARRAY_SIZE(test_descr), &ts, append_to_test_buf,
+			      &appender);
+	zassert_equal(ret, 0, "Encoding function failed");
+	zassert_equal(appender.used, strlen(encoded), "encoded size mismatch");
+
+	ret = strncmp(buffer, encoded, sizeof(encoded) - 1);
+	zassert_equal(ret, 0, "Encoded contents not consistent");
 }
 
 ZTEST(lib_json_test, test_json_decoding)
@@ -0,0 +1,241 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+#include <zephyr/sys/mpmc_msgq.h>
+
+/*
+ * @brief Produce and consume a single uint32_t in the same execution context
+ *
+ * @see mpmc_acquire(), mpmc_produce(), mpmc_consume(), mpmc_release()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_produce_consume_size1)
+{
+	MPMC_DEFINE(ezmpmc, uint32_t, 1);
+
+	const uint32_t magic = 43219876;
+
+	uint32_t *acq = mpmc_acquire(&ezmpmc);
+
+	zassert_not_null(acq, "Acquire should succeed");
+
+	*acq = magic;
+
+	zassert_is_null(mpmc_acquire(&ezmpmc), "Acquire should fail");
+	zassert_is_null(mpmc_consume(&ezmpmc), "Consume should fail before produce");
+
+	mpmc_produce(&ezmpmc, acq);
+
+	uint32_t *cons = mpmc_consume(&ezmpmc);
+
+	zassert_not_null(cons, "Consume should not fail");
+	zassert_equal(*cons, magic, "Consume value should equal magic");
+	zassert_is_null(mpmc_consume(&ezmpmc), "Consume should fail");
+	zassert_is_null(mpmc_acquire(&ezmpmc), "Acquire should fail before release");
+
+	mpmc_release(&ezmpmc, cons);
+
+	zassert_not_null(mpmc_acquire(&ezmpmc), "Acquire should succeed");
+}
+
+/*
+ * @brief Fill and drain an mpmc of size 4 several times to validate the
+ * sequence numbers across wrap arounds.
+ *
+ * @see mpmc_acquire(), mpmc_produce(), mpmc_consume(), mpmc_release()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_produce_consume_wrap_around)
+{
+	MPMC_DEFINE(ezmpmc, uint32_t, 4);
+
+	for (uint32_t i = 0; i < 10; i++) {
+		zassert_equal(mpmc_used(&ezmpmc), 0, "Queue should be empty");
+
+		for (uint32_t j = 0; j < mpmc_size(&ezmpmc); j++) {
+			uint32_t *entry = mpmc_acquire(&ezmpmc);
+
+			zassert_not_null(entry, "Acquire should succeed");
+			*entry = i * 4 + j;
+			mpmc_produce(&ezmpmc, entry);
+		}
+
+		zassert_is_null(mpmc_acquire(&ezmpmc), "Acquire should fail when full");
+		zassert_equal(mpmc_used(&ezmpmc), 4, "Queue should be full");
+
+		for (uint32_t j = 0; j < mpmc_size(&ezmpmc); j++) {
+			uint32_t *entry = mpmc_consume(&ezmpmc);
+
+			zassert_not_null(entry, "Consume should succeed");
+			zassert_equal(*entry, i * 4 + j, "Elements should be consumed in order");
+			mpmc_release(&ezmpmc, entry);
+		}
+
+		zassert_is_null(mpmc_consume(&ezmpmc), "Consume should fail when empty");
+	}
+}
+
+/*
+ * @brief A consumer must not skip over an element that is acquired but not
+ * yet produced.
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_consume_in_order)
+{
+	MPMC_DEFINE(ezmpmc, uint32_t, 4);
+
+	uint32_t *first = mpmc_acquire(&ezmpmc);
+	uint32_t *second = mpmc_acquire(&ezmpmc);
+
+	zassert_not_null(first);
+	zassert_not_null(second);
+
+	*second = 2;
+	mpmc_produce(&ezmpmc, second);
+
+	zassert_is_null(mpmc_consume(&ezmpmc), "Head of the queue is not produced yet");
+
+	*first = 1;
+	mpmc_produce(&ezmpmc, first);
+
+	zassert_equal(*mpmc_consume(&ezmpmc), 1);
+	zassert_equal(*mpmc_consume(&ezmpmc), 2);
+}
+
+#define MSGQ_MSGS 4
+#define MSGQ_ITERS 1000
+#define MSGQ_THREADS_NUM 2
+#define MSGQ_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct test_msg {
+	uint32_t seq;
+	uint16_t producer;
+};
+
+MPMC_MSGQ_DEFINE(test_msgq, sizeof(struct test_msg), MSGQ_MSGS);
+
+static K_THREAD_STACK_ARRAY_DEFINE(msgq_stack, MSGQ_THREADS_NUM, MSGQ_STACK_SIZE);
+static struct k_thread msgq_thread[MSGQ_THREADS_NUM];
+
+/*
+ * @brief Exercise the non-blocking and timeout paths of mpmc_msgq
+ *
+ * @see mpmc_msgq_put(), mpmc_msgq_get()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_msgq_no_wait)
+{
+	struct test_msg msg;
+
+	zassert_equal(mpmc_msgq_get(&test_msgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(mpmc_msgq_get(&test_msgq, &msg, K_MSEC(10)), -EAGAIN);
+
+	for (uint32_t i = 0; i < MSGQ_MSGS; i++) {
+		msg.seq = i;
+		zassert_ok(mpmc_msgq_put(&test_msgq, &msg, K_NO_WAIT));
+	}
+
+	zassert_equal(mpmc_msgq_num_used_get(&test_msgq), MSGQ_MSGS);
+	zassert_equal(mpmc_msgq_put(&test_msgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(mpmc_msgq_put(&test_msgq, &msg, K_MSEC(10)), -EAGAIN);
+
+	for (uint32_t i = 0; i < MSGQ_MSGS; i++) {
+		zassert_ok(mpmc_msgq_get(&test_msgq, &msg, K_NO_WAIT));
+		zassert_equal(msg.seq, i, "Messages should be received in order");
+	}
+
+	zassert_equal(mpmc_msgq_num_used_get(&test_msgq), 0);
+}
+
+static void msgq_producer(void *p1, void *p2, void *p3)
+{
+	struct test_msg msg = {
+		.producer = (uint16_t)(uintptr_t)p1,
+	};
+
+	for (uint32_t i = 0; i < MSGQ_ITERS; i++) {
+		msg.seq = i;
+		zassert_ok(mpmc_msgq_put(&test_msgq, &msg, K_FOREVER));
+	}
+}
+
+/*
+ * @brief Blocking producers and a blocking consumer on a small queue, so
+ * that both the full and the empty wait paths are taken.
+ *
+ * @see mpmc_msgq_put(), mpmc_msgq_get()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_msgq_blocking)
+{
+	uint32_t next[MSGQ_THREADS_NUM] = {0};
+	struct test_msg msg;
+
+	for (int i = 0; i < MSGQ_THREADS_NUM; i++) {
+		k_thread_create(&msgq_thread[i], msgq_stack[i], MSGQ_STACK_SIZE,
+				msgq_producer, (void *)(uintptr_t)i, NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+
+	for (uint32_t i = 0; i < MSGQ_ITERS * MSGQ_THREADS_NUM; i++) {
+		zassert_ok(mpmc_msgq_get(&test_msgq, &msg, K_FOREVER));
+		zassert_true(msg.producer < MSGQ_THREADS_NUM);
+		zassert_equal(msg.seq, next[msg.producer],
+			      "Messages of a producer should be received in order");
+		next[msg.producer]++;
+	}
+
+	for (int i = 0; i < MSGQ_THREADS_NUM; i++) {
+		k_thread_join(&msgq_thread[i], K_FOREVER);
+	}
+
+	zassert_equal(mpmc_msgq_num_used_get(&test_msgq), 0);
+}
+
+#define THROUGHPUT_ITERS 100000
+
+ZTEST(mpmc, test_mpmc_throughput)
+{
+	MPMC_DEFINE(tpmpmc, uint32_t, 8);
+	timing_t start_time, end_time;
+
+	timing_init();
+	timing_start();
+
+	start_time = timing_counter_get();
+
+	int key = irq_lock();
+
+	for (int i = 0; i < THROUGHPUT_ITERS; i++) {
+		uint32_t *entry = mpmc_acquire(&tpmpmc);
+
+		*entry = i;
+		mpmc_produce(&tpmpmc, entry);
+
+		entry = mpmc_consume(&tpmpmc);
+		mpmc_release(&tpmpmc, entry);
+	}
+
+	irq_unlock(key);
+
+	end_time = timing_counter_get();
+
+	uint64_t cycles = timing_cycles_get(&start_time, &end_time);
+	uint64_t ns = timing_cycles_to_ns(cycles);
+
+	TC_PRINT("%llu ns for %d iterations, %llu ns per op\n", ns,
+		 THROUGHPUT_ITERS, ns/THROUGHPUT_ITERS);
+}
+
+ZTEST_SUITE(mpmc, NULL, NULL, NULL, NULL, NULL);
@@ -78,6 +78,7 @@ static void var_destroy_aligned_small(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_VIEW_DEFINE(view_pool, 4, 0);
 
 /* Two pools, one with aligned to 8 bytes and one with aligned to 4 bytes
  * buffers. The aligned pools are used to test that the alignment works
@@ -492,6 +493,60 @@ ZTEST(net_buf_tests, test_net_buf_clone_no_ref_count)
 	zassert_equal(destroy_called, 2, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_slice)
+{
+	struct net_buf *buf, *frag, *view, *clone;
+	uint8_t data[2 * FIXED_BUFFER_SIZE];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	destroy_called = 0;
+
+	buf = net_buf_alloc(&fixed_pool, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffer");
+	net_buf_add_mem(buf, data, FIXED_BUFFER_SIZE);
+
+	frag = net_buf_alloc(&fixed_pool, K_NO_WAIT);
+	zassert_not_null(frag, "Failed to get fragment");
+	net_buf_add_mem(frag, &data[FIXED_BUFFER_SIZE], FIXED_BUFFER_SIZE);
+	net_buf_frag_add(buf, frag);
+
+	/* Range spanning both fragments */
+	view = net_buf_slice(&view_pool, buf, FIXED_BUFFER_SIZE - 2, 4, K_NO_WAIT);
+	zassert_not_null(view, "Failed to slice buffer");
+	zassert_equal(net_buf_frags_len(view), 4, "Incorrect view length");
+	zassert_equal_ptr(view->data, buf->data + FIXED_BUFFER_SIZE - 2,
+			  "View does not reference the original data");
+	zassert_not_null(view->frags, "View should span two fragments");
+	zassert_equal_ptr(view->frags->data, frag->data,
+			  "View does not reference the original data");
+	zassert_equal(net_buf_headroom(view), 0, "View should have no headroom");
+	zassert_equal(net_buf_tailroom(view), 0, "View should have no tailroom");
+
+	/* Ranges past the end of the chain are rejected */
+	zassert_is_null(net_buf_slice(&view_pool, buf, FIXED_BUFFER_SIZE, FIXED_BUFFER_SIZE + 1,
+				      K_NO_WAIT),
+			"Slice past the end of the chain");
+
+	clone = net_buf_clone(view, K_NO_WAIT);
+	zassert_not_null(clone, "Failed to clone view");
+	zassert_equal_ptr(clone->data, view->data, "Clone of a view should not copy");
+
+	/* The views keep the original payload alive */
+	net_buf_unref(buf);
+	zassert_equal(destroy_called, 0, "Buffer destroyed while referenced by a view");
+	zassert_mem_equal(view->data, &data[FIXED_BUFFER_SIZE - 2], 2);
+	zassert_mem_equal(view->frags->data, &data[FIXED_BUFFER_SIZE], 2);
+
+	net_buf_unref(view);
+	zassert_equal(destroy_called, 0, "Buffer destroyed while referenced by a clone");
+
+	net_buf_unref(clone);
+	zassert_equal(destroy_called, 2, "Incorrect destroy callback count");
+}
+
 /* Regression test: Zero sized buffers must be copy-able, not trigger a NULL pointer dereference */
 ZTEST(net_buf_tests, test_net_buf_clone_reference_counted_zero_sized_buffer)
 {
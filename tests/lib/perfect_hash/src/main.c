@@ -0,0 +1,51 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/perfect_hash.h>
+
+#include "test_perfect_hash.h"
+#include "test_perfect_hash_empty.h"
+
+/* Same order as src/keys.txt */
+static const char *const keys[] = {
+	"device", "devmem", "kernel", "log", "shell", "history", "resize", "retval",
+	"select", "help", "clear", "backends", "/api/v1/status", "/api/v1/config",
+	"/api/v1/firmware", "0/0/0", "3/0/0", "3/0/1", "3303/0/5700", "a", "ab", "abc",
+	"settings/bt/name", "settings/bt/id",
+};
+
+ZTEST(perfect_hash, test_lookup)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(keys); i++) {
+		zassert_equal(sys_perfect_hash_lookup_str(&test_perfect_hash, keys[i]), i,
+			      "wrong index for %s", keys[i]);
+	}
+}
+
+ZTEST(perfect_hash, test_lookup_not_nul_terminated)
+{
+	static const char key[] = "shellx";
+
+	zassert_equal(sys_perfect_hash_lookup(&test_perfect_hash, key, 5), 4);
+	zassert_equal(sys_perfect_hash_lookup(&test_perfect_hash, "abcd", 2), 20);
+}
+
+ZTEST(perfect_hash, test_lookup_missing)
+{
+	zassert_equal(sys_perfect_hash_lookup_str(&test_perfect_hash, ""), -ENOENT);
+	zassert_equal(sys_perfect_hash_lookup_str(&test_perfect_hash, "shel"), -ENOENT);
+	zassert_equal(sys_perfect_hash_lookup_str(&test_perfect_hash, "shells"), -ENOENT);
+	zassert_equal(sys_perfect_hash_lookup_str(&test_perfect_hash, "3/0/2"), -ENOENT);
+	zassert_equal(sys_perfect_hash_lookup_str(&test_perfect_hash, "Device"), -ENOENT);
+}
+
+ZTEST(perfect_hash, test_lookup_empty)
+{
+	zassert_equal(sys_perfect_hash_lookup_str(&test_perfect_hash_empty, "device"), -ENOENT);
+}
+
+ZTEST_SUITE(perfect_hash, NULL, NULL, NULL, NULL, NULL);
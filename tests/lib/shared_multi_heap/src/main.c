@@ -212,6 +212,25 @@ ZTEST(shared_multi_heap, test_shared_multi_heap)
 	/* Request a non-existent attribute */
 	block = shared_multi_heap_alloc(MAX_SHARED_MULTI_HEAP_ATTR, 0x100);
 	zassert_is_null(block, "wrong attribute accepted as valid");
+
+	/*
+	 * No external region is registered, so a preference list starting
+	 * with it must fall back to the non-cacheable region RES1
+	 */
+	static const enum shared_multi_heap_attr prefer[] = {
+		SMH_REG_ATTR_EXTERNAL,
+		SMH_REG_ATTR_NON_CACHEABLE,
+	};
+
+	block = shared_multi_heap_aligned_alloc_prefer(prefer, ARRAY_SIZE(prefer), 0, 0x100);
+	reg_map = get_region_map(block);
+
+	zassert_equal(reg_map->p_addr, RES1_NOCACHE_ADDR, "block in the wrong memory region");
+	zassert_equal(reg_map->region.attr, SMH_REG_ATTR_NON_CACHEABLE, "wrong memory attribute");
+	shared_multi_heap_free(block);
+
+	block = shared_multi_heap_aligned_alloc_prefer(prefer, ARRAY_SIZE(prefer), 0, 0x10000);
+	zassert_is_null(block, "allocated buffer too big for any region");
 }
 
 ZTEST_SUITE(shared_multi_heap, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,122 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/hist.h>
+#include <zephyr/ztest.h>
+
+#define SUB_BITS 3
+#define MAX_BITS 20
+
+SYS_HIST_DEFINE(test_hist, SUB_BITS, MAX_BITS);
+SYS_HIST_DEFINE(test_hist_other, SUB_BITS, MAX_BITS);
+
+static void sys_hist_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sys_hist_reset(&test_hist);
+	sys_hist_reset(&test_hist_other);
+}
+
+ZTEST(sys_hist, test_bucket_bounds)
+{
+	const struct sys_hist_layout *layout = &test_hist.layout;
+	uint32_t prev = 0;
+
+	zassert_equal(layout->num_buckets, SYS_HIST_NUM_BUCKETS(SUB_BITS, MAX_BITS));
+
+	for (uint32_t i = 0; i < layout->num_buckets - 1; i++) {
+		uint32_t max = sys_hist_bucket_max(layout, i);
+
+		zassert_equal(sys_hist_bucket_get(layout, max), i, "bucket %u", i);
+		if (i > 0) {
+			zassert_true(max > prev, "bucket %u", i);
+			zassert_equal(sys_hist_bucket_get(layout, prev + 1), i, "bucket %u", i);
+		}
+		prev = max;
+	}
+
+	zassert_equal(sys_hist_bucket_get(layout, BIT(MAX_BITS)), layout->num_buckets - 1);
+	zassert_equal(sys_hist_bucket_get(layout, UINT32_MAX), layout->num_buckets - 1);
+	zassert_equal(sys_hist_bucket_max(layout, layout->num_buckets - 1), UINT32_MAX);
+}
+
+ZTEST(sys_hist, test_relative_error)
+{
+	const struct sys_hist_layout *layout = &test_hist.layout;
+
+	for (uint32_t value = 1; value < BIT(MAX_BITS); value = (value * 3) / 2 + 1) {
+		uint32_t max = sys_hist_bucket_max(layout, sys_hist_bucket_get(layout, value));
+
+		zassert_true(max >= value);
+		zassert_true((max - value) <= (value >> SUB_BITS), "value %u max %u", value, max);
+	}
+}
+
+ZTEST(sys_hist, test_percentile)
+{
+	SYS_HIST_SNAPSHOT_DEFINE(snap, SUB_BITS, MAX_BITS);
+
+	for (uint32_t i = 1; i <= 1000; i++) {
+		sys_hist_record(&test_hist, i);
+	}
+
+	zassert_ok(sys_hist_snapshot(&test_hist, &snap));
+	zassert_equal(snap.count, 1000);
+
+	zassert_within(sys_hist_percentile(&snap, 500000), 500, 500 >> SUB_BITS);
+	zassert_within(sys_hist_percentile(&snap, 990000), 990, 990 >> SUB_BITS);
+	zassert_equal(sys_hist_percentile(&snap, 1000000),
+		      sys_hist_bucket_max(&snap.layout, sys_hist_bucket_get(&snap.layout, 1000)));
+}
+
+ZTEST(sys_hist, test_merge)
+{
+	SYS_HIST_SNAPSHOT_DEFINE(snap, SUB_BITS, MAX_BITS);
+	SYS_HIST_SNAPSHOT_DEFINE(other, SUB_BITS, MAX_BITS);
+	SYS_HIST_SNAPSHOT_DEFINE(coarse, 2, MAX_BITS);
+
+	for (uint32_t i = 0; i < 100; i++) {
+		sys_hist_record(&test_hist, 10);
+		sys_hist_record(&test_hist_other, 100000);
+	}
+
+	zassert_ok(sys_hist_snapshot(&test_hist, &snap));
+	zassert_ok(sys_hist_snapshot(&test_hist_other, &other));
+	zassert_ok(sys_hist_merge(&snap, &other));
+
+	zassert_equal(snap.count, 200);
+	zassert_equal(sys_hist_percentile(&snap, 500000), 10);
+	zassert_true(sys_hist_percentile(&snap, 510000) >= 100000);
+
+	zassert_equal(sys_hist_snapshot(&test_hist, &coarse), -EINVAL);
+	zassert_equal(sys_hist_merge(&snap, &coarse), -EINVAL);
+}
+
+ZTEST(sys_hist, test_reset)
+{
+	SYS_HIST_SNAPSHOT_DEFINE(snap, SUB_BITS, MAX_BITS);
+
+	sys_hist_record(&test_hist, 42);
+	zassert_equal(sys_hist_bucket_count(&test_hist,
+					    sys_hist_bucket_get(&test_hist.layout, 42)), 1);
+
+	sys_hist_reset(&test_hist);
+
+	zassert_ok(sys_hist_snapshot(&test_hist, &snap));
+	zassert_equal(snap.count, 0);
+	zassert_equal(sys_hist_percentile(&snap, 500000), 0);
+}
+
+ZTEST(sys_hist, test_find)
+{
+	zassert_equal_ptr(sys_hist_find("test_hist"), &test_hist);
+	zassert_equal_ptr(sys_hist_find("test_hist_other"), &test_hist_other);
+	zassert_is_null(sys_hist_find("missing"));
+}
+
+ZTEST_SUITE(sys_hist, NULL, NULL, sys_hist_before, NULL, NULL);
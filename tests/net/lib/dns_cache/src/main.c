@@ -267,3 +267,71 @@ ZTEST(net_dns_cache_test, test_remove_null_parameters)
 	zassert_equal(-EINVAL, dns_cache_remove(&test_dns_cache, NULL),
 		      "NULL query should return error.");
 }
+
+ZTEST(net_dns_cache_test, test_negative_entry)
+{
+	struct dns_addrinfo info_write = {.ai_family = NET_AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_A,
+					  TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Negative cache entry adding should work.");
+	zassert_equal(-ENOENT,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_equal(0,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA, &info_read, 1));
+
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_equal(NET_AF_INET, info_read.ai_family);
+
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_A,
+					  TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Negative cache entry adding should work.");
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1),
+		      "Negative entry should not hide a positive one.");
+}
+
+ZTEST(net_dns_cache_test, test_negative_entry_expired)
+{
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA,
+					  TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Negative cache entry adding should work.");
+	zassert_equal(-ENOENT,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA, &info_read, 1));
+	k_sleep(K_MSEC(TEST_DNS_CACHE_DEFAULT_TTL * 1000 + 1));
+	zassert_equal(0,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA, &info_read, 1));
+	zassert_equal(-EINVAL, dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_PTR,
+						      TEST_DNS_CACHE_DEFAULT_TTL));
+}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE_PREFETCH)
+ZTEST(net_dns_cache_test, test_prefetch_due)
+{
+	struct dns_addrinfo info_write = {.ai_family = NET_AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_false(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+
+	k_sleep(K_MSEC(TEST_DNS_CACHE_DEFAULT_TTL * 1000 -
+		       TEST_DNS_CACHE_DEFAULT_TTL * 10 *
+		       CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT / 2));
+	zassert_true(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+	zassert_false(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A),
+		      "Prefetch should be requested once only.");
+
+	/* The answer to the prefetch refreshes the entry */
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_PREFETCH */
@@ -94,6 +94,7 @@ struct test_ctx {
 	uint16_t status;
 	bool abort;
 	bool final;
+	bool keep_alive;
 };
 
 static int response_cb(struct http_response *rsp,
@@ -116,6 +117,7 @@ static int response_cb(struct http_response *rsp,
 	if (final_data == HTTP_DATA_FINAL) {
 		ctx->final = true;
 		ctx->status = rsp->http_status_code;
+		ctx->keep_alive = rsp->keep_alive;
 	}
 
 	/* Copy response body */
@@ -360,6 +362,42 @@ ZTEST(http_client, test_http1_client_post_payload_cb)
 			  "Invalid payload uploaded %d", dynamic_len);
 }
 
+ZTEST(http_client, test_http1_client_keep_alive)
+{
+	struct http_request req = { 0 };
+	struct test_ctx ctx = { 0 };
+	int ret;
+
+	common_request_init(&req);
+	req.method = HTTP_POST;
+	req.url = "/dynamic";
+	req.payload = LOREM_IPSUM_SHORT;
+	req.payload_len = LOREM_IPSUM_SHORT_STRLEN;
+
+	ret = http_client_req(client_fd, &req, -1, &ctx);
+	zassert_true(ret > 0, "http_client_req() failed (%d)", ret);
+	zassert_true(ctx.final, "No final event received");
+	zassert_equal(ctx.status, 200, "Unexpected HTTP status code");
+	zassert_true(ctx.keep_alive, "Connection cannot be kept alive");
+
+	/* Reuse the same connection for another request */
+	memset(&req, 0, sizeof(req));
+	memset(&ctx, 0, sizeof(ctx));
+	common_request_init(&req);
+	req.method = HTTP_GET;
+	req.url = "/dynamic";
+
+	ctx.buf = response_buf;
+	ctx.buflen = sizeof(response_buf);
+
+	ret = http_client_req(client_fd, &req, -1, &ctx);
+	zassert_true(ret > 0, "http_client_req() failed (%d)", ret);
+	zassert_true(ctx.final, "No final event received");
+	zassert_equal(ctx.status, 200, "Unexpected HTTP status code");
+	zassert_equal(ctx.offset, LOREM_IPSUM_SHORT_STRLEN, "Invalid payload length");
+	zassert_mem_equal(response_buf, LOREM_IPSUM_SHORT, ctx.offset, "Invalid payload");
+}
+
 static void client_tests_before(void *fixture)
 {
 	struct net_sockaddr_in6 sa;
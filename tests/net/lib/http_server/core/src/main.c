@@ -26,6 +26,12 @@
 #define TEST_DYNAMIC_POST_PAYLOAD "Test dynamic POST"
 #define TEST_DYNAMIC_GET_PAYLOAD "Test dynamic GET"
 #define TEST_STATIC_PAYLOAD "Hello, World!"
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+#define TEST_STATIC_ETAG "\"ec4ac3d0\""
+#define TEST_STATIC_ETAG_HEADER "ETag: " TEST_STATIC_ETAG "\r\n"
+#else
+#define TEST_STATIC_ETAG_HEADER ""
+#endif
 #define TEST_STATIC_FS_PAYLOAD "Hello, World from static file!"
 
 /* Random base64 encoded data */
@@ -796,6 +802,51 @@ ZTEST(server_function_tests, test_http2_static_get)
 				HTTP2_FLAG_END_STREAM);
 }
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL)
+ZTEST(server_function_tests, test_http2_static_get_flow_control)
+{
+	static const uint8_t request_get_static_small_window[] = {
+		TEST_HTTP2_MAGIC,
+		/* Settings with an initial window size of 5 bytes */
+		0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+		TEST_HTTP2_SETTINGS_ACK,
+		TEST_HTTP2_HEADERS_GET_ROOT_STREAM_1,
+	};
+	static const uint8_t request_window_update[] = {
+		0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, TEST_STREAM_ID_1,
+		0x00, 0x00, 0x00, 0x64,
+	};
+	static const uint8_t request_goaway[] = {
+		TEST_HTTP2_GOAWAY,
+	};
+	size_t offset = 0;
+	int ret;
+
+	ret = zsock_send(client_fd, request_get_static_small_window,
+			 sizeof(request_get_static_small_window), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	memset(buf, 0, sizeof(buf));
+
+	expect_http2_settings_frame(&offset, false);
+	expect_http2_settings_frame(&offset, true);
+	expect_http2_headers_frame(&offset, TEST_STREAM_ID_1, HTTP2_FLAG_END_HEADERS, NULL, 0);
+
+	/* Only the stream window is sent until the window is updated */
+	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, TEST_STATIC_PAYLOAD, 5, 0);
+
+	ret = zsock_send(client_fd, request_window_update, sizeof(request_window_update), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, TEST_STATIC_PAYLOAD + 5,
+				strlen(TEST_STATIC_PAYLOAD) - 5, HTTP2_FLAG_END_STREAM);
+
+	ret = zsock_send(client_fd, request_goaway, sizeof(request_goaway), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+}
+#endif /* CONFIG_HTTP_SERVER_HTTP2_FLOW_CONTROL */
+
 ZTEST(server_function_tests, test_http1_static_upgrade_get)
 {
 	static const char http1_request[] =
@@ -839,6 +890,7 @@ ZTEST(server_function_tests, test_http1_static_get)
 		"HTTP/1.1 200 OK\r\n"
 		"Content-Type: text/html\r\n"
 		"Content-Length: 13\r\n"
+		TEST_STATIC_ETAG_HEADER
 		"\r\n"
 		TEST_STATIC_PAYLOAD;
 	size_t offset = 0;
@@ -854,6 +906,32 @@ ZTEST(server_function_tests, test_http1_static_get)
 			  "Received data doesn't match expected response");
 }
 
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+ZTEST(server_function_tests, test_http1_static_get_not_modified)
+{
+	static const char http1_request[] =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1:8080\r\n"
+		"If-None-Match: W/" TEST_STATIC_ETAG "\r\n"
+		"\r\n";
+	static const char expected_response[] =
+		"HTTP/1.1 304 Not Modified\r\n"
+		TEST_STATIC_ETAG_HEADER
+		"\r\n";
+	size_t offset = 0;
+	int ret;
+
+	ret = zsock_send(client_fd, http1_request, strlen(http1_request), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	memset(buf, 0, sizeof(buf));
+
+	test_read_data(&offset, sizeof(expected_response) - 1);
+	zassert_mem_equal(buf, expected_response, sizeof(expected_response) - 1,
+			  "Received data doesn't match expected response");
+}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
 /* Common code to verify POST/PUT/PATCH */
 static void common_verify_http2_dynamic_post_request(const uint8_t *request,
 						     size_t request_len)
@@ -1232,6 +1310,7 @@ ZTEST(server_function_tests, test_http1_connection_close)
 		"HTTP/1.1 200 OK\r\n"
 		"Content-Type: text/html\r\n"
 		"Content-Length: 13\r\n"
+		TEST_STATIC_ETAG_HEADER
 		"\r\n"
 		TEST_STATIC_PAYLOAD;
 	size_t offset = 0;
@@ -2872,6 +2951,7 @@ ZTEST(server_function_tests, test_http1_static_fs_overlap)
 		"HTTP/1.1 200 OK\r\n"
 		"Content-Type: text/html\r\n"
 		"Content-Length: 13\r\n"
+		TEST_STATIC_ETAG_HEADER
 		"\r\n"
 		TEST_STATIC_PAYLOAD;
 	size_t offset = 0;
@@ -494,4 +494,135 @@ ZTEST(http2_hpack, test_http2_hpack_literal_not_indexed_decode)
 				 ARRAY_SIZE(test_enc_literal_not_indexed_headers));
 }
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+/* Responses from RFC7541 C.6, with a 256 bytes table. The table size is
+ * signalled at the start of the first header block. ":status: 307" is not
+ * Huffman encoded as it would not be any shorter.
+ */
+static const struct example_headers test_dynamic_headers_resp1[] = {
+	{ ":status", "302",
+	  { 0x3f, 0xe1, 0x01, 0x48, 0x82, 0x64, 0x02, 0x58 },
+	  8 },
+	{ "cache-control", "private",
+	  { 0x58, 0x85, 0xae, 0xc3, 0x77, 0x1a, 0x4b },
+	  7 },
+	{ "date", "Mon, 21 Oct 2013 20:13:21 GMT",
+	  { 0x61, 0x96, 0xd0, 0x7a, 0xbe, 0x94, 0x10, 0x54,
+	    0xd4, 0x44, 0xa8, 0x20, 0x05, 0x95, 0x04, 0x0b,
+	    0x81, 0x66, 0xe0, 0x82, 0xa6, 0x2d, 0x1b, 0xff },
+	  24 },
+	{ "location", "https://www.example.com",
+	  { 0x6e, 0x91, 0x9d, 0x29, 0xad, 0x17, 0x18, 0x63,
+	    0xc7, 0x8f, 0x0b, 0x97, 0xc8, 0xe9, 0xae, 0x82,
+	    0xae, 0x43, 0xd3 },
+	  19 },
+};
+
+static const struct example_headers test_dynamic_headers_resp2[] = {
+	{ ":status", "307",
+	  { 0x48, 0x03, 0x33, 0x30, 0x37 },
+	  5 },
+	{ "cache-control", "private",
+	  { 0xc1 },
+	  1 },
+	{ "date", "Mon, 21 Oct 2013 20:13:21 GMT",
+	  { 0xc0 },
+	  1 },
+	{ "location", "https://www.example.com",
+	  { 0xbf },
+	  1 },
+};
+
+static const struct example_headers test_dynamic_headers_resp3[] = {
+	{ ":status", "200",
+	  { 0x88 },
+	  1 },
+	{ "cache-control", "private",
+	  { 0xc1 },
+	  1 },
+	{ "date", "Mon, 21 Oct 2013 20:13:22 GMT",
+	  { 0x61, 0x96, 0xd0, 0x7a, 0xbe, 0x94, 0x10, 0x54,
+	    0xd4, 0x44, 0xa8, 0x20, 0x05, 0x95, 0x04, 0x0b,
+	    0x81, 0x66, 0xe0, 0x84, 0xa6, 0x2d, 0x1b, 0xff },
+	  24 },
+	{ "location", "https://www.example.com",
+	  { 0xc0 },
+	  1 },
+	{ "content-encoding", "gzip",
+	  { 0x5a, 0x83, 0x9b, 0xd9, 0xab },
+	  5 },
+	{ "set-cookie", "foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1",
+	  { 0x77, 0xad, 0x94, 0xe7, 0x82, 0x1d, 0xd7, 0xf2,
+	    0xe6, 0xc7, 0xb3, 0x35, 0xdf, 0xdf, 0xcd, 0x5b,
+	    0x39, 0x60, 0xd5, 0xaf, 0x27, 0x08, 0x7f, 0x36,
+	    0x72, 0xc1, 0xab, 0x27, 0x0f, 0xb5, 0x29, 0x1f,
+	    0x95, 0x87, 0x31, 0x60, 0x65, 0xc0, 0x03, 0xed,
+	    0x4e, 0xe5, 0xb1, 0x06, 0x3d, 0x50, 0x07 },
+	  47 },
+};
+
+static void test_hpack_verify_encode_table(struct http_hpack_table *table,
+					   const struct example_headers *example,
+					   size_t num_examples, size_t table_size)
+{
+	for (int i = 0; i < num_examples; i++) {
+		struct http_hpack_header_buf hdr = {
+			.name = example[i].name,
+			.value = example[i].value,
+			.name_len = strlen(example[i].name),
+			.value_len = strlen(example[i].value)
+		};
+		int ret;
+
+		ret = http_hpack_encode_header_table(table, test_buf, sizeof(test_buf), &hdr);
+		zassert_equal(ret, example[i].encoded_len, "Wrong encoding length");
+		zassert_mem_equal(test_buf, example[i].encoded, ret,
+				  "Header wrongly encoded");
+	}
+
+	zassert_equal(table->size, table_size, "Wrong dynamic table size");
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_encode)
+{
+	struct http_hpack_table table;
+
+	http_hpack_table_init(&table, 256);
+
+	test_hpack_verify_encode_table(&table, test_dynamic_headers_resp1,
+				       ARRAY_SIZE(test_dynamic_headers_resp1), 222);
+	test_hpack_verify_encode_table(&table, test_dynamic_headers_resp2,
+				       ARRAY_SIZE(test_dynamic_headers_resp2), 222);
+	test_hpack_verify_encode_table(&table, test_dynamic_headers_resp3,
+				       ARRAY_SIZE(test_dynamic_headers_resp3), 215);
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_size_update)
+{
+	struct http_hpack_table table;
+	struct http_hpack_header_buf hdr = {
+		.name = "custom-key",
+		.value = "custom-header",
+		.name_len = sizeof("custom-key") - 1,
+		.value_len = sizeof("custom-header") - 1,
+	};
+	int ret;
+
+	http_hpack_table_init(&table, 256);
+
+	ret = http_hpack_encode_header_table(&table, test_buf, sizeof(test_buf), &hdr);
+	zassert_true(ret > 0, "Failed to encode header");
+	zassert_equal(table.count, 1, "Header not added to the table");
+
+	/* Shrinking the table evicts the entry and is signalled in the next block */
+	http_hpack_table_set_max_size(&table, 0);
+	zassert_equal(table.count, 0, "Entry not evicted");
+
+	ret = http_hpack_encode_header_table(&table, test_buf, sizeof(test_buf), &hdr);
+	zassert_true(ret > 1, "Failed to encode header");
+	zassert_equal(test_buf[0], 0x20, "Missing table size update");
+	zassert_equal(table.count, 0, "Header added to a zero size table");
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
 ZTEST_SUITE(http2_hpack, NULL, NULL, NULL, NULL, NULL);
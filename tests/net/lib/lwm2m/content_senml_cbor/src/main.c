@@ -1078,6 +1078,46 @@ ZTEST(net_content_senml_cbor, test_put_composite_res_inst)
 			  expected_payload.len, "Invalid payload format");
 }
 
+ZTEST(net_content_senml_cbor, test_put_composite_basename)
+{
+	int ret;
+	struct lwm2m_obj_path_list lwm2m_obj_path_list_buf[2];
+	sys_slist_t lwm2m_path_list;
+	sys_slist_t lwm2m_path_free_list;
+	struct lwm2m_obj_path path = LWM2M_OBJ(TEST_OBJ_ID, TEST_OBJ_INST_ID, TEST_RES_S16);
+
+	/* The basename is only sent with the first record */
+	struct test_payload_buffer expected_payload = {
+		.data = {
+			0x82,
+			0xA3,
+			0x21, 0x69, '/', '6', '5', '5', '3', '5', '/', '0', '/',
+			0x00, 0x61, '0',
+			0x02, 0x01,
+			0xA2,
+			0x00, 0x61, '1',
+			0x02, 0x02
+		},
+		.len = 23
+	};
+
+	test_s8 = 1;
+	test_s16 = 2;
+	test_msg.path.res_id = TEST_RES_S8;
+
+	lwm2m_engine_path_list_init(&lwm2m_path_list, &lwm2m_path_free_list,
+				    lwm2m_obj_path_list_buf, 2);
+
+	lwm2m_engine_add_path_to_list(&lwm2m_path_list, &lwm2m_path_free_list, &test_msg.path);
+	lwm2m_engine_add_path_to_list(&lwm2m_path_list, &lwm2m_path_free_list, &path);
+
+	ret = do_send_op_senml_cbor(&test_msg, &lwm2m_path_list);
+	zassert_true(ret >= 0, "Error reported");
+
+	zassert_mem_equal(test_msg.msg_data + TEST_PAYLOAD_OFFSET, expected_payload.data,
+			  expected_payload.len, "Invalid payload format");
+}
+
 ZTEST(net_content_senml_cbor, test_get_s32)
 {
 	int ret;
@@ -818,6 +818,88 @@ ZTEST(mqtt_client, test_mqtt_pubsub_long)
 	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
 }
 
+static void publish_param_init(struct mqtt_publish_param *param, enum mqtt_qos qos,
+			       uint16_t message_id)
+{
+	memset(param, 0, sizeof(*param));
+
+	param->message.topic.qos = qos;
+	param->message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
+	param->message.topic.topic.size = strlen(param->message.topic.topic.utf8);
+	param->message.payload.data = (uint8_t *)test_ctx.payload;
+	param->message.payload.len = strlen(test_ctx.payload);
+	param->message_id = message_id;
+}
+
+ZTEST(mqtt_client, test_mqtt_publish_batch)
+{
+	struct mqtt_publish_param params[3];
+	int ret;
+
+	test_ctx.payload = payload_short;
+
+	test_connect();
+
+	ARRAY_FOR_EACH(params, i) {
+		publish_param_init(&params[i], MQTT_QOS_0_AT_MOST_ONCE, 0);
+	}
+
+	ret = mqtt_publish_batch(&client_ctx, params, ARRAY_SIZE(params));
+	zassert_equal(ret, ARRAY_SIZE(params), "MQTT client failed to publish (%d)", ret);
+
+	ARRAY_FOR_EACH(params, i) {
+		broker_process(MQTT_PKT_TYPE_PUBLISH);
+	}
+
+	test_disconnect();
+}
+
+#if defined(CONFIG_MQTT_INFLIGHT_TRACKING)
+ZTEST(mqtt_client, test_mqtt_publish_inflight_window)
+{
+	struct mqtt_publish_param param;
+	int ret;
+
+	BUILD_ASSERT(CONFIG_MQTT_INFLIGHT_MAX == 1);
+
+	test_ctx.payload = payload_short;
+	while (test_ctx.msg_id == 0) {
+		test_ctx.msg_id = sys_rand16_get();
+	}
+
+	test_connect();
+
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, test_ctx.msg_id);
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	/* The window is full until the PUBACK is processed. */
+	param.message_id = test_ctx.msg_id + 1;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_equal(ret, -EAGAIN, "Publish should not fit in the window (%d)", ret);
+
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	client_wait(false);
+	ret = mqtt_input(&client_ctx);
+	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+
+	test_ctx.puback_handled = false;
+
+	param.message_id = test_ctx.msg_id;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	client_wait(false);
+	ret = mqtt_input(&client_ctx);
+	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+
+	test_disconnect();
+}
+#endif /* CONFIG_MQTT_INFLIGHT_TRACKING */
+
 static void mqtt_tests_before(void *fixture)
 {
 	ARG_UNUSED(fixture);
@@ -544,6 +544,90 @@ static void test_route_preference(void)
 	net_route_del(route_entry);
 }
 
+static struct net_route_entry *add_prefix_route(struct net_in6_addr *prefix,
+						uint8_t prefix_len,
+						struct net_in6_addr *nexthop)
+{
+	struct net_route_entry *entry;
+
+	entry = net_route_add(my_iface, prefix, prefix_len, nexthop,
+			      NET_IPV6_ND_INFINITE_LIFETIME,
+			      NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(entry, "Route add failed");
+
+	return entry;
+}
+
+static void test_route_longest_prefix_match(void)
+{
+	struct net_in6_addr in_prefix64 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+						0, 0, 0, 0, 0x1, 0x2, 0x3, 0x4 } } };
+	struct net_in6_addr in_prefix112 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+						 0, 0, 0, 0, 0xd, 0xe, 0x9, 0x9 } } };
+	struct net_in6_addr outside = { { { 0x20, 0x01, 0x0d, 0xb9, 0, 0, 0, 0,
+					    0, 0, 0, 0, 0xd, 0xe, 0x5, 0x7 } } };
+	struct net_route_entry *route64, *route112, *route_generic;
+
+	route64 = add_prefix_route(&dest_addr, 64, &peer_addr);
+	route112 = add_prefix_route(&dest_addr, 112, &peer_addr_alt);
+	route_generic = add_prefix_route(&generic_addr, 100, &peer_addr);
+
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), route112,
+			  "Longest prefix not matched");
+	zassert_equal_ptr(net_route_lookup(my_iface, &in_prefix112), route112,
+			  "Longest prefix not matched");
+	zassert_equal_ptr(net_route_lookup(my_iface, &in_prefix64), route64,
+			  "Shorter prefix not matched");
+	zassert_equal_ptr(net_route_lookup(my_iface, &generic_addr), route_generic,
+			  "Generic prefix not matched");
+	zassert_is_null(net_route_lookup(my_iface, &outside),
+			"Address outside of the prefixes matched");
+
+	zassert_ok(net_route_del(route112));
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), route64,
+			  "Shorter prefix not matched after delete");
+
+	zassert_ok(net_route_del(route64));
+	zassert_is_null(net_route_lookup(my_iface, &dest_addr),
+			"Deleted prefix matched");
+	zassert_equal_ptr(net_route_lookup(my_iface, &generic_addr), route_generic,
+			  "Generic prefix not matched after delete");
+
+	zassert_ok(net_route_del(route_generic));
+}
+
+static void test_route_get_info(void)
+{
+	struct net_route_entry *route64, *route112, *route;
+	struct net_in6_addr *nexthop;
+
+	zassert_true(net_route_get_info(my_iface, &peer_addr, &route, &nexthop));
+	zassert_is_null(route, "Neighbor reached through a route");
+	zassert_equal_ptr(nexthop, &peer_addr, "Neighbor is not its own nexthop");
+
+	route64 = add_prefix_route(&dest_addr, 64, &peer_addr);
+
+	/* The second lookup is served from the destination cache if enabled */
+	for (int i = 0; i < 2; i++) {
+		zassert_true(net_route_get_info(my_iface, &dest_addr, &route, &nexthop));
+		zassert_equal_ptr(route, route64, "Wrong route");
+		zassert_true(net_ipv6_addr_cmp(nexthop, &peer_addr), "Wrong nexthop");
+	}
+
+	route112 = add_prefix_route(&dest_addr, 112, &peer_addr_alt);
+
+	zassert_true(net_route_get_info(my_iface, &dest_addr, &route, &nexthop));
+	zassert_equal_ptr(route, route112, "Added route not used");
+	zassert_true(net_ipv6_addr_cmp(nexthop, &peer_addr_alt), "Wrong nexthop");
+
+	zassert_ok(net_route_del(route112));
+
+	zassert_true(net_route_get_info(my_iface, &dest_addr, &route, &nexthop));
+	zassert_equal_ptr(route, route64, "Deleted route still used");
+	zassert_true(net_ipv6_addr_cmp(nexthop, &peer_addr), "Wrong nexthop");
+
+	zassert_ok(net_route_del(route64));
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +650,8 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix_match();
+	test_route_get_info();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
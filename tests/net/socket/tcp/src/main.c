@@ -2542,6 +2542,63 @@ ZTEST(net_socket_tcp, test_so_keepalive_opt)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion_opt)
+{
+	struct net_sockaddr_in bind_addr4;
+	char name[16];
+	net_socklen_t optlen = sizeof(name);
+	const char *expected = "reno";
+	int sock, ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+		ztest_test_skip();
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CC_DEFAULT_CUBIC)) {
+		expected = "cubic";
+	} else if (IS_ENABLED(CONFIG_NET_TCP_CC_DEFAULT_BBR)) {
+		expected = "bbr";
+	}
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	ret = zsock_getsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, expected, "unexpected default algorithm %s", name);
+	zassert_equal(optlen, strlen(expected) + 1, "getsockopt got invalid size");
+
+	ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, "vegas", 5);
+	zassert_equal(ret, -1, "setsockopt accepted an unknown algorithm");
+	zassert_equal(errno, ENOENT, "unexpected errno (%d)", errno);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CC_CUBIC)) {
+		ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, "cubic", 5);
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = zsock_getsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, name,
+				       &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_str_equal(name, "cubic", "algorithm not changed");
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CC_BBR)) {
+		ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, "bbr",
+				       sizeof("bbr"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = zsock_getsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, name,
+				       &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_str_equal(name, "bbr", "algorithm not changed");
+	}
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 static void test_prepare_keepalive_socks(int *c_sock, int *s_sock, int *new_sock)
 {
 	struct net_sockaddr_in c_saddr, s_saddr;
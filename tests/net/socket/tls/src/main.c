@@ -1220,6 +1220,45 @@ ZTEST(net_socket_tls, test_recv_eof_on_close)
 	k_sleep(TCP_TEARDOWN_TIMEOUT);
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_RECORD_CORK)
+ZTEST(net_socket_tls, test_record_cork)
+{
+	int ret;
+	int optval = 1;
+	uint8_t rx_buf[2 * (sizeof(TEST_STR_SMALL) - 1)] = { 0 };
+
+	test_prepare_tls_connection(NET_AF_INET6);
+
+	ret = zsock_setsockopt(c_sock, ZSOCK_SOL_TLS, ZSOCK_TLS_RECORD_CORK,
+			       &optval, sizeof(optval));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	/* Nothing is sent while corked. */
+	k_sleep(K_MSEC(10));
+	ret = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(ret, -1, "zsock_recv() should've failed");
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+
+	optval = 0;
+	ret = zsock_setsockopt(c_sock, ZSOCK_SOL_TLS, ZSOCK_TLS_RECORD_CORK,
+			       &optval, sizeof(optval));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	/* Both writes arrive in a single record. */
+	ret = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(ret, sizeof(rx_buf), "zsock_recv() failed");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL TEST_STR_SMALL, ret,
+			  "Invalid data received");
+
+	test_sockets_close();
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_RECORD_CORK */
+
 #define TLS_RECORD_OVERHEAD 81
 
 ZTEST(net_socket_tls, test_send_non_block)
@@ -15,6 +15,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 
 #include <zephyr/net/socket.h>
 #include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_mgmt.h>
 #include <zephyr/net/net_event.h>
 
@@ -1424,6 +1425,131 @@ ZTEST_USER(net_socket_udp, test_recvmsg_invalid)
 	zassert_true(ret < 0, "recvmsg() succeed");
 }
 
+#define MMSG_COUNT 3
+
+static ZTEST_BMEM char mmsg_rx_buf[MMSG_COUNT + 1][sizeof(TEST_STR_SMALL)];
+static ZTEST_BMEM struct net_iovec mmsg_iov[MMSG_COUNT + 1];
+static ZTEST_BMEM struct net_mmsghdr mmsg[MMSG_COUNT + 1];
+
+ZTEST_USER(net_socket_udp, test_v4_sendmmsg_recvmmsg)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct net_sockaddr_in client_addr;
+	struct net_sockaddr_in server_addr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct net_sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	memset(mmsg, 0, sizeof(mmsg));
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		mmsg_iov[i].iov_base = TEST_STR_SMALL;
+		mmsg_iov[i].iov_len = STRLEN(TEST_STR_SMALL) - i;
+		mmsg[i].msg_hdr.msg_iov = &mmsg_iov[i];
+		mmsg[i].msg_hdr.msg_iovlen = 1;
+		mmsg[i].msg_hdr.msg_name = &server_addr;
+		mmsg[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = zsock_sendmmsg(client_sock, mmsg, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", -errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(mmsg[i].msg_len, STRLEN(TEST_STR_SMALL) - i,
+			      "invalid length of message %d", i);
+	}
+
+	k_msleep(100);
+
+	/* Only the first message could block, the last slot stays unused */
+	memset(mmsg, 0, sizeof(mmsg));
+	for (int i = 0; i < ARRAY_SIZE(mmsg); i++) {
+		mmsg_iov[i].iov_base = mmsg_rx_buf[i];
+		mmsg_iov[i].iov_len = sizeof(mmsg_rx_buf[i]);
+		mmsg[i].msg_hdr.msg_iov = &mmsg_iov[i];
+		mmsg[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_recvmmsg(server_sock, mmsg, ARRAY_SIZE(mmsg), ZSOCK_MSG_WAITFORONE);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed (%d)", rv < 0 ? -errno : rv);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(mmsg[i].msg_len, STRLEN(TEST_STR_SMALL) - i,
+			      "invalid length of message %d", i);
+		zassert_mem_equal(mmsg_rx_buf[i], TEST_STR_SMALL, mmsg[i].msg_len,
+				  "invalid data in message %d", i);
+	}
+
+	rv = zsock_recvmmsg(server_sock, mmsg, ARRAY_SIZE(mmsg), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recvmmsg on empty queue succeeded");
+	zassert_equal(errno, EAGAIN, "unexpected errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_v4_sendto_recvfrom_buf)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct net_sockaddr_in client_addr;
+	struct net_sockaddr_in server_addr;
+	struct net_sockaddr_in addr;
+	net_socklen_t addrlen = sizeof(addr);
+	struct net_buf *buf;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(client_sock, (struct net_sockaddr *)&client_addr,
+			sizeof(client_addr));
+	zassert_equal(rv, 0, "bind failed");
+	rv = zsock_bind(server_sock, (struct net_sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	buf = net_pkt_get_reserve_tx_data(STRLEN(TEST_STR_SMALL), K_NO_WAIT);
+	zassert_not_null(buf, "cannot allocate buffer");
+	net_buf_add_mem(buf, TEST_STR_SMALL, STRLEN(TEST_STR_SMALL));
+
+	rv = zsock_sendto_buf(client_sock, buf, 0, (struct net_sockaddr *)&server_addr,
+			      sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "sendto_buf failed (%d)", -errno);
+
+	buf = NULL;
+	rv = zsock_recvfrom_buf(server_sock, &buf, 0, (struct net_sockaddr *)&addr,
+				&addrlen);
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "recvfrom_buf failed (%d)", -errno);
+	zassert_not_null(buf, "no buffer loaned");
+	zassert_equal(net_buf_frags_len(buf), rv, "buffer holds more than the payload");
+	zassert_equal(net_buf_linearize(rx_buf, sizeof(rx_buf), buf, 0, rv), rv);
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, rv, "invalid payload");
+	zassert_equal(addrlen, sizeof(addr), "invalid address length");
+	zassert_equal(addr.sin_port, client_addr.sin_port, "invalid source port");
+	net_buf_unref(buf);
+
+	rv = zsock_recvfrom_buf(server_sock, &buf, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recvfrom_buf on empty queue succeeded");
+	zassert_equal(errno, EAGAIN, "unexpected errno (%d)", errno);
+
+	rv = zsock_recvfrom_buf(server_sock, &buf, ZSOCK_MSG_PEEK, NULL, NULL);
+	zassert_equal(rv, -1, "recvfrom_buf with MSG_PEEK succeeded");
+	zassert_equal(errno, EINVAL, "unexpected errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void comm_sendmsg_recvmsg(int client_sock,
 				 struct net_sockaddr *client_addr,
 				 net_socklen_t client_addrlen,
@@ -724,6 +724,12 @@ static void handle_server_test(net_sa_family_t af, struct tcphdr *th)
 		break;
 	case T_SYN_ACK:
 		test_verify_flags(th, SYN | ACK);
+		if (IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+			/* MSS, followed by SACK permitted if the SYN had it */
+			zassert_equal(th->th_off,
+				      test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4 ? 7 : 6,
+				      "unexpected SYN-ACK options");
+		}
 		seq++;
 		ack = net_ntohl(th->th_seq) + 1U;
 		reply = prepare_ack_packet(af, net_htons(MY_PORT),
@@ -640,4 +640,45 @@ ZTEST(udp_fn_tests, test_udp)
 	zassert_false(test_failed, "udp tests failed");
 }
 
+ZTEST(udp_fn_tests, test_udp_recv_batch)
+{
+	struct net_in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+	struct net_in_addr in4addr_peer = { { { 192, 0, 2, 9 } } };
+	struct net_conn_handle *handle;
+	struct net_pkt *pkts[4];
+	struct net_if *iface;
+	int ret;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(net_if_ipv4_addr_add(iface, &in4addr_my, NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+
+	k_sem_init(&recv_lock, 0, UINT_MAX);
+
+	ret = net_udp_register(NET_AF_INET, NULL, NULL, 0, 4244, NULL, test_ok,
+			       NULL, &handle);
+	zassert_ok(ret, "UDP register failed (%d)", ret);
+
+	for (int i = 0; i < ARRAY_SIZE(pkts); i++) {
+		pkts[i] = net_pkt_alloc_with_buffer(iface, 0, NET_AF_INET,
+						    NET_IPPROTO_UDP, K_SECONDS(1));
+		zassert_not_null(pkts[i], "Out of mem");
+
+		zassert_ok(net_ipv4_create(pkts[i], &in4addr_peer, &in4addr_my));
+		zassert_ok(net_udp_create(pkts[i], net_htons(1234), net_htons(4244)));
+
+		net_pkt_cursor_init(pkts[i]);
+		net_ipv4_finalize(pkts[i], NET_IPPROTO_UDP);
+	}
+
+	zassert_ok(net_recv_data_batch(iface, pkts, ARRAY_SIZE(pkts)),
+		   "Cannot receive batch");
+
+	for (int i = 0; i < ARRAY_SIZE(pkts); i++) {
+		zassert_ok(k_sem_take(&recv_lock, TIMEOUT), "Packet %d not received", i);
+	}
+
+	zassert_ok(net_udp_unregister(handle), "UDP unregister failed");
+}
+
 ZTEST_SUITE(udp_fn_tests, NULL, NULL, NULL, NULL, NULL);
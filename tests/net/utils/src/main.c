@@ -1365,6 +1365,41 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+static uint8_t testcopy[CHECKSUM_TEST_LENGTH + 4];
+
+ZTEST(test_utils_fn, test_ip_checksum_copy)
+{
+	uint16_t sum_got;
+	uint16_t sum_exp;
+
+	for (int i = 0; i < CHECKSUM_TEST_LENGTH; i++) {
+		testdata[i] = (uint8_t)(i + 7) * 31;
+	}
+
+	/* Same and different alignments of the source and destination */
+	for (int src_off = 0; src_off < 4; src_off++) {
+		for (int dst_off = 0; dst_off < 4; dst_off++) {
+			for (int length = 0; length < 80; length++) {
+				memset(testcopy, 0, sizeof(testcopy));
+
+				sum_exp = calc_chksum_ref(length ^ 0x5a3c, testdata + src_off,
+							  length);
+				sum_got = calc_chksum_copy(length ^ 0x5a3c, testcopy + dst_off,
+							   testdata + src_off, length);
+
+				zassert_equal(sum_got, sum_exp,
+					      "Mismatch between reference and copy checksum\n");
+				zassert_mem_equal(testcopy + dst_off, testdata + src_off, length,
+						  "Data not copied\n");
+			}
+		}
+	}
+
+	sum_exp = calc_chksum_ref(0, testdata, CHECKSUM_TEST_LENGTH);
+	sum_got = calc_chksum_copy(0, testcopy, testdata, CHECKSUM_TEST_LENGTH);
+	zassert_equal(sum_got, sum_exp, "Mismatch for a full frame\n");
+}
+
 /* Verify that the net_pkt pointer to the received link layer address
  * is correct.
  */
@@ -0,0 +1,192 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/posix/poll.h>
+#include <zephyr/posix/sys/epoll.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/ztest.h>
+
+#define NUM_FDS 3
+
+struct epoll_fixture {
+	int epfd;
+	int fds[NUM_FDS];
+};
+
+static void *epoll_setup(void)
+{
+	static struct epoll_fixture fixture;
+
+	return &fixture;
+}
+
+static void epoll_before(void *arg)
+{
+	struct epoll_fixture *fixture = arg;
+
+	fixture->epfd = epoll_create1(0);
+	zassert_true(fixture->epfd >= 0, "epoll_create1() failed: %d", errno);
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		fixture->fds[i] = eventfd(0, EFD_NONBLOCK);
+		zassert_true(fixture->fds[i] >= 0, "eventfd() failed: %d", errno);
+	}
+}
+
+static void epoll_after(void *arg)
+{
+	struct epoll_fixture *fixture = arg;
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		(void)epoll_ctl(fixture->epfd, EPOLL_CTL_DEL, fixture->fds[i], NULL);
+		zassert_ok(close(fixture->fds[i]));
+	}
+
+	zassert_ok(close(fixture->epfd));
+}
+
+static void add_fd(int epfd, int fd, uint32_t events)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.fd = fd,
+	};
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev), "epoll_ctl() failed: %d", errno);
+}
+
+ZTEST_F(epoll, test_epoll_wait_ready)
+{
+	struct epoll_event events[NUM_FDS];
+	eventfd_t val;
+	int ret;
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		add_fd(fixture->epfd, fixture->fds[i], EPOLLIN);
+	}
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 0, "unexpected events: %d", ret);
+
+	zassert_ok(eventfd_write(fixture->fds[1], 1));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(ret, 1, "expected one event: %d", ret);
+	zassert_equal(events[0].data.fd, fixture->fds[1]);
+	zassert_equal(events[0].events, EPOLLIN);
+
+	/* Level triggered, reported until it is read */
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 1, "expected one event: %d", ret);
+
+	zassert_ok(eventfd_read(fixture->fds[1], &val));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 0, "unexpected events: %d", ret);
+}
+
+ZTEST_F(epoll, test_epoll_wait_maxevents)
+{
+	struct epoll_event events[NUM_FDS];
+	int ret;
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		add_fd(fixture->epfd, fixture->fds[i], EPOLLIN);
+		zassert_ok(eventfd_write(fixture->fds[i], 1));
+	}
+
+	ret = epoll_wait(fixture->epfd, events, 2, 100);
+	zassert_equal(ret, 2, "expected two events: %d", ret);
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, NUM_FDS, "expected all events: %d", ret);
+}
+
+ZTEST_F(epoll, test_epoll_oneshot)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN | EPOLLONESHOT,
+		.data.u32 = 42,
+	};
+	struct epoll_event events[1];
+	int ret;
+
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, fixture->fds[0], &ev));
+	zassert_ok(eventfd_write(fixture->fds[0], 1));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(ret, 1, "expected one event: %d", ret);
+	zassert_equal(events[0].data.u32, 42);
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 0, "oneshot reported twice: %d", ret);
+
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_MOD, fixture->fds[0], &ev));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(ret, 1, "not re-enabled by EPOLL_CTL_MOD: %d", ret);
+}
+
+ZTEST_F(epoll, test_epoll_ctl_errors)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+	};
+	struct epoll_event events[1];
+
+	add_fd(fixture->epfd, fixture->fds[0], EPOLLIN);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, fixture->fds[0], &ev), -1);
+	zassert_equal(errno, EEXIST);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_MOD, fixture->fds[1], &ev), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_DEL, fixture->fds[1], NULL), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, fixture->epfd, &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, -1, &ev), -1);
+	zassert_equal(errno, EBADF);
+
+	zassert_equal(epoll_ctl(fixture->fds[1], EPOLL_CTL_ADD, fixture->fds[0], &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_wait(fixture->epfd, events, 0, 0), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_create(0), -1);
+	zassert_equal(errno, EINVAL);
+
+	/* Removed fds are not reported anymore */
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_DEL, fixture->fds[0], NULL));
+	zassert_ok(eventfd_write(fixture->fds[0], 1));
+	zassert_equal(epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0), 0);
+}
+
+ZTEST_F(epoll, test_epoll_poll_epfd)
+{
+	struct pollfd pfd = {
+		.fd = fixture->epfd,
+		.events = POLLIN,
+	};
+
+	add_fd(fixture->epfd, fixture->fds[0], EPOLLIN);
+
+	zassert_equal(poll(&pfd, 1, 0), 0);
+
+	zassert_ok(eventfd_write(fixture->fds[0], 1));
+
+	zassert_equal(poll(&pfd, 1, 100), 1);
+	zassert_equal(pfd.revents, POLLIN);
+}
+
+ZTEST_SUITE(epoll, NULL, epoll_setup, epoll_before, epoll_after, NULL);
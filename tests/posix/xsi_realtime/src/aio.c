@@ -0,0 +1,139 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fcntl.h>
+#include <string.h>
+#include <ff.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/posix/aio.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/ztest.h>
+
+#define FATFS_MNTP "/RAM:"
+#define TEST_FILE  FATFS_MNTP "/aio.txt"
+
+static FATFS aio_fat_fs;
+
+static struct fs_mount_t aio_fatfs_mnt = {
+	.type = FS_FATFS,
+	.mnt_point = FATFS_MNTP,
+	.fs_data = &aio_fat_fs,
+};
+
+static const char test_str[] = "Hello asynchronous World!";
+
+static int open_test_file(void)
+{
+	int fd;
+
+	zassert_ok(fs_mount(&aio_fatfs_mnt));
+
+	fd = open(TEST_FILE, O_CREAT | O_RDWR, 0660);
+	zassert_not_equal(fd, -1, "Error opening file, errno [%d]", errno);
+
+	return fd;
+}
+
+static void close_test_file(int fd)
+{
+	zassert_ok(close(fd));
+	zassert_ok(fs_unmount(&aio_fatfs_mnt));
+}
+
+static void wait_for(struct aiocb *cb)
+{
+	const struct aiocb *const list[] = {cb};
+
+	while (aio_error(cb) == EINPROGRESS) {
+		zassert_ok(aio_suspend(list, ARRAY_SIZE(list), NULL));
+	}
+}
+
+ZTEST(xsi_realtime, test_aio_read_write)
+{
+	char buf[sizeof(test_str)] = {0};
+	int fd = open_test_file();
+	struct aiocb cb = {
+		.aio_fildes = fd,
+		.aio_buf = (void *)test_str,
+		.aio_nbytes = sizeof(test_str),
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+
+	zassert_ok(aio_write(&cb));
+	wait_for(&cb);
+	zassert_ok(aio_error(&cb));
+	zassert_equal(aio_return(&cb), sizeof(test_str));
+
+	/* The status can only be retrieved once */
+	zassert_equal(aio_return(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	cb.aio_buf = buf;
+	zassert_ok(aio_read(&cb));
+	wait_for(&cb);
+	zassert_equal(aio_return(&cb), sizeof(test_str));
+	zassert_mem_equal(buf, test_str, sizeof(test_str));
+
+	close_test_file(fd);
+}
+
+ZTEST(xsi_realtime, test_aio_lio_listio)
+{
+	char buf[2][8] = {0};
+	int fd = open_test_file();
+	struct aiocb cbs[2] = {
+		{
+			.aio_fildes = fd,
+			.aio_buf = (void *)test_str,
+			.aio_nbytes = 8,
+			.aio_lio_opcode = LIO_WRITE,
+			.aio_sigevent.sigev_notify = SIGEV_NONE,
+		},
+		{
+			.aio_fildes = fd,
+			.aio_offset = 8,
+			.aio_buf = (void *)&test_str[8],
+			.aio_nbytes = 8,
+			.aio_lio_opcode = LIO_WRITE,
+			.aio_sigevent.sigev_notify = SIGEV_NONE,
+		},
+	};
+	struct aiocb *const list[] = {&cbs[0], &cbs[1]};
+
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL));
+	zassert_equal(aio_return(&cbs[0]), 8);
+	zassert_equal(aio_return(&cbs[1]), 8);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cbs); i++) {
+		cbs[i].aio_buf = buf[i];
+		cbs[i].aio_lio_opcode = LIO_READ;
+	}
+
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL));
+	zassert_equal(aio_return(&cbs[0]), 8);
+	zassert_equal(aio_return(&cbs[1]), 8);
+	zassert_mem_equal(buf, test_str, sizeof(buf));
+
+	close_test_file(fd);
+}
+
+ZTEST(xsi_realtime, test_aio_invalid)
+{
+	struct aiocb cb = {
+		.aio_fildes = -1,
+		.aio_offset = -1,
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+
+	zassert_equal(aio_error(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(aio_cancel(-1, NULL), AIO_ALLDONE);
+}
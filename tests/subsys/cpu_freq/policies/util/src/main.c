@@ -0,0 +1,82 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/cpu_freq/policy.h>
+#include <zephyr/cpu_freq/cpu_freq.h>
+
+#define WAIT_US 100000
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+extern const struct pstate *soc_pstates[];
+extern const size_t soc_pstates_count;
+
+static K_THREAD_STACK_DEFINE(critical_stack, STACK_SIZE);
+static struct k_thread critical_thread;
+
+static void critical_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+}
+
+/*
+ * Test that the P-state follows the utilization of the CPU.
+ */
+ZTEST(cpu_freq_util, test_pstates)
+{
+	const struct pstate *test_pstate;
+	int ret;
+
+	zassert_equal(cpu_freq_policy_select_pstate(NULL), -EINVAL,
+		      "Expected -EINVAL for NULL pstate_out");
+
+	/* Simulate high-load: 100ms is about three halving periods of the utilization */
+	k_busy_wait(WAIT_US);
+
+	ret = cpu_freq_policy_select_pstate(&test_pstate);
+	zassert_equal(ret, 0, "Expected success from cpu_freq_policy_select_pstate");
+	zassert_equal(test_pstate, soc_pstates[0], "Expected highest P-state after busy wait");
+
+	/* Simulate low-load by sleeping */
+	k_sleep(K_USEC(WAIT_US));
+
+	ret = cpu_freq_policy_select_pstate(&test_pstate);
+	zassert_equal(ret, 0, "Expected success from cpu_freq_policy_select_pstate");
+	zassert_not_equal(test_pstate, soc_pstates[0], "Expected lower P-state after sleep");
+}
+
+/*
+ * Test that waking up a latency critical thread ramps the frequency up.
+ */
+ZTEST(cpu_freq_util, test_wake_boost)
+{
+	const struct pstate *test_pstate;
+
+	/* Let the utilization decay and apply the resulting P-state */
+	k_sleep(K_USEC(2 * WAIT_US));
+
+	zassert_ok(cpu_freq_policy_select_pstate(&test_pstate));
+	zassert_equal(test_pstate, soc_pstates[soc_pstates_count - 1],
+		      "Expected lowest P-state when idle");
+	zassert_equal(cpu_freq_policy_pstate_set(test_pstate), test_pstate);
+
+	k_thread_create(&critical_thread, critical_stack, K_THREAD_STACK_SIZEOF(critical_stack),
+			critical_entry, NULL, NULL, NULL, K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_join(&critical_thread, K_FOREVER);
+
+	/* The boost holds until the next evaluation */
+	zassert_ok(cpu_freq_policy_select_pstate(&test_pstate));
+	zassert_equal(test_pstate, soc_pstates[0], "Expected highest P-state after wake up");
+
+	zassert_ok(cpu_freq_policy_select_pstate(&test_pstate));
+	zassert_not_equal(test_pstate, soc_pstates[0], "Expected boost to be over");
+}
+
+ZTEST_SUITE(cpu_freq_util, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,140 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/ztest.h>
+#include <zephyr/debug/boot_profile.h>
+
+#define INIT_DELAY_US 1000
+
+static int slow_init(void)
+{
+	k_busy_wait(INIT_DELAY_US);
+
+	return -EIO;
+}
+
+SYS_INIT(slow_init, POST_KERNEL, 0);
+
+static int slow_dev_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_busy_wait(INIT_DELAY_US);
+
+	return 0;
+}
+
+DEVICE_DEFINE(slow_dev, "slow_dev", slow_dev_init, NULL, NULL, NULL, APPLICATION, 0, NULL);
+
+static const struct boot_profile_record *find(enum boot_profile_type type, const void *what)
+{
+	for (size_t i = 0; i < boot_profile_count(); i++) {
+		const struct boot_profile_record *record = boot_profile_get(i);
+
+		if ((record->type == type) && (record->name == what)) {
+			return record;
+		}
+	}
+
+	return NULL;
+}
+
+static const struct boot_profile_record *find_name(enum boot_profile_type type, const char *name)
+{
+	for (size_t i = 0; i < boot_profile_count(); i++) {
+		const struct boot_profile_record *record = boot_profile_get(i);
+
+		if ((record->type == type) && (strcmp(record->name, name) == 0)) {
+			return record;
+		}
+	}
+
+	return NULL;
+}
+
+static uint64_t duration_us(const struct boot_profile_record *record)
+{
+	return boot_profile_cycles_to_ns(record->end - record->start) / NSEC_PER_USEC;
+}
+
+/**
+ * @brief Test that the init levels are recorded in order
+ */
+ZTEST(boot_profile, test_levels)
+{
+	static const char *const levels[] = {
+		"EARLY", "PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL", "APPLICATION",
+	};
+	uint64_t end = 0U;
+
+	zassert_true(boot_profile_count() > 0U);
+	zassert_is_null(boot_profile_get(boot_profile_count()));
+
+	for (int i = 0; i < ARRAY_SIZE(levels); i++) {
+		const struct boot_profile_record *record =
+			find_name(BOOT_PROFILE_LEVEL, levels[i]);
+
+		zassert_not_null(record, "%s not recorded", levels[i]);
+		zassert_equal(record->level, i);
+		zassert_true(record->start >= end, "%s overlaps previous level", levels[i]);
+		zassert_true(record->end >= record->start);
+		end = record->end;
+	}
+}
+
+/**
+ * @brief Test that SYS_INIT entries and devices are timed
+ */
+ZTEST(boot_profile, test_entries)
+{
+	const struct boot_profile_record *record;
+
+	record = find(BOOT_PROFILE_SYS_INIT, slow_init);
+	zassert_not_null(record);
+	zassert_equal(record->level, 3);
+	zassert_equal(record->result, -EIO);
+	zassert_true(duration_us(record) >= INIT_DELAY_US);
+	zassert_not_null(record->thread, "Expected POST_KERNEL to run from a thread");
+
+	if (IS_ENABLED(CONFIG_SYMTAB)) {
+		zassert_str_equal(boot_profile_name(record), "slow_init");
+	}
+
+	record = find(BOOT_PROFILE_DEVICE, DEVICE_GET(slow_dev));
+	zassert_not_null(record);
+	zassert_equal(record->level, 4);
+	zassert_ok(record->result);
+	zassert_true(duration_us(record) >= INIT_DELAY_US);
+	zassert_str_equal(boot_profile_name(record), "slow_dev");
+}
+
+/**
+ * @brief Test that boot milestones are recorded, including custom ones
+ */
+ZTEST(boot_profile, test_marks)
+{
+	const struct boot_profile_record *main_thread =
+		find_name(BOOT_PROFILE_MARK, "main thread");
+	const struct boot_profile_record *main = find_name(BOOT_PROFILE_MARK, "main");
+	const struct boot_profile_record *test;
+
+	zassert_not_null(main_thread);
+	zassert_not_null(main);
+	zassert_true(main->start > main_thread->start);
+	zassert_equal(main->level, BOOT_PROFILE_LEVEL_NONE);
+
+	boot_profile_mark("test");
+	test = find_name(BOOT_PROFILE_MARK, "test");
+	zassert_not_null(test);
+	zassert_equal(test->start, test->end);
+	zassert_true(test->start > main->start);
+}
+
+ZTEST_SUITE(boot_profile, NULL, NULL, NULL, NULL, NULL);
@@ -177,4 +177,83 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_DELTA
+ZTEST(img_util, test_delta)
+{
+	static const uint8_t source[] = "0123456789abcdef\nfedcba9876543210\n";
+	static const uint8_t target[] = "0123456789ABCDEFxyz0123";
+	uint8_t patch[] = {
+		/* Magic, source and target sizes */
+		0x5a, 0x44, 0x50, 0x31, 34, 0, 0, 0, 23, 0, 0, 0,
+		/* sha256sum of the source, as in test_check_flash */
+		0xc6, 0xb6, 0x7c, 0x46, 0xe7, 0x2e, 0x14, 0x17,
+		0x49, 0xa4, 0xd2, 0xf1, 0x38, 0x58, 0xb2, 0xa7,
+		0x54, 0xaf, 0x6d, 0x39, 0x50, 0x6b, 0xd5, 0x41,
+		0x90, 0xf6, 0x18, 0x1a, 0xe0, 0xc2, 0x7f, 0x98,
+		/* sha256sum of the target */
+		0xc6, 0x64, 0xf0, 0x09, 0x1e, 0xc2, 0xe6, 0xb8,
+		0x60, 0xa7, 0x1e, 0x02, 0x73, 0x83, 0xc8, 0x5d,
+		0x3b, 0x94, 0x3f, 0x48, 0x78, 0x7f, 0xc0, 0x49,
+		0x2d, 0x12, 0x79, 0xde, 0x7d, 0xc4, 0x50, 0x43,
+		/* "0123456789" */
+		FLASH_IMG_DELTA_OP_COPY, 10,
+		/* "abcdef" to upper case */
+		FLASH_IMG_DELTA_OP_ADD, 6, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+		FLASH_IMG_DELTA_OP_INSERT, 3, 'x', 'y', 'z',
+		/* Back by 16 bytes */
+		FLASH_IMG_DELTA_OP_SEEK, 31,
+		/* "0123" */
+		FLASH_IMG_DELTA_OP_COPY, 4,
+	};
+	static struct flash_img_delta_context delta;
+	struct flash_img_context ctx;
+	const struct flash_area *fa;
+	uint8_t buf[sizeof(target) - 1];
+	int ret;
+
+	zassert_true(flash_img_delta_is_patch(patch, sizeof(patch)), "Not seen as a patch");
+	zassert_false(flash_img_delta_is_patch(source, sizeof(source)), "Seen as a patch");
+
+	ret = flash_img_init_id(&ctx, RUNNING_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init id");
+	ret = flash_area_flatten(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+	ret = flash_img_buffered_write(&ctx, source, sizeof(source) - 1, true);
+	zassert_true(ret == 0, "Flash img buffered write");
+
+	ret = flash_img_delta_init_id(&delta, UPLOAD_PARTITION_ID, RUNNING_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init id");
+	ret = flash_area_flatten(delta.img.flash_area, 0, delta.img.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	/* Split the patch in the middle of the header and of operations */
+	for (size_t off = 0; off < sizeof(patch); off += 7) {
+		ret = flash_img_delta_write(&delta, &patch[off], MIN(7, sizeof(patch) - off),
+					    false);
+		zassert_true(ret == 0, "Flash img delta write at %zu: %d", off, ret);
+	}
+
+	zassert_equal(flash_img_delta_bytes_read(&delta), sizeof(patch), "Wrong patch size");
+	ret = flash_img_delta_write(&delta, NULL, 0, true);
+	zassert_true(ret == 0, "Flash img delta flush: %d", ret);
+
+	ret = flash_area_open(UPLOAD_PARTITION_ID, &fa);
+	zassert_true(ret == 0, "Flash area open");
+	ret = flash_area_read(fa, 0, buf, sizeof(buf));
+	zassert_true(ret == 0, "Flash read failure (%d)", ret);
+	zassert_mem_equal(buf, target, sizeof(buf), "Wrong target image");
+	flash_area_close(fa);
+
+	ret = flash_img_delta_check(&delta);
+	zassert_true(ret == 0, "Flash img delta check");
+
+	/* A patch for another source image is rejected */
+	patch[12] ^= 0xff;
+	ret = flash_img_delta_init_id(&delta, UPLOAD_PARTITION_ID, RUNNING_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init id");
+	ret = flash_img_delta_write(&delta, patch, sizeof(patch), true);
+	zassert_equal(ret, -EINVAL, "Patch applied to the wrong source");
+}
+#endif
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
@@ -159,4 +159,36 @@ ZTEST(draw_point, test_draw_point_outside_bottom_left)
 	zassert_true(verify_color_inside_rect(0, 0, display_width, display_height, 0));
 }
 
+/*
+ * only the modified rows are written on finalize
+ */
+ZTEST(draw_point, test_draw_point_partial_update)
+{
+	struct display_capabilities caps;
+	struct cfb_position pos = {0, 0};
+	struct display_buffer_descriptor desc = {
+		.height = 8,
+		.pitch = 8,
+		.width = 8,
+		.buf_size = 8,
+	};
+	uint8_t block[8];
+
+	zassert_ok(cfb_draw_point(dev, &pos));
+	zassert_ok(cfb_framebuffer_finalize(dev));
+
+	/* Light an 8x8 block behind the back of the framebuffer */
+	display_get_capabilities(dev, &caps);
+	memset(block, (caps.current_pixel_format == PIXEL_FORMAT_MONO10) ? 0x00 : 0xFF,
+	       sizeof(block));
+	zassert_ok(display_write(dev, 0, 96, &desc, block));
+
+	pos.y = 1;
+	zassert_ok(cfb_draw_point(dev, &pos));
+	zassert_ok(cfb_framebuffer_finalize(dev));
+
+	zassert_true(verify_color_inside_rect(0, 0, 1, 2, 0xFFFFFF));
+	zassert_true(verify_color_inside_rect(0, 96, 8, 8, 0xFFFFFF));
+}
+
 ZTEST_SUITE(draw_point, NULL, NULL, cfb_test_before, cfb_test_after, NULL);
@@ -0,0 +1,98 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/dsp/pipeline.h>
+#include <zephyr/ztest.h>
+
+#define BLOCK_SIZE 4
+#define NUM_TAPS   2
+
+static const float32_t sum_coeffs[NUM_TAPS] = {1.0f, 1.0f};
+static const float32_t double_coeffs[5] = {2.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+static float32_t fir_state[ZDSP_FIR_STATE_LEN(NUM_TAPS, BLOCK_SIZE)];
+static float32_t biquad_a_state[ZDSP_BIQUAD_STATE_LEN(1)];
+static float32_t biquad_b_state[ZDSP_BIQUAD_STATE_LEN(1)];
+static float32_t gain = 0.5f;
+
+static struct zdsp_fir_f32 fir = {
+	.num_taps = NUM_TAPS,
+	.state = fir_state,
+	.coeffs = sum_coeffs,
+};
+
+static struct zdsp_biquad_f32 biquad_a = {
+	.num_stages = 1,
+	.state = biquad_a_state,
+	.coeffs = double_coeffs,
+};
+
+static struct zdsp_biquad_f32 biquad_b = {
+	.num_stages = 1,
+	.state = biquad_b_state,
+	.coeffs = double_coeffs,
+};
+
+/* Moving average of two samples */
+ZDSP_PIPELINE_DEFINE(average, BLOCK_SIZE,
+		     ZDSP_PIPELINE_STAGE_FIR_F32(&fir),
+		     ZDSP_PIPELINE_STAGE_SCALE_F32(&gain));
+
+/* The output of the FIR filter is processed in place in the work buffer */
+ZDSP_PIPELINE_DEFINE(mixed, BLOCK_SIZE,
+		     ZDSP_PIPELINE_STAGE_BIQUAD_F32(&biquad_a),
+		     ZDSP_PIPELINE_STAGE_FIR_F32(&fir),
+		     ZDSP_PIPELINE_STAGE_BIQUAD_F32(&biquad_b));
+
+static void check_block(const float32_t *block, const float32_t *expected)
+{
+	for (size_t i = 0; i < BLOCK_SIZE; i++) {
+		zassert_within(block[i], expected[i], 1e-6f, "sample %zu: %f != %f", i,
+			       (double)block[i], (double)expected[i]);
+	}
+}
+
+static void pipeline_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(fir_state, 0, sizeof(fir_state));
+	memset(biquad_a_state, 0, sizeof(biquad_a_state));
+	memset(biquad_b_state, 0, sizeof(biquad_b_state));
+}
+
+ZTEST(zdsp_pipeline, test_fir_scale)
+{
+	float32_t block[BLOCK_SIZE] = {2.0f, 4.0f, 6.0f, 8.0f};
+
+	zassert_ok(zdsp_pipeline_process(&average, block, BLOCK_SIZE));
+	check_block(block, (const float32_t[]){1.0f, 3.0f, 5.0f, 7.0f});
+
+	/* The filter state carries over to the next block */
+	memcpy(block, (const float32_t[]){10.0f, 12.0f, 14.0f, 16.0f}, sizeof(block));
+	zassert_ok(zdsp_pipeline_process(&average, block, BLOCK_SIZE));
+	check_block(block, (const float32_t[]){9.0f, 11.0f, 13.0f, 15.0f});
+}
+
+ZTEST(zdsp_pipeline, test_work_buffer)
+{
+	float32_t block[BLOCK_SIZE] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+	zassert_ok(zdsp_pipeline_process(&mixed, block, BLOCK_SIZE));
+	check_block(block, (const float32_t[]){4.0f, 8.0f, 8.0f, 8.0f});
+}
+
+ZTEST(zdsp_pipeline, test_block_too_large)
+{
+	float32_t block[BLOCK_SIZE + 1] = {0};
+
+	zassert_equal(zdsp_pipeline_process(&average, block, ARRAY_SIZE(block)), -EINVAL);
+}
+
+ZTEST_SUITE(zdsp_pipeline, NULL, NULL, pipeline_before, NULL, NULL);
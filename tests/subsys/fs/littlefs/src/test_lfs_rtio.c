@@ -0,0 +1,67 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include "testfs_tests.h"
+#include "testfs_lfs.h"
+
+#ifdef CONFIG_FILE_SYSTEM_RTIO
+#include <zephyr/fs/fs_rtio.h>
+
+static struct fs_file_t rtio_file;
+FS_RTIO_IODEV_DEFINE(rtio_file_iodev, &rtio_file);
+RTIO_DEFINE(rtio_file_ctx, 4, 4);
+
+static int rtio_file_run(void)
+{
+	struct rtio_cqe *cqe;
+	int rc;
+
+	zassert_equal(rtio_submit(&rtio_file_ctx, 1), 0, "submit failed");
+	cqe = rtio_cqe_consume_block(&rtio_file_ctx);
+	rc = cqe->result;
+	rtio_cqe_release(&rtio_file_ctx, cqe);
+
+	return rc;
+}
+#endif
+
+ZTEST(littlefs, test_lfs_rtio)
+{
+#ifdef CONFIG_FILE_SYSTEM_RTIO
+	static const uint8_t data[] = "asynchronous file I/O";
+	uint8_t buf[sizeof(data)];
+	struct fs_mount_t *mp = &testfs_small_mnt;
+	struct testfs_path path;
+	struct rtio_sqe *sqe;
+
+	zassert_equal(testfs_lfs_wipe_partition(mp), TC_PASS, "wipe failed");
+	zassert_equal(fs_mount(mp), 0, "mount failed");
+
+	testfs_path_init(&path, mp, "rtio", TESTFS_PATH_END);
+	fs_file_t_init(&rtio_file);
+	zassert_equal(fs_open(&rtio_file, path.path, FS_O_CREATE | FS_O_RDWR), 0,
+		      "open failed");
+
+	sqe = rtio_sqe_acquire(&rtio_file_ctx);
+	rtio_sqe_prep_write(sqe, &rtio_file_iodev, RTIO_PRIO_NORM, data, sizeof(data), NULL);
+	zassert_equal(rtio_file_run(), sizeof(data), "write failed");
+
+	zassert_equal(fs_seek(&rtio_file, 0, FS_SEEK_SET), 0, "seek failed");
+
+	sqe = rtio_sqe_acquire(&rtio_file_ctx);
+	rtio_sqe_prep_read(sqe, &rtio_file_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_equal(rtio_file_run(), sizeof(data), "read failed");
+	zassert_mem_equal(buf, data, sizeof(data), "data mismatch");
+
+	zassert_equal(fs_close(&rtio_file), 0, "close failed");
+	zassert_equal(fs_unmount(mp), 0, "unmount failed");
+#else
+	ztest_test_skip();
+#endif
+}
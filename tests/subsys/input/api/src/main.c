@@ -12,7 +12,64 @@ static const struct device fake_dev;
 static int message_count_filtered;
 static int message_count_unfiltered;
 
-#if CONFIG_INPUT_MODE_THREAD
+#if CONFIG_INPUT_COALESCE
+
+static K_SEM_DEFINE(cb_sync, 0, 1);
+static struct input_event events[8];
+static int event_count;
+
+static void input_cb_record(struct input_event *evt, void *user_data)
+{
+	if (event_count < ARRAY_SIZE(events)) {
+		events[event_count] = *evt;
+	}
+	event_count++;
+
+	if (evt->sync) {
+		k_sem_give(&cb_sync);
+	}
+}
+INPUT_CALLBACK_DEFINE(&fake_dev, input_cb_record, NULL);
+
+ZTEST(input_api, test_coalesce)
+{
+	event_count = 0;
+
+	/* The input thread has a lower priority, these all queue up */
+	zassert_ok(input_report_rel(&fake_dev, INPUT_REL_X, 1, false, K_FOREVER));
+	zassert_ok(input_report_rel(&fake_dev, INPUT_REL_Y, 2, true, K_FOREVER));
+	zassert_ok(input_report_rel(&fake_dev, INPUT_REL_X, 3, false, K_FOREVER));
+	zassert_ok(input_report_rel(&fake_dev, INPUT_REL_Y, 4, true, K_FOREVER));
+	zassert_ok(input_report_abs(&fake_dev, INPUT_ABS_X, 10, false, K_FOREVER));
+	zassert_ok(input_report_key(&fake_dev, INPUT_BTN_TOUCH, 1, true, K_FOREVER));
+	zassert_ok(input_report_abs(&fake_dev, INPUT_ABS_X, 20, false, K_FOREVER));
+	zassert_ok(input_report_key(&fake_dev, INPUT_BTN_TOUCH, 1, true, K_FOREVER));
+	zassert_ok(input_report_key(&fake_dev, INPUT_BTN_TOUCH, 0, true, K_FOREVER));
+
+	zassert_ok(k_sem_take(&cb_sync, K_SECONDS(1)));
+	zassert_ok(k_sem_take(&cb_sync, K_SECONDS(1)));
+
+	zassert_equal(event_count, 5);
+
+	zassert_equal(events[0].code, INPUT_REL_X);
+	zassert_equal(events[0].value, 4);
+	zassert_equal(events[1].code, INPUT_REL_Y);
+	zassert_equal(events[1].value, 6);
+	zassert_equal(events[2].code, INPUT_ABS_X);
+	zassert_equal(events[2].value, 20);
+	zassert_equal(events[3].code, INPUT_BTN_TOUCH);
+	zassert_equal(events[3].value, 1);
+	zassert_true(events[3].sync);
+	zassert_equal(events[4].code, INPUT_BTN_TOUCH);
+	zassert_equal(events[4].value, 0);
+	zassert_true(events[4].sync);
+
+	for (int i = 0; i < 3; i++) {
+		zassert_false(events[i].sync);
+	}
+}
+
+#elif CONFIG_INPUT_MODE_THREAD
 
 static K_SEM_DEFINE(cb_start, 1, 1);
 static K_SEM_DEFINE(cb_done, 1, 1);
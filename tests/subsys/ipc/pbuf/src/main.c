@@ -106,6 +106,61 @@ ZTEST(test_pbuf, test_rw)
 	zassert_mem_equal(write_buf, read_buf, MPS);
 }
 
+/* In place read tests. */
+ZTEST(test_pbuf, test_read_claim)
+{
+	uint8_t read_buf[MEM_AREA_SZ] = {0};
+	uint8_t write_buf[MEM_AREA_SZ];
+	const char *data;
+	int ret;
+
+	/* TODO: Use PBUF_DEFINE().
+	 * The user should use PBUF_DEFINE() macro to define the buffer,
+	 * however for the purpose of this test PBUF_CFG_INIT() is used in
+	 * order to avoid clang complains about memory_area not being constant
+	 * expression.
+	 */
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+	zassert_equal(pbuf_read_claim(&pb, &data), 0);
+
+	zassert_equal(pbuf_write(&pb, write_buf, MSGA_SZ), MSGA_SZ);
+	zassert_equal(pbuf_write(&pb, write_buf+MSGA_SZ, MSGB_SZ), MSGB_SZ);
+
+	/* The message stays in the buffer until released. */
+	ret = pbuf_read_claim(&pb, &data);
+	zassert_equal(ret, MSGA_SZ);
+	zassert_mem_equal(data, write_buf, ret);
+	zassert_equal(pbuf_rd_idx_read(&pb), 0);
+	zassert_equal(pbuf_read_claim(&pb, &data), MSGA_SZ);
+	zassert_ok(pbuf_read_finish(&pb, ret));
+
+	ret = pbuf_read_claim(&pb, &data);
+	zassert_equal(ret, MSGB_SZ);
+	zassert_mem_equal(data, write_buf+MSGA_SZ, ret);
+	zassert_ok(pbuf_read_finish(&pb, ret));
+
+	/* The reader caught up with the writer. */
+	zassert_equal(pbuf_rd_idx_read(&pb), pb.data.wr_idx);
+	zassert_equal(pbuf_read_claim(&pb, &data), 0);
+
+	/* A message wrapping around has to be copied. */
+	zassert_equal(pbuf_write(&pb, write_buf, MPS), MPS);
+	zassert_equal(pbuf_read_claim(&pb, &data), -ENOBUFS);
+	zassert_equal(pbuf_read(&pb, read_buf, MPS), MPS);
+	zassert_mem_equal(read_buf, write_buf, MPS);
+	zassert_equal(pbuf_read_claim(&pb, &data), 0);
+}
+
 /* API ret codes tests. */
 ZTEST(test_pbuf, test_retcodes)
 {
@@ -1318,3 +1318,51 @@ ZTEST_F(zms, test_zms_free_space_5sectors)
 	zassert_equal(free_space_total, zms_calc_free_space(&fixture->fs),
 		      "total free space did not match sum of gc'd sectors");
 }
+
+/*
+ * Test that the ZMS lookup index holds every written ID, across a remount and
+ * a garbage collection.
+ */
+ZTEST_F(zms, test_zms_lookup_index)
+{
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	const int num_ids = 100;
+	int err;
+	uint16_t data;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_true(fixture->fs.lookup_index_complete, "incomplete index");
+	zassert_equal(fixture->fs.lookup_index_used, 0, "index not empty");
+
+	for (int id = 0; id < num_ids; id++) {
+		data = id;
+		err = zms_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	zassert_equal(fixture->fs.lookup_index_used, num_ids, "missing index entries");
+	zassert_true(fixture->fs.lookup_index_size > num_ids, "index not grown");
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_true(fixture->fs.lookup_index_complete, "incomplete index after restart");
+	zassert_equal(fixture->fs.lookup_index_used, num_ids, "index not rebuilt");
+
+	for (uint32_t i = 0; i < fixture->fs.sector_count; i++) {
+		err = zms_sector_use_next(&fixture->fs);
+		zassert_true(err == 0, "zms_sector_use_next call failure: %d", err);
+	}
+
+	for (int id = 0; id < num_ids; id++) {
+		err = zms_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_read call failure: %d", err);
+		zassert_equal(data, id, "incorrect data read");
+	}
+
+	err = zms_read(&fixture->fs, num_ids, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "unexpected entry found: %d", err);
+#else
+	ztest_test_skip();
+#endif
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_DBG);
+
+static uint32_t msg_cnt;
+static uint32_t summary_cnt;
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	size_t len;
+	struct cbprintf_package_hdr_ext *pkg =
+		(struct cbprintf_package_hdr_ext *)log_msg_get_package(&msg->log, &len);
+
+	ARG_UNUSED(backend);
+
+	if ((len > 0) && (strncmp(pkg->fmt, "Message repeated", 16) == 0)) {
+		summary_cnt++;
+	} else {
+		msg_cnt++;
+	}
+}
+
+static const struct log_backend_api backend_api = {
+	.process = process,
+};
+
+LOG_BACKEND_DEFINE(test_backend, backend_api, false);
+
+static void flush(void)
+{
+	while (log_process()) {
+	}
+}
+
+static void log_storm(int cnt)
+{
+	for (int i = 0; i < cnt; i++) {
+		LOG_WRN("storm %d", i);
+	}
+}
+
+ZTEST(log_dedup, test_burst_and_summary)
+{
+	log_storm(10);
+	flush();
+
+	zassert_equal(msg_cnt, CONFIG_LOG_DEDUP_BURST);
+	zassert_equal(summary_cnt, 0);
+
+	k_msleep(CONFIG_LOG_DEDUP_INTERVAL_MS + 10);
+
+	log_storm(1);
+	flush();
+
+	zassert_equal(msg_cnt, CONFIG_LOG_DEDUP_BURST + 1);
+	zassert_equal(summary_cnt, 1);
+}
+
+ZTEST(log_dedup, test_distinct_messages)
+{
+	for (int i = 0; i < 10; i++) {
+		LOG_INF("first %d", i);
+		LOG_INF("second %d", i);
+	}
+	flush();
+
+	/* Each message is tracked on its own unless both share a slot. */
+	zassert_true(msg_cnt >= 2 * CONFIG_LOG_DEDUP_BURST);
+}
+
+ZTEST(log_dedup, test_raw_string_not_filtered)
+{
+	for (int i = 0; i < 10; i++) {
+		LOG_PRINTK("raw %d\n", i);
+	}
+	flush();
+
+	zassert_equal(msg_cnt, 10);
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	flush();
+	msg_cnt = 0;
+	summary_cnt = 0;
+}
+
+static void *setup(void)
+{
+	log_init();
+	log_thread_set(k_current_get());
+	log_backend_enable(&test_backend, NULL, LOG_LEVEL_DBG);
+
+	return NULL;
+}
+
+ZTEST_SUITE(log_dedup, NULL, setup, before, NULL, NULL);
@@ -142,4 +142,46 @@ ZTEST(mem_attr_heap, test_mem_attr_heap)
 	zassert_true(((uintptr_t) block % 64 == 0), "");
 }
 
+ZTEST(mem_attr_heap, test_mem_attr_heap_prefer)
+{
+	const struct mem_attr_region_t *region;
+	void *block;
+	int ret;
+
+	ret = mem_attr_heap_pool_init();
+	zassert_true(ret == 0 || ret == -EALREADY, "Failed initialization");
+
+	/*
+	 * The first attribute has no region, so the allocation must fall
+	 * back to the second one.
+	 */
+	block = MEM_ATTR_HEAP_ALLOC_PREFER(0x100, DT_MEM_SW(DT_MEM_SW_ATTR_UNKNOWN),
+					   DT_MEM_SW_ALLOC_DMA);
+	zassert_not_null(block, "Failed to allocate memory");
+
+	region = mem_attr_heap_get_region(block);
+	zassert_equal(region->dt_addr, ADDR_MEM_DMA_SW,
+		      "Memory allocated from the wrong region");
+	mem_attr_heap_free(block);
+
+	/*
+	 * The most preferred attribute wins when it can satisfy the request.
+	 */
+	block = MEM_ATTR_HEAP_ALLOC_PREFER(0x100, DT_MEM_SW_ALLOC_NON_CACHE,
+					   DT_MEM_SW_ALLOC_DMA);
+	zassert_not_null(block, "Failed to allocate memory");
+
+	region = mem_attr_heap_get_region(block);
+	zassert_equal(region->dt_addr, ADDR_MEM_NON_CACHE_SW,
+		      "Memory allocated from the wrong region");
+	mem_attr_heap_free(block);
+
+	/*
+	 * No attribute can satisfy the request.
+	 */
+	block = MEM_ATTR_HEAP_ALLOC_PREFER(0x4000, DT_MEM_SW_ALLOC_CACHE,
+					   DT_MEM_SW_ALLOC_DMA);
+	zassert_is_null(block, "Buffer too big for regions correctly allocated");
+}
+
 ZTEST_SUITE(mem_attr_heap, NULL, NULL, NULL, NULL, NULL);
@@ -417,6 +417,52 @@ ZTEST(policy_api, test_pm_policy_state_constraints)
 }
 #endif /* CONFIG_PM_POLICY_DEFAULT */
 
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+/**
+ * @brief Test that CONFIG_PM_POLICY_PREDICTIVE=y avoids deep states when the
+ * CPU keeps waking up early, and goes back to them once wakeups follow the
+ * next scheduled event again.
+ */
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	const struct pm_state_info *next;
+	int32_t ticks = k_us_to_ticks_floor32(1100000);
+
+	/* Nothing learnt yet, same as the residency policy */
+	next = pm_policy_next_state(0U, ticks);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* Interrupted shortly after entering idle */
+	for (int i = 0; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+		pm_policy_idle_report(0U, ticks, 20000);
+	}
+
+	next = pm_policy_next_state(0U, ticks);
+	zassert_is_null(next);
+
+	/* Woken up by the timer, the correction factor builds up again */
+	for (int i = 0; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+		pm_policy_idle_report(0U, ticks, 1100000);
+	}
+
+	next = pm_policy_next_state(0U, ticks);
+	zassert_not_null(next);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	for (int i = 0; i < 4 * CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+		pm_policy_idle_report(0U, ticks, 1100000);
+	}
+
+	next = pm_policy_next_state(0U, ticks);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+}
+#else
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
 #ifdef CONFIG_PM_POLICY_CUSTOM
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 {
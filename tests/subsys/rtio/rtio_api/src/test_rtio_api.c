@@ -1173,6 +1173,118 @@ ZTEST(rtio_api, test_rtio_acquire_array)
 	rtio_sqe_drop_all(&r_acquire_array);
 }
 
+RTIO_DEFINE(r_consume_batch, SQE_POOL_SIZE, CQE_POOL_SIZE);
+
+static void callback_nop(struct rtio *r, const struct rtio_sqe *sqe, int result, void *arg0)
+{
+}
+
+ZTEST(rtio_api, test_rtio_cqe_consume_batch)
+{
+	struct rtio *r = &r_consume_batch;
+	struct rtio_sqe sqes[SQE_POOL_SIZE];
+	struct rtio_cqe *cqes[CQE_POOL_SIZE];
+	uintptr_t userdata[SQE_POOL_SIZE];
+	size_t count;
+
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		userdata[i] = i;
+		rtio_sqe_prep_callback(&sqes[i], callback_nop, NULL, &userdata[i]);
+	}
+
+	zassert_ok(rtio_sqe_copy_in(r, sqes, SQE_POOL_SIZE));
+	zassert_equal(rtio_sqe_copy_in(r, sqes, 1), -ENOMEM, "Expected no sqe available");
+	zassert_ok(rtio_submit(r, SQE_POOL_SIZE));
+
+	count = rtio_cqe_consume_batch(r, cqes, 2);
+	zassert_equal(count, 2, "Expected a partial batch");
+	count += rtio_cqe_consume_batch(r, &cqes[2], CQE_POOL_SIZE - 2);
+	zassert_equal(count, SQE_POOL_SIZE, "Expected all completions");
+	zassert_equal(rtio_cqe_consume_batch(r, cqes, CQE_POOL_SIZE), 0);
+
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		zassert_ok(cqes[i]->result);
+		zassert_equal_ptr(cqes[i]->userdata, &userdata[i], "Expected in order completions");
+		rtio_cqe_release(r, cqes[i]);
+	}
+}
+
+#define MP_PRODUCERS 3
+#define MP_CHAINS 32
+#define MP_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#define MP_IN_FLIGHT (MP_PRODUCERS * 2)
+
+RTIO_DEFINE(r_mp, MP_IN_FLIGHT * 2, MP_IN_FLIGHT);
+/* Chains in flight, bounded so completions are never dropped */
+static K_SEM_DEFINE(mp_slots, MP_IN_FLIGHT, MP_IN_FLIGHT);
+static K_THREAD_STACK_ARRAY_DEFINE(mp_stacks, MP_PRODUCERS, MP_STACK_SIZE);
+static struct k_thread mp_threads[MP_PRODUCERS];
+static atomic_t mp_callbacks;
+
+static void callback_count_mp(struct rtio *r, const struct rtio_sqe *sqe, int result, void *arg0)
+{
+	atomic_inc(&mp_callbacks);
+}
+
+static void mp_producer(void *p1, void *p2, void *p3)
+{
+	uintptr_t id = (uintptr_t)p1;
+	struct rtio_sqe sqes[2];
+
+	/* Chains of two, both parts tagged with the producer */
+	rtio_sqe_prep_callback_no_cqe(&sqes[0], callback_count_mp, NULL, NULL);
+	sqes[0].flags |= RTIO_SQE_CHAINED;
+	rtio_sqe_prep_callback(&sqes[1], callback_count_mp, NULL, (void *)id);
+
+	for (int i = 0; i < MP_CHAINS; i++) {
+		k_sem_take(&mp_slots, K_FOREVER);
+		zassert_ok(rtio_sqe_copy_in(&r_mp, sqes, ARRAY_SIZE(sqes)));
+
+		rtio_submit(&r_mp, 0);
+	}
+}
+
+ZTEST(rtio_api, test_rtio_submit_mp)
+{
+#ifdef CONFIG_RTIO_SUBMIT_MP
+	struct rtio_cqe *cqes[MP_IN_FLIGHT];
+	int received[MP_PRODUCERS] = {0};
+	int total = 0;
+	size_t count;
+
+	atomic_set(&mp_callbacks, 0);
+
+	for (uintptr_t i = 0; i < MP_PRODUCERS; i++) {
+		k_thread_create(&mp_threads[i], mp_stacks[i], MP_STACK_SIZE, mp_producer,
+				(void *)i, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	while (total < (MP_PRODUCERS * MP_CHAINS)) {
+		count = rtio_cqe_consume_batch(&r_mp, cqes, ARRAY_SIZE(cqes));
+		for (size_t i = 0; i < count; i++) {
+			zassert_ok(cqes[i]->result);
+			received[(uintptr_t)cqes[i]->userdata]++;
+			rtio_cqe_release(&r_mp, cqes[i]);
+			k_sem_give(&mp_slots);
+		}
+
+		total += count;
+		k_yield();
+	}
+
+	for (int i = 0; i < MP_PRODUCERS; i++) {
+		k_thread_join(&mp_threads[i], K_FOREVER);
+		zassert_equal(received[i], MP_CHAINS, "Expected all chains of producer %d", i);
+	}
+
+	zassert_equal(atomic_get(&mp_callbacks), MP_PRODUCERS * MP_CHAINS * 2,
+		      "Expected both parts of every chain to run");
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void *rtio_api_setup(void)
 {
 #ifdef CONFIG_USERSPACE
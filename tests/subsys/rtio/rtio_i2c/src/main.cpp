@@ -5,6 +5,7 @@
 #include "blocking_emul.hpp"
 
 #include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c/rtio.h>
 #include <zephyr/fff.h>
 #include <zephyr/rtio/rtio.h>
 #include <zephyr/ztest.h>
@@ -309,3 +310,74 @@ ZTEST(rtio_i2c, test_work_queue_overflow)
 	rtio_cqe_release(&test_rtio_ctx, cqe[1]);
 	rtio_cqe_release(&test_rtio_ctx, cqe[2]);
 }
+
+#ifdef CONFIG_I2C_RTIO_SCHED
+static struct i2c_rtio sched_ctx;
+
+static void sched_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	/* The bus is driven by the test through i2c_rtio_complete() */
+	(void)i2c_rtio_submit(&sched_ctx, iodev_sqe);
+}
+
+static const struct rtio_iodev_api sched_iodev_api = {
+	.submit = sched_iodev_submit,
+};
+
+RTIO_IODEV_DEFINE(sched_iodev_a, &sched_iodev_api, NULL);
+RTIO_IODEV_DEFINE(sched_iodev_b, &sched_iodev_api, NULL);
+RTIO_DEFINE(sched_rtio_ctx, 8, 8);
+#endif
+
+ZTEST(rtio_i2c, test_sched_order)
+{
+#ifdef CONFIG_I2C_RTIO_SCHED
+	static const struct {
+		const struct rtio_iodev *iodev;
+		uint8_t prio;
+	} txns[] = {
+		{&sched_iodev_a, RTIO_PRIO_NORM},
+		{&sched_iodev_b, RTIO_PRIO_LOW},
+		{&sched_iodev_a, RTIO_PRIO_NORM},
+		{&sched_iodev_b, RTIO_PRIO_HIGH},
+		{&sched_iodev_a, RTIO_PRIO_NORM},
+		{&sched_iodev_b, RTIO_PRIO_NORM},
+	};
+	/*
+	 * The first transaction starts right away, then the high priority one. The bus stays on
+	 * target b for the later normal priority one before going back to target a.
+	 */
+	static const uintptr_t expected[] = {0, 3, 5, 2, 4, 1};
+
+	i2c_rtio_init(&sched_ctx, i2c_dev);
+
+	for (uintptr_t i = 0; i < ARRAY_SIZE(txns); i++) {
+		struct rtio_sqe *sqe = rtio_sqe_acquire(&sched_rtio_ctx);
+
+		zassert_not_null(sqe);
+		rtio_sqe_prep_nop(sqe, txns[i].iodev, (void *)i);
+		sqe->prio = txns[i].prio;
+	}
+
+	zassert_ok(rtio_submit(&sched_rtio_ctx, 0));
+
+	for (size_t i = 0; i < ARRAY_SIZE(expected); i++) {
+		zassert_not_null(sched_ctx.txn_head);
+		zassert_equal(expected[i], (uintptr_t)sched_ctx.txn_head->sqe.userdata,
+			      "Unexpected transaction started at step %zu", i);
+		zassert_equal(i < ARRAY_SIZE(expected) - 1, i2c_rtio_complete(&sched_ctx, 0));
+	}
+
+	zassert_is_null(sched_ctx.txn_head);
+
+	for (size_t i = 0; i < ARRAY_SIZE(expected); i++) {
+		struct rtio_cqe *cqe = rtio_cqe_consume(&sched_rtio_ctx);
+
+		zassert_not_null(cqe);
+		zassert_equal((void *)expected[i], cqe->userdata);
+		rtio_cqe_release(&sched_rtio_ctx, cqe);
+	}
+#else
+	ztest_test_skip();
+#endif
+}
@@ -1326,3 +1326,113 @@ ZTEST(settings_functional, test_single_save)
 	settings_deregister(&first_settings);
 #endif
 }
+
+ZTEST(settings_functional, test_transaction)
+{
+#ifdef CONFIG_SETTINGS_TRANSACTION
+	uint8_t val;
+	ssize_t len;
+	int rc;
+
+	settings_subsys_init();
+
+	rc = settings_save_one("txn/a", &(uint8_t){0x01}, sizeof(uint8_t));
+	zassert_equal(rc, 0, "can't save value");
+	rc = settings_save_one("txn/c", &(uint8_t){0x03}, sizeof(uint8_t));
+	zassert_equal(rc, 0, "can't save value");
+
+	/* Aborted transaction */
+	rc = settings_transaction_begin();
+	zassert_equal(rc, 0, "can't begin transaction");
+	zassert_equal(settings_transaction_begin(), -EBUSY, "nested transaction");
+	rc = settings_transaction_set("txn/a", &(uint8_t){0x11}, sizeof(uint8_t));
+	zassert_equal(rc, 0, "can't set value");
+	settings_transaction_abort();
+
+	len = settings_load_one("txn/a", &val, sizeof(val));
+	zassert_equal(len, sizeof(val), "can't load value");
+	zassert_equal(val, 0x01, "aborted transaction saved");
+	zassert_equal(settings_transaction_set("txn/a", &val, sizeof(val)), -EINVAL,
+		      "set outside of transaction");
+
+	/* Committed transaction */
+	rc = settings_transaction_begin();
+	zassert_equal(rc, 0, "can't begin transaction");
+	rc = settings_transaction_set("txn/a", &(uint8_t){0x11}, sizeof(uint8_t));
+	zassert_equal(rc, 0, "can't set value");
+	rc = settings_transaction_set("txn/b", &(uint8_t){0x12}, sizeof(uint8_t));
+	zassert_equal(rc, 0, "can't set value");
+	rc = settings_transaction_set("txn/c", NULL, 0);
+	zassert_equal(rc, 0, "can't set deletion");
+	rc = settings_transaction_commit();
+	zassert_equal(rc, 0, "can't commit transaction");
+
+	len = settings_load_one("txn/a", &val, sizeof(val));
+	zassert_equal(len, sizeof(val), "can't load value");
+	zassert_equal(val, 0x11, "transaction not saved");
+	len = settings_load_one("txn/b", &val, sizeof(val));
+	zassert_equal(len, sizeof(val), "can't load value");
+	zassert_equal(val, 0x12, "transaction not saved");
+	len = settings_load_one("txn/c", &val, sizeof(val));
+	zassert_equal(len, 0, "item not deleted");
+
+	(void)settings_delete("txn/a");
+	(void)settings_delete("txn/b");
+#else
+	ztest_test_skip();
+#endif
+}
+
+#ifdef CONFIG_SETTINGS_HANDLER_HASH
+static uint8_t hash_parent_val;
+static uint8_t hash_child_val;
+
+static int hash_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+		    uint8_t *val)
+{
+	if (!key || (strcmp(key, "val") != 0) || (len != sizeof(*val))) {
+		return -ENOENT;
+	}
+
+	return (read_cb(cb_arg, val, sizeof(*val)) == sizeof(*val)) ? 0 : -EIO;
+}
+
+static int hash_parent_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	return hash_set(key, len, read_cb, cb_arg, &hash_parent_val);
+}
+
+static int hash_child_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	return hash_set(key, len, read_cb, cb_arg, &hash_child_val);
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(hash_parent, "hh", NULL, hash_parent_set, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(hash_child, "hh/sub", NULL, hash_child_set, NULL, NULL);
+#endif
+
+ZTEST(settings_functional, test_handler_hash)
+{
+#ifdef CONFIG_SETTINGS_HANDLER_HASH
+	int rc;
+
+	settings_subsys_init();
+
+	rc = settings_save_one("hh/val", &(uint8_t){0x21}, sizeof(uint8_t));
+	zassert_equal(rc, 0, "can't save value");
+	rc = settings_save_one("hh/sub/val", &(uint8_t){0x42}, sizeof(uint8_t));
+	zassert_equal(rc, 0, "can't save value");
+
+	hash_parent_val = 0;
+	hash_child_val = 0;
+	rc = settings_load_subtree("hh");
+	zassert_equal(rc, 0, "can't load subtree");
+	zassert_equal(hash_parent_val, 0x21, "parent handler not called");
+	zassert_equal(hash_child_val, 0x42, "longest matching handler not called");
+
+	(void)settings_delete("hh/val");
+	(void)settings_delete("hh/sub/val");
+#else
+	ztest_test_skip();
+#endif
+}
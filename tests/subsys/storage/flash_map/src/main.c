@@ -321,6 +321,71 @@ ZTEST(flash_map, test_flash_area_copy)
 	zassert_mem_equal(src_buf, dst_buf, sizeof(src_buf), "Data mismatch after copy");
 }
 
+ZTEST(flash_map, test_flash_area_write_combine)
+{
+#ifdef CONFIG_FLASH_MAP_WRITE_COMBINE
+	const struct flash_area *fa = FIXED_PARTITION(SLOT1_PARTITION);
+	uint32_t wbs = flash_area_align(fa);
+	uint8_t data[16] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
+			    0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xf0, 0x0f};
+	uint8_t buf[sizeof(data)];
+	size_t len = ROUND_DOWN(sizeof(data), wbs);
+	int rc;
+
+	zassume_true(len >= wbs, "Write block size too large");
+
+	rc = flash_area_erase(fa, 0, fa->fa_size);
+	zassert_equal(rc, 0, "flash area erase fail");
+
+	for (size_t off = 0; off < len; off += wbs) {
+		rc = flash_area_write(fa, off, &data[off], wbs);
+		zassert_equal(rc, 0, "flash area write fail");
+	}
+
+	/* Not programmed yet */
+	rc = flash_read(flash_area_get_device(fa), fa->fa_off, buf, len);
+	zassert_equal(rc, 0, "flash read fail");
+	for (size_t i = 0; i < len; i++) {
+		zassert_equal(buf[i], flash_area_erased_val(fa), "Data programmed early");
+	}
+
+	rc = flash_area_flush(fa);
+	zassert_equal(rc, 0, "flash area flush fail");
+
+	rc = flash_read(flash_area_get_device(fa), fa->fa_off, buf, len);
+	zassert_equal(rc, 0, "flash read fail");
+	zassert_mem_equal(buf, data, len, "Data not programmed on flush");
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(flash_map, test_flash_area_mmap)
+{
+	const struct flash_area *fa = FIXED_PARTITION(SLOT1_PARTITION);
+	uint8_t buf[16];
+	const void *ptr;
+	int rc;
+
+	rc = flash_area_mmap(fa, fa->fa_size, 1, &ptr);
+	zassert_true(rc == -EINVAL || rc == -ENOTSUP, "Unexpected mmap result %d", rc);
+
+	rc = flash_area_mmap(fa, 0, sizeof(buf), &ptr);
+#if CONFIG_FLASH_MAP_MMAP
+	if (fa->fa_mmap == NULL) {
+		zassert_equal(rc, -ENOTSUP, "Unmapped area mapped");
+		ztest_test_skip();
+	}
+
+	zassert_equal(rc, 0, "flash area mmap fail");
+	rc = flash_area_read(fa, 0, buf, sizeof(buf));
+	zassert_equal(rc, 0, "flash area read fail");
+	zassert_mem_equal(ptr, buf, sizeof(buf), "Mapped data differs");
+#else
+	zassert_equal(rc, -ENOTSUP, "mmap without CONFIG_FLASH_MAP_MMAP");
+#endif
+}
+
 ZTEST(flash_map, test_parameter_overflows)
 {
 	const struct flash_area *fa;
@@ -192,6 +192,35 @@ ZTEST(lib_stream_flash, test_stream_flash_buffered_write_cross_buf_border)
 	VERIFY_WRITTEN(0, BUF_LEN * 2 + BUF_LEN / 2);
 }
 
+ZTEST(lib_stream_flash, test_stream_flash_buffered_write_in_place)
+{
+	int rc;
+
+	init_target();
+
+	/* Without a callback, whole buffers are programmed from the source */
+	rc = stream_flash_init(&ctx, fdev, generic_buf, BUF_LEN, FLASH_BASE, FLASH_AVAILABLE,
+			       NULL);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, written_pattern, BUF_LEN * 2, false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), BUF_LEN * 2, "wrong bytes written");
+	zassert_equal(stream_flash_bytes_buffered(&ctx), 0, "nothing should be buffered");
+	VERIFY_WRITTEN(0, BUF_LEN * 2);
+
+	/* Data following a partial buffer goes through the buffer first */
+	rc = stream_flash_buffered_write(&ctx, written_pattern, 128, false);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, written_pattern, BUF_LEN * 2, false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_buffered(&ctx), 128, "wrong bytes buffered");
+
+	rc = stream_flash_buffered_write(&ctx, written_pattern, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	VERIFY_WRITTEN(0, BUF_LEN * 4 + 128);
+}
+
 ZTEST(lib_stream_flash, test_stream_flash_buffered_write_unaligned)
 {
 	int rc;
@@ -8,6 +8,7 @@
 #include <zephyr/irq_offload.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/net_buf.h>
 #include <zephyr/zbus/zbus.h>
 #include <zephyr/ztest.h>
 LOG_MODULE_DECLARE(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -361,8 +362,18 @@ ZTEST(basic, test_specification_based__zbus_chan)
 		      "MSG_SUBSCRIBERS it is necessary at least one per each and a spare one.");
 
 	zassert_equal(0, zbus_sub_wait_msg(&foo_msg_sub, &chan, &msg, K_MSEC(500)));
-	zbus_obs_set_enable(&foo_msg_sub, false);
 	zbus_obs_set_enable(&foo2_msg_sub, false);
+
+	struct net_buf *buf;
+
+	msg = 42;
+	zassert_equal(0, zbus_chan_pub(&msg_sub_no_pool_chan, &msg, K_MSEC(200)));
+	zassert_equal(0, zbus_sub_wait_msg_buf(&foo_msg_sub, &chan, &buf, K_MSEC(500)));
+	zassert_equal_ptr(&msg_sub_no_pool_chan, chan);
+	zassert_equal(sizeof(msg), buf->len);
+	zassert_mem_equal(&msg, buf->data, sizeof(msg));
+	net_buf_unref(buf);
+	zbus_obs_set_enable(&foo_msg_sub, false);
 }
 
 static bool always_true_chan_iterator(const struct zbus_channel *chan)
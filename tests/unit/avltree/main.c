@@ -0,0 +1,148 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/sys/avl.h>
+
+#include "../../../lib/utils/avl.c"
+
+#define MAX_NODES 256
+
+struct item {
+	struct avlnode node;
+	uint32_t key;
+	bool in_tree;
+};
+
+static struct avltree test_avltree;
+
+static struct item items[MAX_NODES];
+
+static int in_tree;
+
+static bool node_lessthan(struct avlnode *a, struct avlnode *b)
+{
+	return CONTAINER_OF(a, struct item, node)->key < CONTAINER_OF(b, struct item, node)->key;
+}
+
+/* Same LCRNG as the rbtree test, repeatable across platforms */
+static unsigned int next_rand_mod(unsigned int mod)
+{
+	static unsigned long long state = 123456789; /* seed */
+
+	state = state * 2862933555777941757ul + 3037000493ul;
+
+	return ((unsigned int)(state >> 32)) % mod;
+}
+
+/* Returns the height of the subtree, checking parents and balances */
+static int check_subtree(struct avlnode *node, struct avlnode *parent, int *count)
+{
+	int l, r;
+
+	if (node == NULL) {
+		return 0;
+	}
+
+	zassert_equal(get_parent(node), parent, "wrong parent");
+
+	l = check_subtree(node->children[0], node, count);
+	r = check_subtree(node->children[1], node, count);
+
+	zassert_equal(r - l, get_balance(node), "wrong balance");
+	(*count)++;
+
+	return 1 + MAX(l, r);
+}
+
+static void check_tree(void)
+{
+	struct avlnode *node, *min = NULL, *max = NULL;
+	struct item *prev = NULL, *item;
+	int count = 0;
+
+	(void)check_subtree(test_avltree.root, NULL, &count);
+	zassert_equal(count, in_tree, "wrong node count");
+
+	count = 0;
+	AVL_FOR_EACH_CONTAINER(&test_avltree, item, node) {
+		if (prev != NULL) {
+			zassert_true(prev->key <= item->key, "out of order");
+		}
+		if (min == NULL) {
+			min = &item->node;
+		}
+		max = &item->node;
+		prev = item;
+		count++;
+	}
+	zassert_equal(count, in_tree, "wrong iteration count");
+	zassert_equal(avl_get_min(&test_avltree), min, "wrong min");
+	zassert_equal(avl_get_max(&test_avltree), max, "wrong max");
+
+	count = 0;
+	for (node = avl_get_max(&test_avltree); node != NULL; node = avl_prev(node)) {
+		count++;
+	}
+	zassert_equal(count, in_tree, "wrong reverse iteration count");
+
+	for (int i = 0; i < MAX_NODES; i++) {
+		zassert_equal(avl_contains(&test_avltree, &items[i].node), items[i].in_tree,
+			      "wrong membership of node %d", i);
+	}
+}
+
+ZTEST(avltree_api, test_avltree_spam)
+{
+	test_avltree.lessthan_fn = node_lessthan;
+
+	/* Unique keys, in random order */
+	for (int i = 0; i < MAX_NODES; i++) {
+		items[i].key = next_rand_mod(64) * MAX_NODES + i;
+	}
+
+	for (int n = 0; n < 8 * MAX_NODES; n++) {
+		struct item *item = &items[next_rand_mod(MAX_NODES)];
+
+		if (item->in_tree) {
+			avl_remove(&test_avltree, &item->node);
+			in_tree--;
+		} else {
+			avl_insert(&test_avltree, &item->node);
+			in_tree++;
+		}
+		item->in_tree = !item->in_tree;
+
+		check_tree();
+	}
+}
+
+ZTEST(avltree_api, test_avltree_equal_keys)
+{
+	static struct item equal_items[16];
+	struct avltree tree = { .lessthan_fn = node_lessthan };
+	struct avlnode *node, *next;
+	int i = 0;
+
+	/* Nodes comparing as equal are kept in insertion order */
+	for (int n = 0; n < ARRAY_SIZE(equal_items); n++) {
+		equal_items[n].key = 42;
+		avl_insert(&tree, &equal_items[n].node);
+	}
+
+	AVL_FOR_EACH(&tree, node) {
+		zassert_equal(node, &equal_items[i].node, "not in insertion order");
+		i++;
+	}
+
+	AVL_FOR_EACH_SAFE(&tree, node, next) {
+		avl_remove(&tree, node);
+	}
+
+	zassert_is_null(tree.root);
+	zassert_is_null(avl_get_min(&tree));
+}
+
+ZTEST_SUITE(avltree_api, NULL, NULL, NULL, NULL, NULL);
@@ -74,6 +74,32 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+ZTEST(crc, test_crc32_long)
+{
+	uint8_t data[256];
+	uint32_t crc;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	zassert_equal(crc32_ieee(data, sizeof(data)), 0x29058C73);
+	zassert_equal(crc32_c(0, data, sizeof(data), true, true), 0x9C44184B);
+
+	/* Chunks not multiple of the word size, nor aligned */
+	crc = 0;
+	for (size_t i = 0; i < sizeof(data); i += 13) {
+		crc = crc32_ieee_update(crc, &data[i], MIN(13, sizeof(data) - i));
+	}
+	zassert_equal(crc, 0x29058C73);
+
+	for (size_t i = 0; i < sizeof(data); i += 13) {
+		crc = crc32_c(crc, &data[i], MIN(13, sizeof(data) - i), i == 0,
+			      (i + 13) >= sizeof(data));
+	}
+	zassert_equal(crc, 0x9C44184B);
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };